@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Write the Huffman coded copies of the localized OLED fonts that FONT_COMPRESSED builds use.
+
+Reads each src/graphics/fonts/OLEDDisplayFonts<locale>.cpp and writes src/graphics/fonts/CompressedFonts<locale>.cpp, in the
+format CompressedFont.h describes.  Run it again after editing a font.
+"""
+
+import heapq
+import os
+import re
+import sys
+
+MAXBITS = 16
+LOCALES = ["CS", "PL", "RU", "UA"]
+FONTS = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "graphics", "fonts")
+
+
+def read_fonts(path):
+    src = open(path, encoding="utf-8").read()
+    for m in re.finditer(r"const uint8_t (\w+)\[\] PROGMEM = \{(.*?)\};", src, re.S):
+        body = re.sub(r"//[^\n]*", "", m.group(2))
+        yield m.group(1), bytes(int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]+", body))
+
+
+def code_lengths(freq):
+    """Huffman code length of each byte value"""
+    if len(freq) == 1:
+        return {next(iter(freq)): 1}
+    heap = [(f, i, [s]) for i, (s, f) in enumerate(sorted(freq.items()))]
+    heapq.heapify(heap)
+    lengths = dict.fromkeys(freq, 0)
+    tie = len(heap)
+    while len(heap) > 1:
+        a, b = heapq.heappop(heap), heapq.heappop(heap)
+        for s in a[2] + b[2]:
+            lengths[s] += 1
+        heapq.heappush(heap, (a[0] + b[0], tie, a[2] + b[2]))
+        tie += 1
+    if max(lengths.values()) > MAXBITS:
+        sys.exit("Huffman code longer than %d bits" % MAXBITS)
+    return lengths
+
+
+def canonical(lengths):
+    """The code of each byte value, and the counts and symbols table that describe them"""
+    order = sorted(lengths, key=lambda s: (lengths[s], s))
+    codes, code, prev = {}, 0, 0
+    for s in order:
+        code <<= lengths[s] - prev
+        prev = lengths[s]
+        codes[s] = code
+        code += 1
+    counts = [sum(1 for s in order if lengths[s] == n) for n in range(1, MAXBITS + 1)]
+    if max(counts) > 255:
+        sys.exit("Too many codes of one length for the table")
+    return codes, bytes(counts) + bytes(order)
+
+
+def encode(glyph, codes, lengths):
+    bits = "".join(format(codes[b], "0%db" % lengths[b]) for b in glyph)
+    bits += "0" * (-len(bits) % 8)
+    return bytes(int(bits[i : i + 8], 2) for i in range(0, len(bits), 8))
+
+
+def decode(coded, table, n):
+    """What the firmware does, to check the round trip"""
+    counts, symbols = table[:MAXBITS], table[MAXBITS:]
+    bits = "".join(format(b, "08b") for b in coded)
+    out, pos = bytearray(), 0
+    for _ in range(n):
+        code = first = index = 0
+        for length in range(1, MAXBITS + 1):
+            code |= int(bits[pos])
+            pos += 1
+            if code - counts[length - 1] < first:
+                out.append(symbols[index + code - first])
+                break
+            index += counts[length - 1]
+            first = (first + counts[length - 1]) << 1
+            code <<= 1
+    return bytes(out)
+
+
+def compress(font):
+    num = font[3]
+    jump = font[4 : 4 + 4 * num]
+    data = font[4 + 4 * num :]
+    glyphs = []
+    for c in range(num):
+        msb, lsb, size, _ = jump[4 * c : 4 * c + 4]
+        glyphs.append(None if msb == 0xFF and lsb == 0xFF else data[(msb << 8) | lsb :][:size])
+
+    freq = {}
+    for g in glyphs:
+        for b in g or b"":
+            freq[b] = freq.get(b, 0) + 1
+    lengths = code_lengths(freq or {0: 1})
+    codes, table = canonical(lengths)
+
+    header, coded = bytearray(font[:4]), bytearray()
+    for c, g in enumerate(glyphs):
+        width = jump[4 * c + 3]
+        if g is None:
+            header += bytes([0xFF, 0xFF, jump[4 * c + 2], width])
+            continue
+        enc = encode(g, codes, lengths)
+        assert decode(enc, table, len(g)) == g
+        header += bytes([len(coded) >> 8, len(coded) & 0xFF, len(g), width])
+        coded += enc
+    if len(coded) >= 0xFFFF:
+        sys.exit("Coded glyphs too big for 16 bit offsets")
+    return header, coded, table
+
+
+def c_array(name, data):
+    lines = ["const uint8_t %s[] PROGMEM = {" % name]
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join("0x%02X," % b for b in data[i : i + 16]))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    for locale in LOCALES:
+        out = [
+            "// Generated by bin/compress-oled-fonts.py from OLEDDisplayFonts%s.cpp, don't edit" % locale,
+            "// trunk-ignore-all(clang-format): Generated",
+            "#include \"OLEDDisplayFonts%s.h\"" % locale,
+            "#if defined(OLED_%s) && FONT_COMPRESSED" % locale,
+            "",
+        ]
+        raw = coded_total = 0
+        for name, font in read_fonts(os.path.join(FONTS, "OLEDDisplayFonts%s.cpp" % locale)):
+            header, coded, table = compress(font)
+            raw += len(font)
+            coded_total += len(header) + len(coded) + len(table)
+            out += [
+                c_array(name + "_header", header),
+                c_array(name + "_data", coded),
+                c_array(name + "_huffman", table),
+                "const CompressedFont %s = {%s_header, %s_data, %s_huffman};" % (name, name, name, name),
+                "",
+            ]
+        out.append("#endif")
+        open(os.path.join(FONTS, "CompressedFonts%s.cpp" % locale), "w").write("\n".join(out) + "\n")
+        print("%s: %d bytes coded from %d" % (locale, coded_total, raw))
+
+
+if __name__ == "__main__":
+    main()
@@ -67,6 +67,9 @@ if platform.name == "espressif32":
 
     env.AddPostAction("$BUILD_DIR/${PROGNAME}.bin", esp32_create_combined_bin)
 
+    # Let PaxcounterModule see every address libpax counts, the wrapper is in src/modules/esp32/PaxcounterModule.cpp.
+    env.Append(LINKFLAGS=["-Wl,--wrap=mac_add"])
+
     esp32_kind = env.GetProjectOption("custom_esp32_kind")
     if esp32_kind == "esp32":
         # Free up some IRAM by removing auxiliary SPI flash chip drivers.
@@ -14,6 +14,17 @@
 #define LEGACY_LOGRADIO_UUID "6c6fd238-78fa-436b-aacf-15c5be1ef2e2"
 #define LOGRADIO_UUID "5a3d6e49-06e6-4423-9944-e9de8cdf9547"
 
+// Connection parameters we ask the phone for once it connects, so the NodeDB download isn't paced by its default interval
+#ifndef BLE_CONN_INTERVAL_MIN
+#define BLE_CONN_INTERVAL_MIN 12 // 15ms in 1.25ms units, the fastest iOS will accept
+#endif
+#ifndef BLE_CONN_INTERVAL_MAX
+#define BLE_CONN_INTERVAL_MAX 24 // 30ms
+#endif
+#ifndef BLE_CONN_SUPERVISION_TIMEOUT
+#define BLE_CONN_SUPERVISION_TIMEOUT 400 // 4s in 10ms units
+#endif
+
 // NRF52 wants these constants as byte arrays
 // Generated here https://yupana-engineering.com/online-uuid-to-c-array-converter - but in REVERSE BYTE ORDER
 extern const uint8_t MESH_SERVICE_UUID_16[], TORADIO_UUID_16[16u], FROMRADIO_UUID_16[], FROMNUM_UUID_16[], LOGRADIO_UUID_16[];
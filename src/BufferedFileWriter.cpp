@@ -0,0 +1,96 @@
+#include "BufferedFileWriter.h"
+#include "SPILock.h"
+#include "sleep.h"
+
+#ifdef FSCom
+
+BufferedFileWriter::BufferedFileWriter(const char *filename, const char *header, size_t bufferSize, uint32_t flushMsec)
+    : concurrency::OSThread("BufferedFile"), filename(filename), header(header), bufferSize(bufferSize), flushMsec(flushMsec)
+{
+    rebootObserver.observe(&notifyReboot);
+    deepSleepObserver.observe(&notifyDeepSleep);
+    disable(); // Nothing to flush until the first write
+}
+
+BufferedFileWriter::~BufferedFileWriter()
+{
+    sync();
+    delete[] buf;
+}
+
+size_t BufferedFileWriter::write(const uint8_t *buffer, size_t size)
+{
+    if (!buf) {
+        buf = new uint8_t[bufferSize];
+        if (!buf)
+            return 0;
+    }
+
+    if (used + size > bufferSize)
+        sync();
+    if (size > bufferSize)
+        return writeFile(buffer, size) ? size : 0; // Wouldn't fit even in an empty buffer
+
+    if (!used) {
+        // Start the clock on the oldest byte we hold
+        enabled = true;
+        setIntervalFromNow(flushMsec);
+    }
+    memcpy(buf + used, buffer, size);
+    used += size;
+    return size;
+}
+
+bool BufferedFileWriter::sync()
+{
+    if (!used)
+        return true;
+    bool ok = writeFile(buf, used);
+    used = 0;
+    return ok;
+}
+
+int32_t BufferedFileWriter::runOnce()
+{
+    sync();
+    return disable();
+}
+
+bool BufferedFileWriter::writeFile(const uint8_t *data, size_t len)
+{
+    concurrency::LockGuard g(spiLock);
+
+#ifdef ARCH_ESP32
+    if (minFreeBytes && FSCom.totalBytes() - FSCom.usedBytes() < minFreeBytes) {
+        LOG_WARN("Not enough free space to write %u bytes to %s", len, filename);
+        return false;
+    }
+#endif
+
+    bool exists = FSCom.exists(filename);
+    if (!exists) {
+        const char *slash = strrchr(filename, '/');
+        if (slash && slash != filename) {
+            String dir(filename);
+            FSCom.mkdir(dir.substring(0, slash - filename).c_str());
+        }
+    }
+
+    File f = FSCom.open(filename, FILE_O_APPEND);
+    if (!f) {
+        LOG_ERROR("Can't open %s for appending", filename);
+        return false;
+    }
+    bool ok = true;
+    if (!exists && header)
+        ok = f.println(header) > 0;
+    ok = ok && f.write(data, len) == len;
+    f.flush();
+    f.close();
+    fileManifestChanged();
+    if (!ok)
+        LOG_ERROR("Write to %s failed", filename);
+    return ok;
+}
+
+#endif
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "FSCommon.h"
+#include "Observer.h"
+#include "concurrency/OSThread.h"
+#include "configuration.h"
+
+#ifdef FSCom
+
+#ifndef BUFFERED_FILE_SIZE
+#define BUFFERED_FILE_SIZE 1024
+#endif
+#ifndef BUFFERED_FILE_FLUSH_MSEC
+#define BUFFERED_FILE_FLUSH_MSEC (30 * 1000)
+#endif
+
+/**
+ * Appends to a log file through a RAM buffer, so a stream of small records costs one open/write/close of the file per
+ * buffer full instead of one per record (each of which may rewrite a flash block and hold spiLock while the radio waits).
+ *
+ * The buffer is written out when it fills, once its oldest byte is flushMsec old, and before a reboot or deep sleep.  It
+ * is only allocated the first time something is written, so an unused writer costs no heap.
+ */
+class BufferedFileWriter : public Print, private concurrency::OSThread
+{
+  public:
+    /// If header is given it is written as the first line of a file we create
+    BufferedFileWriter(const char *filename, const char *header = nullptr, size_t bufferSize = BUFFERED_FILE_SIZE,
+                       uint32_t flushMsec = BUFFERED_FILE_FLUSH_MSEC);
+    ~BufferedFileWriter();
+
+    virtual size_t write(uint8_t ch) override { return write(&ch, 1); }
+    virtual size_t write(const uint8_t *buffer, size_t size) override;
+
+    /// Don't write to the file while the filesystem has less than this many bytes free (where we can tell)
+    void setMinFreeBytes(size_t bytes) { minFreeBytes = bytes; }
+
+    /// Write out anything buffered now, @return false if it couldn't be written (the data is dropped either way)
+    bool sync();
+
+  protected:
+    virtual int32_t runOnce() override;
+
+  private:
+    const char *filename;
+    const char *header;
+    uint8_t *buf = nullptr;
+    size_t bufferSize;
+    size_t used = 0;
+    uint32_t flushMsec;
+    size_t minFreeBytes = 0;
+
+    bool writeFile(const uint8_t *data, size_t len);
+
+    CallbackObserver<BufferedFileWriter, void *> rebootObserver =
+        CallbackObserver<BufferedFileWriter, void *>(this, &BufferedFileWriter::onShutdown);
+    CallbackObserver<BufferedFileWriter, void *> deepSleepObserver =
+        CallbackObserver<BufferedFileWriter, void *>(this, &BufferedFileWriter::onShutdown);
+
+    int onShutdown(void *unused)
+    {
+        sync();
+        return 0;
+    }
+};
+
+#endif
@@ -24,6 +24,10 @@
 #define MESHTASTIC_LOG_LEVEL_CRIT "CRIT "
 #define MESHTASTIC_LOG_LEVEL_TRACE "TRACE"
 
+#ifndef DEBUG_LOG_MAX_LEVEL
+#define DEBUG_LOG_MAX_LEVEL LOG_NUM_TRACE // A LogLevelNum, calls to LOG_* above this level are compiled out, arguments and all
+#endif
+
 #include "SerialConsole.h"
 
 // If defined we will include support for ARM ICE "semihosting" for a virtual
@@ -46,12 +50,18 @@
 #define LOG_TRACE(...) SEGGER_RTT_printf(0, __VA_ARGS__)
 #else
 #if defined(DEBUG_PORT) && !defined(DEBUG_MUTE)
-#define LOG_DEBUG(...) DEBUG_PORT.log(MESHTASTIC_LOG_LEVEL_DEBUG, __VA_ARGS__)
-#define LOG_INFO(...) DEBUG_PORT.log(MESHTASTIC_LOG_LEVEL_INFO, __VA_ARGS__)
-#define LOG_WARN(...) DEBUG_PORT.log(MESHTASTIC_LOG_LEVEL_WARN, __VA_ARGS__)
-#define LOG_ERROR(...) DEBUG_PORT.log(MESHTASTIC_LOG_LEVEL_ERROR, __VA_ARGS__)
-#define LOG_CRIT(...) DEBUG_PORT.log(MESHTASTIC_LOG_LEVEL_CRIT, __VA_ARGS__)
-#define LOG_TRACE(...) DEBUG_PORT.log(MESHTASTIC_LOG_LEVEL_TRACE, __VA_ARGS__)
+// Arguments are only evaluated for messages that get past both the compile time and the runtime limit
+#define MESHTASTIC_LOG(num, level, ...)                                                                                          \
+    do {                                                                                                                         \
+        if ((num) <= DEBUG_LOG_MAX_LEVEL && DEBUG_PORT.wantsLog(num))                                                            \
+            DEBUG_PORT.log(num, level, __VA_ARGS__);                                                                             \
+    } while (0)
+#define LOG_DEBUG(...) MESHTASTIC_LOG(LOG_NUM_DEBUG, MESHTASTIC_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define LOG_INFO(...) MESHTASTIC_LOG(LOG_NUM_INFO, MESHTASTIC_LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_WARN(...) MESHTASTIC_LOG(LOG_NUM_WARN, MESHTASTIC_LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_ERROR(...) MESHTASTIC_LOG(LOG_NUM_ERROR, MESHTASTIC_LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_CRIT(...) MESHTASTIC_LOG(LOG_NUM_ERROR, MESHTASTIC_LOG_LEVEL_CRIT, __VA_ARGS__)
+#define LOG_TRACE(...) MESHTASTIC_LOG(LOG_NUM_TRACE, MESHTASTIC_LOG_LEVEL_TRACE, __VA_ARGS__)
 #else
 #define LOG_DEBUG(...)
 #define LOG_INFO(...)
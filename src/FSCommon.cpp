@@ -41,7 +41,7 @@ bool copyFile(const char *from, const char *to)
 {
 #ifdef FSCom
     // take SPI Lock
-    concurrency::LockGuard g(spiLock);
+    SPIGuard g(SPI_CLIENT_STORAGE);
     unsigned char cbuffer[16];
 
     File f1 = FSCom.open(from, FILE_O_READ);
@@ -64,6 +64,7 @@ bool copyFile(const char *from, const char *to)
     f2.flush();
     f2.close();
     f1.close();
+    fileManifestChanged();
     return true;
 #endif
 }
@@ -79,23 +80,17 @@ bool copyFile(const char *from, const char *to)
 bool renameFile(const char *pathFrom, const char *pathTo)
 {
 #ifdef FSCom
-
-#ifdef ARCH_ESP32
     // take SPI Lock
-    spiLock->lock();
-    // rename was fixed for ESP32 IDF LittleFS in April
-    bool result = FSCom.rename(pathFrom, pathTo);
-    spiLock->unlock();
-    return result;
-#else
-    // copyFile does its own locking.
-    if (copyFile(pathFrom, pathTo) && FSCom.remove(pathFrom)) {
+    SPIGuard g(SPI_CLIENT_STORAGE);
+    fileManifestChanged();
+    // Every filesystem we use is LittleFS (or POSIX on portduino), whose rename replaces an existing pathTo in one step, so
+    // there is never a moment with neither the old nor the new file on the disk
+    if (FSCom.rename(pathFrom, pathTo))
         return true;
-    } else {
-        return false;
-    }
-#endif
-
+    // Older ports refused to rename over an existing file, make room and try once more
+    return FSCom.exists(pathTo) && FSCom.remove(pathTo) && FSCom.rename(pathFrom, pathTo);
+#else
+    return false;
 #endif
 }
 
@@ -152,6 +147,23 @@ std::vector<meshtastic_FileInfo> getFiles(const char *dirname, uint8_t levels)
     return filenames;
 }
 
+static std::vector<meshtastic_FileInfo> fileManifest;
+static bool fileManifestStale = true;
+
+void fileManifestChanged()
+{
+    fileManifestStale = true;
+}
+
+const std::vector<meshtastic_FileInfo> &getFileManifest()
+{
+    if (fileManifestStale) {
+        fileManifestStale = false; // Before the walk, so a write that races with it makes the next call walk again
+        fileManifest = getFiles("/", 10);
+    }
+    return fileManifest;
+}
+
 /**
  * Lists the contents of a directory.
  * We can't use SPILOCK here because of recursion. Callers of this function should use SPILOCK.
@@ -162,6 +174,8 @@ std::vector<meshtastic_FileInfo> getFiles(const char *dirname, uint8_t levels)
  */
 void listDir(const char *dirname, uint8_t levels, bool del)
 {
+    if (del)
+        fileManifestChanged();
 #ifdef FSCom
 #if (defined(ARCH_ESP32) || defined(ARCH_RP2040) || defined(ARCH_PORTDUINO))
     char buffer[255];
@@ -12,6 +12,7 @@
 #define FSBegin() true
 #define FILE_O_WRITE "w"
 #define FILE_O_READ "r"
+#define FILE_O_APPEND "a"
 #endif
 
 #if defined(ARCH_STM32WL)
@@ -19,6 +20,7 @@
 #include "LittleFS.h"
 #define FSCom InternalFS
 #define FSBegin() FSCom.begin()
+#define FILE_O_APPEND FILE_O_WRITE // Adafruit style LittleFS opens for write at the end of the file
 using namespace STM32_LittleFS_Namespace;
 #endif
 
@@ -29,6 +31,7 @@ using namespace STM32_LittleFS_Namespace;
 #define FSBegin() FSCom.begin() // set autoformat
 #define FILE_O_WRITE "w"
 #define FILE_O_READ "r"
+#define FILE_O_APPEND "a"
 #endif
 
 #if defined(ARCH_ESP32)
@@ -38,6 +41,7 @@ using namespace STM32_LittleFS_Namespace;
 #define FSBegin() FSCom.begin(true) // format on failure
 #define FILE_O_WRITE "w"
 #define FILE_O_READ "r"
+#define FILE_O_APPEND "a"
 #endif
 
 #if defined(ARCH_NRF52)
@@ -45,6 +49,7 @@ using namespace STM32_LittleFS_Namespace;
 #include "InternalFileSystem.h"
 #define FSCom InternalFS
 #define FSBegin() FSCom.begin() // InternalFS formats on failure
+#define FILE_O_APPEND FILE_O_WRITE // Adafruit LittleFS opens for write at the end of the file
 using namespace Adafruit_LittleFS_Namespace;
 #endif
 
@@ -53,6 +58,11 @@ void fsListFiles();
 bool copyFile(const char *from, const char *to);
 bool renameFile(const char *pathFrom, const char *pathTo);
 std::vector<meshtastic_FileInfo> getFiles(const char *dirname, uint8_t levels);
+/// Every file on flash, as getFiles("/", 10) would list them, only walking the filesystem again after a change.  Callers hold
+/// spiLock, like for getFiles().
+const std::vector<meshtastic_FileInfo> &getFileManifest();
+/// Call after creating, growing, renaming or removing a file, so getFileManifest() doesn't return a stale list
+void fileManifestChanged();
 void listDir(const char *dirname, uint8_t levels, bool del = false);
 void rmDir(const char *dirname);
 void setupSDCard();
\ No newline at end of file
@@ -1,2 +1,51 @@
 #include "Observer.h"
+#include "concurrency/LockGuard.h"
 #include "configuration.h"
+
+static ObserverLink linkPool[OBSERVER_LINK_POOL_SIZE];
+static ObserverLink *freeLinks;
+static bool poolInitialized;
+
+// Made on first use, observables are often globals that get observed before main() is
+static concurrency::Lock &poolLock()
+{
+    static concurrency::Lock lock;
+    return lock;
+}
+
+ObserverLink *ObserverLink::alloc(void *observer, void *observable)
+{
+    ObserverLink *link;
+    {
+        concurrency::LockGuard g(&poolLock());
+        if (!poolInitialized) {
+            for (size_t i = 0; i < OBSERVER_LINK_POOL_SIZE; i++) {
+                linkPool[i].nextObserver = freeLinks;
+                freeLinks = &linkPool[i];
+            }
+            poolInitialized = true;
+        }
+        link = freeLinks;
+        if (link)
+            freeLinks = link->nextObserver;
+    }
+    if (!link)
+        link = new ObserverLink; // Pool used up, raise OBSERVER_LINK_POOL_SIZE if this is common
+
+    link->observer = observer;
+    link->observable = observable;
+    link->nextObserver = NULL;
+    link->nextObservable = NULL;
+    return link;
+}
+
+void ObserverLink::release(ObserverLink *link)
+{
+    if (link < linkPool || link >= linkPool + OBSERVER_LINK_POOL_SIZE) {
+        delete link;
+        return;
+    }
+    concurrency::LockGuard g(&poolLock());
+    link->nextObserver = freeLinks;
+    freeLinks = link;
+}
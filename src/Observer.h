@@ -1,18 +1,39 @@
 #pragma once
 
 #include <Arduino.h>
-#include <list>
+
+// Subscriptions the firmware makes sit in a fixed pool, so observing doesn't allocate. Only past that do links come from the heap.
+#ifndef OBSERVER_LINK_POOL_SIZE
+#define OBSERVER_LINK_POOL_SIZE 64
+#endif
 
 template <class T> class Observable;
 
+/**
+ * One observer watching one observable, on both of their lists.  Type erased so every Observable<T> shares the one pool.
+ */
+struct ObserverLink {
+    void *observer;               // The Observer<T>
+    void *observable;             // The Observable<T>
+    ObserverLink *nextObserver;   // The next link of the same observable, in the order they subscribed
+    ObserverLink *nextObservable; // The next link of the same observer
+
+    static ObserverLink *alloc(void *observer, void *observable);
+    static void release(ObserverLink *link);
+};
+
 /**
  * An observer which can be mixed in as a baseclass.  Implement onNotify as a method in your class.
  */
 template <class T> class Observer
 {
-    std::list<Observable<T> *> observables;
+    ObserverLink *links = NULL;
 
   public:
+    Observer() {}
+    // A copy watches nothing until told to, the links belong to the original
+    Observer(const Observer &) {}
+    Observer &operator=(const Observer &) { return *this; }
     virtual ~Observer();
 
     /// Stop watching the observable
@@ -24,6 +45,9 @@ template <class T> class Observer
   private:
     friend class Observable<T>;
 
+    /// The observable is going away, drop our link to it
+    void forgetLink(ObserverLink *link);
+
   protected:
     /**
      * returns 0 if other observers should continue to be called
@@ -55,9 +79,14 @@ template <class Callback, class T> class CallbackObserver : public Observer<T>
  */
 template <class T> class Observable
 {
-    std::list<Observer<T> *> observers;
+    ObserverLink *observers = NULL;
 
   public:
+    Observable() {}
+    Observable(const Observable &) {}
+    Observable &operator=(const Observable &) { return *this; }
+    ~Observable();
+
     /**
      * Tell all observers about a change, observers can process arg as they wish
      *
@@ -65,11 +94,12 @@ template <class T> class Observable
      */
     int notifyObservers(T arg)
     {
-        for (typename std::list<Observer<T> *>::const_iterator iterator = observers.begin(); iterator != observers.end();
-             ++iterator) {
-            int result = (*iterator)->onNotify(arg);
+        for (ObserverLink *l = observers; l;) {
+            ObserverLink *next = l->nextObserver; // The observer may unobserve us while notified
+            int result = static_cast<Observer<T> *>(l->observer)->onNotify(arg);
             if (result != 0)
                 return result;
+            l = next;
         }
 
         return 0;
@@ -79,28 +109,71 @@ template <class T> class Observable
     friend class Observer<T>;
 
     // Not called directly, instead call observer.observe
-    void addObserver(Observer<T> *o) { observers.push_back(o); }
+    void addLink(ObserverLink *link)
+    {
+        ObserverLink **tail = &observers;
+        while (*tail)
+            tail = &(*tail)->nextObserver;
+        *tail = link;
+    }
 
-    void removeObserver(Observer<T> *o) { observers.remove(o); }
+    void removeLink(ObserverLink *link)
+    {
+        for (ObserverLink **l = &observers; *l; l = &(*l)->nextObserver)
+            if (*l == link) {
+                *l = link->nextObserver;
+                return;
+            }
+    }
 };
 
 template <class T> Observer<T>::~Observer()
 {
-    for (typename std::list<Observable<T> *>::const_iterator iterator = observables.begin(); iterator != observables.end();
-         ++iterator) {
-        (*iterator)->removeObserver(this);
+    while (links) {
+        ObserverLink *l = links;
+        links = l->nextObservable;
+        static_cast<Observable<T> *>(l->observable)->removeLink(l);
+        ObserverLink::release(l);
     }
-    observables.clear();
 }
 
 template <class T> void Observer<T>::unobserve(Observable<T> *o)
 {
-    o->removeObserver(this);
-    observables.remove(o);
+    for (ObserverLink **l = &links; *l;) {
+        ObserverLink *link = *l;
+        if (link->observable == o) {
+            *l = link->nextObservable;
+            o->removeLink(link);
+            ObserverLink::release(link);
+        } else {
+            l = &link->nextObservable;
+        }
+    }
 }
 
 template <class T> void Observer<T>::observe(Observable<T> *o)
 {
-    observables.push_back(o);
-    o->addObserver(this);
-}
\ No newline at end of file
+    ObserverLink *link = ObserverLink::alloc(this, o);
+    link->nextObservable = links;
+    links = link;
+    o->addLink(link);
+}
+
+template <class T> void Observer<T>::forgetLink(ObserverLink *link)
+{
+    for (ObserverLink **l = &links; *l; l = &(*l)->nextObservable)
+        if (*l == link) {
+            *l = link->nextObservable;
+            return;
+        }
+}
+
+template <class T> Observable<T>::~Observable()
+{
+    while (observers) {
+        ObserverLink *l = observers;
+        observers = l->nextObserver;
+        static_cast<Observer<T> *>(l->observer)->forgetLink(l);
+        ObserverLink::release(l);
+    }
+}
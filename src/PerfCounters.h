@@ -0,0 +1,69 @@
+#pragma once
+
+#include "configuration.h"
+
+/**
+ * Named code regions meshtasticd can profile on Linux: each PERF_SCOPE adds its wall time and, when the kernel lets us
+ * open them, the CPU cycles, instructions and cache misses of the calling thread to that region's totals.  Enabled with
+ * Logging: PerfCounters: true in config.yaml, reported by HostMetrics and as Prometheus text at /metrics on the web server.
+ * On every other platform PERF_SCOPE is nothing.
+ */
+#if ARCH_PORTDUINO
+#include <stdint.h>
+#include <string>
+
+enum PerfRegion {
+    PERF_HANDLE_RECEIVED, // Router::handleReceived, includes the two below
+    PERF_DECODE,          // perhapsDecode
+    PERF_CALL_MODULES,    // MeshModule::callModules
+    PERF_MQTT_SEND,       // MQTT::onSend, includes JSON serializing for it
+    PERF_JSON_SERIALIZE,  // MeshPacketSerializer::JsonSerialize
+    PERF_NUM_REGIONS
+};
+
+struct PerfRegionTotals {
+    uint64_t calls;
+    uint64_t nanos;
+    uint64_t cycles;
+    uint64_t instructions;
+    uint64_t cacheMisses;
+};
+
+/// Start counting, @return false if not even timing could be set up
+bool perfCountersBegin();
+
+/// Are regions being counted
+bool perfCountersEnabled();
+
+/// Did the kernel give us cycles, instructions and cache misses, or are we only timing
+bool perfCountersHaveHardware();
+
+const char *perfRegionName(PerfRegion region);
+
+PerfRegionTotals perfRegionTotals(PerfRegion region);
+
+/// Every region's totals in the Prometheus text exposition format
+std::string perfCountersPrometheus();
+
+/// One log line per region that ran
+void perfCountersLog();
+
+/// Counts what happens between its construction and destruction, nothing unless perfCountersBegin() was called
+class PerfScope
+{
+  public:
+    explicit PerfScope(PerfRegion region);
+    ~PerfScope();
+
+  private:
+    PerfRegion region;
+    bool active;
+    bool counted; // Have startCounts, the kernel may have refused hardware counters
+    uint64_t startNanos;
+    uint64_t startCounts[3];
+};
+
+#define PERF_SCOPE(region) PerfScope perfScope(region)
+#else
+#define PERF_SCOPE(region)
+#endif
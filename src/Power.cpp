@@ -81,6 +81,10 @@ static const uint8_t ext_chrg_detect_value = EXT_CHRG_DETECT_VALUE;
 #endif
 #endif
 
+#ifndef BATTERY_READ_INTERVAL_MS
+#define BATTERY_READ_INTERVAL_MS 5000 // How long a battery voltage reading is reused before the sensor is read again
+#endif
+
 #if HAS_TELEMETRY && !MESHTASTIC_EXCLUDE_ENVIRONMENTAL_SENSOR
 #if __has_include(<Adafruit_INA219.h>)
 INA219Sensor ina219Sensor;
@@ -282,10 +286,25 @@ class AnalogBatteryLevel : public HasBatteryLevel
 
     /**
      * The raw voltage of the batteryin millivolts or NAN if unknown
+     *
+     * Every check in readPowerStatus() (connected, vbus, charging, percent) and the low voltage check end up here, so the
+     * sensor is only actually read once per BATTERY_READ_INTERVAL_MS and the cached reading is handed out in between.
      */
     virtual uint16_t getBattVoltage() override
     {
+        if (!initial_read_done || !Throttle::isWithinTimespanMs(last_read_time_ms, BATTERY_READ_INTERVAL_MS)) {
+            last_read_time_ms = millis();
+            last_voltage = readBattVoltage();
+            initial_read_done = true;
+        }
+        return last_voltage;
+    }
 
+    /**
+     * Read the battery voltage from whichever sensor we have
+     */
+    uint16_t readBattVoltage()
+    {
 #if HAS_TELEMETRY && defined(HAS_RAKPROT) && !defined(HAS_PMU) && !MESHTASTIC_EXCLUDE_ENVIRONMENTAL_SENSOR
         if (hasRAK()) {
             return getRAKVoltage();
@@ -311,41 +330,35 @@ class AnalogBatteryLevel : public HasBatteryLevel
         // Override variant or default ADC_MULTIPLIER if we have the override pref
         float operativeAdcMultiplier =
             config.power.adc_multiplier_override > 0 ? config.power.adc_multiplier_override : ADC_MULTIPLIER;
-        // Do not call analogRead() often.
-        const uint32_t min_read_interval = 5000;
-        if (!initial_read_done || !Throttle::isWithinTimespanMs(last_read_time_ms, min_read_interval)) {
-            last_read_time_ms = millis();
-
-            uint32_t raw = 0;
-            float scaled = 0;
+        uint32_t raw = 0;
+        float scaled = 0;
 
-            adcEnable();
+        adcEnable();
 #ifdef ARCH_ESP32 // ADC block for espressif platforms
-            raw = espAdcRead();
-            scaled = esp_adc_cal_raw_to_voltage(raw, adc_characs);
-            scaled *= operativeAdcMultiplier;
+        raw = espAdcRead();
+        scaled = esp_adc_cal_raw_to_voltage(raw, adc_characs);
+        scaled *= operativeAdcMultiplier;
 #else // block for all other platforms
-            for (uint32_t i = 0; i < BATTERY_SENSE_SAMPLES; i++) {
-                raw += analogRead(BATTERY_PIN);
-            }
-            raw = raw / BATTERY_SENSE_SAMPLES;
-            scaled = operativeAdcMultiplier * ((1000 * AREF_VOLTAGE) / pow(2, BATTERY_SENSE_RESOLUTION_BITS)) * raw;
+        for (uint32_t i = 0; i < BATTERY_SENSE_SAMPLES; i++) {
+            raw += analogRead(BATTERY_PIN);
+        }
+        raw = raw / BATTERY_SENSE_SAMPLES;
+        scaled = operativeAdcMultiplier * ((1000 * AREF_VOLTAGE) / pow(2, BATTERY_SENSE_RESOLUTION_BITS)) * raw;
 #endif
-            adcDisable();
-
-            if (!initial_read_done) {
-                // Flush the smoothing filter with an ADC reading, if the reading is plausibly correct
-                if (scaled > last_read_value)
-                    last_read_value = scaled;
-                initial_read_done = true;
-            } else {
-                // Already initialized - filter this reading
-                last_read_value += (scaled - last_read_value) * 0.5; // Virtual LPF
-            }
+        adcDisable();
 
-            // LOG_DEBUG("battery gpio %d raw val=%u scaled=%u filtered=%u", BATTERY_PIN, raw, (uint32_t)(scaled), (uint32_t)
-            // (last_read_value));
+        if (!adc_filter_primed) {
+            // Flush the smoothing filter with an ADC reading, if the reading is plausibly correct
+            if (scaled > last_read_value)
+                last_read_value = scaled;
+            adc_filter_primed = true;
+        } else {
+            // Already initialized - filter this reading
+            last_read_value += (scaled - last_read_value) * 0.5; // Virtual LPF
         }
+
+        // LOG_DEBUG("battery gpio %d raw val=%u scaled=%u filtered=%u", BATTERY_PIN, raw, (uint32_t)(scaled), (uint32_t)
+        // (last_read_value));
         return last_read_value;
 #endif // BATTERY_PIN
         return 0;
@@ -500,8 +513,12 @@ class AnalogBatteryLevel : public HasBatteryLevel
     // Start value from minimum voltage for the filter to not start from 0
     // that could trigger some events.
     // This value is over-written by the first ADC reading, it the voltage seems reasonable.
-    bool initial_read_done = false;
+    bool adc_filter_primed = false;
     float last_read_value = (OCV[NUM_OCV_POINTS - 1] * NUM_CELLS);
+
+    // The cached reading from whichever sensor getBattVoltage() last read
+    bool initial_read_done = false;
+    uint16_t last_voltage = 0;
     uint32_t last_read_time_ms = 0;
 
 #if HAS_TELEMETRY && !MESHTASTIC_EXCLUDE_ENVIRONMENTAL_SENSOR && defined(HAS_RAKPROT)
@@ -713,6 +730,8 @@ void Power::powerCommandsCheck()
 void Power::reboot()
 {
     notifyReboot.notifyObservers(NULL);
+    if (console)
+        console->flush(); // Don't lose the last queued log lines
 #if defined(ARCH_ESP32)
     ESP.restart();
 #elif defined(ARCH_NRF52)
@@ -789,8 +808,9 @@ void Power::readPowerStatus()
         if (hasBattery) {
             batteryVoltageMv = batteryLevel->getBattVoltage();
             // If the AXP192 returns a valid battery percentage, use it
-            if (batteryLevel->getBatteryPercent() >= 0) {
-                batteryChargePercent = batteryLevel->getBatteryPercent();
+            int percent = batteryLevel->getBatteryPercent();
+            if (percent >= 0) {
+                batteryChargePercent = percent;
             } else {
                 // If the AXP192 returns a percentage less than 0, the feature is either not supported or there is an error
                 // In that case, we compute an estimate of the charge percent based on open circuit voltage table defined
@@ -31,9 +31,59 @@ void PowerMon::clearState(_meshtastic_PowerMon_State state, const char *reason)
 #endif
 }
 
+void PowerMon::mark(uint32_t code)
+{
+#if defined(USE_POWERMON) && POWERMON_TRACE_LEN
+    record(POWERMON_TRACE_MARK | code);
+    flushTrace();
+#endif
+}
+
+#if POWERMON_TRACE_LEN
+void PowerMon::record(uint32_t value)
+{
+    if (traceLen == POWERMON_TRACE_LEN)
+        flushTrace();
+    if (traceLen == 0)
+        traceStartMs = millis();
+    trace[traceLen++] = {(uint32_t)micros(), value};
+    if (millis() - traceStartMs > POWERMON_TRACE_FLUSH_MS)
+        flushTrace();
+}
+#endif
+
+void PowerMon::flushTrace()
+{
+#if defined(USE_POWERMON) && POWERMON_TRACE_LEN
+    static const char digits[] = "0123456789abcdef";
+    for (size_t first = 0; first < traceLen; first += POWERMON_TRACE_PER_LINE) {
+        size_t n = traceLen - first < POWERMON_TRACE_PER_LINE ? traceLen - first : POWERMON_TRACE_PER_LINE;
+        char hex[POWERMON_TRACE_PER_LINE * sizeof(Transition) * 2 + 1];
+        char *out = hex;
+        for (size_t i = first; i < first + n; i++) {
+            uint32_t words[2] = {trace[i].usec, trace[i].states};
+            for (uint32_t w : words) {
+                for (int b = 0; b < 4; b++, w >>= 8) {
+                    *out++ = digits[(w >> 4) & 0xf];
+                    *out++ = digits[w & 0xf];
+                }
+            }
+        }
+        *out = '\0';
+        LOG_INFO("S:PMT:%s", hex);
+    }
+    traceLen = 0;
+#endif
+}
+
 void PowerMon::emitLog(const char *reason)
 {
-#ifdef USE_POWERMON
+#if defined(USE_POWERMON) && POWERMON_TRACE_LEN
+    (void)reason;
+    record((uint32_t)states);
+    if (states & meshtastic_PowerMon_State_CPU_DeepSleep)
+        flushTrace(); // Nobody is left to send it
+#elif defined(USE_POWERMON)
     // The nrf52 printf doesn't understand 64 bit ints, so if we ever reach that point this function will need to change.
     LOG_INFO("S:PM:0x%08lx,%s", (uint32_t)states, reason);
 #endif
@@ -7,6 +7,19 @@
 #define USE_POWERMON // FIXME turn this only for certain builds
 #endif
 
+// With this many transitions, record each one as a timestamped binary record instead of printing an S:PM log line for it.
+// Records are sent in batches as "S:PMT:" log lines, each up to POWERMON_TRACE_PER_LINE records in hex.  A record is 8 bytes,
+// little endian: micros() when the states changed, then the new states bitmask (meshtastic_PowerMon_State).  Records with
+// POWERMON_TRACE_MARK set are markers instead, with the PowerStress command in the low bits.  0 keeps the S:PM lines
+#ifndef POWERMON_TRACE_LEN
+#define POWERMON_TRACE_LEN 0
+#endif
+#define POWERMON_TRACE_PER_LINE 8 // Fits the smallest log line buffer
+#define POWERMON_TRACE_MARK 0x80000000UL
+#ifndef POWERMON_TRACE_FLUSH_MS
+#define POWERMON_TRACE_FLUSH_MS 5000 // Send a batch once its oldest record is this old, at the next transition
+#endif
+
 /**
  * The singleton class for monitoring power consumption of device
  * subsystems/modes.
@@ -31,7 +44,25 @@ class PowerMon
     void setState(_meshtastic_PowerMon_State state, const char *reason = "");
     void clearState(_meshtastic_PowerMon_State state, const char *reason = "");
 
+    // Put a marker in the trace, e.g. where a PowerStress command starts and ends
+    void mark(uint32_t code);
+
+    // Send any transitions not yet sent, before we go quiet for a while (deep sleep, a PowerStress command)
+    void flushTrace();
+
   private:
+#if POWERMON_TRACE_LEN
+    struct Transition {
+        uint32_t usec;
+        uint32_t states;
+    };
+    Transition trace[POWERMON_TRACE_LEN];
+    size_t traceLen = 0;
+    uint32_t traceStartMs = 0; // millis() of the oldest record
+
+    void record(uint32_t value);
+#endif
+
     // Emit the coded log message
     void emitLog(const char *reason);
 
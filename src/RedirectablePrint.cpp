@@ -19,11 +19,47 @@
 #if HAS_NETWORKING
 extern Syslog syslog;
 #endif
+
+/// Writes out queued log lines whenever the main loop has nothing more important to do
+class LogDrainThread : public concurrency::OSThread
+{
+    RedirectablePrint *owner;
+
+  public:
+    explicit LogDrainThread(RedirectablePrint *owner) : concurrency::OSThread("LogDrain"), owner(owner)
+    {
+        setPriority(concurrency::PRIORITY_BACKGROUND);
+        disable();
+    }
+
+    void wake()
+    {
+        enabled = true;
+        setInterval(0);
+    }
+
+  protected:
+    virtual int32_t runOnce() override
+    {
+        owner->flushLog();
+        return disable();
+    }
+};
+
 void RedirectablePrint::rpInit()
 {
 #ifdef HAS_FREE_RTOS
     inDebugPrint = xSemaphoreCreateMutexStatic(&this->_MutexStorageSpace);
 #endif
+#ifdef ARCH_PORTDUINO
+    logOutputLevel = settingsMap[logoutputlevel];
+    logMaxLevel = settingsStrings[traceFilename] != "" ? LOG_NUM_TRACE : logOutputLevel;
+#endif
+#if DEBUG_LOG_QUEUE_LINES
+    logQueue = new LogLine[DEBUG_LOG_QUEUE_LINES];
+    logQueueLock = new concurrency::Lock();
+    logDrain = new LogDrainThread(this);
+#endif
 }
 
 void RedirectablePrint::setDestination(Print *_dest)
@@ -118,7 +154,7 @@ void RedirectablePrint::log_to_serial(const char *logLevel, const char *format,
             Print::write("\u001b[35m", 5);
     }
 
-    uint32_t rtc_sec = getValidTime(RTCQuality::RTCQualityDevice, true); // display local time on logfile
+    uint32_t rtc_sec = emitting->rtcSec; // display local time on logfile
     if (rtc_sec > 0) {
         long hms = rtc_sec % SEC_PER_DAY;
         // hms += tz.tz_dsttime * SEC_PER_HOUR;
@@ -135,13 +171,13 @@ void RedirectablePrint::log_to_serial(const char *logLevel, const char *format,
         if (color) {
             ::printf("\u001b[0m");
         }
-        ::printf("| %02d:%02d:%02d %u ", hour, min, sec, millis() / 1000);
+        ::printf("| %02d:%02d:%02d %u ", hour, min, sec, emitting->msec / 1000);
 #else
         printf("%s ", logLevel);
         if (color) {
             printf("\u001b[0m");
         }
-        printf("| %02d:%02d:%02d %u ", hour, min, sec, millis() / 1000);
+        printf("| %02d:%02d:%02d %u ", hour, min, sec, emitting->msec / 1000);
 #endif
     } else {
 #ifdef ARCH_PORTDUINO
@@ -149,21 +185,18 @@ void RedirectablePrint::log_to_serial(const char *logLevel, const char *format,
         if (color) {
             ::printf("\u001b[0m");
         }
-        ::printf("| ??:??:?? %u ", millis() / 1000);
+        ::printf("| ??:??:?? %u ", emitting->msec / 1000);
 #else
         printf("%s ", logLevel);
         if (color) {
             printf("\u001b[0m");
         }
-        printf("| ??:??:?? %u ", millis() / 1000);
+        printf("| ??:??:?? %u ", emitting->msec / 1000);
 #endif
     }
-    auto thread = concurrency::OSThread::currentThread;
-    if (thread) {
+    if (emitting->source[0]) {
         print("[");
-        // printf("%p ", thread);
-        // assert(thread->ThreadName.length());
-        print(thread->ThreadName);
+        print(emitting->source);
         print("] ");
     }
     r += vprintf(logLevel, format, arg);
@@ -194,9 +227,8 @@ void RedirectablePrint::log_to_syslog(const char *logLevel, const char *format,
         default:
             ll = 0;
         }
-        auto thread = concurrency::OSThread::currentThread;
-        if (thread) {
-            syslog.vlogf(ll, thread->ThreadName.c_str(), format, arg);
+        if (emitting->source[0]) {
+            syslog.vlogf(ll, emitting->source, format, arg);
         } else {
             syslog.vlogf(ll, format, arg);
         }
@@ -215,34 +247,23 @@ void RedirectablePrint::log_to_ble(const char *logLevel, const char *format, va_
         isBleConnected = nrf52Bluetooth != nullptr && nrf52Bluetooth->isConnected();
 #endif
         if (isBleConnected) {
-            char *message;
-            size_t initialLen;
-            size_t len;
-            initialLen = strlen(format);
-            message = new char[initialLen + 1];
-            len = vsnprintf(message, initialLen + 1, format, arg);
-            if (len > initialLen) {
-                delete[] message;
-                message = new char[len + 1];
-                vsnprintf(message, len + 1, format, arg);
-            }
-            auto thread = concurrency::OSThread::currentThread;
-            meshtastic_LogRecord logRecord = meshtastic_LogRecord_init_zero;
+            // Only ever used under inDebugPrint, so these can live outside the stacks of the threads that log
+            static meshtastic_LogRecord logRecord;
+            static uint8_t buffer[meshtastic_LogRecord_size];
+            logRecord = meshtastic_LogRecord_init_zero;
             logRecord.level = getLogLevel(logLevel);
-            strcpy(logRecord.message, message);
-            if (thread)
-                strcpy(logRecord.source, thread->ThreadName.c_str());
-            logRecord.time = getValidTime(RTCQuality::RTCQualityDevice, true);
+            int len = vsnprintf(logRecord.message, sizeof(logRecord.message), format, arg);
+            if (len > 0 && (size_t)len < sizeof(logRecord.message) && logRecord.message[len - 1] == '\n')
+                logRecord.message[len - 1] = '\0'; // The record is the framing, like emitLogRecord() does for serial
+            strcpy(logRecord.source, emitting->source);
+            logRecord.time = emitting->rtcSec;
 
-            uint8_t *buffer = new uint8_t[meshtastic_LogRecord_size];
-            size_t size = pb_encode_to_bytes(buffer, meshtastic_LogRecord_size, meshtastic_LogRecord_fields, &logRecord);
+            size_t size = pb_encode_to_bytes(buffer, sizeof(buffer), meshtastic_LogRecord_fields, &logRecord);
 #ifdef ARCH_ESP32
             nimbleBluetooth->sendLog(buffer, size);
 #elif defined(ARCH_NRF52)
             nrf52Bluetooth->sendLog(buffer, size);
 #endif
-            delete[] message;
-            delete[] buffer;
         }
     }
 #else
@@ -275,83 +296,152 @@ meshtastic_LogRecord_Level RedirectablePrint::getLogLevel(const char *logLevel)
     return ll;
 }
 
-void RedirectablePrint::log(const char *logLevel, const char *format, ...)
+void RedirectablePrint::log(uint8_t levelNum, const char *logLevel, const char *format, ...)
 {
-
-    // append \n to format
-    size_t len = strlen(format);
-    char *newFormat = new char[len + 2];
-    strcpy(newFormat, format);
-    newFormat[len] = '\n';
-    newFormat[len + 1] = '\0';
-
+    if (levelNum > logMaxLevel)
+        return;
 #if ARCH_PORTDUINO
     // level trace is special, two possible ways to handle it.
-    if (strcmp(logLevel, MESHTASTIC_LOG_LEVEL_TRACE) == 0) {
-        if (settingsStrings[traceFilename] != "") {
-            va_list arg;
-            va_start(arg, format);
-            try {
-                traceFile << va_arg(arg, char *) << std::endl;
-            } catch (const std::ios_base::failure &e) {
-            }
-            va_end(arg);
-        }
-        if (settingsMap[logoutputlevel] < level_trace && strcmp(logLevel, MESHTASTIC_LOG_LEVEL_TRACE) == 0) {
-            delete[] newFormat;
-            return;
+    if (levelNum == LOG_NUM_TRACE && settingsStrings[traceFilename] != "") {
+        va_list arg;
+        va_start(arg, format);
+        try {
+            traceFile << va_arg(arg, char *) << std::endl;
+        } catch (const std::ios_base::failure &e) {
         }
+        va_end(arg);
     }
-    if (settingsMap[logoutputlevel] < level_debug && strcmp(logLevel, MESHTASTIC_LOG_LEVEL_DEBUG) == 0) {
-        delete[] newFormat;
+    if (levelNum > logOutputLevel)
         return;
-    } else if (settingsMap[logoutputlevel] < level_info && strcmp(logLevel, MESHTASTIC_LOG_LEVEL_INFO) == 0) {
-        delete[] newFormat;
+#endif
+    if (moduleConfig.serial.override_console_serial_port && levelNum == LOG_NUM_DEBUG)
         return;
-    } else if (settingsMap[logoutputlevel] < level_warn && strcmp(logLevel, MESHTASTIC_LOG_LEVEL_WARN) == 0) {
-        delete[] newFormat;
+
+    LogLine line;
+    line.level = logLevel;
+    line.msec = millis();
+    line.rtcSec = getValidTime(RTCQuality::RTCQualityDevice, true);
+    line.source[0] = '\0';
+    auto thread = concurrency::OSThread::currentThread;
+    if (thread) {
+        strncpy(line.source, thread->ThreadName.c_str(), sizeof(line.source) - 1);
+        line.source[sizeof(line.source) - 1] = '\0';
+    }
+
+    va_list arg;
+    va_start(arg, format);
+    int len = vsnprintf(line.text, sizeof(line.text) - 1, format, arg);
+    va_end(arg);
+    if (len < 0)
+        len = 0;
+    else if (len > (int)sizeof(line.text) - 2)
+        len = sizeof(line.text) - 2;
+    line.text[len] = '\n';
+    line.text[len + 1] = '\0';
+
+    bool urgent = logLevel[0] == 'E' || logLevel[0] == 'C'; // ERROR and CRIT might be the last thing we get to say
+#if DEBUG_LOG_QUEUE_LINES
+    if (logDrain && !urgent) {
+        logQueueLock->lock();
+        if (logQueued < DEBUG_LOG_QUEUE_LINES) {
+            logQueue[(logHead + logQueued) % DEBUG_LOG_QUEUE_LINES] = line;
+            logQueued++;
+        } else {
+            logDropped++;
+        }
+        logQueueLock->unlock();
+        logDrain->wake();
         return;
     }
 #endif
-    if (moduleConfig.serial.override_console_serial_port && strcmp(logLevel, MESHTASTIC_LOG_LEVEL_DEBUG) == 0) {
-        delete[] newFormat;
+    flushLog();
+    emitLine(line);
+}
+
+void RedirectablePrint::flushLog()
+{
+#if DEBUG_LOG_QUEUE_LINES
+    if (!logDrain)
         return;
+    LogLine line;
+    while (true) {
+        logQueueLock->lock();
+        bool have = logQueued > 0;
+        if (have) {
+            line = logQueue[logHead];
+            logHead = (logHead + 1) % DEBUG_LOG_QUEUE_LINES;
+            logQueued--;
+        }
+        uint32_t dropped = have ? 0 : logDropped; // The lines we dropped came after everything that is queued
+        if (!have)
+            logDropped = 0;
+        logQueueLock->unlock();
+
+        if (have)
+            emitLine(line);
+        if (dropped) {
+            line.level = MESHTASTIC_LOG_LEVEL_WARN;
+            line.msec = millis();
+            line.rtcSec = getValidTime(RTCQuality::RTCQualityDevice, true);
+            line.source[0] = '\0';
+            snprintf(line.text, sizeof(line.text), "%u log lines dropped, the queue was full\n", dropped);
+            emitLine(line);
+        }
+        if (!have)
+            break;
     }
+#endif
+}
+
+void RedirectablePrint::emitSinks(const char *logLevel, const char *format, ...)
+{
+    // Every sink gets its own walk over the arguments
+    va_list arg;
+    va_start(arg, format);
+    log_to_serial(logLevel, format, arg);
+    va_end(arg);
+    va_start(arg, format);
+    log_to_syslog(logLevel, format, arg);
+    va_end(arg);
+    va_start(arg, format);
+    log_to_ble(logLevel, format, arg);
+    va_end(arg);
+}
 
+void RedirectablePrint::emitLine(const LogLine &line)
+{
 #ifdef HAS_FREE_RTOS
     if (inDebugPrint != nullptr && xSemaphoreTake(inDebugPrint, portMAX_DELAY) == pdTRUE) {
 #else
     if (!inDebugPrint) {
         inDebugPrint = true;
 #endif
-
-        va_list arg;
-        va_start(arg, format);
-
-        log_to_serial(logLevel, newFormat, arg);
-        log_to_syslog(logLevel, newFormat, arg);
-        log_to_ble(logLevel, newFormat, arg);
-
-        va_end(arg);
+        emitting = &line;
+        emitSinks(line.level, "%s", line.text);
+        emitting = nullptr;
 #ifdef HAS_FREE_RTOS
         xSemaphoreGive(inDebugPrint);
 #else
         inDebugPrint = false;
 #endif
     }
-
-    delete[] newFormat;
-    return;
 }
 
 void RedirectablePrint::hexDump(const char *logLevel, unsigned char *buf, uint16_t len)
 {
+    uint8_t levelNum = logLevel[0] == 'T'   ? LOG_NUM_TRACE
+                       : logLevel[0] == 'D' ? LOG_NUM_DEBUG
+                       : logLevel[0] == 'I' ? LOG_NUM_INFO
+                       : logLevel[0] == 'W' ? LOG_NUM_WARN
+                                            : LOG_NUM_ERROR;
+    if (!wantsLog(levelNum))
+        return;
     const char alphabet[17] = "0123456789abcdef";
-    log(logLevel, "    +------------------------------------------------+ +----------------+");
-    log(logLevel, "    |.0 .1 .2 .3 .4 .5 .6 .7 .8 .9 .a .b .c .d .e .f | |      ASCII     |");
+    log(levelNum, logLevel, "    +------------------------------------------------+ +----------------+");
+    log(levelNum, logLevel, "    |.0 .1 .2 .3 .4 .5 .6 .7 .8 .9 .a .b .c .d .e .f | |      ASCII     |");
     for (uint16_t i = 0; i < len; i += 16) {
         if (i % 128 == 0)
-            log(logLevel, "    +------------------------------------------------+ +----------------+");
+            log(levelNum, logLevel, "    +------------------------------------------------+ +----------------+");
         char s[] = "     |                                                | |                |\n";
         uint8_t ix = 5, iy = 56;
         for (uint8_t j = 0; j < 16; j++) {
@@ -369,9 +459,9 @@ void RedirectablePrint::hexDump(const char *logLevel, unsigned char *buf, uint16
         uint8_t index = i / 16;
         sprintf(s, "%03x", index);
         s[3] = '.';
-        log(logLevel, s);
+        log(levelNum, logLevel, s);
     }
-    log(logLevel, "    +------------------------------------------------+ +----------------+");
+    log(levelNum, logLevel, "    +------------------------------------------------+ +----------------+");
 }
 
 std::string RedirectablePrint::mt_sprintf(const std::string fmt_str, ...)
@@ -1,11 +1,28 @@
 #pragma once
 
 #include "../freertosinc.h"
+#include "concurrency/Lock.h"
 #include "mesh/generated/meshtastic/mesh.pb.h"
 #include <Print.h>
 #include <stdarg.h>
 #include <string>
 
+#ifndef DEBUG_LOG_QUEUE_LINES
+#define DEBUG_LOG_QUEUE_LINES 8 // Log lines waiting to be written out by a background thread, 0 writes them from the caller
+#endif
+#ifndef DEBUG_LOG_LINE_LEN
+#if ENABLE_JSON_LOGGING || ARCH_PORTDUINO
+#define DEBUG_LOG_LINE_LEN 512
+#else
+#define DEBUG_LOG_LINE_LEN 160
+#endif
+#endif
+
+class LogDrainThread;
+
+/// The MESHTASTIC_LOG_LEVEL_* strings as numbers for filtering, a message is logged while its number is at most the limit
+enum LogLevelNum : uint8_t { LOG_NUM_ERROR, LOG_NUM_WARN, LOG_NUM_INFO, LOG_NUM_DEBUG, LOG_NUM_TRACE };
+
 /**
  * A Printable that can be switched to squirt its bytes to a different sink.
  * This class is mostly useful to allow debug printing to be redirected away from Serial
@@ -22,6 +39,15 @@ class RedirectablePrint : public Print
     volatile bool inDebugPrint = false;
 #endif
   public:
+    /// One rendered log message, with what we need to know about where and when it was logged
+    struct LogLine {
+        const char *level;
+        uint32_t rtcSec;
+        uint32_t msec;
+        char source[16]; // Name of the thread that logged it, if any
+        char text[DEBUG_LOG_LINE_LEN];
+    };
+
     explicit RedirectablePrint(Print *_dest) : dest(_dest) {}
 
     /**
@@ -35,11 +61,17 @@ class RedirectablePrint : public Print
     /**
      * Debug logging print message
      *
-     * If the provide format string ends with a newline we assume it is the final print of a single
-     * log message.  Otherwise we assume more prints will come before the log message ends.  This
-     * allows you to call logDebug a few times to build up a single log message line if you wish.
+     * The message is formatted once, on the caller, then queued for a background thread that writes it to the serial
+     * port, syslog and BLE, so logging from time critical code doesn't wait for the serial port.  ERROR and CRIT
+     * messages, and anything logged before the queue exists, are still written out before we return.
      */
-    void log(const char *logLevel, const char *format, ...) __attribute__((format(printf, 3, 4)));
+    void log(uint8_t levelNum, const char *logLevel, const char *format, ...) __attribute__((format(printf, 4, 5)));
+
+    /// Would a message of this LogLevelNum get anywhere?  The LOG_* macros ask before evaluating their arguments
+    bool wantsLog(uint8_t levelNum) const { return levelNum <= logMaxLevel; }
+
+    /// Write out every queued log line now, e.g. before we sleep or reboot
+    void flushLog();
 
     /** like printf but va_list based */
     size_t vprintf(const char *logLevel, const char *format, va_list arg);
@@ -53,7 +85,23 @@ class RedirectablePrint : public Print
     virtual void log_to_serial(const char *logLevel, const char *format, va_list arg);
     meshtastic_LogRecord_Level getLogLevel(const char *logLevel);
 
+    /// The line the log_to_* sinks are writing out right now
+    const LogLine *emitting = nullptr;
+
   private:
     void log_to_syslog(const char *logLevel, const char *format, va_list arg);
     void log_to_ble(const char *logLevel, const char *format, va_list arg);
+
+    /// Hand one line to every sink, under inDebugPrint
+    void emitLine(const LogLine &line);
+    void emitSinks(const char *logLevel, const char *format, ...);
+
+    uint8_t logMaxLevel = LOG_NUM_TRACE;    // Until rpInit() knows better
+    uint8_t logOutputLevel = LOG_NUM_TRACE; // The same except on portduino, where traces can go to a file without being printed
+
+    LogLine *logQueue = nullptr; // Ring of DEBUG_LOG_QUEUE_LINES, allocated by rpInit()
+    uint8_t logHead = 0, logQueued = 0;
+    uint32_t logDropped = 0; // Lines we had no room for since the last drain
+    concurrency::Lock *logQueueLock = nullptr;
+    LogDrainThread *logDrain = nullptr;
 };
\ No newline at end of file
@@ -5,8 +5,57 @@
 
 concurrency::Lock *spiLock;
 
+static SPIHoldStats holdStats[SPI_CLIENT_COUNT];
+static uint32_t holdStartUsec;             // When the current holder took the lock (there can only be one)
+static volatile bool radioWaiting = false; // Only written by the radio, which only ever runs on one task
+
 void initSPI()
 {
     assert(!spiLock);
     spiLock = new concurrency::Lock();
-}
\ No newline at end of file
+}
+
+void spiAcquire(SPIClient client)
+{
+    if (client == SPI_CLIENT_RADIO) {
+        radioWaiting = true;
+        spiLock->lock();
+        radioWaiting = false;
+    } else {
+        spiLock->lock();
+    }
+    holdStartUsec = micros();
+}
+
+void spiRelease(SPIClient client)
+{
+    uint32_t usec = micros() - holdStartUsec;
+    SPIHoldStats &s = holdStats[client];
+    s.holds++;
+    s.totalUsec += usec;
+    if (usec > s.maxUsec)
+        s.maxUsec = usec;
+    spiLock->unlock();
+}
+
+void spiYieldToRadio()
+{
+    // Releasing the lock wakes the radio, but on a single core we'd take the lock straight back before it got to run
+    if (radioWaiting)
+        yield();
+}
+
+const SPIHoldStats &getSPIHoldStats(SPIClient client)
+{
+    return holdStats[client];
+}
+
+void logSPIHoldStats()
+{
+    static const char *names[SPI_CLIENT_COUNT] = {"radio", "display", "storage", "ethernet"};
+    for (int i = 0; i < SPI_CLIENT_COUNT; i++) {
+        const SPIHoldStats &s = holdStats[i];
+        if (s.holds)
+            LOG_DEBUG("SPI %s: holds=%u, avg=%uus, max=%uus", names[i], s.holds, (uint32_t)(s.totalUsec / s.holds), s.maxUsec);
+    }
+}
@@ -1,12 +1,53 @@
 #pragma once
 
 #include "../concurrency/LockGuard.h"
+#include <stdint.h>
 
 /**
  * Used to provide mutual exclusion for access to the SPI bus.  Usage:
  * concurrency::LockGuard g(spiLock);
+ *
+ * or, for the users we keep hold time statistics for:
+ * SPIGuard g(SPI_CLIENT_DISPLAY);
  */
 extern concurrency::Lock *spiLock;
 
 /** Setup SPI access and create the spiLock lock. */
-void initSPI();
\ No newline at end of file
+void initSPI();
+
+#ifndef SPI_MAX_CHUNK_BYTES
+#define SPI_MAX_CHUNK_BYTES 1024 // Long transfers release the bus after this many bytes, so the radio can get in between
+#endif
+
+/// The users of spiLock we keep hold time statistics for
+enum SPIClient : uint8_t { SPI_CLIENT_RADIO, SPI_CLIENT_DISPLAY, SPI_CLIENT_STORAGE, SPI_CLIENT_ETHERNET, SPI_CLIENT_COUNT };
+
+struct SPIHoldStats {
+    uint32_t holds = 0;
+    uint32_t maxUsec = 0;
+    uint64_t totalUsec = 0;
+};
+
+/// Take spiLock for client, timing how long it's held until spiRelease()
+void spiAcquire(SPIClient client);
+void spiRelease(SPIClient client);
+
+/// Call between the chunks of a long transfer (without spiLock held): steps aside if the radio is waiting for the bus
+void spiYieldToRadio();
+
+const SPIHoldStats &getSPIHoldStats(SPIClient client);
+void logSPIHoldStats();
+
+/// LockGuard for spiLock that keeps hold time statistics
+class SPIGuard
+{
+  public:
+    explicit SPIGuard(SPIClient client) : client(client) { spiAcquire(client); }
+    ~SPIGuard() { spiRelease(client); }
+
+    SPIGuard(const SPIGuard &) = delete;
+    SPIGuard &operator=(const SPIGuard &) = delete;
+
+  private:
+    SPIClient client;
+};
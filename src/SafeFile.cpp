@@ -5,52 +5,77 @@
 // Only way to work on both esp32 and nrf52
 static File openFile(const char *filename, bool fullAtomic)
 {
-    concurrency::LockGuard g(spiLock);
+    SPIGuard g(SPI_CLIENT_STORAGE);
     LOG_DEBUG("Opening %s, fullAtomic=%d", filename, fullAtomic);
-#ifdef ARCH_NRF52
-    FSCom.remove(filename);
-    return FSCom.open(filename, FILE_O_WRITE);
-#endif
     if (!fullAtomic) {
         FSCom.remove(filename); // Nuke the old file to make space (ignore if it !exists)
     }
 
     String filenameTmp = filename;
     filenameTmp += ".tmp";
+#ifdef ARCH_NRF52
+    FSCom.remove(filenameTmp.c_str()); // Adafruit LittleFS opens for write at the end of an existing file
+#endif
 
-    // FIXME: If we are doing a full atomic write, we may need to remove the old tmp file now
-    // if (fullAtomic) {
-    //     FSCom.remove(filename);
-    // }
-
+    fileManifestChanged();
     // clear any previous LFS errors
     return FSCom.open(filenameTmp.c_str(), FILE_O_WRITE);
 }
 
-SafeFile::SafeFile(const char *_filename, bool fullAtomic)
-    : filename(_filename), f(openFile(_filename, fullAtomic)), fullAtomic(fullAtomic)
+static inline uint32_t fnv1a(uint32_t hash, uint8_t c)
 {
+    return (hash ^ c) * 16777619u;
 }
 
-size_t SafeFile::write(uint8_t ch)
+static uint8_t writeBuffer[SAFEFILE_WRITE_BUFFER];
+static size_t writeBufferUsed;
+static bool writeBufferBusy;
+
+SafeFile::SafeFile(const char *_filename, bool fullAtomic) : filename(_filename), f(openFile(_filename, fullAtomic))
 {
-    if (!f)
-        return 0;
+    if (f && !writeBufferBusy) {
+        writeBufferBusy = buffered = true;
+        writeBufferUsed = 0;
+    }
+}
 
-    hash ^= ch;
-    return f.write(ch);
+size_t SafeFile::write(uint8_t ch)
+{
+    return write(&ch, 1);
 }
 
 size_t SafeFile::write(const uint8_t *buffer, size_t size)
 {
-    if (!f)
+    if (!f || failed)
         return 0;
 
     for (size_t i = 0; i < size; i++) {
-        hash ^= buffer[i];
+        hash = fnv1a(hash, buffer[i]);
     }
-    return f.write((uint8_t const *)buffer, size); // This nasty cast is _IMPORTANT_ otherwise the correct adafruit method does
-                                                   // not get used (they made a mistake in their typing)
+    if (!buffered)
+        return f.write((uint8_t const *)buffer, size); // This nasty cast is _IMPORTANT_ otherwise the correct adafruit method
+                                                       // does not get used (they made a mistake in their typing)
+
+    size_t left = size;
+    while (left) {
+        size_t room = sizeof(writeBuffer) - writeBufferUsed;
+        size_t n = left < room ? left : room;
+        memcpy(writeBuffer + writeBufferUsed, buffer, n);
+        writeBufferUsed += n;
+        buffer += n;
+        left -= n;
+        if (writeBufferUsed == sizeof(writeBuffer) && !flushBuffer())
+            return 0;
+    }
+    return size;
+}
+
+bool SafeFile::flushBuffer()
+{
+    if (writeBufferUsed && f.write((uint8_t const *)writeBuffer, writeBufferUsed) != writeBufferUsed)
+        failed = true;
+    writeBufferUsed = 0;
+    return !failed;
 }
 
 /**
@@ -63,25 +88,25 @@ bool SafeFile::close()
     if (!f)
         return false;
 
-    spiLock->lock();
+    spiAcquire(SPI_CLIENT_STORAGE);
+    if (buffered) {
+        flushBuffer();
+        writeBufferBusy = buffered = false;
+    }
     f.close();
-    spiLock->unlock();
+    spiRelease(SPI_CLIENT_STORAGE);
 
-#ifdef ARCH_NRF52
-    return true;
-#endif
-    if (!testReadback())
+    if (failed) {
+        LOG_ERROR("Write to %s failed", filename.c_str());
         return false;
-
-    { // Scope for lock
-        concurrency::LockGuard g(spiLock);
-        // brief window of risk here ;-)
-        if (fullAtomic && FSCom.exists(filename.c_str()) && !FSCom.remove(filename.c_str())) {
-            LOG_ERROR("Can't remove old pref file");
-            return false;
-        }
     }
 
+#if SAFEFILE_READBACK
+    if (!testReadback())
+        return false;
+#endif
+
+    // One rename replaces any old version, no remove first and so no window without a valid file
     String filenameTmp = filename;
     filenameTmp += ".tmp";
     if (!renameFile(filenameTmp.c_str(), filename.c_str())) {
@@ -95,7 +120,7 @@ bool SafeFile::close()
 /// Read our (closed) tempfile back in and compare the hash
 bool SafeFile::testReadback()
 {
-    concurrency::LockGuard g(spiLock);
+    SPIGuard g(SPI_CLIENT_STORAGE);
 
     String filenameTmp = filename;
     filenameTmp += ".tmp";
@@ -105,10 +130,12 @@ bool SafeFile::testReadback()
         return false;
     }
 
-    int c = 0;
-    uint8_t test_hash = 0;
-    while ((c = f2.read()) >= 0) {
-        test_hash ^= (uint8_t)c;
+    uint8_t buf[64];
+    uint32_t test_hash = 2166136261u;
+    int n;
+    while ((n = f2.read(buf, sizeof(buf))) > 0) {
+        for (int i = 0; i < n; i++)
+            test_hash = fnv1a(test_hash, buf[i]);
     }
     f2.close();
 
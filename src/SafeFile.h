@@ -6,6 +6,13 @@
 
 #ifdef FSCom
 
+#ifndef SAFEFILE_READBACK
+#define SAFEFILE_READBACK 1 // Read each file back once before committing it and compare with the hash taken while writing
+#endif
+#ifndef SAFEFILE_WRITE_BUFFER
+#define SAFEFILE_WRITE_BUFFER 512 // Small writes are combined into chunks of this many bytes, a multiple of the flash page size
+#endif
+
 /**
  * This class provides 'safe'/paranoid file writing.
  *
@@ -13,14 +20,18 @@
  * be very careful about how we write files.  This class provides a restricted (Stream only) writing API for writing to files.
  *
  * Notably:
- * - we keep a simple xor hash of all characters that were written.
+ * - we keep a running FNV-1a hash of all bytes as they are written, so verifying needs no extra pass over our data
  * - We do not allow seeking (because we want to maintain our hash)
  * - we provide an close() method which is similar to close but returns false if we were unable to successfully write the
  * file.  Also this method
- * - atomically replaces any old version of the file on the disk with our new file (after first rereading the file from the disk
- * to confirm the hash matches)
- * - Some files are super huge so we can't do the full atomic rename/copy (because of filesystem size limits).  If !fullAtomic
- * then we still do the readback to verify file is valid so higher level code can handle failures.
+ * - optionally (SAFEFILE_READBACK) rereads the file from the disk once to confirm the hash matches, then commits it with a
+ * single rename over any old version, which LittleFS does atomically
+ * - Some files are super huge so we can't keep the old and the new version at once (because of filesystem size limits).  If
+ * !fullAtomic then the old version is removed before we start writing, and higher level code has to handle failures.
+ *
+ * Writes go through one static buffer of SAFEFILE_WRITE_BUFFER bytes, so the many tiny writes nanopb makes reach the flash as
+ * page sized ones.  Only one SafeFile at a time gets the buffer, any others write straight through.  Like the writes
+ * themselves, the flushes happen in whatever locking context the caller writes from.
  */
 class SafeFile : public Print
 {
@@ -41,10 +52,14 @@ class SafeFile : public Print
     /// Read our (closed) tempfile back in and compare the hash
     bool testReadback();
 
+    /// Write out whatever is in the shared buffer
+    bool flushBuffer();
+
     String filename;
     File f;
-    bool fullAtomic;
-    uint8_t hash = 0;
+    uint32_t hash = 2166136261u; // FNV-1a offset basis
+    bool buffered = false;       // Do we own the shared write buffer?
+    bool failed = false;         // Did a buffered write fail after we had already told the caller it worked?
 };
 
 #endif
\ No newline at end of file
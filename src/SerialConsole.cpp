@@ -77,6 +77,7 @@ int32_t SerialConsole::runOnce()
 
 void SerialConsole::flush()
 {
+    flushLog();
     Port.flush();
 }
 
@@ -108,8 +109,7 @@ void SerialConsole::log_to_serial(const char *logLevel, const char *format, va_l
 {
     if (usingProtobufs && config.security.debug_log_api_enabled) {
         meshtastic_LogRecord_Level ll = RedirectablePrint::getLogLevel(logLevel);
-        auto thread = concurrency::OSThread::currentThread;
-        emitLogRecord(ll, thread ? thread->ThreadName.c_str() : "", format, arg);
+        emitLogRecord(ll, emitting->source, format, arg);
     } else
         RedirectablePrint::log_to_serial(logLevel, format, arg);
 }
\ No newline at end of file
@@ -31,6 +31,133 @@ void AirTime::logAirtime(reportTypes reportType, uint32_t airtime_ms)
     this->channelUtilization[this->getPeriodUtilMinute()] = channelUtilization[this->getPeriodUtilMinute()] + airtime_ms;
 }
 
+void AirtimeTalkers::add(uint32_t key, uint32_t airtime_ms)
+{
+    totalMs += airtime_ms;
+
+    uint8_t quietest = 0;
+    for (uint8_t i = 0; i < numEntries; i++) {
+        if (entries[i].key == key) {
+            entries[i].ms += airtime_ms;
+            return;
+        }
+        if (entries[i].ms < entries[quietest].ms)
+            quietest = i;
+    }
+
+    if (numEntries < AIRTIME_TOP_TALKERS) {
+        entries[numEntries++] = {key, airtime_ms, 0};
+    } else {
+        Entry &e = entries[quietest];
+        e = {key, e.ms + airtime_ms, e.ms};
+    }
+}
+
+void AirtimeTalkers::decay()
+{
+    totalMs /= 2;
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < numEntries; i++) {
+        Entry e = entries[i];
+        e.ms /= 2;
+        e.errorMs /= 2;
+        if (e.ms > 0)
+            entries[kept++] = e;
+    }
+    numEntries = kept;
+}
+
+uint8_t AirtimeTalkers::getSorted(Entry out[AIRTIME_TOP_TALKERS]) const
+{
+    // Insertion sort, there are only a handful
+    for (uint8_t i = 0; i < numEntries; i++) {
+        uint8_t j = i;
+        for (; j > 0 && out[j - 1].ms < entries[i].ms; j--)
+            out[j] = out[j - 1];
+        out[j] = entries[i];
+    }
+    return numEntries;
+}
+
+void AirTime::logTalker(NodeNum from, uint32_t portnum, uint32_t airtime_ms)
+{
+    portTalkers.add(portnum, airtime_ms);
+    nodeTalkers.add(from, airtime_ms);
+}
+
+const char *AirTime::getPortName(uint32_t portnum, char *buf, size_t bufLen)
+{
+    switch (portnum) {
+    case meshtastic_PortNum_TEXT_MESSAGE_APP:
+    case meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP:
+        return "Text";
+    case meshtastic_PortNum_POSITION_APP:
+        return "Position";
+    case meshtastic_PortNum_NODEINFO_APP:
+        return "NodeInfo";
+    case meshtastic_PortNum_ROUTING_APP:
+        return "Routing";
+    case meshtastic_PortNum_ADMIN_APP:
+        return "Admin";
+    case meshtastic_PortNum_WAYPOINT_APP:
+        return "Waypoint";
+    case meshtastic_PortNum_DETECTION_SENSOR_APP:
+        return "Detection";
+    case meshtastic_PortNum_PAXCOUNTER_APP:
+        return "Paxcount";
+    case meshtastic_PortNum_SERIAL_APP:
+        return "Serial";
+    case meshtastic_PortNum_STORE_FORWARD_APP:
+        return "S&F";
+    case meshtastic_PortNum_RANGE_TEST_APP:
+        return "RangeTest";
+    case meshtastic_PortNum_TELEMETRY_APP:
+        return "Telemetry";
+    case meshtastic_PortNum_TRACEROUTE_APP:
+        return "Traceroute";
+    case meshtastic_PortNum_NEIGHBORINFO_APP:
+        return "Neighbors";
+    case meshtastic_PortNum_ATAK_PLUGIN:
+    case meshtastic_PortNum_ATAK_FORWARDER:
+        return "ATAK";
+    case meshtastic_PortNum_MAP_REPORT_APP:
+        return "MapReport";
+    case AIRTIME_PORT_ENCRYPTED:
+        return "Encrypted";
+    default:
+        snprintf(buf, bufLen, "Port %u", portnum);
+        return buf;
+    }
+}
+
+// One line per list, so an operator can tell from the log which config is filling the channel
+void AirTime::logTalkers()
+{
+    AirtimeTalkers::Entry sorted[AIRTIME_TOP_TALKERS];
+    char line[AIRTIME_TOP_TALKERS * 24];
+    char portBuf[12];
+
+    uint32_t total = portTalkers.getTotalMs();
+    if (total == 0)
+        return;
+
+    size_t used = 0;
+    line[0] = '\0';
+    uint8_t n = portTalkers.getSorted(sorted);
+    for (uint8_t i = 0; i < n && used < sizeof(line); i++)
+        used += snprintf(line + used, sizeof(line) - used, " %s %u%%", getPortName(sorted[i].key, portBuf, sizeof(portBuf)),
+                         sorted[i].ms * 100 / total);
+    LOG_INFO("Airtime by port of %ums:%s", total, line);
+
+    used = 0;
+    line[0] = '\0';
+    total = nodeTalkers.getTotalMs();
+    n = nodeTalkers.getSorted(sorted);
+    for (uint8_t i = 0; i < n && used < sizeof(line); i++)
+        used += snprintf(line + used, sizeof(line) - used, " 0x%x %u%%", sorted[i].key, sorted[i].ms * 100 / total);
+    LOG_INFO("Airtime by node:%s", line);
+}
+
 uint8_t AirTime::currentPeriodIndex()
 {
     return ((getSecondsSinceBoot() / SECONDS_PER_PERIOD) % PERIODS_TO_LOG);
@@ -144,6 +271,76 @@ bool AirTime::isTxAllowedAirUtil()
     return true;
 }
 
+// Each bucket holds at most a minute of its allowance, enough for a burst of max size packets but not an hour's worth
+#define TX_BUDGET_BURST_SECS 60
+
+AirTime::txBudgetBand AirTime::getTxBudgetBand(meshtastic_MeshPacket_Priority priority)
+{
+    if (priority < meshtastic_MeshPacket_Priority_DEFAULT)
+        return TX_BAND_BACKGROUND;
+    else if (priority < meshtastic_MeshPacket_Priority_RESPONSE)
+        return TX_BAND_NORMAL;
+    else
+        return TX_BAND_URGENT;
+}
+
+float AirTime::getTxBudgetRate(txBudgetBand band)
+{
+    if (config.lora.override_duty_cycle || myRegion->dutyCycle >= 100 || band == TX_BAND_URGENT)
+        return 0;
+
+    float rate = myRegion->dutyCycle * 1000 / 100; // msec per second
+    return band == TX_BAND_BACKGROUND ? rate * polite_duty_cycle_percent / 100 : rate;
+}
+
+void AirTime::refillTxBudget()
+{
+    uint32_t now = millis();
+    uint32_t elapsed = now - lastTxBudgetRefill;
+    lastTxBudgetRefill = now;
+
+    for (int band = 0; band < TX_BAND_URGENT; band++) {
+        float rate = getTxBudgetRate((txBudgetBand)band);
+        float burst = rate * TX_BUDGET_BURST_SECS;
+        // Start out full, we have no way of knowing what we sent before booting
+        float tokens = txBudgetStarted ? txBudget[band] + rate * elapsed / 1000 : burst;
+        txBudget[band] = tokens > burst ? burst : tokens;
+    }
+    txBudgetStarted = true;
+}
+
+uint32_t AirTime::getTxBudgetWaitMsec(meshtastic_MeshPacket_Priority priority, uint32_t airtime_ms)
+{
+    txBudgetBand band = getTxBudgetBand(priority);
+    float rate = getTxBudgetRate(band);
+    if (rate <= 0)
+        return 0;
+
+    refillTxBudget();
+    // A packet bigger than the whole bucket may go once the bucket is full, otherwise it would never go
+    float burst = rate * TX_BUDGET_BURST_SECS;
+    float needed = airtime_ms < burst ? airtime_ms : burst;
+    if (txBudget[band] >= needed)
+        return 0;
+
+    uint32_t wait = (needed - txBudget[band]) * 1000 / rate + 1;
+    LOG_DEBUG("TX budget for priority %d is %.0fms short, wait %ums", priority, needed - txBudget[band], wait);
+    return wait;
+}
+
+void AirTime::spendTxBudget(meshtastic_MeshPacket_Priority priority, uint32_t airtime_ms)
+{
+    refillTxBudget();
+    // Higher priority traffic also eats into what lower priority traffic may use, but not the other way around
+    txBudgetBand band = getTxBudgetBand(priority);
+    for (int b = TX_BAND_BACKGROUND; b < TX_BAND_URGENT && b <= band; b++) {
+        float floor = -getTxBudgetRate((txBudgetBand)b) * TX_BUDGET_BURST_SECS;
+        txBudget[b] -= airtime_ms;
+        if (txBudget[b] < floor)
+            txBudget[b] = floor; // Don't carry more than one burst of debt
+    }
+}
+
 // Get the amount of minutes we have to be silent before we can send again
 uint8_t AirTime::getSilentMinutes(float txPercent, float dutyCycle)
 {
@@ -163,6 +360,12 @@ int32_t AirTime::runOnce()
 {
     secSinceBoot++;
 
+    if (secSinceBoot % AIRTIME_TALKER_DECAY_SECS == 0) {
+        logTalkers();
+        portTalkers.decay();
+        nodeTalkers.decay();
+    }
+
     uint8_t utilPeriod = this->getPeriodUtilMinute();
     uint8_t utilPeriodTX = this->getPeriodUtilHour();
 
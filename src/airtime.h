@@ -33,8 +33,49 @@
 #define MS_IN_MINUTE (SECONDS_IN_MINUTE * 1000)
 #define MS_IN_HOUR (MINUTES_IN_HOUR * SECONDS_IN_MINUTE * 1000)
 
+// How many ports and how many nodes we keep airtime for, the busiest ones are never pushed out by quieter ones
+#ifndef AIRTIME_TOP_TALKERS
+#define AIRTIME_TOP_TALKERS 8
+#endif
+
+// Talker airtime halves this often, so the lists show who is busy lately rather than since boot
+#ifndef AIRTIME_TALKER_DECAY_SECS
+#define AIRTIME_TALKER_DECAY_SECS (60 * 10)
+#endif
+
+// Port key for packets we heard or relayed without being able to decode them
+#define AIRTIME_PORT_ENCRYPTED 0xffff
+
 enum reportTypes { TX_LOG, RX_LOG, RX_ALL_LOG };
 
+/**
+ * Bounded top-K of airtime by key (a portnum or a node number), by the Space-Saving algorithm: a key we don't have yet
+ * takes over the slot of the quietest one and inherits its airtime. Anyone using more than 1/AIRTIME_TOP_TALKERS of the
+ * airtime is always in the list, a newcomer's airtime may be overestimated by at most errorMs.
+ */
+class AirtimeTalkers
+{
+  public:
+    struct Entry {
+        uint32_t key;
+        uint32_t ms;
+        uint32_t errorMs; // How much of ms was inherited from the key this one replaced
+    };
+
+    void add(uint32_t key, uint32_t airtime_ms);
+    /// Halve everyone, forgetting those that reach 0
+    void decay();
+    /// Copy out the entries busiest first, @return how many there are
+    uint8_t getSorted(Entry out[AIRTIME_TOP_TALKERS]) const;
+    /// Airtime of every key added since boot, decayed the same way, so shares can be shown against it
+    uint32_t getTotalMs() const { return totalMs; }
+
+  private:
+    Entry entries[AIRTIME_TOP_TALKERS] = {};
+    uint8_t numEntries = 0;
+    uint32_t totalMs = 0;
+};
+
 void logAirtime(reportTypes reportType, uint32_t airtime_ms);
 
 uint32_t *airtimeReport(reportTypes reportType);
@@ -46,6 +87,12 @@ class AirTime : private concurrency::OSThread
     AirTime();
 
     void logAirtime(reportTypes reportType, uint32_t airtime_ms);
+    /** Charge a packet we sent or heard to the port it was on and the node it came from */
+    void logTalker(NodeNum from, uint32_t portnum, uint32_t airtime_ms);
+    const AirtimeTalkers &getPortTalkers() const { return portTalkers; }
+    const AirtimeTalkers &getNodeTalkers() const { return nodeTalkers; }
+    /** @return a short name for a port key of getPortTalkers(), buf is used for ports we have no name for */
+    static const char *getPortName(uint32_t portnum, char *buf, size_t bufLen);
     float channelUtilizationPercent();
     float utilizationTXPercent();
 
@@ -61,6 +108,16 @@ class AirTime : private concurrency::OSThread
     uint8_t getSilentMinutes(float txPercent, float dutyCycle);
     bool isTxAllowedChannelUtil(bool polite = false);
     bool isTxAllowedAirUtil();
+    uint8_t getPoliteChannelUtilPercent() const { return polite_channel_util_percent; }
+
+    /**
+     * Airtime token buckets for duty cycle limited regions, one per priority band. Background traffic may use the polite
+     * share of the duty cycle, normal traffic all of it, and acks/responses/alerts are never held back here.
+     * @return how long a packet of this priority and airtime has to wait for budget, 0 if it can go now
+     */
+    uint32_t getTxBudgetWaitMsec(meshtastic_MeshPacket_Priority priority, uint32_t airtime_ms);
+    /** Charge a transmission against the buckets of its priority band and all lower ones */
+    void spendTxBudget(meshtastic_MeshPacket_Priority priority, uint32_t airtime_ms);
 
   private:
     bool firstTime = true;
@@ -78,6 +135,20 @@ class AirTime : private concurrency::OSThread
         uint8_t lastPeriodIndex;
     } airtimes;
 
+    enum txBudgetBand { TX_BAND_BACKGROUND, TX_BAND_NORMAL, TX_BAND_URGENT };
+    float txBudget[TX_BAND_URGENT] = {0}; // msec of airtime in hand, the urgent band has no bucket
+    uint32_t lastTxBudgetRefill = 0;
+    bool txBudgetStarted = false;
+
+    AirtimeTalkers portTalkers;
+    AirtimeTalkers nodeTalkers;
+    void logTalkers();
+
+    txBudgetBand getTxBudgetBand(meshtastic_MeshPacket_Priority priority);
+    /** @return msec of airtime per second this band may use, 0 if we are not duty cycle limited */
+    float getTxBudgetRate(txBudgetBand band);
+    void refillTxBudget();
+
     uint8_t getPeriodUtilMinute();
     uint8_t getPeriodUtilHour();
     uint8_t currentPeriodIndex();
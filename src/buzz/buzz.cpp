@@ -1,5 +1,6 @@
 #include "buzz.h"
 #include "NodeDB.h"
+#include "concurrency/OSThread.h"
 #include "configuration.h"
 
 #if !defined(ARCH_ESP32) && !defined(ARCH_RP2040) && !defined(ARCH_PORTDUINO)
@@ -36,6 +37,62 @@ const int DURATION_1_2 = 500;  // 1/2 note
 const int DURATION_3_4 = 750;  // 1/4 note
 const int DURATION_1_1 = 1000; // 1/1 note
 
+#define MAX_QUEUED_TONES 8 // Longer than any of our melodies
+
+/**
+ * Plays a melody a note at a time from the scheduler, so a beep never holds up the radio or anything else.  tone() is given
+ * each note's duration and stops it by itself, we only come back to start the next one.
+ */
+class ToneSequencer : public concurrency::OSThread
+{
+  public:
+    ToneSequencer() : OSThread("ToneSequencer") { disable(); }
+
+    /// Drop whatever is playing and play tones instead.  Feedback for a button press shouldn't wait for the last one's.
+    void play(const ToneDuration *tones, int size)
+    {
+        count = size < MAX_QUEUED_TONES ? size : MAX_QUEUED_TONES;
+        memcpy(queue, tones, count * sizeof(ToneDuration));
+        next = 0;
+        enabled = true;
+        setIntervalFromNow(0);
+    }
+
+    void stop()
+    {
+        if (enabled && config.device.buzzer_gpio)
+            noTone(config.device.buzzer_gpio);
+        count = next = 0;
+        disable();
+    }
+
+    /// Play the rest right here, for when we are about to power off
+    void finish()
+    {
+        while (next < count)
+            delay(runOnce());
+        disable();
+    }
+
+  protected:
+    virtual int32_t runOnce() override
+    {
+        if (next >= count)
+            return disable();
+        const ToneDuration &note = queue[next++];
+        tone(config.device.buzzer_gpio, note.frequency_khz, note.duration_ms);
+        // to distinguish the notes, set a minimum time between them.
+        return 1.3 * note.duration_ms;
+    }
+
+  private:
+    ToneDuration queue[MAX_QUEUED_TONES];
+    int count = 0;
+    int next = 0;
+};
+
+static ToneSequencer *toneSequencer;
+
 void playTones(const ToneDuration *tone_durations, int size)
 {
     if (config.device.buzzer_mode == meshtastic_Config_DeviceConfig_BuzzerMode_DISABLED ||
@@ -48,15 +105,18 @@ void playTones(const ToneDuration *tone_durations, int size)
         config.device.buzzer_gpio = PIN_BUZZER;
 #endif
     if (config.device.buzzer_gpio) {
-        for (int i = 0; i < size; i++) {
-            const auto &tone_duration = tone_durations[i];
-            tone(config.device.buzzer_gpio, tone_duration.frequency_khz, tone_duration.duration_ms);
-            // to distinguish the notes, set a minimum time between them.
-            delay(1.3 * tone_duration.duration_ms);
-        }
+        if (!toneSequencer)
+            toneSequencer = new ToneSequencer();
+        toneSequencer->play(tone_durations, size);
     }
 }
 
+void stopTones()
+{
+    if (toneSequencer)
+        toneSequencer->stop();
+}
+
 void playBeep()
 {
     ToneDuration melody[] = {{NOTE_B3, DURATION_1_8}};
@@ -91,6 +151,9 @@ void playShutdownMelody()
 {
     ToneDuration melody[] = {{NOTE_CS4, DURATION_1_8}, {NOTE_AS3, DURATION_1_8}, {NOTE_FS3, DURATION_1_4}};
     playTones(melody, sizeof(melody) / sizeof(ToneDuration));
+    // The scheduler won't get another go before we power off
+    if (toneSequencer)
+        toneSequencer->finish();
 }
 
 void playChirp()
@@ -137,7 +200,7 @@ bool playNextLeadUpNote()
 
     // Use playTones to handle buzzer logic consistently
     const auto &note = leadUpNotes[leadUpNoteIndex];
-    playTones(&note, 1); // Play single note using existing playTones function
+    playTones(&note, 1); // Queue single note using existing playTones function
 
     leadUpNoteIndex++;
 
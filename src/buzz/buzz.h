@@ -10,5 +10,6 @@ void playComboTune();
 void playBoop();
 void playChirp();
 void playLongPressLeadUp();
+void stopTones(); // Cut short whatever the functions above are playing, they all return without waiting for it
 bool playNextLeadUpNote();  // Play the next note in the lead-up sequence
 void resetLeadUpSequence(); // Reset the lead-up sequence to start from beginning
\ No newline at end of file
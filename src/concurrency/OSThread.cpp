@@ -17,6 +17,9 @@ bool OSThread::showWaiting = false;
 
 const OSThread *OSThread::currentThread;
 
+OSThread *OSThread::radioThreads[OSTHREAD_MAX_RADIO_THREADS];
+uint32_t OSThread::backgroundUsec;
+
 ThreadController mainController, timerController;
 InterruptableDelay mainDelay;
 
@@ -43,6 +46,37 @@ OSThread::~OSThread()
 {
     if (controller)
         controller->remove(this);
+    setPriority(PRIORITY_NORMAL);
+}
+
+void OSThread::setPriority(ThreadPriority p)
+{
+    for (int i = 0; i < OSTHREAD_MAX_RADIO_THREADS; i++) {
+        if (radioThreads[i] == this)
+            radioThreads[i] = nullptr;
+    }
+    if (p == PRIORITY_RADIO) {
+        int i = 0;
+        while (i < OSTHREAD_MAX_RADIO_THREADS && radioThreads[i])
+            i++;
+        if (i == OSTHREAD_MAX_RADIO_THREADS) {
+            LOG_WARN("Too many radio threads, %s runs at normal priority", ThreadName.c_str());
+            p = PRIORITY_NORMAL;
+        } else {
+            radioThreads[i] = this;
+        }
+    }
+    priority = p;
+}
+
+bool OSThread::radioWaiting(unsigned long time) const
+{
+    for (int i = 0; i < OSTHREAD_MAX_RADIO_THREADS; i++) {
+        OSThread *t = radioThreads[i];
+        if (t && t != this && t->Thread::shouldRun(time))
+            return true;
+    }
+    return false;
 }
 
 /**
@@ -61,6 +95,12 @@ bool OSThread::shouldRun(unsigned long time)
 {
     bool r = Thread::shouldRun(time);
 
+    // Let the radio go first, and keep background work from hogging the loop; a thread we hold back here is still due,
+    // so the controller comes straight back for it
+    if (r && priority != PRIORITY_RADIO &&
+        ((priority == PRIORITY_BACKGROUND && backgroundUsec >= OSTHREAD_BACKGROUND_BUDGET_MSEC * 1000UL) || radioWaiting(time)))
+        r = false;
+
     if (showRun && r) {
         LOG_DEBUG("Thread %s: run", ThreadName.c_str());
     }
@@ -82,7 +122,26 @@ void OSThread::run()
     auto heap = memGet.getFreeHeap();
 #endif
     currentThread = this;
+    uint32_t startUsec = micros();
+#if OSTHREAD_PROFILE
+    if (interval) {
+        int32_t lateMsec = (int32_t)(millis() - _cached_next_run);
+        profile.late[lateMsec < 10 ? 0 : lateMsec < 100 ? 1 : lateMsec < 1000 ? 2 : 3]++;
+    }
+#endif
     auto newDelay = runOnce();
+    uint32_t usec = micros() - startUsec;
+    if (priority == PRIORITY_BACKGROUND)
+        backgroundUsec += usec;
+#if OSTHREAD_PROFILE
+    profile.runs++;
+    profile.totalUsec += usec;
+    if (usec > profile.maxUsec) {
+        profile.maxUsec = usec;
+        if (usec >= OSTHREAD_SLOW_RUN_MSEC * 1000UL)
+            LOG_WARN("Thread %s ran for %u ms", ThreadName.c_str(), usec / 1000);
+    }
+#endif
 #ifdef DEBUG_HEAP
     auto newHeap = memGet.getFreeHeap();
     if (newHeap < heap)
@@ -99,6 +158,32 @@ void OSThread::run()
     currentThread = NULL;
 }
 
+#if OSTHREAD_PROFILE
+// Only OSThreads ever add themselves to mainController
+const OSThread *OSThread::slowest()
+{
+    const OSThread *worst = nullptr;
+    for (int i = 0; i < MAX_THREADS; i++) {
+        auto thread = static_cast<const OSThread *>(mainController.get(i));
+        if (thread && (!worst || thread->profile.maxUsec > worst->profile.maxUsec))
+            worst = thread;
+    }
+    return worst;
+}
+
+void OSThread::logProfiles()
+{
+    for (int i = 0; i < MAX_THREADS; i++) {
+        auto thread = static_cast<const OSThread *>(mainController.get(i));
+        if (!thread || !thread->profile.runs)
+            continue;
+        const ThreadProfile &p = thread->profile;
+        LOG_DEBUG("Thread %s: runs=%u, avg=%uus, max=%uus, late<10ms/<100ms/<1s/more=%u/%u/%u/%u", thread->ThreadName.c_str(),
+                  p.runs, (uint32_t)(p.totalUsec / p.runs), p.maxUsec, p.late[0], p.late[1], p.late[2], p.late[3]);
+    }
+}
+#endif
+
 int32_t OSThread::disable()
 {
     enabled = false;
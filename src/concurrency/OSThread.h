@@ -15,11 +15,46 @@ extern InterruptableDelay mainDelay;
 
 #define RUN_SAME -1
 
+#ifndef OSTHREAD_PROFILE
+#define OSTHREAD_PROFILE 1 // Keep run time statistics for each thread
+#endif
+#ifndef OSTHREAD_SLOW_RUN_MSEC
+#define OSTHREAD_SLOW_RUN_MSEC 100 // Warn when a thread sets a new personal record for running longer than this
+#endif
+#define OSTHREAD_LATE_BUCKETS 4 // Runs that started <10ms, <100ms, <1s and >=1s after they were due
+
+#ifndef OSTHREAD_MAX_RADIO_THREADS
+#define OSTHREAD_MAX_RADIO_THREADS 4
+#endif
+#ifndef OSTHREAD_BACKGROUND_BUDGET_MSEC
+#define OSTHREAD_BACKGROUND_BUDGET_MSEC 50 // How long BACKGROUND threads may run in total per pass of the main loop
+#endif
+
+/**
+ * When several threads are due at once, none of the others start while a RADIO thread is due, and once BACKGROUND
+ * threads have used up their budget for this pass of the main loop the rest of them wait for the next pass.  Threads
+ * still never interrupt each other, so a RADIO thread can wait out at most the one runOnce() that has already started.
+ */
+enum ThreadPriority : uint8_t { PRIORITY_RADIO, PRIORITY_NORMAL, PRIORITY_BACKGROUND };
+
+/// How long a thread's runOnce() takes, and how late it gets to start
+struct ThreadProfile {
+    uint32_t runs = 0;
+    uint64_t totalUsec = 0;
+    uint32_t maxUsec = 0;
+    uint32_t late[OSTHREAD_LATE_BUCKETS] = {}; // Only counts runs that were scheduled, not ones woken with setInterval(0)
+};
+
 /**
  * @brief Base threading
  *
  * This is a pseudo threading layer that is super easy to port, well suited to our slow network and very ram & power efficient.
  *
+ * The controller finds due threads by polling each one's enabled flag and cached next run time, rather than keeping them
+ * in a queue ordered by deadline.  Keep it that way unless every writer goes through the queue: setInterval() is called
+ * from ISRs and other tasks (see TypedQueue::enqueueFromISR) and many threads set enabled directly, and a poll of a few
+ * dozen threads per wakeup costs less than the locking a shared queue would need.
+ *
  * TODO FIXME @geeksville
  *
  * move more things into OSThreads
@@ -60,6 +95,19 @@ class OSThread : public Thread
      */
     void setIntervalFromNow(unsigned long _interval);
 
+    /// Call at the start of each pass over mainController, to give BACKGROUND threads their budget back
+    static void startPass() { backgroundUsec = 0; }
+
+#if OSTHREAD_PROFILE
+    const ThreadProfile &getProfile() const { return profile; }
+
+    /// The thread in mainController with the longest single run so far (might be null)
+    static const OSThread *slowest();
+
+    /// Log the profile of every thread in mainController
+    static void logProfiles();
+#endif
+
   protected:
     /**
      * The method that will be called each time our thread gets a chance to run
@@ -69,8 +117,24 @@ class OSThread : public Thread
     virtual int32_t runOnce() = 0;
     bool sleepOnNextExecution = false;
 
+    /// Call from the constructor of threads that aren't PRIORITY_NORMAL
+    void setPriority(ThreadPriority p);
+
     // Do not override this
     virtual void run();
+
+  private:
+    ThreadPriority priority = PRIORITY_NORMAL;
+
+    static OSThread *radioThreads[OSTHREAD_MAX_RADIO_THREADS];
+    static uint32_t backgroundUsec;
+
+    /// Is any RADIO thread (other than this one) due to run?
+    bool radioWaiting(unsigned long time) const;
+
+#if OSTHREAD_PROFILE
+    ThreadProfile profile;
+#endif
 };
 
 /**
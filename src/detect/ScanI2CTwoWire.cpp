@@ -2,6 +2,7 @@
 
 #if !MESHTASTIC_EXCLUDE_I2C
 
+#include "SPILock.h"
 #include "concurrency/LockGuard.h"
 #if defined(ARCH_PORTDUINO)
 #include "linux/LinuxHardwareI2C.h"
@@ -9,6 +10,11 @@
 #if !defined(ARCH_PORTDUINO) && !defined(ARCH_STM32WL)
 #include "meshUtils.h" // vformat
 #endif
+#include <ErriezCRC32.h>
+#ifdef ARCH_ESP32
+#include "sleep.h" // wakeCause
+#include <esp_system.h>
+#endif
 
 bool in_array(uint8_t *array, int size, uint8_t lookfor)
 {
@@ -109,6 +115,26 @@ uint16_t ScanI2CTwoWire::getRegisterValue(const ScanI2CTwoWire::RegisterLocation
     return value;
 }
 
+uint8_t ScanI2CTwoWire::probeAddress(TwoWire *i2cBus, uint8_t address)
+{
+    uint8_t err;
+    i2cBus->beginTransmission(address);
+#ifdef ARCH_PORTDUINO
+    err = 2;
+    if ((address >= 0x30 && address <= 0x37) || (address >= 0x50 && address <= 0x5F)) {
+        if (i2cBus->read() != -1)
+            err = 0;
+    } else {
+        err = i2cBus->writeQuick((uint8_t)0);
+    }
+    if (err != 0)
+        err = 2;
+#else
+    err = i2cBus->endTransmission();
+#endif
+    return err;
+}
+
 #define SCAN_SIMPLE_CASE(ADDR, T, ...)                                                                                           \
     case ADDR:                                                                                                                   \
         logFoundDevice(__VA_ARGS__);                                                                                             \
@@ -157,22 +183,10 @@ void ScanI2CTwoWire::scanPort(I2CPort port, uint8_t *address, uint8_t asize)
                 continue;
             LOG_DEBUG("Scan address 0x%x", (uint8_t)addr.address);
         }
-        i2cBus->beginTransmission(addr.address);
-#ifdef ARCH_PORTDUINO
-        err = 2;
-        if ((addr.address >= 0x30 && addr.address <= 0x37) || (addr.address >= 0x50 && addr.address <= 0x5F)) {
-            if (i2cBus->read() != -1)
-                err = 0;
-        } else {
-            err = i2cBus->writeQuick((uint8_t)0);
-        }
-        if (err != 0)
-            err = 2;
-#else
-        err = i2cBus->endTransmission();
-#endif
+        err = probeAddress(i2cBus, addr.address);
         type = NONE;
         if (err == 0) {
+            answered[port][addr.address / 32] |= 1UL << (addr.address % 32);
             switch (addr.address) {
             case SSD1306_ADDRESS:
                 type = probeOLED(addr);
@@ -560,11 +574,184 @@ void ScanI2CTwoWire::scanPort(I2CPort port, uint8_t *address, uint8_t asize)
     }
 }
 
+#define I2C_SCAN_CACHE_MAGIC 0x12c5ca41
+
+#ifdef ARCH_ESP32
+/// Kept in RTC memory, which keeps its contents through a crash, a watchdog reset or deep sleep
+static RTC_NOINIT_ATTR I2CScanCache rtcScanCache;
+
+/// Only a reset that didn't cut power or come from the user (who might have just plugged something in) keeps the bus as it
+/// was.  Nobody touched the board either when the timer woke us from deep sleep, which is most wakes on a sleepy node.
+static bool busKeptSinceScan()
+{
+    switch (esp_reset_reason()) {
+    case ESP_RST_PANIC:
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+        return true;
+    case ESP_RST_DEEPSLEEP:
+        return wakeCause == ESP_SLEEP_WAKEUP_TIMER;
+    default:
+        return false;
+    }
+}
+#endif
+
+#ifdef FSCom
+static constexpr const char *i2cScanFileName = "/prefs/i2cscan.bin";
+
+/// The copy in flash, for any other boot
+static I2CScanCache savedScan;
+static bool savedScanLoaded;
+#endif
+
 void ScanI2CTwoWire::scanPort(I2CPort port)
 {
+#ifdef ARCH_ESP32
+    if (busKeptSinceScan() && restoreScan(port, rtcScanCache)) {
+        LOG_INFO("Reuse the scan of I2C port %d from before the reset or sleep", port);
+        return;
+    }
+#endif
+#ifdef FSCom
+    if (loadSavedScan() && sameAddressesAnswer(port) && restoreScan(port, savedScan)) {
+        LOG_INFO("I2C port %d has the same devices as when last scanned, skip identifying them", port);
+        return;
+    }
+#endif
+    memset(answered[port], 0, sizeof(answered[port]));
     scanPort(port, nullptr, 0);
+    rememberScan(port);
+}
+
+/// Identifying the devices again is only worth skipping if it would come to the same, so this changes with the board and
+/// with the firmware (which may know new devices by now)
+static uint32_t scanFingerprint()
+{
+    const char *version = optstr(APP_VERSION);
+    return crc32Buffer(version, strlen(version)) ^ (uint32_t)HW_VENDOR;
 }
 
+static uint32_t scanCacheCRC(const I2CScanCache &cache)
+{
+    return crc32Buffer(&cache, offsetof(I2CScanCache, crc));
+}
+
+static bool scanCacheValid(const I2CScanCache &cache)
+{
+    return cache.magic == I2C_SCAN_CACHE_MAGIC && cache.count <= I2C_SCAN_CACHE_DEVICES &&
+           cache.fingerprint == scanFingerprint() && cache.crc == scanCacheCRC(cache);
+}
+
+bool ScanI2CTwoWire::restoreScan(I2CPort port, const I2CScanCache &cache)
+{
+    if (!scanCacheValid(cache) || !(cache.scannedPorts & (1 << port)))
+        return false;
+
+    for (uint8_t i = 0; i < cache.count; i++) {
+        if (cache.devices[i].port != port)
+            continue;
+        DeviceAddress addr(port, cache.devices[i].address);
+        DeviceType type = (DeviceType)cache.devices[i].type;
+        deviceAddresses[type] = addr;
+        foundDevices[addr] = type;
+    }
+    memcpy(answered[port], cache.answered[port], sizeof(answered[port]));
+    return true;
+}
+
+void ScanI2CTwoWire::recordScan(I2CPort port, I2CScanCache &cache) const
+{
+    if (!scanCacheValid(cache)) {
+        memset(&cache, 0, sizeof(cache));
+        cache.magic = I2C_SCAN_CACHE_MAGIC;
+        cache.fingerprint = scanFingerprint();
+    }
+
+    // Replace whatever an earlier boot found on this port
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < cache.count; i++)
+        if (cache.devices[i].port != port)
+            cache.devices[kept++] = cache.devices[i];
+    cache.count = kept;
+    cache.scannedPorts |= 1 << port;
+    memcpy(cache.answered[port], answered[port], sizeof(cache.answered[port]));
+
+    for (auto &found : foundDevices) {
+        if (found.first.port != port)
+            continue;
+        if (cache.count == I2C_SCAN_CACHE_DEVICES) {
+            cache.scannedPorts &= ~(1 << port); // Too many to remember, scan this port again next time
+            break;
+        }
+        cache.devices[cache.count].port = port;
+        cache.devices[cache.count].address = found.first.address;
+        cache.devices[cache.count].type = found.second;
+        cache.count++;
+    }
+    cache.crc = scanCacheCRC(cache);
+}
+
+void ScanI2CTwoWire::rememberScan(I2CPort port)
+{
+#ifdef ARCH_ESP32
+    recordScan(port, rtcScanCache);
+#endif
+#ifdef FSCom
+    I2CScanCache before;
+    memcpy(&before, &savedScan, sizeof(before));
+    recordScan(port, savedScan);
+    if (memcmp(&before, &savedScan, sizeof(savedScan)) == 0)
+        return;
+
+    concurrency::LockGuard g(spiLock);
+    FSCom.mkdir("/prefs");
+    FSCom.remove(i2cScanFileName); // FILE_O_WRITE appends on some platforms
+    auto f = FSCom.open(i2cScanFileName, FILE_O_WRITE);
+    if (!f) {
+        LOG_ERROR("Could not open %s", i2cScanFileName);
+        return;
+    }
+    if (f.write((const uint8_t *)&savedScan, sizeof(savedScan)) != sizeof(savedScan))
+        LOG_ERROR("Could not write %s", i2cScanFileName);
+    f.close();
+    fileManifestChanged();
+#endif
+}
+
+#ifdef FSCom
+bool ScanI2CTwoWire::loadSavedScan()
+{
+    if (savedScanLoaded)
+        return scanCacheValid(savedScan);
+    savedScanLoaded = true;
+
+    concurrency::LockGuard g(spiLock);
+    auto f = FSCom.open(i2cScanFileName, FILE_O_READ);
+    if (!f)
+        return false;
+    bool okay = f.read((uint8_t *)&savedScan, sizeof(savedScan)) == sizeof(savedScan);
+    f.close();
+    if (!okay)
+        memset(&savedScan, 0, sizeof(savedScan));
+    return okay && scanCacheValid(savedScan);
+}
+
+bool ScanI2CTwoWire::sameAddressesAnswer(I2CPort port)
+{
+    concurrency::LockGuard guard((concurrency::Lock *)&lock);
+
+    // Only asking who acknowledges is quick, it's telling what each device is with register reads that takes long
+    TwoWire *i2cBus = fetchI2CBus(DeviceAddress(port, 0));
+    uint32_t now[4] = {};
+    for (uint8_t address = 8; address < 120; address++)
+        if (probeAddress(i2cBus, address) == 0)
+            now[address / 32] |= 1UL << (address % 32);
+    return memcmp(now, savedScan.answered[port], sizeof(now)) == 0;
+}
+#endif
+
 TwoWire *ScanI2CTwoWire::fetchI2CBus(ScanI2C::DeviceAddress address) const
 {
     if (address.port == ScanI2C::I2CPort::WIRE) {
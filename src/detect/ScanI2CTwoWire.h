@@ -10,10 +10,28 @@
 
 #include <Wire.h>
 
+#include "FSCommon.h"
 #include "ScanI2C.h"
 
 #include "../concurrency/Lock.h"
 
+#define I2C_SCAN_CACHE_DEVICES 16
+
+/// What the last full scan of each port found, so a boot that finds the bus unchanged can skip identifying the devices
+struct I2CScanCache {
+    uint32_t magic;
+    uint32_t fingerprint; // Board and firmware that did the identifying
+    uint8_t scannedPorts; // Bit per I2CPort
+    uint8_t count;
+    struct {
+        uint8_t port;
+        uint8_t address;
+        uint8_t type;
+    } devices[I2C_SCAN_CACHE_DEVICES];
+    uint32_t answered[3][4]; // By I2CPort, bit per address that acknowledged, whether we could tell what it is or not
+    uint32_t crc;
+};
+
 class ScanI2CTwoWire : public ScanI2C
 {
   public:
@@ -58,5 +76,30 @@ class ScanI2CTwoWire : public ScanI2C
     DeviceType probeOLED(ScanI2C::DeviceAddress) const;
 
     static void logFoundDevice(const char *device, uint8_t address);
+
+    /// @return 0 if a device acknowledged address, same as TwoWire::endTransmission()
+    static uint8_t probeAddress(TwoWire *i2cBus, uint8_t address);
+
+    /// Addresses that acknowledged on each port during the scan
+    uint32_t answered[3][4] = {};
+
+    /// Take the devices a full scan of port found from cache instead of probing again
+    /// @return false if we have to scan
+    bool restoreScan(ScanI2C::I2CPort port, const I2CScanCache &cache);
+
+    /// Put what the full scan of port found into cache
+    void recordScan(ScanI2C::I2CPort port, I2CScanCache &cache) const;
+
+    /// Keep what the full scan of port found for restoreScan() on the next boot (and after a crash, in RTC memory on ESP32)
+    void rememberScan(ScanI2C::I2CPort port);
+
+#ifdef FSCom
+    /// Read the scan a previous boot saved, once
+    /// @return false if there is none we can use
+    bool loadSavedScan();
+
+    /// @return true if exactly the addresses that answered when savedScan was made answer on port now
+    bool sameAddressesAnswer(ScanI2C::I2CPort port);
+#endif
 };
 #endif
\ No newline at end of file
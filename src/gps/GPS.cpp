@@ -5,11 +5,14 @@
 #include "configuration.h"
 #if !MESHTASTIC_EXCLUDE_GPS
 #include "Default.h"
+#include "FSCommon.h"
 #include "GPS.h"
 #include "GpioLogic.h"
 #include "NodeDB.h"
 #include "PowerMon.h"
 #include "RTC.h"
+#include "SPILock.h"
+#include "SafeFile.h"
 #include "Throttle.h"
 #include "buzz.h"
 #include "concurrency/Periodic.h"
@@ -67,6 +70,7 @@ static struct uBloxGnssModelInfo {
     uint8_t protocol_version;
 } ublox_info;
 
+#define GPS_READ_CHUNK 64 // Bytes whileActive() takes from the serial port per call
 #define GPS_SOL_EXPIRY_MS 5000 // in millis. give 1 second time to combine different sentences. NMEA Frequency isn't higher anyway
 #define NMEA_MSG_GXGSA "GNGSA" // GSA message (GPGSA, GNGSA etc)
 
@@ -495,38 +499,55 @@ bool GPS::setup()
     if (!didSerialInit) {
         int msglen = 0;
         if (tx_gpio && gnssModel == GNSS_MODEL_UNKNOWN) {
+            if (!probeCacheLoaded)
+                loadProbeCache();
 #ifdef TRACKER_T1000_E
-            // add power up/down strategy, improve ag3335 detection success
-            digitalWrite(PIN_GPS_EN, LOW);
-            delay(500);
-            digitalWrite(GPS_VRTC_EN, LOW);
-            delay(1000);
-            digitalWrite(GPS_VRTC_EN, HIGH);
-            delay(500);
-            digitalWrite(PIN_GPS_EN, HIGH);
-            delay(1000);
+            if (probeFamily == PROBE_START) {
+                // add power up/down strategy, improve ag3335 detection success
+                digitalWrite(PIN_GPS_EN, LOW);
+                delay(500);
+                digitalWrite(GPS_VRTC_EN, LOW);
+                delay(1000);
+                digitalWrite(GPS_VRTC_EN, HIGH);
+                delay(500);
+                digitalWrite(PIN_GPS_EN, HIGH);
+                delay(1000);
+            }
 #endif
-            if (probeTries < GPS_PROBETRIES) {
-                LOG_DEBUG("Probe for GPS at %d", serialSpeeds[speedSelect]);
+            // Each call of probe() only tries one chip family, we move on to the next speed once it has tried them all
+            if (cachedSpeed) {
+                if (probeFamily == PROBE_START)
+                    LOG_DEBUG("Probe for GPS at %d, where we found it last time", cachedSpeed);
+                gnssModel = probe(cachedSpeed);
+                if (gnssModel == GNSS_MODEL_UNKNOWN && probeFamily == PROBE_START)
+                    cachedSpeed = 0; // Not there any more, search everywhere
+            } else if (probeTries < GPS_PROBETRIES) {
+                if (probeFamily == PROBE_START)
+                    LOG_DEBUG("Probe for GPS at %d", serialSpeeds[speedSelect]);
                 gnssModel = probe(serialSpeeds[speedSelect]);
-                if (gnssModel == GNSS_MODEL_UNKNOWN) {
+                if (gnssModel == GNSS_MODEL_UNKNOWN && probeFamily == PROBE_START) {
                     if (++speedSelect == array_count(serialSpeeds)) {
                         speedSelect = 0;
                         ++probeTries;
                     }
                 }
-            }
-            // Rare Serial Speeds
-            if (probeTries == GPS_PROBETRIES) {
-                LOG_DEBUG("Probe for GPS at %d", rareSerialSpeeds[speedSelect]);
+            } else if (probeTries == GPS_PROBETRIES) {
+                // Rare Serial Speeds
+                if (probeFamily == PROBE_START)
+                    LOG_DEBUG("Probe for GPS at %d", rareSerialSpeeds[speedSelect]);
                 gnssModel = probe(rareSerialSpeeds[speedSelect]);
-                if (gnssModel == GNSS_MODEL_UNKNOWN) {
+                if (gnssModel == GNSS_MODEL_UNKNOWN && probeFamily == PROBE_START) {
                     if (++speedSelect == array_count(rareSerialSpeeds)) {
                         LOG_WARN("Give up on GPS probe and set to %d", GPS_BAUDRATE);
                         return true;
                     }
                 }
             }
+
+            if (gnssModel != GNSS_MODEL_UNKNOWN) {
+                saveProbeCache(probeFamily - 1); // probe() has already stepped past the family that answered
+                probeFamily = PROBE_START;
+            }
         }
 
         if (gnssModel != GNSS_MODEL_UNKNOWN) {
@@ -737,6 +758,22 @@ bool GPS::setup()
             SEND_UBX_PACKET(0x06, 0x01, _message_VTG, "disable NMEA VTG", 500);
             SEND_UBX_PACKET(0x06, 0x01, _message_RMC, "enable NMEA RMC", 500);
             SEND_UBX_PACKET(0x06, 0x01, _message_GGA, "enable NMEA GGA", 500);
+#if GPS_UBX_NAV_PVT
+            if (IS_ONE_OF(gnssModel, GNSS_MODEL_UBLOX8, GNSS_MODEL_UBLOX9)) {
+                clearBuffer();
+                msglen = makeUBXPacket(0x06, 0x01, sizeof(_message_NAV_PVT), _message_NAV_PVT);
+                _serial_gps->write(UBXscratch, msglen);
+                if (getACK(0x06, 0x01, 500) == GNSS_RESPONSE_OK) {
+                    // Only turn NMEA off once we know we'll get the binary solution instead
+                    SEND_UBX_PACKET(0x06, 0x01, _message_RMC_OFF, "disable NMEA RMC", 500);
+                    SEND_UBX_PACKET(0x06, 0x01, _message_GGA_OFF, "disable NMEA GGA", 500);
+                    ubxBinary = true;
+                    LOG_INFO("GPS will report UBX-NAV-PVT instead of NMEA");
+                } else {
+                    LOG_WARN("Unable to enable UBX-NAV-PVT, stay with NMEA");
+                }
+            }
+#endif
 
             if (ublox_info.protocol_version >= 18) {
                 clearBuffer();
@@ -790,6 +827,24 @@ bool GPS::setup()
             SEND_UBX_PACKET(0x06, 0x8A, _message_VALSET_DISABLE_SBAS_BBR, "disable SBAS M10 GPS BBR", 300);
             delay(750); // will cause a receiver restart so wait a bit
 
+#if GPS_UBX_NAV_PVT
+            // Done with initialization, have the M10 send UBX-NAV-PVT rather than NMEA, RAM layer first so we know it works
+            clearBuffer();
+            msglen = makeUBXPacket(0x06, 0x8A, sizeof(_message_VALSET_ENABLE_NAV_PVT_RAM), _message_VALSET_ENABLE_NAV_PVT_RAM);
+            _serial_gps->write(UBXscratch, msglen);
+            ubxBinary = getACK(0x06, 0x8A, 500) == GNSS_RESPONSE_OK;
+            delay(750);
+            if (ubxBinary) {
+                SEND_UBX_PACKET(0x06, 0x8A, _message_VALSET_ENABLE_NAV_PVT_BBR, "enable NAV-PVT for M10 GPS BBR", 300);
+                LOG_INFO("GPS will report UBX-NAV-PVT instead of NMEA");
+            } else {
+                LOG_WARN("Unable to enable UBX-NAV-PVT, stay with NMEA");
+                SEND_UBX_PACKET(0x06, 0x8A, _message_VALSET_ENABLE_NMEA_BBR, "enable messages for M10 GPS BBR", 300);
+                delay(750);
+                SEND_UBX_PACKET(0x06, 0x8A, _message_VALSET_ENABLE_NMEA_RAM, "enable messages for M10 GPS RAM", 500);
+            }
+            delay(750);
+#else
             // Done with initialization, Now enable wanted NMEA messages in BBR layer so they will survive a periodic
             // sleep.
             SEND_UBX_PACKET(0x06, 0x8A, _message_VALSET_ENABLE_NMEA_BBR, "enable messages for M10 GPS BBR", 300);
@@ -797,6 +852,7 @@ bool GPS::setup()
             // Next enable wanted NMEA messages in RAM layer
             SEND_UBX_PACKET(0x06, 0x8A, _message_VALSET_ENABLE_NMEA_RAM, "enable messages for M10 GPS RAM", 500);
             delay(750);
+#endif
 
             // As the M10 has no flash, the best we can do to preserve the config is to set it in RAM and BBR.
             // BBR will survive a restart, and power off for a while, but modules with small backup
@@ -1023,7 +1079,7 @@ void GPS::up()
 // We've got a GPS lock. Enter a low power state, potentially.
 void GPS::down()
 {
-    scheduling.informGotLock();
+    scheduling.informGotLock(p.sats_in_view);
     uint32_t predictedSearchDuration = scheduling.predictedSearchDurationMs();
     uint32_t sleepTime = scheduling.msUntilNextSearch();
     uint32_t updateInterval = Default::getConfiguredOrDefaultMs(config.position.gps_update_interval);
@@ -1090,13 +1146,23 @@ int32_t GPS::runOnce()
             return disable();
         }
         if (!setup())
-            return 2000; // Setup failed, re-run in two seconds
+            return probeFamily != PROBE_START ? 0 : 2000; // Carry on probing at once, or re-run setup in two seconds
 
         // We have now loaded our saved preferences from flash
         if (config.position.gps_mode != meshtastic_Config_PositionConfig_GpsMode_ENABLED) {
             return disable();
         }
         GPSInitFinished = true;
+#ifdef ARCH_ESP32
+        // From now on the UART tells us when the chip has gone quiet after a burst, rather than us polling for it
+        _serial_gps->onReceive(
+            []() {
+                if (gps)
+                    gps->onSerialIdle();
+            },
+            true);
+        serialIdleEvents = true;
+#endif
         publishUpdate();
     }
 
@@ -1156,8 +1222,21 @@ int32_t GPS::runOnce()
 
     // 9600bps is approx 1 byte per msec, so considering our buffer size we never need to wake more often than 200ms
     // if not awake we can run super infrquently (once every 5 secs?) to see if we need to wake.
-    return (powerState == GPS_ACTIVE) ? GPS_THREAD_INTERVAL : 5000;
+    // When the UART wakes us at the end of each burst we only need to poll for the scheduling.
+    if (powerState != GPS_ACTIVE)
+        return 5000;
+    return serialIdleEvents ? GPS_IDLE_EVENT_INTERVAL : GPS_THREAD_INTERVAL;
+}
+
+#ifdef ARCH_ESP32
+void GPS::onSerialIdle()
+{
+    if (powerState != GPS_ACTIVE)
+        return; // whileActive() would just throw it away, no need to wake up early for that
+    setInterval(0);
+    concurrency::mainDelay.interrupt();
 }
+#endif
 
 // clear the GPS rx/tx buffer as quickly as possible
 void GPS::clearBuffer()
@@ -1169,6 +1248,9 @@ void GPS::clearBuffer()
     while (x--)
         _serial_gps->read();
 #endif
+#if GPS_UBX_NAV_PVT
+    ubxPos = 0;
+#endif
 }
 
 /// Prepare the GPS for the cpu entering deep or light sleep, expect to be gone for at least 100s of msecs
@@ -1206,6 +1288,61 @@ static const char *DETECTED_MESSAGE = "%s detected";
 
 GnssModel_t GPS::probe(int serialSpeed)
 {
+    probeSpeed = serialSpeed;
+    switch (probeFamily++) {
+    default: // PROBE_START
+        break;
+    case PROBE_UNICORE: {
+        // Unicore UFirebirdII Series: UC6580, UM620, UM621, UM670A, UM680A, or UM681A
+        std::vector<ChipInfo> unicore = {{"UC6580", "UC6580", GNSS_MODEL_UC6580}, {"UM600", "UM600", GNSS_MODEL_UC6580}};
+        PROBE_FAMILY("Unicore Family", "$PDTINFO", unicore, 500);
+        return GNSS_MODEL_UNKNOWN;
+    }
+    case PROBE_ATGM: {
+        std::vector<ChipInfo> atgm = {
+            {"ATGM336H", "$GPTXT,01,01,02,HW=ATGM336H", GNSS_MODEL_ATGM336H},
+            /* ATGM332D series (-11(GPS), -21(BDS), -31(GPS+BDS), -51(GPS+GLONASS), -71-0(GPS+BDS+GLONASS)) based on AT6558 */
+            {"ATGM332D", "$GPTXT,01,01,02,HW=ATGM332D", GNSS_MODEL_ATGM336H}};
+        PROBE_FAMILY("ATGM33xx Family", "$PCAS06,1*1A", atgm, 500);
+        return GNSS_MODEL_UNKNOWN;
+    }
+    case PROBE_AIROHA: {
+        /* Airoha (Mediatek) AG3335A/M/S, A3352Q, Quectel L89 2.0, SimCom SIM65M */
+        _serial_gps->write("$PAIR062,2,0*3C\r\n"); // GSA OFF to reduce volume
+        _serial_gps->write("$PAIR062,3,0*3D\r\n"); // GSV OFF to reduce volume
+        _serial_gps->write("$PAIR513*3D\r\n");     // save configuration
+        std::vector<ChipInfo> airoha = {{"AG3335", "$PAIR021,AG3335", GNSS_MODEL_AG3335},
+                                        {"AG3352", "$PAIR021,AG3352", GNSS_MODEL_AG3352},
+                                        {"RYS3520", "$PAIR021,REYAX_RYS3520_V2", GNSS_MODEL_AG3352}};
+        PROBE_FAMILY("Airoha Family", "$PAIR021*39", airoha, 1000);
+        return GNSS_MODEL_UNKNOWN;
+    }
+    case PROBE_LC86:
+        PROBE_SIMPLE("LC86", "$PQTMVERNO*58", "$PQTMVERNO,LC86", GNSS_MODEL_AG3352, 500);
+        return GNSS_MODEL_UNKNOWN;
+    case PROBE_L76K:
+        PROBE_SIMPLE("L76K", "$PCAS06,0*1B", "$GPTXT,01,01,02,SW=", GNSS_MODEL_MTK, 500);
+        return GNSS_MODEL_UNKNOWN;
+    case PROBE_MTK: {
+        // Close all NMEA sentences, valid for MTK3333 and MTK3339 platforms
+        _serial_gps->write("$PMTK514,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0*2E\r\n");
+        delay(20);
+        std::vector<ChipInfo> mtk = {{"L76B", "Quectel-L76B", GNSS_MODEL_MTK_L76B}, {"PA1010D", "1010D", GNSS_MODEL_MTK_PA1010D},
+                                     {"PA1616S", "1616S", GNSS_MODEL_MTK_PA1616S},  {"LS20031", "MC-1513", GNSS_MODEL_MTK_L76B},
+                                     {"L96", "Quectel-L96", GNSS_MODEL_MTK_L76B},   {"L80-R", "_3337_", GNSS_MODEL_MTK_L76B},
+                                     {"L80", "_3339_", GNSS_MODEL_MTK_L76B}};
+
+        PROBE_FAMILY("MTK Family", "$PMTK605*31", mtk, 500);
+        return GNSS_MODEL_UNKNOWN;
+    }
+    case PROBE_UBLOX: {
+        GnssModel_t model = probeUblox(serialSpeed);
+        if (model == GNSS_MODEL_UNKNOWN)
+            probeFamily = PROBE_START; // Nothing left to try at this speed
+        return model;
+    }
+    }
+
 #if defined(ARCH_NRF52) || defined(ARCH_PORTDUINO) || defined(ARCH_STM32WL)
     _serial_gps->end();
     _serial_gps->begin(serialSpeed);
@@ -1221,7 +1358,6 @@ GnssModel_t GPS::probe(int serialSpeed)
 #endif
 
     memset(&ublox_info, 0, sizeof(ublox_info));
-    uint8_t buffer[768] = {0};
     delay(100);
 
     // Close all NMEA sentences, valid for L76K, ATGM336H (and likely other AT6558 devices)
@@ -1233,38 +1369,17 @@ GnssModel_t GPS::probe(int serialSpeed)
     _serial_gps->write("$PUBX,40,VTG,0,0,0,0,0,0*5E\r\n");
     delay(20);
 
-    // Unicore UFirebirdII Series: UC6580, UM620, UM621, UM670A, UM680A, or UM681A
-    std::vector<ChipInfo> unicore = {{"UC6580", "UC6580", GNSS_MODEL_UC6580}, {"UM600", "UM600", GNSS_MODEL_UC6580}};
-    PROBE_FAMILY("Unicore Family", "$PDTINFO", unicore, 500);
-
-    std::vector<ChipInfo> atgm = {
-        {"ATGM336H", "$GPTXT,01,01,02,HW=ATGM336H", GNSS_MODEL_ATGM336H},
-        /* ATGM332D series (-11(GPS), -21(BDS), -31(GPS+BDS), -51(GPS+GLONASS), -71-0(GPS+BDS+GLONASS)) based on AT6558 */
-        {"ATGM332D", "$GPTXT,01,01,02,HW=ATGM332D", GNSS_MODEL_ATGM336H}};
-    PROBE_FAMILY("ATGM33xx Family", "$PCAS06,1*1A", atgm, 500);
-
-    /* Airoha (Mediatek) AG3335A/M/S, A3352Q, Quectel L89 2.0, SimCom SIM65M */
-    _serial_gps->write("$PAIR062,2,0*3C\r\n"); // GSA OFF to reduce volume
-    _serial_gps->write("$PAIR062,3,0*3D\r\n"); // GSV OFF to reduce volume
-    _serial_gps->write("$PAIR513*3D\r\n");     // save configuration
-    std::vector<ChipInfo> airoha = {{"AG3335", "$PAIR021,AG3335", GNSS_MODEL_AG3335},
-                                    {"AG3352", "$PAIR021,AG3352", GNSS_MODEL_AG3352},
-                                    {"RYS3520", "$PAIR021,REYAX_RYS3520_V2", GNSS_MODEL_AG3352}};
-    PROBE_FAMILY("Airoha Family", "$PAIR021*39", airoha, 1000);
-
-    PROBE_SIMPLE("LC86", "$PQTMVERNO*58", "$PQTMVERNO,LC86", GNSS_MODEL_AG3352, 500);
-    PROBE_SIMPLE("L76K", "$PCAS06,0*1B", "$GPTXT,01,01,02,SW=", GNSS_MODEL_MTK, 500);
-
-    // Close all NMEA sentences, valid for MTK3333 and MTK3339 platforms
-    _serial_gps->write("$PMTK514,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0*2E\r\n");
-    delay(20);
-    std::vector<ChipInfo> mtk = {{"L76B", "Quectel-L76B", GNSS_MODEL_MTK_L76B}, {"PA1010D", "1010D", GNSS_MODEL_MTK_PA1010D},
-                                 {"PA1616S", "1616S", GNSS_MODEL_MTK_PA1616S},  {"LS20031", "MC-1513", GNSS_MODEL_MTK_L76B},
-                                 {"L96", "Quectel-L96", GNSS_MODEL_MTK_L76B},   {"L80-R", "_3337_", GNSS_MODEL_MTK_L76B},
-                                 {"L80", "_3339_", GNSS_MODEL_MTK_L76B}};
-
-    PROBE_FAMILY("MTK Family", "$PMTK605*31", mtk, 500);
+    // Go straight to the family that answered last time we found the GPS at this speed
+    if (serialSpeed == cachedSpeed && cachedFamily > PROBE_START && cachedFamily <= PROBE_UBLOX)
+        probeFamily = cachedFamily;
+    else
+        probeFamily = PROBE_UNICORE;
+    return GNSS_MODEL_UNKNOWN;
+}
 
+GnssModel_t GPS::probeUblox(int serialSpeed)
+{
+    uint8_t buffer[768] = {0};
     uint8_t cfg_rate[] = {0xB5, 0x62, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00};
     UBXChecksum(cfg_rate, sizeof(cfg_rate));
     clearBuffer();
@@ -1392,6 +1507,52 @@ GnssModel_t GPS::getProbeResponse(unsigned long timeout, const std::vector<ChipI
     return GNSS_MODEL_UNKNOWN; // Return empty string on timeout
 }
 
+#define GPS_PROBE_CACHE_FILE "/prefs/gnss.dat"
+#define GPS_PROBE_CACHE_MAGIC 0x53534e47 // "GNSS"
+
+struct GPSProbeCache {
+    uint32_t magic;
+    int32_t speed;
+    uint8_t family;
+};
+
+void GPS::loadProbeCache()
+{
+    probeCacheLoaded = true;
+#ifdef FSCom
+    concurrency::LockGuard g(spiLock);
+    if (!FSCom.exists(GPS_PROBE_CACHE_FILE))
+        return;
+    auto f = FSCom.open(GPS_PROBE_CACHE_FILE, FILE_O_READ);
+    if (!f)
+        return;
+    GPSProbeCache cache;
+    if (f.read((uint8_t *)&cache, sizeof(cache)) == sizeof(cache) && cache.magic == GPS_PROBE_CACHE_MAGIC && cache.speed > 0) {
+        cachedSpeed = cache.speed;
+        cachedFamily = cache.family;
+    }
+    f.close();
+#endif
+}
+
+void GPS::saveProbeCache(uint8_t family)
+{
+    if (probeSpeed == cachedSpeed && family == cachedFamily)
+        return; // Found it right where we looked first
+    cachedSpeed = probeSpeed;
+    cachedFamily = family;
+#ifdef FSCom
+    spiLock->lock();
+    FSCom.mkdir("/prefs");
+    spiLock->unlock();
+    SafeFile f(GPS_PROBE_CACHE_FILE, true);
+    GPSProbeCache cache = {GPS_PROBE_CACHE_MAGIC, probeSpeed, family};
+    f.write((const uint8_t *)&cache, sizeof(cache));
+    if (!f.close())
+        LOG_ERROR("Can't write %s", GPS_PROBE_CACHE_FILE);
+#endif
+}
+
 GPS *GPS::createGps()
 {
     int8_t _rx_gpio = config.position.rx_gpio;
@@ -1508,6 +1669,10 @@ static int32_t toDegInt(RawDegrees d)
  */
 bool GPS::lookForTime()
 {
+#if GPS_UBX_NAV_PVT
+    if (ubxBinary)
+        return lookForTimeUBX();
+#endif
 
 #ifdef GNSS_AIROHA
     uint8_t fix = reader.fixQuality();
@@ -1563,6 +1728,10 @@ The Unix epoch (or Unix time or POSIX time or Unix timestamp) is the number of s
  */
 bool GPS::lookForLocation()
 {
+#if GPS_UBX_NAV_PVT
+    if (ubxBinary)
+        return lookForLocationUBX();
+#endif
 #ifdef GNSS_AIROHA
     if ((config.position.gps_update_interval * 1000) >= (GPS_FIX_HOLD_TIME * 2)) {
         uint8_t fix = reader.fixQuality();
@@ -1711,6 +1880,10 @@ bool GPS::lookForLocation()
 
 bool GPS::hasLock()
 {
+#if GPS_UBX_NAV_PVT
+    if (ubxBinary) // gnssFixOK with a 3D fix
+        return navPvtCount && (navPvt.flags & 0x01) && (navPvt.fixType == 3 || navPvt.fixType == 4);
+#endif
     // Using GPGGA fix quality indicator
     if (fixQual >= 1 && fixQual <= 5) {
 #ifndef TINYGPS_OPTION_NO_CUSTOM_FIELDS
@@ -1725,6 +1898,10 @@ bool GPS::hasLock()
 
 bool GPS::hasFlow()
 {
+#if GPS_UBX_NAV_PVT
+    if (ubxBinary)
+        return navPvtCount > 0;
+#endif
     return reader.passedChecksum() > 0;
 }
 
@@ -1745,21 +1922,35 @@ bool GPS::whileActive()
         clearBuffer();
     }
 #endif
-    // First consume any chars that have piled up at the receiver
-    while (_serial_gps->available() > 0) {
-        int c = _serial_gps->read();
-        UBXscratch[charsInBuf] = c;
+    // First consume any chars that have piled up at the receiver, a chunk at a time rather than a call per char
+    uint8_t chunk[GPS_READ_CHUNK];
+    int waiting;
+    while ((waiting = _serial_gps->available()) > 0) {
+        size_t got = _serial_gps->readBytes((char *)chunk, waiting < GPS_READ_CHUNK ? waiting : GPS_READ_CHUNK);
+        if (!got)
+            break;
+#if GPS_UBX_NAV_PVT
+        if (ubxBinary) {
+            for (size_t i = 0; i < got; i++)
+                isValid |= parseUBX(chunk[i]);
+            continue;
+        }
+#endif
+        for (size_t i = 0; i < got; i++) {
+            uint8_t c = chunk[i];
+            UBXscratch[charsInBuf] = c;
 #ifdef GPS_DEBUG
-        debugmsg += vformat("%c", (c >= 32 && c <= 126) ? c : '.');
+            debugmsg += vformat("%c", (c >= 32 && c <= 126) ? c : '.');
 #endif
-        isValid |= reader.encode(c);
-        if (charsInBuf > sizeof(UBXscratch) - 10 || c == '\r') {
-            if (strnstr((char *)UBXscratch, "$GPTXT,01,01,02,u-blox ag - www.u-blox.com*50", charsInBuf)) {
-                rebootsSeen++;
+            isValid |= reader.encode(c);
+            if (charsInBuf > sizeof(UBXscratch) - 10 || c == '\r') {
+                if (strnstr((char *)UBXscratch, "$GPTXT,01,01,02,u-blox ag - www.u-blox.com*50", charsInBuf)) {
+                    rebootsSeen++;
+                }
+                charsInBuf = 0;
+            } else {
+                charsInBuf++;
             }
-            charsInBuf = 0;
-        } else {
-            charsInBuf++;
         }
     }
 #ifdef GPS_DEBUG
@@ -1769,6 +1960,121 @@ bool GPS::whileActive()
 #endif
     return isValid;
 }
+#if GPS_UBX_NAV_PVT
+static_assert(sizeof(UBXNavPVT) == 92, "UBX-NAV-PVT payload is 92 bytes");
+
+bool GPS::parseUBX(uint8_t c)
+{
+    // Resynchronise on the two sync chars, the frame goes into UBXscratch as it arrives
+    if ((ubxPos == 0 && c != 0xB5) || (ubxPos == 1 && c != 0x62)) {
+        ubxPos = (c == 0xB5) ? 1 : 0;
+        return false;
+    }
+    UBXscratch[ubxPos++] = c;
+    if (ubxPos == 6) {
+        ubxLen = UBXscratch[4] | (UBXscratch[5] << 8);
+        if ((size_t)ubxLen + 8 > sizeof(UBXscratch)) { // Too long to be anything we want
+            ubxPos = 0;
+            return false;
+        }
+    }
+    if (ubxPos < 6 || ubxPos < ubxLen + 8)
+        return false;
+    ubxPos = 0;
+
+    uint8_t ckA = 0, ckB = 0;
+    for (uint16_t i = 2; i < ubxLen + 6; i++) {
+        ckA += UBXscratch[i];
+        ckB += ckA;
+    }
+    if (ckA != UBXscratch[ubxLen + 6] || ckB != UBXscratch[ubxLen + 7]) {
+        LOG_WARN("UBX checksum failure for class 0x%02x id 0x%02x", UBXscratch[2], UBXscratch[3]);
+        return false;
+    }
+    if (UBXscratch[2] != 0x01 || UBXscratch[3] != 0x07 || ubxLen != sizeof(navPvt))
+        return false; // Not NAV-PVT, maybe an ACK for a power command
+
+    memcpy(&navPvt, UBXscratch + 6, sizeof(navPvt));
+    navPvtCount++;
+    navPvtUpdated = true;
+    return true;
+}
+
+bool GPS::lookForTimeUBX()
+{
+    if (!navPvtCount || (navPvt.valid & 0x07) != 0x07) // validDate, validTime and fullyResolved
+        return false;
+
+    struct tm t;
+    t.tm_sec = navPvt.sec;
+    t.tm_min = navPvt.min;
+    t.tm_hour = navPvt.hour;
+    t.tm_mday = navPvt.day;
+    t.tm_mon = navPvt.month - 1;
+    t.tm_year = navPvt.year - 1900;
+    t.tm_isdst = false;
+    LOG_DEBUG("UBX GPS time %02d-%02d-%02d %02d:%02d:%02d", navPvt.year, navPvt.month, t.tm_mday, t.tm_hour, t.tm_min,
+              t.tm_sec);
+    if (perhapsSetRTC(RTCQualityGPS, t) == RTCSetResultInvalidTime)
+        clearBuffer();
+    return true;
+}
+
+bool GPS::lookForLocationUBX()
+{
+    // Same GGA fix quality the NMEA path reports: 1 for a fix, 2 for a differential one
+    fixQual = (navPvt.flags & 0x01) ? ((navPvt.flags & 0x02) ? 2 : 1) : 0;
+#ifndef TINYGPS_OPTION_NO_CUSTOM_FIELDS
+    fixType = navPvt.fixType == 2 ? 2 : (navPvt.fixType == 3 || navPvt.fixType == 4) ? 3 : 1; // As GSA would report it
+#endif
+
+    if (!hasLock() || !navPvtUpdated)
+        return false;
+    navPvtUpdated = false;
+
+    if (navPvt.lat > 900000000 || navPvt.lat < -900000000 || navPvt.lon > 1800000000 || navPvt.lon < -1800000000 ||
+        navPvt.pDOP == 0) {
+        LOG_WARN("BOGUS UBX-NAV-PVT REJECTED: lat %d lon %d pDOP %u", navPvt.lat, navPvt.lon, navPvt.pDOP);
+        return false;
+    }
+
+    p.location_source = meshtastic_Position_LocSource_LOC_INTERNAL;
+
+    // NAV-PVT only has PDOP, which is never better than HDOP so it makes a cautious stand in
+    p.PDOP = navPvt.pDOP;
+    p.HDOP = navPvt.pDOP;
+
+    p.latitude_i = navPvt.lat;
+    p.longitude_i = navPvt.lon;
+
+    p.altitude = navPvt.hMSL / 1000;
+    p.altitude_hae = navPvt.height / 1000;
+    p.altitude_geoidal_separation = (navPvt.height - navPvt.hMSL) / 1000;
+
+    p.fix_quality = fixQual;
+#ifndef TINYGPS_OPTION_NO_CUSTOM_FIELDS
+    p.fix_type = fixType;
+#endif
+
+    struct tm t;
+    t.tm_sec = navPvt.sec;
+    t.tm_min = navPvt.min;
+    t.tm_hour = navPvt.hour;
+    t.tm_mday = navPvt.day;
+    t.tm_mon = navPvt.month - 1;
+    t.tm_year = navPvt.year - 1900;
+    t.tm_isdst = false;
+    p.timestamp = gm_mktime(&t);
+
+    p.sats_in_view = navPvt.numSV;
+    if (navPvt.headMot >= 0 && navPvt.headMot < 36000000) // Already degrees * 10^-5
+        p.ground_track = navPvt.headMot;
+    p.ground_speed = navPvt.gSpeed * 36 / 10000; // mm/s to km/h
+
+    return true;
+}
+#endif
+
 void GPS::enable()
 {
     // Clear the old scheduling info (reset the lock-time prediction)
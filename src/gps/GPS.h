@@ -16,6 +16,14 @@
 #define GPS_EN_ACTIVE 1
 #endif
 
+#ifndef GPS_IDLE_EVENT_INTERVAL
+#define GPS_IDLE_EVENT_INTERVAL 1000 // How often an active GPS still runs when the UART wakes it after each burst
+#endif
+
+#ifndef GPS_UBX_NAV_PVT
+#define GPS_UBX_NAV_PVT 0 // Have u-blox M8/M9/M10 send one binary UBX-NAV-PVT per fix instead of NMEA sentences
+#endif
+
 typedef enum {
     GNSS_MODEL_ATGM336H,
     GNSS_MODEL_MTK,
@@ -49,11 +57,51 @@ enum GPSPowerState : uint8_t {
     GPS_OFF        // Powered off indefinitely
 };
 
+/// The chip families GPS::probe() tries in turn at each serial speed, one per call
+enum GPSProbeFamily : uint8_t {
+    PROBE_START, // Set the speed and quiet the chip
+    PROBE_UNICORE,
+    PROBE_ATGM,
+    PROBE_AIROHA,
+    PROBE_LC86,
+    PROBE_L76K,
+    PROBE_MTK,
+    PROBE_UBLOX
+};
+
 struct ChipInfo {
     String chipName;        // The name of the chip (for logging)
     String detectionString; // The string to match in the response
     GnssModel_t driver;     // The driver to use
 };
+#if GPS_UBX_NAV_PVT
+/// Payload of UBX-NAV-PVT (protocol 15 and later), little endian like every MCU we run on
+struct UBXNavPVT {
+    uint32_t iTOW;
+    uint16_t year;
+    uint8_t month, day, hour, min, sec;
+    uint8_t valid; // validDate, validTime, fullyResolved, validMag
+    uint32_t tAcc;
+    int32_t nano;
+    uint8_t fixType; // 0 none, 1 dead reckoning, 2 2D, 3 3D, 4 GNSS + dead reckoning, 5 time only
+    uint8_t flags;   // gnssFixOK, diffSoln, ...
+    uint8_t flags2;
+    uint8_t numSV;
+    int32_t lon, lat;     // 1e-7 degrees
+    int32_t height, hMSL; // mm above the ellipsoid and above mean sea level
+    uint32_t hAcc, vAcc;
+    int32_t velN, velE, velD, gSpeed; // mm/s
+    int32_t headMot;                  // 1e-5 degrees
+    uint32_t sAcc, headAcc;
+    uint16_t pDOP; // 0.01
+    uint8_t flags3;
+    uint8_t reserved1[5];
+    int32_t headVeh;
+    int16_t magDec;
+    uint16_t magAcc;
+} __attribute__((packed));
+#endif
+
 /**
  * A gps class that only reads from the GPS periodically and keeps the gps powered down except when reading
  *
@@ -117,6 +165,11 @@ class GPS : private concurrency::OSThread
     // Let the GPS hardware save power between updates
     void down();
 
+#ifdef ARCH_ESP32
+    /// Called from the UART event task once the chip stops sending, so we parse each burst as soon as it is complete
+    void onSerialIdle();
+#endif
+
   private:
     GPS() : concurrency::OSThread("GPS") {}
 
@@ -163,8 +216,28 @@ class GPS : private concurrency::OSThread
     uint32_t rx_gpio = 0;
     uint32_t tx_gpio = 0;
 
+#if GPS_UBX_NAV_PVT
+    bool ubxBinary = false;     // The chip sends UBX-NAV-PVT instead of NMEA, so reader gets nothing
+    UBXNavPVT navPvt;           // The last NAV-PVT that passed its checksum
+    bool navPvtUpdated = false; // navPvt is newer than the last position we took from it
+    uint32_t navPvtCount = 0;
+    uint16_t ubxPos = 0, ubxLen = 0; // Where parseUBX() is in the frame it is collecting in UBXscratch
+
+    /// Feed one byte from the chip, @return true if it completed a valid NAV-PVT
+    bool parseUBX(uint8_t c);
+    bool lookForTimeUBX();
+    bool lookForLocationUBX();
+#endif
+
     uint8_t speedSelect = 0;
     uint8_t probeTries = 0;
+    uint8_t probeFamily = PROBE_START; // What the next call of probe() will try at the current speed
+    int probeSpeed = 0;                // The speed probe() was last called for
+
+    // Where we found the GPS on an earlier boot, which we try first
+    bool probeCacheLoaded = false;
+    int cachedSpeed = 0;
+    uint8_t cachedFamily = PROBE_START;
 
     /**
      * hasValidLocation - indicates that the position variables contain a complete
@@ -178,6 +251,8 @@ class GPS : private concurrency::OSThread
 
     bool hasGPS = false; // Do we have a GPS we are talking to
 
+    bool serialIdleEvents = false; // The UART wakes us at the end of each burst, see onSerialIdle()
+
     bool GPSInitFinished = false; // Init thread finished?
     bool GPSInitStarted = false;  // Init thread finished?
 
@@ -238,8 +313,13 @@ class GPS : private concurrency::OSThread
 
     GnssModel_t getProbeResponse(unsigned long timeout, const std::vector<ChipInfo> &responseMap);
 
-    // Get GNSS model
+    // Get GNSS model, trying one family per call; probeFamily is back to PROBE_START once all have been tried
     GnssModel_t probe(int serialSpeed);
+    GnssModel_t probeUblox(int serialSpeed);
+
+    void loadProbeCache();
+    /// Remember that family answered at probeSpeed, for the next boot
+    void saveProbeCache(uint8_t family);
 
     // delay counter to allow more sats before fixed position stops GPS thread
     uint8_t fixeddelayCtr = 0;
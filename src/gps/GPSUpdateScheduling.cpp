@@ -1,20 +1,28 @@
 #include "GPSUpdateScheduling.h"
 
 #include "Default.h"
+#include <math.h>
+
+bool GPSUpdateScheduling::haveMotionSensor;
+uint32_t GPSUpdateScheduling::lastMovedMs;
 
 // Mark the time when searching for GPS position begins
 void GPSUpdateScheduling::informSearching()
 {
     searchStartedMs = millis();
+    // Until the first lock we don't know how long the GNSS has been off, so assume the worst
+    searchStartType = searchCount ? startTypeAfter(searchStartedMs - searchEndedMs) : COLD_START;
 }
 
 // Mark the time when searching for GPS is complete,
 // then update the predicted lock-time
-void GPSUpdateScheduling::informGotLock()
+void GPSUpdateScheduling::informGotLock(uint32_t satsInView)
 {
     searchEndedMs = millis();
     LOG_DEBUG("Took %us to get lock", (searchEndedMs - searchStartedMs) / 1000);
     updateLockTimePrediction();
+    if (satsInView)
+        poorSky = satsInView < GPS_POOR_SKY_SATS;
 }
 
 // Clear old lock-time prediction data.
@@ -24,7 +32,25 @@ void GPSUpdateScheduling::reset()
     searchStartedMs = 0;
     searchEndedMs = 0;
     searchCount = 0;
-    predictedMsToGetLock = 0;
+    searchStartType = COLD_START;
+    poorSky = false;
+    memset(lockTimes, 0, sizeof(lockTimes));
+}
+
+void GPSUpdateScheduling::informMotionSensor()
+{
+    haveMotionSensor = true;
+}
+
+void GPSUpdateScheduling::informMoved()
+{
+    lastMovedMs = millis();
+}
+
+// A motion sensor is watching and hasn't seen us move since the last fix, so another would find us in the same place
+bool GPSUpdateScheduling::isStill()
+{
+    return GPS_STILL_INTERVAL_MS && haveMotionSensor && searchCount && (int32_t)(lastMovedMs - searchEndedMs) < 0;
 }
 
 // How many milliseconds before we should next search for GPS position
@@ -36,9 +62,14 @@ uint32_t GPSUpdateScheduling::msUntilNextSearch()
     // Target interval (seconds), between GPS updates
     uint32_t updateInterval = Default::getConfiguredOrDefaultMs(config.position.gps_update_interval, default_gps_update_interval);
 
-    // Check how long until we should start searching, to hopefully hit our target interval
+    // Nothing to gain from a fix in the same place. As soon as we move this shrinks back, and the search is due at once
+    if (isStill() && updateInterval < GPS_STILL_INTERVAL_MS)
+        updateInterval = GPS_STILL_INTERVAL_MS;
+
+    // Check how long until we should start searching, to hopefully hit our target interval.  Start early by as long as the
+    // kind of start the GNSS will make after this long off usually takes, so the fix is there when it is due
     uint32_t dueAtMs = searchEndedMs + updateInterval;
-    uint32_t compensatedStart = dueAtMs - predictedMsToGetLock;
+    uint32_t compensatedStart = dueAtMs - predictLockMs(startTypeAfter(updateInterval));
     int32_t remainingMs = compensatedStart - now;
 
     // If we should have already started (negative value), start ASAP
@@ -86,7 +117,16 @@ bool GPSUpdateScheduling::searchedTooLong()
         return false;
 }
 
-// Updates the predicted time-to-get-lock, by exponentially smoothing the latest observation
+GPSUpdateScheduling::StartType GPSUpdateScheduling::startTypeAfter(uint32_t offMs)
+{
+    if (offMs < GPS_HOT_START_MS)
+        return HOT_START;
+    if (offMs < GPS_WARM_START_MS)
+        return WARM_START;
+    return COLD_START;
+}
+
+// Updates the lock-times of the kind of start just made, by exponentially smoothing the latest observation
 void GPSUpdateScheduling::updateLockTimePrediction()
 {
 
@@ -96,23 +136,48 @@ void GPSUpdateScheduling::updateLockTimePrediction()
     if (lockTime < 0)
         lockTime = 0;
 
-    // Ignore the first lock-time: likely to be long, will skew data
-
-    // Second locktime: likely stable. Use to initialize the smoothing filter
-    if (searchCount == 1)
-        predictedMsToGetLock = lockTime;
-
-    // Third locktime and after: predict using exponential smoothing. Respond slowly to changes
-    else if (searchCount > 1)
-        predictedMsToGetLock = (lockTime * weighting) + (predictedMsToGetLock * (1 - weighting));
-
-    searchCount++; // Only tracked so we can disregard initial lock-times
+    // The sky of the fix before this one is the one we predicted with, so learn under it
+    LockTimes &t = lockTimes[searchStartType][poorSky];
+    if (t.count == 0) {
+        t.meanMs = lockTime;
+        t.deviationMs = 0;
+    }
+
+    // Then respond slowly to changes. The deviation tells us how far to trust the mean
+    else {
+        float error = lockTime - t.meanMs;
+        t.meanMs += error * weighting;
+        t.deviationMs += (fabsf(error) - t.deviationMs) * weighting;
+    }
+    if (t.count < UINT16_MAX)
+        t.count++;
+
+    searchCount++;
+
+    LOG_DEBUG("%s start under %s sky: expect %us +- %us to get lock",
+              searchStartType == HOT_START    ? "Hot"
+              : searchStartType == WARM_START ? "Warm"
+                                              : "Cold",
+              poorSky ? "poor" : "good", (uint32_t)t.meanMs / 1000, (uint32_t)t.deviationMs / 1000);
+}
 
-    LOG_DEBUG("Predict %us to get next lock", predictedMsToGetLock / 1000);
+// How long a start of this type will take, with margin enough that it is seldom longer.  Without a lock-time for it yet,
+// borrow the same start under the other sky, then a colder start, which errs towards waking early rather than late
+uint32_t GPSUpdateScheduling::predictLockMs(StartType type)
+{
+    for (int colder = type; colder < NUM_START_TYPES; colder++) {
+        for (int sky = 0; sky < 2; sky++) {
+            const LockTimes &t = lockTimes[colder][sky ? !poorSky : poorSky];
+            if (t.count)
+                return (uint32_t)(t.meanMs + t.deviationMs);
+        }
+    }
+    return 0;
 }
 
 // How long do we expect to spend searching for a lock?
 uint32_t GPSUpdateScheduling::predictedSearchDurationMs()
 {
-    return GPSUpdateScheduling::predictedMsToGetLock;
+    uint32_t updateInterval = Default::getConfiguredOrDefaultMs(config.position.gps_update_interval, default_gps_update_interval);
+    return predictLockMs(startTypeAfter(updateInterval));
 }
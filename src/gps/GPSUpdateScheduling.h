@@ -2,13 +2,29 @@
 
 #include "configuration.h"
 
+// A GNSS that was off for less than this still has valid ephemeris and starts hot
+#ifndef GPS_HOT_START_MS
+#define GPS_HOT_START_MS (30 * 60 * 1000UL)
+#endif
+// Off for less than this it still has the almanac and a rough position, and starts warm. Longer is a cold start
+#ifndef GPS_WARM_START_MS
+#define GPS_WARM_START_MS (4 * 60 * 60 * 1000UL)
+#endif
+// A fix with fewer satellites in view than this was taken under a poor sky, and the next one likely will be too
+#define GPS_POOR_SKY_SATS 6
+// While a motion sensor says we haven't moved since the last fix, search only this often. Caps how long a movement the
+// sensor missed can go unnoticed. 0 searches every gps_update_interval regardless
+#ifndef GPS_STILL_INTERVAL_MS
+#define GPS_STILL_INTERVAL_MS (60 * 60 * 1000UL)
+#endif
+
 // Encapsulates code responsible for the timing of GPS updates
 class GPSUpdateScheduling
 {
   public:
     // Marks the time of these events, for calculation use
     void informSearching();
-    void informGotLock(); // Predicted lock-time is recalculated here
+    void informGotLock(uint32_t satsInView = 0); // Predicted lock-time is recalculated here
 
     void reset();           // Reset the prediction - after GPS::disable() / GPS::enable()
     bool isUpdateDue();     // Is it time to begin searching for a GPS position?
@@ -18,12 +34,34 @@ class GPSUpdateScheduling
     uint32_t elapsedSearchMs();   // How long have we been searching so far?
     uint32_t predictedSearchDurationMs(); // How long do we expect to spend searching for a lock?
 
+    // From the motion sensors: one is watching, and it saw the board move
+    static void informMotionSensor();
+    static void informMoved();
+
   private:
+    enum StartType { HOT_START, WARM_START, COLD_START, NUM_START_TYPES };
+
+    // Lock-times seen for one kind of start, exponentially smoothed
+    struct LockTimes {
+        float meanMs;
+        float deviationMs; // Mean absolute deviation from meanMs
+        uint16_t count;
+    };
+
     void updateLockTimePrediction(); // Called from informGotLock
+    static StartType startTypeAfter(uint32_t offMs);
+    uint32_t predictLockMs(StartType type);
+    bool isStill();
+
     uint32_t searchStartedMs = 0;
     uint32_t searchEndedMs = 0;
     uint32_t searchCount = 0;
-    uint32_t predictedMsToGetLock = 0;
+    StartType searchStartType = COLD_START; // Of the search in progress, or the last one
+    bool poorSky = false;                   // The last fix had fewer than GPS_POOR_SKY_SATS in view
+    LockTimes lockTimes[NUM_START_TYPES][2] = {}; // By start type, then good or poor sky
+
+    static bool haveMotionSensor;
+    static uint32_t lastMovedMs;
 
     const float weighting = 0.2; // Controls exponential smoothing of lock-times prediction. 20% weighting of "latest lock-time".
-};
\ No newline at end of file
+};
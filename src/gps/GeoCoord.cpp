@@ -593,4 +593,56 @@ double GeoCoord::toRadians(double deg)
 double GeoCoord::toDegrees(double r)
 {
     return r * 180 / PI;
-}
\ No newline at end of file
+}
+
+// Meters per 1e-7 degree along a meridian, with the same earth radius as latLongToMeter()
+#define GEO_METERS_PER_DEG_I (6366000.0f * (float)(PI / 180) * 1e-7f)
+#define GEO_FAST_MAX_DLON_I 10000000 // 1 degree, past that the meridians converge too much near the poles
+
+GeoOrigin::GeoOrigin(int32_t latitude_i, int32_t longitude_i) : lat(latitude_i), lon(longitude_i)
+{
+    float latRad = latitude_i * 1e-7f * (float)(PI / 180);
+    cosLat = cosf(latRad);
+    sinLat = sinf(latRad);
+}
+
+bool GeoOrigin::toLocal(int32_t latitude_i, int32_t longitude_i, float &north, float &east) const
+{
+    int64_t dLat = (int64_t)latitude_i - lat;
+    int64_t dLon = (int64_t)longitude_i - lon;
+    if (dLon > 1800000000)
+        dLon -= 3600000000LL; // Shorter the other way round, across the antimeridian
+    else if (dLon < -1800000000)
+        dLon += 3600000000LL;
+    if (dLon > GEO_FAST_MAX_DLON_I || dLon < -GEO_FAST_MAX_DLON_I)
+        return false;
+
+    float n = (float)dLat * GEO_METERS_PER_DEG_I;
+    if (n > GEOCOORD_FAST_RANGE_METERS || n < -GEOCOORD_FAST_RANGE_METERS)
+        return false;
+    // Scale longitude by the cosine of the latitude halfway there, taken from the origin's by its first derivative
+    float cosMid = cosLat - sinLat * (n * (0.5f / 6366000.0f));
+    float e = (float)dLon * GEO_METERS_PER_DEG_I * cosMid;
+    if (n * n + e * e > (float)GEOCOORD_FAST_RANGE_METERS * GEOCOORD_FAST_RANGE_METERS)
+        return false;
+
+    north = n;
+    east = e;
+    return true;
+}
+
+float GeoOrigin::distanceTo(int32_t latitude_i, int32_t longitude_i) const
+{
+    float north, east;
+    if (toLocal(latitude_i, longitude_i, north, east))
+        return sqrtf(north * north + east * east);
+    return GeoCoord::latLongToMeter(lat * 1e-7, lon * 1e-7, latitude_i * 1e-7, longitude_i * 1e-7);
+}
+
+float GeoOrigin::bearingTo(int32_t latitude_i, int32_t longitude_i) const
+{
+    float north, east;
+    if (toLocal(latitude_i, longitude_i, north, east))
+        return atan2f(east, north);
+    return GeoCoord::bearing(lat * 1e-7, lon * 1e-7, latitude_i * 1e-7, longitude_i * 1e-7);
+}
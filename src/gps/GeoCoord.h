@@ -13,6 +13,10 @@
 #define OLC_CODE_LEN 11
 #define DEG_CONVERT (180 / PI)
 
+#ifndef GEOCOORD_FAST_RANGE_METERS
+#define GEOCOORD_FAST_RANGE_METERS 20000 // Further than this GeoOrigin falls back to the exact great circle formulas
+#endif
+
 // GeoCoord structs/classes
 // A struct to hold the data for a DMS coordinate.
 struct DMS {
@@ -145,4 +149,35 @@ class GeoCoord
 
     // OLC getter
     void getOLCCode(char *code) { strncpy(code, _olc.code, OLC_CODE_LEN + 1); } // +1 for null termination
-};
\ No newline at end of file
+};
+
+/**
+ * Distances and bearings from one fixed point to many others, e.g. from us to every node in a list.
+ *
+ * The cosine of the origin's latitude is worked out once, and points within GEOCOORD_FAST_RANGE_METERS are measured on
+ * a flat earth tangent to the origin in single precision, which beats the double precision trig of latLongToMeter() and
+ * bearing() by a wide margin on MCUs without a double FPU while staying well under a meter out. Points further away
+ * (or far enough east or west near the poles for the flat earth to bend) go through those exact formulas instead.
+ */
+class GeoOrigin
+{
+  public:
+    GeoOrigin(int32_t latitude_i = 0, int32_t longitude_i = 0);
+
+    /// Meters north and east of the origin
+    /// @return false, leaving north and east alone, if the point is too far away to measure on a flat earth
+    bool toLocal(int32_t latitude_i, int32_t longitude_i, float &north, float &east) const;
+
+    /// Same as GeoCoord::latLongToMeter() from the origin
+    float distanceTo(int32_t latitude_i, int32_t longitude_i) const;
+
+    /// Same as GeoCoord::bearing() from the origin, in radians with 0 meaning due north
+    float bearingTo(int32_t latitude_i, int32_t longitude_i) const;
+
+    int32_t getLatitude() const { return lat; }
+    int32_t getLongitude() const { return lon; }
+
+  private:
+    int32_t lat, lon;
+    float cosLat, sinLat;
+};
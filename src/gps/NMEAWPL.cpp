@@ -50,6 +50,16 @@ uint32_t printWPL(char *buf, size_t bufsz, const meshtastic_Position &pos, const
     len += snprintf(buf + len, bufsz - len, "*%02X\r\n", chk);
     return len;
 }
+
+// A shared waypoint, under its own name
+uint32_t printWPL(char *buf, size_t bufsz, const meshtastic_Waypoint &wp, bool isCaltopoMode)
+{
+    meshtastic_Position pos = meshtastic_Position_init_default;
+    pos.latitude_i = wp.latitude_i;
+    pos.longitude_i = wp.longitude_i;
+    return printWPL(buf, bufsz, pos, wp.name, isCaltopoMode);
+}
+
 /* -------------------------------------------
  *        1         2       3 4       5 6 7  8   9  10 11 12 13  14   15
  *        |         |       | |       | | |  |   |   | |   | |   |    |
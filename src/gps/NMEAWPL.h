@@ -5,4 +5,5 @@
 
 uint32_t printWPL(char *buf, size_t bufsz, const meshtastic_Position &pos, const char *name, bool isCaltopoMode = false);
 uint32_t printWPL(char *buf, size_t bufsz, const meshtastic_PositionLite &pos, const char *name, bool isCaltopoMode = false);
+uint32_t printWPL(char *buf, size_t bufsz, const meshtastic_Waypoint &wp, bool isCaltopoMode = false);
 uint32_t printGGA(char *buf, size_t bufsz, const meshtastic_Position &pos);
\ No newline at end of file
@@ -144,8 +144,8 @@ RTCSetResult perhapsSetRTC(RTCQuality q, const struct timeval *tv, bool forceUpd
             lastSetFromPhoneNtpOrGps = now;
         }
 
-        // This delta value works on all platforms
-        timeStartMsec = now;
+        // This delta value works on all platforms, backdated by the fraction of a second tv is past tv_sec
+        timeStartMsec = now - tv->tv_usec / 1000;
         zeroOffsetSecs = tv->tv_sec;
         // If this platform has a setable RTC, set it
 #ifdef RV3028_RTC
@@ -276,6 +276,11 @@ uint32_t getTime(bool local)
     }
 }
 
+uint64_t getTimeMsec()
+{
+    return zeroOffsetSecs * 1000 + ((uint32_t)millis() - timeStartMsec);
+}
+
 /**
  * Returns the current time from the RTC if the quality of the time is at least minQuality.
  *
@@ -45,6 +45,9 @@ const char *RtcName(RTCQuality quality);
 /// Return time since 1970 in secs.  While quality is RTCQualityNone we will be returning time based at zero
 uint32_t getTime(bool local = false);
 
+/// Return time since 1970 in msec, as precise as whatever set it.  UTC, and based at zero like getTime() until it is set
+uint64_t getTimeMsec();
+
 /// Return time since 1970 in secs.  If quality is RTCQualityNone return zero
 uint32_t getValidTime(RTCQuality minQuality, bool local = false);
 
@@ -286,6 +286,39 @@ static const uint8_t _message_AID[] = {
     0x00        // Reserved
 };
 
+// Report UBX-NAV-PVT once per navigation solution, for GPS_UBX_NAV_PVT (M8 and M9 only, older modules lack it)
+static const uint8_t _message_NAV_PVT[] = {
+    0x01, 0x07, // UBX ID for NAV-PVT
+    0x00,       // Rate for DDC
+    0x01,       // Rate for UART1
+    0x00,       // Rate for UART2
+    0x01,       // Rate for USB useful for native linux
+    0x00,       // Rate for SPI
+    0x00        // Reserved
+};
+
+// Disable RMC once NAV-PVT carries the same data
+static const uint8_t _message_RMC_OFF[] = {
+    0xF0, 0x04, // NMEA ID for RMC
+    0x00,       // Rate for DDC
+    0x00,       // Rate for UART1
+    0x00,       // Rate for UART2
+    0x00,       // Rate for USB
+    0x00,       // Rate for SPI
+    0x00        // Reserved
+};
+
+// Disable GGA once NAV-PVT carries the same data
+static const uint8_t _message_GGA_OFF[] = {
+    0xF0, 0x00, // NMEA ID for GGA
+    0x00,       // Rate for DDC
+    0x00,       // Rate for UART1
+    0x00,       // Rate for UART2
+    0x00,       // Rate for USB
+    0x00,       // Rate for SPI
+    0x00        // Reserved
+};
+
 // Turn off TEXT INFO Messages for all but M10 series
 
 // B5 62 06 02 0A 00 01 00 00 00 03 03 00 03 03 00 1F 20
@@ -441,6 +474,11 @@ static const uint8_t _message_VALSET_ENABLE_NMEA_RAM[] = {0x00, 0x01, 0x00, 0x00
                                                           0x20, 0x01, 0xac, 0x00, 0x91, 0x20, 0x01};
 static const uint8_t _message_VALSET_ENABLE_NMEA_BBR[] = {0x00, 0x02, 0x00, 0x00, 0xbb, 0x00, 0x91,
                                                           0x20, 0x01, 0xac, 0x00, 0x91, 0x20, 0x01};
+// Enable UBX-NAV-PVT and keep NMEA GGA and RMC off on UART1, for GPS_UBX_NAV_PVT
+static const uint8_t _message_VALSET_ENABLE_NAV_PVT_RAM[] = {0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x91, 0x20, 0x01, 0xbb,
+                                                             0x00, 0x91, 0x20, 0x00, 0xac, 0x00, 0x91, 0x20, 0x00};
+static const uint8_t _message_VALSET_ENABLE_NAV_PVT_BBR[] = {0x00, 0x02, 0x00, 0x00, 0x07, 0x00, 0x91, 0x20, 0x01, 0xbb,
+                                                             0x00, 0x91, 0x20, 0x00, 0xac, 0x00, 0x91, 0x20, 0x00};
 static const uint8_t _message_VALSET_DISABLE_SBAS_RAM[] = {0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x31,
                                                            0x10, 0x00, 0x05, 0x00, 0x31, 0x10, 0x00};
 static const uint8_t _message_VALSET_DISABLE_SBAS_BBR[] = {0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x31,
@@ -51,7 +51,12 @@ void EInkDynamicDisplay::configForFastRefresh()
 #if defined(PRIVATE_HW)
 #else
     // Otherwise:
-    adafruitDisplay->setPartialWindow(0, 0, adafruitDisplay->width(), adafruitDisplay->height());
+    int16_t x = 0, y = 0, w = adafruitDisplay->width(), h = adafruitDisplay->height();
+    // Only refresh the part of the panel that changed, if the driver can refresh a window of the panel on its own
+    if (adafruitDisplay->epd2.hasPartialUpdate && getChangedWindow(x, y, w, h)) {
+        LOG_DEBUG("Fast refresh window %dx%d at %d,%d", w, h, x, y);
+    }
+    adafruitDisplay->setPartialWindow(x, y, w, h);
 #endif
 }
 
@@ -69,8 +74,8 @@ void EInkDynamicDisplay::configForFullRefresh()
 // Run any relevant GxEPD2 code, so next update will use correct refresh type
 void EInkDynamicDisplay::applyRefreshMode()
 {
-    // Change from FULL to FAST
-    if (currentConfig == FULL && refresh == FAST) {
+    // Change from FULL to FAST, or move the window of an ongoing series of FAST refreshes
+    if (refresh == FAST) {
         configForFastRefresh();
         currentConfig = FAST;
     }
@@ -375,15 +380,86 @@ void EInkDynamicDisplay::resetRateLimiting()
     previousRunMs = millis();
 }
 
-// Generate a hash of this frame, to compare against previous update
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+// FNV-1a, fed a 32-bit word at a time
+static uint32_t hashBytes(uint32_t hash, const uint8_t *data, uint32_t len)
+{
+    uint32_t i = 0;
+    for (; i + 4 <= len; i += 4) {
+        uint32_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * FNV_PRIME;
+    }
+    for (; i < len; i++)
+        hash = (hash ^ data[i]) * FNV_PRIME;
+    return hash;
+}
+
+// Generate a hash of each tile of this frame (and of the whole frame from those), to compare against previous update
 void EInkDynamicDisplay::hashImage()
 {
-    imageHash = 0;
+    // The buffer is in pages of 8 rows, each one byte per column
+    const uint32_t pages = displayBufferSize / displayWidth;
+
+    for (uint8_t ty = 0; ty < EINK_TILES_Y; ty++) {
+        for (uint8_t tx = 0; tx < EINK_TILES_X; tx++)
+            tileHashes[ty][tx] = FNV_OFFSET_BASIS;
+        for (uint32_t page = ty * pages / EINK_TILES_Y; page < (ty + 1) * pages / EINK_TILES_Y; page++) {
+            const uint8_t *row = buffer + page * displayWidth;
+            for (uint8_t tx = 0; tx < EINK_TILES_X; tx++) {
+                uint32_t x0 = tx * displayWidth / EINK_TILES_X, x1 = (tx + 1) * displayWidth / EINK_TILES_X;
+                tileHashes[ty][tx] = hashBytes(tileHashes[ty][tx], row + x0, x1 - x0);
+            }
+        }
+    }
 
-    // Sum all bytes of the image buffer together
-    for (uint16_t b = 0; b < (displayWidth / 8) * displayHeight; b++) {
-        imageHash ^= buffer[b] << b;
+    imageHash = hashBytes(FNV_OFFSET_BASIS, (const uint8_t *)tileHashes, sizeof(tileHashes));
+}
+
+// Find the bounding box (in the coordinates we draw to GxEPD2 with) of the tiles which differ from the last update
+bool EInkDynamicDisplay::getChangedWindow(int16_t &x, int16_t &y, int16_t &w, int16_t &h)
+{
+    uint8_t txMin = EINK_TILES_X, txMax = 0, tyMin = EINK_TILES_Y, tyMax = 0;
+    for (uint8_t ty = 0; ty < EINK_TILES_Y; ty++) {
+        for (uint8_t tx = 0; tx < EINK_TILES_X; tx++) {
+            if (tileHashes[ty][tx] != previousTileHashes[ty][tx]) {
+                txMin = min(txMin, tx);
+                txMax = max(txMax, tx);
+                tyMin = min(tyMin, ty);
+                tyMax = max(tyMax, ty);
+            }
+        }
     }
+    if (txMin > txMax)
+        return false; // Nothing changed: redraw the whole panel, as whoever asked for this frame expects
+
+    const uint32_t pages = displayBufferSize / displayWidth;
+    int16_t x0 = txMin * displayWidth / EINK_TILES_X;
+    int16_t x1 = (txMax + 1) * displayWidth / EINK_TILES_X;
+    int16_t y0 = (tyMin * pages / EINK_TILES_Y) * 8;
+    int16_t y1 = min((uint32_t)displayHeight, ((tyMax + 1) * pages / EINK_TILES_Y) * 8);
+
+    // EInkDisplay::forceDisplay() mirrors both axes on some panels
+#if defined(SEEED_WIO_TRACKER_L1_EINK)
+    const bool flipped = true;
+#else
+    const bool flipped = config.display.flip_screen;
+#endif
+    if (flipped) {
+        int16_t mirroredX0 = displayWidth - x1, mirroredY0 = displayHeight - y1;
+        x1 = displayWidth - x0;
+        y1 = displayHeight - y0;
+        x0 = mirroredX0;
+        y0 = mirroredY0;
+    }
+
+    x = x0;
+    y = y0;
+    w = x1 - x0;
+    h = y1 - y0;
+    return true;
 }
 
 // Store the results of determineMode() for future use, and reset for next call
@@ -396,6 +472,7 @@ void EInkDynamicDisplay::storeAndReset()
     // Only store image hash if the display will update
     if (refresh != SKIPPED) {
         previousImageHash = imageHash;
+        memcpy(previousTileHashes, tileHashes, sizeof(tileHashes));
     }
 
     frameFlags = BACKGROUND;
@@ -413,24 +490,24 @@ void EInkDynamicDisplay::countGhostPixels()
     // Start a new count
     ghostPixelCount = 0;
 
-    // Check new image, bit by bit, for any white pixels at locations marked "dirty"
-    for (uint16_t i = 0; i < displayBufferSize; i++) {
-        for (uint8_t bit = 0; bit < 7; bit++) {
-
-            const bool dirty = (dirtyPixels[i] >> bit) & 1;       // Has pixel location been drawn to since full-refresh?
-            const bool shouldBeBlank = !((buffer[i] >> bit) & 1); // Is pixel location white in the new image?
-
-            // If pixel is (or has been) black since last full-refresh, and now is white: ghosting
-            if (dirty && shouldBeBlank)
-                ghostPixelCount++;
-
-            // Update the dirty status for this pixel - will this location become a ghost if set white in future?
-            if (!dirty && !shouldBeBlank)
-                dirtyPixels[i] |= (1 << bit);
-        }
+    // Check the new image, a word of pixels at a time, for any white pixels at locations marked "dirty"
+    // (drawn black at some point since the last full-refresh): those will show as ghosts.
+    // Then mark the new image's black pixels dirty, as they will become ghosts if set white in future.
+    uint32_t i = 0;
+    for (; i + 4 <= displayBufferSize; i += 4) {
+        uint32_t dirty, image;
+        memcpy(&dirty, dirtyPixels + i, sizeof(dirty));
+        memcpy(&image, buffer + i, sizeof(image));
+        ghostPixelCount += __builtin_popcount(dirty & ~image);
+        dirty |= image;
+        memcpy(dirtyPixels + i, &dirty, sizeof(dirty));
+    }
+    for (; i < displayBufferSize; i++) {
+        ghostPixelCount += __builtin_popcount((uint8_t)(dirtyPixels[i] & ~buffer[i]));
+        dirtyPixels[i] |= buffer[i];
     }
 
-    LOG_DEBUG("ghostPixels=%hu, ", ghostPixelCount);
+    LOG_DEBUG("ghostPixels=%u, ", ghostPixelCount);
 }
 
 // Check if ghost pixel count exceeds the defined limit
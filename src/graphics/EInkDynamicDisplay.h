@@ -8,6 +8,14 @@
 #include "GxEPD2_BW.h"
 #include "concurrency/NotifiedWorkerThread.h"
 
+// The frame is hashed as a grid of tiles, so a fast refresh only needs to redraw the part of the panel that changed
+#ifndef EINK_TILES_X
+#define EINK_TILES_X 8
+#endif
+#ifndef EINK_TILES_Y
+#define EINK_TILES_Y 8
+#endif
+
 /*
     Derives from the EInkDisplay adapter class.
     Accepts suggestions from Screen class about frame type.
@@ -94,6 +102,7 @@ class EInkDynamicDisplay : public EInkDisplay, protected concurrency::NotifiedWo
 
     void resetRateLimiting(); // Set previousRunMs - this now counts as an update, for rate-limiting
     void hashImage();         // Generate a hashed version of this frame, to compare against previous update
+    bool getChangedWindow(int16_t &x, int16_t &y, int16_t &w, int16_t &h); // Bounding box of tiles changed since last update
     void storeAndReset();     // Keep results of determineMode() for later, tidy-up for next call
 
     // What we are determining for this frame
@@ -110,6 +119,8 @@ class EInkDynamicDisplay : public EInkDisplay, protected concurrency::NotifiedWo
     uint32_t previousRunMs = -1;       // When did determineMode() last run (rather than rejecting for rate-limiting)
     uint32_t imageHash = 0;            // Hash of the current frame. Don't bother updating if nothing has changed!
     uint32_t previousImageHash = 0;    // Hash of the previous update's frame
+    uint32_t tileHashes[EINK_TILES_Y][EINK_TILES_X] = {};         // Hash of each tile of the current frame
+    uint32_t previousTileHashes[EINK_TILES_Y][EINK_TILES_X] = {}; // .. and of the previous update's frame
     uint32_t fastRefreshCount = 0;     // How many fast-refreshes consecutively since last full refresh?
     refreshTypes currentConfig = FULL; // Which refresh type is GxEPD2 currently configured for
 
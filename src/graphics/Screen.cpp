@@ -216,6 +216,17 @@ void Screen::showNumberPicker(const char *message, uint32_t durationMs, uint8_t
     ui->update();
 }
 
+#if FONTS_FROM_CACHE
+// OLEDDisplay passes each character through here before drawing it, which is when its glyph must be decoded
+static char cachingFontTableLookup(const uint8_t ch)
+{
+    char code = Screen::customFontTableLookup(ch);
+    if (code)
+        fontCache.touch(code);
+    return code;
+}
+#endif
+
 static void drawModuleFrame(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y)
 {
     uint8_t module_frame;
@@ -289,6 +300,7 @@ Screen::Screen(ScanI2C::DeviceAddress address, meshtastic_Config_DisplayConfig_O
     : concurrency::OSThread("Screen"), address_found(address), model(screenType), geometry(geometry), cmdQueue(32)
 {
     graphics::normalFrames = new FrameCallback[MAX_NUM_NODES + NUM_EXTRA_FRAMES];
+    setPriority(concurrency::PRIORITY_BACKGROUND);
 
     LOG_INFO("Protobuf Value uiconfig.screen_rgb_color: %d", uiconfig.screen_rgb_color);
     int32_t rawRGB = uiconfig.screen_rgb_color;
@@ -519,7 +531,11 @@ void Screen::setup()
     ui->setOverlays(overlays, sizeof(overlays) / sizeof(overlays[0]));
 
     // === Enable UTF-8 to display mapping ===
+#if FONTS_FROM_CACHE
+    dispdev->setFontTableLookupFunction(cachingFontTableLookup);
+#else
     dispdev->setFontTableLookupFunction(customFontTableLookup);
+#endif
 
 #ifdef USERPREFS_OEM_TEXT
     logo_timeout *= 2; // Give more time for branded boot logos
@@ -758,7 +774,10 @@ int32_t Screen::runOnce()
 
     // this must be before the frameState == FIXED check, because we always
     // want to draw at least one FIXED frame before doing forceDisplay
-    ui->update();
+    if (targetFramerate != IDLE_FRAMERATE || idleFrameNeedsDraw()) {
+        ui->update();
+        changedSources = 0;
+    }
 
     // Switch to a low framerate (to save CPU) when we are not in transition
     // but we should only call setTargetFPS when framestate changes, because
@@ -939,6 +958,8 @@ void Screen::setFrames(FrameFocus focus)
         fsi.positions.lora = numframes;
         normalFrames[numframes++] = graphics::DebugRenderer::drawLoRaFocused;
         indicatorIcons.push_back(icon_radio);
+        normalFrames[numframes++] = graphics::DebugRenderer::drawAirtimeTalkers;
+        indicatorIcons.push_back(icon_radio);
     }
     if (!dismissedFrames.memory) {
         fsi.positions.memory = numframes;
@@ -1234,11 +1255,68 @@ void Screen::setFastFramerate()
     runASAP = true;
 }
 
+#ifndef SCREEN_IDLE_REDRAW_MSEC
+#define SCREEN_IDLE_REDRAW_MSEC (5 * 1000) // Catch up on what we aren't told about (last heard ages, SNR, uptime)
+#endif
+
+uint8_t Screen::getFrameSources(uint8_t frame)
+{
+    const FramesetInfo::FramePositions &pos = framesetInfo.positions;
+    bool isFavorite = pos.firstFavorite != 255 && frame >= pos.firstFavorite && frame <= pos.lastFavorite;
+
+    if (frame == pos.fault && error_code)
+        return 0;
+    if (frame == pos.textMessage)
+        return SOURCE_MESSAGES | SOURCE_NODEDB;
+    if (hasHeading() && (frame == pos.gps || frame == pos.nodelist_bearings || isFavorite))
+        return SOURCE_HEADING | SOURCE_NODEDB | SOURCE_GPS;
+    if (frame == pos.home || frame == pos.gps || isFavorite || frame == pos.nodelist || frame == pos.nodelist_lastheard ||
+        frame == pos.nodelist_hopsignal || frame == pos.nodelist_distance || frame == pos.nodelist_bearings)
+        return SOURCE_NODEDB | SOURCE_GPS;
+    return SOURCE_ALWAYS; // Clock, LoRa, memory, WiFi and module frames
+}
+
+bool Screen::idleFrameNeedsDraw()
+{
+    OLEDDisplayUiState *state = ui->getUiState();
+    if (!showingNormalScreen || state->frameState != FIXED || NotificationRenderer::isOverlayBannerShowing())
+        return true;
+#ifndef USE_EINK
+    if (hasUnreadMessage || powerStatus->getIsCharging())
+        return true; // Blinking header icons
+#endif
+
+    uint32_t seq = nodeDB->getChangeSeq();
+    if (seq != drawnNodeDBSeq)
+        changedSources |= SOURCE_NODEDB;
+    uint32_t minute = getValidTime(RTCQuality::RTCQualityDevice, true) / 60;
+
+    uint8_t sources = SOURCE_ALWAYS;
+    if (state->currentFrame < framesetInfo.frameCount)
+        sources = getFrameSources(state->currentFrame);
+    sources |= SOURCE_POWER | SOURCE_MESSAGES; // The header
+    if (!(sources & (changedSources | SOURCE_ALWAYS)) && minute == drawnMinute &&
+        Throttle::isWithinTimespanMs(lastIdleDrawMsec, SCREEN_IDLE_REDRAW_MSEC))
+        return false;
+
+    drawnNodeDBSeq = seq;
+    drawnMinute = minute;
+    lastIdleDrawMsec = millis();
+    return true;
+}
+
 int Screen::handleStatusUpdate(const meshtastic::Status *arg)
 {
     // LOG_DEBUG("Screen got status update %d", arg->getStatusType());
     switch (arg->getStatusType()) {
+    case STATUS_TYPE_POWER:
+        changedSources |= SOURCE_POWER;
+        break;
+    case STATUS_TYPE_GPS:
+        changedSources |= SOURCE_GPS;
+        break;
     case STATUS_TYPE_NODE:
+        changedSources |= SOURCE_NODEDB;
         if (showingNormalScreen && nodeStatus->getLastNumTotal() != nodeStatus->getNumTotal()) {
             setFrames(FOCUS_PRESERVE); // Regen the list of screen frames (returning to same frame, if possible)
         }
@@ -1252,6 +1330,7 @@ int Screen::handleStatusUpdate(const meshtastic::Status *arg)
 // Handles when message is received; will jump to text message frame.
 int Screen::handleTextMessage(const meshtastic_MeshPacket *packet)
 {
+    changedSources |= SOURCE_MESSAGES;
     if (showingNormalScreen) {
         if (packet->from == 0) {
             // Outgoing message (likely sent from phone)
@@ -331,8 +331,11 @@ class Screen : public concurrency::OSThread
     // Mutex needed?
     void setHeading(long _heading)
     {
+        float heading = fmod(_heading, 360);
+        if (!hasCompass || heading != compassHeading)
+            changedSources |= SOURCE_HEADING;
         hasCompass = true;
-        compassHeading = fmod(_heading, 360);
+        compassHeading = heading;
     }
 
     bool hasHeading() { return hasCompass; }
@@ -681,6 +684,28 @@ class Screen : public concurrency::OSThread
     /// Try to start drawing ASAP
     void setFastFramerate();
 
+    /// The data a frame is drawn from. While the UI is idle, the current frame is only redrawn once one of the sources
+    /// it depends on has changed (or the header clock has ticked over), instead of on every idle tick
+    enum FrameSource : uint8_t {
+        SOURCE_NODEDB = 1 << 0,
+        SOURCE_GPS = 1 << 1,
+        SOURCE_POWER = 1 << 2,
+        SOURCE_MESSAGES = 1 << 3,
+        SOURCE_ALWAYS = 1 << 4, // Shows seconds or values nobody tells us about (airtime, heap, module state)
+        SOURCE_HEADING = 1 << 5, // Compass needles that follow the magnetometer
+    };
+
+    /// Which sources the normal frame at this index depends on, besides the header every frame draws
+    uint8_t getFrameSources(uint8_t frame);
+
+    /// Should this idle tick redraw the current frame?
+    bool idleFrameNeedsDraw();
+
+    uint8_t changedSources = 0xFF; // Sources that changed since we last drew
+    uint32_t drawnNodeDBSeq = 0;   // nodeDB->getChangeSeq() when we last drew
+    uint32_t drawnMinute = 0;      // Header clock minute when we last drew
+    uint32_t lastIdleDrawMsec = 0;
+
     // Sets frame up for immediate drawing
     void setFrameImmediateDraw(FrameCallback *drawFrames);
 
@@ -20,17 +20,26 @@
 #include "graphics/fonts/EinkDisplayFonts.h"
 #endif
 
+// Compressed fonts are drawn from the RAM copy fontCache keeps, see CompressedFont.h
+#if FONT_COMPRESSED && (defined(OLED_PL) || defined(OLED_RU) || defined(OLED_UA) || defined(OLED_CS))
+#define FONTS_FROM_CACHE 1
+#define _localFont(font) fontCache.font(font)
+#else
+#define FONTS_FROM_CACHE 0
+#define _localFont(font) (font)
+#endif
+
 #ifdef OLED_PL
-#define FONT_SMALL_LOCAL ArialMT_Plain_10_PL
+#define FONT_SMALL_LOCAL _localFont(ArialMT_Plain_10_PL)
 #else
 #ifdef OLED_RU
-#define FONT_SMALL_LOCAL ArialMT_Plain_10_RU
+#define FONT_SMALL_LOCAL _localFont(ArialMT_Plain_10_RU)
 #else
 #ifdef OLED_UA
-#define FONT_SMALL_LOCAL ArialMT_Plain_10_UA // Height: 13
+#define FONT_SMALL_LOCAL _localFont(ArialMT_Plain_10_UA) // Height: 13
 #else
 #ifdef OLED_CS
-#define FONT_SMALL_LOCAL ArialMT_Plain_10_CS
+#define FONT_SMALL_LOCAL _localFont(ArialMT_Plain_10_CS)
 #else
 #define FONT_SMALL_LOCAL ArialMT_Plain_10 // Height: 13
 #endif
@@ -38,16 +47,16 @@
 #endif
 #endif
 #ifdef OLED_PL
-#define FONT_MEDIUM_LOCAL ArialMT_Plain_16_PL // Height: 19
+#define FONT_MEDIUM_LOCAL _localFont(ArialMT_Plain_16_PL) // Height: 19
 #else
 #ifdef OLED_RU
-#define FONT_MEDIUM_LOCAL ArialMT_Plain_16_RU // Height: 19
+#define FONT_MEDIUM_LOCAL _localFont(ArialMT_Plain_16_RU) // Height: 19
 #else
 #ifdef OLED_UA
-#define FONT_MEDIUM_LOCAL ArialMT_Plain_16_UA // Height: 19
+#define FONT_MEDIUM_LOCAL _localFont(ArialMT_Plain_16_UA) // Height: 19
 #else
 #ifdef OLED_CS
-#define FONT_MEDIUM_LOCAL ArialMT_Plain_16_CS
+#define FONT_MEDIUM_LOCAL _localFont(ArialMT_Plain_16_CS)
 #else
 #define FONT_MEDIUM_LOCAL ArialMT_Plain_16 // Height: 19
 #endif
@@ -55,16 +64,16 @@
 #endif
 #endif
 #ifdef OLED_PL
-#define FONT_LARGE_LOCAL ArialMT_Plain_24_PL // Height: 28
+#define FONT_LARGE_LOCAL _localFont(ArialMT_Plain_24_PL) // Height: 28
 #else
 #ifdef OLED_RU
-#define FONT_LARGE_LOCAL ArialMT_Plain_24_RU // Height: 28
+#define FONT_LARGE_LOCAL _localFont(ArialMT_Plain_24_RU) // Height: 28
 #else
 #ifdef OLED_UA
-#define FONT_LARGE_LOCAL ArialMT_Plain_24_UA // Height: 28
+#define FONT_LARGE_LOCAL _localFont(ArialMT_Plain_24_UA) // Height: 28
 #else
 #ifdef OLED_CS
-#define FONT_LARGE_LOCAL ArialMT_Plain_24_CS // Height: 28
+#define FONT_LARGE_LOCAL _localFont(ArialMT_Plain_24_CS) // Height: 28
 #else
 #define FONT_LARGE_LOCAL ArialMT_Plain_24 // Height: 28
 #endif
@@ -9,6 +9,12 @@
 #define TFT_BACKLIGHT_ON HIGH
 #endif
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #ifdef GPIO_EXTENDER
 #include <SparkFunSX1509.h>
 #include <Wire.h>
@@ -1128,16 +1134,138 @@ TFTDisplay::TFTDisplay(uint8_t address, int sda, int scl, OLEDDISPLAY_GEOMETRY g
 #endif
 }
 
+static inline uint32_t loadWord(const uint8_t *p)
+{
+    uint32_t w;
+    memcpy(&w, p, sizeof(w)); // The compiler turns this into a plain load where alignment allows
+    return w;
+}
+
+/**
+ * Find the first and last column of a page (8 rows in the page ordered buffer) that differ between cur and prev, or that
+ * have any pixel set if prev is null.  Compares a word at a time, which skips unchanged stretches 4 columns per step.
+ * @return false if nothing in the page changed
+ */
+static bool findChangedColumns(const uint8_t *cur, const uint8_t *prev, uint32_t width, uint32_t &first, uint32_t &last)
+{
+    uint32_t x = 0;
+    while (x + 4 <= width && loadWord(cur + x) == (prev ? loadWord(prev + x) : 0))
+        x += 4;
+    while (x < width && cur[x] == (prev ? prev[x] : 0))
+        x++;
+    if (x >= width)
+        return false;
+    first = x;
+
+    x = width;
+    while (x >= first + 4 && loadWord(cur + x - 4) == (prev ? loadWord(prev + x - 4) : 0))
+        x -= 4;
+    while (cur[x - 1] == (prev ? prev[x - 1] : 0))
+        x--;
+    last = x - 1;
+    return true;
+}
+
+/**
+ * Expand columns first..last of one row of a page into pixels, set bits becoming fg and the rest bg.  Host builds (native
+ * framebuffer and SDL) do 8 pixels per step with SSE2 or NEON, everything else a pixel at a time.
+ */
+static void expandRow(const uint8_t *page, uint8_t mask, uint32_t first, uint32_t last, uint16_t *out, uint16_t fg,
+                      uint16_t bg)
+{
+    uint32_t x = first;
+#if defined(__SSE2__)
+    const __m128i vMask = _mm_set1_epi16(mask), vFg = _mm_set1_epi16(fg), vBg = _mm_set1_epi16(bg);
+    for (; x + 8 <= last + 1; x += 8) {
+        __m128i cols = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(page + x)), _mm_setzero_si128());
+        __m128i clear = _mm_cmpeq_epi16(_mm_and_si128(cols, vMask), _mm_setzero_si128());
+        _mm_storeu_si128((__m128i *)(out + x), _mm_or_si128(_mm_and_si128(clear, vBg), _mm_andnot_si128(clear, vFg)));
+    }
+#elif defined(__ARM_NEON)
+    const uint16x8_t vMask = vdupq_n_u16(mask), vFg = vdupq_n_u16(fg), vBg = vdupq_n_u16(bg);
+    for (; x + 8 <= last + 1; x += 8) {
+        uint16x8_t set = vtstq_u16(vmovl_u8(vld1_u8(page + x)), vMask);
+        vst1q_u16(out + x, vbslq_u16(set, vFg, vBg));
+    }
+#endif
+    for (; x <= last; x++)
+        out[x] = (page[x] & mask) ? fg : bg;
+}
+
 // Write the buffer to the display memory
 void TFTDisplay::display(bool fromBlank)
 {
-    if (fromBlank)
-        tft->fillScreen(TFT_BLACK);
+#if TFT_PUSH_TASK
+    if (pushTask || startPushTask()) {
+        // Hand a copy of the frame to the push task and get back to the main loop; if the task is still busy with an
+        // earlier frame it will pick up this newer one when it's done
+        frameLock.lock();
+        memcpy(pendingFrame, buffer, displayBufferSize);
+        pendingFromBlank |= fromBlank;
+        framePending = true;
+        frameLock.unlock();
+        xTaskNotifyGive(pushTask);
+        return;
+    }
+#endif
+    pushFrame(buffer, fromBlank);
+}
 
-    concurrency::LockGuard g(spiLock);
+#if TFT_PUSH_TASK
+bool TFTDisplay::startPushTask()
+{
+    if (!pendingFrame)
+        pendingFrame = (uint8_t *)malloc(displayBufferSize);
+    if (!pushingFrame)
+        pushingFrame = (uint8_t *)malloc(displayBufferSize);
+    if (!pendingFrame || !pushingFrame) {
+        LOG_WARN("Not enough memory for TFT push task, pushing from the main loop");
+        return false;
+    }
+
+    // The main loop runs on core 1, so push from core 0 (as the MUI task does)
+    if (xTaskCreatePinnedToCore(pushTaskMain, "tftPush", 4096, this, 1, &pushTask, 0) != pdPASS) {
+        LOG_WARN("Can't start TFT push task, pushing from the main loop");
+        pushTask = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void TFTDisplay::pushTaskMain(void *arg)
+{
+    TFTDisplay *self = static_cast<TFTDisplay *>(arg);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        self->frameLock.lock();
+        bool pending = self->framePending;
+        bool fromBlank = self->pendingFromBlank;
+        if (pending) {
+            uint8_t *frame = self->pendingFrame;
+            self->pendingFrame = self->pushingFrame;
+            self->pushingFrame = frame;
+            self->framePending = false;
+            self->pendingFromBlank = false;
+        }
+        self->frameLock.unlock();
 
-    uint32_t x, y;
-    uint32_t y_byteIndex;
+        if (pending) {
+            concurrency::LockGuard g(&self->panelLock);
+            self->pushFrame(self->pushingFrame, fromBlank);
+        }
+    }
+}
+#endif
+
+void TFTDisplay::pushFrame(const uint8_t *frame, bool fromBlank)
+{
+    if (fromBlank) {
+        SPIGuard g(SPI_CLIENT_DISPLAY);
+        tft->fillScreen(TFT_BLACK);
+    }
+
+    uint32_t y;
     uint8_t y_byteMask;
     uint32_t x_FirstPixelUpdate;
     uint32_t x_LastPixelUpdate;
@@ -1149,69 +1277,51 @@ void TFTDisplay::display(bool fromBlank)
     colorTftMesh = (TFT_MESH >> 8) | ((TFT_MESH & 0xFF) << 8);
     colorTftBlack = (TFT_BLACK >> 8) | ((TFT_BLACK & 0xFF) << 8);
 
-    y = 0;
-    while (y < displayHeight) {
-        y_byteIndex = (y / 8) * displayWidth;
-        y_byteMask = (1 << (y & 7));
-
-        // Step 1: Do a quick scan of 8 rows together. This allows fast-forwarding over unchanged screen areas.
-        if (y_byteMask == 1) {
-            if (!fromBlank) {
-                for (x = 0; x < displayWidth; x++) {
-                    if (buffer[x + y_byteIndex] != buffer_back[x + y_byteIndex])
-                        break;
-                }
-            } else {
-                for (x = 0; x < displayWidth; x++) {
-                    if (buffer[x + y_byteIndex] != 0)
-                        break;
-                }
-            }
-            if (x >= displayWidth) {
-                // No changed pixels found in these 8 rows, fast-forward to the next 8
-                y = y + 8;
-                continue;
-            }
-        }
-
-        // Step 2: Scan each of the 8 rows individually. Find the first pixel in each row that needs updating
-        for (x_FirstPixelUpdate = 0; x_FirstPixelUpdate < displayWidth; x_FirstPixelUpdate++) {
-            isset = buffer[x_FirstPixelUpdate + y_byteIndex] & y_byteMask;
+    for (uint32_t y_page = 0; y_page < displayHeight; y_page += 8) {
+        const uint8_t *page = frame + (y_page / 8) * displayWidth;
+        const uint8_t *page_back = fromBlank ? nullptr : buffer_back + (y_page / 8) * displayWidth;
 
-            if (!fromBlank) {
-                // get src pixel in the page based ordering the OLED lib uses
-                dblbuf_isset = buffer_back[x_FirstPixelUpdate + y_byteIndex] & y_byteMask;
-                if (isset != dblbuf_isset) {
-                    break;
-                }
-            } else if (isset) {
-                break;
-            }
-        }
+        // Step 1: Do a quick scan of 8 rows together, to fast-forward over unchanged screen areas and narrow the rest down to
+        // the columns that changed
+        uint32_t x_FirstChanged, x_LastChanged;
+        if (!findChangedColumns(page, page_back, displayWidth, x_FirstChanged, x_LastChanged))
+            continue;
 
-        // Did we find a pixel that needs updating on this row?
-        if (x_FirstPixelUpdate < displayWidth) {
+        // Only hold the SPI bus for one page at a time, so the radio never has to wait out a full screen refresh
+        spiYieldToRadio();
+        SPIGuard g(SPI_CLIENT_DISPLAY);
 
-            // Quickly write out the first changed pixel (saves another array lookup)
-            linePixelBuffer[x_FirstPixelUpdate] = isset ? colorTftMesh : colorTftBlack;
-            x_LastPixelUpdate = x_FirstPixelUpdate;
+        for (y = y_page; y < y_page + 8 && y < displayHeight; y++) {
+            y_byteMask = (1 << (y & 7));
 
-            // Step 3: copy all remaining pixels in this row into the pixel line buffer,
-            // while also recording the last pixel in the row that needs updating
-            for (x = x_FirstPixelUpdate + 1; x < displayWidth; x++) {
-                isset = buffer[x + y_byteIndex] & y_byteMask;
-                linePixelBuffer[x] = isset ? colorTftMesh : colorTftBlack;
+            // Step 2: Scan each of the 8 rows individually. Find the first pixel in each row that needs updating
+            for (x_FirstPixelUpdate = x_FirstChanged; x_FirstPixelUpdate <= x_LastChanged; x_FirstPixelUpdate++) {
+                isset = page[x_FirstPixelUpdate] & y_byteMask;
 
                 if (!fromBlank) {
-                    dblbuf_isset = buffer_back[x + y_byteIndex] & y_byteMask;
+                    // get src pixel in the page based ordering the OLED lib uses
+                    dblbuf_isset = page_back[x_FirstPixelUpdate] & y_byteMask;
                     if (isset != dblbuf_isset) {
-                        x_LastPixelUpdate = x;
+                        break;
                     }
                 } else if (isset) {
-                    x_LastPixelUpdate = x;
+                    break;
                 }
             }
 
+            // Did we find a pixel that needs updating on this row?
+            if (x_FirstPixelUpdate > x_LastChanged)
+                continue;
+
+            // Step 3: Find the last pixel in the row that needs updating, then expand the pixels in between into the pixel line
+            // buffer
+            for (x_LastPixelUpdate = x_LastChanged; x_LastPixelUpdate > x_FirstPixelUpdate; x_LastPixelUpdate--) {
+                isset = page[x_LastPixelUpdate] & y_byteMask;
+                if (fromBlank ? isset : isset != (bool)(page_back[x_LastPixelUpdate] & y_byteMask))
+                    break;
+            }
+            expandRow(page, y_byteMask, x_FirstPixelUpdate, x_LastPixelUpdate, linePixelBuffer, colorTftMesh, colorTftBlack);
+
             // Step 4: Send the changed pixels on this line to the screen as a single block transfer.
             // This function accepts pixel data MSB first so it can dump the memory straight out the SPI port.
             tft->pushRect(x_FirstPixelUpdate, y, (x_LastPixelUpdate - x_FirstPixelUpdate + 1), 1,
@@ -1219,11 +1329,10 @@ void TFTDisplay::display(bool fromBlank)
 
             somethingChanged = true;
         }
-        y++;
     }
     // Copy the Buffer to the Back Buffer
     if (somethingChanged)
-        memcpy(buffer_back, buffer, displayBufferSize);
+        memcpy(buffer_back, frame, displayBufferSize);
 }
 
 void TFTDisplay::sdlLoop()
@@ -1272,6 +1381,10 @@ void TFTDisplay::sdlLoop()
 // Send a command to the display (low level function)
 void TFTDisplay::sendCommand(uint8_t com)
 {
+#if TFT_PUSH_TASK
+    // Don't sleep or wake the panel in the middle of a frame the push task is sending
+    concurrency::LockGuard g(&panelLock);
+#endif
     // handle display on/off directly
     switch (com) {
     case DISPLAYON: {
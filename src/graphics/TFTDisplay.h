@@ -1,8 +1,20 @@
 #pragma once
 
+#include "concurrency/Lock.h"
+#include "configuration.h"
 #include <GpioLogic.h>
 #include <OLEDDisplay.h>
 
+// On dual core ESP32s, set to 1 to send frames to the panel from a task on the other core, so the main loop only has to
+// render them
+#ifndef TFT_PUSH_TASK
+#define TFT_PUSH_TASK 0
+#endif
+#if TFT_PUSH_TASK && (!defined(ARCH_ESP32) || defined(CONFIG_FREERTOS_UNICORE))
+#undef TFT_PUSH_TASK
+#define TFT_PUSH_TASK 0
+#endif
+
 /**
  * An adapter class that allows using the LovyanGFX library as if it was an OLEDDisplay implementation.
  *
@@ -60,4 +72,21 @@ class TFTDisplay : public OLEDDisplay
     virtual bool connect() override;
 
     uint16_t *linePixelBuffer = nullptr;
+
+  private:
+    // Send the pixels of frame that differ from buffer_back to the panel, then remember frame as what the panel shows
+    void pushFrame(const uint8_t *frame, bool fromBlank);
+
+#if TFT_PUSH_TASK
+    uint8_t *pendingFrame = nullptr; // Latest frame handed over by display(), swapped with pushingFrame by the task
+    uint8_t *pushingFrame = nullptr; // Frame the push task is sending, only touched by the task
+    bool framePending = false;
+    bool pendingFromBlank = false;
+    concurrency::Lock frameLock; // Guards pendingFrame and its flags, only ever held for a memcpy or pointer swap
+    concurrency::Lock panelLock; // Held by whoever is talking to the panel: the push task, or sendCommand()
+    TaskHandle_t pushTask = nullptr;
+
+    bool startPushTask();
+    static void pushTaskMain(void *arg);
+#endif
 };
\ No newline at end of file
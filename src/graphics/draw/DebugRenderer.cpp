@@ -484,6 +484,50 @@ void drawLoRaFocused(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x,
                         chUtilPercentage);
 }
 
+// ****************************
+// *  Airtime Talkers Screen  *
+// ****************************
+void drawAirtimeTalkers(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y)
+{
+    display->clear();
+    display->setTextAlignment(TEXT_ALIGN_LEFT);
+    display->setFont(FONT_SMALL);
+
+    graphics::drawCommonHeader(display, x, y, (isHighResolution) ? "Airtime Use" : "Airtime");
+
+    AirtimeTalkers::Entry ports[AIRTIME_TOP_TALKERS], nodes[AIRTIME_TOP_TALKERS];
+    uint8_t numPorts = airTime->getPortTalkers().getSorted(ports);
+    uint8_t numNodes = airTime->getNodeTalkers().getSorted(nodes);
+    uint32_t total = airTime->getPortTalkers().getTotalMs();
+    if (total == 0) {
+        display->drawString(x, getTextPositions(display)[1], "Nothing heard yet");
+        return;
+    }
+
+    // Busiest ports on the left, busiest nodes on the right, as a share of the airtime in the lists
+    const int rows = (isHighResolution) ? 6 : 4;
+    for (int row = 0; row < rows && (row < numPorts || row < numNodes); row++) {
+        int lineY = getTextPositions(display)[row + 1];
+        char buf[24];
+        if (row < numPorts) {
+            char portBuf[12];
+            snprintf(buf, sizeof(buf), "%s %u%%", AirTime::getPortName(ports[row].key, portBuf, sizeof(portBuf)),
+                     ports[row].ms * 100 / total);
+            display->setTextAlignment(TEXT_ALIGN_LEFT);
+            display->drawString(x, lineY, buf);
+        }
+        if (row < numNodes) {
+            const meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(nodes[row].key);
+            if (node && node->has_user && node->user.short_name[0])
+                snprintf(buf, sizeof(buf), "%s %u%%", node->user.short_name, nodes[row].ms * 100 / total);
+            else
+                snprintf(buf, sizeof(buf), "%04x %u%%", nodes[row].key & 0xffff, nodes[row].ms * 100 / total);
+            display->setTextAlignment(TEXT_ALIGN_RIGHT);
+            display->drawString(x + SCREEN_WIDTH, lineY, buf);
+        }
+    }
+}
+
 // ****************************
 // *      System Screen       *
 // ****************************
@@ -630,6 +674,35 @@ void drawMemoryUsage(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x,
         nameX = (SCREEN_WIDTH - textWidth) / 2;
         display->drawString(nameX, getTextPositions(display)[line], uptimeStr);
     }
+
+#if OSTHREAD_PROFILE
+    // The thread that has held up the main loop the longest, if there's room for it
+    const concurrency::OSThread *slowest = concurrency::OSThread::slowest();
+    if (slowest && line < 6 && getTextPositions(display)[line + 1] + FONT_HEIGHT_SMALL <= SCREEN_HEIGHT) {
+        line += 1;
+        char slowStr[40];
+        snprintf(slowStr, sizeof(slowStr), "Slowest: %s %ums", slowest->ThreadName.c_str(),
+                 slowest->getProfile().maxUsec / 1000);
+        textWidth = display->getStringWidth(slowStr);
+        nameX = (SCREEN_WIDTH - textWidth) / 2;
+        display->drawString(nameX, getTextPositions(display)[line], slowStr);
+    }
+#endif
+
+    // The worst the heap and packet pool have been since boot, what the node DB and queues have to fit in
+    AllocatorStats poolStats;
+    uint32_t heapMinFree = memGet.getMinFreeHeap();
+    if (heapMinFree < heapTotal && packetPool.getStats(poolStats) && line < 6 &&
+        getTextPositions(display)[line + 1] + FONT_HEIGHT_SMALL <= SCREEN_HEIGHT) {
+        line += 1;
+        char peakStr[40];
+        snprintf(peakStr, sizeof(peakStr), "Peak: heap %u%% pool %u/%u%s",
+                 (unsigned)((uint64_t)(heapTotal - heapMinFree) * 100 / heapTotal), poolStats.highWater, poolStats.capacity,
+                 poolStats.allocFailures ? "!" : "");
+        textWidth = display->getStringWidth(peakStr);
+        nameX = (SCREEN_WIDTH - textWidth) / 2;
+        display->drawString(nameX, getTextPositions(display)[line], peakStr);
+    }
 }
 } // namespace DebugRenderer
 } // namespace graphics
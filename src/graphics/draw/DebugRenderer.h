@@ -31,6 +31,9 @@ void drawDebugInfoWiFiTrampoline(OLEDDisplay *display, OLEDDisplayUiState *state
 // LoRa information display
 void drawLoRaFocused(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y);
 
+// Which ports and nodes use the most airtime
+void drawAirtimeTalkers(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y);
+
 // Memory screen display
 void drawMemoryUsage(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y);
 } // namespace DebugRenderer
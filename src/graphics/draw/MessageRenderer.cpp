@@ -56,14 +56,18 @@ namespace graphics
 namespace MessageRenderer
 {
 
-// Simple cache based on text hash
+// Simple cache based on text hash: the wrapped lines, their heights and their segments are only worked out when the
+// message or the screen width changes, not on every frame of the scroll
 static size_t cachedKey = 0;
+static int cachedWidth = 0;
 static std::vector<std::string> cachedLines;
 static std::vector<int> cachedHeights;
+static std::vector<LineLayout> cachedLayouts;
 
-void drawStringWithEmotes(OLEDDisplay *display, int x, int y, const std::string &line, const Emote *emotes, int emoteCount)
+LineLayout layoutLine(OLEDDisplay *display, const std::string &line, const Emote *emotes, int emoteCount)
 {
-    int cursorX = x;
+    LineLayout layout;
+    int cursorX = 0;
     const int fontHeight = FONT_HEIGHT_SMALL;
 
     // === Step 1: Find tallest emote in the line ===
@@ -96,10 +100,10 @@ void drawStringWithEmotes(OLEDDisplay *display, int x, int y, const std::string
     // === Step 2: Baseline alignment ===
     int lineHeight = std::max(fontHeight, maxIconHeight);
     int baselineOffset = (lineHeight - fontHeight) / 2;
-    int fontY = y + baselineOffset;
-    int fontMidline = fontY + fontHeight / 2;
+    layout.fontY = baselineOffset;
+    int fontMidline = baselineOffset + fontHeight / 2;
 
-    // === Step 3: Render line in segments ===
+    // === Step 3: Split the line into text and emote segments ===
     size_t i = 0;
     bool inBold = false;
 
@@ -125,51 +129,60 @@ void drawStringWithEmotes(OLEDDisplay *display, int x, int y, const std::string
             }
         }
 
-        // Render normal text segment up to the emote or bold toggle
+        // Text segment up to the emote or bold toggle, or the rest of the line if there are no more emotes
         size_t nextControl = std::min(nextEmotePos, line.find("**", i));
         if (nextControl == std::string::npos)
             nextControl = line.length();
+        if (nextControl == i && !(matchedEmote && i == nextEmotePos))
+            nextControl = line.length();
 
         if (nextControl > i) {
-            std::string textChunk = line.substr(i, nextControl - i);
-            if (inBold) {
-                // Faux bold: draw twice, offset by 1px
-                display->drawString(cursorX + 1, fontY, textChunk.c_str());
-            }
-            display->drawString(cursorX, fontY, textChunk.c_str());
+            LineSegment seg;
+            seg.text = line.substr(i, nextControl - i);
+            seg.x = cursorX;
+            seg.bold = inBold;
 #if defined(OLED_UA) || defined(OLED_RU)
-            cursorX += display->getStringWidth(textChunk.c_str(), textChunk.length(), true);
+            cursorX += display->getStringWidth(seg.text.c_str(), seg.text.length(), true);
 #else
-            cursorX += display->getStringWidth(textChunk.c_str());
+            cursorX += display->getStringWidth(seg.text.c_str());
 #endif
+            layout.segments.push_back(seg);
             i = nextControl;
             continue;
         }
 
-        // Render the emote (if found)
-        if (matchedEmote && i == nextEmotePos) {
-            int iconY = fontMidline - matchedEmote->height / 2 - 1;
-            display->drawXbm(cursorX, iconY, matchedEmote->width, matchedEmote->height, matchedEmote->bitmap);
-            cursorX += matchedEmote->width + 1;
-            i += emojiLen;
+        // The emote
+        LineSegment seg;
+        seg.emote = matchedEmote;
+        seg.x = cursorX;
+        seg.y = fontMidline - matchedEmote->height / 2 - 1;
+        layout.segments.push_back(seg);
+        cursorX += matchedEmote->width + 1;
+        i += emojiLen;
+    }
+    return layout;
+}
+
+void drawLineLayout(OLEDDisplay *display, int x, int y, const LineLayout &layout)
+{
+    for (const LineSegment &seg : layout.segments) {
+        if (seg.emote) {
+            display->drawXbm(x + seg.x, y + seg.y, seg.emote->width, seg.emote->height, seg.emote->bitmap);
         } else {
-            // No more emotes — render the rest of the line
-            std::string remaining = line.substr(i);
-            if (inBold) {
-                display->drawString(cursorX + 1, fontY, remaining.c_str());
+            if (seg.bold) {
+                // Faux bold: draw twice, offset by 1px
+                display->drawString(x + seg.x + 1, y + layout.fontY, seg.text.c_str());
             }
-            display->drawString(cursorX, fontY, remaining.c_str());
-#if defined(OLED_UA) || defined(OLED_RU)
-            cursorX += display->getStringWidth(remaining.c_str(), remaining.length(), true);
-#else
-            cursorX += display->getStringWidth(remaining.c_str());
-#endif
-
-            break;
+            display->drawString(x + seg.x, y + layout.fontY, seg.text.c_str());
         }
     }
 }
 
+void drawStringWithEmotes(OLEDDisplay *display, int x, int y, const std::string &line, const Emote *emotes, int emoteCount)
+{
+    drawLineLayout(display, x, y, layoutLine(display, line, emotes, emoteCount));
+}
+
 void drawTextMessageFrame(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y)
 {
     // Clear the unread message indicator when viewing the message
@@ -281,13 +294,19 @@ void drawTextMessageFrame(OLEDDisplay *display, OLEDDisplayUiState *state, int16
     currentKey ^= ((size_t)mp.rx_time << 16);
     currentKey ^= ((size_t)mp.id << 24);
 
-    if (cachedKey != currentKey) {
+    if (cachedKey != currentKey || cachedWidth != textWidth) {
         LOG_INFO("Onscreen message scroll cache key needs updating: cachedKey=0x%0x, currentKey=0x%x", cachedKey, currentKey);
 
-        // Cache miss - regenerate lines and heights
+        // Cache miss - regenerate lines, heights and layouts
         cachedLines = generateLines(display, headerStr, messageBuf, textWidth);
         cachedHeights = calculateLineHeights(cachedLines, emotes);
+        cachedLayouts.clear();
+        cachedLayouts.reserve(cachedLines.size());
+        cachedLayouts.push_back(LineLayout()); // The header changes every frame, so isn't laid out here
+        for (size_t i = 1; i < cachedLines.size(); ++i)
+            cachedLayouts.push_back(layoutLine(display, cachedLines[i], emotes, numEmotes));
         cachedKey = currentKey;
+        cachedWidth = textWidth;
     } else {
         // Cache hit but update the header line with current time information
         cachedLines[0] = std::string(headerStr);
@@ -351,7 +370,8 @@ void drawTextMessageFrame(OLEDDisplay *display, OLEDDisplayUiState *state, int16
     }
 
     // === Render visible lines ===
-    renderMessageContent(display, cachedLines, cachedHeights, x, yOffset, scrollBottom, emotes, numEmotes, isInverted, isBold);
+    renderMessageContent(display, cachedLines, cachedHeights, cachedLayouts, x, yOffset, scrollBottom, emotes, numEmotes,
+                         isInverted, isBold);
 
     // Draw header at the end to sort out overlapping elements
     graphics::drawCommonHeader(display, x, y, titleStr);
@@ -438,18 +458,19 @@ std::vector<int> calculateLineHeights(const std::vector<std::string> &lines, con
     return rowHeights;
 }
 
-void renderMessageContent(OLEDDisplay *display, const std::vector<std::string> &lines, const std::vector<int> &rowHeights, int x,
-                          int yOffset, int scrollBottom, const Emote *emotes, int numEmotes, bool isInverted, bool isBold)
+void renderMessageContent(OLEDDisplay *display, const std::vector<std::string> &lines, const std::vector<int> &rowHeights,
+                          const std::vector<LineLayout> &layouts, int x, int yOffset, int scrollBottom, const Emote *emotes,
+                          int numEmotes, bool isInverted, bool isBold)
 {
-    for (size_t i = 0; i < lines.size(); ++i) {
-        int lineY = yOffset;
-        for (size_t j = 0; j < i; ++j)
-            lineY += rowHeights[j];
+    int lineY = yOffset;
+    for (size_t i = 0; i < lines.size(); lineY += rowHeights[i++]) {
         if (lineY > -rowHeights[i] && lineY < scrollBottom) {
             if (i == 0 && isInverted) {
                 display->drawString(x, lineY, lines[i].c_str());
                 if (isBold)
                     display->drawString(x, lineY, lines[i].c_str());
+            } else if (i < layouts.size() && i > 0) {
+                drawLineLayout(display, x, lineY, layouts[i]);
             } else {
                 drawStringWithEmotes(display, x, lineY, lines[i], emotes, numEmotes);
             }
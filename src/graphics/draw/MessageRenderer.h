@@ -10,6 +10,24 @@ namespace graphics
 namespace MessageRenderer
 {
 
+/// One run of a laid out line: text in the small font, or an emote
+struct LineSegment {
+    std::string text;             // Empty for an emote
+    const Emote *emote = nullptr; // nullptr for text
+    int16_t x = 0;                // Offset from the left of the line
+    int16_t y = 0;                // Offset of an emote from the top of the line
+    bool bold = false;
+};
+
+/// Where each piece of a line goes, worked out once so redraws and scrolling don't rescan the text for emotes
+struct LineLayout {
+    std::vector<LineSegment> segments;
+    int16_t fontY = 0; // Offset of the text from the top of the line, to centre it against the tallest emote
+};
+
+LineLayout layoutLine(OLEDDisplay *display, const std::string &line, const Emote *emotes, int emoteCount);
+void drawLineLayout(OLEDDisplay *display, int x, int y, const LineLayout &layout);
+
 // Text and emote rendering
 void drawStringWithEmotes(OLEDDisplay *display, int x, int y, const std::string &line, const Emote *emotes, int emoteCount);
 
@@ -23,8 +41,9 @@ std::vector<std::string> generateLines(OLEDDisplay *display, const char *headerS
 std::vector<int> calculateLineHeights(const std::vector<std::string> &lines, const Emote *emotes);
 
 // Function to render the message content
-void renderMessageContent(OLEDDisplay *display, const std::vector<std::string> &lines, const std::vector<int> &rowHeights, int x,
-                          int yOffset, int scrollBottom, const Emote *emotes, int numEmotes, bool isInverted, bool isBold);
+void renderMessageContent(OLEDDisplay *display, const std::vector<std::string> &lines, const std::vector<int> &rowHeights,
+                          const std::vector<LineLayout> &layouts, int x, int yOffset, int scrollBottom, const Emote *emotes,
+                          int numEmotes, bool isInverted, bool isBold);
 
 } // namespace MessageRenderer
 } // namespace graphics
@@ -49,9 +49,8 @@ static int scrollIndex = 0;
 // Utility Functions
 // =============================
 
-const char *getSafeNodeName(meshtastic_NodeInfoLite *node)
+static void formatSafeNodeName(const meshtastic_NodeInfoLite *node, char *nodeName, size_t len)
 {
-    static char nodeName[16] = "?";
     if (node->has_user && strlen(node->user.short_name) > 0) {
         bool valid = true;
         const char *name = node->user.short_name;
@@ -63,17 +62,129 @@ const char *getSafeNodeName(meshtastic_NodeInfoLite *node)
             }
         }
         if (valid) {
-            strncpy(nodeName, name, sizeof(nodeName) - 1);
-            nodeName[sizeof(nodeName) - 1] = '\0';
+            strncpy(nodeName, name, len - 1);
+            nodeName[len - 1] = '\0';
         } else {
-            snprintf(nodeName, sizeof(nodeName), "(%04X)", (uint16_t)(node->num & 0xFFFF));
+            snprintf(nodeName, len, "(%04X)", (uint16_t)(node->num & 0xFFFF));
         }
     } else {
-        snprintf(nodeName, sizeof(nodeName), "(%04X)", (uint16_t)(node->num & 0xFFFF));
+        snprintf(nodeName, len, "(%04X)", (uint16_t)(node->num & 0xFFFF));
     }
+}
+
+const char *getSafeNodeName(meshtastic_NodeInfoLite *node)
+{
+    static char nodeName[16] = "?";
+    formatSafeNodeName(node, nodeName, sizeof(nodeName));
     return nodeName;
 }
 
+static void formatDistance(double distanceKm, char *distStr, size_t len)
+{
+    if (config.display.units == meshtastic_Config_DisplayConfig_DisplayUnits_IMPERIAL) {
+        double miles = distanceKm * 0.621371;
+        if (miles < 0.1) {
+            int feet = (int)(miles * 5280);
+            if (feet < 1000)
+                snprintf(distStr, len, "%dft", feet);
+            else
+                snprintf(distStr, len, "¼mi"); // 4-char max
+        } else {
+            int roundedMiles = (int)(miles + 0.5);
+            if (roundedMiles < 1000)
+                snprintf(distStr, len, "%dmi", roundedMiles);
+            else
+                snprintf(distStr, len, "999"); // Max display cap
+        }
+    } else {
+        if (distanceKm < 1.0) {
+            int meters = (int)(distanceKm * 1000);
+            if (meters < 1000)
+                snprintf(distStr, len, "%dm", meters);
+            else
+                snprintf(distStr, len, "1k");
+        } else {
+            int km = (int)(distanceKm + 0.5);
+            if (km < 1000)
+                snprintf(distStr, len, "%dk", km);
+            else
+                snprintf(distStr, len, "999");
+        }
+    }
+}
+
+// =============================
+// Row Cache
+// =============================
+
+#ifndef NODELIST_ROW_CACHE_SIZE
+#define NODELIST_ROW_CACHE_SIZE 32 // Power of two, comfortably more than the rows one screen shows
+#endif
+#ifndef NODELIST_MOVED_METERS
+#define NODELIST_MOVED_METERS 10 // Work out distances and bearings again once we are this far from where we last did
+#endif
+
+/// What a node list row shows that is costly to work out, kept until the node changes or we move
+struct NodeRow {
+    NodeNum num = 0;
+    uint32_t changeSeq = 0; // nodeDB->getNodeChangeSeq() when the row was filled in
+    uint32_t epoch = 0;     // originEpoch when distance and bearing were worked out
+    char name[16];
+    char distance[10]; // Empty unless both positions are known
+    float bearing;     // From us to the node in radians, NAN if the node has no position
+};
+
+static NodeRow rowCache[NODELIST_ROW_CACHE_SIZE];
+
+// Where the cached distances and bearings were measured from
+static GeoOrigin rowOrigin;
+static bool originValid;
+static meshtastic_Config_DisplayConfig_DisplayUnits originUnits;
+static uint32_t originEpoch = 1; // Bumped whenever the above change, so rows redo what depends on them
+
+/// Called once per list draw, before any row is looked up
+static void updateRowOrigin()
+{
+    meshtastic_NodeInfoLite *ourNode = nodeDB->getMeshNode(nodeDB->getNodeNum());
+    int32_t lat = ourNode ? ourNode->position.latitude_i : 0;
+    int32_t lon = ourNode ? ourNode->position.longitude_i : 0;
+    bool valid = nodeDB->hasValidPosition(ourNode);
+
+    if (valid == originValid && config.display.units == originUnits &&
+        rowOrigin.distanceTo(lat, lon) < NODELIST_MOVED_METERS)
+        return;
+
+    rowOrigin = GeoOrigin(lat, lon);
+    originValid = valid;
+    originUnits = config.display.units;
+    originEpoch++;
+}
+
+static const NodeRow &getNodeRow(meshtastic_NodeInfoLite *node)
+{
+    NodeRow &row = rowCache[node->num & (NODELIST_ROW_CACHE_SIZE - 1)];
+    uint32_t seq = nodeDB->getNodeChangeSeq(node->num);
+    if (row.num != node->num || row.changeSeq != seq) {
+        row.num = node->num;
+        row.changeSeq = seq;
+        row.epoch = 0;
+        formatSafeNodeName(node, row.name, sizeof(row.name));
+    }
+
+    if (row.epoch != originEpoch) {
+        row.epoch = originEpoch;
+        row.distance[0] = '\0';
+        row.bearing = NAN;
+        if (nodeDB->hasValidPosition(node)) {
+            row.bearing = rowOrigin.bearingTo(node->position.latitude_i, node->position.longitude_i);
+            if (originValid)
+                formatDistance(rowOrigin.distanceTo(node->position.latitude_i, node->position.longitude_i) / 1000,
+                               row.distance, sizeof(row.distance));
+        }
+    }
+    return row;
+}
+
 const char *getCurrentModeTitle(int screenWidth)
 {
     switch (currentMode) {
@@ -137,7 +248,7 @@ void drawEntryLastHeard(OLEDDisplay *display, meshtastic_NodeInfoLite *node, int
     bool isLeftCol = (x < SCREEN_WIDTH / 2);
     int timeOffset = (isHighResolution) ? (isLeftCol ? 7 : 10) : (isLeftCol ? 3 : 7);
 
-    const char *nodeName = getSafeNodeName(node);
+    const char *nodeName = getNodeRow(node).name;
 
     char timeStr[10];
     uint32_t seconds = sinceLastSeen(node);
@@ -182,7 +293,7 @@ void drawEntryHopSignal(OLEDDisplay *display, meshtastic_NodeInfoLite *node, int
 
     int barsXOffset = columnWidth - barsOffset;
 
-    const char *nodeName = getSafeNodeName(node);
+    const char *nodeName = getNodeRow(node).name;
 
     display->setTextAlignment(TEXT_ALIGN_LEFT);
     display->setFont(FONT_SMALL);
@@ -226,56 +337,9 @@ void drawNodeDistance(OLEDDisplay *display, meshtastic_NodeInfoLite *node, int16
     bool isLeftCol = (x < SCREEN_WIDTH / 2);
     int nameMaxWidth = columnWidth - (isHighResolution ? (isLeftCol ? 25 : 28) : (isLeftCol ? 20 : 22));
 
-    const char *nodeName = getSafeNodeName(node);
-    char distStr[10] = "";
-
-    meshtastic_NodeInfoLite *ourNode = nodeDB->getMeshNode(nodeDB->getNodeNum());
-    if (nodeDB->hasValidPosition(ourNode) && nodeDB->hasValidPosition(node)) {
-        double lat1 = ourNode->position.latitude_i * 1e-7;
-        double lon1 = ourNode->position.longitude_i * 1e-7;
-        double lat2 = node->position.latitude_i * 1e-7;
-        double lon2 = node->position.longitude_i * 1e-7;
-
-        double earthRadiusKm = 6371.0;
-        double dLat = (lat2 - lat1) * DEG_TO_RAD;
-        double dLon = (lon2 - lon1) * DEG_TO_RAD;
-
-        double a =
-            sin(dLat / 2) * sin(dLat / 2) + cos(lat1 * DEG_TO_RAD) * cos(lat2 * DEG_TO_RAD) * sin(dLon / 2) * sin(dLon / 2);
-        double c = 2 * atan2(sqrt(a), sqrt(1 - a));
-        double distanceKm = earthRadiusKm * c;
-
-        if (config.display.units == meshtastic_Config_DisplayConfig_DisplayUnits_IMPERIAL) {
-            double miles = distanceKm * 0.621371;
-            if (miles < 0.1) {
-                int feet = (int)(miles * 5280);
-                if (feet < 1000)
-                    snprintf(distStr, sizeof(distStr), "%dft", feet);
-                else
-                    snprintf(distStr, sizeof(distStr), "¼mi"); // 4-char max
-            } else {
-                int roundedMiles = (int)(miles + 0.5);
-                if (roundedMiles < 1000)
-                    snprintf(distStr, sizeof(distStr), "%dmi", roundedMiles);
-                else
-                    snprintf(distStr, sizeof(distStr), "999"); // Max display cap
-            }
-        } else {
-            if (distanceKm < 1.0) {
-                int meters = (int)(distanceKm * 1000);
-                if (meters < 1000)
-                    snprintf(distStr, sizeof(distStr), "%dm", meters);
-                else
-                    snprintf(distStr, sizeof(distStr), "1k");
-            } else {
-                int km = (int)(distanceKm + 0.5);
-                if (km < 1000)
-                    snprintf(distStr, sizeof(distStr), "%dk", km);
-                else
-                    snprintf(distStr, sizeof(distStr), "999");
-            }
-        }
-    }
+    const NodeRow &row = getNodeRow(node);
+    const char *nodeName = row.name;
+    const char *distStr = row.distance;
 
     display->setTextAlignment(TEXT_ALIGN_LEFT);
     display->setFont(FONT_SMALL);
@@ -321,7 +385,7 @@ void drawEntryCompass(OLEDDisplay *display, meshtastic_NodeInfoLite *node, int16
     // Adjust max text width depending on column and screen width
     int nameMaxWidth = columnWidth - (isHighResolution ? (isLeftCol ? 25 : 28) : (isLeftCol ? 20 : 22));
 
-    const char *nodeName = getSafeNodeName(node);
+    const char *nodeName = getNodeRow(node).name;
 
     display->setTextAlignment(TEXT_ALIGN_LEFT);
     display->setFont(FONT_SMALL);
@@ -338,7 +402,8 @@ void drawEntryCompass(OLEDDisplay *display, meshtastic_NodeInfoLite *node, int16
 void drawCompassArrow(OLEDDisplay *display, meshtastic_NodeInfoLite *node, int16_t x, int16_t y, int columnWidth, float myHeading,
                       double userLat, double userLon)
 {
-    if (!nodeDB->hasValidPosition(node))
+    float bearing = getNodeRow(node).bearing; // Measured from the row origin, which tracks userLat/userLon
+    if (isnan(bearing))
         return;
 
     bool isLeftCol = (x < SCREEN_WIDTH / 2);
@@ -347,9 +412,6 @@ void drawCompassArrow(OLEDDisplay *display, meshtastic_NodeInfoLite *node, int16
     int centerX = x + columnWidth - arrowXOffset;
     int centerY = y + FONT_HEIGHT_SMALL / 2;
 
-    double nodeLat = node->position.latitude_i * 1e-7;
-    double nodeLon = node->position.longitude_i * 1e-7;
-    float bearing = GeoCoord::bearing(userLat, userLon, nodeLat, nodeLon);
     float bearingToNode = RAD_TO_DEG * bearing;
     float relativeBearing = fmod((bearingToNode - myHeading + 360), 360);
     float angle = relativeBearing * DEG_TO_RAD;
@@ -404,6 +466,8 @@ void drawNodeListScreen(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t
     // Space below header
     y += COMMON_HEADER_HEIGHT;
 
+    updateRowOrigin();
+
     int totalEntries = nodeDB->getNumMeshNodes();
     int totalRowsAvailable = (display->getHeight() - y) / rowYOffset;
 
@@ -0,0 +1,139 @@
+#include "CompressedFont.h"
+#if FONT_COMPRESSED
+#include <stdlib.h>
+
+static_assert(FONT_CACHE_BYTES < 0xffff, "Glyph offsets in the jump table are 16 bit, and 0xffff means missing");
+
+FontCache fontCache;
+
+// Offsets within an OLEDDisplay font
+#define FONT_FIRST_CHAR_POS 2
+#define FONT_CHAR_NUM_POS 3
+#define FONT_JUMPTABLE_START 4
+#define FONT_JUMPTABLE_BYTES 4
+#define FONT_GLYPH_MISSING 0xFF // In both offset bytes of the jump table
+
+const uint8_t *FontCache::font(const CompressedFont &f)
+{
+    Entry *e = find(f);
+    if (e)
+        return e->ram;
+    if (numEntries == FONT_CACHE_MAX_FONTS)
+        return nullptr;
+
+    uint16_t numChars = pgm_read_byte(&f.header[FONT_CHAR_NUM_POS]);
+    uint16_t headerLen = FONT_JUMPTABLE_START + numChars * FONT_JUMPTABLE_BYTES;
+    uint16_t slotSize = 1;
+    for (uint16_t c = 0; c < numChars; c++) {
+        uint8_t size = pgm_read_byte(&f.header[FONT_JUMPTABLE_START + c * FONT_JUMPTABLE_BYTES + 2]);
+        if (size > slotSize)
+            slotSize = size;
+    }
+    uint16_t slots = FONT_CACHE_BYTES / slotSize;
+    if (slots > numChars)
+        slots = numChars;
+    if (slots == 0)
+        slots = 1;
+
+    uint8_t *ram = (uint8_t *)malloc(headerLen + slots * slotSize);
+    uint16_t *slotGlyph = (uint16_t *)malloc(slots * sizeof(uint16_t));
+    uint32_t *slotUsed = (uint32_t *)calloc(slots, sizeof(uint32_t));
+    if (!ram || !slotGlyph || !slotUsed) {
+        free(ram);
+        free(slotGlyph);
+        free(slotUsed);
+        return nullptr;
+    }
+    for (uint16_t i = 0; i < headerLen; i++)
+        ram[i] = pgm_read_byte(&f.header[i]);
+    // Nothing is decoded yet
+    for (uint16_t c = 0; c < numChars; c++) {
+        uint8_t *jump = ram + FONT_JUMPTABLE_START + c * FONT_JUMPTABLE_BYTES;
+        jump[0] = jump[1] = FONT_GLYPH_MISSING;
+    }
+    for (uint16_t s = 0; s < slots; s++)
+        slotGlyph[s] = UINT16_MAX;
+
+    e = &entries[numEntries++];
+    *e = Entry{&f, ram, slotGlyph, slotUsed, slotSize, slots};
+    return ram;
+}
+
+void FontCache::touch(uint8_t code)
+{
+    clock++;
+    for (uint8_t i = 0; i < numEntries; i++)
+        touch(entries[i], code, clock);
+}
+
+FontCache::Entry *FontCache::find(const CompressedFont &f)
+{
+    for (uint8_t i = 0; i < numEntries; i++)
+        if (entries[i].source == &f)
+            return &entries[i];
+    return nullptr;
+}
+
+void FontCache::touch(Entry &e, uint8_t code, uint32_t now)
+{
+    const uint8_t *header = e.source->header;
+    uint8_t first = e.ram[FONT_FIRST_CHAR_POS];
+    uint16_t numChars = e.ram[FONT_CHAR_NUM_POS];
+    if (code < first || code - first >= numChars)
+        return;
+
+    uint16_t glyph = code - first;
+    uint16_t at = FONT_JUMPTABLE_START + glyph * FONT_JUMPTABLE_BYTES;
+    uint8_t *jump = e.ram + at;
+    if (jump[0] != FONT_GLYPH_MISSING || jump[1] != FONT_GLYPH_MISSING) {
+        e.slotUsed[((jump[0] << 8) | jump[1]) / e.slotSize] = now;
+        return;
+    }
+    uint8_t msb = pgm_read_byte(&header[at]), lsb = pgm_read_byte(&header[at + 1]);
+    if (msb == FONT_GLYPH_MISSING && lsb == FONT_GLYPH_MISSING)
+        return; // The font has no glyph for it
+
+    uint16_t victim = 0;
+    for (uint16_t s = 1; s < e.slots; s++)
+        if (e.slotUsed[s] < e.slotUsed[victim])
+            victim = s;
+    if (e.slotGlyph[victim] != UINT16_MAX) {
+        uint8_t *old = e.ram + FONT_JUMPTABLE_START + e.slotGlyph[victim] * FONT_JUMPTABLE_BYTES;
+        old[0] = old[1] = FONT_GLYPH_MISSING;
+    }
+
+    uint16_t offset = victim * e.slotSize;
+    uint16_t headerLen = FONT_JUMPTABLE_START + numChars * FONT_JUMPTABLE_BYTES;
+    decode(*e.source, (msb << 8) | lsb, e.ram + headerLen + offset, jump[2]);
+    e.slotGlyph[victim] = glyph;
+    e.slotUsed[victim] = now;
+    jump[0] = offset >> 8;
+    jump[1] = offset & 0xff;
+}
+
+// Canonical Huffman, bit by bit from the most significant, as in zlib's puff.c
+void FontCache::decode(const CompressedFont &f, uint16_t offset, uint8_t *out, uint16_t len)
+{
+    const uint8_t *in = f.data + offset;
+    const uint8_t *symbols = f.huffman + FONT_HUFFMAN_MAXBITS;
+    uint8_t byte = 0, bitsLeft = 0;
+    for (uint16_t n = 0; n < len; n++) {
+        int code = 0, first = 0, index = 0;
+        for (uint8_t bits = 1; bits <= FONT_HUFFMAN_MAXBITS; bits++) {
+            if (bitsLeft == 0) {
+                byte = pgm_read_byte(in++);
+                bitsLeft = 8;
+            }
+            code |= (byte >> --bitsLeft) & 1;
+            int count = pgm_read_byte(&f.huffman[bits - 1]);
+            if (code - count < first) {
+                out[n] = pgm_read_byte(&symbols[index + code - first]);
+                break;
+            }
+            index += count;
+            first = (first + count) << 1;
+            code <<= 1;
+        }
+    }
+}
+#endif
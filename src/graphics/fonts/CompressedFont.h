@@ -0,0 +1,72 @@
+#pragma once
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#elif __MBED__
+#define PROGMEM
+#endif
+#include <stdint.h>
+
+// Store the localized OLED fonts Huffman coded, and decode their glyphs into RAM as they are drawn.  Saves about half the flash
+// the fonts take, for a few kB of RAM, so it's for builds short of flash.  Regenerate the coded fonts with
+// bin/compress-oled-fonts.py after editing OLEDDisplayFonts*.cpp.
+#ifndef FONT_COMPRESSED
+#define FONT_COMPRESSED 0
+#endif
+// RAM each font gets for decoded glyphs.  The glyphs of one string must all fit, or the first ones drawn blank.
+#ifndef FONT_CACHE_BYTES
+#define FONT_CACHE_BYTES 1536
+#endif
+#define FONT_CACHE_MAX_FONTS 3 // A build only has the small, medium and large font of its locale
+#define FONT_HUFFMAN_MAXBITS 16
+
+/**
+ * A font in the OLEDDisplay format, with each glyph Huffman coded on its own.
+ *
+ * header is the usual OLEDDisplay header and jump table, except that glyph offsets point into data rather than after the
+ * jump table.  The glyph sizes are those decoded.  huffman is a canonical code: the number of codes of each length from 1 to
+ * FONT_HUFFMAN_MAXBITS, then the byte each code stands for in code order.
+ */
+struct CompressedFont {
+    const uint8_t *header;
+    const uint8_t *data;
+    const uint8_t *huffman;
+};
+
+/**
+ * The OLEDDisplay fonts that compressed fonts are drawn with.
+ *
+ * Each is a copy of the jump table in RAM with room for some decoded glyphs.  Glyphs not decoded yet are marked missing, which
+ * OLEDDisplay skips, so touch() must see each character before it is drawn.  The font table lookup function is where it does,
+ * as OLEDDisplay passes every character of a string through that first.  When the room is full the glyph drawn longest ago
+ * makes way.
+ */
+class FontCache
+{
+  public:
+    /// The font to pass to OLEDDisplay::setFont() for f, nullptr if there's no RAM for it
+    const uint8_t *font(const CompressedFont &f);
+
+    /// Decode the glyph for code in each font, unless it is already
+    void touch(uint8_t code);
+
+  private:
+    struct Entry {
+        const CompressedFont *source;
+        uint8_t *ram;             // Header, jump table, then slots
+        uint16_t *slotGlyph;      // The glyph in each slot, UINT16_MAX if none
+        uint32_t *slotUsed;       // When each slot was last touched
+        uint16_t slotSize, slots; // Bytes in the largest glyph, and how many fit in FONT_CACHE_BYTES
+    };
+
+    Entry *find(const CompressedFont &f);
+    static void touch(Entry &e, uint8_t code, uint32_t now);
+    static void decode(const CompressedFont &f, uint16_t offset, uint8_t *out, uint16_t len);
+
+    // No constructor, so it is zeroed before any static initializer asks for a font height
+    Entry entries[FONT_CACHE_MAX_FONTS];
+    uint8_t numEntries;
+    uint32_t clock;
+};
+
+extern FontCache fontCache;
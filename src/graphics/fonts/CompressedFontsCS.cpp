@@ -0,0 +1,716 @@
+// Generated by bin/compress-oled-fonts.py from OLEDDisplayFontsCS.cpp, don't edit
+// trunk-ignore-all(clang-format): Generated
+#include "OLEDDisplayFontsCS.h"
+#if defined(OLED_CS) && FONT_COMPRESSED
+
+const uint8_t ArialMT_Plain_10_CS_header[] PROGMEM = {
+    0x0A, 0x0D, 0x20, 0xE0, 0xFF, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x04, 0x03, 0x00, 0x02, 0x05, 0x04,
+    0x00, 0x05, 0x09, 0x06, 0x00, 0x0B, 0x0A, 0x06, 0x00, 0x12, 0x10, 0x09, 0x00, 0x1B, 0x0E, 0x08,
+    0x00, 0x24, 0x01, 0x02, 0x00, 0x25, 0x06, 0x04, 0x00, 0x2A, 0x06, 0x04, 0x00, 0x2F, 0x05, 0x04,
+    0x00, 0x32, 0x09, 0x06, 0x00, 0x37, 0x04, 0x03, 0x00, 0x39, 0x03, 0x03, 0x00, 0x3B, 0x04, 0x03,
+    0x00, 0x3D, 0x05, 0x04, 0x00, 0x40, 0x0A, 0x06, 0x00, 0x46, 0x08, 0x05, 0x00, 0x4A, 0x0A, 0x06,
+    0x00, 0x50, 0x0A, 0x06, 0x00, 0x56, 0x0B, 0x07, 0x00, 0x5D, 0x0A, 0x06, 0x00, 0x64, 0x0A, 0x06,
+    0x00, 0x6A, 0x09, 0x06, 0x00, 0x6F, 0x0A, 0x06, 0x00, 0x75, 0x0A, 0x06, 0x00, 0x7C, 0x04, 0x03,
+    0x00, 0x7E, 0x04, 0x03, 0x00, 0x81, 0x0A, 0x06, 0x00, 0x86, 0x09, 0x06, 0x00, 0x8B, 0x09, 0x06,
+    0x00, 0x90, 0x0B, 0x07, 0x00, 0x96, 0x14, 0x0B, 0x00, 0xA7, 0x0E, 0x08, 0x00, 0xAE, 0x0C, 0x07,
+    0x00, 0xB4, 0x0C, 0x07, 0x00, 0xBA, 0x0B, 0x07, 0x00, 0xC0, 0x0C, 0x07, 0x00, 0xC6, 0x09, 0x06,
+    0x00, 0xCA, 0x0D, 0x08, 0x00, 0xD1, 0x0C, 0x07, 0x00, 0xD7, 0x04, 0x03, 0x00, 0xD9, 0x08, 0x05,
+    0x00, 0xDC, 0x0E, 0x08, 0x00, 0xE3, 0x0C, 0x07, 0x00, 0xE8, 0x10, 0x09, 0x00, 0xF0, 0x0C, 0x07,
+    0x00, 0xF6, 0x0E, 0x08, 0x00, 0xFD, 0x0B, 0x07, 0x01, 0x03, 0x0E, 0x08, 0x01, 0x0A, 0x0C, 0x07,
+    0x01, 0x10, 0x0C, 0x07, 0x01, 0x17, 0x0B, 0x07, 0x01, 0x1C, 0x0C, 0x07, 0x01, 0x21, 0x0D, 0x08,
+    0x01, 0x28, 0x11, 0x0A, 0x01, 0x31, 0x0E, 0x08, 0x01, 0x38, 0x0D, 0x08, 0x01, 0x3F, 0x0C, 0x07,
+    0x01, 0x47, 0x06, 0x04, 0x01, 0x4B, 0x06, 0x04, 0x01, 0x4E, 0x04, 0x03, 0x01, 0x51, 0x09, 0x06,
+    0x01, 0x56, 0x0C, 0x07, 0x01, 0x5C, 0x03, 0x03, 0x01, 0x5E, 0x0A, 0x06, 0x01, 0x63, 0x0A, 0x06,
+    0x01, 0x68, 0x0A, 0x06, 0x01, 0x6D, 0x0A, 0x06, 0x01, 0x72, 0x0A, 0x06, 0x01, 0x77, 0x05, 0x04,
+    0x01, 0x7A, 0x0A, 0x06, 0x01, 0x81, 0x0A, 0x06, 0x01, 0x86, 0x04, 0x03, 0x01, 0x88, 0x04, 0x03,
+    0x01, 0x8B, 0x08, 0x05, 0x01, 0x90, 0x04, 0x03, 0x01, 0x92, 0x10, 0x09, 0x01, 0x9A, 0x0A, 0x06,
+    0x01, 0x9F, 0x0A, 0x06, 0x01, 0xA4, 0x0A, 0x06, 0x01, 0xA9, 0x0A, 0x06, 0x01, 0xAE, 0x05, 0x04,
+    0x01, 0xB1, 0x08, 0x05, 0x01, 0xB6, 0x06, 0x04, 0x01, 0xB9, 0x0A, 0x06, 0x01, 0xBD, 0x09, 0x06,
+    0x01, 0xC2, 0x0E, 0x08, 0x01, 0xC9, 0x0A, 0x06, 0x01, 0xCF, 0x09, 0x06, 0x01, 0xD5, 0x0A, 0x06,
+    0x01, 0xDB, 0x06, 0x04, 0x01, 0xE0, 0x04, 0x03, 0x01, 0xE2, 0x05, 0x04, 0x01, 0xE6, 0x09, 0x06,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0x01, 0xEB, 0x0C, 0x07, 0x01, 0xF2, 0x0B, 0x07,
+    0x01, 0xF9, 0x0C, 0x07, 0x02, 0x00, 0x0C, 0x07, 0x02, 0x08, 0x0C, 0x07, 0x02, 0x0F, 0x0C, 0x07,
+    0x02, 0x17, 0x0B, 0x07, 0x02, 0x1D, 0x0C, 0x07, 0x02, 0x23, 0x0C, 0x07, 0x02, 0x2C, 0x0A, 0x06,
+    0x02, 0x32, 0x0D, 0x08, 0x02, 0x38, 0x0A, 0x06, 0x02, 0x3E, 0x0A, 0x06, 0x02, 0x44, 0x07, 0x05,
+    0x02, 0x49, 0x08, 0x05, 0x02, 0x4F, 0x07, 0x05, 0x02, 0x53, 0x0A, 0x06, 0x02, 0x59, 0x0A, 0x06,
+    0x02, 0x60, 0x0C, 0x07, 0x02, 0x65, 0x05, 0x04, 0x02, 0x68, 0x0C, 0x07, 0x02, 0x6D, 0x07, 0x05,
+    0x02, 0x70, 0x0C, 0x07, 0x02, 0x77, 0x07, 0x05, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0x02, 0x7B, 0x04, 0x03, 0x02, 0x7E, 0x0A, 0x06,
+    0x02, 0x84, 0x0C, 0x07, 0x02, 0x8B, 0x0A, 0x06, 0x02, 0x90, 0x0A, 0x06, 0x02, 0x96, 0x04, 0x03,
+    0x02, 0x99, 0x0A, 0x06, 0x02, 0xA2, 0x05, 0x04, 0x02, 0xA4, 0x0D, 0x08, 0x02, 0xAC, 0x07, 0x05,
+    0x02, 0xB1, 0x0A, 0x06, 0x02, 0xB6, 0x09, 0x06, 0x02, 0xBB, 0x03, 0x03, 0x02, 0xBD, 0x0D, 0x08,
+    0x02, 0xC5, 0x0B, 0x07, 0x02, 0xC9, 0x07, 0x05, 0x02, 0xCD, 0x0A, 0x06, 0x02, 0xD3, 0x05, 0x04,
+    0x02, 0xD7, 0x05, 0x04, 0x02, 0xDB, 0x05, 0x04, 0x02, 0xDE, 0x0A, 0x06, 0x02, 0xE3, 0x09, 0x06,
+    0x02, 0xE9, 0x03, 0x03, 0x02, 0xEB, 0x06, 0x04, 0x02, 0xEF, 0x05, 0x04, 0x02, 0xF2, 0x07, 0x05,
+    0x02, 0xF6, 0x0A, 0x06, 0x02, 0xFB, 0x10, 0x09, 0x03, 0x04, 0x10, 0x09, 0x03, 0x0D, 0x10, 0x09,
+    0x03, 0x17, 0x0A, 0x06, 0x03, 0x1D, 0x0E, 0x08, 0x03, 0x25, 0x0E, 0x08, 0x03, 0x2D, 0x0E, 0x08,
+    0x03, 0x35, 0x0E, 0x08, 0x03, 0x3D, 0x0E, 0x08, 0x03, 0x45, 0x0E, 0x08, 0x03, 0x4D, 0x12, 0x0A,
+    0x03, 0x57, 0x0C, 0x07, 0x03, 0x5F, 0x0C, 0x07, 0x03, 0x66, 0x0C, 0x07, 0x03, 0x6D, 0x0C, 0x07,
+    0x03, 0x74, 0x0C, 0x07, 0x03, 0x7B, 0x05, 0x04, 0x03, 0x7E, 0x04, 0x03, 0x03, 0x81, 0x04, 0x03,
+    0x03, 0x84, 0x05, 0x04, 0x03, 0x87, 0x0B, 0x07, 0x03, 0x8D, 0x0C, 0x07, 0x03, 0x95, 0x0E, 0x08,
+    0x03, 0x9D, 0x0E, 0x08, 0x03, 0xA5, 0x0E, 0x08, 0x03, 0xAD, 0x0E, 0x08, 0x03, 0xB5, 0x0E, 0x08,
+    0x03, 0xBD, 0x0A, 0x06, 0x03, 0xC3, 0x0D, 0x08, 0x03, 0xCB, 0x0C, 0x07, 0x03, 0xD0, 0x0C, 0x07,
+    0x03, 0xD5, 0x0C, 0x07, 0x03, 0xDA, 0x0C, 0x07, 0x03, 0xDF, 0x0D, 0x08, 0x03, 0xE7, 0x0B, 0x07,
+    0x03, 0xED, 0x0C, 0x07, 0x03, 0xF4, 0x0A, 0x06, 0x03, 0xF9, 0x0A, 0x06, 0x03, 0xFE, 0x0A, 0x06,
+    0x04, 0x04, 0x0A, 0x06, 0x04, 0x0A, 0x0A, 0x06, 0x04, 0x10, 0x0A, 0x06, 0x04, 0x17, 0x10, 0x09,
+    0x04, 0x20, 0x0A, 0x06, 0x04, 0x27, 0x0A, 0x06, 0x04, 0x2D, 0x0A, 0x06, 0x04, 0x33, 0x0A, 0x06,
+    0x04, 0x39, 0x0A, 0x06, 0x04, 0x3F, 0x05, 0x04, 0x04, 0x42, 0x04, 0x03, 0x04, 0x45, 0x05, 0x04,
+    0x04, 0x49, 0x05, 0x04, 0x04, 0x4C, 0x0A, 0x06, 0x04, 0x51, 0x0A, 0x06, 0x04, 0x57, 0x0A, 0x06,
+    0x04, 0x5C, 0x0A, 0x06, 0x04, 0x61, 0x0A, 0x06, 0x04, 0x67, 0x0A, 0x06, 0x04, 0x6D, 0x0A, 0x06,
+    0x04, 0x72, 0x09, 0x06, 0x04, 0x78, 0x0A, 0x06, 0x04, 0x7E, 0x0A, 0x06, 0x04, 0x83, 0x0A, 0x06,
+    0x04, 0x88, 0x0A, 0x06, 0x04, 0x8E, 0x0A, 0x06, 0x04, 0x93, 0x09, 0x06, 0x04, 0x9A, 0x0A, 0x06,
+    0x04, 0x9F, 0x09, 0x06,
+};
+const uint8_t ArialMT_Plain_10_CS_data[] PROGMEM = {
+    0x0B, 0xB0, 0xE9, 0x03, 0xA4, 0xD2, 0x2C, 0x7E, 0xF1, 0x63, 0xF7, 0xE0, 0xB1, 0x77, 0xF6, 0xD1,
+    0xF8, 0xA0, 0x0E, 0x05, 0x0E, 0x11, 0x53, 0xCD, 0x51, 0xE6, 0x80, 0xCD, 0x7B, 0x9F, 0x6B, 0xE2,
+    0xF7, 0xAC, 0xE3, 0x36, 0xE9, 0xB4, 0x61, 0xCD, 0x29, 0x00, 0x94, 0xB0, 0xE6, 0xB4, 0x00, 0xC4,
+    0xDE, 0x62, 0xC8, 0xC8, 0xD5, 0x64, 0x64, 0x03, 0x9C, 0xCC, 0xCC, 0x01, 0x80, 0x22, 0xC6, 0xF0,
+    0xD5, 0x49, 0xC9, 0xC9, 0xEA, 0x80, 0x09, 0x98, 0x17, 0x80, 0xC1, 0xCA, 0x3C, 0x1D, 0x1F, 0x06,
+    0xC1, 0x49, 0xD1, 0xD1, 0xF9, 0xA0, 0xA9, 0xA1, 0xE2, 0x78, 0x17, 0x8C, 0xC0, 0xEC, 0x5D, 0x2F,
+    0x17, 0x8B, 0xE4, 0x80, 0xD5, 0x62, 0xF1, 0x78, 0xBF, 0xAA, 0x91, 0x28, 0xE4, 0x74, 0x92, 0xF3,
+    0x54, 0x74, 0x74, 0x7E, 0x68, 0xEE, 0x5E, 0x0F, 0xC1, 0xF8, 0x3D, 0x50, 0x09, 0xB0, 0x09, 0xF3,
+    0x80, 0x0C, 0x8D, 0x0D, 0x0C, 0x10, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0x0C, 0x16, 0x86, 0x86, 0x40,
+    0xC0, 0x91, 0x23, 0x93, 0xA1, 0xC0, 0x0A, 0xC7, 0x0E, 0x6F, 0xAE, 0xCC, 0x76, 0xE3, 0xB7, 0x97,
+    0xF8, 0xED, 0xDB, 0x87, 0xB2, 0xDC, 0xC0, 0x1D, 0x57, 0x99, 0xE0, 0x79, 0x95, 0x43, 0x0B, 0xC5,
+    0x1D, 0x1D, 0x1E, 0xA8, 0x0D, 0x54, 0x9C, 0x9C, 0x9E, 0x08, 0x0B, 0xC4, 0x9C, 0x9E, 0x0A, 0xC0,
+    0x0B, 0xC5, 0x1D, 0x1D, 0x1D, 0x18, 0x0B, 0xC5, 0x0A, 0x12, 0x0B, 0x18, 0x29, 0x3A, 0x3F, 0x72,
+    0xA8, 0x0B, 0xC6, 0x46, 0x46, 0x45, 0xE0, 0x0B, 0xC0, 0x20, 0x63, 0xBA, 0x0B, 0xC6, 0x67, 0x61,
+    0xE2, 0x49, 0x0C, 0x0B, 0xC0, 0xC6, 0x31, 0x80, 0x0B, 0xC7, 0x02, 0xA8, 0x75, 0x5C, 0x0B, 0xC0,
+    0x0B, 0xC7, 0x03, 0x23, 0x35, 0x78, 0x0D, 0x54, 0x9C, 0x9C, 0x9C, 0x9E, 0xA8, 0x0B, 0xC5, 0x0A,
+    0x14, 0x38, 0x00, 0x0D, 0x54, 0x9C, 0x9C, 0xA2, 0x51, 0xAB, 0x0B, 0xC5, 0x0A, 0x1C, 0x8E, 0x10,
+    0x0E, 0x0A, 0x8E, 0x8E, 0x8F, 0xC5, 0x00, 0x09, 0x12, 0x2F, 0x12, 0x24, 0x0B, 0xA1, 0x8C, 0x77,
+    0x40, 0x91, 0xDC, 0x66, 0x87, 0x9A, 0xEE, 0x24, 0xDE, 0x59, 0x0F, 0x55, 0x23, 0x54, 0x3B, 0x2D,
+    0xE0, 0x1C, 0x97, 0x89, 0xD8, 0x78, 0x92, 0x43, 0x91, 0x81, 0x32, 0xB1, 0x33, 0x02, 0x40, 0x94,
+    0x78, 0x3E, 0x4F, 0xB5, 0xF4, 0xBD, 0xEC, 0x0B, 0xEE, 0x94, 0x80, 0xDE, 0x58, 0x20, 0x94, 0xAF,
+    0xB8, 0xC8, 0xE0, 0x48, 0xE0, 0x64, 0x24, 0x48, 0x91, 0x22, 0x44, 0x80, 0x91, 0x80, 0x02, 0x34,
+    0x7A, 0x3B, 0x40, 0x0B, 0xC4, 0xDC, 0xDD, 0x50, 0x0A, 0xA9, 0xB9, 0xBC, 0x90, 0x0A, 0xA9, 0xB9,
+    0xBB, 0xC0, 0x0A, 0xAD, 0x1E, 0x8E, 0xAC, 0x99, 0xAC, 0x62, 0x0A, 0xFB, 0x27, 0xB6, 0x7B, 0x6D,
+    0xED, 0x0B, 0xC4, 0xC9, 0x95, 0x80, 0x0F, 0x48, 0x25, 0xE9, 0xED, 0xBC, 0x66, 0x55, 0x4D, 0x80,
+    0x0B, 0xC0, 0x0B, 0x44, 0xC9, 0x96, 0x89, 0x93, 0x2B, 0x00, 0x0B, 0x44, 0xC9, 0x95, 0x80, 0x0A,
+    0xA9, 0xB9, 0xBA, 0xA0, 0x0B, 0x6E, 0x9B, 0x9B, 0xAA, 0x0A, 0xA9, 0xB9, 0xBB, 0x6E, 0x0B, 0x44,
+    0xC0, 0xC9, 0xE8, 0xF4, 0x73, 0x40, 0x99, 0x78, 0x9B, 0x0B, 0x21, 0x8E, 0xD0, 0x99, 0x54, 0x3A,
+    0xA9, 0x80, 0xB2, 0x1D, 0x54, 0xCA, 0xA1, 0xD9, 0x00, 0x9B, 0xC9, 0x66, 0x64, 0xA6, 0xC0, 0x99,
+    0x5D, 0x87, 0x3D, 0x54, 0xC0, 0x9B, 0x9C, 0x68, 0xFB, 0x1C, 0xD8, 0xCC, 0xEF, 0xDD, 0x29, 0x00,
+    0x0B, 0xEE, 0x94, 0xBB, 0xF7, 0x66, 0xA9, 0x91, 0x53, 0x32, 0xA0, 0x0D, 0x56, 0xC7, 0xB5, 0xEC,
+    0x78, 0x20, 0x0B, 0xC6, 0xC7, 0xB5, 0xFF, 0x95, 0x60, 0x0B, 0xC7, 0x53, 0xEB, 0x7D, 0x4E, 0x8C,
+    0x0B, 0xC7, 0xE2, 0x7E, 0x47, 0xE6, 0xAF, 0x00, 0x0B, 0xC7, 0x51, 0xD6, 0x7D, 0x0E, 0x10, 0x0E,
+    0x0B, 0xA9, 0xF5, 0xBE, 0xA7, 0xE2, 0x80, 0x09, 0x1B, 0x0F, 0x58, 0xD8, 0x48, 0x0B, 0xA6, 0xFD,
+    0x8D, 0xBB, 0xA0, 0x94, 0x78, 0x3F, 0xA3, 0xFF, 0xCF, 0xFD, 0xBD, 0xEC, 0x0A, 0xAE, 0x87, 0x8B,
+    0xFF, 0x88, 0x0A, 0xA9, 0xB9, 0xBB, 0xC0, 0x6F, 0x0A, 0xAF, 0x27, 0xC5, 0xFC, 0xD8, 0x0B, 0x47,
+    0x41, 0x89, 0xF3, 0x80, 0x0F, 0xB4, 0x62, 0x73, 0x00, 0xC9, 0xF9, 0x3E, 0x2F, 0xA1, 0x00, 0x99,
+    0x78, 0x9B, 0xDE, 0x0B, 0x29, 0x3F, 0xB9, 0xFA, 0x40, 0x9B, 0xE8, 0x8E, 0x2F, 0xFE, 0xB9, 0xB0,
+    0x0F, 0x58, 0x4C, 0x63, 0x18, 0x0F, 0x58, 0x40, 0x0B, 0xC0, 0xC7, 0xBD, 0x8C, 0x0B, 0xC0, 0x6F,
+    0x0B, 0xC5, 0x0E, 0xB3, 0xE8, 0x70, 0x80, 0x0B, 0x46, 0x27, 0x30, 0x0D, 0x37, 0x00, 0x0A, 0xAD,
+    0x37, 0x77, 0xBC, 0x90, 0xC9, 0xF7, 0x47, 0x27, 0x47, 0x27, 0x83, 0x0B, 0x29, 0xA9, 0xAB, 0x20,
+    0xA2, 0xEE, 0x55, 0x8E, 0xE5, 0x44, 0x0E, 0x9D, 0xC0, 0xFA, 0xF3, 0x63, 0xB2, 0x9B, 0x29, 0xB7,
+    0xC7, 0xD8, 0x90, 0x12, 0xB1, 0x82, 0xA3, 0xE2, 0xF8, 0xBC, 0x15, 0x80, 0xED, 0x3B, 0x4E, 0xD3,
+    0xBC, 0x0C, 0xD6, 0x4F, 0x35, 0x93, 0x99, 0x32, 0x64, 0xCB, 0x00, 0xCC, 0xCC, 0xB1, 0x82, 0xF4,
+    0x7D, 0xAF, 0x93, 0xC1, 0x58, 0x63, 0x18, 0xC6, 0x30, 0x0E, 0x93, 0x13, 0xA4, 0xC9, 0xE4, 0xF5,
+    0x8C, 0x9E, 0x4C, 0xA1, 0xDA, 0x7B, 0xC0, 0xA1, 0xEF, 0x3B, 0x40, 0x0C, 0x09, 0x00, 0x0B, 0x6E,
+    0x18, 0xED, 0x00, 0xEE, 0x2F, 0xBA, 0x45, 0xF7, 0x48, 0x0C, 0x80, 0x03, 0xEE, 0x37, 0x80, 0x0C,
+    0x0E, 0xF0, 0xE0, 0x50, 0xA1, 0xC0, 0x0C, 0x9E, 0x6B, 0x27, 0x9A, 0x0C, 0x1F, 0x7A, 0xA9, 0x35,
+    0xE2, 0xB9, 0x40, 0x80, 0x0C, 0x1F, 0x7A, 0xCC, 0xEC, 0x3D, 0xCE, 0x91, 0x56, 0xA1, 0xEF, 0x3B,
+    0x63, 0x33, 0xB1, 0x78, 0xAE, 0x50, 0x20, 0x03, 0x9C, 0xD9, 0xA6, 0xC3, 0x98, 0x1D, 0x57, 0x99,
+    0xFA, 0x1F, 0x22, 0xA8, 0x60, 0x1D, 0x57, 0x99, 0xF0, 0x3E, 0x25, 0x50, 0xC0, 0x1D, 0x57, 0xC8,
+    0xFD, 0x0F, 0x91, 0x54, 0x30, 0x1F, 0xF2, 0xBE, 0x27, 0xC0, 0xF8, 0x95, 0x43, 0x1D, 0x57, 0xC8,
+    0xF0, 0x3E, 0x45, 0x50, 0xC0, 0x1D, 0x57, 0xF0, 0x7C, 0x0F, 0xE0, 0xAA, 0x18, 0x22, 0xA5, 0x8F,
+    0xFE, 0x78, 0x17, 0x8A, 0x3A, 0x3A, 0x30, 0x0D, 0x54, 0x9C, 0xBE, 0xF9, 0x7E, 0x18, 0x20, 0x0B,
+    0xC7, 0x53, 0xEB, 0x74, 0x74, 0x60, 0x0B, 0xC5, 0x1F, 0x5B, 0xEA, 0x74, 0x60, 0x0F, 0x58, 0xEA,
+    0x7D, 0x6E, 0x8E, 0x8C, 0x0B, 0xC7, 0x5B, 0xA3, 0xEB, 0x74, 0x60, 0x0F, 0xEE, 0x18, 0x67, 0xF7,
+    0x00, 0x47, 0xAC, 0x00, 0x65, 0xE1, 0x80, 0xC8, 0xBC, 0x51, 0xD1, 0xE0, 0xAC, 0x0F, 0x58, 0xFC,
+    0x4F, 0xC8, 0xFC, 0xD5, 0xE0, 0x0D, 0x54, 0x9E, 0xC7, 0xB5, 0xC9, 0xEA, 0x80, 0x0D, 0x54, 0x9E,
+    0xD7, 0xB1, 0xC9, 0xEA, 0x80, 0x0D, 0x54, 0x9E, 0xD7, 0xB1, 0xED, 0x7A, 0xA0, 0x0D, 0x56, 0xD7,
+    0xB1, 0xED, 0x7B, 0x1E, 0xA8, 0x0D, 0x56, 0xD7, 0x27, 0xB5, 0xC9, 0xEA, 0x80, 0xC1, 0x68, 0x58,
+    0xD0, 0xC1, 0x00, 0x0D, 0x5C, 0xA3, 0x93, 0xC5, 0xEF, 0x8F, 0x40, 0x0B, 0xA4, 0xDB, 0x1D, 0xD0,
+    0x0B, 0xA6, 0xD3, 0x1D, 0xD0, 0x0B, 0xA6, 0xD3, 0x6E, 0xE8, 0x0B, 0xA6, 0xC6, 0xDD, 0xD0, 0x91,
+    0x81, 0x33, 0xF9, 0x8F, 0xF4, 0x60, 0x48, 0x0B, 0xC6, 0x0B, 0x05, 0x82, 0xB0, 0x0D, 0x62, 0x4A,
+    0x8F, 0xCD, 0xE6, 0x80, 0x02, 0x3C, 0x9F, 0x17, 0x68, 0x02, 0x38, 0xBF, 0x27, 0x68, 0x02, 0x38,
+    0xBF, 0x27, 0xE9, 0x00, 0x09, 0x47, 0x93, 0xE2, 0xFE, 0xD0, 0x02, 0x38, 0xBD, 0x1F, 0xA4, 0x00,
+    0x02, 0x3F, 0x67, 0xFA, 0xBF, 0xEA, 0x00, 0x0C, 0xA3, 0x47, 0xA3, 0xAA, 0xD1, 0xE8, 0xEA, 0xC0,
+    0x0A, 0xA9, 0xFD, 0xF3, 0xFC, 0x32, 0x40, 0x0A, 0xAF, 0x27, 0xC5, 0xD5, 0x80, 0x0A, 0xAE, 0x2F,
+    0xC9, 0xD5, 0x80, 0x0A, 0xAE, 0x2F, 0xC9, 0xF2, 0x60, 0x0A, 0xAE, 0x2F, 0x47, 0xC9, 0x80, 0x0F,
+    0xB4, 0x48, 0x91, 0xF6, 0x80, 0x91, 0xF6, 0x89, 0x00, 0x91, 0x68, 0x90, 0x0A, 0xAC, 0x5F, 0x4B,
+    0xB2, 0x0F, 0x48, 0xE8, 0x31, 0x3E, 0x70, 0x0A, 0xAE, 0x87, 0x8B, 0xAA, 0x0A, 0xAC, 0x5F, 0x43,
+    0xAA, 0x0A, 0xAC, 0x5F, 0x43, 0xE4, 0x80, 0x0E, 0x4B, 0xA1, 0xE2, 0xFE, 0x68, 0x0A, 0xAC, 0x5C,
+    0xDF, 0x24, 0xC8, 0xC8, 0xF7, 0x2C, 0x8C, 0x80, 0x0A, 0xBD, 0x23, 0xB1, 0xE8, 0x80, 0x0B, 0x2E,
+    0x67, 0x27, 0x68, 0x0B, 0x29, 0x3E, 0x67, 0x68, 0x0F, 0x45, 0xCC, 0xE4, 0xED, 0x00, 0x0B, 0x29,
+    0x31, 0xFA, 0x40, 0x99, 0x5D, 0x92, 0xE7, 0xF9, 0xA9, 0x80, 0x0B, 0xEE, 0x9B, 0x9B, 0xAA, 0x99,
+    0xCB, 0x61, 0xCF, 0xC9, 0x4C,
+};
+const uint8_t ArialMT_Plain_10_CS_huffman[] PROGMEM = {
+    0x00, 0x01, 0x02, 0x01, 0x06, 0x06, 0x07, 0x10, 0x0B, 0x0E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x08, 0x20, 0x48, 0xC0, 0xE0, 0xF8, 0x10, 0x28, 0x40, 0x80, 0xA0, 0xF0,
+    0x09, 0x0A, 0x0F, 0x18, 0x30, 0xA8, 0xC8, 0x04, 0x06, 0x24, 0x38, 0x49, 0x4A, 0x60, 0x68, 0x70,
+    0x78, 0x88, 0x90, 0xA4, 0xB0, 0xE8, 0xFA, 0x05, 0x07, 0x50, 0x58, 0x8A, 0xB1, 0xB2, 0xC4, 0xC9,
+    0xD0, 0xE4, 0x14, 0x16, 0x1A, 0x31, 0x42, 0x81, 0x89, 0xAA, 0xAE, 0xB8, 0xBE, 0xC2, 0xEE, 0xF9,
+    0x0B, 0x11, 0x21, 0x39, 0x44, 0x64, 0x6A, 0x98,
+};
+const CompressedFont ArialMT_Plain_10_CS = {ArialMT_Plain_10_CS_header, ArialMT_Plain_10_CS_data, ArialMT_Plain_10_CS_huffman};
+
+const uint8_t ArialMT_Plain_16_CS_header[] PROGMEM = {
+    0x10, 0x13, 0x20, 0xE0, 0xFF, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x03, 0x0D, 0x06,
+    0x00, 0x07, 0x1A, 0x0A, 0x00, 0x17, 0x17, 0x09, 0x00, 0x24, 0x26, 0x0E, 0x00, 0x38, 0x1D, 0x0B,
+    0x00, 0x47, 0x04, 0x03, 0x00, 0x49, 0x0C, 0x05, 0x00, 0x4F, 0x0B, 0x05, 0x00, 0x55, 0x0D, 0x06,
+    0x00, 0x5B, 0x17, 0x09, 0x00, 0x63, 0x09, 0x04, 0x00, 0x66, 0x0B, 0x05, 0x00, 0x69, 0x08, 0x04,
+    0x00, 0x6B, 0x0A, 0x05, 0x00, 0x71, 0x17, 0x09, 0x00, 0x7C, 0x11, 0x07, 0x00, 0x81, 0x17, 0x09,
+    0x00, 0x8C, 0x17, 0x09, 0x00, 0x97, 0x17, 0x09, 0x00, 0xA1, 0x17, 0x09, 0x00, 0xAE, 0x17, 0x09,
+    0x00, 0xBB, 0x16, 0x09, 0x00, 0xC4, 0x17, 0x09, 0x00, 0xD1, 0x17, 0x09, 0x00, 0xDE, 0x05, 0x03,
+    0x00, 0xE0, 0x06, 0x03, 0x00, 0xE3, 0x17, 0x09, 0x00, 0xED, 0x17, 0x09, 0x00, 0xF6, 0x17, 0x09,
+    0x01, 0x00, 0x16, 0x09, 0x01, 0x09, 0x2F, 0x11, 0x01, 0x29, 0x1D, 0x0B, 0x01, 0x37, 0x1D, 0x0B,
+    0x01, 0x46, 0x20, 0x0C, 0x01, 0x54, 0x20, 0x0C, 0x01, 0x62, 0x1D, 0x0B, 0x01, 0x6F, 0x19, 0x0A,
+    0x01, 0x79, 0x20, 0x0C, 0x01, 0x89, 0x1D, 0x0B, 0x01, 0x94, 0x05, 0x03, 0x01, 0x96, 0x14, 0x08,
+    0x01, 0x9D, 0x1D, 0x0B, 0x01, 0xAA, 0x17, 0x09, 0x01, 0xB1, 0x23, 0x0D, 0x01, 0xBF, 0x1D, 0x0B,
+    0x01, 0xCA, 0x20, 0x0C, 0x01, 0xD8, 0x1C, 0x0B, 0x01, 0xE4, 0x20, 0x0C, 0x01, 0xF4, 0x1D, 0x0B,
+    0x02, 0x03, 0x1D, 0x0B, 0x02, 0x12, 0x19, 0x0A, 0x02, 0x1A, 0x1D, 0x0B, 0x02, 0x24, 0x1C, 0x0B,
+    0x02, 0x30, 0x2B, 0x10, 0x02, 0x45, 0x20, 0x0C, 0x02, 0x54, 0x19, 0x0A, 0x02, 0x5E, 0x1A, 0x0A,
+    0x02, 0x6C, 0x0C, 0x05, 0x02, 0x72, 0x0B, 0x05, 0x02, 0x78, 0x09, 0x04, 0x02, 0x7E, 0x14, 0x08,
+    0x02, 0x86, 0x1B, 0x0A, 0x02, 0x8E, 0x07, 0x04, 0x02, 0x90, 0x17, 0x09, 0x02, 0x9B, 0x17, 0x09,
+    0x02, 0xA5, 0x14, 0x08, 0x02, 0xAD, 0x17, 0x09, 0x02, 0xB7, 0x17, 0x09, 0x02, 0xC2, 0x0A, 0x05,
+    0x02, 0xC7, 0x17, 0x09, 0x02, 0xD4, 0x14, 0x08, 0x02, 0xDB, 0x05, 0x03, 0x02, 0xDE, 0x06, 0x03,
+    0x02, 0xE2, 0x17, 0x09, 0x02, 0xEC, 0x05, 0x03, 0x02, 0xEE, 0x23, 0x0D, 0x02, 0xFA, 0x14, 0x08,
+    0x03, 0x01, 0x17, 0x09, 0x03, 0x0A, 0x17, 0x09, 0x03, 0x15, 0x18, 0x09, 0x03, 0x20, 0x0D, 0x06,
+    0x03, 0x25, 0x14, 0x08, 0x03, 0x2F, 0x0B, 0x05, 0x03, 0x34, 0x14, 0x08, 0x03, 0x3B, 0x13, 0x08,
+    0x03, 0x43, 0x1F, 0x0C, 0x03, 0x4F, 0x14, 0x08, 0x03, 0x58, 0x13, 0x08, 0x03, 0x63, 0x14, 0x08,
+    0x03, 0x6D, 0x0F, 0x06, 0x03, 0x75, 0x06, 0x03, 0x03, 0x79, 0x0E, 0x06, 0x03, 0x81, 0x17, 0x09,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0x03, 0x89, 0x20, 0x0C, 0x03, 0x98, 0x20, 0x0C,
+    0x03, 0xA7, 0x1D, 0x0B, 0x03, 0xB6, 0x1D, 0x0B, 0x03, 0xC4, 0x1D, 0x0B, 0x03, 0xD4, 0x1D, 0x0B,
+    0x03, 0xE4, 0x19, 0x0A, 0x03, 0xED, 0x1D, 0x0B, 0x03, 0xFA, 0x1A, 0x0A, 0x04, 0x09, 0x14, 0x08,
+    0x04, 0x12, 0x1C, 0x0B, 0x04, 0x1D, 0x17, 0x09, 0x04, 0x29, 0x14, 0x08, 0x04, 0x31, 0x0D, 0x06,
+    0x04, 0x37, 0x14, 0x08, 0x04, 0x43, 0x10, 0x07, 0x04, 0x4A, 0x14, 0x08, 0x04, 0x56, 0x14, 0x08,
+    0x04, 0x62, 0x17, 0x09, 0x04, 0x6A, 0x07, 0x04, 0x04, 0x6E, 0x17, 0x09, 0x04, 0x76, 0x0A, 0x05,
+    0x04, 0x7A, 0x1D, 0x0B, 0x04, 0x89, 0x0D, 0x06, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0x04, 0x8E, 0x09, 0x04, 0x04, 0x92, 0x17, 0x09,
+    0x04, 0x9F, 0x17, 0x09, 0x04, 0xAC, 0x14, 0x08, 0x04, 0xB6, 0x1A, 0x0A, 0x04, 0xC6, 0x06, 0x03,
+    0x04, 0xCA, 0x17, 0x09, 0x04, 0xDD, 0x07, 0x04, 0x04, 0xDF, 0x23, 0x0D, 0x04, 0xF5, 0x0E, 0x06,
+    0x04, 0xFE, 0x14, 0x08, 0x05, 0x07, 0x17, 0x09, 0x05, 0x0F, 0x0B, 0x05, 0x05, 0x12, 0x23, 0x0D,
+    0x05, 0x29, 0x19, 0x0A, 0x05, 0x33, 0x0D, 0x06, 0x05, 0x38, 0x17, 0x09, 0x05, 0x41, 0x0E, 0x06,
+    0x05, 0x4A, 0x0D, 0x06, 0x05, 0x52, 0x0A, 0x05, 0x05, 0x55, 0x17, 0x09, 0x05, 0x5E, 0x19, 0x0A,
+    0x05, 0x6C, 0x08, 0x04, 0x05, 0x6E, 0x0C, 0x05, 0x05, 0x72, 0x0B, 0x05, 0x05, 0x76, 0x0D, 0x06,
+    0x05, 0x7D, 0x17, 0x09, 0x05, 0x86, 0x26, 0x0E, 0x05, 0x97, 0x26, 0x0E, 0x05, 0xA9, 0x26, 0x0E,
+    0x05, 0xBD, 0x1A, 0x0A, 0x05, 0xC8, 0x1D, 0x0B, 0x05, 0xD7, 0x1D, 0x0B, 0x05, 0xE6, 0x1D, 0x0B,
+    0x05, 0xF6, 0x1D, 0x0B, 0x06, 0x06, 0x1D, 0x0B, 0x06, 0x15, 0x1D, 0x0B, 0x06, 0x24, 0x2C, 0x10,
+    0x06, 0x3B, 0x20, 0x0C, 0x06, 0x4B, 0x1D, 0x0B, 0x06, 0x59, 0x1D, 0x0B, 0x06, 0x67, 0x1D, 0x0B,
+    0x06, 0x76, 0x1D, 0x0B, 0x06, 0x84, 0x05, 0x03, 0x06, 0x87, 0x07, 0x04, 0x06, 0x8B, 0x0A, 0x05,
+    0x06, 0x90, 0x07, 0x04, 0x06, 0x94, 0x20, 0x0C, 0x06, 0xA4, 0x1D, 0x0B, 0x06, 0xB2, 0x20, 0x0C,
+    0x06, 0xC1, 0x20, 0x0C, 0x06, 0xD0, 0x20, 0x0C, 0x06, 0xE0, 0x20, 0x0C, 0x06, 0xF0, 0x20, 0x0C,
+    0x06, 0xFF, 0x17, 0x09, 0x07, 0x09, 0x20, 0x0C, 0x07, 0x1C, 0x1D, 0x0B, 0x07, 0x27, 0x1D, 0x0B,
+    0x07, 0x32, 0x1D, 0x0B, 0x07, 0x3E, 0x1D, 0x0B, 0x07, 0x49, 0x19, 0x0A, 0x07, 0x54, 0x1D, 0x0B,
+    0x07, 0x61, 0x17, 0x09, 0x07, 0x6C, 0x17, 0x09, 0x07, 0x78, 0x17, 0x09, 0x07, 0x84, 0x17, 0x09,
+    0x07, 0x91, 0x17, 0x09, 0x07, 0x9E, 0x17, 0x09, 0x07, 0xAA, 0x17, 0x09, 0x07, 0xB8, 0x29, 0x0F,
+    0x07, 0xCD, 0x14, 0x08, 0x07, 0xD7, 0x17, 0x09, 0x07, 0xE3, 0x17, 0x09, 0x07, 0xEF, 0x17, 0x09,
+    0x07, 0xFC, 0x17, 0x09, 0x08, 0x08, 0x05, 0x03, 0x08, 0x0B, 0x07, 0x04, 0x08, 0x0E, 0x0A, 0x05,
+    0x08, 0x13, 0x07, 0x04, 0x08, 0x17, 0x17, 0x09, 0x08, 0x24, 0x14, 0x08, 0x08, 0x2D, 0x17, 0x09,
+    0x08, 0x37, 0x17, 0x09, 0x08, 0x41, 0x17, 0x09, 0x08, 0x4C, 0x17, 0x09, 0x08, 0x57, 0x17, 0x09,
+    0x08, 0x61, 0x17, 0x09, 0x08, 0x69, 0x17, 0x09, 0x08, 0x75, 0x14, 0x08, 0x08, 0x7D, 0x14, 0x08,
+    0x08, 0x85, 0x14, 0x08, 0x08, 0x8E, 0x14, 0x08, 0x08, 0x96, 0x13, 0x08, 0x08, 0xA2, 0x17, 0x09,
+    0x08, 0xAD, 0x13, 0x08,
+};
+const uint8_t ArialMT_Plain_16_CS_data[] PROGMEM = {
+    0x03, 0x5F, 0xDE, 0x1F, 0x68, 0x07, 0xDA, 0xBC, 0x2F, 0xF6, 0xB4, 0xEA, 0x7E, 0x10, 0xBC, 0x2F,
+    0xF6, 0xB4, 0xEA, 0x7E, 0x10, 0xBC, 0x00, 0x1E, 0x75, 0x57, 0xD2, 0x8C, 0x5F, 0xFF, 0xF1, 0x47,
+    0x82, 0xBD, 0x8B, 0x6F, 0x1F, 0x02, 0x30, 0x46, 0x08, 0xFE, 0x0F, 0x87, 0x59, 0xE8, 0x69, 0x83,
+    0xBF, 0xF5, 0xA3, 0xC0, 0xF0, 0x3C, 0x0F, 0xD6, 0x0D, 0xEF, 0x1E, 0xC7, 0x96, 0x28, 0xF6, 0xBC,
+    0xB2, 0x78, 0xF7, 0x15, 0x3B, 0x8C, 0x80, 0x1F, 0x68, 0x17, 0xF6, 0x3C, 0x74, 0xC2, 0x14, 0x10,
+    0xA7, 0x8E, 0x98, 0x5F, 0xD8, 0xA9, 0xF8, 0x9E, 0xA3, 0xF1, 0x2A, 0x0A, 0x14, 0x28, 0xD3, 0x81,
+    0x42, 0x85, 0x00, 0x01, 0xA6, 0x00, 0x41, 0x04, 0x10, 0x01, 0x20, 0x73, 0x3E, 0x97, 0x9E, 0x0E,
+    0xB0, 0x1E, 0x7C, 0x15, 0xB2, 0x25, 0x12, 0x89, 0x56, 0xCF, 0x3E, 0x00, 0x02, 0x4B, 0x15, 0x35,
+    0xCC, 0x16, 0x95, 0x79, 0xA3, 0x92, 0x38, 0xA3, 0x25, 0x7D, 0xAF, 0x39, 0x16, 0xAA, 0xB6, 0x46,
+    0x28, 0xC5, 0xE5, 0x8B, 0xE1, 0xD8, 0x6F, 0x7C, 0xC6, 0xE3, 0x6B, 0x48, 0x5A, 0x15, 0x86, 0xB9,
+    0x90, 0x1A, 0x7E, 0x67, 0xE1, 0x67, 0x94, 0xBC, 0xA5, 0xE5, 0x28, 0xF4, 0xA3, 0xE9, 0x1E, 0x7C,
+    0x15, 0xF4, 0xBC, 0xA5, 0xE5, 0x2F, 0x29, 0x57, 0xD2, 0xB7, 0xD2, 0x10, 0x41, 0x1F, 0x6A, 0x3A,
+    0x5E, 0xF3, 0xB8, 0xEB, 0x1C, 0xF7, 0xBD, 0xDD, 0x88, 0xC5, 0x18, 0xA3, 0x17, 0xBB, 0xB1, 0xCF,
+    0x78, 0x1E, 0x7F, 0x99, 0x5E, 0xC4, 0x64, 0x8C, 0x91, 0x92, 0xBD, 0x8F, 0x3E, 0x00, 0x13, 0x20,
+    0x13, 0xA6, 0x00, 0x0A, 0x1F, 0x21, 0xF2, 0x2F, 0x0B, 0xC2, 0xF0, 0x9A, 0x80, 0x17, 0x85, 0xE1,
+    0x78, 0x5E, 0x17, 0x85, 0xE1, 0x78, 0x13, 0x55, 0xE1, 0x78, 0x5E, 0x0F, 0x90, 0xF9, 0x0A, 0x00,
+    0x1C, 0xCA, 0x90, 0x47, 0xEE, 0x45, 0x15, 0xC1, 0xE6, 0x0F, 0x63, 0x49, 0x5A, 0xEA, 0xFD, 0x38,
+    0x57, 0xD3, 0x87, 0x94, 0xD3, 0x8C, 0xD3, 0x8C, 0xD3, 0x8D, 0xA9, 0xE5, 0xFE, 0xF4, 0xF7, 0xFB,
+    0x69, 0x59, 0xA5, 0x6D, 0x87, 0x3A, 0xE1, 0x7F, 0xFA, 0x0E, 0x66, 0xF5, 0xFA, 0x5E, 0x3B, 0x11,
+    0xB1, 0xE3, 0xB1, 0x7E, 0x93, 0x79, 0xCC, 0x1A, 0xE6, 0x8C, 0x51, 0x8A, 0x31, 0x46, 0x28, 0xC5,
+    0x18, 0xBD, 0xDD, 0x8E, 0x7B, 0xC0, 0x1A, 0x75, 0x2D, 0x55, 0x6C, 0x89, 0x44, 0xA2, 0x51, 0x28,
+    0x95, 0x6C, 0xB5, 0x40, 0x1A, 0xE6, 0x89, 0x44, 0xA2, 0x51, 0x28, 0x94, 0x4A, 0xB6, 0x5A, 0xAD,
+    0x3A, 0x80, 0x1A, 0xE6, 0x8C, 0x51, 0x8A, 0x31, 0x46, 0x28, 0xC5, 0x18, 0xA3, 0x14, 0x48, 0x1A,
+    0xE6, 0x8A, 0x22, 0x88, 0xA2, 0x28, 0x8A, 0x22, 0x88, 0x1A, 0x75, 0x2D, 0x55, 0x6C, 0x89, 0x44,
+    0xA3, 0xC1, 0x1E, 0x0A, 0xF6, 0x2D, 0xF9, 0xCF, 0xEE, 0x1A, 0xE6, 0x60, 0x60, 0x60, 0x60, 0x60,
+    0x60, 0x60, 0xD7, 0x30, 0x1A, 0xE6, 0x0F, 0x51, 0x24, 0x92, 0x4B, 0x5F, 0x60, 0x1A, 0xE6, 0x6C,
+    0x28, 0x60, 0xBF, 0x42, 0x76, 0x2D, 0xD6, 0xAD, 0x91, 0x20, 0x1A, 0xE6, 0x49, 0x24, 0x92, 0x49,
+    0x20, 0x1A, 0xE6, 0xEF, 0x34, 0x1D, 0x06, 0xF3, 0x99, 0xBC, 0xE8, 0x68, 0x77, 0x9A, 0xE6, 0x1A,
+    0xE6, 0xA9, 0xCC, 0xB8, 0xE8, 0x36, 0x1D, 0x65, 0x9A, 0xE6, 0x1A, 0x75, 0x2D, 0x55, 0x6C, 0x89,
+    0x44, 0xA2, 0x51, 0x2A, 0xD9, 0x6A, 0xB4, 0xEA, 0x1A, 0xE6, 0x8A, 0x22, 0x88, 0xA2, 0x28, 0x8A,
+    0x22, 0x8A, 0xE0, 0xF3, 0x1A, 0x75, 0x2D, 0x55, 0x6C, 0x89, 0x44, 0xA3, 0x92, 0x39, 0x2B, 0x65,
+    0xBC, 0x5A, 0x7D, 0x40, 0x1A, 0xE6, 0x8A, 0x22, 0x88, 0xA2, 0x28, 0x8F, 0x42, 0x3F, 0x42, 0xBE,
+    0x97, 0x9C, 0x80, 0x1C, 0xEA, 0xF7, 0x59, 0x18, 0xA3, 0x14, 0x62, 0x8F, 0x04, 0x78, 0x2B, 0xD8,
+    0xB6, 0xF0, 0x82, 0x08, 0x20, 0xD7, 0x34, 0x10, 0x41, 0x00, 0x1A, 0xF0, 0x2C, 0x49, 0x24, 0x92,
+    0x49, 0x66, 0xBC, 0x00, 0x1D, 0x67, 0x98, 0xE9, 0x3A, 0xCE, 0x67, 0x59, 0xD2, 0xF3, 0x3A, 0xC0,
+    0xEB, 0x3C, 0xF0, 0x3E, 0x93, 0x99, 0xBD, 0x7E, 0x87, 0x89, 0x07, 0x89, 0x7E, 0x83, 0x79, 0xCC,
+    0xFA, 0x5E, 0x78, 0x3A, 0xC0, 0x4A, 0x2C, 0xAD, 0x5C, 0xFE, 0x65, 0xE8, 0x60, 0xBD, 0x1C, 0xFE,
+    0x65, 0x6A, 0x8B, 0x12, 0x83, 0xBC, 0x92, 0xF8, 0x1F, 0x72, 0xF8, 0x24, 0xEF, 0x20, 0x4A, 0x39,
+    0xA3, 0xEB, 0x46, 0x48, 0xF6, 0xBC, 0xA5, 0xFC, 0x65, 0xD7, 0x28, 0x90, 0x1A, 0xFC, 0x7A, 0x21,
+    0x48, 0x50, 0xEB, 0x3C, 0xF0, 0x3E, 0x93, 0x98, 0x85, 0x21, 0x4D, 0x7E, 0x3D, 0x00, 0x60, 0xD0,
+    0xEF, 0x20, 0xEF, 0x34, 0x18, 0x00, 0x28, 0x50, 0xA1, 0x42, 0x85, 0x0A, 0x14, 0x28, 0x10, 0x54,
+    0x0F, 0x5A, 0xF9, 0x27, 0x24, 0xE4, 0x9F, 0x04, 0xF6, 0x2F, 0x98, 0x1A, 0xE6, 0xBD, 0x93, 0x29,
+    0x94, 0xCA, 0xF6, 0x38, 0x00, 0x0E, 0x0B, 0xD9, 0x32, 0x99, 0x4C, 0xAF, 0x60, 0x0E, 0x0B, 0xD9,
+    0x32, 0x99, 0x4C, 0xAF, 0x66, 0xB9, 0x80, 0x0E, 0x0B, 0xF6, 0xA7, 0x24, 0xE4, 0x9C, 0x97, 0xED,
+    0x3E, 0x70, 0x93, 0xE1, 0x9B, 0x89, 0xC4, 0x0E, 0x18, 0x5E, 0xD4, 0x99, 0xA4, 0xCD, 0x26, 0x69,
+    0x7B, 0x61, 0xA7, 0xC4, 0x1A, 0xE6, 0xB9, 0x24, 0x92, 0x5F, 0x30, 0x1E, 0xFC, 0xC0, 0x29, 0xEF,
+    0xF8, 0xE0, 0x1A, 0xE6, 0x41, 0xB0, 0xF4, 0x1F, 0xDE, 0xBD, 0x93, 0x20, 0x1A, 0xE6, 0x1A, 0x66,
+    0xB9, 0x24, 0x92, 0x5F, 0x35, 0xC9, 0x24, 0x92, 0xF9, 0x80, 0x1A, 0x66, 0xB9, 0x24, 0x92, 0x5F,
+    0x30, 0x0E, 0x0B, 0xD9, 0x32, 0x99, 0x4C, 0xAF, 0x63, 0x80, 0x1A, 0x7C, 0x7A, 0x2F, 0x64, 0xCA,
+    0x65, 0x32, 0xBD, 0x8E, 0x00, 0x0E, 0x0B, 0xD9, 0x32, 0x99, 0x4C, 0xAF, 0x66, 0x9F, 0x1E, 0x80,
+    0x1A, 0x66, 0xB9, 0x24, 0x80, 0x17, 0xFD, 0x29, 0xC9, 0x39, 0x27, 0x24, 0xE4, 0xBF, 0xA8, 0x93,
+    0xE1, 0x9A, 0x65, 0x32, 0x1A, 0x7B, 0x09, 0x24, 0x92, 0xCD, 0x33, 0xD0, 0x74, 0x1B, 0xCE, 0x66,
+    0xF3, 0xA1, 0xA0, 0xD0, 0x70, 0x39, 0x9B, 0xCE, 0x86, 0x83, 0xA0, 0xDE, 0x73, 0x38, 0x34, 0x99,
+    0x5E, 0xC7, 0xD0, 0x6C, 0x3E, 0x85, 0xEC, 0x99, 0xD3, 0x03, 0xD1, 0x47, 0xAA, 0x8F, 0x3C, 0x1E,
+    0xA3, 0xA5, 0xA0, 0x99, 0x4F, 0x34, 0xFD, 0x69, 0xC9, 0x3E, 0xD6, 0x92, 0x99, 0x6C, 0x36, 0x3E,
+    0x1F, 0xDB, 0x08, 0x52, 0x14, 0x1A, 0xFC, 0x7A, 0x00, 0x85, 0x21, 0x4F, 0x87, 0xF6, 0xC1, 0xB0,
+    0xD8, 0x50, 0xC0, 0xC0, 0xC0, 0xA1, 0x42, 0x86, 0x00, 0x1A, 0x75, 0x2D, 0x55, 0x6C, 0xDB, 0x2D,
+    0xD2, 0xDD, 0x2D, 0xB2, 0x89, 0x56, 0xCB, 0x54, 0x1A, 0xE6, 0x89, 0x44, 0xB6, 0xCB, 0x74, 0xB7,
+    0x4B, 0x6C, 0xAB, 0x65, 0xAA, 0xD3, 0xA8, 0x1A, 0xE6, 0x8C, 0x51, 0x8B, 0x6E, 0x2D, 0xD8, 0xB7,
+    0x62, 0xDB, 0x8A, 0x31, 0x44, 0x80, 0x1A, 0xE6, 0xA9, 0xCC, 0xFB, 0xCA, 0x74, 0x29, 0xB1, 0x87,
+    0x59, 0x66, 0xB9, 0x80, 0x1A, 0xE6, 0x8A, 0x22, 0x8D, 0xB4, 0x6E, 0xA3, 0x77, 0xA1, 0xB7, 0xF4,
+    0x2B, 0xE9, 0x79, 0xC8, 0x1C, 0xEA, 0xF7, 0x59, 0x18, 0xB6, 0xE2, 0xDD, 0x8B, 0x77, 0x83, 0x6F,
+    0x82, 0xBD, 0x8B, 0x6F, 0x82, 0x08, 0x36, 0x9F, 0x96, 0x6D, 0xC6, 0xD2, 0x08, 0x1A, 0xF0, 0x2C,
+    0x4B, 0xD1, 0x2D, 0xB2, 0xDB, 0x2F, 0x44, 0x96, 0x6B, 0xC0, 0x4A, 0x39, 0xA3, 0xEB, 0x6D, 0xC9,
+    0xBB, 0xDA, 0xFF, 0x99, 0x7F, 0xB4, 0xBA, 0xE5, 0x12, 0x0E, 0x0B, 0xD9, 0xC6, 0x5C, 0xA5, 0xCA,
+    0x5E, 0x56, 0x0E, 0x0B, 0xD9, 0x32, 0x99, 0x4C, 0xAF, 0x66, 0xB9, 0x87, 0xA8, 0x0E, 0x0B, 0xF6,
+    0xB8, 0xE4, 0xE5, 0x93, 0x96, 0x4F, 0x2E, 0xD3, 0xE7, 0x1A, 0x66, 0xF2, 0x39, 0x1C, 0x8E, 0x25,
+    0xF3, 0x1E, 0xFC, 0xDE, 0xE3, 0x91, 0xC4, 0x17, 0xFD, 0x2E, 0x39, 0x39, 0x64, 0xE5, 0x93, 0x8E,
+    0x4B, 0xFA, 0x80, 0x93, 0xE1, 0x9A, 0x65, 0x32, 0x1E, 0x20, 0x1A, 0x7B, 0x1F, 0x34, 0xBF, 0x3C,
+    0xBF, 0x3C, 0xBE, 0x6B, 0x34, 0xCC, 0x99, 0x4F, 0x37, 0x1F, 0xAD, 0xCB, 0x27, 0x2F, 0x6B, 0xDF,
+    0x29, 0x90, 0x1A, 0xE6, 0xA4, 0xB0, 0x92, 0x49, 0x24, 0x90, 0x1F, 0x96, 0x6C, 0x00, 0x1A, 0xE6,
+    0x49, 0x24, 0x92, 0xF5, 0x49, 0x20, 0x1A, 0xE6, 0x1E, 0xA0, 0x1A, 0xE6, 0x8A, 0x22, 0x88, 0xA3,
+    0x75, 0x1B, 0x7D, 0x08, 0xFD, 0x0A, 0xFA, 0x5E, 0x72, 0x1A, 0x66, 0xB9, 0xC8, 0xE2, 0x02, 0x7E,
+    0x3D, 0x00, 0x0E, 0x0B, 0xDB, 0xA2, 0x7E, 0x09, 0xFF, 0x36, 0x98, 0xBF, 0x0B, 0x1F, 0x98, 0x62,
+    0xF3, 0xFD, 0x4A, 0xFF, 0x82, 0x3D, 0x28, 0xF4, 0xA2, 0x55, 0x95, 0xAC, 0x13, 0xF2, 0xAF, 0xB1,
+    0x30, 0x98, 0x5F, 0x62, 0x7E, 0x50, 0x8D, 0xCA, 0xEE, 0x73, 0xDC, 0xBF, 0xCA, 0x7D, 0xCB, 0xFC,
+    0xAE, 0x7B, 0x95, 0xDC, 0x8D, 0xC0, 0x1A, 0xFF, 0xEF, 0x40, 0x7F, 0xC3, 0xC7, 0x6E, 0x1E, 0xFA,
+    0xD3, 0xCA, 0xB4, 0x8F, 0x4D, 0x23, 0xF8, 0x53, 0xBF, 0xFF, 0x30, 0x7C, 0xC0, 0x80, 0x40, 0xD3,
+    0xA9, 0x6A, 0xAB, 0x67, 0xBF, 0xFC, 0x9D, 0xDC, 0x5D, 0xDC, 0x5D, 0xDC, 0x5D, 0xDC, 0x5C, 0x72,
+    0x56, 0xCB, 0x55, 0xA7, 0x50, 0xFC, 0x4E, 0x38, 0x3B, 0xB0, 0x77, 0x60, 0xF8, 0x60, 0x0D, 0x87,
+    0xD0, 0xBD, 0x8D, 0x87, 0xD0, 0xBD, 0x80, 0x17, 0x2E, 0x5C, 0xB9, 0x72, 0xE5, 0xFA, 0x80, 0x41,
+    0x04, 0x10, 0xD3, 0xA9, 0x6A, 0xAB, 0x67, 0xF5, 0xFA, 0x9D, 0xD8, 0xBB, 0xB1, 0x77, 0x7B, 0x5D,
+    0xDF, 0xE2, 0xF7, 0xF1, 0x56, 0xCB, 0x55, 0xA7, 0x50, 0xD8, 0x6C, 0x36, 0x1B, 0x0D, 0x86, 0xC3,
+    0x61, 0xB0, 0xD8, 0x1D, 0xE7, 0x13, 0x89, 0xDE, 0x0C, 0x4C, 0x4C, 0x5E, 0x7F, 0x51, 0x89, 0x89,
+    0x88, 0xAE, 0x0F, 0x2C, 0x1C, 0x70, 0x71, 0xC1, 0xDF, 0x80, 0xF7, 0x11, 0x82, 0x30, 0x77, 0x60,
+    0xFE, 0x80, 0x02, 0xA4, 0x00, 0x1A, 0x7C, 0x7A, 0x16, 0x24, 0x92, 0x4B, 0x34, 0xCC, 0xF8, 0x1A,
+    0x9A, 0xE0, 0xD7, 0x06, 0xBF, 0x1E, 0x88, 0x20, 0xD7, 0xE3, 0xD1, 0x00, 0x01, 0x40, 0x05, 0x17,
+    0xA1, 0xD0, 0x15, 0x20, 0xD7, 0x00, 0xF8, 0x11, 0x82, 0x30, 0x46, 0x0F, 0x80, 0x02, 0xF6, 0x3E,
+    0x83, 0x62, 0xF6, 0x3E, 0x83, 0x60, 0x15, 0x22, 0x5A, 0xFA, 0x4A, 0x9F, 0x31, 0x45, 0xF0, 0x4F,
+    0x7B, 0xBF, 0xB9, 0x1D, 0xA7, 0xDC, 0x58, 0x15, 0x22, 0x5A, 0xFE, 0xA2, 0x0D, 0x87, 0x42, 0xE7,
+    0x3C, 0x95, 0xFF, 0x54, 0x7E, 0xD3, 0xF6, 0x9F, 0xB0, 0xF7, 0x11, 0x82, 0x31, 0x77, 0x7A, 0x5F,
+    0xD3, 0xAC, 0xD8, 0x74, 0x2E, 0x4F, 0x7B, 0xBF, 0xB9, 0x1D, 0xA7, 0xDC, 0x58, 0x0F, 0x32, 0xB8,
+    0x22, 0x93, 0xD3, 0x42, 0x85, 0x0C, 0x1A, 0x00, 0x0E, 0x66, 0xF5, 0xFA, 0x5F, 0xCB, 0x63, 0x76,
+    0xC7, 0x8E, 0xC5, 0xFA, 0x4D, 0xE7, 0x30, 0x0E, 0x66, 0xF5, 0xFA, 0x5E, 0x3B, 0x1B, 0xB6, 0x3F,
+    0x96, 0xC5, 0xFA, 0x4D, 0xE7, 0x30, 0x0E, 0x66, 0xF5, 0xFA, 0x5F, 0x66, 0xC6, 0xDD, 0x8F, 0xE5,
+    0xB1, 0xFC, 0xFA, 0x4D, 0xE7, 0x30, 0x0E, 0x66, 0xF5, 0xFA, 0x5F, 0x66, 0xC6, 0xDD, 0x8F, 0xB3,
+    0x63, 0xEF, 0xE9, 0x37, 0x9C, 0xC0, 0x0E, 0x66, 0xF5, 0xFA, 0x5F, 0x66, 0xC4, 0x6C, 0x7D, 0x9B,
+    0x17, 0xE9, 0x37, 0x9C, 0xC0, 0x0E, 0x66, 0xF5, 0xFA, 0x5F, 0x76, 0xC6, 0xED, 0x8F, 0xBB, 0x62,
+    0xFD, 0x26, 0xF3, 0x98, 0x73, 0x3A, 0xCF, 0x42, 0xFF, 0x23, 0x9E, 0xC7, 0x5E, 0xC4, 0x6C, 0x46,
+    0xC6, 0xB9, 0xA3, 0x14, 0x62, 0x8C, 0x51, 0x8A, 0x31, 0x46, 0x20, 0x1A, 0x75, 0x2D, 0x55, 0x6C,
+    0x89, 0x44, 0xD2, 0x34, 0xA4, 0x4F, 0x44, 0x4A, 0xB6, 0x5A, 0xA0, 0x1A, 0xE6, 0x8C, 0x51, 0x8A,
+    0x31, 0x6D, 0xC5, 0xBB, 0x14, 0x62, 0x8C, 0x51, 0x20, 0x1A, 0xE6, 0x8C, 0x51, 0x8A, 0x31, 0x6E,
+    0xC5, 0xB7, 0x14, 0x62, 0x8C, 0x51, 0x20, 0x1A, 0xE6, 0x8C, 0x51, 0x8B, 0x76, 0x2D, 0xB8, 0xB6,
+    0xE2, 0xDD, 0x8A, 0x31, 0x44, 0x80, 0x1A, 0xE6, 0x8C, 0x51, 0x8B, 0x76, 0x28, 0xC5, 0xBB, 0x14,
+    0x62, 0x8C, 0x51, 0x20, 0xC0, 0xFC, 0xB3, 0x1F, 0x96, 0x6C, 0x00, 0xA1, 0xFF, 0xD9, 0xB0, 0x28,
+    0xA1, 0xAE, 0x6A, 0x00, 0x51, 0xAE, 0x68, 0xF0, 0x47, 0x82, 0x3C, 0x11, 0xE0, 0x89, 0x44, 0xAB,
+    0x65, 0xAA, 0xD3, 0xA8, 0x1A, 0xE6, 0xA9, 0xCC, 0xFE, 0x66, 0x1D, 0x0A, 0x6C, 0x61, 0xD6, 0x59,
+    0xAE, 0x60, 0x1A, 0x75, 0x2D, 0x55, 0x6C, 0x89, 0x6D, 0x96, 0xE9, 0x44, 0xAB, 0x65, 0xAA, 0xD3,
+    0xA8, 0x1A, 0x75, 0x2D, 0x55, 0x6C, 0x89, 0x6E, 0x96, 0xD9, 0x44, 0xAB, 0x65, 0xAA, 0xD3, 0xA8,
+    0x1A, 0x75, 0x2D, 0x55, 0x6C, 0xDD, 0x2D, 0xB2, 0xDB, 0x2D, 0xD2, 0xAD, 0x96, 0xAB, 0x4E, 0xA0,
+    0x1A, 0x75, 0x2D, 0x55, 0x6C, 0xDD, 0x2D, 0xB2, 0xDD, 0x2D, 0xB2, 0xAD, 0x96, 0xAB, 0x4E, 0xA0,
+    0x1A, 0x75, 0x2D, 0x55, 0x6C, 0x89, 0x6E, 0x94, 0x4B, 0x74, 0xAB, 0x65, 0xAA, 0xD3, 0xA8, 0x13,
+    0x55, 0xE0, 0xF9, 0x0E, 0x93, 0xE4, 0x5E, 0x13, 0x50, 0x1A, 0x7D, 0x4B, 0x77, 0xAB, 0xDE, 0x8F,
+    0xD8, 0x8F, 0x04, 0x62, 0xF7, 0xCB, 0xBE, 0xCE, 0xFA, 0xBD, 0xFD, 0x40, 0x1A, 0xF0, 0x2C, 0x4B,
+    0x09, 0x52, 0x49, 0x24, 0xB3, 0x5E, 0x00, 0x1A, 0xF0, 0x2C, 0x49, 0x2A, 0x4B, 0x09, 0x24, 0xB3,
+    0x5E, 0x00, 0x1A, 0xF0, 0x2C, 0x4A, 0x92, 0xC2, 0x58, 0x4A, 0x92, 0x59, 0xAF, 0x00, 0x1A, 0xF0,
+    0x2C, 0x4A, 0x92, 0x4A, 0x92, 0x49, 0x66, 0xBC, 0x00, 0x83, 0xBC, 0x92, 0xF8, 0x29, 0xF7, 0x3E,
+    0xFC, 0x12, 0x77, 0x90, 0x1A, 0xE6, 0xB5, 0x56, 0xAA, 0xD5, 0x5A, 0xAB, 0x55, 0x6A, 0xA6, 0x17,
+    0xE9, 0x1E, 0x79, 0xAA, 0x45, 0x9E, 0x5E, 0xD7, 0x8F, 0x81, 0x91, 0xEA, 0x0F, 0x5A, 0xF9, 0x27,
+    0x27, 0x1C, 0x9C, 0xBC, 0x13, 0xD8, 0xBE, 0x60, 0x0F, 0x5A, 0xF9, 0x27, 0x27, 0x2C, 0x9C, 0x7C,
+    0x13, 0xD8, 0xBE, 0x60, 0x0F, 0x5A, 0xF9, 0x39, 0x64, 0xE3, 0x93, 0x8F, 0x83, 0x97, 0x62, 0xF9,
+    0x80, 0x0F, 0x5A, 0xF9, 0x39, 0x64, 0xE3, 0x93, 0x97, 0x83, 0x8F, 0x62, 0xF9, 0x80, 0x0F, 0x5A,
+    0xF9, 0x39, 0x64, 0x9C, 0x9C, 0xBC, 0x13, 0xD8, 0xBE, 0x60, 0x0F, 0x5A, 0xF9, 0x3F, 0x76, 0x4F,
+    0xF4, 0xC9, 0xFB, 0xBC, 0x13, 0xD8, 0xBE, 0x60, 0x0F, 0x5A, 0xF9, 0x27, 0x24, 0xE4, 0x9F, 0x04,
+    0xF6, 0x2F, 0xEC, 0x5F, 0xB5, 0x39, 0x27, 0x24, 0xE4, 0xBF, 0x69, 0xF3, 0x80, 0x0E, 0x0B, 0xD9,
+    0x33, 0x49, 0xD2, 0x93, 0x3D, 0x17, 0xB0, 0x0E, 0x0B, 0xF6, 0xB8, 0xE4, 0xE5, 0x92, 0x72, 0x5F,
+    0xB4, 0xF9, 0xC0, 0x0E, 0x0B, 0xF6, 0xA7, 0x27, 0x2C, 0x9C, 0x72, 0x5F, 0xB4, 0xF9, 0xC0, 0x0E,
+    0x0B, 0xF6, 0xB9, 0x64, 0xE3, 0x93, 0x8E, 0x4F, 0x77, 0x69, 0xF3, 0x80, 0x0E, 0x0B, 0xF6, 0xB9,
+    0x64, 0x9C, 0x9C, 0xB2, 0x5F, 0xB4, 0xF9, 0xC0, 0x83, 0xF1, 0xCC, 0x1F, 0x8E, 0x68, 0xA9, 0xEF,
+    0xCD, 0x05, 0x40, 0xA9, 0xA6, 0x6A, 0x80, 0x0E, 0x0F, 0xFB, 0xB3, 0xF8, 0xCB, 0xEB, 0x97, 0x8C,
+    0xBF, 0xAD, 0x8E, 0x00, 0x1A, 0x66, 0xF7, 0x1C, 0x4E, 0x47, 0x12, 0xF9, 0x80, 0x0E, 0x0B, 0xD9,
+    0xC6, 0x5C, 0xA5, 0x32, 0xBD, 0x8E, 0x00, 0x0E, 0x0B, 0xD9, 0x32, 0xE5, 0x2E, 0x32, 0xBD, 0x8E,
+    0x00, 0x0E, 0x0B, 0xD9, 0xCA, 0x5C, 0x65, 0xC6, 0x5E, 0xEB, 0x1C, 0x00, 0x0E, 0x0B, 0xD9, 0xCA,
+    0x5C, 0x65, 0xCA, 0x5E, 0x56, 0x38, 0x00, 0x0E, 0x0B, 0xD9, 0xCA, 0x53, 0x2E, 0x52, 0xBD, 0x8E,
+    0x00, 0x0A, 0x14, 0x28, 0xBE, 0xE2, 0x85, 0x0A, 0x00, 0x0F, 0xDE, 0xBF, 0x7A, 0x78, 0xA7, 0x24,
+    0xF8, 0x2F, 0xE9, 0x4F, 0x00, 0x1A, 0x7B, 0x09, 0x44, 0xAB, 0x25, 0x9A, 0x66, 0x1A, 0x7B, 0x09,
+    0x25, 0x59, 0x45, 0x9A, 0x66, 0x1A, 0x7B, 0x15, 0x94, 0x4A, 0x25, 0x5B, 0x34, 0xCC, 0x1F, 0x8F,
+    0xB0, 0x95, 0x64, 0x92, 0xCD, 0x33, 0xD3, 0x03, 0xD1, 0x47, 0xAA, 0x95, 0xF3, 0xC2, 0x3D, 0x47,
+    0x4B, 0x40, 0x1A, 0xFC, 0x7A, 0x2F, 0x64, 0xCA, 0x65, 0x32, 0xBD, 0x8E, 0x00, 0xD3, 0x03, 0xD1,
+    0x4A, 0xFA, 0xA8, 0xF3, 0xC2, 0xBE, 0xA3, 0xA5, 0xA0,
+};
+const uint8_t ArialMT_Plain_16_CS_huffman[] PROGMEM = {
+    0x01, 0x00, 0x00, 0x02, 0x04, 0x06, 0x08, 0x0C, 0x0A, 0x0F, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x40, 0x02, 0x10, 0x20, 0x80, 0x01, 0x41, 0x44, 0x7F, 0xC0, 0xF8, 0x04, 0x09, 0x0A,
+    0x1C, 0x1F, 0x48, 0x50, 0x60, 0x03, 0x07, 0x0F, 0x18, 0x22, 0x24, 0x28, 0x30, 0x42, 0x70, 0x88,
+    0xE0, 0x06, 0x21, 0x38, 0x39, 0x3F, 0x43, 0x90, 0xC8, 0xF0, 0xFF, 0x05, 0x0B, 0x0C, 0x17, 0x1B,
+    0x1E, 0x4F, 0x58, 0x72, 0x78, 0x7E, 0x81, 0xB8, 0xD0, 0xFA, 0x11, 0x12, 0x1A, 0x23, 0x31, 0x3C,
+    0x4C, 0x52, 0x5C, 0x5F, 0x61, 0x68, 0x71, 0x82, 0xD8, 0xE8, 0xFB, 0x0E, 0x19, 0x2F, 0x45, 0x47,
+    0x4E, 0x54, 0x62, 0x69, 0x7C, 0x86, 0x8A, 0x8F, 0xA0, 0xD2, 0xF1, 0xF9, 0xFC,
+};
+const CompressedFont ArialMT_Plain_16_CS = {ArialMT_Plain_16_CS_header, ArialMT_Plain_16_CS_data, ArialMT_Plain_16_CS_huffman};
+
+const uint8_t ArialMT_Plain_24_CS_header[] PROGMEM = {
+    0x18, 0x1C, 0x20, 0xE0, 0xFF, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x13, 0x06, 0x00, 0x07, 0x1A, 0x08,
+    0x00, 0x0F, 0x33, 0x0E, 0x00, 0x2B, 0x2F, 0x0D, 0x00, 0x45, 0x4F, 0x15, 0x00, 0x6C, 0x3B, 0x10,
+    0x00, 0x8C, 0x0A, 0x04, 0x00, 0x90, 0x1C, 0x08, 0x00, 0x9F, 0x1B, 0x08, 0x00, 0xAE, 0x21, 0x0A,
+    0x00, 0xBC, 0x32, 0x0E, 0x00, 0xCA, 0x10, 0x05, 0x00, 0xCF, 0x1B, 0x08, 0x00, 0xDB, 0x0F, 0x05,
+    0x00, 0xDE, 0x19, 0x08, 0x00, 0xE8, 0x2F, 0x0D, 0x00, 0xFD, 0x23, 0x0A, 0x01, 0x08, 0x2F, 0x0D,
+    0x01, 0x1F, 0x2F, 0x0D, 0x01, 0x36, 0x2F, 0x0D, 0x01, 0x4B, 0x2F, 0x0D, 0x01, 0x63, 0x2F, 0x0D,
+    0x01, 0x7D, 0x2D, 0x0D, 0x01, 0x8F, 0x2F, 0x0D, 0x01, 0xA9, 0x2F, 0x0D, 0x01, 0xC2, 0x0F, 0x05,
+    0x01, 0xC6, 0x10, 0x05, 0x01, 0xCC, 0x2F, 0x0D, 0x01, 0xE0, 0x2F, 0x0D, 0x01, 0xF5, 0x2E, 0x0D,
+    0x02, 0x08, 0x2E, 0x0D, 0x02, 0x1B, 0x5B, 0x18, 0x02, 0x58, 0x3B, 0x10, 0x02, 0x74, 0x3B, 0x10,
+    0x02, 0x90, 0x3F, 0x11, 0x02, 0xAB, 0x3F, 0x11, 0x02, 0xC4, 0x3B, 0x10, 0x02, 0xDD, 0x35, 0x0F,
+    0x02, 0xF0, 0x43, 0x12, 0x03, 0x11, 0x3B, 0x10, 0x03, 0x23, 0x0F, 0x05, 0x03, 0x29, 0x27, 0x0B,
+    0x03, 0x36, 0x3F, 0x11, 0x03, 0x50, 0x2F, 0x0D, 0x03, 0x5D, 0x43, 0x12, 0x03, 0x76, 0x3B, 0x10,
+    0x03, 0x8D, 0x47, 0x13, 0x03, 0xAB, 0x3A, 0x10, 0x03, 0xC1, 0x47, 0x13, 0x03, 0xE3, 0x3F, 0x11,
+    0x04, 0x00, 0x3B, 0x10, 0x04, 0x1E, 0x35, 0x0F, 0x04, 0x2F, 0x3B, 0x10, 0x04, 0x42, 0x39, 0x10,
+    0x04, 0x58, 0x59, 0x18, 0x04, 0x7B, 0x3B, 0x10, 0x04, 0x98, 0x3D, 0x11, 0x04, 0xAF, 0x37, 0x0F,
+    0x04, 0xCA, 0x14, 0x06, 0x04, 0xD4, 0x1B, 0x08, 0x04, 0xDE, 0x18, 0x07, 0x04, 0xE8, 0x2A, 0x0C,
+    0x04, 0xF5, 0x34, 0x0E, 0x05, 0x02, 0x11, 0x06, 0x05, 0x07, 0x2F, 0x0D, 0x05, 0x1E, 0x33, 0x0E,
+    0x05, 0x33, 0x2B, 0x0C, 0x05, 0x45, 0x2F, 0x0D, 0x05, 0x59, 0x2F, 0x0D, 0x05, 0x6F, 0x1A, 0x08,
+    0x05, 0x7A, 0x2F, 0x0D, 0x05, 0x94, 0x2F, 0x0D, 0x05, 0xA4, 0x0F, 0x05, 0x05, 0xAA, 0x10, 0x05,
+    0x05, 0xB2, 0x2F, 0x0D, 0x05, 0xC5, 0x0F, 0x05, 0x05, 0xCB, 0x47, 0x13, 0x05, 0xE4, 0x2F, 0x0D,
+    0x05, 0xF3, 0x2F, 0x0D, 0x06, 0x07, 0x33, 0x0E, 0x06, 0x1C, 0x30, 0x0D, 0x06, 0x31, 0x1E, 0x09,
+    0x06, 0x3A, 0x2B, 0x0C, 0x06, 0x51, 0x1B, 0x08, 0x06, 0x5C, 0x2F, 0x0D, 0x06, 0x6B, 0x2A, 0x0C,
+    0x06, 0x79, 0x42, 0x12, 0x06, 0x94, 0x2B, 0x0C, 0x06, 0xA9, 0x2A, 0x0C, 0x06, 0xBB, 0x2B, 0x0C,
+    0x06, 0xCE, 0x1C, 0x08, 0x06, 0xDC, 0x10, 0x05, 0x06, 0xE3, 0x1B, 0x08, 0x06, 0xF1, 0x32, 0x0E,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0x06, 0xFE, 0x3F, 0x11, 0x07, 0x1C, 0x3F, 0x11,
+    0x07, 0x38, 0x3B, 0x10, 0x07, 0x53, 0x3B, 0x10, 0x07, 0x6E, 0x3F, 0x11, 0x07, 0x8D, 0x3B, 0x10,
+    0x07, 0xAE, 0x35, 0x0F, 0x07, 0xC2, 0x3B, 0x10, 0x07, 0xDB, 0x37, 0x0F, 0x07, 0xF8, 0x2B, 0x0C,
+    0x08, 0x0D, 0x3A, 0x10, 0x08, 0x25, 0x2F, 0x0D, 0x08, 0x3F, 0x2F, 0x0D, 0x08, 0x52, 0x1E, 0x09,
+    0x08, 0x5F, 0x2B, 0x0C, 0x08, 0x79, 0x26, 0x0B, 0x08, 0x88, 0x2F, 0x0D, 0x08, 0x9D, 0x2B, 0x0C,
+    0x08, 0xB4, 0x2F, 0x0D, 0x08, 0xC4, 0x15, 0x07, 0x08, 0xCE, 0x2F, 0x0D, 0x08, 0xDD, 0x1A, 0x08,
+    0x08, 0xE6, 0x3F, 0x11, 0x09, 0x05, 0x1E, 0x09, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0x09, 0x10, 0x14, 0x06, 0x09, 0x17, 0x2B, 0x0C,
+    0x09, 0x2D, 0x2F, 0x0D, 0x09, 0x46, 0x33, 0x0E, 0x09, 0x5E, 0x31, 0x0E, 0x09, 0x7B, 0x10, 0x05,
+    0x09, 0x83, 0x2F, 0x0D, 0x09, 0xA5, 0x19, 0x08, 0x09, 0xAB, 0x46, 0x13, 0x09, 0xD7, 0x1A, 0x08,
+    0x09, 0xE3, 0x27, 0x0B, 0x09, 0xF6, 0x2F, 0x0D, 0x0A, 0x05, 0x1B, 0x08, 0x0A, 0x11, 0x46, 0x13,
+    0x0A, 0x38, 0x31, 0x0E, 0x0A, 0x47, 0x1E, 0x09, 0x0A, 0x57, 0x33, 0x0E, 0x0A, 0x69, 0x1A, 0x08,
+    0x0A, 0x79, 0x1A, 0x08, 0x0A, 0x89, 0x19, 0x08, 0x0A, 0x8F, 0x2F, 0x0D, 0x0A, 0x9F, 0x31, 0x0E,
+    0x0A, 0xB7, 0x12, 0x06, 0x0A, 0xBB, 0x18, 0x07, 0x0A, 0xC4, 0x16, 0x07, 0x0A, 0xCC, 0x1E, 0x09,
+    0x0A, 0xD8, 0x2E, 0x0D, 0x0A, 0xEC, 0x4F, 0x15, 0x0B, 0x0D, 0x4B, 0x14, 0x0B, 0x31, 0x4B, 0x14,
+    0x0B, 0x5A, 0x33, 0x0E, 0x0B, 0x6E, 0x3B, 0x10, 0x0B, 0x8D, 0x3B, 0x10, 0x0B, 0xAC, 0x3B, 0x10,
+    0x0B, 0xCB, 0x3B, 0x10, 0x0B, 0xEB, 0x3B, 0x10, 0x0C, 0x09, 0x3B, 0x10, 0x0C, 0x28, 0x5B, 0x18,
+    0x0C, 0x52, 0x3F, 0x11, 0x0C, 0x72, 0x3B, 0x10, 0x0C, 0x8D, 0x3B, 0x10, 0x0C, 0xA8, 0x3B, 0x10,
+    0x0C, 0xC4, 0x3B, 0x10, 0x0C, 0xDF, 0x11, 0x06, 0x0C, 0xE8, 0x11, 0x06, 0x0C, 0xF1, 0x15, 0x07,
+    0x0C, 0xFC, 0x15, 0x07, 0x0D, 0x05, 0x3F, 0x11, 0x0D, 0x21, 0x3B, 0x10, 0x0D, 0x3D, 0x47, 0x13,
+    0x0D, 0x5E, 0x47, 0x13, 0x0D, 0x7F, 0x47, 0x13, 0x0D, 0xA1, 0x47, 0x13, 0x0D, 0xC4, 0x47, 0x13,
+    0x0D, 0xE5, 0x2B, 0x0C, 0x0D, 0xF6, 0x47, 0x13, 0x0E, 0x1F, 0x3B, 0x10, 0x0E, 0x35, 0x3B, 0x10,
+    0x0E, 0x4B, 0x3B, 0x10, 0x0E, 0x62, 0x3B, 0x10, 0x0E, 0x78, 0x3D, 0x11, 0x0E, 0x92, 0x3A, 0x10,
+    0x0E, 0xAA, 0x37, 0x0F, 0x0E, 0xC3, 0x2F, 0x0D, 0x0E, 0xDD, 0x2F, 0x0D, 0x0E, 0xF7, 0x2F, 0x0D,
+    0x0F, 0x11, 0x2F, 0x0D, 0x0F, 0x2C, 0x2F, 0x0D, 0x0F, 0x45, 0x2F, 0x0D, 0x0F, 0x62, 0x53, 0x16,
+    0x0F, 0x8C, 0x2B, 0x0C, 0x0F, 0xA3, 0x2F, 0x0D, 0x0F, 0xBC, 0x2F, 0x0D, 0x0F, 0xD5, 0x2F, 0x0D,
+    0x0F, 0xEE, 0x2F, 0x0D, 0x10, 0x06, 0x11, 0x06, 0x10, 0x0E, 0x11, 0x06, 0x10, 0x16, 0x15, 0x07,
+    0x10, 0x1F, 0x15, 0x07, 0x10, 0x27, 0x2F, 0x0D, 0x10, 0x40, 0x2F, 0x0D, 0x10, 0x53, 0x2F, 0x0D,
+    0x10, 0x69, 0x2F, 0x0D, 0x10, 0x7F, 0x2F, 0x0D, 0x10, 0x96, 0x2F, 0x0D, 0x10, 0xAE, 0x2F, 0x0D,
+    0x10, 0xC4, 0x32, 0x0E, 0x10, 0xD2, 0x33, 0x0E, 0x10, 0xEB, 0x2F, 0x0D, 0x10, 0xFC, 0x2F, 0x0D,
+    0x11, 0x0D, 0x2F, 0x0D, 0x11, 0x1F, 0x2F, 0x0D, 0x11, 0x30, 0x2A, 0x0C, 0x11, 0x44, 0x2F, 0x0D,
+    0x11, 0x58, 0x2A, 0x0C,
+};
+const uint8_t ArialMT_Plain_24_CS_data[] PROGMEM = {
+    0x00, 0x0B, 0x6F, 0xE9, 0x5B, 0x7F, 0x48, 0x0B, 0x5E, 0x5A, 0xF0, 0x02, 0xD7, 0x96, 0xBC, 0x61,
+    0x71, 0x87, 0xA4, 0xC3, 0x53, 0xC7, 0x16, 0xDB, 0xDC, 0xB6, 0x37, 0x29, 0x87, 0xA4, 0xC3, 0x53,
+    0xC7, 0x16, 0xDB, 0xDC, 0xB6, 0x37, 0x29, 0x85, 0xC6, 0x17, 0x00, 0x0D, 0xAF, 0x9A, 0xB8, 0xF9,
+    0xD5, 0xCB, 0x35, 0x32, 0xD1, 0x48, 0x87, 0x3D, 0xF7, 0x52, 0x21, 0x4A, 0x68, 0xAD, 0x32, 0x57,
+    0xF4, 0x71, 0x3F, 0xF3, 0x78, 0x0D, 0xB1, 0x2B, 0xC4, 0xA4, 0x1C, 0xB9, 0x1C, 0xB9, 0x72, 0x52,
+    0x34, 0x57, 0x8F, 0x9D, 0xB7, 0xBF, 0x12, 0xB7, 0x1C, 0xC7, 0x60, 0xF7, 0xE2, 0xAF, 0xE9, 0xE2,
+    0xB5, 0x21, 0xCB, 0x97, 0x23, 0x97, 0x22, 0x90, 0x57, 0x89, 0xB6, 0x20, 0x06, 0xD7, 0x95, 0xC5,
+    0xB7, 0xF9, 0xE6, 0xAF, 0xF5, 0xE8, 0xB7, 0x64, 0x29, 0xA4, 0x29, 0xF5, 0x42, 0xDF, 0x6E, 0x8A,
+    0xFB, 0xFE, 0xE3, 0x6B, 0xB8, 0x8C, 0x4A, 0xF1, 0x2B, 0xA0, 0xF9, 0x80, 0x0B, 0x5E, 0x5A, 0xF0,
+    0x07, 0x3C, 0x4E, 0xBF, 0x63, 0x6C, 0x79, 0xCA, 0xB2, 0xDA, 0xEA, 0x13, 0xE4, 0x79, 0x40, 0x0E,
+    0x47, 0x96, 0x84, 0xEB, 0x2D, 0xAE, 0xDB, 0x1E, 0x72, 0x75, 0xFB, 0x0E, 0x78, 0x80, 0x0D, 0x86,
+    0xDE, 0x53, 0x6C, 0x4B, 0x5C, 0x5A, 0xE3, 0x6C, 0x4D, 0xBC, 0xA6, 0xC0, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x06, 0xF8, 0x9B, 0xE2, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00, 0x22, 0xE3, 0x9C, 0x80, 0x6D,
+    0x23, 0x69, 0x1B, 0x48, 0xDA, 0x46, 0xD2, 0x36, 0x91, 0xB4, 0x80, 0x00, 0x20, 0x40, 0x20, 0x76,
+    0x96, 0xC4, 0xF1, 0x93, 0x6D, 0x4B, 0x5C, 0x50, 0x07, 0x5B, 0x9B, 0x6F, 0x8A, 0xB2, 0xCD, 0x66,
+    0x8A, 0x21, 0x44, 0x28, 0x85, 0x9A, 0x2B, 0x2C, 0xDB, 0x6F, 0x89, 0xD6, 0xE0, 0x00, 0x04, 0xC5,
+    0xE2, 0xE3, 0x69, 0x16, 0xDF, 0x55, 0xB7, 0xD4, 0x05, 0xD0, 0xAD, 0xDA, 0x2A, 0xEC, 0x51, 0xFC,
+    0xCA, 0x3D, 0x2A, 0x6D, 0xE8, 0x52, 0xB0, 0xA5, 0x21, 0x58, 0x85, 0x78, 0xC1, 0x8C, 0x00, 0x04,
+    0xA6, 0xAC, 0xB8, 0x2A, 0xCD, 0x44, 0x29, 0x10, 0xA4, 0x42, 0x91, 0x0A, 0xE9, 0x0A, 0xFF, 0x4E,
+    0x4D, 0xBF, 0x56, 0x26, 0xD7, 0x80, 0x06, 0xD7, 0x15, 0xB8, 0xE7, 0x71, 0xD9, 0x71, 0xC2, 0xE6,
+    0xD7, 0xDC, 0xAC, 0xAE, 0x5B, 0x7D, 0x56, 0xDF, 0x51, 0x70, 0xB8, 0x04, 0x4D, 0xB6, 0xBC, 0x16,
+    0xE3, 0x92, 0x9E, 0x68, 0x53, 0x08, 0x53, 0x08, 0x53, 0x08, 0x53, 0x08, 0x53, 0x2C, 0xD4, 0xE7,
+    0x89, 0x6B, 0x80, 0x07, 0x8D, 0xCD, 0xB7, 0xC5, 0x5F, 0xFB, 0xE6, 0xAC, 0x68, 0xA6, 0x50, 0xA6,
+    0x50, 0xA6, 0x50, 0xA6, 0x50, 0xB4, 0x64, 0xAF, 0xFA, 0xE2, 0xDB, 0xF4, 0x5E, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x3B, 0x14, 0xDB, 0x55, 0x2D, 0x72, 0x9F, 0x51, 0x4E, 0x05, 0x2E, 0x2D, 0x22, 0x80, 0x06,
+    0xD7, 0xB6, 0xFD, 0x5C, 0x55, 0xFE, 0x9C, 0x96, 0xD2, 0x14, 0x88, 0x52, 0x21, 0x48, 0x85, 0xB4,
+    0x85, 0x7F, 0xA7, 0x26, 0xDF, 0xAB, 0x89, 0xB5, 0xE0, 0x07, 0x1C, 0x1B, 0x7D, 0x99, 0xAB, 0xF8,
+    0x74, 0x52, 0xB0, 0xA5, 0x61, 0x4A, 0xC2, 0x95, 0x85, 0x29, 0x92, 0xBE, 0x8F, 0x3B, 0x6D, 0xF1,
+    0x3A, 0xC8, 0x00, 0x4E, 0x09, 0xC0, 0x00, 0x4E, 0x2E, 0x4F, 0x9C, 0x80, 0x07, 0x21, 0xEC, 0x1F,
+    0xD0, 0x3F, 0x60, 0xFD, 0x83, 0xBE, 0x47, 0x7C, 0x8F, 0x2C, 0x89, 0xDC, 0x4E, 0xE2, 0xE9, 0x80,
+    0x07, 0x7C, 0x8E, 0xF9, 0x1D, 0xF2, 0x3B, 0xE4, 0x77, 0xC8, 0xEF, 0x91, 0xDF, 0x23, 0xBE, 0x47,
+    0x7C, 0x8E, 0xF9, 0x1D, 0xF2, 0x05, 0xD3, 0x27, 0x71, 0x3B, 0x8F, 0x2C, 0x8E, 0xF9, 0x1D, 0xF2,
+    0x3F, 0x60, 0xFD, 0x83, 0xFA, 0x07, 0xB0, 0x72, 0x05, 0xC6, 0xD7, 0x15, 0x91, 0x61, 0x4D, 0xBD,
+    0x2A, 0x57, 0xD2, 0xA5, 0x8A, 0x41, 0x5D, 0x0A, 0xF1, 0x17, 0x80, 0x05, 0xB1, 0x3A, 0x6A, 0x79,
+    0xF9, 0x97, 0xD6, 0x5B, 0x7E, 0x9F, 0xEE, 0x95, 0x7F, 0xD7, 0xFF, 0x97, 0x57, 0x4C, 0xAE, 0xAE,
+    0x11, 0x75, 0x38, 0x44, 0xE9, 0x38, 0x9D, 0x27, 0x94, 0xE9, 0x3C, 0x27, 0x4C, 0x3C, 0xF3, 0xA7,
+    0x4D, 0x67, 0x6E, 0xBE, 0x89, 0xD7, 0x84, 0x4E, 0xB2, 0xCA, 0xED, 0xAE, 0xCE, 0xE5, 0xFE, 0xF9,
+    0x3A, 0xFF, 0x74, 0x9D, 0x3F, 0x40, 0xFC, 0x00, 0x20, 0x76, 0x9B, 0x62, 0x73, 0xB8, 0xEB, 0x26,
+    0xDE, 0xF9, 0x2D, 0xED, 0x92, 0x9B, 0x49, 0x6F, 0x6C, 0x9B, 0x7B, 0xE4, 0x75, 0x91, 0xCE, 0xE3,
+    0x6C, 0x47, 0x68, 0x80, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x44, 0x29, 0x10, 0xA4, 0x42, 0x91,
+    0x0A, 0x44, 0x29, 0x10, 0xA4, 0x42, 0xBF, 0x54, 0x2B, 0xBE, 0x4D, 0xBF, 0x57, 0x13, 0x6B, 0xC0,
+    0x07, 0x8C, 0x8D, 0xEF, 0x6D, 0x7E, 0x2A, 0xCB, 0x35, 0x59, 0x28, 0x85, 0x10, 0xA2, 0x14, 0x42,
+    0x88, 0x51, 0x0A, 0xB2, 0x56, 0x59, 0xB6, 0xBB, 0x13, 0xC9, 0x70, 0x00, 0xB6, 0xFA, 0xAD, 0xBE,
+    0xAA, 0x21, 0x44, 0x28, 0x85, 0x10, 0xA2, 0x14, 0x42, 0x88, 0x59, 0x92, 0xB2, 0xCD, 0xB5, 0xDC,
+    0x0D, 0xEF, 0x3C, 0x64, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x44, 0x29, 0x10, 0xA4, 0x42, 0x91,
+    0x0A, 0x44, 0x29, 0x10, 0xA4, 0x42, 0x91, 0x0A, 0x44, 0x29, 0x10, 0xA2, 0x00, 0x00, 0xB6, 0xFA,
+    0xAD, 0xBE, 0xAA, 0x41, 0x48, 0x29, 0x05, 0x20, 0xA4, 0x14, 0x82, 0x90, 0x52, 0x0A, 0x41, 0x40,
+    0x07, 0x8C, 0x8D, 0xEF, 0x6D, 0x7E, 0x2A, 0xCB, 0x35, 0x59, 0x2C, 0xC9, 0x44, 0x28, 0x85, 0x10,
+    0xA5, 0x21, 0x4A, 0x42, 0xD4, 0xD1, 0x5A, 0x64, 0xAF, 0xE1, 0xC9, 0xB7, 0xF9, 0xE2, 0x7E, 0xDC,
+    0x40, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA4, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x16, 0xDF,
+    0x55, 0xB7, 0xD4, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA0, 0x03, 0x80, 0xF3, 0x8D, 0x04, 0x08, 0x10,
+    0x34, 0x5B, 0x7E, 0x2B, 0x6F, 0x88, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA5, 0x87, 0xB0, 0x68, 0x3F,
+    0x18, 0xEA, 0x3F, 0xD2, 0x4D, 0xBD, 0xB7, 0xAB, 0x2C, 0x56, 0x79, 0xD4, 0x68, 0xE4, 0x81, 0xC8,
+    0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA2, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x00, 0x00, 0xB6, 0xFA,
+    0xAD, 0xBE, 0xAB, 0x48, 0xAE, 0x23, 0xA8, 0xB5, 0xE3, 0x51, 0x03, 0x52, 0xD7, 0x9D, 0x4A, 0xE2,
+    0x5A, 0x45, 0xB7, 0xD5, 0x6D, 0xF5, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0xC8, 0xDA, 0xE1, 0xC0,
+    0x76, 0x0F, 0x60, 0xB4, 0x8D, 0xAE, 0x18, 0x8C, 0xD6, 0xDF, 0x55, 0xB7, 0xD4, 0x07, 0x8C, 0x8D,
+    0xEF, 0x6D, 0x7E, 0x2A, 0xCB, 0x35, 0x59, 0x2C, 0xD1, 0x44, 0x28, 0x85, 0x10, 0xA2, 0x14, 0x42,
+    0xCD, 0x15, 0x64, 0xAC, 0xB3, 0x6D, 0x7E, 0x26, 0xF7, 0x9E, 0x32, 0x00, 0xB6, 0xFA, 0xAD, 0xBE,
+    0xAA, 0x50, 0xA5, 0x0A, 0x50, 0xA5, 0x0A, 0x50, 0xA5, 0x0A, 0x50, 0xA5, 0x0A, 0xC1, 0x5D, 0x46,
+    0x20, 0x07, 0x8C, 0x8D, 0xEF, 0x6D, 0x7E, 0x2A, 0xCB, 0x05, 0x59, 0x2C, 0xC9, 0x44, 0x28, 0x85,
+    0x10, 0xA3, 0xF9, 0x94, 0x7F, 0x32, 0xCE, 0xC5, 0x59, 0xAB, 0x2C, 0xDB, 0x5F, 0xA9, 0xBF, 0xF5,
+    0x9E, 0x3F, 0x84, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x41, 0x48, 0x29, 0x05, 0x20, 0xA7, 0xB0,
+    0xA7, 0x32, 0x9C, 0xEE, 0x53, 0xF3, 0xDE, 0xB6, 0x5C, 0x55, 0xE3, 0xD8, 0xDB, 0x18, 0x1C, 0x80,
+    0x02, 0xE2, 0xFC, 0x55, 0xE3, 0x9A, 0xB9, 0x64, 0xA6, 0x9A, 0x29, 0x10, 0xA4, 0x42, 0x91, 0x0A,
+    0x44, 0x29, 0xEC, 0x85, 0x69, 0x92, 0xBF, 0xE5, 0x93, 0x6F, 0xD3, 0x89, 0xED, 0xBC, 0xA0, 0xA0,
+    0xA0, 0xA0, 0xA0, 0xA0, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00,
+    0xB6, 0xF7, 0x2D, 0xBE, 0x23, 0x31, 0xA0, 0x81, 0x02, 0x04, 0x08, 0x1A, 0x0C, 0xD6, 0xDF, 0x15,
+    0xB7, 0xB8, 0xE4, 0x2D, 0x22, 0xB8, 0x8E, 0xD1, 0xD2, 0x45, 0x71, 0x1D, 0xA3, 0x41, 0xDA, 0x57,
+    0x13, 0xA4, 0x8E, 0xD2, 0xB8, 0x96, 0x91, 0xC8, 0xA0, 0xB5, 0xE6, 0xDB, 0x8E, 0x98, 0x9B, 0x6A,
+    0x20, 0x6A, 0x5B, 0x13, 0xC6, 0x4D, 0xB8, 0x96, 0xB8, 0xA0, 0xB5, 0xC6, 0xDC, 0x47, 0x8C, 0x8B,
+    0x62, 0x35, 0x10, 0x6D, 0xA9, 0xD3, 0x16, 0xDB, 0x96, 0xBC, 0xA0, 0x39, 0x39, 0x21, 0x47, 0x62,
+    0xD2, 0xF3, 0xAB, 0xED, 0xBC, 0xFF, 0x1B, 0x8E, 0xB2, 0x34, 0x1D, 0x64, 0x7F, 0x8D, 0xCA, 0xDD,
+    0x7A, 0xD2, 0xF3, 0xA8, 0xEC, 0x72, 0x40, 0xE4, 0xE4, 0x28, 0x2B, 0x23, 0x6B, 0x85, 0xE3, 0xCE,
+    0x3B, 0x07, 0x3D, 0x4E, 0x7A, 0x9D, 0x83, 0xCE, 0x2F, 0x2B, 0x71, 0x69, 0x14, 0x1C, 0x80, 0x21,
+    0x46, 0x8A, 0x3B, 0x14, 0x7D, 0xF5, 0x36, 0xF4, 0xA9, 0x5F, 0x42, 0x96, 0x85, 0x34, 0x85, 0x33,
+    0x85, 0x38, 0x42, 0x97, 0xC2, 0xD2, 0x85, 0x90, 0xA2, 0x00, 0x0B, 0x6F, 0xBD, 0xF6, 0xDF, 0x7B,
+    0xE8, 0x4E, 0x84, 0xC0, 0xA0, 0xB5, 0xC6, 0xDA, 0x8F, 0x19, 0x16, 0xC4, 0x76, 0x88, 0x00, 0xA1,
+    0x3A, 0x13, 0xB6, 0xFB, 0xDF, 0x6D, 0xF7, 0xBC, 0x07, 0x21, 0xA0, 0xE2, 0x56, 0xF2, 0xC2, 0xC2,
+    0xB7, 0x8E, 0x23, 0x41, 0xC8, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x0E, 0x42, 0x82, 0xC3, 0x60, 0x06, 0x5C, 0x0C, 0xF8, 0x9D, 0xFF, 0x39, 0xEE, 0xF4,
+    0x1E, 0xEF, 0x41, 0xE1, 0x07, 0x86, 0x47, 0xC3, 0x03, 0xC7, 0x89, 0xD3, 0x51, 0xC8, 0x00, 0xB6,
+    0xFA, 0xAD, 0xBE, 0xA6, 0x58, 0x18, 0x64, 0x4E, 0x09, 0xC1, 0x38, 0x38, 0x68, 0x67, 0x99, 0xD3,
+    0x12, 0xD7, 0x00, 0x07, 0x3B, 0xCE, 0x98, 0x99, 0xE6, 0x70, 0xD0, 0x9C, 0x13, 0x82, 0x70, 0x70,
+    0xD0, 0xCF, 0x33, 0x2C, 0x00, 0x05, 0xAE, 0x3A, 0x62, 0x67, 0x99, 0xC3, 0x42, 0x70, 0x4E, 0x09,
+    0xC1, 0x86, 0x46, 0x58, 0x2D, 0xBE, 0xAB, 0x6F, 0xA8, 0x05, 0xAF, 0x3A, 0x62, 0x7C, 0x73, 0x3E,
+    0x1A, 0x1E, 0x10, 0x78, 0x41, 0xE1, 0x07, 0xC3, 0x43, 0xE3, 0x91, 0xD3, 0x03, 0x9F, 0x94, 0x4C,
+    0x4C, 0xAE, 0xFA, 0xAD, 0xBE, 0xAA, 0x4C, 0xA4, 0xCA, 0x4C, 0x05, 0xBD, 0xB2, 0x74, 0xF7, 0xDC,
+    0xCF, 0x3B, 0xDC, 0x34, 0x9A, 0x71, 0x34, 0xE2, 0x69, 0xC4, 0xD8, 0x65, 0x7B, 0x2E, 0xFB, 0x9D,
+    0x77, 0x93, 0xAE, 0xE0, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA6, 0x43, 0x01, 0x31, 0x31, 0x31, 0xC0,
+    0x78, 0xEA, 0x74, 0xD4, 0x00, 0xA7, 0x5D, 0x54, 0xEB, 0xA8, 0x13, 0x13, 0xA7, 0x5D, 0xEF, 0xA7,
+    0x5D, 0xEE, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA5, 0x45, 0x87, 0x39, 0x1F, 0xFB, 0xBC, 0xC3, 0x81,
+    0x3E, 0xC3, 0xC9, 0x03, 0x90, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA0, 0x00, 0x75, 0xD4, 0xEB, 0xA9,
+    0x80, 0xF2, 0x89, 0x89, 0x8E, 0x03, 0xC7, 0x53, 0xA6, 0xA6, 0x03, 0xCA, 0x26, 0x26, 0x38, 0x0F,
+    0x1D, 0x4E, 0x9A, 0x80, 0x00, 0x75, 0xD4, 0xEB, 0xA9, 0x90, 0xC0, 0x4C, 0x4C, 0x4C, 0x70, 0x1E,
+    0x3A, 0x9D, 0x35, 0x07, 0x3B, 0xCE, 0x98, 0x99, 0xE6, 0x70, 0xD0, 0x9C, 0x13, 0x82, 0x70, 0x70,
+    0xD0, 0xCF, 0x33, 0xA6, 0x27, 0x3B, 0xC0, 0x00, 0x75, 0xDE, 0xF7, 0x5D, 0xEF, 0x65, 0x81, 0x86,
+    0x44, 0xE0, 0x9C, 0x13, 0x83, 0x86, 0x86, 0x79, 0x9D, 0x31, 0x2D, 0x70, 0x05, 0xAE, 0x3A, 0x62,
+    0x67, 0x99, 0xC3, 0x42, 0x70, 0x4E, 0x09, 0xC1, 0x86, 0x46, 0x58, 0x1D, 0x77, 0xBD, 0xD7, 0x7B,
+    0xC0, 0x00, 0x75, 0xD4, 0xEB, 0xA9, 0x80, 0x98, 0x98, 0x98, 0x06, 0x98, 0x1F, 0x8F, 0x33, 0xF7,
+    0xE8, 0x78, 0x41, 0xE1, 0x07, 0x87, 0xA0, 0xF0, 0xF4, 0x1F, 0x97, 0xE7, 0x3F, 0x37, 0x13, 0x2C,
+    0x40, 0x4C, 0x4C, 0xAE, 0xFC, 0x56, 0xDF, 0x52, 0x70, 0x4E, 0x09, 0xC0, 0x00, 0x75, 0xC4, 0xEB,
+    0xC4, 0x68, 0x20, 0x40, 0x81, 0x90, 0xC0, 0xEB, 0xA9, 0xD7, 0x50, 0x4C, 0x76, 0x8E, 0x82, 0xB7,
+    0x8E, 0x23, 0x41, 0xC4, 0xAD, 0xE7, 0x41, 0xDA, 0x26, 0x70, 0x1F, 0x58, 0xE7, 0x71, 0xB7, 0x11,
+    0xA1, 0xB7, 0x12, 0xD7, 0x1F, 0x8C, 0x70, 0x1F, 0x8C, 0x5A, 0xE3, 0x6E, 0x23, 0x43, 0x6E, 0x27,
+    0x3B, 0x8F, 0xAC, 0x70, 0x79, 0x39, 0x13, 0x83, 0xCF, 0xD8, 0x69, 0xC0, 0xE7, 0x79, 0x59, 0x16,
+    0xBC, 0xD3, 0x81, 0x9F, 0x61, 0xC2, 0x0F, 0x27, 0x20, 0x07, 0x01, 0xF5, 0xA6, 0xE7, 0x29, 0xB6,
+    0xC6, 0xF3, 0xAD, 0xC7, 0x89, 0x5E, 0x27, 0x4B, 0x8E, 0xD1, 0x30, 0x02, 0x09, 0xF6, 0x13, 0xED,
+    0x27, 0xF7, 0xCF, 0x0F, 0x49, 0xF2, 0x83, 0xFA, 0xA0, 0xED, 0x83, 0xCF, 0x04, 0xE0, 0x06, 0xD2,
+    0x2B, 0x72, 0xBF, 0x67, 0x5B, 0xAD, 0xAF, 0x8D, 0xF4, 0x27, 0x42, 0x60, 0x00, 0xB6, 0xFB, 0xE3,
+    0x6D, 0xF7, 0xC4, 0x0A, 0x13, 0xA1, 0x3B, 0x6B, 0xE3, 0x7D, 0x7E, 0xCD, 0xEE, 0x56, 0xE3, 0x69,
+    0x00, 0x05, 0x07, 0xB0, 0x40, 0x81, 0x02, 0x82, 0x82, 0xA2, 0xA2, 0xA2, 0xC2, 0x80, 0x07, 0x8C,
+    0x8D, 0xEF, 0x6D, 0x7E, 0x2A, 0xCB, 0x35, 0x59, 0x3D, 0x48, 0x77, 0x21, 0xEB, 0x43, 0xD6, 0x87,
+    0x72, 0x1E, 0xA4, 0x2A, 0xC9, 0x59, 0x66, 0xDA, 0xEC, 0x4F, 0x25, 0xC0, 0x00, 0xB6, 0xFA, 0xAD,
+    0xBE, 0xAA, 0x21, 0x44, 0x3D, 0x48, 0x77, 0x21, 0xEB, 0x43, 0xD6, 0x87, 0x72, 0x1F, 0xB5, 0x92,
+    0xB2, 0xCD, 0xB5, 0xDC, 0x0D, 0xEF, 0x3C, 0x64, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x44, 0x29,
+    0x10, 0xF5, 0x44, 0x3B, 0xA2, 0x1E, 0xB8, 0x87, 0xAE, 0x21, 0xDD, 0x10, 0xF5, 0x44, 0x29, 0x10,
+    0xA4, 0x42, 0x88, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0xC8, 0xDA, 0xE3, 0xC9, 0xC0, 0x9F, 0x61,
+    0x87, 0xB0, 0xC2, 0xD2, 0x4F, 0x6B, 0x9E, 0x46, 0x23, 0x35, 0xB7, 0xD5, 0x6D, 0xF5, 0x00, 0xB6,
+    0xFA, 0xAD, 0xBE, 0xAA, 0x41, 0x48, 0x3D, 0x50, 0x77, 0x41, 0xEB, 0xF6, 0x1E, 0xBE, 0x67, 0x77,
+    0x3B, 0x9E, 0xAF, 0xCF, 0x7A, 0xD9, 0x71, 0x57, 0x8F, 0x63, 0x6C, 0x60, 0x72, 0x02, 0xE2, 0xFC,
+    0x55, 0xE3, 0x9A, 0xB9, 0x64, 0xF5, 0x69, 0xA3, 0xBA, 0x21, 0xEB, 0x88, 0x7A, 0xE2, 0x1D, 0xD1,
+    0x0F, 0x57, 0xB2, 0x15, 0xA6, 0x4A, 0xFF, 0x96, 0x4D, 0xBF, 0x4E, 0x27, 0xB6, 0xF0, 0xA0, 0xA0,
+    0xA0, 0xA0, 0xF5, 0x0E, 0xE1, 0xF6, 0xEF, 0xAB, 0xED, 0xDF, 0x57, 0x70, 0xF5, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x00, 0x00, 0xB6, 0xF7, 0x2D, 0xBE, 0x23, 0x31, 0xA3, 0x82, 0x1F, 0x71, 0x0F, 0xF8, 0xA1,
+    0xF7, 0x10, 0xE0, 0x81, 0xA0, 0xCD, 0x6D, 0xF1, 0x5B, 0x7B, 0x80, 0x21, 0x46, 0x8A, 0x3B, 0x14,
+    0x7D, 0xF5, 0x36, 0xF4, 0xBD, 0x55, 0xF4, 0x3B, 0xAD, 0x0F, 0x5E, 0x90, 0xF5, 0xE7, 0x0E, 0xEE,
+    0x10, 0xF5, 0x5F, 0x0B, 0x4A, 0x16, 0x42, 0x88, 0x07, 0x3B, 0xCE, 0x98, 0x99, 0xE6, 0xE5, 0xC3,
+    0x45, 0x27, 0x0A, 0xCE, 0x15, 0x9C, 0x29, 0xC3, 0x47, 0x2C, 0xF3, 0x32, 0xC0, 0x05, 0xAE, 0x3A,
+    0x62, 0x67, 0x99, 0xC3, 0x42, 0x70, 0x4E, 0x09, 0xC1, 0x86, 0x46, 0x58, 0x2D, 0xBE, 0xAB, 0x6F,
+    0xA8, 0x29, 0x71, 0x69, 0x00, 0x05, 0xAF, 0x3A, 0x62, 0x7C, 0x73, 0x72, 0xF8, 0x68, 0xA7, 0x84,
+    0x2B, 0xE1, 0x0A, 0xF8, 0x42, 0x9F, 0x0D, 0x1C, 0xBE, 0x39, 0x1D, 0x30, 0x39, 0xF9, 0x40, 0x00,
+    0x75, 0xD4, 0xEB, 0xAB, 0x96, 0x45, 0x30, 0x2B, 0x32, 0xB3, 0x29, 0x33, 0x97, 0x01, 0xE3, 0xA9,
+    0xD3, 0x50, 0x00, 0xE5, 0xD7, 0x55, 0x3A, 0xEA, 0xAE, 0x05, 0x66, 0x52, 0x67, 0x29, 0x80, 0x06,
+    0x98, 0x1F, 0x8F, 0x37, 0x2F, 0xDF, 0xA2, 0x9E, 0x10, 0xAF, 0x84, 0x2B, 0xE1, 0xE8, 0x53, 0xC3,
+    0xD0, 0xE5, 0xF9, 0x7E, 0x73, 0xF3, 0x71, 0x32, 0xC4, 0x4C, 0x4C, 0xAE, 0xFC, 0x56, 0xDF, 0x52,
+    0x70, 0x4E, 0x09, 0xC0, 0x29, 0x71, 0x69, 0x00, 0x00, 0x75, 0xC4, 0xEB, 0xC4, 0x68, 0xF6, 0x21,
+    0xFB, 0x10, 0xFC, 0x88, 0x7E, 0xC6, 0x4F, 0x63, 0x03, 0xAE, 0xA7, 0x5D, 0x40, 0x02, 0x09, 0xF6,
+    0x13, 0xED, 0x72, 0x9F, 0xDF, 0x53, 0xC3, 0xD2, 0xAF, 0xCA, 0x15, 0xFE, 0xA8, 0x53, 0xB6, 0x1C,
+    0xBC, 0xF0, 0x4E, 0x00, 0x00, 0xB6, 0xFA, 0xBF, 0x76, 0xFA, 0xB8, 0x21, 0x34, 0x3C, 0x88, 0x10,
+    0x20, 0x40, 0x81, 0x00, 0x00, 0xFD, 0xDB, 0xEA, 0xFD, 0xFB, 0xEA, 0x98, 0xF2, 0x00, 0x00, 0xB6,
+    0xFA, 0xAD, 0xBE, 0xA2, 0x04, 0x08, 0x10, 0x21, 0x4B, 0xA1, 0x69, 0x40, 0x80, 0x00, 0xB6, 0xFA,
+    0xAD, 0xBE, 0xA0, 0xA5, 0xC5, 0xA4, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x41, 0x48, 0x29, 0x05,
+    0x20, 0xFA, 0x3D, 0x87, 0xD3, 0xCC, 0xEE, 0xE7, 0x73, 0xD5, 0xF9, 0xEF, 0x5B, 0x2E, 0x2A, 0xF1,
+    0xEC, 0x6D, 0x8C, 0x0E, 0x40, 0x00, 0x75, 0xD4, 0xEB, 0xAB, 0x6C, 0x0B, 0x4C, 0xA4, 0xCE, 0x53,
+    0x00, 0x07, 0xCB, 0x7B, 0xDF, 0x2D, 0xEF, 0x05, 0xAF, 0x3A, 0x62, 0x67, 0xF9, 0xAF, 0x70, 0xFA,
+    0x89, 0xEA, 0x7F, 0xFE, 0x0E, 0x10, 0xB7, 0xFC, 0x33, 0x33, 0xE0, 0x7C, 0xD3, 0x53, 0xE6, 0x29,
+    0xA1, 0xF6, 0x66, 0xAE, 0xFC, 0x56, 0xB7, 0xF0, 0xA9, 0x4C, 0x94, 0xA6, 0x4A, 0x52, 0x16, 0x42,
+    0xB2, 0x86, 0xD2, 0xD0, 0x7C, 0xC0, 0x07, 0x93, 0xCA, 0x7F, 0xBF, 0x03, 0xAD, 0xE6, 0x17, 0x13,
+    0x99, 0x39, 0x93, 0x99, 0x39, 0x98, 0x5C, 0x75, 0xBC, 0xFF, 0x7E, 0x07, 0x93, 0xCA, 0xB5, 0x26,
+    0xAF, 0xE1, 0x9B, 0x6F, 0xC5, 0x33, 0xEB, 0x99, 0xF8, 0xE6, 0x73, 0xD4, 0xE7, 0xA9, 0xF8, 0xE6,
+    0x7D, 0x73, 0x6D, 0xF8, 0xA6, 0xAF, 0xE1, 0x9A, 0xD4, 0x9B, 0x90, 0x00, 0xB7, 0xD9, 0xD3, 0x1B,
+    0x7D, 0x9D, 0x31, 0x05, 0x8D, 0xBF, 0xDB, 0xF4, 0x2B, 0xC7, 0xF4, 0xDD, 0x6C, 0x2F, 0xBA, 0x99,
+    0xCE, 0x74, 0xCB, 0x09, 0xD2, 0x33, 0x9D, 0xBD, 0x9A, 0x5F, 0x5F, 0xF2, 0xFF, 0xF5, 0xDB, 0x7E,
+    0x8F, 0xF4, 0x93, 0x6B, 0x80, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x74, 0x1D, 0x6E, 0x2F, 0xBD,
+    0xB4, 0xB0, 0x57, 0xFF, 0x19, 0xAB, 0xD7, 0xF8, 0x54, 0xF7, 0x7A, 0x14, 0xBB, 0xD2, 0xA5, 0xDE,
+    0x95, 0x2E, 0xF4, 0xA9, 0x77, 0xA5, 0x4F, 0xEE, 0xF4, 0xAB, 0xEE, 0xFE, 0x15, 0x7F, 0xF5, 0x9B,
+    0x69, 0x60, 0x5F, 0x79, 0xD6, 0xE3, 0xA0, 0x0A, 0xE6, 0x5B, 0xB4, 0xA7, 0xF2, 0x94, 0xFE, 0x52,
+    0xDA, 0x95, 0xD4, 0x06, 0xC2, 0xD7, 0x1F, 0x56, 0x26, 0x79, 0x9F, 0xDB, 0xF3, 0x16, 0xB8, 0xFA,
+    0xB1, 0x33, 0xCC, 0xF2, 0xFC, 0xC0, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06,
+    0x03, 0xC6, 0x47, 0x8C, 0x80, 0x6D, 0x23, 0x69, 0x1B, 0x48, 0xDA, 0x46, 0xD2, 0x36, 0x91, 0xB4,
+    0x80, 0x74, 0x1D, 0x6E, 0x2F, 0xBD, 0xB4, 0xB0, 0x56, 0x59, 0xAB, 0xD7, 0xEE, 0x29, 0xD7, 0xD2,
+    0xA7, 0x74, 0x29, 0xDD, 0x0A, 0x7C, 0xA1, 0x4E, 0xBE, 0x85, 0x3B, 0x3D, 0x2A, 0xBF, 0xE4, 0xAC,
+    0xB3, 0x6D, 0x2C, 0x0B, 0xEF, 0x3A, 0xDC, 0x74, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01,
+    0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x00, 0x0D, 0xAE, 0x3F, 0x07, 0x94, 0xE5, 0xE6, 0x39, 0x79,
+    0x8E, 0x5E, 0x63, 0xF0, 0x79, 0x4D, 0xAE, 0x05, 0x20, 0xA4, 0x14, 0x82, 0x90, 0x52, 0x0D, 0xF5,
+    0x37, 0xD4, 0xA4, 0x14, 0x82, 0x90, 0x52, 0x0A, 0x40, 0xFC, 0x1C, 0x8A, 0x41, 0xCB, 0x43, 0x97,
+    0xF2, 0x1C, 0xBF, 0x8C, 0xB7, 0xFC, 0xCA, 0xFD, 0xD0, 0xFC, 0x1F, 0x31, 0x48, 0x39, 0x72, 0x39,
+    0x7D, 0xE3, 0x97, 0xDE, 0x2D, 0xFC, 0xE5, 0x7F, 0x88, 0x00, 0x0D, 0x85, 0x85, 0x07, 0x20, 0x00,
+    0x75, 0xDE, 0xF7, 0x5D, 0xEF, 0x33, 0x10, 0x20, 0x40, 0x81, 0x99, 0xD7, 0x53, 0xAE, 0xA0, 0x62,
+    0x57, 0x52, 0xBA, 0x96, 0xFB, 0x0B, 0x7D, 0x85, 0xB7, 0xDE, 0xFB, 0x6F, 0xBD, 0xF4, 0x14, 0x16,
+    0xDF, 0x7B, 0xED, 0xBE, 0xF7, 0xD0, 0x50, 0x00, 0x05, 0x05, 0x00, 0x01, 0xE4, 0x1E, 0x42, 0xBE,
+    0x43, 0x6B, 0x84, 0x80, 0x0D, 0xA4, 0x54, 0x54, 0x5B, 0x52, 0xDA, 0x80, 0x0D, 0xB1, 0x2B, 0xC4,
+    0xB6, 0x85, 0x20, 0xB6, 0x85, 0x78, 0x9B, 0x62, 0x00, 0x07, 0x97, 0xE6, 0x33, 0xCC, 0xFA, 0xB1,
+    0x2D, 0x71, 0xFD, 0xBF, 0x31, 0x9E, 0x67, 0xD5, 0x89, 0x6B, 0x8D, 0x80, 0x0D, 0xA4, 0x54, 0x55,
+    0xC9, 0x6D, 0x74, 0x5B, 0x5C, 0xC7, 0x03, 0x6B, 0x8A, 0xC8, 0xB0, 0xD0, 0x66, 0x38, 0x0B, 0xF0,
+    0x56, 0x5C, 0x16, 0xDB, 0xF8, 0x14, 0xAF, 0x98, 0xB6, 0xA5, 0xB5, 0x1E, 0x60, 0x0D, 0xA4, 0x54,
+    0x55, 0xC9, 0x6D, 0x61, 0x6D, 0x73, 0x1C, 0x05, 0xE5, 0x64, 0x58, 0x7B, 0x06, 0x63, 0xFE, 0xDC,
+    0x8F, 0xC5, 0x0A, 0xFD, 0xDD, 0x16, 0xE5, 0xFC, 0x8A, 0x72, 0xFE, 0x32, 0xDF, 0xF4, 0x2B, 0xF7,
+    0x40, 0xFC, 0x1F, 0x31, 0x48, 0x39, 0x72, 0x39, 0x7D, 0xEE, 0x4E, 0x5F, 0x7A, 0x16, 0xFE, 0x7D,
+    0x15, 0xFE, 0x2E, 0x02, 0xF3, 0x6B, 0x8B, 0x0F, 0x60, 0xD0, 0x70, 0xC0, 0xBF, 0x83, 0x6F, 0x6F,
+    0xF0, 0x2D, 0x5F, 0x32, 0x96, 0xD5, 0xCA, 0xDA, 0x8F, 0x30, 0x00, 0x39, 0x8E, 0x97, 0x1E, 0x7B,
+    0x8B, 0xEF, 0x7C, 0xAE, 0x9B, 0xE5, 0x29, 0x89, 0x8B, 0xCD, 0xAE, 0x2B, 0x22, 0xA0, 0x20, 0x76,
+    0x9B, 0x62, 0x73, 0xB8, 0xEB, 0x27, 0xF6, 0x7B, 0xE4, 0xF9, 0x7B, 0x64, 0xFA, 0x76, 0x93, 0xF7,
+    0x7B, 0x64, 0xDB, 0xDF, 0x23, 0xAC, 0x8E, 0x77, 0x1B, 0x62, 0x3B, 0x44, 0x00, 0x20, 0x76, 0x9B,
+    0x62, 0x73, 0xB8, 0xEB, 0x26, 0xDE, 0xF9, 0x3F, 0x77, 0xB6, 0x4F, 0xA7, 0x69, 0x3E, 0x5E, 0xD9,
+    0x3F, 0xB3, 0xDF, 0x23, 0xAC, 0x8E, 0x77, 0x1B, 0x62, 0x3B, 0x44, 0x00, 0x20, 0x76, 0x9B, 0x62,
+    0x73, 0xB8, 0xEB, 0x27, 0xE4, 0xF7, 0xC9, 0xF6, 0xFB, 0x64, 0xEE, 0xDA, 0x4F, 0x97, 0xB6, 0x4E,
+    0xFF, 0x7C, 0x9E, 0x6E, 0xB2, 0x39, 0xDC, 0x6D, 0x88, 0xED, 0x10, 0x20, 0x76, 0x9B, 0x62, 0x73,
+    0xB9, 0x87, 0x59, 0x3F, 0x2F, 0xBE, 0x4F, 0x97, 0xB6, 0x4E, 0xED, 0xA4, 0xFB, 0x7D, 0xB2, 0x77,
+    0xFB, 0xE4, 0xE1, 0xD6, 0x49, 0xF3, 0xB8, 0xDB, 0x11, 0xDA, 0x20, 0x20, 0x76, 0x9B, 0x62, 0x73,
+    0xB8, 0xEB, 0x27, 0x7F, 0xBE, 0x4F, 0xB7, 0xDB, 0x25, 0x36, 0x92, 0xDE, 0xD9, 0x3B, 0xFD, 0xF2,
+    0x61, 0xD6, 0x47, 0x3B, 0x8D, 0xB1, 0x1D, 0xA2, 0x00, 0x20, 0x76, 0x9B, 0x62, 0x73, 0xB8, 0xEB,
+    0x27, 0xE6, 0xF7, 0xC9, 0xFB, 0x7D, 0xB2, 0x7A, 0xB6, 0x93, 0xF6, 0xFB, 0x64, 0xFC, 0xDE, 0xF9,
+    0x1D, 0x64, 0x73, 0xB8, 0xDB, 0x11, 0xDA, 0x20, 0x20, 0x76, 0x0C, 0x4A, 0xDC, 0x73, 0x91, 0xFF,
+    0xD9, 0x1E, 0xF9, 0x2B, 0xED, 0x92, 0xDB, 0x49, 0x4D, 0xA4, 0xA6, 0xD2, 0x5B, 0x7D, 0x56, 0xDF,
+    0x55, 0x22, 0x14, 0x88, 0x52, 0x21, 0x48, 0x85, 0x22, 0x14, 0x88, 0x52, 0x21, 0x48, 0x85, 0x22,
+    0x14, 0x40, 0x07, 0x8C, 0x8D, 0xEF, 0x6D, 0x7E, 0x2A, 0xCB, 0x35, 0x59, 0x28, 0x8F, 0x25, 0x11,
+    0xE4, 0xA3, 0x9F, 0x92, 0x8F, 0xCF, 0x75, 0x11, 0x2A, 0x21, 0x56, 0x4A, 0xCB, 0x36, 0xD7, 0x62,
+    0x79, 0x2E, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x44, 0x29, 0x10, 0xF5, 0x44, 0x3B, 0xA2, 0x1F,
+    0x4C, 0x43, 0xE8, 0x88, 0x52, 0x21, 0x48, 0x85, 0x22, 0x14, 0x88, 0x51, 0x00, 0x00, 0xB6, 0xFA,
+    0xAD, 0xBE, 0xAA, 0x44, 0x29, 0x10, 0xA4, 0x43, 0xE8, 0x88, 0x7D, 0x31, 0x0E, 0xE8, 0x87, 0xAA,
+    0x21, 0x48, 0x85, 0x22, 0x14, 0x88, 0x51, 0x00, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x44, 0x29,
+    0x10, 0xFA, 0x22, 0x1E, 0xB8, 0x87, 0x74, 0x43, 0xBA, 0x21, 0xEB, 0x88, 0x7D, 0x11, 0x0A, 0x44,
+    0x29, 0x10, 0xA2, 0x00, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x44, 0x29, 0x10, 0xF5, 0xC4, 0x3D,
+    0x71, 0x0A, 0x44, 0x29, 0x10, 0xF5, 0xC4, 0x3D, 0x71, 0x0A, 0x44, 0x29, 0x10, 0xA2, 0x00, 0x0F,
+    0x20, 0xF9, 0x6F, 0xAB, 0xF7, 0xEF, 0xAB, 0xCC, 0x0F, 0x30, 0xFD, 0xFB, 0xEA, 0xF9, 0x6F, 0xAB,
+    0xC8, 0xF3, 0x0C, 0x07, 0xCB, 0x7D, 0x5F, 0x2D, 0xF5, 0x60, 0x3C, 0xC0, 0xC0, 0x60, 0x2D, 0xBE,
+    0xAB, 0x6F, 0xAB, 0x01, 0x80, 0x40, 0x82, 0xDB, 0xEA, 0xB6, 0xFA, 0xA9, 0x10, 0xA4, 0x42, 0x91,
+    0x0A, 0x44, 0x29, 0x10, 0xA2, 0x14, 0x42, 0xCC, 0x95, 0x96, 0x6D, 0xAE, 0xE0, 0x6F, 0x79, 0xE3,
+    0x20, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0xC8, 0xEF, 0xB8, 0xE1, 0xC0, 0x9F, 0x61, 0x3F, 0x61,
+    0x85, 0xA4, 0xC3, 0x6B, 0x9C, 0x18, 0xA6, 0xCD, 0x6D, 0xF5, 0x5B, 0x7D, 0x40, 0x07, 0x8C, 0x8D,
+    0xEF, 0x6D, 0x7E, 0x2A, 0xCB, 0x35, 0x59, 0x2C, 0xD1, 0xEA, 0x43, 0xB9, 0x0F, 0xA5, 0x0F, 0xA1,
+    0x0A, 0x21, 0x66, 0x8A, 0xB2, 0x56, 0x59, 0xB6, 0xBF, 0x13, 0x7B, 0xCF, 0x19, 0x00, 0x07, 0x8C,
+    0x8D, 0xEF, 0x6D, 0x7E, 0x2A, 0xCB, 0x35, 0x59, 0x2C, 0xD1, 0x44, 0x3E, 0x84, 0x3E, 0x94, 0x3B,
+    0x90, 0xF5, 0x21, 0x66, 0x8A, 0xB2, 0x56, 0x59, 0xB6, 0xBF, 0x13, 0x7B, 0xCF, 0x19, 0x00, 0x07,
+    0x8C, 0x8D, 0xEF, 0x6D, 0x7E, 0x2A, 0xCB, 0x35, 0x59, 0x2C, 0xD1, 0xF4, 0x21, 0xEB, 0x43, 0xB9,
+    0x0E, 0xE4, 0x3D, 0x68, 0x7E, 0xE6, 0x8A, 0xB2, 0x56, 0x59, 0xB6, 0xBF, 0x13, 0x7B, 0xCF, 0x19,
+    0x00, 0x07, 0x8C, 0x8D, 0xEF, 0x6D, 0x7E, 0x2A, 0xCB, 0x37, 0xEB, 0x64, 0xFD, 0xED, 0x1D, 0xC8,
+    0x77, 0x21, 0xEB, 0x43, 0xD6, 0x87, 0xD2, 0x87, 0xC9, 0xA2, 0xAC, 0x95, 0x96, 0x6D, 0xAF, 0xC4,
+    0xDE, 0xF3, 0xC6, 0x40, 0x07, 0x8C, 0x8D, 0xEF, 0x6D, 0x7E, 0x2A, 0xCB, 0x35, 0x59, 0x2C, 0xD1,
+    0xEB, 0x43, 0xD6, 0x85, 0x10, 0xA2, 0x1E, 0xB4, 0x3E, 0xD6, 0x8A, 0xB2, 0x56, 0x59, 0xB6, 0xBF,
+    0x13, 0x7B, 0xCF, 0x19, 0x00, 0x00, 0x4E, 0xE3, 0xF2, 0xDC, 0x7C, 0x64, 0x74, 0x1E, 0xC1, 0xD0,
+    0x7C, 0x64, 0x7E, 0x5B, 0x89, 0xDC, 0x07, 0x8F, 0xDD, 0x37, 0xFE, 0xB6, 0xD7, 0xEA, 0xAC, 0xBC,
+    0xEA, 0xB8, 0xAD, 0xB7, 0xFD, 0x54, 0xAF, 0xA1, 0x4B, 0x42, 0x9E, 0xC8, 0x53, 0x48, 0x53, 0x38,
+    0x5B, 0x86, 0x8A, 0xDF, 0x92, 0xB7, 0x66, 0xB5, 0xF8, 0xBD, 0x9B, 0xDE, 0xE5, 0xE3, 0x20, 0x00,
+    0xB6, 0xF7, 0x2D, 0xBE, 0x23, 0x31, 0xA3, 0xC8, 0x84, 0xD0, 0xE0, 0x87, 0x99, 0x02, 0x06, 0x83,
+    0x35, 0xB7, 0xC5, 0x6D, 0xEE, 0x00, 0xB6, 0xF7, 0x2D, 0xBE, 0x23, 0x31, 0xA0, 0x87, 0x99, 0x0E,
+    0x08, 0x4D, 0x0F, 0x22, 0x06, 0x83, 0x35, 0xB7, 0xC5, 0x6D, 0xEE, 0x00, 0xB6, 0xF7, 0x2D, 0xBE,
+    0x23, 0x31, 0xA3, 0xCC, 0x86, 0x08, 0x4D, 0x09, 0xA1, 0x82, 0x1E, 0x66, 0x83, 0x35, 0xB7, 0xC5,
+    0x6D, 0xEE, 0x00, 0xB6, 0xF7, 0x2D, 0xBE, 0x23, 0x31, 0xA3, 0x04, 0x30, 0x40, 0x81, 0x0C, 0x10,
+    0xC1, 0xA0, 0xCD, 0x6D, 0xF1, 0x5B, 0x7B, 0x80, 0xE4, 0x28, 0x2B, 0x23, 0x6B, 0x85, 0xE3, 0xCE,
+    0x3B, 0x0F, 0x37, 0x3D, 0x5C, 0x39, 0xEA, 0x9F, 0x61, 0xE4, 0xF3, 0x8B, 0xCA, 0xDC, 0x5A, 0x45,
+    0x07, 0x20, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA5, 0xD3, 0x2E, 0x99, 0x74, 0xCB, 0xA6, 0x5D, 0x32,
+    0xE9, 0x97, 0x4C, 0xBA, 0xF3, 0xDD, 0x71, 0xD6, 0x47, 0x40, 0x00, 0xDB, 0x7D, 0x55, 0xDF, 0x55,
+    0x45, 0x1E, 0x65, 0x19, 0xA8, 0xD1, 0x6F, 0xAA, 0x15, 0xFB, 0x21, 0xB7, 0xEA, 0x83, 0x6F, 0x9C,
+    0xDB, 0x88, 0xC4, 0x06, 0x5C, 0x0C, 0xF8, 0x9D, 0xFF, 0x3B, 0x97, 0xBB, 0xD0, 0xA7, 0xBB, 0xD0,
+    0xB7, 0x84, 0x36, 0xF0, 0xC8, 0xF8, 0x60, 0x78, 0xF1, 0x3A, 0x6A, 0x39, 0x00, 0x06, 0x5C, 0x0C,
+    0xF8, 0x9D, 0xFF, 0x39, 0xEE, 0xF4, 0x36, 0xF7, 0x7A, 0x16, 0xF0, 0x85, 0x3C, 0x32, 0x72, 0xF8,
+    0x60, 0x78, 0xF1, 0x3A, 0x6A, 0x39, 0x00, 0x06, 0x5C, 0x0C, 0xF8, 0xB6, 0xEF, 0xF9, 0xD5, 0xF7,
+    0x7A, 0x14, 0xF7, 0x7A, 0x14, 0xF0, 0x85, 0x7C, 0x32, 0x6D, 0xF0, 0xC0, 0xF1, 0xE2, 0x74, 0xD4,
+    0x72, 0x06, 0x5C, 0x15, 0xCF, 0x8A, 0xDD, 0xFF, 0x3A, 0x9E, 0xEF, 0x42, 0x9E, 0xEF, 0x42, 0xBE,
+    0x10, 0xAF, 0x86, 0x4B, 0x7C, 0x30, 0x53, 0xC7, 0x89, 0xD3, 0x51, 0xC8, 0x06, 0x5C, 0x0C, 0xF8,
+    0xAB, 0xDF, 0xF3, 0xAB, 0xEE, 0xF4, 0x1E, 0xEF, 0x41, 0xE1, 0x0A, 0xF8, 0x64, 0xAF, 0xC3, 0x03,
+    0xC7, 0x89, 0xD3, 0x51, 0xC8, 0x06, 0x5C, 0x0C, 0xF8, 0x9D, 0xFF, 0x3B, 0xD9, 0xEE, 0xF4, 0x3F,
+    0x27, 0xBB, 0xD0, 0xFC, 0x9E, 0x10, 0xFC, 0x9E, 0x19, 0x3D, 0x9F, 0x0C, 0x0F, 0x1E, 0x27, 0x4D,
+    0x47, 0x20, 0x07, 0xCD, 0x89, 0xF9, 0xB8, 0x9F, 0xAF, 0xE7, 0x3C, 0x20, 0xF0, 0x83, 0xC2, 0x0F,
+    0x08, 0x3B, 0xB2, 0x3E, 0x9C, 0xCF, 0x1C, 0x4F, 0x1E, 0x27, 0xEB, 0xCC, 0xF8, 0x68, 0x78, 0x41,
+    0xE1, 0x07, 0x84, 0x1E, 0x10, 0x7E, 0xBC, 0x8E, 0x98, 0x16, 0xF2, 0x80, 0x07, 0x3B, 0xCE, 0x98,
+    0x99, 0xE6, 0x70, 0xD3, 0xC8, 0x9C, 0x79, 0x13, 0xE7, 0xE4, 0x4F, 0xF3, 0xDC, 0xE1, 0xA4, 0x99,
+    0xE6, 0x65, 0x80, 0x05, 0xAF, 0x3A, 0x62, 0x7C, 0x73, 0x72, 0xF8, 0x68, 0xA7, 0x84, 0x2D, 0xE1,
+    0x0D, 0xBC, 0x20, 0xF8, 0x68, 0x7C, 0x72, 0x3A, 0x60, 0x73, 0xF2, 0x80, 0x05, 0xAF, 0x3A, 0x62,
+    0x7C, 0x73, 0x3E, 0x1A, 0x36, 0xF0, 0x85, 0xBC, 0x21, 0x4F, 0x08, 0x72, 0xF8, 0x68, 0x7C, 0x72,
+    0x3A, 0x60, 0x73, 0xF2, 0x80, 0x05, 0xAF, 0x3A, 0x62, 0x7C, 0x73, 0x6D, 0xF0, 0xD1, 0x5F, 0x08,
+    0x53, 0xC2, 0x14, 0xF0, 0x85, 0x7E, 0x1A, 0x36, 0xF8, 0xE4, 0x74, 0xC0, 0xE7, 0xE5, 0x05, 0xAF,
+    0x3A, 0x62, 0x7C, 0x73, 0x57, 0xE1, 0xA2, 0xBE, 0x10, 0x78, 0x41, 0xE1, 0x0A, 0xFC, 0x34, 0x57,
+    0xE3, 0x91, 0xD3, 0x03, 0x9F, 0x94, 0x0E, 0x42, 0x9D, 0x75, 0x5B, 0xAE, 0xAD, 0x80, 0x0D, 0x85,
+    0xBA, 0xEA, 0xA7, 0x5D, 0x5C, 0x80, 0xD8, 0x54, 0x53, 0xAE, 0xAA, 0x75, 0xD5, 0x51, 0xB0, 0xA8,
+    0xA8, 0x75, 0xD4, 0xEB, 0xAA, 0xA2, 0xA0, 0x07, 0x3B, 0xCE, 0x98, 0x9F, 0xC5, 0x9B, 0xFB, 0xF1,
+    0xD1, 0xFD, 0xF3, 0x85, 0xA7, 0x0A, 0xCE, 0x15, 0xC7, 0x47, 0x2E, 0x39, 0x9E, 0x38, 0x96, 0xBC,
+    0x00, 0x75, 0xD5, 0x5E, 0xBA, 0xAD, 0x91, 0x4C, 0x0A, 0x4C, 0xAC, 0xCA, 0xCC, 0xB7, 0x02, 0x9E,
+    0x3A, 0x9D, 0x35, 0x07, 0x3B, 0xCE, 0x98, 0x99, 0xE6, 0xE5, 0xC3, 0x45, 0x27, 0x0B, 0x4E, 0x1B,
+    0x4E, 0x0E, 0x1A, 0x19, 0xE6, 0x74, 0xC4, 0xE7, 0x78, 0x07, 0x3B, 0xCE, 0x98, 0x99, 0xE6, 0x70,
+    0xD1, 0xB4, 0xE1, 0x69, 0xC2, 0x93, 0x87, 0x2E, 0x1A, 0x19, 0xE6, 0x74, 0xC4, 0xE7, 0x78, 0x07,
+    0x3B, 0xCE, 0x98, 0x99, 0xE6, 0xDB, 0x86, 0x8A, 0xCE, 0x14, 0x9C, 0x29, 0x38, 0x57, 0x86, 0x8D,
+    0xB3, 0xCC, 0xE9, 0x89, 0xCE, 0xF0, 0x07, 0x3B, 0xCE, 0x98, 0xAB, 0x9E, 0x6B, 0x70, 0xD1, 0x49,
+    0xC2, 0x93, 0x85, 0x67, 0x0A, 0xF0, 0xD1, 0x6C, 0xF3, 0x53, 0xA6, 0x27, 0x3B, 0xC0, 0x07, 0x3B,
+    0xCE, 0x98, 0x99, 0xE6, 0xAF, 0x0D, 0x15, 0x9C, 0x13, 0x82, 0x70, 0xAF, 0x0D, 0x15, 0xCF, 0x33,
+    0xA6, 0x27, 0x3B, 0xC0, 0x04, 0x08, 0x10, 0x20, 0x40, 0xFF, 0x09, 0x1F, 0xE1, 0x22, 0x04, 0x08,
+    0x10, 0x20, 0x00, 0x73, 0xFC, 0x47, 0x4F, 0xB0, 0xCF, 0x33, 0x86, 0xA7, 0xBB, 0xD2, 0x7C, 0xBD,
+    0x07, 0xF5, 0x41, 0xDB, 0xA1, 0x9E, 0x66, 0xF8, 0x9F, 0xED, 0x78, 0x00, 0x75, 0xC4, 0xEB, 0xC5,
+    0xC9, 0xA2, 0x88, 0x59, 0x0D, 0x90, 0x32, 0x18, 0x1D, 0x75, 0x3A, 0xEA, 0x00, 0x75, 0xC4, 0xEB,
+    0xC4, 0x68, 0x21, 0xB2, 0x16, 0x42, 0x8C, 0x9C, 0x98, 0x1D, 0x75, 0x3A, 0xEA, 0x00, 0x75, 0xC4,
+    0xEB, 0xC5, 0xB3, 0x45, 0x50, 0xA2, 0x14, 0x42, 0xAC, 0x9B, 0x30, 0x3A, 0xEA, 0x75, 0xD4, 0x00,
+    0x75, 0xC4, 0xEB, 0xC5, 0x56, 0x8A, 0xA0, 0x40, 0x85, 0x59, 0x2A, 0xC0, 0xEB, 0xA9, 0xD7, 0x50,
+    0x07, 0x01, 0xF5, 0xA6, 0xE7, 0x29, 0xB6, 0xC6, 0xFD, 0x9D, 0x6E, 0xB3, 0xC5, 0x4A, 0xF1, 0x72,
+    0xE9, 0x71, 0xDA, 0x26, 0x00, 0xB6, 0xFB, 0xDF, 0x6D, 0xF7, 0xBD, 0x9E, 0x44, 0xE0, 0x9C, 0x13,
+    0x83, 0x86, 0x86, 0x79, 0x9D, 0x31, 0x39, 0xDC, 0x07, 0x01, 0xF5, 0xA7, 0x5E, 0x72, 0x9D, 0x76,
+    0xC6, 0xF3, 0xAD, 0xC7, 0x8A, 0xB5, 0xE2, 0xAF, 0x4B, 0x8E, 0xD1, 0x30,
+};
+const uint8_t ArialMT_Plain_24_CS_huffman[] PROGMEM = {
+    0x01, 0x00, 0x00, 0x01, 0x05, 0x0A, 0x06, 0x06, 0x0F, 0x08, 0x14, 0x18, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x01, 0x06, 0x60, 0xC0, 0xE0, 0x03, 0x07, 0x0C, 0x0F, 0x18, 0x1C, 0x38, 0x3F, 0x80,
+    0xFF, 0x0E, 0x1F, 0x20, 0xF0, 0xF8, 0xFE, 0x3C, 0x3E, 0x66, 0x8C, 0xC6, 0xFC, 0x02, 0x04, 0x08,
+    0x1E, 0x31, 0x33, 0x62, 0x6C, 0x70, 0x83, 0x86, 0x8F, 0xCE, 0xDC, 0xE6, 0x10, 0x39, 0x68, 0x6E,
+    0x78, 0x7E, 0x7F, 0xEC, 0x1B, 0x21, 0x22, 0x37, 0x40, 0x61, 0x67, 0x7C, 0x88, 0x8E, 0x9C, 0xB0,
+    0xC1, 0xC3, 0xC7, 0xCC, 0xD8, 0xE2, 0xE8, 0xEE, 0x0B, 0x19, 0x1D, 0x26, 0x2C, 0x32, 0x36, 0x3D,
+    0x50, 0x6F, 0x76, 0x77, 0x82, 0x84, 0x87, 0xA0, 0xB6, 0xCF, 0xE1, 0xE3, 0xE7, 0xF1, 0xF3, 0xF7,
+    0x0D, 0x11, 0x1A, 0x23, 0x27, 0x3B, 0x4E, 0x63, 0x79, 0x81, 0x85, 0x98, 0x9F, 0xBC, 0xF4, 0xF6,
+};
+const CompressedFont ArialMT_Plain_24_CS = {ArialMT_Plain_24_CS_header, ArialMT_Plain_24_CS_data, ArialMT_Plain_24_CS_huffman};
+
+#endif
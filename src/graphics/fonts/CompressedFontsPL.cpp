@@ -0,0 +1,698 @@
+// Generated by bin/compress-oled-fonts.py from OLEDDisplayFontsPL.cpp, don't edit
+// trunk-ignore-all(clang-format): Generated
+#include "OLEDDisplayFontsPL.h"
+#if defined(OLED_PL) && FONT_COMPRESSED
+
+const uint8_t ArialMT_Plain_10_PL_header[] PROGMEM = {
+    0x0A, 0x0D, 0x20, 0xE0, 0xFF, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x04, 0x03, 0x00, 0x02, 0x05, 0x04,
+    0x00, 0x05, 0x09, 0x06, 0x00, 0x0C, 0x0A, 0x06, 0x00, 0x13, 0x10, 0x09, 0x00, 0x1C, 0x0E, 0x08,
+    0x00, 0x26, 0x01, 0x02, 0x00, 0x27, 0x06, 0x04, 0x00, 0x2B, 0x06, 0x04, 0x00, 0x2F, 0x05, 0x04,
+    0x00, 0x32, 0x09, 0x06, 0x00, 0x37, 0x04, 0x03, 0x00, 0x39, 0x03, 0x03, 0x00, 0x3B, 0x04, 0x03,
+    0x00, 0x3D, 0x05, 0x04, 0x00, 0x40, 0x0A, 0x06, 0x00, 0x45, 0x08, 0x05, 0x00, 0x49, 0x0A, 0x06,
+    0x00, 0x4F, 0x0A, 0x06, 0x00, 0x55, 0x0B, 0x07, 0x00, 0x5C, 0x0A, 0x06, 0x00, 0x63, 0x0A, 0x06,
+    0x00, 0x69, 0x09, 0x06, 0x00, 0x6E, 0x0A, 0x06, 0x00, 0x74, 0x0A, 0x06, 0x00, 0x7B, 0x04, 0x03,
+    0x00, 0x7D, 0x04, 0x03, 0x00, 0x80, 0x0A, 0x06, 0x00, 0x85, 0x09, 0x06, 0x00, 0x8A, 0x09, 0x06,
+    0x00, 0x8F, 0x0B, 0x07, 0x00, 0x95, 0x14, 0x0B, 0x00, 0xA6, 0x0E, 0x08, 0x00, 0xAD, 0x0C, 0x07,
+    0x00, 0xB3, 0x0C, 0x07, 0x00, 0xB9, 0x0B, 0x07, 0x00, 0xBF, 0x0C, 0x07, 0x00, 0xC5, 0x09, 0x06,
+    0x00, 0xC9, 0x0D, 0x08, 0x00, 0xD0, 0x0C, 0x07, 0x00, 0xD6, 0x04, 0x03, 0x00, 0xD8, 0x08, 0x05,
+    0x00, 0xDB, 0x0E, 0x08, 0x00, 0xE2, 0x0C, 0x07, 0x00, 0xE7, 0x10, 0x09, 0x00, 0xEF, 0x0C, 0x07,
+    0x00, 0xF6, 0x0E, 0x08, 0x00, 0xFD, 0x0B, 0x07, 0x01, 0x03, 0x0E, 0x08, 0x01, 0x0A, 0x0C, 0x07,
+    0x01, 0x10, 0x0C, 0x07, 0x01, 0x17, 0x0B, 0x07, 0x01, 0x1C, 0x0C, 0x07, 0x01, 0x21, 0x0D, 0x08,
+    0x01, 0x28, 0x11, 0x0A, 0x01, 0x31, 0x0E, 0x08, 0x01, 0x38, 0x0D, 0x08, 0x01, 0x3F, 0x0C, 0x07,
+    0x01, 0x47, 0x06, 0x04, 0x01, 0x4A, 0x06, 0x04, 0x01, 0x4D, 0x04, 0x03, 0x01, 0x50, 0x09, 0x06,
+    0x01, 0x55, 0x0C, 0x07, 0x01, 0x5A, 0x03, 0x03, 0x01, 0x5C, 0x0A, 0x06, 0x01, 0x61, 0x0A, 0x06,
+    0x01, 0x66, 0x0A, 0x06, 0x01, 0x6B, 0x0A, 0x06, 0x01, 0x70, 0x0A, 0x06, 0x01, 0x75, 0x05, 0x04,
+    0x01, 0x78, 0x0A, 0x06, 0x01, 0x80, 0x0A, 0x06, 0x01, 0x85, 0x04, 0x03, 0x01, 0x87, 0x04, 0x03,
+    0x01, 0x8A, 0x08, 0x05, 0x01, 0x8F, 0x04, 0x03, 0x01, 0x91, 0x10, 0x09, 0x01, 0x99, 0x0A, 0x06,
+    0x01, 0x9E, 0x0A, 0x06, 0x01, 0xA3, 0x0A, 0x06, 0x01, 0xA9, 0x0A, 0x06, 0x01, 0xAF, 0x05, 0x04,
+    0x01, 0xB2, 0x08, 0x05, 0x01, 0xB7, 0x06, 0x04, 0x01, 0xBA, 0x0A, 0x06, 0x01, 0xBF, 0x09, 0x06,
+    0x01, 0xC4, 0x0E, 0x08, 0x01, 0xCB, 0x0A, 0x06, 0x01, 0xD1, 0x09, 0x06, 0x01, 0xD7, 0x0A, 0x06,
+    0x01, 0xDD, 0x06, 0x04, 0x01, 0xE2, 0x04, 0x03, 0x01, 0xE4, 0x05, 0x04, 0x01, 0xE8, 0x09, 0x06,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0x01, 0xED, 0x0C, 0x07, 0x01, 0xF2, 0x05, 0x04,
+    0x01, 0xF5, 0x0C, 0x07, 0x01, 0xFD, 0x0E, 0x08, 0x02, 0x06, 0x0A, 0x06, 0x02, 0x0D, 0x0C, 0x07,
+    0x02, 0x14, 0x0A, 0x06, 0x02, 0x1A, 0x0A, 0x06, 0x02, 0x20, 0x0A, 0x06, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0x02, 0x27, 0x0E, 0x08, 0x02, 0x2E, 0x0A, 0x06, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0x02, 0x34, 0x0C, 0x07, 0x02, 0x3B, 0x0A, 0x06, 0x02, 0x41, 0x0C, 0x07,
+    0x02, 0x48, 0x08, 0x05, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0x02, 0x4D, 0x04, 0x03, 0x02, 0x50, 0x0A, 0x06,
+    0x02, 0x56, 0x0C, 0x07, 0x02, 0x5D, 0x0A, 0x06, 0x02, 0x62, 0x0A, 0x06, 0x02, 0x68, 0x04, 0x03,
+    0x02, 0x6B, 0x0A, 0x06, 0x02, 0x74, 0x05, 0x04, 0x02, 0x76, 0x0D, 0x08, 0x02, 0x7E, 0x07, 0x05,
+    0x02, 0x83, 0x0A, 0x06, 0x02, 0x89, 0x09, 0x06, 0x02, 0x8E, 0x03, 0x03, 0x02, 0x90, 0x0D, 0x08,
+    0x02, 0x98, 0x0B, 0x07, 0x02, 0x9C, 0x07, 0x05, 0x02, 0xA0, 0x0A, 0x06, 0x02, 0xA6, 0x05, 0x04,
+    0x02, 0xAA, 0x05, 0x04, 0x02, 0xAE, 0x05, 0x04, 0x02, 0xB0, 0x0A, 0x06, 0x02, 0xB5, 0x09, 0x06,
+    0x02, 0xBB, 0x03, 0x03, 0x02, 0xBD, 0x06, 0x04, 0x02, 0xC1, 0x0C, 0x07, 0x02, 0xCA, 0x07, 0x05,
+    0x02, 0xCE, 0x0C, 0x07, 0x02, 0xD6, 0x0A, 0x06, 0x02, 0xDC, 0x10, 0x09, 0x02, 0xE6, 0x10, 0x09,
+    0x02, 0xF0, 0x0A, 0x06, 0x02, 0xF6, 0x0E, 0x08, 0x02, 0xFE, 0x0E, 0x08, 0x03, 0x06, 0x0E, 0x08,
+    0x03, 0x0E, 0x0E, 0x08, 0x03, 0x16, 0x0E, 0x08, 0x03, 0x1E, 0x0E, 0x08, 0x03, 0x26, 0x12, 0x0A,
+    0x03, 0x30, 0x0C, 0x07, 0x03, 0x38, 0x0C, 0x07, 0x03, 0x3F, 0x0C, 0x07, 0x03, 0x46, 0x0C, 0x07,
+    0x03, 0x4D, 0x0C, 0x07, 0x03, 0x54, 0x05, 0x04, 0x03, 0x57, 0x04, 0x03, 0x03, 0x5A, 0x04, 0x03,
+    0x03, 0x5D, 0x05, 0x04, 0x03, 0x60, 0x0B, 0x07, 0x03, 0x66, 0x0C, 0x07, 0x03, 0x6F, 0x0E, 0x08,
+    0x03, 0x76, 0x0E, 0x08, 0x03, 0x7D, 0x0E, 0x08, 0x03, 0x85, 0x0E, 0x08, 0x03, 0x8D, 0x0E, 0x08,
+    0x03, 0x94, 0x0A, 0x06, 0x03, 0x9A, 0x0D, 0x08, 0x03, 0xA2, 0x0C, 0x07, 0x03, 0xA7, 0x0C, 0x07,
+    0x03, 0xAC, 0x0C, 0x07, 0x03, 0xB1, 0x0C, 0x07, 0x03, 0xB6, 0x0D, 0x08, 0x03, 0xBE, 0x0B, 0x07,
+    0x03, 0xC4, 0x0C, 0x07, 0x03, 0xCB, 0x0A, 0x06, 0x03, 0xD1, 0x0A, 0x06, 0x03, 0xD7, 0x0A, 0x06,
+    0x03, 0xDD, 0x0A, 0x06, 0x03, 0xE3, 0x0A, 0x06, 0x03, 0xE9, 0x0A, 0x06, 0x03, 0xF0, 0x10, 0x09,
+    0x03, 0xF9, 0x0A, 0x06, 0x04, 0x00, 0x0A, 0x06, 0x04, 0x06, 0x0A, 0x06, 0x04, 0x0C, 0x0A, 0x06,
+    0x04, 0x12, 0x0A, 0x06, 0x04, 0x18, 0x05, 0x04, 0x04, 0x1B, 0x04, 0x03, 0x04, 0x1E, 0x05, 0x04,
+    0x04, 0x21, 0x05, 0x04, 0x04, 0x24, 0x0A, 0x06, 0x04, 0x2A, 0x0A, 0x06, 0x04, 0x30, 0x0A, 0x06,
+    0x04, 0x35, 0x0A, 0x06, 0x04, 0x3A, 0x0A, 0x06, 0x04, 0x40, 0x0A, 0x06, 0x04, 0x46, 0x0A, 0x06,
+    0x04, 0x4B, 0x09, 0x06, 0x04, 0x51, 0x0A, 0x06, 0x04, 0x57, 0x0A, 0x06, 0x04, 0x5D, 0x0A, 0x06,
+    0x04, 0x63, 0x0A, 0x06, 0x04, 0x69, 0x0A, 0x06, 0x04, 0x6E, 0x09, 0x06, 0x04, 0x74, 0x0A, 0x06,
+    0x04, 0x79, 0x09, 0x06,
+};
+const uint8_t ArialMT_Plain_10_PL_data[] PROGMEM = {
+    0x0B, 0xB0, 0xEC, 0x03, 0xB0, 0xCE, 0x34, 0x3F, 0x48, 0xD0, 0xFD, 0x00, 0xDE, 0xB1, 0x77, 0xF5,
+    0x55, 0xF8, 0xA0, 0x0D, 0xE5, 0x4D, 0xF1, 0x63, 0xCD, 0x55, 0xF0, 0x40, 0xE0, 0xBD, 0xAF, 0xBD,
+    0xF2, 0x7D, 0x4B, 0x84, 0x70, 0x60, 0xEC, 0xD2, 0x30, 0xE8, 0x99, 0x99, 0xC3, 0xA3, 0x48, 0xC4,
+    0xEA, 0x31, 0xC8, 0xC8, 0xD5, 0x64, 0x64, 0x03, 0xA4, 0xE0, 0x70, 0x01, 0x80, 0x23, 0x43, 0xA8,
+    0xD5, 0x4B, 0x97, 0x2F, 0x54, 0x0A, 0x18, 0x17, 0x80, 0xC1, 0xCC, 0x71, 0x75, 0x7B, 0xD8, 0xC1,
+    0x4B, 0xAB, 0xAB, 0xF3, 0x40, 0xB1, 0x99, 0xE2, 0x71, 0x2F, 0x1C, 0x00, 0xEE, 0x5D, 0x8F, 0x17,
+    0x8B, 0xE6, 0x80, 0xD5, 0x62, 0xF1, 0x78, 0xBF, 0xA2, 0x92, 0x63, 0x99, 0xD8, 0x48, 0xF3, 0x55,
+    0x75, 0x75, 0x7E, 0x68, 0xF0, 0x5C, 0x5F, 0x17, 0xC5, 0xEA, 0x80, 0x0A, 0x30, 0x0A, 0x74, 0x80,
+    0x0C, 0x8C, 0xCC, 0xCC, 0x10, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x0C, 0x16, 0x66, 0x66, 0x40, 0xC0,
+    0x92, 0x4E, 0x6E, 0xA6, 0xF0, 0x0B, 0x46, 0xFE, 0x8F, 0xA6, 0xCC, 0x76, 0xE3, 0xB7, 0x9F, 0xDF,
+    0xDF, 0xB7, 0x0F, 0xBB, 0x4E, 0x80, 0x1D, 0x97, 0x99, 0xC4, 0xF3, 0x2C, 0x86, 0x0B, 0xC5, 0x5D,
+    0x5D, 0x5E, 0xA8, 0x0D, 0x54, 0xB9, 0x72, 0xF0, 0x40, 0x0B, 0xC4, 0xB9, 0x78, 0x2D, 0x00, 0x0B,
+    0xC5, 0x5D, 0x5D, 0x5D, 0x58, 0x0B, 0xC5, 0x4A, 0x92, 0x0D, 0x0C, 0x14, 0xBA, 0xBF, 0x6A, 0xB0,
+    0x0B, 0xC6, 0x46, 0x46, 0x45, 0xE0, 0x0B, 0xC0, 0x20, 0x63, 0xBA, 0x0B, 0xC7, 0x03, 0xB8, 0xF1,
+    0x25, 0x0C, 0x0B, 0xC0, 0xC6, 0x31, 0x80, 0x0B, 0xC6, 0xF2, 0xC8, 0x76, 0x5B, 0xCB, 0xC0, 0x0B,
+    0xC6, 0xF3, 0x23, 0x82, 0xBC, 0x00, 0x0D, 0x54, 0xB9, 0x72, 0xE5, 0xEA, 0x80, 0x0B, 0xC5, 0x4A,
+    0x95, 0x37, 0x80, 0x0D, 0x54, 0xB9, 0x73, 0x13, 0x1A, 0xB0, 0x0B, 0xC5, 0x4A, 0x9C, 0xCD, 0xF0,
+    0x0D, 0xEA, 0xAE, 0xAE, 0xAF, 0xC5, 0x00, 0x09, 0x24, 0xBC, 0x49, 0x20, 0x0B, 0xA1, 0x8C, 0x77,
+    0x40, 0x93, 0xC0, 0xE0, 0x87, 0xC1, 0x78, 0x12, 0xEA, 0x34, 0x43, 0xD5, 0x49, 0xAA, 0x1E, 0x8B,
+    0xA8, 0x1C, 0xAF, 0x13, 0xB8, 0xF1, 0x25, 0x0C, 0x93, 0x02, 0x85, 0xA2, 0x86, 0x04, 0x80, 0x98,
+    0xE2, 0xF9, 0xBE, 0xF7, 0xD8, 0xFA, 0x98, 0x0B, 0xEE, 0x99, 0xEA, 0x34, 0x08, 0x99, 0xBE, 0xE0,
+    0xC8, 0xDE, 0x49, 0xBC, 0xC8, 0x24, 0x92, 0x49, 0x24, 0x90, 0x93, 0x00, 0x02, 0x33, 0x79, 0xBD,
+    0x20, 0x0B, 0xC5, 0x1D, 0x1D, 0x90, 0x0B, 0x2A, 0x3A, 0x3C, 0x90, 0x0B, 0x2A, 0x3A, 0x3B, 0xC0,
+    0x0B, 0x2C, 0xDE, 0x6E, 0xCC, 0xA1, 0xAC, 0x62, 0x0B, 0x7D, 0xD4, 0xDB, 0x4D, 0xBA, 0x7A, 0x80,
+    0x0B, 0xC5, 0x0A, 0x16, 0x80, 0x0F, 0x48, 0x27, 0xD3, 0xD4, 0xBC, 0x70, 0x2C, 0xA8, 0xC0, 0x0B,
+    0xC0, 0x0D, 0x22, 0x85, 0x0D, 0x22, 0x85, 0x0B, 0x40, 0x0D, 0x22, 0x85, 0x0B, 0x40, 0x0B, 0x2A,
+    0x3A, 0x3B, 0x20, 0x0D, 0x37, 0x51, 0xD1, 0xD9, 0x00, 0x0B, 0x2A, 0x3A, 0x3D, 0x37, 0x00, 0x0D,
+    0x22, 0x80, 0xC9, 0xE6, 0xF3, 0x74, 0x40, 0xA1, 0x78, 0xA3, 0x0D, 0x10, 0xC7, 0xA4, 0x00, 0xA1,
+    0x64, 0x3B, 0x2A, 0x00, 0xD1, 0x0E, 0xCA, 0x85, 0x90, 0xF4, 0x40, 0xA3, 0xC9, 0x70, 0x32, 0x54,
+    0x60, 0xA1, 0x6D, 0x87, 0x4D, 0x95, 0x00, 0xA3, 0xA4, 0x66, 0xFB, 0x9D, 0x18, 0xE0, 0x7B, 0xF7,
+    0x4C, 0x80, 0x0B, 0xEE, 0x99, 0xF7, 0xEE, 0xE0, 0xB1, 0x91, 0x63, 0x81, 0x60, 0x0B, 0xC6, 0x4E,
+    0x8C, 0x63, 0xC8, 0xBC, 0x50, 0x0B, 0xC6, 0xF3, 0xF2, 0x3F, 0xDA, 0xBC, 0x00, 0x1D, 0x97, 0x99,
+    0xC4, 0xF3, 0x2D, 0xFC, 0x8D, 0xA0, 0x02, 0x33, 0x79, 0xFA, 0xF4, 0xFB, 0xC0, 0x0D, 0x54, 0xBD,
+    0xAF, 0x63, 0xC1, 0x00, 0x0B, 0x2A, 0x3C, 0x5F, 0xE4, 0x80, 0x0D, 0x22, 0x86, 0x27, 0xCE, 0x00,
+    0xA3, 0xA4, 0x72, 0x7F, 0xDD, 0xD1, 0x80, 0x0D, 0x54, 0xB9, 0x7B, 0x5E, 0xC7, 0xAA, 0x0B, 0x2A,
+    0x3C, 0x5F, 0xCD, 0x00, 0x0B, 0xC5, 0x5D, 0x7D, 0x75, 0xDB, 0x56, 0x0B, 0x2C, 0xDE, 0x7E, 0xBB,
+    0x6D, 0x0D, 0xEA, 0xAF, 0xB5, 0xFB, 0x1F, 0x8A, 0xC9, 0xE6, 0xF9, 0x3E, 0xB4, 0x0C, 0xF7, 0x00,
+    0x0B, 0x2C, 0xF7, 0x7B, 0xDE, 0x48, 0xC9, 0xF8, 0x47, 0x37, 0x57, 0x2F, 0x06, 0x0D, 0x15, 0x15,
+    0x16, 0x88, 0xAA, 0xF0, 0x56, 0x8F, 0x05, 0x54, 0x0E, 0xCD, 0xC0, 0xFA, 0x74, 0x63, 0xB2, 0xBB,
+    0x2B, 0xB7, 0xC7, 0xEE, 0x90, 0x24, 0xD0, 0xC1, 0x55, 0xF2, 0x7C, 0x9E, 0x0B, 0x40, 0xEF, 0x3B,
+    0xCE, 0xF3, 0xDE, 0x0E, 0x0B, 0x27, 0xC1, 0x64, 0xC0, 0xA1, 0x42, 0x85, 0x0D, 0x00, 0xE0, 0x70,
+    0xD0, 0xC1, 0x7A, 0x3E, 0xF7, 0xCD, 0xE0, 0xB4, 0x63, 0x18, 0xC6, 0x30, 0x0E, 0xC3, 0x13, 0xB0,
+    0xC9, 0xE4, 0xF5, 0x8C, 0x9E, 0x4C, 0xA9, 0xDE, 0x7B, 0x80, 0xA9, 0xEE, 0x3B, 0xC0, 0x0C, 0x09,
+    0x0D, 0x37, 0x0C, 0x7A, 0x40, 0xF0, 0x2F, 0xBA, 0x4B, 0xEE, 0x90, 0x0C, 0x80, 0x03, 0xF9, 0x9D,
+    0x40, 0x98, 0xE2, 0xFF, 0xFB, 0xFF, 0x0F, 0xB1, 0xF5, 0x30, 0xDE, 0x54, 0xA9, 0xBC, 0x98, 0xE2,
+    0xF9, 0xBF, 0xF2, 0xFB, 0x1F, 0x53, 0xA3, 0xA4, 0x72, 0x7D, 0xCE, 0x8C, 0x0C, 0x1F, 0xBD, 0x70,
+    0x3B, 0x8F, 0x6B, 0xAC, 0x59, 0x80, 0xA9, 0xEE, 0x3B, 0xE3, 0x81, 0xDC, 0xBC, 0x57, 0x38, 0x10,
+    0x03, 0xA4, 0xD9, 0x9E, 0xC3, 0xA0, 0x1D, 0x97, 0x99, 0xF9, 0x9F, 0x22, 0xC8, 0x60, 0x1D, 0x97,
+    0x99, 0xF0, 0x3E, 0x25, 0x90, 0xC0, 0x1D, 0x97, 0xC8, 0xFC, 0xCF, 0x91, 0x64, 0x30, 0x1F, 0xEC,
+    0xBE, 0x27, 0xC0, 0xF8, 0x96, 0x43, 0x1D, 0x97, 0xC8, 0xE2, 0x7C, 0x8B, 0x21, 0x80, 0x1D, 0x97,
+    0xEA, 0x7C, 0x0F, 0xD4, 0xB2, 0x18, 0x22, 0xC6, 0x87, 0xFC, 0x38, 0x97, 0x8A, 0xBA, 0xBA, 0xB0,
+    0x0D, 0x54, 0xB9, 0xFC, 0x27, 0xF1, 0xC1, 0x00, 0x0B, 0xC7, 0xB1, 0xF6, 0xBA, 0xBA, 0xB0, 0x0B,
+    0xC5, 0x5F, 0x6B, 0xF6, 0x3A, 0xB0, 0x0F, 0xB4, 0x7B, 0x1F, 0x6B, 0xAB, 0xAB, 0x0B, 0xC7, 0x6B,
+    0xAB, 0xED, 0x75, 0x60, 0x0F, 0xE2, 0x18, 0x67, 0xF1, 0x00, 0x47, 0xDA, 0x00, 0x65, 0xE1, 0x80,
+    0xC8, 0xBC, 0x55, 0xD5, 0xE0, 0xB4, 0x0F, 0xB4, 0x7F, 0x53, 0xFB, 0x1F, 0xE9, 0x5E, 0x00, 0x0D,
+    0x54, 0xBD, 0x8F, 0x6B, 0x97, 0xAA, 0x0D, 0x54, 0xBD, 0xAF, 0x63, 0x97, 0xAA, 0x0D, 0x54, 0xBD,
+    0xAF, 0x63, 0xDA, 0xF5, 0x40, 0x0D, 0x56, 0xD7, 0xB1, 0xED, 0x7B, 0x1E, 0xA8, 0x0D, 0x56, 0xD7,
+    0x2F, 0x6B, 0x97, 0xAA, 0xC1, 0x66, 0x68, 0x66, 0x60, 0x80, 0x0D, 0x5C, 0xC7, 0x37, 0x8B, 0xEA,
+    0x8F, 0x40, 0x0B, 0xA4, 0xDB, 0x1D, 0xD0, 0x0B, 0xA6, 0xD3, 0x1D, 0xD0, 0x0B, 0xA6, 0xD3, 0x6E,
+    0xE8, 0x0B, 0xA6, 0xC6, 0xDD, 0xD0, 0x93, 0x02, 0x87, 0xED, 0x1F, 0xD0, 0xC0, 0x90, 0x0B, 0xC6,
+    0x0B, 0x05, 0x82, 0xD0, 0x0D, 0x62, 0x55, 0x5F, 0x9B, 0xE0, 0x80, 0x02, 0x3C, 0x9F, 0x27, 0xA4,
+    0x00, 0x02, 0x39, 0x3F, 0x27, 0xA4, 0x00, 0x02, 0x39, 0x3F, 0x27, 0xE9, 0x00, 0x09, 0x8F, 0x27,
+    0xC9, 0xFD, 0x60, 0x02, 0x39, 0x3C, 0xDF, 0xA4, 0x00, 0x02, 0x3F, 0xF3, 0xFF, 0xAF, 0xF7, 0x80,
+    0x0C, 0xA3, 0x37, 0x9B, 0xB2, 0xCD, 0xE6, 0xEC, 0xC0, 0x0B, 0x2A, 0x7E, 0x14, 0xFC, 0x72, 0x40,
+    0x0B, 0x2F, 0x27, 0xC9, 0xD9, 0x80, 0x0B, 0x2E, 0x4F, 0xC9, 0xD9, 0x80, 0x0B, 0x2E, 0x4F, 0xC9,
+    0xF3, 0x60, 0x0B, 0x2E, 0x4F, 0x37, 0xCD, 0x80, 0x0F, 0xAC, 0x48, 0x93, 0xEB, 0x00, 0x93, 0xEB,
+    0x12, 0x93, 0x48, 0x90, 0x0B, 0x2C, 0x5F, 0x63, 0xD1, 0x00, 0x0F, 0x48, 0xEB, 0x31, 0x3E, 0x70,
+    0x0B, 0x2E, 0xB7, 0x8B, 0xB2, 0x0B, 0x2C, 0x5F, 0x5B, 0xB2, 0x0B, 0x2C, 0x5F, 0x5B, 0xE6, 0x80,
+    0x0E, 0x6B, 0xAD, 0xE2, 0xFE, 0x68, 0x0B, 0x2C, 0x5D, 0x1F, 0x34, 0xC8, 0xC8, 0xF6, 0xAC, 0x8C,
+    0x80, 0x0B, 0x3C, 0xE3, 0xB9, 0xE6, 0x80, 0x0D, 0x17, 0x43, 0x97, 0xA4, 0x00, 0x0D, 0x14, 0xBE,
+    0x87, 0xA4, 0x00, 0x0F, 0x45, 0xD0, 0xE5, 0xE9, 0x00, 0x0D, 0x14, 0xB1, 0xFA, 0x40, 0xA1, 0x6D,
+    0x93, 0xD3, 0xF3, 0x54, 0x0B, 0xEE, 0xA3, 0xA3, 0xB2, 0xA1, 0xCF, 0x61, 0xD3, 0xCD, 0x50,
+};
+const uint8_t ArialMT_Plain_10_PL_huffman[] PROGMEM = {
+    0x00, 0x01, 0x02, 0x02, 0x04, 0x06, 0x08, 0x0D, 0x0D, 0x0B, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x08, 0x20, 0x48, 0xC0, 0xF8, 0x10, 0x28, 0x40, 0xA0, 0xE0, 0xF0, 0x09,
+    0x0A, 0x0F, 0x30, 0x80, 0x88, 0xA8, 0xC8, 0x04, 0x06, 0x18, 0x24, 0x38, 0x4A, 0x60, 0x68, 0x70,
+    0x90, 0xA4, 0xB0, 0xE8, 0x07, 0x0E, 0x49, 0x50, 0x58, 0x78, 0x8A, 0xB1, 0xB2, 0xC4, 0xD0, 0xE4,
+    0xFA, 0x05, 0x0B, 0x16, 0x1A, 0x44, 0x89, 0xB8, 0xBE, 0xC2, 0xEE, 0xF9, 0x0D, 0x14, 0x21, 0x31,
+    0x42, 0x64, 0x69, 0x6A, 0x81, 0x82, 0x98, 0xAA, 0xAE, 0xCA,
+};
+const CompressedFont ArialMT_Plain_10_PL = {ArialMT_Plain_10_PL_header, ArialMT_Plain_10_PL_data, ArialMT_Plain_10_PL_huffman};
+
+const uint8_t ArialMT_Plain_16_PL_header[] PROGMEM = {
+    0x10, 0x13, 0x20, 0xE0, 0xFF, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x03, 0x0D, 0x06,
+    0x00, 0x07, 0x1A, 0x0A, 0x00, 0x16, 0x17, 0x09, 0x00, 0x23, 0x26, 0x0E, 0x00, 0x37, 0x1D, 0x0B,
+    0x00, 0x46, 0x04, 0x03, 0x00, 0x48, 0x0C, 0x05, 0x00, 0x4F, 0x0B, 0x05, 0x00, 0x55, 0x0D, 0x06,
+    0x00, 0x5B, 0x17, 0x09, 0x00, 0x63, 0x09, 0x04, 0x00, 0x66, 0x0B, 0x05, 0x00, 0x69, 0x08, 0x04,
+    0x00, 0x6B, 0x0A, 0x05, 0x00, 0x71, 0x17, 0x09, 0x00, 0x7C, 0x11, 0x07, 0x00, 0x81, 0x17, 0x09,
+    0x00, 0x8C, 0x17, 0x09, 0x00, 0x97, 0x17, 0x09, 0x00, 0xA1, 0x17, 0x09, 0x00, 0xAE, 0x17, 0x09,
+    0x00, 0xBB, 0x16, 0x09, 0x00, 0xC4, 0x17, 0x09, 0x00, 0xD1, 0x17, 0x09, 0x00, 0xDE, 0x05, 0x03,
+    0x00, 0xE0, 0x06, 0x03, 0x00, 0xE3, 0x17, 0x09, 0x00, 0xEC, 0x17, 0x09, 0x00, 0xF5, 0x17, 0x09,
+    0x00, 0xFE, 0x16, 0x09, 0x01, 0x07, 0x2F, 0x11, 0x01, 0x28, 0x1D, 0x0B, 0x01, 0x36, 0x1D, 0x0B,
+    0x01, 0x45, 0x20, 0x0C, 0x01, 0x53, 0x20, 0x0C, 0x01, 0x61, 0x1D, 0x0B, 0x01, 0x6E, 0x19, 0x0A,
+    0x01, 0x79, 0x20, 0x0C, 0x01, 0x89, 0x1D, 0x0B, 0x01, 0x94, 0x05, 0x03, 0x01, 0x96, 0x14, 0x08,
+    0x01, 0x9D, 0x1D, 0x0B, 0x01, 0xAA, 0x17, 0x09, 0x01, 0xB1, 0x23, 0x0D, 0x01, 0xBF, 0x1D, 0x0B,
+    0x01, 0xCA, 0x20, 0x0C, 0x01, 0xD8, 0x1C, 0x0B, 0x01, 0xE5, 0x20, 0x0C, 0x01, 0xF5, 0x1D, 0x0B,
+    0x02, 0x04, 0x1D, 0x0B, 0x02, 0x13, 0x19, 0x0A, 0x02, 0x1B, 0x1D, 0x0B, 0x02, 0x25, 0x1C, 0x0B,
+    0x02, 0x31, 0x2B, 0x10, 0x02, 0x45, 0x20, 0x0C, 0x02, 0x55, 0x19, 0x0A, 0x02, 0x5F, 0x1A, 0x0A,
+    0x02, 0x6D, 0x0C, 0x05, 0x02, 0x73, 0x0B, 0x05, 0x02, 0x79, 0x09, 0x04, 0x02, 0x7F, 0x14, 0x08,
+    0x02, 0x87, 0x1B, 0x0A, 0x02, 0x90, 0x07, 0x04, 0x02, 0x92, 0x17, 0x09, 0x02, 0x9D, 0x17, 0x09,
+    0x02, 0xA7, 0x14, 0x08, 0x02, 0xAF, 0x17, 0x09, 0x02, 0xB9, 0x17, 0x09, 0x02, 0xC4, 0x0A, 0x05,
+    0x02, 0xC9, 0x17, 0x09, 0x02, 0xD7, 0x14, 0x08, 0x02, 0xDE, 0x05, 0x03, 0x02, 0xE1, 0x06, 0x03,
+    0x02, 0xE5, 0x17, 0x09, 0x02, 0xEF, 0x05, 0x03, 0x02, 0xF1, 0x23, 0x0D, 0x02, 0xFD, 0x14, 0x08,
+    0x03, 0x04, 0x17, 0x09, 0x03, 0x0D, 0x17, 0x09, 0x03, 0x18, 0x18, 0x09, 0x03, 0x23, 0x0D, 0x06,
+    0x03, 0x28, 0x14, 0x08, 0x03, 0x32, 0x0B, 0x05, 0x03, 0x37, 0x14, 0x08, 0x03, 0x3E, 0x13, 0x08,
+    0x03, 0x46, 0x1F, 0x0C, 0x03, 0x52, 0x14, 0x08, 0x03, 0x5B, 0x13, 0x08, 0x03, 0x66, 0x14, 0x08,
+    0x03, 0x70, 0x0F, 0x06, 0x03, 0x78, 0x06, 0x03, 0x03, 0x7C, 0x0E, 0x06, 0x03, 0x84, 0x17, 0x09,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0x03, 0x8C, 0x17, 0x09, 0x03, 0x94, 0x07, 0x04,
+    0x03, 0x98, 0x1D, 0x0B, 0x03, 0xA5, 0x1E, 0x0B, 0x03, 0xB5, 0x1B, 0x0A, 0x03, 0xC2, 0x20, 0x0C,
+    0x03, 0xD0, 0x14, 0x08, 0x03, 0xD9, 0x14, 0x08, 0x03, 0xE1, 0x14, 0x08, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0x03, 0xEC, 0x20, 0x0C, 0x03, 0xFB, 0x17, 0x09, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0x04, 0x05, 0x1D, 0x0B, 0x04, 0x14, 0x17, 0x09, 0x04, 0x21, 0x1D, 0x0B,
+    0x04, 0x31, 0x14, 0x08, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0x04, 0x3C, 0x09, 0x04, 0x04, 0x40, 0x17, 0x09,
+    0x04, 0x4D, 0x17, 0x09, 0x04, 0x5A, 0x14, 0x08, 0x04, 0x64, 0x1A, 0x0A, 0x04, 0x74, 0x06, 0x03,
+    0x04, 0x78, 0x17, 0x09, 0x04, 0x8B, 0x07, 0x04, 0x04, 0x8D, 0x23, 0x0D, 0x04, 0xA3, 0x0E, 0x06,
+    0x04, 0xAC, 0x14, 0x08, 0x04, 0xB4, 0x17, 0x09, 0x04, 0xBC, 0x0B, 0x05, 0x04, 0xBF, 0x23, 0x0D,
+    0x04, 0xD6, 0x19, 0x0A, 0x04, 0xDF, 0x0D, 0x06, 0x04, 0xE4, 0x17, 0x09, 0x04, 0xED, 0x0E, 0x06,
+    0x04, 0xF6, 0x0D, 0x06, 0x04, 0xFE, 0x0A, 0x05, 0x05, 0x01, 0x17, 0x09, 0x05, 0x0A, 0x19, 0x0A,
+    0x05, 0x18, 0x08, 0x04, 0x05, 0x1A, 0x0C, 0x05, 0x05, 0x1E, 0x1A, 0x0A, 0x05, 0x2D, 0x0D, 0x06,
+    0x05, 0x34, 0x1A, 0x0A, 0x05, 0x42, 0x14, 0x08, 0x05, 0x4D, 0x26, 0x0E, 0x05, 0x5F, 0x26, 0x0E,
+    0x05, 0x73, 0x1A, 0x0A, 0x05, 0x7E, 0x1D, 0x0B, 0x05, 0x8C, 0x1D, 0x0B, 0x05, 0x9A, 0x1D, 0x0B,
+    0x05, 0xAA, 0x1D, 0x0B, 0x05, 0xBA, 0x1D, 0x0B, 0x05, 0xC8, 0x1D, 0x0B, 0x05, 0xD7, 0x2C, 0x10,
+    0x05, 0xED, 0x20, 0x0C, 0x05, 0xFD, 0x1D, 0x0B, 0x06, 0x0B, 0x1D, 0x0B, 0x06, 0x19, 0x1D, 0x0B,
+    0x06, 0x28, 0x1D, 0x0B, 0x06, 0x36, 0x05, 0x03, 0x06, 0x3A, 0x07, 0x04, 0x06, 0x3E, 0x0A, 0x05,
+    0x06, 0x44, 0x07, 0x04, 0x06, 0x48, 0x20, 0x0C, 0x06, 0x58, 0x1D, 0x0B, 0x06, 0x66, 0x20, 0x0C,
+    0x06, 0x75, 0x20, 0x0C, 0x06, 0x84, 0x20, 0x0C, 0x06, 0x94, 0x20, 0x0C, 0x06, 0xA4, 0x20, 0x0C,
+    0x06, 0xB3, 0x17, 0x09, 0x06, 0xBD, 0x20, 0x0C, 0x06, 0xD0, 0x1D, 0x0B, 0x06, 0xDB, 0x1D, 0x0B,
+    0x06, 0xE6, 0x1D, 0x0B, 0x06, 0xF2, 0x1D, 0x0B, 0x06, 0xFD, 0x19, 0x0A, 0x07, 0x09, 0x1D, 0x0B,
+    0x07, 0x16, 0x17, 0x09, 0x07, 0x21, 0x17, 0x09, 0x07, 0x2D, 0x17, 0x09, 0x07, 0x39, 0x17, 0x09,
+    0x07, 0x46, 0x17, 0x09, 0x07, 0x53, 0x17, 0x09, 0x07, 0x5F, 0x17, 0x09, 0x07, 0x6D, 0x29, 0x0F,
+    0x07, 0x81, 0x14, 0x08, 0x07, 0x8B, 0x17, 0x09, 0x07, 0x97, 0x17, 0x09, 0x07, 0xA3, 0x17, 0x09,
+    0x07, 0xAF, 0x17, 0x09, 0x07, 0xBB, 0x05, 0x03, 0x07, 0xBE, 0x07, 0x04, 0x07, 0xC1, 0x0A, 0x05,
+    0x07, 0xC6, 0x07, 0x04, 0x07, 0xCA, 0x17, 0x09, 0x07, 0xD7, 0x14, 0x08, 0x07, 0xE0, 0x17, 0x09,
+    0x07, 0xEA, 0x17, 0x09, 0x07, 0xF4, 0x17, 0x09, 0x07, 0xFF, 0x17, 0x09, 0x08, 0x0A, 0x17, 0x09,
+    0x08, 0x14, 0x17, 0x09, 0x08, 0x1C, 0x17, 0x09, 0x08, 0x28, 0x14, 0x08, 0x08, 0x30, 0x14, 0x08,
+    0x08, 0x38, 0x14, 0x08, 0x08, 0x41, 0x14, 0x08, 0x08, 0x49, 0x13, 0x08, 0x08, 0x55, 0x17, 0x09,
+    0x08, 0x60, 0x13, 0x08,
+};
+const uint8_t ArialMT_Plain_16_PL_data[] PROGMEM = {
+    0x03, 0x5F, 0xDA, 0x1F, 0x78, 0x07, 0xDE, 0xB4, 0x2D, 0xF7, 0xB4, 0xDC, 0xFC, 0x61, 0x68, 0x5B,
+    0xEF, 0x69, 0xB9, 0xF8, 0xC2, 0xD0, 0x1E, 0x54, 0x53, 0xD4, 0x8C, 0x5F, 0xFF, 0xF3, 0x47, 0x7A,
+    0x9D, 0x6A, 0xEF, 0x1F, 0x22, 0x2E, 0x45, 0xC8, 0xFD, 0xCF, 0x97, 0x51, 0xE7, 0x69, 0x73, 0xBB,
+    0xF4, 0xA3, 0xBC, 0xEF, 0x3B, 0xCF, 0xD2, 0x0D, 0xEF, 0x0E, 0xB7, 0x8E, 0x28, 0xF7, 0x3C, 0x72,
+    0x78, 0x76, 0x94, 0x3B, 0x4C, 0x80, 0x1F, 0x78, 0x16, 0xF6, 0xBC, 0x34, 0xBA, 0x17, 0x80, 0x10,
+    0xBF, 0xC3, 0x4B, 0xAD, 0xED, 0xA1, 0xF9, 0x1E, 0xB3, 0xF2, 0x28, 0x0B, 0xCB, 0xCB, 0xDA, 0x70,
+    0x2F, 0x2F, 0x2F, 0x01, 0xA5, 0xC0, 0x41, 0x04, 0x10, 0x01, 0x20, 0x73, 0x3D, 0x2F, 0x2B, 0x9D,
+    0x40, 0x1E, 0x5C, 0x14, 0xAA, 0x25, 0x12, 0x89, 0x52, 0xAF, 0x2E, 0x00, 0x02, 0x4A, 0x94, 0x35,
+    0xCC, 0x15, 0x95, 0x39, 0xA3, 0x92, 0x38, 0xA3, 0x25, 0x3D, 0xCF, 0x29, 0x15, 0xA2, 0x95, 0x46,
+    0x28, 0xC5, 0xE3, 0x8B, 0xE5, 0xD6, 0x6F, 0x7D, 0x26, 0xD3, 0xA5, 0xA4, 0x2B, 0x0A, 0x43, 0x5C,
+    0xC8, 0x1A, 0x7E, 0x67, 0xE3, 0x57, 0x8C, 0xBC, 0x65, 0xE3, 0x28, 0xF5, 0x23, 0xD2, 0x1E, 0x5C,
+    0x14, 0xF5, 0x3C, 0x65, 0xE3, 0x2F, 0x19, 0x53, 0xD4, 0xAF, 0xA4, 0x10, 0x41, 0x1F, 0x7A, 0x3A,
+    0x1F, 0x13, 0xB4, 0xEA, 0x1C, 0xF7, 0xBE, 0x1D, 0x68, 0xC5, 0x18, 0xA3, 0x17, 0xC3, 0xAD, 0xCF,
+    0x78, 0x1E, 0x5F, 0x99, 0x4E, 0xB4, 0x64, 0x8C, 0x91, 0x92, 0x9D, 0x6F, 0x2E, 0x00, 0x13, 0x20,
+    0x13, 0xA5, 0xC0, 0x0B, 0xCF, 0x31, 0xE6, 0x5A, 0x16, 0x85, 0xA1, 0x34, 0x16, 0x85, 0xA1, 0x68,
+    0x5A, 0x16, 0x85, 0xA1, 0x68, 0x13, 0x45, 0xA1, 0x68, 0x5A, 0x0F, 0x31, 0xE6, 0x2F, 0x1C, 0xCA,
+    0x10, 0x47, 0xEC, 0x45, 0xEA, 0x5C, 0xF2, 0x0F, 0x6B, 0x49, 0x56, 0xCA, 0x7A, 0x6E, 0xA7, 0xAA,
+    0xEF, 0x19, 0xBF, 0x8C, 0xDF, 0xC6, 0x6F, 0xE3, 0x5B, 0xFC, 0x7F, 0xD2, 0xFF, 0x8F, 0xBA, 0xFA,
+    0x4D, 0xF4, 0xAD, 0xDC, 0xE9, 0x75, 0xBF, 0xDC, 0x0E, 0x66, 0xF5, 0xBA, 0x1E, 0x18, 0x23, 0x07,
+    0x86, 0x0B, 0x74, 0x1B, 0xCE, 0x60, 0x1A, 0xE6, 0x8C, 0x51, 0x8A, 0x31, 0x46, 0x28, 0xC5, 0x18,
+    0xBE, 0x1D, 0x6E, 0x7B, 0xC0, 0x1A, 0x6E, 0x56, 0x8A, 0x55, 0x12, 0x89, 0x44, 0xA2, 0x51, 0x2A,
+    0x55, 0x5A, 0x00, 0x1A, 0xE6, 0x89, 0x44, 0xA2, 0x51, 0x28, 0x94, 0x4A, 0x95, 0x56, 0x8D, 0x37,
+    0x00, 0x1A, 0xE6, 0x8C, 0x51, 0x8A, 0x31, 0x46, 0x28, 0xC5, 0x18, 0xA3, 0x14, 0x48, 0x1A, 0xE6,
+    0x8B, 0xD1, 0x7A, 0x2F, 0x45, 0xE8, 0xBD, 0x17, 0xA0, 0x1A, 0x6E, 0x56, 0x8A, 0x55, 0x12, 0x89,
+    0x47, 0x7A, 0x3B, 0xD4, 0xEB, 0x57, 0xFA, 0xCF, 0xEA, 0x1A, 0xE6, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x5C, 0x5C, 0xD7, 0x30, 0x1A, 0xE6, 0x0F, 0x59, 0x24, 0x92, 0x4B, 0x5F, 0x68, 0x1A, 0xE6, 0x60,
+    0x5E, 0x5C, 0xB6, 0xC4, 0xE0, 0xAF, 0x52, 0x95, 0x44, 0x80, 0x1A, 0xE6, 0x49, 0x24, 0x92, 0x49,
+    0x20, 0x1A, 0xE6, 0xEE, 0x34, 0x1B, 0x0D, 0xE7, 0x33, 0x79, 0xB1, 0xA1, 0xDC, 0x6B, 0x98, 0x1A,
+    0xE6, 0xA1, 0xCC, 0xB0, 0xD8, 0x60, 0x75, 0x15, 0x6B, 0x98, 0x1A, 0x6E, 0x56, 0x8A, 0x55, 0x12,
+    0x89, 0x44, 0xA2, 0x54, 0xAA, 0xB4, 0x69, 0xB8, 0x1A, 0xE6, 0x8B, 0xD1, 0x7A, 0x2F, 0x45, 0xE8,
+    0xBD, 0x17, 0xA9, 0x73, 0xC8, 0x1A, 0x6E, 0x56, 0x8A, 0x55, 0x12, 0x89, 0x47, 0x24, 0x72, 0x52,
+    0xAA, 0xF8, 0x34, 0xFA, 0xC0, 0x1A, 0xE6, 0x8B, 0xD1, 0x7A, 0x2F, 0x45, 0xE8, 0xF3, 0xA3, 0xFB,
+    0x54, 0xF5, 0x3C, 0xA4, 0x1C, 0xE8, 0xF8, 0x55, 0x18, 0xA3, 0x14, 0x62, 0x8E, 0xF4, 0x77, 0xA9,
+    0xD6, 0xAE, 0xF0, 0x82, 0x08, 0x20, 0xD7, 0x34, 0x10, 0x41, 0x00, 0x1A, 0xF0, 0x2A, 0x49, 0x24,
+    0x92, 0x49, 0x56, 0xBC, 0x00, 0x1D, 0x47, 0x90, 0xE8, 0x3A, 0x8E, 0x67, 0x51, 0xD0, 0xF2, 0x3A,
+    0x80, 0xEA, 0x3C, 0xAE, 0x3D, 0x27, 0x33, 0x7A, 0xDB, 0x1E, 0x04, 0x1E, 0x05, 0xB6, 0x1B, 0xCE,
+    0x67, 0xA5, 0xE5, 0x73, 0xA8, 0x4A, 0x2A, 0xA5, 0x1C, 0xFE, 0x95, 0xAF, 0x2E, 0x5A, 0xF7, 0x3F,
+    0xA5, 0x4A, 0x22, 0xA4, 0x80, 0x83, 0xB8, 0x92, 0xD7, 0x1F, 0x82, 0xD7, 0x24, 0xEE, 0x20, 0x4A,
+    0x39, 0xA3, 0xDE, 0x8C, 0x91, 0xEE, 0x78, 0xCB, 0xEC, 0x97, 0x54, 0xA2, 0x40, 0x1A, 0xFC, 0xF6,
+    0x42, 0xF8, 0x5E, 0xEA, 0x3C, 0xAE, 0x3D, 0x27, 0x30, 0x85, 0xF0, 0xBF, 0x5F, 0x9E, 0xC0, 0x5C,
+    0xD0, 0xEE, 0x20, 0xEE, 0x34, 0x17, 0x00, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+    0x10, 0x50, 0x0F, 0x62, 0xD9, 0x27, 0x24, 0xE4, 0x9E, 0xF4, 0xF5, 0xAD, 0x98, 0x1A, 0xE6, 0xB5,
+    0x53, 0x29, 0x94, 0xCA, 0xD5, 0x38, 0x00, 0x0E, 0x0B, 0x55, 0x32, 0x99, 0x4C, 0xAD, 0x50, 0x0E,
+    0x0B, 0x55, 0x32, 0x99, 0x4C, 0xAD, 0x56, 0xB9, 0x80, 0x0E, 0x0B, 0x76, 0x27, 0x24, 0xE4, 0x9C,
+    0x96, 0xEC, 0x3D, 0x00, 0x93, 0xE5, 0x9B, 0x89, 0xC4, 0x0E, 0x17, 0x5A, 0xB7, 0xCC, 0xDF, 0x33,
+    0x7C, 0xCD, 0xF6, 0xAD, 0xDA, 0x7C, 0xC0, 0x1A, 0xE6, 0xB1, 0x24, 0x92, 0x5B, 0x30, 0x1F, 0x1C,
+    0xC0, 0x2F, 0xF8, 0xFC, 0xEE, 0x1A, 0xE6, 0x41, 0x81, 0xE7, 0x3F, 0xB1, 0x6A, 0xA6, 0x40, 0x1A,
+    0xE6, 0x1A, 0x66, 0xB1, 0x24, 0x92, 0x5B, 0x35, 0x89, 0x24, 0x92, 0xD9, 0x80, 0x1A, 0x66, 0xB1,
+    0x24, 0x92, 0x5B, 0x30, 0x0E, 0x0B, 0x55, 0x32, 0x99, 0x4C, 0xAD, 0x53, 0x80, 0x1A, 0x7C, 0xF6,
+    0x5A, 0xA9, 0x94, 0xCA, 0x65, 0x6A, 0x9C, 0x00, 0x0E, 0x0B, 0x55, 0x32, 0x99, 0x4C, 0xAD, 0x56,
+    0x9F, 0x3D, 0x80, 0x1A, 0x66, 0xB1, 0x24, 0x80, 0x16, 0xFC, 0xE9, 0xC9, 0x39, 0x27, 0x24, 0xE4,
+    0xB7, 0xAC, 0x93, 0xE5, 0x9A, 0x65, 0x32, 0x1A, 0x7B, 0x49, 0x24, 0x92, 0xAD, 0x33, 0xD0, 0x6C,
+    0x37, 0x9C, 0xCD, 0xE6, 0xC6, 0x80, 0xD0, 0x70, 0x39, 0x9B, 0xCD, 0x8D, 0x06, 0xC3, 0x79, 0xCC,
+    0xE0, 0xD0, 0x99, 0x5A, 0xA7, 0xD4, 0x60, 0x7D, 0x4B, 0x55, 0x32, 0xD2, 0xE3, 0xCF, 0x7B, 0xD7,
+    0x7B, 0xCA, 0xE7, 0xAC, 0xE8, 0x68, 0x99, 0x4F, 0x34, 0xFB, 0xD3, 0x92, 0x7D, 0xCD, 0x25, 0x32,
+    0x60, 0x60, 0xF9, 0x7F, 0x4B, 0xA1, 0x7C, 0x2F, 0x1A, 0xFC, 0xF6, 0x00, 0x85, 0xF0, 0xBF, 0xE5,
+    0xFD, 0x2E, 0x60, 0x60, 0x5E, 0x5C, 0x5C, 0x5C, 0x5E, 0x5E, 0x5E, 0x5C, 0x1A, 0xE6, 0x77, 0x98,
+    0xAD, 0x24, 0x92, 0x48, 0x5C, 0xD7, 0x35, 0x80, 0x1A, 0xE6, 0xA1, 0xCC, 0xB1, 0x1B, 0x18, 0x60,
+    0xBF, 0xA8, 0xAB, 0x5C, 0xC0, 0x0E, 0x66, 0xF5, 0xBA, 0x1E, 0x18, 0x23, 0x07, 0x86, 0x0B, 0x74,
+    0x1F, 0xF1, 0x73, 0x9D, 0xE0, 0x0F, 0x62, 0xD9, 0x27, 0x24, 0xE4, 0x9E, 0xF4, 0xF5, 0xAD, 0x9E,
+    0xC5, 0xB0, 0x1A, 0x6E, 0x56, 0x8A, 0x55, 0x12, 0x89, 0x44, 0xB6, 0xCB, 0xA6, 0x54, 0xAA, 0xB4,
+    0x0E, 0x0B, 0x55, 0x32, 0xE5, 0x2E, 0x32, 0xB5, 0x40, 0x1A, 0x66, 0xB1, 0x27, 0x23, 0x89, 0x6C,
+    0xC0, 0x99, 0x4F, 0x34, 0xFB, 0xDC, 0xB2, 0x71, 0xF7, 0x34, 0x94, 0xC8, 0x1A, 0x6E, 0x56, 0x8A,
+    0x55, 0x12, 0x89, 0x6D, 0x97, 0x4C, 0xA9, 0x55, 0x68, 0xD3, 0x70, 0x0E, 0x0B, 0x55, 0x32, 0xE5,
+    0x2E, 0x32, 0xB5, 0x4E, 0x00, 0x1A, 0xE6, 0x8C, 0x51, 0x8A, 0x31, 0x46, 0x28, 0xFF, 0xAB, 0xA3,
+    0x1B, 0xE3, 0x14, 0x48, 0x0E, 0x0B, 0x76, 0x27, 0x24, 0xE5, 0xB2, 0x7F, 0xEF, 0x0B, 0x76, 0x1E,
+    0x80, 0x1C, 0xE8, 0xF8, 0x55, 0x18, 0xA3, 0x16, 0xDC, 0x5D, 0x3D, 0xE8, 0xEF, 0x53, 0xAD, 0x5D,
+    0xE0, 0x16, 0xFC, 0xE9, 0xC9, 0x39, 0x39, 0x64, 0xE3, 0x92, 0xDE, 0xB0, 0x02, 0x7E, 0x7B, 0x00,
+    0x0E, 0x0B, 0x57, 0x64, 0xFC, 0x93, 0xFE, 0x2D, 0x31, 0x7E, 0x35, 0x3F, 0x30, 0x62, 0xF2, 0xFD,
+    0x0A, 0x7F, 0x72, 0x3D, 0x48, 0xF5, 0x22, 0x54, 0x95, 0x6A, 0x13, 0xF4, 0x2D, 0x82, 0x61, 0x30,
+    0xB6, 0x09, 0xFA, 0x00, 0x8D, 0xAA, 0x6D, 0x73, 0xDA, 0xB7, 0xD0, 0x7E, 0x0B, 0x7D, 0x0E, 0x7B,
+    0x54, 0xDA, 0x8D, 0xA0, 0x1A, 0xFF, 0xEE, 0xC0, 0x7F, 0xAB, 0xC3, 0xA6, 0xEF, 0x8D, 0x2F, 0xF1,
+    0xA5, 0xF1, 0xEA, 0xBE, 0x3F, 0x75, 0xFD, 0xDF, 0xF9, 0x73, 0xE9, 0x80, 0x40, 0xD3, 0x72, 0xB4,
+    0x52, 0xAF, 0x8F, 0xF8, 0x3B, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xB8, 0xE4, 0xA5, 0x55,
+    0xA3, 0x4D, 0xC0, 0xFC, 0x8E, 0x37, 0x3B, 0x6E, 0x76, 0xDC, 0xF9, 0x5C, 0x0C, 0x0F, 0xA9, 0x6A,
+    0x98, 0x1F, 0x52, 0xD5, 0x16, 0x2C, 0x58, 0xB1, 0x62, 0xC5, 0xB7, 0x00, 0x41, 0x04, 0x10, 0xD3,
+    0x72, 0xB4, 0x52, 0xAF, 0xE5, 0xF5, 0xBB, 0x71, 0x76, 0xE2, 0xED, 0xF7, 0x3B, 0x7F, 0xBD, 0xF1,
+    0xE2, 0xA5, 0x55, 0xA3, 0x4D, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x1D,
+    0xC7, 0x13, 0x89, 0xDC, 0x0C, 0x4C, 0x4C, 0x5E, 0x5F, 0x59, 0x89, 0x89, 0x88, 0xA5, 0xCF, 0x1B,
+    0x9C, 0x6E, 0x71, 0xB9, 0xDD, 0x70, 0xF8, 0x11, 0x72, 0x2E, 0x76, 0xDC, 0xFE, 0x20, 0x02, 0x84,
+    0x00, 0x1A, 0x7C, 0xF6, 0x2A, 0x49, 0x24, 0x95, 0x69, 0x98, 0xF9, 0x1A, 0x9A, 0xDC, 0xD6, 0xE6,
+    0xBF, 0x3D, 0x90, 0x41, 0xAF, 0xCF, 0x64, 0x00, 0x01, 0x78, 0x05, 0xEB, 0x5E, 0x6C, 0x4A, 0x39,
+    0xA3, 0xDE, 0x8C, 0x9B, 0x7D, 0xCF, 0xF6, 0x97, 0xD9, 0x2E, 0xA9, 0x44, 0x80, 0xF9, 0x11, 0x72,
+    0x2E, 0x45, 0xCF, 0x90, 0x4A, 0x39, 0xA3, 0xDE, 0x8C, 0x9B, 0x7D, 0xCF, 0x19, 0x7D, 0x92, 0xEA,
+    0x94, 0x48, 0x99, 0x4F, 0x34, 0xFB, 0xDC, 0xB2, 0x4F, 0xB9, 0xA4, 0xA6, 0x40, 0x14, 0x22, 0x5A,
+    0xFE, 0x82, 0x0C, 0x0D, 0x8B, 0x1C, 0xF2, 0x53, 0xFC, 0xD1, 0xFA, 0xCF, 0xD6, 0x7E, 0xA0, 0xF8,
+    0x11, 0x72, 0x31, 0x76, 0xFA, 0x9F, 0xC7, 0xA8, 0xC0, 0xD8, 0xB1, 0x3D, 0xCE, 0xEE, 0xD4, 0x76,
+    0x1F, 0x81, 0x50, 0x0F, 0x22, 0x97, 0x22, 0xF9, 0xE8, 0xBC, 0xBC, 0xBC, 0xB9, 0xA0, 0x0E, 0x66,
+    0xF5, 0xBA, 0x1F, 0x6E, 0x0D, 0xB8, 0x3C, 0x30, 0x5B, 0xA0, 0xDE, 0x73, 0x0E, 0x66, 0xF5, 0xBA,
+    0x1E, 0x18, 0x36, 0xE0, 0xFB, 0x70, 0x5B, 0xA0, 0xDE, 0x73, 0x0E, 0x66, 0xF5, 0xBA, 0x1F, 0x76,
+    0x0E, 0x9C, 0x1F, 0x6E, 0x0F, 0xE1, 0xD0, 0x6F, 0x39, 0x80, 0x0E, 0x66, 0xF5, 0xBA, 0x1F, 0x76,
+    0x0E, 0x9C, 0x1F, 0x76, 0x0F, 0xDF, 0xD0, 0x6F, 0x39, 0x80, 0x0E, 0x66, 0xF5, 0xBA, 0x1F, 0x76,
+    0x08, 0xC1, 0xF7, 0x60, 0xB7, 0x41, 0xBC, 0xE6, 0x0E, 0x66, 0xF5, 0xBA, 0x1F, 0x86, 0x0D, 0xB8,
+    0x3F, 0x0C, 0x16, 0xE8, 0x37, 0x9C, 0xC0, 0x73, 0x3A, 0x8F, 0x3A, 0xDE, 0x67, 0x3C, 0x1D, 0x58,
+    0x23, 0x04, 0x60, 0xD7, 0x34, 0x62, 0x8C, 0x51, 0x8A, 0x31, 0x46, 0x28, 0xC4, 0x1A, 0x6E, 0x56,
+    0x8A, 0x55, 0x12, 0x89, 0xBE, 0x34, 0xBE, 0x27, 0x64, 0x4A, 0x95, 0x56, 0x80, 0x1A, 0xE6, 0x8C,
+    0x51, 0x8A, 0x31, 0x74, 0xE2, 0xDB, 0x8A, 0x31, 0x46, 0x28, 0x90, 0x1A, 0xE6, 0x8C, 0x51, 0x8A,
+    0x31, 0x6D, 0xC5, 0xD3, 0x8A, 0x31, 0x46, 0x28, 0x90, 0x1A, 0xE6, 0x8C, 0x51, 0x8B, 0x6E, 0x2E,
+    0x9C, 0x5D, 0x38, 0xB6, 0xE2, 0x8C, 0x51, 0x20, 0x1A, 0xE6, 0x8C, 0x51, 0x8B, 0x6E, 0x28, 0xC5,
+    0xB7, 0x14, 0x62, 0x8C, 0x51, 0x20, 0xB8, 0xFE, 0x79, 0x80, 0x1F, 0xCF, 0x35, 0xC0, 0xBC, 0xFF,
+    0xEC, 0xD7, 0x17, 0x80, 0xBC, 0xD7, 0x35, 0xE0, 0x5E, 0xD7, 0x34, 0x77, 0xA3, 0xBD, 0x1D, 0xE8,
+    0xEF, 0x44, 0xA2, 0x54, 0xAA, 0xB4, 0x69, 0xB8, 0x1A, 0xE6, 0xA1, 0xCC, 0xFE, 0x05, 0xDB, 0x17,
+    0xE0, 0xBB, 0xA8, 0xAB, 0x5C, 0xC0, 0x1A, 0x6E, 0x56, 0x8A, 0x55, 0x12, 0xE9, 0x96, 0xD9, 0x44,
+    0xA9, 0x55, 0x68, 0xD3, 0x70, 0x1A, 0x6E, 0x56, 0x8A, 0x55, 0x12, 0xDB, 0x2E, 0x99, 0x44, 0xA9,
+    0x55, 0x68, 0xD3, 0x70, 0x1A, 0x6E, 0x56, 0x8A, 0x55, 0xB6, 0x5D, 0x32, 0xE9, 0x96, 0xD9, 0x52,
+    0xAA, 0xD1, 0xA6, 0xE0, 0x1A, 0x6E, 0x56, 0x8A, 0x55, 0xB6, 0x5D, 0x32, 0xDB, 0x2E, 0x99, 0x52,
+    0xAA, 0xD1, 0xA6, 0xE0, 0x1A, 0x6E, 0x56, 0x8A, 0x55, 0x12, 0xDB, 0x28, 0x96, 0xD9, 0x52, 0xAA,
+    0xD1, 0xA6, 0xE0, 0x13, 0x45, 0xA0, 0xF3, 0x1D, 0x07, 0x99, 0x68, 0x4D, 0x00, 0x1A, 0x7D, 0x6A,
+    0xF7, 0x29, 0xDC, 0x8F, 0xD4, 0x8E, 0xF4, 0x62, 0xF8, 0xCB, 0xBA, 0xAE, 0xEA, 0x3E, 0x3B, 0x80,
+    0x1A, 0xF0, 0x2A, 0x4A, 0xE9, 0x5F, 0x24, 0x92, 0x55, 0xAF, 0x00, 0x1A, 0xF0, 0x2A, 0x49, 0x2B,
+    0xE5, 0x74, 0x92, 0x55, 0xAF, 0x00, 0x1A, 0xF0, 0x2A, 0x4A, 0xF9, 0x5D, 0x2B, 0xA5, 0x7C, 0x95,
+    0x6B, 0xC0, 0x1A, 0xF0, 0x2A, 0x4A, 0xF9, 0x25, 0x7C, 0x92, 0x55, 0xAF, 0x00, 0x83, 0xB8, 0x92,
+    0xD7, 0x2F, 0xFC, 0x1F, 0xBE, 0xE4, 0x9D, 0xC4, 0x00, 0x1A, 0xE6, 0xAD, 0x15, 0xA2, 0xB4, 0x56,
+    0x8A, 0xD1, 0x5A, 0x26, 0x16, 0xE8, 0x1E, 0x59, 0xA8, 0x45, 0x5E, 0x3E, 0xE7, 0x87, 0x79, 0x91,
+    0xEB, 0x0F, 0x62, 0xD9, 0x27, 0x27, 0x1C, 0x9C, 0xBB, 0xD3, 0xD6, 0xB6, 0x60, 0x0F, 0x62, 0xD9,
+    0x27, 0x27, 0x2C, 0x9C, 0x7B, 0xD3, 0xD6, 0xB6, 0x60, 0x0F, 0x62, 0xD9, 0x39, 0x64, 0xE3, 0x93,
+    0x8F, 0x7B, 0x97, 0x5A, 0xD9, 0x80, 0x0F, 0x62, 0xD9, 0x39, 0x64, 0xE3, 0x93, 0x97, 0x7B, 0x8F,
+    0x5A, 0xD9, 0x80, 0x0F, 0x62, 0xD9, 0x39, 0x64, 0x9C, 0x9C, 0xBB, 0xD3, 0xD6, 0xB6, 0x60, 0x0F,
+    0x62, 0xD9, 0x3F, 0x66, 0x4F, 0xF2, 0xC9, 0xFB, 0x3B, 0xD3, 0xD6, 0xB6, 0x60, 0x0F, 0x62, 0xD9,
+    0x27, 0x24, 0xE4, 0x9E, 0xF4, 0xF5, 0xAD, 0xED, 0x5B, 0xB1, 0x39, 0x27, 0x24, 0xE4, 0xB7, 0x61,
+    0xE8, 0x0E, 0x0B, 0x55, 0x33, 0x7C, 0xE9, 0x7C, 0xCE, 0xCB, 0x54, 0x0E, 0x0B, 0x76, 0x38, 0xE4,
+    0xE5, 0x92, 0x72, 0x5B, 0xB0, 0xF4, 0x00, 0x0E, 0x0B, 0x76, 0x27, 0x27, 0x2C, 0x9C, 0x72, 0x5B,
+    0xB0, 0xF4, 0x00, 0x0E, 0x0B, 0x76, 0x39, 0x64, 0xE3, 0x93, 0x8E, 0x4F, 0x87, 0x61, 0xE8, 0x0E,
+    0x0B, 0x76, 0x39, 0x64, 0x9C, 0x9C, 0xB2, 0x5B, 0xB0, 0xF4, 0x00, 0x83, 0xF2, 0xCC, 0x1F, 0x96,
+    0x68, 0xA1, 0xF1, 0xCD, 0x05, 0x00, 0xA1, 0xA6, 0x6A, 0x00, 0x0E, 0x0F, 0xF9, 0xAB, 0xEC, 0x97,
+    0xBE, 0x5E, 0x12, 0xFE, 0x55, 0x38, 0x00, 0x1A, 0x66, 0xF8, 0x1C, 0x4E, 0x47, 0x12, 0xD9, 0x80,
+    0x0E, 0x0B, 0x55, 0xC6, 0x5C, 0xA5, 0x32, 0xB5, 0x4E, 0x00, 0x0E, 0x0B, 0x55, 0x32, 0xE5, 0x2E,
+    0x32, 0xB5, 0x4E, 0x00, 0x0E, 0x0B, 0x55, 0xCA, 0x5C, 0x65, 0xC6, 0x5F, 0x0A, 0x9C, 0x00, 0x0E,
+    0x0B, 0x55, 0xCA, 0x5C, 0x65, 0xCA, 0x5E, 0x35, 0x38, 0x00, 0x0E, 0x0B, 0x55, 0xCA, 0x53, 0x2E,
+    0x52, 0xB5, 0x4E, 0x00, 0x0B, 0xCB, 0xCB, 0xD6, 0xDA, 0x5E, 0x5E, 0x5E, 0x0F, 0xDA, 0xB7, 0x72,
+    0x78, 0xA7, 0x24, 0xF7, 0xAD, 0xEA, 0x4F, 0x00, 0x1A, 0x7B, 0x49, 0x44, 0xA9, 0x25, 0x5A, 0x66,
+    0x1A, 0x7B, 0x49, 0x25, 0x49, 0x45, 0x5A, 0x66, 0x1A, 0x7B, 0x54, 0x94, 0x4A, 0x25, 0x4A, 0xB4,
+    0xCC, 0x1F, 0x97, 0xB4, 0x95, 0x24, 0x92, 0xAD, 0x33, 0xD2, 0xE3, 0xCF, 0x7B, 0xD7, 0x7D, 0x3C,
+    0xAE, 0x8F, 0x59, 0xD0, 0xD0, 0x1A, 0xFC, 0xF6, 0x5A, 0xA9, 0x94, 0xCA, 0x65, 0x6A, 0x9C, 0x00,
+    0xD2, 0xE3, 0xCF, 0x7D, 0x3D, 0x77, 0xBC, 0xAE, 0xA7, 0xAC, 0xE8, 0x68,
+};
+const uint8_t ArialMT_Plain_16_PL_huffman[] PROGMEM = {
+    0x01, 0x00, 0x00, 0x02, 0x03, 0x08, 0x08, 0x0B, 0x0E, 0x0B, 0x0F, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x40, 0x10, 0x20, 0x80, 0x01, 0x02, 0x04, 0x41, 0x44, 0x7F, 0xC0, 0xF8, 0x03, 0x0A,
+    0x0F, 0x1C, 0x1F, 0x48, 0x50, 0x60, 0x07, 0x09, 0x18, 0x22, 0x24, 0x28, 0x30, 0x42, 0x70, 0x88,
+    0xE0, 0x05, 0x06, 0x17, 0x1E, 0x21, 0x38, 0x39, 0x3F, 0x43, 0x58, 0x90, 0xC8, 0xF0, 0xFF, 0x0B,
+    0x0C, 0x1B, 0x4F, 0x68, 0x71, 0x72, 0x78, 0x7E, 0xB8, 0xD0, 0x11, 0x23, 0x31, 0x3C, 0x4C, 0x52,
+    0x5C, 0x5F, 0x61, 0x81, 0x82, 0xD8, 0xE8, 0xFA, 0xFB, 0x0E, 0x12, 0x19, 0x1A, 0x2F, 0x45, 0x47,
+    0x4E, 0x54, 0x62, 0x7C, 0x86, 0x89, 0x8F, 0x9C, 0xA0, 0xC1, 0xC4, 0xD2, 0xF1, 0xF9, 0xFC,
+};
+const CompressedFont ArialMT_Plain_16_PL = {ArialMT_Plain_16_PL_header, ArialMT_Plain_16_PL_data, ArialMT_Plain_16_PL_huffman};
+
+const uint8_t ArialMT_Plain_24_PL_header[] PROGMEM = {
+    0x18, 0x1C, 0x20, 0xE0, 0xFF, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x13, 0x06, 0x00, 0x07, 0x1A, 0x08,
+    0x00, 0x0F, 0x33, 0x0E, 0x00, 0x2A, 0x2F, 0x0D, 0x00, 0x44, 0x4F, 0x15, 0x00, 0x6B, 0x3B, 0x10,
+    0x00, 0x8B, 0x0A, 0x04, 0x00, 0x8F, 0x1C, 0x08, 0x00, 0x9E, 0x1B, 0x08, 0x00, 0xAD, 0x21, 0x0A,
+    0x00, 0xBB, 0x32, 0x0E, 0x00, 0xC9, 0x10, 0x05, 0x00, 0xCE, 0x1B, 0x08, 0x00, 0xDA, 0x0F, 0x05,
+    0x00, 0xDD, 0x19, 0x08, 0x00, 0xE7, 0x2F, 0x0D, 0x00, 0xFC, 0x23, 0x0A, 0x01, 0x07, 0x2F, 0x0D,
+    0x01, 0x1E, 0x2F, 0x0D, 0x01, 0x35, 0x2F, 0x0D, 0x01, 0x4A, 0x2F, 0x0D, 0x01, 0x62, 0x2F, 0x0D,
+    0x01, 0x7C, 0x2D, 0x0D, 0x01, 0x8E, 0x2F, 0x0D, 0x01, 0xA8, 0x2F, 0x0D, 0x01, 0xC1, 0x0F, 0x05,
+    0x01, 0xC5, 0x10, 0x05, 0x01, 0xCB, 0x2F, 0x0D, 0x01, 0xDF, 0x2F, 0x0D, 0x01, 0xF4, 0x2E, 0x0D,
+    0x02, 0x07, 0x2E, 0x0D, 0x02, 0x1A, 0x5B, 0x18, 0x02, 0x57, 0x3B, 0x10, 0x02, 0x73, 0x3B, 0x10,
+    0x02, 0x8F, 0x3F, 0x11, 0x02, 0xAA, 0x3F, 0x11, 0x02, 0xC3, 0x3B, 0x10, 0x02, 0xDC, 0x35, 0x0F,
+    0x02, 0xEF, 0x43, 0x12, 0x03, 0x10, 0x3B, 0x10, 0x03, 0x22, 0x0F, 0x05, 0x03, 0x28, 0x27, 0x0B,
+    0x03, 0x35, 0x3F, 0x11, 0x03, 0x4F, 0x2F, 0x0D, 0x03, 0x5C, 0x43, 0x12, 0x03, 0x75, 0x3B, 0x10,
+    0x03, 0x8C, 0x47, 0x13, 0x03, 0xAA, 0x3A, 0x10, 0x03, 0xC0, 0x47, 0x13, 0x03, 0xE2, 0x3F, 0x11,
+    0x03, 0xFF, 0x3B, 0x10, 0x04, 0x1D, 0x35, 0x0F, 0x04, 0x2E, 0x3B, 0x10, 0x04, 0x41, 0x39, 0x10,
+    0x04, 0x57, 0x59, 0x18, 0x04, 0x7A, 0x3B, 0x10, 0x04, 0x98, 0x3D, 0x11, 0x04, 0xAF, 0x37, 0x0F,
+    0x04, 0xCA, 0x14, 0x06, 0x04, 0xD4, 0x1B, 0x08, 0x04, 0xDE, 0x18, 0x07, 0x04, 0xE8, 0x2A, 0x0C,
+    0x04, 0xF5, 0x34, 0x0E, 0x05, 0x02, 0x11, 0x06, 0x05, 0x07, 0x2F, 0x0D, 0x05, 0x1E, 0x33, 0x0E,
+    0x05, 0x33, 0x2B, 0x0C, 0x05, 0x45, 0x2F, 0x0D, 0x05, 0x59, 0x2F, 0x0D, 0x05, 0x6F, 0x1A, 0x08,
+    0x05, 0x7A, 0x2F, 0x0D, 0x05, 0x94, 0x2F, 0x0D, 0x05, 0xA4, 0x0F, 0x05, 0x05, 0xAA, 0x10, 0x05,
+    0x05, 0xB2, 0x2F, 0x0D, 0x05, 0xC5, 0x0F, 0x05, 0x05, 0xCB, 0x47, 0x13, 0x05, 0xE3, 0x2F, 0x0D,
+    0x05, 0xF2, 0x2F, 0x0D, 0x06, 0x06, 0x33, 0x0E, 0x06, 0x1B, 0x30, 0x0D, 0x06, 0x30, 0x1E, 0x09,
+    0x06, 0x39, 0x2B, 0x0C, 0x06, 0x4F, 0x1B, 0x08, 0x06, 0x5A, 0x2F, 0x0D, 0x06, 0x69, 0x2A, 0x0C,
+    0x06, 0x77, 0x42, 0x12, 0x06, 0x92, 0x2B, 0x0C, 0x06, 0xA7, 0x2A, 0x0C, 0x06, 0xB9, 0x2B, 0x0C,
+    0x06, 0xCC, 0x1C, 0x08, 0x06, 0xDA, 0x10, 0x05, 0x06, 0xE1, 0x1B, 0x08, 0x06, 0xEE, 0x32, 0x0E,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0x06, 0xFB, 0x2F, 0x0D, 0x07, 0x0A, 0x16, 0x07,
+    0x07, 0x13, 0x3B, 0x10, 0x07, 0x2E, 0x40, 0x11, 0x07, 0x4D, 0x34, 0x0E, 0x07, 0x67, 0x3F, 0x11,
+    0x07, 0x84, 0x2B, 0x0C, 0x07, 0x98, 0x2F, 0x0D, 0x07, 0xAA, 0x2B, 0x0C, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0x07, 0xC0, 0x47, 0x13, 0x07, 0xE1, 0x2F, 0x0D, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0x07, 0xF7, 0x3B, 0x10, 0x08, 0x13, 0x2F, 0x0D, 0x08, 0x2C, 0x3B, 0x10,
+    0x08, 0x4D, 0x2B, 0x0C, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0x08, 0x66, 0x14, 0x06, 0x08, 0x6D, 0x2B, 0x0C,
+    0x08, 0x83, 0x2F, 0x0D, 0x08, 0x9C, 0x33, 0x0E, 0x08, 0xB4, 0x31, 0x0E, 0x08, 0xD1, 0x10, 0x05,
+    0x08, 0xD9, 0x2F, 0x0D, 0x08, 0xFB, 0x19, 0x08, 0x09, 0x01, 0x46, 0x13, 0x09, 0x2D, 0x1A, 0x08,
+    0x09, 0x39, 0x27, 0x0B, 0x09, 0x4C, 0x2F, 0x0D, 0x09, 0x5A, 0x1B, 0x08, 0x09, 0x66, 0x46, 0x13,
+    0x09, 0x8E, 0x31, 0x0E, 0x09, 0x9D, 0x1E, 0x09, 0x09, 0xAD, 0x33, 0x0E, 0x09, 0xBF, 0x1A, 0x08,
+    0x09, 0xCF, 0x1A, 0x08, 0x09, 0xDF, 0x19, 0x08, 0x09, 0xE5, 0x2F, 0x0D, 0x09, 0xF5, 0x31, 0x0E,
+    0x0A, 0x0D, 0x12, 0x06, 0x0A, 0x11, 0x18, 0x07, 0x0A, 0x1A, 0x37, 0x0F, 0x0A, 0x37, 0x1E, 0x09,
+    0x0A, 0x43, 0x37, 0x0F, 0x0A, 0x5F, 0x2B, 0x0C, 0x0A, 0x73, 0x4B, 0x14, 0x0A, 0x97, 0x4B, 0x14,
+    0x0A, 0xC0, 0x33, 0x0E, 0x0A, 0xD4, 0x3B, 0x10, 0x0A, 0xF3, 0x3B, 0x10, 0x0B, 0x12, 0x3B, 0x10,
+    0x0B, 0x32, 0x3B, 0x10, 0x0B, 0x52, 0x3B, 0x10, 0x0B, 0x70, 0x3B, 0x10, 0x0B, 0x8F, 0x5B, 0x18,
+    0x0B, 0xB9, 0x3F, 0x11, 0x0B, 0xD9, 0x3B, 0x10, 0x0B, 0xF4, 0x3B, 0x10, 0x0C, 0x0F, 0x3B, 0x10,
+    0x0C, 0x2B, 0x3B, 0x10, 0x0C, 0x46, 0x11, 0x06, 0x0C, 0x4F, 0x11, 0x06, 0x0C, 0x58, 0x15, 0x07,
+    0x0C, 0x63, 0x15, 0x07, 0x0C, 0x6C, 0x3F, 0x11, 0x0C, 0x88, 0x3B, 0x10, 0x0C, 0xA4, 0x47, 0x13,
+    0x0C, 0xC5, 0x47, 0x13, 0x0C, 0xE6, 0x47, 0x13, 0x0D, 0x08, 0x47, 0x13, 0x0D, 0x2B, 0x47, 0x13,
+    0x0D, 0x4B, 0x2B, 0x0C, 0x0D, 0x5C, 0x47, 0x13, 0x0D, 0x85, 0x3B, 0x10, 0x0D, 0x9B, 0x3B, 0x10,
+    0x0D, 0xB1, 0x3B, 0x10, 0x0D, 0xC8, 0x3B, 0x10, 0x0D, 0xDE, 0x3D, 0x11, 0x0D, 0xF8, 0x3A, 0x10,
+    0x0E, 0x10, 0x37, 0x0F, 0x0E, 0x29, 0x2F, 0x0D, 0x0E, 0x42, 0x2F, 0x0D, 0x0E, 0x5B, 0x2F, 0x0D,
+    0x0E, 0x75, 0x2F, 0x0D, 0x0E, 0x90, 0x2F, 0x0D, 0x0E, 0xA9, 0x2F, 0x0D, 0x0E, 0xC6, 0x53, 0x16,
+    0x0E, 0xEF, 0x2B, 0x0C, 0x0F, 0x06, 0x2F, 0x0D, 0x0F, 0x1F, 0x2F, 0x0D, 0x0F, 0x38, 0x2F, 0x0D,
+    0x0F, 0x51, 0x2F, 0x0D, 0x0F, 0x69, 0x11, 0x06, 0x0F, 0x71, 0x11, 0x06, 0x0F, 0x79, 0x15, 0x07,
+    0x0F, 0x82, 0x15, 0x07, 0x0F, 0x8A, 0x2F, 0x0D, 0x0F, 0xA3, 0x2F, 0x0D, 0x0F, 0xB6, 0x2F, 0x0D,
+    0x0F, 0xCC, 0x2F, 0x0D, 0x0F, 0xE2, 0x2F, 0x0D, 0x0F, 0xF9, 0x2F, 0x0D, 0x10, 0x11, 0x2F, 0x0D,
+    0x10, 0x27, 0x32, 0x0E, 0x10, 0x35, 0x33, 0x0E, 0x10, 0x4E, 0x2F, 0x0D, 0x10, 0x5F, 0x2F, 0x0D,
+    0x10, 0x70, 0x2F, 0x0D, 0x10, 0x82, 0x2F, 0x0D, 0x10, 0x93, 0x2A, 0x0C, 0x10, 0xA7, 0x2F, 0x0D,
+    0x10, 0xBB, 0x2A, 0x0C,
+};
+const uint8_t ArialMT_Plain_24_PL_data[] PROGMEM = {
+    0x00, 0x0B, 0x6F, 0xE8, 0x5B, 0x7F, 0x40, 0x0B, 0x5E, 0x5A, 0xF0, 0x02, 0xD7, 0x96, 0xBC, 0x61,
+    0x71, 0x87, 0xA0, 0xC3, 0x53, 0xAE, 0x2D, 0xB7, 0xB9, 0x6C, 0x6E, 0x53, 0x0F, 0x41, 0x86, 0xA7,
+    0x5C, 0x5B, 0x6F, 0x72, 0xD8, 0xDC, 0xA6, 0x17, 0x18, 0x5C, 0x0D, 0xAF, 0x9A, 0xB8, 0xF9, 0xD5,
+    0xCB, 0x35, 0x32, 0xD1, 0x48, 0x87, 0x3D, 0xF7, 0x52, 0x21, 0x4A, 0x68, 0xAD, 0x32, 0x57, 0xF4,
+    0x71, 0x3F, 0xF3, 0x78, 0x0D, 0xB1, 0x2B, 0xC4, 0xA4, 0x1C, 0xB9, 0x1C, 0xB9, 0x72, 0x52, 0x34,
+    0x57, 0x8F, 0x9D, 0xB7, 0xBF, 0x12, 0xB7, 0x1C, 0xC7, 0xA4, 0x7B, 0xF1, 0x57, 0xF4, 0xF1, 0x5A,
+    0x90, 0xE5, 0xCB, 0x91, 0xCB, 0x91, 0x48, 0x2B, 0xC4, 0xDB, 0x10, 0x06, 0xD7, 0x95, 0xC5, 0xB7,
+    0xF8, 0xE6, 0xAF, 0xF5, 0x68, 0xB7, 0xA6, 0x14, 0xD2, 0x14, 0xFC, 0x70, 0xB7, 0xEE, 0xD1, 0x5F,
+    0x7F, 0xF0, 0xB6, 0xBB, 0x88, 0xC4, 0xAF, 0x12, 0xBA, 0x0F, 0x98, 0x0B, 0x5E, 0x5A, 0xF0, 0x07,
+    0x3C, 0x4E, 0xDF, 0x6B, 0x6C, 0x79, 0xCA, 0xB2, 0xDA, 0xEA, 0x13, 0xE4, 0x79, 0x40, 0x0E, 0x47,
+    0x96, 0x84, 0xEB, 0x2D, 0xAE, 0xDB, 0x1E, 0x72, 0x76, 0xFB, 0x4E, 0x78, 0x80, 0x0D, 0x86, 0xDE,
+    0x53, 0x6C, 0x4B, 0x5C, 0x5A, 0xE3, 0x6C, 0x4D, 0xBC, 0xA6, 0xC0, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x06, 0xF8, 0x9B, 0xE2, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00, 0x22, 0xE3, 0x9C, 0x80, 0x6D, 0x23,
+    0x69, 0x1B, 0x48, 0xDA, 0x46, 0xD2, 0x36, 0x91, 0xB4, 0x80, 0x00, 0x20, 0x40, 0x20, 0x77, 0x96,
+    0xC4, 0xEB, 0x26, 0xDA, 0x96, 0xB8, 0xA0, 0x07, 0x6B, 0x9B, 0x6F, 0x8A, 0xB2, 0xCD, 0x66, 0x8A,
+    0x21, 0x44, 0x28, 0x85, 0x9A, 0x2B, 0x2C, 0xDB, 0x6F, 0x89, 0xDA, 0xE0, 0x00, 0x04, 0xC5, 0xE2,
+    0xE3, 0x69, 0x16, 0xDF, 0x55, 0xB7, 0xD4, 0x05, 0xD0, 0xAD, 0xDA, 0x2A, 0xF4, 0xA8, 0xFE, 0x65,
+    0x1E, 0x85, 0x36, 0xEE, 0x52, 0xB0, 0xA5, 0x21, 0x58, 0x85, 0x78, 0xC1, 0x8C, 0x00, 0x04, 0xA6,
+    0xAC, 0xB8, 0x2A, 0xCD, 0x44, 0x29, 0x10, 0xA4, 0x42, 0x91, 0x0A, 0xE9, 0x0A, 0xFF, 0x4E, 0x4D,
+    0xBF, 0x56, 0x26, 0xD7, 0x80, 0x06, 0xD7, 0x15, 0xB8, 0xE7, 0x71, 0xE9, 0xB8, 0xE1, 0x73, 0x6B,
+    0xEE, 0x56, 0x57, 0x2D, 0xBE, 0xAB, 0x6F, 0xA8, 0xB8, 0x5C, 0x04, 0x4D, 0xB6, 0xBC, 0x16, 0xE3,
+    0x92, 0x9E, 0x68, 0x53, 0x08, 0x53, 0x08, 0x53, 0x08, 0x53, 0x08, 0x53, 0x2C, 0xD4, 0xE7, 0x89,
+    0x6B, 0x80, 0x07, 0x5B, 0x9B, 0x6F, 0x8A, 0xBF, 0xF7, 0xCD, 0x58, 0xD1, 0x4C, 0xA1, 0x4C, 0xA1,
+    0x4C, 0xA1, 0x4C, 0xA1, 0x68, 0xC9, 0x5F, 0xF4, 0xC5, 0xB7, 0xE8, 0xBC, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x3D, 0x2A, 0x6D, 0xAA, 0x96, 0xB9, 0x4F, 0xC6, 0x53, 0x81, 0x4B, 0x8B, 0x48, 0xA0, 0x06, 0xD7,
+    0xB6, 0xFD, 0x5C, 0x55, 0xFE, 0x9C, 0x96, 0xD2, 0x14, 0x88, 0x52, 0x21, 0x48, 0x85, 0xB4, 0x85,
+    0x7F, 0xA7, 0x26, 0xDF, 0xAB, 0x89, 0xB5, 0xE0, 0x07, 0x1C, 0x1B, 0x7D, 0xB9, 0xAB, 0xF8, 0x34,
+    0x52, 0xB0, 0xA5, 0x61, 0x4A, 0xC2, 0x95, 0x85, 0x29, 0x92, 0xBD, 0xDE, 0x76, 0xDB, 0xE2, 0x76,
+    0x90, 0x00, 0x4E, 0x09, 0xC0, 0x00, 0x4E, 0x2E, 0x4F, 0x9C, 0x80, 0x07, 0x21, 0xEC, 0x1F, 0xD0,
+    0x3F, 0x60, 0xFD, 0x83, 0xC2, 0x47, 0x84, 0x8F, 0x2C, 0x89, 0xDC, 0x4E, 0xE2, 0xE9, 0x80, 0x07,
+    0x84, 0x8F, 0x09, 0x1E, 0x12, 0x3C, 0x24, 0x78, 0x48, 0xF0, 0x91, 0xE1, 0x23, 0xC2, 0x47, 0x84,
+    0x8F, 0x09, 0x1E, 0x12, 0x05, 0xD3, 0x27, 0x71, 0x3B, 0x8F, 0x2C, 0x8F, 0x09, 0x1E, 0x12, 0x3F,
+    0x60, 0xFD, 0x83, 0xFA, 0x07, 0xB0, 0x72, 0x05, 0xC6, 0xD7, 0x15, 0x91, 0x61, 0x4D, 0xBD, 0x0A,
+    0x57, 0xD0, 0xA5, 0x8A, 0x41, 0x5D, 0x0A, 0xF1, 0x17, 0x80, 0x05, 0xB1, 0x3A, 0x6A, 0x79, 0xF9,
+    0x97, 0xD6, 0x5B, 0x7E, 0x9F, 0xEC, 0x95, 0x7F, 0xD3, 0xFF, 0xB7, 0x57, 0x4C, 0xAE, 0xAE, 0x11,
+    0x75, 0x38, 0x44, 0xE9, 0x38, 0x9D, 0x27, 0x94, 0xE9, 0x3C, 0x27, 0x4C, 0x3C, 0xF3, 0xA7, 0x4D,
+    0x67, 0x6E, 0xDD, 0xD3, 0xAF, 0x08, 0x9D, 0x65, 0x95, 0xDB, 0x5D, 0x9D, 0xCB, 0xFD, 0xF2, 0x76,
+    0xFE, 0xC9, 0x3A, 0x7E, 0x81, 0xF7, 0xC0, 0x20, 0x77, 0x9B, 0x62, 0x73, 0xB8, 0xED, 0x26, 0xDE,
+    0xF9, 0x2D, 0xED, 0x92, 0x9B, 0x49, 0x6F, 0x6C, 0x9B, 0x7B, 0xE4, 0x76, 0x91, 0xCE, 0xE3, 0x6C,
+    0x47, 0x78, 0x80, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x44, 0x29, 0x10, 0xA4, 0x42, 0x91, 0x0A,
+    0x44, 0x29, 0x10, 0xA4, 0x42, 0xBF, 0x8E, 0x15, 0xDF, 0x26, 0xDF, 0xAB, 0x89, 0xB5, 0xE0, 0x07,
+    0x59, 0x1B, 0xDE, 0xDA, 0xFC, 0x55, 0x96, 0x6A, 0xB2, 0x51, 0x0A, 0x21, 0x44, 0x28, 0x85, 0x10,
+    0xA2, 0x15, 0x64, 0xAC, 0xB3, 0x6D, 0x76, 0x27, 0x92, 0xE0, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA,
+    0x21, 0x44, 0x28, 0x85, 0x10, 0xA2, 0x14, 0x42, 0x88, 0x59, 0x92, 0xB2, 0xCD, 0xB5, 0xDC, 0x0D,
+    0xEF, 0x3A, 0xC8, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x44, 0x29, 0x10, 0xA4, 0x42, 0x91, 0x0A,
+    0x44, 0x29, 0x10, 0xA4, 0x42, 0x91, 0x0A, 0x44, 0x29, 0x10, 0xA2, 0x00, 0x00, 0xB6, 0xFA, 0xAD,
+    0xBE, 0xAA, 0x41, 0x48, 0x29, 0x05, 0x20, 0xA4, 0x14, 0x82, 0x90, 0x52, 0x0A, 0x41, 0x40, 0x07,
+    0x59, 0x1B, 0xDE, 0xDA, 0xFC, 0x55, 0x96, 0x6A, 0xB2, 0x59, 0x92, 0x88, 0x51, 0x0A, 0x21, 0x4A,
+    0x42, 0x94, 0x85, 0xA9, 0xA2, 0xB4, 0xC9, 0x5F, 0xC1, 0x93, 0x6F, 0xF1, 0xC4, 0xFD, 0xB8, 0x80,
+    0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA4, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x16, 0xDF, 0x55,
+    0xB7, 0xD4, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA0, 0x03, 0x80, 0xF3, 0x8D, 0x04, 0x08, 0x10, 0x34,
+    0x5B, 0x7E, 0x2B, 0x6F, 0x88, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA5, 0x87, 0xB0, 0x68, 0x3E, 0xB1,
+    0xD8, 0x7F, 0x94, 0x9B, 0x7B, 0x6F, 0x56, 0x58, 0xAC, 0xF3, 0xA8, 0xD1, 0xC9, 0x03, 0x90, 0x00,
+    0xB6, 0xFA, 0xAD, 0xBE, 0xA2, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x00, 0x00, 0xB6, 0xFA, 0xAD,
+    0xBE, 0xAB, 0x48, 0xAE, 0x23, 0xB0, 0xB5, 0xE3, 0x51, 0x03, 0x52, 0xD7, 0x9D, 0x8A, 0xE2, 0x5A,
+    0x45, 0xB7, 0xD5, 0x6D, 0xF5, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0xC8, 0xDA, 0xE1, 0xC0, 0x7A,
+    0x47, 0xB0, 0x5A, 0x46, 0xD7, 0x0C, 0x46, 0x6B, 0x6F, 0xAA, 0xDB, 0xEA, 0x07, 0x59, 0x1B, 0xDE,
+    0xDA, 0xFC, 0x55, 0x96, 0x6A, 0xB2, 0x59, 0xA2, 0x88, 0x51, 0x0A, 0x21, 0x44, 0x28, 0x85, 0x9A,
+    0x2A, 0xC9, 0x59, 0x66, 0xDA, 0xFC, 0x4D, 0xEF, 0x3A, 0xC8, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA,
+    0x50, 0xA5, 0x0A, 0x50, 0xA5, 0x0A, 0x50, 0xA5, 0x0A, 0x50, 0xA5, 0x0A, 0xC1, 0x5D, 0x46, 0x20,
+    0x07, 0x59, 0x1B, 0xDE, 0xDA, 0xFC, 0x55, 0x96, 0x0A, 0xB2, 0x59, 0x92, 0x88, 0x51, 0x0A, 0x21,
+    0x47, 0xF3, 0x28, 0xFE, 0x65, 0x9E, 0x95, 0x59, 0xAB, 0x2C, 0xDB, 0x5F, 0xA9, 0xBF, 0xF5, 0x1D,
+    0x7F, 0x00, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x41, 0x48, 0x29, 0x05, 0x20, 0xA7, 0xB0, 0xA7,
+    0x32, 0x9C, 0xEE, 0x53, 0xF3, 0xDE, 0xB6, 0x5C, 0x55, 0xE3, 0xE9, 0x6D, 0x8C, 0x0E, 0x40, 0x02,
+    0xE2, 0xFC, 0x55, 0xE3, 0x9A, 0xB9, 0x64, 0xA6, 0x9A, 0x29, 0x10, 0xA4, 0x42, 0x91, 0x0A, 0x44,
+    0x29, 0xEC, 0x85, 0x69, 0x92, 0xBF, 0xE1, 0x93, 0x6F, 0xD3, 0x89, 0xED, 0xBC, 0xA0, 0xA0, 0xA0,
+    0xA0, 0xA0, 0xA0, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0xB6,
+    0xF7, 0x2D, 0xBE, 0x23, 0x31, 0xA0, 0x81, 0x02, 0x04, 0x08, 0x1A, 0x0C, 0xD6, 0xDF, 0x15, 0xB7,
+    0xB8, 0xE4, 0x2D, 0x22, 0xB8, 0x8E, 0xF1, 0xD2, 0x45, 0x71, 0x1D, 0xE3, 0x41, 0xDE, 0x57, 0x13,
+    0xA4, 0x8E, 0xF2, 0xB8, 0x96, 0x91, 0xC8, 0xA0, 0xB5, 0xE6, 0xDB, 0x8E, 0x98, 0x9B, 0x6A, 0x20,
+    0x6A, 0x5B, 0x13, 0xAC, 0x9B, 0x71, 0x2D, 0x71, 0x41, 0x6B, 0x8D, 0xB8, 0x8E, 0xB2, 0x2D, 0x88,
+    0xD4, 0x41, 0xB6, 0xA7, 0x4C, 0x5B, 0x6E, 0x5A, 0xF2, 0x80, 0x39, 0x39, 0x21, 0x47, 0xA5, 0x69,
+    0x79, 0xD5, 0xF6, 0xDE, 0x7F, 0x7D, 0xC7, 0x69, 0x1A, 0x0E, 0xD2, 0x3F, 0xBE, 0xE5, 0x6E, 0xBD,
+    0x69, 0x79, 0xD4, 0x7A, 0x5C, 0x90, 0x39, 0x00, 0xE4, 0x28, 0x2B, 0x23, 0x6B, 0x85, 0xE3, 0xCE,
+    0x3D, 0x23, 0x9E, 0xA7, 0x3D, 0x4F, 0x48, 0xF3, 0x8B, 0xCA, 0xDC, 0x5A, 0x45, 0x07, 0x20, 0x21,
+    0x46, 0x8A, 0x3D, 0x2A, 0x3E, 0xF2, 0x9B, 0x7A, 0x14, 0xAF, 0x72, 0x96, 0x85, 0x34, 0x85, 0x33,
+    0x85, 0x38, 0x42, 0x97, 0xC2, 0xD2, 0x85, 0x90, 0xA2, 0x00, 0x0B, 0x6F, 0xBD, 0xF6, 0xDF, 0x7B,
+    0xE8, 0x4E, 0x84, 0xC0, 0xA0, 0xB5, 0xC6, 0xDA, 0x8E, 0xB2, 0x2D, 0x88, 0xEF, 0x10, 0x00, 0xA1,
+    0x3A, 0x13, 0xB6, 0xFB, 0xDF, 0x6D, 0xF7, 0xBC, 0x07, 0x21, 0xA0, 0xE2, 0x56, 0xF2, 0xC2, 0xC2,
+    0xB7, 0x8E, 0x23, 0x41, 0xC8, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x0E, 0x42, 0x82, 0xC3, 0x60, 0x06, 0x5C, 0x0C, 0xF8, 0x9E, 0x1F, 0x39, 0xEE, 0xEE,
+    0x3D, 0xDD, 0xC7, 0x8C, 0x1E, 0x39, 0x1F, 0x0C, 0x0E, 0xBC, 0x4E, 0x9A, 0x8E, 0x40, 0x00, 0xB6,
+    0xFA, 0xAD, 0xBE, 0xA6, 0x58, 0x18, 0x64, 0x4E, 0x09, 0xC1, 0x38, 0x38, 0x68, 0x67, 0x99, 0xD3,
+    0x12, 0xD7, 0x00, 0x07, 0x3B, 0xCE, 0x98, 0x99, 0xE6, 0x70, 0xD0, 0x9C, 0x13, 0x82, 0x70, 0x70,
+    0xD0, 0xCF, 0x33, 0x2C, 0x00, 0x05, 0xAE, 0x3A, 0x62, 0x67, 0x99, 0xC3, 0x42, 0x70, 0x4E, 0x09,
+    0xC1, 0x86, 0x46, 0x58, 0x2D, 0xBE, 0xAB, 0x6F, 0xA8, 0x05, 0xAF, 0x3A, 0x62, 0x7C, 0x73, 0x3E,
+    0x1A, 0x1E, 0x30, 0x78, 0xC1, 0xE3, 0x07, 0xC3, 0x43, 0xE3, 0x91, 0xD3, 0x03, 0x9F, 0x94, 0x4C,
+    0x4C, 0xAE, 0xFA, 0xAD, 0xBE, 0xAA, 0x4C, 0xA4, 0xCA, 0x4C, 0x05, 0xBD, 0xB2, 0x74, 0xF7, 0xDC,
+    0xCF, 0x3B, 0xDC, 0x34, 0x9A, 0x71, 0x34, 0xE2, 0x69, 0xC4, 0xD8, 0x65, 0x7B, 0x2F, 0x0B, 0x9D,
+    0xB7, 0x93, 0xB6, 0xE0, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA6, 0x43, 0x01, 0x31, 0x31, 0x31, 0xC0,
+    0x75, 0xD4, 0xE9, 0xA8, 0x00, 0xA7, 0x6D, 0x54, 0xED, 0xA8, 0x13, 0x13, 0xA7, 0x6D, 0xEF, 0xA7,
+    0x6D, 0xEE, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA5, 0x45, 0x87, 0x39, 0x1F, 0xFC, 0xBC, 0xC3, 0x81,
+    0x3F, 0x49, 0xE4, 0x81, 0xC8, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA0, 0x00, 0x76, 0xD4, 0xED, 0xA9,
+    0x80, 0xF2, 0x89, 0x89, 0x8E, 0x03, 0xAE, 0xA7, 0x4D, 0x4C, 0x07, 0x94, 0x4C, 0x4C, 0x70, 0x1D,
+    0x75, 0x3A, 0x6A, 0x00, 0x76, 0xD4, 0xED, 0xA9, 0x90, 0xC0, 0x4C, 0x4C, 0x4C, 0x70, 0x1D, 0x75,
+    0x3A, 0x6A, 0x07, 0x3B, 0xCE, 0x98, 0x99, 0xE6, 0x70, 0xD0, 0x9C, 0x13, 0x82, 0x70, 0x70, 0xD0,
+    0xCF, 0x33, 0xA6, 0x27, 0x3B, 0xC0, 0x00, 0x76, 0xDE, 0xF7, 0x6D, 0xEF, 0x65, 0x81, 0x86, 0x44,
+    0xE0, 0x9C, 0x13, 0x83, 0x86, 0x86, 0x79, 0x9D, 0x31, 0x2D, 0x70, 0x05, 0xAE, 0x3A, 0x62, 0x67,
+    0x99, 0xC3, 0x42, 0x70, 0x4E, 0x09, 0xC1, 0x86, 0x46, 0x58, 0x1D, 0xB7, 0xBD, 0xDB, 0x7B, 0xC0,
+    0x00, 0x76, 0xD4, 0xED, 0xA9, 0x80, 0x98, 0x98, 0x98, 0x06, 0x98, 0x1F, 0x5E, 0x67, 0xEF, 0xD0,
+    0xF1, 0x83, 0xC6, 0x0F, 0x1E, 0xE3, 0xC7, 0xB8, 0xFC, 0xBF, 0x39, 0xF9, 0xB8, 0x99, 0x62, 0x4C,
+    0x4C, 0xAE, 0xFC, 0x56, 0xDF, 0x52, 0x70, 0x4E, 0x09, 0xC0, 0x00, 0x76, 0xC4, 0xED, 0xC4, 0x68,
+    0x20, 0x40, 0x81, 0x90, 0xC0, 0xED, 0xA9, 0xDB, 0x50, 0x4C, 0x77, 0x8E, 0x82, 0xB7, 0x8E, 0x23,
+    0x41, 0xC4, 0xAD, 0xE7, 0x41, 0xDE, 0x26, 0x70, 0x1F, 0x60, 0xE7, 0x71, 0xB7, 0x11, 0xA1, 0xB7,
+    0x12, 0xD7, 0x1F, 0x58, 0xE0, 0x3E, 0xB1, 0x6B, 0x8D, 0xB8, 0x8D, 0x0D, 0xB8, 0x9C, 0xEE, 0x3E,
+    0xC1, 0xC0, 0x79, 0x39, 0x13, 0x83, 0xCF, 0xE9, 0x34, 0xE0, 0x73, 0xBC, 0xAC, 0x8B, 0x5E, 0x69,
+    0xC0, 0xCF, 0xD2, 0x70, 0x83, 0xC9, 0xC8, 0x07, 0x01, 0xF6, 0x26, 0xE7, 0x29, 0xB6, 0xC6, 0xF3,
+    0xB5, 0xC7, 0x52, 0xBC, 0x4E, 0x97, 0x1D, 0xE2, 0x60, 0x02, 0x09, 0xFA, 0x49, 0xF7, 0x93, 0xFB,
+    0xC7, 0x8F, 0xA0, 0xF9, 0x41, 0xF8, 0xA0, 0xEF, 0x83, 0xCF, 0x04, 0xE0, 0x06, 0xD2, 0x2B, 0x72,
+    0xBF, 0x6F, 0x6B, 0xAD, 0xAF, 0x5B, 0xE8, 0x4E, 0x84, 0xC0, 0x00, 0xB6, 0xFB, 0xE3, 0x6D, 0xF7,
+    0xC4, 0x0A, 0x13, 0xA1, 0x3B, 0x6B, 0xD6, 0xFA, 0xFD, 0xBB, 0xDC, 0xAD, 0xC6, 0xD2, 0x05, 0x07,
+    0xB0, 0x40, 0x81, 0x02, 0x82, 0x82, 0xA2, 0xA2, 0xA2, 0xC2, 0x80, 0x50, 0x41, 0x6D, 0xF5, 0x5B,
+    0x7D, 0x4C, 0x20, 0x9C, 0x17, 0x40, 0x81, 0x02, 0x04, 0x08, 0x50, 0x41, 0x6D, 0xF5, 0x5B, 0x7D,
+    0x4C, 0x04, 0xC0, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0xC8, 0xDA, 0xE1, 0xC0, 0xF9, 0xBD, 0x26,
+    0x7E, 0xC3, 0x0B, 0x49, 0xE5, 0xDA, 0xE1, 0x88, 0xCD, 0x6D, 0xF5, 0x5B, 0x7D, 0x40, 0x20, 0x77,
+    0x9B, 0x62, 0x73, 0xB8, 0xED, 0x26, 0xDE, 0xF9, 0x2D, 0xED, 0x92, 0x9B, 0x49, 0x6F, 0x6C, 0x9B,
+    0x7B, 0xE4, 0x76, 0x91, 0xCE, 0xE3, 0x6C, 0x47, 0x69, 0x1F, 0x9E, 0xE1, 0x70, 0x06, 0x5C, 0x0C,
+    0xF8, 0x9E, 0x1F, 0x39, 0xEE, 0xEE, 0x3D, 0xDD, 0xC7, 0x8C, 0x1E, 0x39, 0x1F, 0x0C, 0x0E, 0xBC,
+    0x4E, 0x9B, 0xC8, 0xFE, 0xDB, 0x85, 0xC0, 0x07, 0x59, 0x1B, 0xDE, 0xDA, 0xFC, 0x55, 0x96, 0x6A,
+    0xB2, 0x51, 0x0A, 0x21, 0xF4, 0xA1, 0xF5, 0x21, 0xEA, 0x43, 0xE8, 0x42, 0xAC, 0x95, 0x96, 0x6D,
+    0xAE, 0xC4, 0xF2, 0x5C, 0x07, 0x3B, 0xCE, 0x98, 0x99, 0xE6, 0x70, 0xD1, 0xB4, 0xE1, 0x69, 0xC2,
+    0x93, 0x87, 0x2E, 0x1A, 0x19, 0xE6, 0x65, 0x80, 0x00, 0x76, 0xD4, 0xED, 0xA9, 0x90, 0xC0, 0xDA,
+    0x65, 0xA6, 0x52, 0x67, 0x2E, 0x03, 0xAE, 0xA7, 0x4D, 0x40, 0x02, 0x09, 0xFA, 0x49, 0xF7, 0x93,
+    0xFB, 0xCD, 0xBC, 0x7D, 0x0B, 0x7C, 0xA1, 0x4F, 0xC5, 0x0E, 0x5D, 0xF0, 0x79, 0xE0, 0x9C, 0x00,
+    0x07, 0x59, 0x1B, 0xDE, 0xDA, 0xFC, 0x55, 0x96, 0x6A, 0xB2, 0x59, 0xA2, 0x88, 0x51, 0x0F, 0xA5,
+    0x0F, 0xA9, 0x0F, 0x52, 0x1F, 0xB5, 0xA2, 0xAC, 0x95, 0x96, 0x6D, 0xAF, 0xC4, 0xDE, 0xF3, 0xAC,
+    0x80, 0x07, 0x3B, 0xCE, 0x98, 0x99, 0xE6, 0x70, 0xD0, 0x9C, 0x36, 0x9C, 0x2D, 0x38, 0x53, 0x86,
+    0x8E, 0x59, 0xE6, 0x74, 0xC4, 0xE7, 0x78, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x44, 0x29, 0x10,
+    0xA4, 0x42, 0x91, 0x0A, 0x47, 0x39, 0x52, 0x3F, 0x3D, 0xD4, 0x88, 0xBA, 0x91, 0x0A, 0x44, 0x29,
+    0x10, 0xA2, 0x00, 0x05, 0xAF, 0x3A, 0x62, 0x7C, 0x73, 0x3E, 0x1A, 0x1E, 0x30, 0x78, 0xF3, 0x93,
+    0xC7, 0xF3, 0xDC, 0xF8, 0x69, 0x73, 0xE3, 0x91, 0xD3, 0x03, 0x9F, 0x94, 0x02, 0xE2, 0xFC, 0x55,
+    0xE3, 0x9A, 0xB9, 0x64, 0xA6, 0x9A, 0x29, 0x10, 0xFA, 0x62, 0x1F, 0x54, 0x43, 0xD5, 0x10, 0xFA,
+    0x3D, 0x90, 0xAD, 0x32, 0x57, 0xFC, 0x32, 0x6D, 0xFA, 0x71, 0x3D, 0xB7, 0x80, 0x06, 0x98, 0x1F,
+    0x5E, 0x67, 0xEF, 0xD0, 0xF1, 0x86, 0xDE, 0x30, 0xB7, 0x8F, 0x72, 0x9E, 0x3D, 0xCE, 0x5F, 0x97,
+    0xE7, 0x3F, 0x37, 0x13, 0x2C, 0x40, 0x00, 0x07, 0xCB, 0x7B, 0xDF, 0x2D, 0xEF, 0x05, 0xAF, 0x3A,
+    0x62, 0x67, 0xF9, 0xAF, 0x70, 0xFC, 0x64, 0xF5, 0x3F, 0xDA, 0x0E, 0x10, 0xB7, 0xFC, 0x73, 0x33,
+    0xE0, 0x7C, 0xD3, 0x53, 0xE6, 0x29, 0xA1, 0xF6, 0xE6, 0xAE, 0xFC, 0x56, 0xB7, 0xF0, 0x29, 0x4C,
+    0x94, 0xA6, 0x4A, 0x52, 0x16, 0x42, 0xB2, 0x86, 0xD2, 0xD0, 0x7C, 0xC0, 0x07, 0x93, 0xCA, 0x7F,
+    0xBF, 0x03, 0xB5, 0xE6, 0x17, 0x13, 0x99, 0x39, 0x93, 0x99, 0x39, 0x98, 0x5C, 0x76, 0xBC, 0xFF,
+    0x7E, 0x07, 0x93, 0xCA, 0xB5, 0x26, 0xAF, 0xE0, 0x9B, 0x6F, 0xC3, 0x33, 0xEC, 0x99, 0xF5, 0xCC,
+    0xE7, 0xA9, 0xCF, 0x53, 0xEB, 0x99, 0xF6, 0x4D, 0xB7, 0xE1, 0x9A, 0xBF, 0x82, 0x6B, 0x52, 0x6E,
+    0x40, 0x00, 0xB7, 0xDB, 0xD3, 0x1B, 0x7D, 0xBD, 0x31, 0x05, 0x8D, 0xBF, 0xD7, 0xF4, 0x2B, 0xC7,
+    0xF4, 0xDD, 0x6C, 0x2F, 0xBA, 0x99, 0xCE, 0x74, 0xCB, 0x09, 0xD2, 0x33, 0x9D, 0xBD, 0x9A, 0x5F,
+    0x5F, 0xF0, 0xFF, 0xFD, 0xDB, 0x7E, 0x8F, 0xF2, 0x93, 0x6B, 0x80, 0x0A, 0x0A, 0x00, 0x0A, 0x0A,
+    0x00, 0x74, 0x1D, 0xAE, 0x2F, 0xBD, 0xB4, 0xB0, 0x57, 0xFF, 0x19, 0xAB, 0xDB, 0xF8, 0x14, 0xF7,
+    0x77, 0x29, 0x77, 0xA1, 0x4B, 0xBD, 0x0A, 0x5D, 0xE8, 0x52, 0xEF, 0x42, 0x9F, 0xD9, 0xE8, 0x57,
+    0xDD, 0xFC, 0x0A, 0xFF, 0xEF, 0x36, 0xD2, 0xC0, 0xBE, 0xF3, 0xB5, 0xC7, 0x40, 0x0A, 0xE6, 0x5B,
+    0xBC, 0xA7, 0xF2, 0x94, 0xFE, 0x52, 0xDA, 0x95, 0xD4, 0x06, 0xC2, 0xD7, 0x1F, 0x8F, 0x13, 0x3C,
+    0xCF, 0xFD, 0x7C, 0xC5, 0xAE, 0x3F, 0x1E, 0x26, 0x79, 0x9E, 0x5F, 0x98, 0x06, 0x03, 0x01, 0x80,
+    0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0xAC, 0x8E, 0xB2, 0x6D, 0x23, 0x69, 0x1B, 0x48, 0xDA,
+    0x46, 0xD2, 0x36, 0x91, 0xB4, 0x80, 0x74, 0x1D, 0xAE, 0x2F, 0xBD, 0xB4, 0xB0, 0x56, 0x59, 0xAB,
+    0xDB, 0xF8, 0x54, 0xED, 0xE8, 0x53, 0xD5, 0x0A, 0x7A, 0xA1, 0x4F, 0x94, 0x29, 0xDB, 0xB9, 0x4F,
+    0x4F, 0xA1, 0x57, 0xFC, 0x95, 0x96, 0x6D, 0xA5, 0x81, 0x7D, 0xE7, 0x6B, 0x8E, 0x80, 0xC0, 0x60,
+    0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x00, 0x0D, 0xAE, 0x3E,
+    0xFF, 0x94, 0xE5, 0xE6, 0x39, 0x79, 0x8E, 0x5E, 0x63, 0xEF, 0xF9, 0x4D, 0xAE, 0x05, 0x20, 0xA4,
+    0x14, 0x82, 0x90, 0x52, 0x0D, 0xF5, 0x37, 0xD4, 0xA4, 0x14, 0x82, 0x90, 0x52, 0x0A, 0x40, 0xFB,
+    0xFC, 0x8A, 0x41, 0xCB, 0x43, 0x97, 0xF2, 0x1C, 0xBF, 0x8C, 0xB7, 0xFC, 0xCA, 0xFD, 0xC0, 0xFB,
+    0xFF, 0x31, 0x48, 0x39, 0x72, 0x39, 0x7D, 0xD3, 0x97, 0xDD, 0x2D, 0xFC, 0xE5, 0x7F, 0x88, 0x00,
+    0x0D, 0x85, 0x85, 0x07, 0x20, 0x00, 0x76, 0xDE, 0xF7, 0x6D, 0xEF, 0x33, 0x10, 0x20, 0x40, 0x81,
+    0x99, 0xDB, 0x53, 0xB6, 0xA0, 0x62, 0x57, 0x52, 0xBA, 0x96, 0xFB, 0x4B, 0x7D, 0xA5, 0xB7, 0xDE,
+    0xFB, 0x6F, 0xBD, 0xF4, 0x14, 0x16, 0xDF, 0x7B, 0xED, 0xBE, 0xF7, 0xD0, 0x50, 0x00, 0x05, 0x05,
+    0x00, 0x01, 0xE4, 0x1E, 0x42, 0xBE, 0x43, 0x6B, 0x84, 0x80, 0x21, 0x46, 0x8A, 0x3D, 0x2A, 0x3E,
+    0xF2, 0x9B, 0x7A, 0x14, 0xAF, 0x73, 0xE9, 0xB4, 0x3E, 0xAD, 0x21, 0xEA, 0xCE, 0x1F, 0x47, 0x08,
+    0x52, 0xF8, 0x5A, 0x50, 0xB2, 0x14, 0x40, 0x0D, 0xB1, 0x2B, 0xC4, 0xB6, 0x85, 0x20, 0xB6, 0x85,
+    0x78, 0x9B, 0x62, 0x21, 0x46, 0x8A, 0x3D, 0x2A, 0x3E, 0xF2, 0x9B, 0x7A, 0x14, 0xAF, 0x73, 0xD7,
+    0x68, 0x7A, 0xF4, 0x85, 0x33, 0x85, 0x38, 0x42, 0x97, 0xC2, 0xD2, 0x85, 0x90, 0xA2, 0x00, 0x02,
+    0x09, 0xFA, 0x49, 0xF7, 0x93, 0xFB, 0xCA, 0xF8, 0xFA, 0x15, 0xF9, 0x41, 0xF8, 0xA0, 0xEF, 0x83,
+    0xCF, 0x04, 0xE0, 0x0D, 0xA4, 0x54, 0x55, 0xC9, 0x6D, 0x61, 0x6D, 0x73, 0x1C, 0x05, 0xE5, 0x64,
+    0x58, 0x7B, 0x06, 0x63, 0xFE, 0xDC, 0x8F, 0xC3, 0x0A, 0xFD, 0xCD, 0x16, 0xE5, 0xFC, 0x8A, 0x72,
+    0xFE, 0x32, 0xDF, 0xF4, 0x2B, 0xF7, 0x00, 0xFB, 0xFF, 0x31, 0x48, 0x39, 0x72, 0x39, 0x7D, 0xDE,
+    0x4E, 0x5F, 0x76, 0x16, 0xFE, 0x7D, 0x15, 0xFE, 0x2E, 0x02, 0xF3, 0x6B, 0x8B, 0x0F, 0x60, 0xD0,
+    0x70, 0xC0, 0xBF, 0x83, 0x6F, 0x6F, 0xFC, 0x16, 0xAF, 0x99, 0x4B, 0x6A, 0xE5, 0x6D, 0x47, 0x98,
+    0x00, 0x39, 0x8E, 0x97, 0x1E, 0x7B, 0x8B, 0xEF, 0x7C, 0xAE, 0x9B, 0xE5, 0x29, 0x89, 0x8B, 0xCD,
+    0xAE, 0x2B, 0x22, 0xA0, 0x20, 0x77, 0x9B, 0x62, 0x73, 0xB8, 0xED, 0x27, 0xF5, 0xFB, 0xE4, 0xF9,
+    0x7B, 0x64, 0xFA, 0xB6, 0x93, 0xFC, 0xFD, 0xB2, 0x6D, 0xEF, 0x91, 0xDA, 0x47, 0x3B, 0x8D, 0xB1,
+    0x1D, 0xE2, 0x00, 0x20, 0x77, 0x9B, 0x62, 0x73, 0xB8, 0xED, 0x26, 0xDE, 0xF9, 0x3F, 0xCF, 0xDB,
+    0x27, 0xD5, 0xB4, 0x9F, 0x2F, 0x6C, 0x9F, 0xD7, 0xEF, 0x91, 0xDA, 0x47, 0x3B, 0x8D, 0xB1, 0x1D,
+    0xE2, 0x00, 0x20, 0x77, 0x9B, 0x62, 0x73, 0xB8, 0xED, 0x27, 0xE4, 0xF7, 0xC9, 0xFB, 0xBD, 0xB2,
+    0x7A, 0xB6, 0x93, 0xE5, 0xED, 0x93, 0xC3, 0xDF, 0x27, 0x9B, 0xB4, 0x8E, 0x77, 0x1B, 0x62, 0x3B,
+    0xC4, 0x00, 0x20, 0x77, 0x9B, 0x62, 0x73, 0xB9, 0x87, 0x69, 0x3F, 0x2F, 0xBE, 0x4F, 0x97, 0xB6,
+    0x4F, 0x56, 0xD2, 0x7E, 0xEF, 0x6C, 0x9E, 0x1E, 0xF9, 0x38, 0x76, 0x92, 0x7C, 0xEE, 0x36, 0xC4,
+    0x77, 0x88, 0x20, 0x77, 0x9B, 0x62, 0x73, 0xB8, 0xED, 0x27, 0x87, 0xBE, 0x4F, 0xDD, 0xED, 0x92,
+    0x9B, 0x49, 0x6F, 0x6C, 0x9E, 0x1E, 0xF9, 0x30, 0xED, 0x23, 0x9D, 0xC6, 0xD8, 0x8E, 0xF1, 0x00,
+    0x20, 0x77, 0x9B, 0x62, 0x73, 0xB8, 0xED, 0x27, 0xE6, 0xF7, 0xC9, 0xFB, 0x7D, 0xB2, 0x7D, 0x1B,
+    0x49, 0xFB, 0x7D, 0xB2, 0x7E, 0x6F, 0x7C, 0x8E, 0xD2, 0x39, 0xDC, 0x6D, 0x88, 0xEF, 0x10, 0x20,
+    0x7A, 0x46, 0x25, 0x6E, 0x39, 0xC8, 0xFF, 0xF4, 0x8F, 0x7C, 0x95, 0xF6, 0xC9, 0x6D, 0xA4, 0xA6,
+    0xD2, 0x53, 0x69, 0x2D, 0xBE, 0xAB, 0x6F, 0xAA, 0x91, 0x0A, 0x44, 0x29, 0x10, 0xA4, 0x42, 0x91,
+    0x0A, 0x44, 0x29, 0x10, 0xA4, 0x42, 0x91, 0x0A, 0x20, 0x07, 0x59, 0x1B, 0xDE, 0xDA, 0xFC, 0x55,
+    0x96, 0x6A, 0xB2, 0x51, 0x1E, 0x4A, 0x23, 0xC9, 0x47, 0x3F, 0x25, 0x1F, 0x9E, 0xEA, 0x22, 0x54,
+    0x42, 0xAC, 0x95, 0x96, 0x6D, 0xAE, 0xC4, 0xF2, 0x5C, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x44,
+    0x29, 0x10, 0xFA, 0x22, 0x1E, 0xA8, 0x87, 0xD5, 0x10, 0xFA, 0x62, 0x14, 0x88, 0x52, 0x21, 0x48,
+    0x85, 0x22, 0x14, 0x40, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x44, 0x29, 0x10, 0xA4, 0x43, 0xE9,
+    0x88, 0x7D, 0x51, 0x0F, 0x54, 0x43, 0xE8, 0x88, 0x52, 0x21, 0x48, 0x85, 0x22, 0x14, 0x40, 0x00,
+    0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0x44, 0x29, 0x10, 0xFA, 0x62, 0x1E, 0xB8, 0x87, 0xAA, 0x21, 0xEA,
+    0x88, 0x7A, 0xE2, 0x1F, 0x4C, 0x42, 0x91, 0x0A, 0x44, 0x28, 0x80, 0x00, 0xB6, 0xFA, 0xAD, 0xBE,
+    0xAA, 0x44, 0x29, 0x10, 0xF5, 0xC4, 0x3D, 0x71, 0x0A, 0x44, 0x29, 0x10, 0xF5, 0xC4, 0x3D, 0x71,
+    0x0A, 0x44, 0x29, 0x10, 0xA2, 0x00, 0x0F, 0x20, 0xF9, 0x6F, 0xAB, 0xF7, 0xEF, 0xAB, 0xCC, 0x0F,
+    0x30, 0xFD, 0xFB, 0xEA, 0xF9, 0x6F, 0xAB, 0xC8, 0xF3, 0x0C, 0x07, 0xCB, 0x7D, 0x5F, 0x2D, 0xF5,
+    0x60, 0x3C, 0xC0, 0xC0, 0x60, 0x2D, 0xBE, 0xAB, 0x6F, 0xAB, 0x01, 0x80, 0x40, 0x82, 0xDB, 0xEA,
+    0xB6, 0xFA, 0xA9, 0x10, 0xA4, 0x42, 0x91, 0x0A, 0x44, 0x29, 0x10, 0xA2, 0x14, 0x42, 0xCC, 0x95,
+    0x96, 0x6D, 0xAE, 0xE0, 0x6F, 0x79, 0xD6, 0x40, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xAA, 0xC8, 0xF0,
+    0xB8, 0xE1, 0xC0, 0x9F, 0xA4, 0x9F, 0xB0, 0xC2, 0xD2, 0x61, 0xB5, 0xCE, 0x0C, 0x53, 0x66, 0xB6,
+    0xFA, 0xAD, 0xBE, 0xA0, 0x07, 0x59, 0x1B, 0xDE, 0xDA, 0xFC, 0x55, 0x96, 0x6A, 0xB2, 0x59, 0xA3,
+    0xE8, 0x43, 0xD4, 0x87, 0xD4, 0x87, 0xD2, 0x85, 0x10, 0xB3, 0x45, 0x59, 0x2B, 0x2C, 0xDB, 0x5F,
+    0x89, 0xBD, 0xE7, 0x59, 0x00, 0x07, 0x59, 0x1B, 0xDE, 0xDA, 0xFC, 0x55, 0x96, 0x6A, 0xB2, 0x59,
+    0xA2, 0x88, 0x7D, 0x28, 0x7D, 0x48, 0x7A, 0x90, 0xFA, 0x10, 0xB3, 0x45, 0x59, 0x2B, 0x2C, 0xDB,
+    0x5F, 0x89, 0xBD, 0xE7, 0x59, 0x00, 0x07, 0x59, 0x1B, 0xDE, 0xDA, 0xFC, 0x55, 0x96, 0x6A, 0xB2,
+    0x59, 0xA3, 0xE9, 0x43, 0xD6, 0x87, 0xA9, 0x0F, 0x52, 0x1E, 0xB4, 0x3F, 0xCD, 0xA2, 0xAC, 0x95,
+    0x96, 0x6D, 0xAF, 0xC4, 0xDE, 0xF3, 0xAC, 0x80, 0x07, 0x59, 0x1B, 0xDE, 0xDA, 0xFC, 0x55, 0x96,
+    0x6F, 0xD6, 0xC9, 0xFB, 0xDA, 0x3D, 0x48, 0x7A, 0x90, 0xF5, 0xA1, 0xEB, 0x43, 0xEA, 0x43, 0xE4,
+    0xD1, 0x56, 0x4A, 0xCB, 0x36, 0xD7, 0xE2, 0x6F, 0x79, 0xD6, 0x40, 0x07, 0x59, 0x1B, 0xDE, 0xDA,
+    0xFC, 0x55, 0x96, 0x6A, 0xB2, 0x59, 0xA3, 0xD6, 0x87, 0xAD, 0x0A, 0x21, 0x44, 0x3D, 0x68, 0x7E,
+    0xE6, 0x8A, 0xB2, 0x56, 0x59, 0xB6, 0xBF, 0x13, 0x7B, 0xCE, 0xB2, 0x00, 0x4E, 0xE3, 0xF2, 0xDC,
+    0x7C, 0x64, 0x74, 0x1E, 0xC1, 0xD0, 0x7C, 0x64, 0x7E, 0x5B, 0x89, 0xDC, 0x07, 0x5F, 0xB8, 0x6F,
+    0xFD, 0x4D, 0xAF, 0xD5, 0x59, 0x79, 0xD5, 0x71, 0x5B, 0x6F, 0xFA, 0xA9, 0x5E, 0xE5, 0x2D, 0x0A,
+    0x7B, 0x21, 0x4D, 0x21, 0x4C, 0xE1, 0x6E, 0x1A, 0x2B, 0x7E, 0x4A, 0xDD, 0x9A, 0xD7, 0xE2, 0xF6,
+    0x6F, 0x7B, 0x97, 0x59, 0x00, 0x00, 0xB6, 0xF7, 0x2D, 0xBE, 0x23, 0x31, 0xA3, 0xC8, 0x84, 0xD0,
+    0xE0, 0x87, 0x99, 0x02, 0x06, 0x83, 0x35, 0xB7, 0xC5, 0x6D, 0xEE, 0x00, 0xB6, 0xF7, 0x2D, 0xBE,
+    0x23, 0x31, 0xA0, 0x87, 0x99, 0x0E, 0x08, 0x4D, 0x0F, 0x22, 0x06, 0x83, 0x35, 0xB7, 0xC5, 0x6D,
+    0xEE, 0x00, 0xB6, 0xF7, 0x2D, 0xBE, 0x23, 0x31, 0xA3, 0xCC, 0x86, 0x08, 0x4D, 0x09, 0xA1, 0x82,
+    0x1E, 0x66, 0x83, 0x35, 0xB7, 0xC5, 0x6D, 0xEE, 0x00, 0xB6, 0xF7, 0x2D, 0xBE, 0x23, 0x31, 0xA3,
+    0x04, 0x30, 0x40, 0x81, 0x0C, 0x10, 0xC1, 0xA0, 0xCD, 0x6D, 0xF1, 0x5B, 0x7B, 0x80, 0xE4, 0x28,
+    0x2B, 0x23, 0x6B, 0x85, 0xE3, 0xCE, 0x3D, 0x27, 0x9B, 0x9E, 0xAE, 0x1C, 0xF5, 0x4F, 0xD2, 0x79,
+    0x3C, 0xE2, 0xF2, 0xB7, 0x16, 0x91, 0x41, 0xC8, 0x00, 0xB6, 0xFA, 0xAD, 0xBE, 0xA5, 0xD3, 0x2E,
+    0x99, 0x74, 0xCB, 0xA6, 0x5D, 0x32, 0xE9, 0x97, 0x4C, 0xBA, 0xF3, 0xDD, 0x71, 0xDA, 0x47, 0x40,
+    0x00, 0xDB, 0x7D, 0x55, 0xDF, 0x55, 0x45, 0x1E, 0x65, 0x19, 0xA8, 0xD1, 0x6F, 0xC7, 0x0A, 0xFD,
+    0xB0, 0xDB, 0xF5, 0x41, 0xB7, 0xCE, 0x6D, 0xC4, 0x62, 0x06, 0x5C, 0x0C, 0xF8, 0x9E, 0x1F, 0x3B,
+    0x97, 0xBB, 0xB9, 0x4F, 0x77, 0x72, 0xDE, 0x30, 0xDB, 0xC7, 0x23, 0xE1, 0x81, 0xD7, 0x89, 0xD3,
+    0x51, 0xC8, 0x06, 0x5C, 0x0C, 0xF8, 0x9E, 0x1F, 0x39, 0xEE, 0xEE, 0x6D, 0xEE, 0xEE, 0x5B, 0xC6,
+    0x14, 0xF1, 0xC9, 0xCB, 0xE1, 0x81, 0xD7, 0x89, 0xD3, 0x51, 0xC8, 0x06, 0x5C, 0x0C, 0xF8, 0xB6,
+    0xF0, 0xF9, 0xD5, 0xF7, 0x77, 0x29, 0xEE, 0xEE, 0x53, 0xC6, 0x15, 0xF1, 0xC9, 0xB7, 0xC3, 0x03,
+    0xAF, 0x13, 0xA6, 0xA3, 0x90, 0x06, 0x5C, 0x15, 0xCF, 0x8A, 0xDE, 0x1F, 0x3A, 0x9E, 0xEE, 0xE5,
+    0x3D, 0xDD, 0xCA, 0xF8, 0xC2, 0xBE, 0x39, 0x2D, 0xF0, 0xC1, 0x4E, 0xBC, 0x4E, 0x9A, 0x8E, 0x40,
+    0x06, 0x5C, 0x0C, 0xF8, 0xAB, 0xE1, 0xF3, 0xAB, 0xEE, 0xEE, 0x3D, 0xDD, 0xC7, 0x8C, 0x2B, 0xE3,
+    0x92, 0xBF, 0x0C, 0x0E, 0xBC, 0x4E, 0x9A, 0x8E, 0x40, 0x06, 0x5C, 0x0C, 0xF8, 0x9E, 0x1F, 0x3B,
+    0xD9, 0xEE, 0xEE, 0x7E, 0x4F, 0x77, 0x73, 0xF2, 0x78, 0xC3, 0xF2, 0x78, 0xE4, 0xF6, 0x7C, 0x30,
+    0x3A, 0xF1, 0x3A, 0x6A, 0x39, 0x00, 0x07, 0xCD, 0x89, 0xF9, 0xB8, 0x9F, 0xAF, 0xE7, 0x3C, 0x60,
+    0xF1, 0x83, 0xC6, 0x0F, 0x18, 0x3D, 0x59, 0x1F, 0x56, 0x67, 0x5C, 0x4E, 0xBC, 0x4F, 0xD7, 0x99,
+    0xF0, 0xD0, 0xF1, 0x83, 0xC6, 0x0F, 0x18, 0x3C, 0x60, 0xFD, 0x79, 0x1D, 0x30, 0x2D, 0xE5, 0x07,
+    0x3B, 0xCE, 0x98, 0x99, 0xE6, 0x70, 0xD3, 0xC8, 0x9C, 0x79, 0x13, 0xE7, 0xE4, 0x4F, 0xF3, 0xDC,
+    0xE1, 0xA4, 0x99, 0xE6, 0x65, 0x80, 0x05, 0xAF, 0x3A, 0x62, 0x7C, 0x73, 0x72, 0xF8, 0x68, 0xA7,
+    0x8C, 0x2D, 0xE3, 0x0D, 0xBC, 0x60, 0xF8, 0x68, 0x7C, 0x72, 0x3A, 0x60, 0x73, 0xF2, 0x80, 0x05,
+    0xAF, 0x3A, 0x62, 0x7C, 0x73, 0x3E, 0x1A, 0x36, 0xF1, 0x85, 0xBC, 0x61, 0x4F, 0x18, 0x72, 0xF8,
+    0x68, 0x7C, 0x72, 0x3A, 0x60, 0x73, 0xF2, 0x80, 0x05, 0xAF, 0x3A, 0x62, 0x7C, 0x73, 0x6D, 0xF0,
+    0xD1, 0x5F, 0x18, 0x53, 0xC6, 0x14, 0xF1, 0x85, 0x7E, 0x1A, 0x36, 0xF8, 0xE4, 0x74, 0xC0, 0xE7,
+    0xE5, 0x05, 0xAF, 0x3A, 0x62, 0x7C, 0x73, 0x57, 0xE1, 0xA2, 0xBE, 0x30, 0x78, 0xC1, 0xE3, 0x0A,
+    0xFC, 0x34, 0x57, 0xE3, 0x91, 0xD3, 0x03, 0x9F, 0x94, 0x0E, 0x42, 0x9D, 0xB5, 0x5B, 0xB6, 0xAD,
+    0x80, 0x0D, 0x85, 0xBB, 0x6A, 0xA7, 0x6D, 0x5C, 0x80, 0xD8, 0x54, 0x53, 0xB6, 0xAA, 0x76, 0xD5,
+    0x51, 0xB0, 0xA8, 0xA8, 0x76, 0xD4, 0xED, 0xAA, 0xA2, 0xA0, 0x07, 0x3B, 0xCE, 0x98, 0x9F, 0xC5,
+    0x9B, 0xFB, 0x71, 0xD1, 0xFD, 0xB3, 0x85, 0xA7, 0x0A, 0xCE, 0x15, 0xC7, 0x47, 0x2E, 0x39, 0x9D,
+    0x71, 0x2D, 0x78, 0x00, 0x76, 0xD5, 0x5E, 0xDA, 0xAD, 0x91, 0x4C, 0x0A, 0x4C, 0xAC, 0xCA, 0xCC,
+    0xB7, 0x02, 0x9D, 0x75, 0x3A, 0x6A, 0x07, 0x3B, 0xCE, 0x98, 0x99, 0xE6, 0xE5, 0xC3, 0x45, 0x27,
+    0x0B, 0x4E, 0x1B, 0x4E, 0x0E, 0x1A, 0x19, 0xE6, 0x74, 0xC4, 0xE7, 0x78, 0x07, 0x3B, 0xCE, 0x98,
+    0x99, 0xE6, 0x70, 0xD1, 0xB4, 0xE1, 0x69, 0xC2, 0x93, 0x87, 0x2E, 0x1A, 0x19, 0xE6, 0x74, 0xC4,
+    0xE7, 0x78, 0x07, 0x3B, 0xCE, 0x98, 0x99, 0xE6, 0xDB, 0x86, 0x8A, 0xCE, 0x14, 0x9C, 0x29, 0x38,
+    0x57, 0x86, 0x8D, 0xB3, 0xCC, 0xE9, 0x89, 0xCE, 0xF0, 0x07, 0x3B, 0xCE, 0x98, 0xAB, 0x9E, 0x6B,
+    0x70, 0xD1, 0x49, 0xC2, 0x93, 0x85, 0x67, 0x0A, 0xF0, 0xD1, 0x6C, 0xF3, 0x53, 0xA6, 0x27, 0x3B,
+    0xC0, 0x07, 0x3B, 0xCE, 0x98, 0x99, 0xE6, 0xAF, 0x0D, 0x15, 0x9C, 0x13, 0x82, 0x70, 0xAF, 0x0D,
+    0x15, 0xCF, 0x33, 0xA6, 0x27, 0x3B, 0xC0, 0x04, 0x08, 0x10, 0x20, 0x40, 0xFE, 0xE9, 0x1F, 0xDD,
+    0x22, 0x04, 0x08, 0x10, 0x20, 0x00, 0x73, 0xFC, 0x27, 0x4F, 0xB4, 0xCF, 0x33, 0x86, 0xA7, 0xBB,
+    0xD0, 0x7C, 0xBB, 0x8F, 0xC5, 0x07, 0x7E, 0x86, 0x79, 0x9B, 0xE2, 0x7F, 0xAD, 0xE0, 0x00, 0x76,
+    0xC4, 0xED, 0xC5, 0xC9, 0xA2, 0x88, 0x59, 0x0D, 0x90, 0x32, 0x18, 0x1D, 0xB5, 0x3B, 0x6A, 0x00,
+    0x76, 0xC4, 0xED, 0xC4, 0x68, 0x21, 0xB2, 0x16, 0x42, 0x8C, 0x9C, 0x98, 0x1D, 0xB5, 0x3B, 0x6A,
+    0x00, 0x76, 0xC4, 0xED, 0xC5, 0xB3, 0x45, 0x50, 0xA2, 0x14, 0x42, 0xAC, 0x9B, 0x30, 0x3B, 0x6A,
+    0x76, 0xD4, 0x00, 0x76, 0xC4, 0xED, 0xC5, 0x56, 0x8A, 0xA0, 0x40, 0x85, 0x59, 0x2A, 0xC0, 0xED,
+    0xA9, 0xDB, 0x50, 0x07, 0x01, 0xF6, 0x26, 0xE7, 0x29, 0xB6, 0xC6, 0xFD, 0x9D, 0xAE, 0xB3, 0xAA,
+    0x95, 0xE2, 0xE5, 0xD2, 0xE3, 0xBC, 0x4C, 0x00, 0xB6, 0xFB, 0xDF, 0x6D, 0xF7, 0xBD, 0x9E, 0x44,
+    0xE0, 0x9C, 0x13, 0x83, 0x86, 0x86, 0x79, 0x9D, 0x31, 0x39, 0xDC, 0x07, 0x01, 0xF6, 0x27, 0x5E,
+    0x72, 0x9D, 0x76, 0xC6, 0xF3, 0xB5, 0xC7, 0x55, 0x6B, 0xC5, 0x5E, 0x97, 0x1D, 0xE2, 0x60,
+};
+const uint8_t ArialMT_Plain_24_PL_huffman[] PROGMEM = {
+    0x01, 0x00, 0x00, 0x01, 0x05, 0x0A, 0x07, 0x04, 0x0F, 0x08, 0x14, 0x18, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x01, 0x06, 0x60, 0xC0, 0xE0, 0x03, 0x07, 0x0C, 0x0F, 0x18, 0x1C, 0x38, 0x3F, 0x80,
+    0xFF, 0x0E, 0x1F, 0x20, 0xF0, 0xF8, 0xFC, 0xFE, 0x31, 0x3E, 0x8C, 0xC6, 0x02, 0x04, 0x08, 0x1E,
+    0x33, 0x3C, 0x66, 0x6C, 0x70, 0x83, 0x86, 0x8F, 0xCE, 0xDC, 0xE6, 0x10, 0x39, 0x62, 0x68, 0x6E,
+    0x7C, 0x7E, 0x7F, 0x21, 0x22, 0x37, 0x40, 0x61, 0x67, 0x76, 0x78, 0x88, 0x8E, 0x9C, 0xB0, 0xC1,
+    0xC3, 0xC7, 0xCC, 0xD8, 0xE2, 0xEC, 0xEE, 0x19, 0x1B, 0x1D, 0x26, 0x2C, 0x32, 0x36, 0x3D, 0x50,
+    0x6F, 0x77, 0x82, 0x87, 0xA0, 0xB6, 0xCF, 0xE1, 0xE3, 0xE7, 0xE8, 0xF1, 0xF3, 0xF6, 0xF7, 0x0B,
+    0x0D, 0x1A, 0x23, 0x27, 0x3B, 0x4E, 0x63, 0x79, 0x81, 0x84, 0x85, 0x98, 0x9F, 0xBC, 0xF4,
+};
+const CompressedFont ArialMT_Plain_24_PL = {ArialMT_Plain_24_PL_header, ArialMT_Plain_24_PL_data, ArialMT_Plain_24_PL_huffman};
+
+#endif
@@ -0,0 +1,653 @@
+// Generated by bin/compress-oled-fonts.py from OLEDDisplayFontsRU.cpp, don't edit
+// trunk-ignore-all(clang-format): Generated
+#include "OLEDDisplayFontsRU.h"
+#if defined(OLED_RU) && FONT_COMPRESSED
+
+const uint8_t ArialMT_Plain_10_RU_header[] PROGMEM = {
+    0x0A, 0x0D, 0x20, 0xE0, 0xFF, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x04, 0x03, 0x00, 0x02, 0x05, 0x04,
+    0x00, 0x05, 0x09, 0x06, 0x00, 0x0B, 0x0A, 0x06, 0x00, 0x12, 0x10, 0x09, 0x00, 0x1B, 0x0E, 0x08,
+    0x00, 0x24, 0x01, 0x02, 0x00, 0x25, 0x06, 0x04, 0x00, 0x29, 0x06, 0x04, 0x00, 0x2D, 0x05, 0x04,
+    0x00, 0x31, 0x09, 0x06, 0x00, 0x36, 0x04, 0x03, 0x00, 0x38, 0x03, 0x03, 0x00, 0x3A, 0x04, 0x03,
+    0x00, 0x3C, 0x05, 0x04, 0x00, 0x3F, 0x0A, 0x06, 0x00, 0x45, 0x08, 0x05, 0x00, 0x49, 0x0A, 0x06,
+    0x00, 0x4F, 0x0A, 0x06, 0x00, 0x55, 0x0B, 0x07, 0x00, 0x5B, 0x0A, 0x06, 0x00, 0x62, 0x0A, 0x06,
+    0x00, 0x69, 0x09, 0x06, 0x00, 0x6E, 0x0A, 0x06, 0x00, 0x74, 0x0A, 0x06, 0x00, 0x7B, 0x04, 0x03,
+    0x00, 0x7D, 0x04, 0x03, 0x00, 0x7F, 0x0A, 0x06, 0x00, 0x84, 0x09, 0x06, 0x00, 0x89, 0x09, 0x06,
+    0x00, 0x8E, 0x0B, 0x07, 0x00, 0x94, 0x14, 0x0B, 0x00, 0xA5, 0x0E, 0x08, 0x00, 0xAD, 0x0C, 0x07,
+    0x00, 0xB3, 0x0C, 0x07, 0x00, 0xB9, 0x0B, 0x07, 0x00, 0xBF, 0x0C, 0x07, 0x00, 0xC5, 0x09, 0x06,
+    0x00, 0xC9, 0x0D, 0x08, 0x00, 0xD0, 0x0C, 0x07, 0x00, 0xD6, 0x04, 0x03, 0x00, 0xD8, 0x08, 0x05,
+    0x00, 0xDC, 0x0E, 0x08, 0x00, 0xE3, 0x0C, 0x07, 0x00, 0xE8, 0x10, 0x09, 0x00, 0xF0, 0x0C, 0x07,
+    0x00, 0xF6, 0x0E, 0x08, 0x00, 0xFD, 0x0B, 0x07, 0x01, 0x03, 0x0E, 0x08, 0x01, 0x0A, 0x0C, 0x07,
+    0x01, 0x10, 0x0C, 0x07, 0x01, 0x17, 0x0B, 0x07, 0x01, 0x1C, 0x0C, 0x07, 0x01, 0x21, 0x0D, 0x08,
+    0x01, 0x28, 0x11, 0x0A, 0x01, 0x31, 0x0E, 0x08, 0x01, 0x38, 0x0D, 0x08, 0x01, 0x3E, 0x0C, 0x07,
+    0x01, 0x46, 0x06, 0x04, 0x01, 0x49, 0x06, 0x04, 0x01, 0x4C, 0x04, 0x03, 0x01, 0x4F, 0x09, 0x06,
+    0x01, 0x54, 0x0C, 0x07, 0x01, 0x59, 0x03, 0x03, 0x01, 0x5B, 0x0A, 0x06, 0x01, 0x60, 0x0A, 0x06,
+    0x01, 0x65, 0x0A, 0x06, 0x01, 0x6A, 0x0A, 0x06, 0x01, 0x6F, 0x0A, 0x06, 0x01, 0x74, 0x05, 0x04,
+    0x01, 0x77, 0x0A, 0x06, 0x01, 0x7E, 0x0A, 0x06, 0x01, 0x83, 0x04, 0x03, 0x01, 0x86, 0x04, 0x03,
+    0x01, 0x89, 0x08, 0x05, 0x01, 0x8D, 0x04, 0x03, 0x01, 0x8F, 0x10, 0x09, 0x01, 0x96, 0x0A, 0x06,
+    0x01, 0x9B, 0x0A, 0x06, 0x01, 0xA0, 0x0A, 0x06, 0x01, 0xA5, 0x0A, 0x06, 0x01, 0xAA, 0x05, 0x04,
+    0x01, 0xAD, 0x08, 0x05, 0x01, 0xB1, 0x06, 0x04, 0x01, 0xB4, 0x0A, 0x06, 0x01, 0xB8, 0x09, 0x06,
+    0x01, 0xBD, 0x0E, 0x08, 0x01, 0xC4, 0x0A, 0x06, 0x01, 0xC9, 0x09, 0x06, 0x01, 0xCF, 0x0A, 0x06,
+    0x01, 0xD4, 0x06, 0x04, 0x01, 0xD8, 0x04, 0x03, 0x01, 0xDA, 0x05, 0x04, 0x01, 0xDE, 0x09, 0x06,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0x01, 0xE3, 0x04, 0x03, 0x01, 0xE5, 0x0A, 0x06,
+    0x01, 0xEB, 0x0C, 0x07, 0x01, 0xF2, 0x0A, 0x06, 0x01, 0xF7, 0x0A, 0x06, 0x01, 0xFE, 0x04, 0x03,
+    0x02, 0x01, 0x0A, 0x06, 0x02, 0x0B, 0x0C, 0x07, 0x02, 0x12, 0x0D, 0x08, 0x02, 0x1A, 0x07, 0x05,
+    0x02, 0x1F, 0x0A, 0x06, 0x02, 0x24, 0x09, 0x06, 0x02, 0x28, 0x03, 0x03, 0x02, 0x2A, 0x0D, 0x08,
+    0x02, 0x32, 0x0B, 0x07, 0x02, 0x36, 0x07, 0x05, 0x02, 0x3A, 0x0A, 0x06, 0x02, 0x40, 0x05, 0x04,
+    0x02, 0x44, 0x05, 0x04, 0x02, 0x48, 0x05, 0x04, 0x02, 0x4A, 0x0A, 0x06, 0x02, 0x4F, 0x09, 0x06,
+    0x02, 0x55, 0x03, 0x03, 0x02, 0x57, 0x0B, 0x07, 0x02, 0x5D, 0x0B, 0x07, 0x02, 0x63, 0x07, 0x05,
+    0x02, 0x67, 0x0A, 0x06, 0x02, 0x6C, 0x10, 0x09, 0x02, 0x75, 0x10, 0x09, 0x02, 0x7E, 0x10, 0x09,
+    0x02, 0x88, 0x0A, 0x06, 0x02, 0x8E, 0x0C, 0x07, 0x02, 0x95, 0x0C, 0x07, 0x02, 0x9B, 0x0C, 0x07,
+    0x02, 0xA2, 0x0B, 0x07, 0x02, 0xA7, 0x0C, 0x07, 0x02, 0xAE, 0x0C, 0x07, 0x02, 0xB4, 0x0C, 0x07,
+    0x02, 0xBB, 0x0C, 0x07, 0x02, 0xC1, 0x0C, 0x07, 0x02, 0xC7, 0x0C, 0x07, 0x02, 0xCD, 0x0C, 0x07,
+    0x02, 0xD3, 0x0C, 0x07, 0x02, 0xD8, 0x0C, 0x07, 0x02, 0xDE, 0x0C, 0x07, 0x02, 0xE4, 0x0C, 0x07,
+    0x02, 0xEA, 0x0C, 0x07, 0x02, 0xEF, 0x0B, 0x07, 0x02, 0xF5, 0x0C, 0x07, 0x02, 0xFB, 0x0B, 0x07,
+    0x03, 0x00, 0x0C, 0x07, 0x03, 0x06, 0x0B, 0x07, 0x03, 0x0D, 0x0C, 0x07, 0x03, 0x13, 0x0C, 0x07,
+    0x03, 0x18, 0x0C, 0x07, 0x03, 0x1E, 0x0C, 0x07, 0x03, 0x24, 0x0E, 0x08, 0x03, 0x2B, 0x0C, 0x07,
+    0x03, 0x31, 0x0C, 0x07, 0x03, 0x37, 0x0C, 0x07, 0x03, 0x3D, 0x0C, 0x07, 0x03, 0x43, 0x0C, 0x07,
+    0x03, 0x49, 0x0C, 0x07, 0x03, 0x4F, 0x0C, 0x07, 0x03, 0x55, 0x0C, 0x07, 0x03, 0x5C, 0x0C, 0x07,
+    0x03, 0x62, 0x0B, 0x07, 0x03, 0x67, 0x0C, 0x07, 0x03, 0x6C, 0x0B, 0x07, 0x03, 0x72, 0x0C, 0x07,
+    0x03, 0x79, 0x0C, 0x07, 0x03, 0x7F, 0x0C, 0x07, 0x03, 0x85, 0x0C, 0x07, 0x03, 0x8B, 0x0C, 0x07,
+    0x03, 0x91, 0x0C, 0x07, 0x03, 0x96, 0x0C, 0x07, 0x03, 0x9C, 0x0C, 0x07, 0x03, 0xA2, 0x0C, 0x07,
+    0x03, 0xA8, 0x0C, 0x07, 0x03, 0xAD, 0x0B, 0x07, 0x03, 0xB2, 0x0C, 0x07, 0x03, 0xB8, 0x0B, 0x07,
+    0x03, 0xBD, 0x0C, 0x07, 0x03, 0xC3, 0x0B, 0x07, 0x03, 0xC9, 0x0C, 0x07, 0x03, 0xCF, 0x0C, 0x07,
+    0x03, 0xD4, 0x0C, 0x07, 0x03, 0xDA, 0x0C, 0x07, 0x03, 0xE0, 0x0E, 0x08, 0x03, 0xE7, 0x0C, 0x07,
+    0x03, 0xED, 0x0C, 0x07, 0x03, 0xF3, 0x0C, 0x07, 0x03, 0xF9, 0x0C, 0x07, 0x03, 0xFF, 0x0C, 0x07,
+    0x04, 0x05, 0x0C, 0x07,
+};
+const uint8_t ArialMT_Plain_10_RU_data[] PROGMEM = {
+    0x0D, 0x20, 0xE8, 0x07, 0x40, 0xBB, 0xE4, 0xFE, 0x3E, 0x4F, 0xE0, 0xE6, 0xDC, 0x96, 0xBF, 0x35,
+    0x5E, 0x18, 0x0E, 0x65, 0x4E, 0x6F, 0x83, 0xED, 0xAA, 0xAC, 0xC0, 0xB3, 0x7E, 0x97, 0x65, 0xF4,
+    0xB8, 0xB5, 0x9E, 0xC8, 0xE8, 0xCB, 0xED, 0xE9, 0x10, 0x88, 0xDB, 0xD3, 0x2E, 0xE4, 0x71, 0x39,
+    0x00, 0xA1, 0x43, 0x76, 0xA1, 0x40, 0x03, 0xD4, 0xB1, 0x60, 0x01, 0x00, 0x1F, 0x27, 0x10, 0xDD,
+    0xA1, 0x42, 0x85, 0xBB, 0x00, 0x09, 0x36, 0x34, 0xE0, 0xD9, 0x43, 0xF7, 0x55, 0x5C, 0xD0, 0xD9,
+    0xA1, 0x55, 0x55, 0x7D, 0xB0, 0xC1, 0x73, 0xC1, 0xDC, 0xD3, 0xD8, 0xEA, 0xDD, 0x17, 0x25, 0xC9,
+    0x79, 0x60, 0xDD, 0xB9, 0x2E, 0x4B, 0x92, 0xFE, 0xB0, 0x82, 0x1F, 0xC9, 0xD0, 0x80, 0xFB, 0x6A,
+    0xAA, 0xAA, 0xAF, 0xB6, 0xF8, 0x6E, 0xEB, 0xBA, 0xEE, 0xB7, 0x60, 0x09, 0x40, 0x09, 0xF5, 0x0A,
+    0x17, 0x2E, 0x6C, 0xC0, 0xB9, 0x72, 0xE5, 0xCB, 0x80, 0x0D, 0x9A, 0xE5, 0xCA, 0x00, 0xD8, 0x82,
+    0x0F, 0x2A, 0xA7, 0x30, 0x0C, 0x3F, 0x3F, 0x4F, 0xEF, 0xB7, 0x2F, 0x7E, 0x5E, 0xFE, 0x7F, 0xF7,
+    0x6F, 0x7D, 0xBF, 0x19, 0xF4, 0x16, 0x1B, 0xEC, 0xEE, 0x7D, 0x98, 0x61, 0x00, 0x0D, 0x3D, 0x55,
+    0x55, 0x56, 0xEC, 0x0D, 0xDA, 0x14, 0x28, 0x5B, 0x30, 0x0D, 0x3C, 0x28, 0x5B, 0x36, 0x40, 0x0D,
+    0x3D, 0x55, 0x55, 0x55, 0x50, 0x0D, 0x3D, 0x4A, 0x90, 0x0C, 0x9B, 0x34, 0x2A, 0xAF, 0xD3, 0x60,
+    0x0D, 0x3D, 0x0A, 0x14, 0x34, 0xE0, 0x0D, 0x38, 0x1C, 0x42, 0xD3, 0x00, 0x0D, 0x3D, 0x8E, 0xA7,
+    0x82, 0x18, 0x40, 0x0D, 0x38, 0x84, 0x21, 0x00, 0x0D, 0x3F, 0x33, 0x0C, 0x2C, 0x37, 0x33, 0x4E,
+    0x0D, 0x3F, 0x32, 0x85, 0x9B, 0x4E, 0x0D, 0xDA, 0x14, 0x28, 0x50, 0xB7, 0x60, 0x0D, 0x3D, 0x4A,
+    0x95, 0x39, 0x80, 0x0D, 0xDA, 0x14, 0x28, 0x78, 0x7D, 0xD0, 0x0D, 0x3D, 0x4A, 0x9E, 0x4E, 0x6E,
+    0x0E, 0x6D, 0x55, 0x55, 0x55, 0xE1, 0x80, 0x08, 0x20, 0xD3, 0xC1, 0x00, 0x0D, 0x30, 0x84, 0x2D,
+    0x30, 0x83, 0xE0, 0xB3, 0x0A, 0xCD, 0xF0, 0x40, 0xE2, 0x65, 0x85, 0xBB, 0x41, 0xBB, 0x0B, 0x2D,
+    0xC4, 0x14, 0x37, 0x83, 0xA9, 0xE0, 0x86, 0x10, 0x83, 0x62, 0x4C, 0x3C, 0x9B, 0x10, 0x87, 0xEE,
+    0xBC, 0xAE, 0xCB, 0xA2, 0xE2, 0x80, 0x0D, 0x70, 0x88, 0xE2, 0x64, 0x1C, 0x88, 0xD7, 0x00, 0xA1,
+    0xCC, 0x83, 0x99, 0x40, 0x20, 0x82, 0x08, 0x20, 0x80, 0x83, 0x60, 0x01, 0xEE, 0xAE, 0xB2, 0xE0,
+    0x0D, 0x3C, 0xA9, 0x58, 0x60, 0x0C, 0x34, 0xA9, 0x54, 0x60, 0x0C, 0x34, 0xA9, 0x5A, 0x70, 0x0C,
+    0x35, 0xD5, 0xD6, 0x10, 0x93, 0x77, 0xE4, 0x0C, 0x7E, 0x27, 0xDE, 0x7D, 0xF3, 0xF9, 0x0D, 0x3C,
+    0x92, 0x61, 0xC0, 0x0F, 0xF3, 0x80, 0x23, 0xFD, 0xF9, 0xD3, 0xD8, 0xC3, 0x4A, 0x0D, 0x38, 0x0C,
+    0xBC, 0x92, 0x65, 0xE4, 0x93, 0x0E, 0x0C, 0xBC, 0x92, 0x61, 0xC0, 0x0C, 0x34, 0xA9, 0x58, 0x60,
+    0x0C, 0xF0, 0x95, 0x2B, 0x0C, 0x0C, 0x34, 0xA9, 0x59, 0xE0, 0x0C, 0xBC, 0x80, 0xA2, 0xBA, 0xBA,
+    0x96, 0x93, 0x4F, 0x28, 0x0C, 0xB0, 0x85, 0x97, 0x93, 0x0C, 0x2C, 0x34, 0x80, 0xCB, 0x0B, 0x0D,
+    0x26, 0x18, 0x59, 0x60, 0x95, 0x46, 0xB1, 0x46, 0x94, 0x93, 0x1E, 0xC7, 0xAE, 0x1A, 0x40, 0x95,
+    0x2F, 0x75, 0xD5, 0x4A, 0xB1, 0xF3, 0xC2, 0x20, 0x0D, 0x70, 0x88, 0xF9, 0xE1, 0x60, 0xC1, 0x43,
+    0x05, 0x8C, 0x00, 0x0B, 0xF0, 0x0C, 0x35, 0xF8, 0x7C, 0xAA, 0x30, 0xA2, 0xF8, 0x7F, 0x2A, 0xAA,
+    0x16, 0xC8, 0x0C, 0xB4, 0xB4, 0xB6, 0x58, 0xAB, 0x7C, 0x36, 0x1F, 0xE1, 0xAA, 0xC0, 0x0E, 0x9C,
+    0x00, 0xFE, 0xFA, 0x72, 0xF6, 0xAF, 0xB5, 0x7D, 0xFC, 0x7E, 0x00, 0x0C, 0xBF, 0xD2, 0xBA, 0xFA,
+    0x52, 0x80, 0xC9, 0xB3, 0x55, 0x7D, 0x2F, 0xA5, 0xB3, 0x64, 0xEC, 0x76, 0x3B, 0x1F, 0x20, 0x0B,
+    0x35, 0x15, 0x9A, 0x88, 0x92, 0x49, 0x24, 0xC8, 0xB1, 0x60, 0xC9, 0xB3, 0x7F, 0x97, 0x65, 0xE5,
+    0x6C, 0xD9, 0x42, 0x10, 0x84, 0x20, 0x0E, 0x87, 0x23, 0xA0, 0xA2, 0xA2, 0xDD, 0xE8, 0xA8, 0x80,
+    0xA9, 0xD8, 0xFD, 0x80, 0xA9, 0xFB, 0x3B, 0x00, 0x0D, 0x88, 0x0C, 0xF0, 0x10, 0xB2, 0xE0, 0xF8,
+    0x35, 0xC2, 0x0D, 0x70, 0x80, 0x0A, 0x00, 0x0C, 0x37, 0xD2, 0xBA, 0xFA, 0x58, 0x0D, 0xDE, 0x85,
+    0x8D, 0x3C, 0x00, 0xE6, 0x54, 0xA9, 0xCC, 0x0A, 0x2B, 0x35, 0x15, 0x98, 0x0D, 0x97, 0xCB, 0x60,
+    0x96, 0xF0, 0xDE, 0x5C, 0x60, 0x0D, 0x97, 0xCB, 0x58, 0xEA, 0x7E, 0x95, 0x5F, 0x08, 0xA9, 0xFB,
+    0x3B, 0x3D, 0x8E, 0xAD, 0xE1, 0xBC, 0xB8, 0xC0, 0x03, 0xD4, 0xF6, 0xBF, 0xB1, 0xE8, 0x0D, 0xDF,
+    0xB9, 0xDC, 0xEE, 0x6E, 0xE0, 0x0D, 0x3D, 0x55, 0x55, 0x57, 0x76, 0x0D, 0x3D, 0x55, 0x55, 0x57,
+    0xDB, 0x00, 0x0D, 0x3C, 0x10, 0x41, 0xC4, 0x01, 0x7F, 0xCF, 0xE8, 0xBF, 0xE7, 0x10, 0x0D, 0x3D,
+    0x55, 0x55, 0x54, 0x20, 0x0F, 0xE3, 0xD0, 0xD3, 0xD0, 0xFE, 0x38, 0x08, 0x55, 0x55, 0x55, 0x5F,
+    0x6C, 0x0D, 0x3D, 0x8A, 0x12, 0x69, 0xC0, 0x0C, 0xBC, 0x37, 0x82, 0xA6, 0x5C, 0x0D, 0x3D, 0x0B,
+    0x9B, 0x34, 0x20, 0x01, 0x6E, 0xD0, 0x41, 0xA7, 0x0D, 0x3E, 0xC7, 0x53, 0x63, 0x4E, 0x0D, 0x3D,
+    0x0A, 0x14, 0x34, 0xE0, 0x0D, 0xDA, 0x14, 0x28, 0x5B, 0xB0, 0x0D, 0x3C, 0x10, 0x41, 0xA7, 0x0D,
+    0x3D, 0x4A, 0x95, 0x39, 0x80, 0x0D, 0xDA, 0x14, 0x28, 0x5B, 0x30, 0x08, 0x20, 0xD3, 0xC1, 0x00,
+    0x0E, 0x85, 0x15, 0x15, 0x16, 0x98, 0x0F, 0x83, 0xB9, 0xA7, 0xEE, 0x7C, 0x00, 0x0E, 0x2F, 0x72,
+    0x85, 0xCE, 0x2E, 0x0D, 0x38, 0x85, 0xA7, 0x10, 0x0E, 0x85, 0x0A, 0x14, 0x34, 0xE0, 0x0D, 0x38,
+    0xB4, 0xE2, 0xD3, 0x80, 0x0D, 0x38, 0xB4, 0xE2, 0xD3, 0x9E, 0xA0, 0x08, 0x34, 0xF4, 0x54, 0x56,
+    0x60, 0x0D, 0x3D, 0x15, 0x15, 0x9B, 0x4E, 0x0D, 0x3D, 0x15, 0x15, 0x15, 0x98, 0x0D, 0x9A, 0x15,
+    0x55, 0x56, 0xEC, 0x0D, 0x3D, 0x0D, 0xDA, 0x16, 0xEC, 0x0E, 0x6A, 0xAD, 0xE4, 0xA9, 0xA7, 0x01,
+    0xAE, 0xAE, 0xAE, 0xB0, 0xE0, 0x0C, 0xB7, 0xE9, 0x7E, 0x95, 0x57, 0x76, 0x0C, 0xBD, 0xD5, 0xD5,
+    0xD5, 0x18, 0x0C, 0xBC, 0x92, 0x49, 0xD4, 0x01, 0x61, 0xE5, 0x65, 0xC4, 0x0C, 0x35, 0xD5, 0xD5,
+    0xD6, 0x00, 0x0E, 0xAF, 0x63, 0x2F, 0x63, 0xAB, 0x80, 0x09, 0x57, 0x57, 0x57, 0x54, 0x60, 0x0C,
+    0xB8, 0xD6, 0x28, 0x65, 0xC0, 0x0C, 0xB8, 0xDF, 0xFC, 0xA1, 0x97, 0x0C, 0xBD, 0x8B, 0x14, 0x69,
+    0x40, 0x01, 0x61, 0xA4, 0x93, 0x2E, 0x0C, 0xBD, 0x0B, 0x14, 0x32, 0xE0, 0x0C, 0xBD, 0x8B, 0x16,
+    0x32, 0xE0, 0x0C, 0x34, 0xA9, 0x52, 0xB0, 0xC0, 0x0C, 0xBC, 0x92, 0x49, 0x97, 0x0C, 0xBD, 0xCB,
+    0x97, 0x28, 0x0C, 0x34, 0xA9, 0x52, 0xA8, 0x80, 0x09, 0x24, 0xCB, 0xC9, 0x20, 0x0E, 0xA5, 0x95,
+    0x95, 0x96, 0x58, 0x0C, 0x12, 0xD9, 0x79, 0x6C, 0x00, 0x09, 0x54, 0x6B, 0x14, 0x69, 0x40, 0x0C,
+    0xB8, 0x85, 0x97, 0x10, 0x0E, 0xA5, 0x8B, 0x16, 0x32, 0xE0, 0x0C, 0xB8, 0xB2, 0xE2, 0xCB, 0x80,
+    0x0C, 0xB8, 0xB2, 0xE2, 0xCB, 0x9E, 0xA0, 0x09, 0x32, 0xF6, 0x56, 0x43, 0x00, 0x0C, 0xBD, 0x95,
+    0x90, 0xD9, 0x70, 0x0C, 0xBD, 0x95, 0x95, 0x90, 0xC0, 0x0A, 0x34, 0xAB, 0xAB, 0xAC, 0x30, 0x0C,
+    0xBD, 0x8C, 0x34, 0xAC, 0x30, 0x0A, 0x2B, 0xB5, 0xCB, 0x99, 0x70,
+};
+const uint8_t ArialMT_Plain_10_RU_huffman[] PROGMEM = {
+    0x00, 0x01, 0x01, 0x04, 0x07, 0x02, 0x0A, 0x08, 0x07, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x01, 0x03, 0x08, 0x20, 0x40, 0x48, 0x80, 0xA0, 0xC0, 0xE0, 0xF8, 0x10, 0xF0, 0x0F,
+    0x18, 0x28, 0x30, 0x38, 0x60, 0x68, 0x88, 0x90, 0xC8, 0x04, 0x06, 0x09, 0x0A, 0x70, 0x78, 0xA8,
+    0xB0, 0x05, 0x07, 0x50, 0x58, 0xB8, 0xD0, 0xE8, 0xFC, 0x0B, 0x98,
+};
+const CompressedFont ArialMT_Plain_10_RU = {ArialMT_Plain_10_RU_header, ArialMT_Plain_10_RU_data, ArialMT_Plain_10_RU_huffman};
+
+const uint8_t ArialMT_Plain_16_RU_header[] PROGMEM = {
+    0x10, 0x13, 0x20, 0xE0, 0xFF, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x08, 0x05, 0x00, 0x03, 0x0D, 0x06,
+    0x00, 0x07, 0x1A, 0x09, 0x00, 0x16, 0x17, 0x09, 0x00, 0x24, 0x26, 0x0E, 0x00, 0x38, 0x1D, 0x0B,
+    0x00, 0x47, 0x04, 0x03, 0x00, 0x49, 0x0C, 0x05, 0x00, 0x4F, 0x0B, 0x05, 0x00, 0x55, 0x0D, 0x06,
+    0x00, 0x5B, 0x17, 0x09, 0x00, 0x63, 0x09, 0x04, 0x00, 0x66, 0x0B, 0x05, 0x00, 0x69, 0x08, 0x04,
+    0x00, 0x6B, 0x0A, 0x04, 0x00, 0x71, 0x17, 0x09, 0x00, 0x7C, 0x11, 0x09, 0x00, 0x81, 0x17, 0x09,
+    0x00, 0x8D, 0x17, 0x09, 0x00, 0x99, 0x17, 0x09, 0x00, 0xA3, 0x17, 0x09, 0x00, 0xB0, 0x17, 0x09,
+    0x00, 0xBD, 0x16, 0x09, 0x00, 0xC6, 0x17, 0x09, 0x00, 0xD4, 0x17, 0x09, 0x00, 0xE1, 0x05, 0x04,
+    0x00, 0xE3, 0x06, 0x04, 0x00, 0xE6, 0x17, 0x09, 0x00, 0xF0, 0x17, 0x09, 0x00, 0xF9, 0x17, 0x09,
+    0x01, 0x03, 0x16, 0x09, 0x01, 0x0C, 0x2F, 0x10, 0x01, 0x2E, 0x1D, 0x0B, 0x01, 0x3C, 0x1D, 0x0B,
+    0x01, 0x4B, 0x20, 0x0C, 0x01, 0x59, 0x20, 0x0C, 0x01, 0x66, 0x1D, 0x0B, 0x01, 0x73, 0x19, 0x0A,
+    0x01, 0x7E, 0x20, 0x0C, 0x01, 0x8F, 0x1D, 0x0B, 0x01, 0x9A, 0x05, 0x03, 0x01, 0x9C, 0x14, 0x08,
+    0x01, 0xA3, 0x1D, 0x0B, 0x01, 0xAF, 0x17, 0x09, 0x01, 0xB6, 0x23, 0x0D, 0x01, 0xC4, 0x1D, 0x0B,
+    0x01, 0xCF, 0x20, 0x0C, 0x01, 0xDD, 0x1C, 0x0B, 0x01, 0xEA, 0x20, 0x0C, 0x01, 0xFB, 0x1D, 0x0B,
+    0x02, 0x0A, 0x1D, 0x0B, 0x02, 0x19, 0x19, 0x09, 0x02, 0x21, 0x1D, 0x0B, 0x02, 0x2B, 0x1C, 0x0B,
+    0x02, 0x36, 0x2B, 0x0F, 0x02, 0x4A, 0x20, 0x0B, 0x02, 0x59, 0x19, 0x09, 0x02, 0x63, 0x1A, 0x09,
+    0x02, 0x71, 0x0C, 0x04, 0x02, 0x77, 0x0B, 0x04, 0x02, 0x7D, 0x09, 0x04, 0x02, 0x83, 0x14, 0x07,
+    0x02, 0x8A, 0x1B, 0x09, 0x02, 0x93, 0x07, 0x05, 0x02, 0x95, 0x17, 0x09, 0x02, 0xA1, 0x17, 0x09,
+    0x02, 0xAA, 0x14, 0x08, 0x02, 0xB2, 0x17, 0x09, 0x02, 0xBB, 0x17, 0x09, 0x02, 0xC7, 0x0A, 0x04,
+    0x02, 0xCC, 0x17, 0x09, 0x02, 0xD9, 0x14, 0x08, 0x02, 0xE0, 0x05, 0x04, 0x02, 0xE3, 0x06, 0x03,
+    0x02, 0xE7, 0x17, 0x08, 0x02, 0xF1, 0x05, 0x03, 0x02, 0xF3, 0x23, 0x0D, 0x02, 0xFE, 0x14, 0x08,
+    0x03, 0x05, 0x17, 0x09, 0x03, 0x0E, 0x17, 0x09, 0x03, 0x19, 0x18, 0x09, 0x03, 0x24, 0x0D, 0x05,
+    0x03, 0x28, 0x14, 0x08, 0x03, 0x33, 0x0B, 0x04, 0x03, 0x38, 0x14, 0x08, 0x03, 0x3F, 0x13, 0x07,
+    0x03, 0x47, 0x1F, 0x0B, 0x03, 0x53, 0x14, 0x07, 0x03, 0x5C, 0x13, 0x07, 0x03, 0x67, 0x14, 0x07,
+    0x03, 0x72, 0x0F, 0x05, 0x03, 0x7A, 0x06, 0x03, 0x03, 0x7D, 0x0E, 0x05, 0x03, 0x85, 0x17, 0x09,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10,
+    0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0x03, 0x8D, 0x09, 0x05, 0x03, 0x91, 0x17, 0x09,
+    0x03, 0x9E, 0x17, 0x09, 0x03, 0xAC, 0x14, 0x09, 0x03, 0xB6, 0x1A, 0x09, 0x03, 0xC7, 0x06, 0x03,
+    0x03, 0xCB, 0x17, 0x09, 0x03, 0xDE, 0x1D, 0x0B, 0x03, 0xEE, 0x23, 0x0C, 0x04, 0x05, 0x0E, 0x05,
+    0x04, 0x0E, 0x14, 0x09, 0x04, 0x16, 0x17, 0x09, 0x04, 0x1E, 0x0B, 0x05, 0x04, 0x21, 0x23, 0x0C,
+    0x04, 0x38, 0x19, 0x09, 0x04, 0x41, 0x0D, 0x06, 0x04, 0x47, 0x17, 0x09, 0x04, 0x50, 0x0E, 0x05,
+    0x04, 0x59, 0x0D, 0x05, 0x04, 0x61, 0x0A, 0x05, 0x04, 0x64, 0x17, 0x09, 0x04, 0x6D, 0x19, 0x09,
+    0x04, 0x7A, 0x08, 0x05, 0x04, 0x7C, 0x17, 0x09, 0x04, 0x89, 0x0B, 0x05, 0x04, 0x8D, 0x0D, 0x05,
+    0x04, 0x94, 0x17, 0x09, 0x04, 0x9D, 0x26, 0x0D, 0x04, 0xAE, 0x26, 0x0D, 0x04, 0xC0, 0x26, 0x0D,
+    0x04, 0xD4, 0x1B, 0x0C, 0x04, 0xE0, 0x1D, 0x0B, 0x04, 0xEE, 0x1A, 0x0B, 0x04, 0xFC, 0x1D, 0x0B,
+    0x05, 0x0B, 0x19, 0x09, 0x05, 0x13, 0x1E, 0x0B, 0x05, 0x22, 0x1D, 0x0B, 0x05, 0x2F, 0x2C, 0x0F,
+    0x05, 0x46, 0x1A, 0x0A, 0x05, 0x54, 0x20, 0x0C, 0x05, 0x5F, 0x20, 0x0C, 0x05, 0x6D, 0x1A, 0x09,
+    0x05, 0x78, 0x1A, 0x0B, 0x05, 0x82, 0x23, 0x0D, 0x05, 0x90, 0x1D, 0x0B, 0x05, 0x9B, 0x20, 0x0C,
+    0x05, 0xA9, 0x1D, 0x0C, 0x05, 0xB2, 0x1C, 0x0B, 0x05, 0xBF, 0x20, 0x0C, 0x05, 0xCD, 0x19, 0x09,
+    0x05, 0xD5, 0x1C, 0x0A, 0x05, 0xE3, 0x23, 0x0D, 0x05, 0xF5, 0x20, 0x0B, 0x06, 0x05, 0x21, 0x0C,
+    0x06, 0x10, 0x1A, 0x0B, 0x06, 0x1A, 0x26, 0x0F, 0x06, 0x26, 0x2A, 0x0F, 0x06, 0x33, 0x23, 0x0D,
+    0x06, 0x40, 0x23, 0x0E, 0x06, 0x4D, 0x1A, 0x0A, 0x06, 0x57, 0x1D, 0x0C, 0x06, 0x66, 0x2C, 0x10,
+    0x06, 0x7D, 0x20, 0x0C, 0x06, 0x8E, 0x17, 0x09, 0x06, 0x9A, 0x1A, 0x09, 0x06, 0xAB, 0x14, 0x09,
+    0x06, 0xB6, 0x10, 0x06, 0x06, 0xBB, 0x1B, 0x09, 0x06, 0xC8, 0x17, 0x09, 0x06, 0xD4, 0x20, 0x0B,
+    0x06, 0xE3, 0x11, 0x07, 0x06, 0xEB, 0x17, 0x09, 0x06, 0xF3, 0x17, 0x09, 0x06, 0xFD, 0x14, 0x07,
+    0x07, 0x06, 0x17, 0x09, 0x07, 0x0D, 0x1D, 0x0B, 0x07, 0x19, 0x17, 0x09, 0x07, 0x21, 0x17, 0x09,
+    0x07, 0x2A, 0x17, 0x09, 0x07, 0x31, 0x17, 0x09, 0x07, 0x3C, 0x14, 0x08, 0x07, 0x44, 0x13, 0x07,
+    0x07, 0x4A, 0x13, 0x07, 0x07, 0x55, 0x23, 0x0D, 0x07, 0x67, 0x17, 0x09, 0x07, 0x70, 0x1A, 0x0A,
+    0x07, 0x78, 0x14, 0x08, 0x07, 0x7F, 0x23, 0x0D, 0x07, 0x8A, 0x23, 0x0D, 0x07, 0x95, 0x1A, 0x0A,
+    0x07, 0x9F, 0x1D, 0x0C, 0x07, 0xAA, 0x17, 0x09, 0x07, 0xB3, 0x14, 0x08, 0x07, 0xBD, 0x20, 0x0C,
+    0x07, 0xCC, 0x17, 0x09,
+};
+const uint8_t ArialMT_Plain_16_RU_data[] PROGMEM = {
+    0x03, 0x6F, 0xB4, 0x1F, 0x10, 0x0F, 0x88, 0xBC, 0x2F, 0xF1, 0x63, 0xA1, 0xF8, 0x42, 0xF0, 0xBF,
+    0xC5, 0x8E, 0x87, 0xE1, 0x0B, 0xC0, 0x1C, 0xA8, 0xA7, 0xB1, 0x1A, 0xBF, 0xFF, 0xCD, 0x1D, 0xC8,
+    0xF6, 0xBB, 0x3A, 0x80, 0x1E, 0x44, 0x64, 0x8C, 0x91, 0xF7, 0x3C, 0xBA, 0x4F, 0x43, 0x19, 0x3B,
+    0x3E, 0xC4, 0x77, 0x1D, 0xC7, 0x71, 0xF6, 0x00, 0x0E, 0xA7, 0x87, 0xB5, 0xE3, 0xAA, 0x3E, 0x0F,
+    0x1E, 0x0F, 0x0E, 0xB2, 0x87, 0x59, 0xC0, 0x1F, 0x10, 0x17, 0xF7, 0xBC, 0x31, 0x94, 0x33, 0x10,
+    0xCF, 0xC3, 0x19, 0x5F, 0xDE, 0xA1, 0xFB, 0x8E, 0xD3, 0xF7, 0x14, 0x0C, 0xCC, 0xCC, 0xD8, 0xDE,
+    0x66, 0x66, 0x66, 0x01, 0x8C, 0x80, 0x41, 0x04, 0x10, 0x01, 0x20, 0x71, 0x3D, 0x6E, 0x59, 0x3A,
+    0x40, 0x1C, 0xB7, 0xA9, 0x54, 0x4A, 0x25, 0x12, 0xA5, 0x5C, 0xB7, 0x80, 0x02, 0x4A, 0x94, 0x36,
+    0xB0, 0x15, 0x95, 0x38, 0xA3, 0xF4, 0x23, 0xBD, 0x1C, 0x1D, 0x3F, 0x07, 0x29, 0x15, 0xEC, 0x52,
+    0xA8, 0xD5, 0x1A, 0xBC, 0x75, 0x79, 0x7B, 0x4E, 0xA0, 0x73, 0x9E, 0x93, 0xE7, 0x62, 0x15, 0x85,
+    0x21, 0xB5, 0x88, 0x18, 0xFA, 0x5F, 0x85, 0x5E, 0x32, 0xF1, 0x97, 0x8C, 0xA3, 0xD8, 0x8F, 0x58,
+    0x1C, 0xB7, 0xA9, 0xEC, 0x78, 0xCB, 0xC6, 0x5E, 0x32, 0xA7, 0xB1, 0x5F, 0x58, 0x02, 0x08, 0x23,
+    0xE2, 0xF1, 0xE6, 0x7E, 0xC3, 0xA4, 0x1C, 0x7A, 0x9F, 0x2F, 0x6A, 0x35, 0x46, 0xA8, 0xD5, 0xF2,
+    0xF6, 0xB8, 0xF5, 0x00, 0x1C, 0xBE, 0x95, 0x3D, 0xA8, 0xE0, 0x8E, 0x08, 0xE0, 0xA7, 0xB5, 0xCB,
+    0x78, 0x13, 0x20, 0x13, 0x8C, 0x80, 0x0C, 0xCF, 0x98, 0xF9, 0x97, 0x85, 0xE1, 0x78, 0x4D, 0x00,
+    0x17, 0x85, 0xE1, 0x78, 0x5E, 0x17, 0x85, 0xE1, 0x78, 0x13, 0x45, 0xE1, 0x78, 0x5E, 0x0F, 0x98,
+    0xF9, 0x8C, 0xC0, 0x1C, 0x4A, 0x10, 0x47, 0xF7, 0xA3, 0x35, 0x32, 0x72, 0x0F, 0x7B, 0x12, 0xAD,
+    0xD4, 0xF5, 0xE5, 0x4F, 0x66, 0x5E, 0x33, 0x9F, 0x7C, 0xE7, 0xDF, 0x39, 0xF7, 0xD7, 0x3F, 0x1F,
+    0xF6, 0xCF, 0xF1, 0xF8, 0x67, 0x49, 0xCE, 0x95, 0xCB, 0x8D, 0x32, 0xBF, 0xFC, 0x80, 0x0E, 0x27,
+    0x52, 0xFC, 0xCF, 0x0D, 0x11, 0xA3, 0xC3, 0x45, 0xF9, 0x8E, 0xA3, 0x88, 0x1B, 0x59, 0x1A, 0xA3,
+    0x54, 0x6A, 0x8D, 0x51, 0xAA, 0x35, 0x7C, 0xBD, 0xAE, 0x3D, 0x40, 0x18, 0xE8, 0x56, 0x8A, 0x55,
+    0x12, 0x89, 0x44, 0xA2, 0x51, 0x2A, 0x55, 0x5A, 0x00, 0x1B, 0x59, 0x12, 0x89, 0x44, 0xA2, 0x51,
+    0x28, 0x95, 0x2A, 0xAD, 0x18, 0xE8, 0x1B, 0x59, 0x1A, 0xA3, 0x54, 0x6A, 0x8D, 0x51, 0xAA, 0x35,
+    0x46, 0xA8, 0x90, 0x1B, 0x59, 0x19, 0xA3, 0x34, 0x66, 0x8C, 0xD1, 0x9A, 0x33, 0x40, 0x18, 0xE8,
+    0x56, 0x8A, 0x55, 0x12, 0x89, 0x47, 0x72, 0x3B, 0x94, 0xF6, 0xAB, 0xFC, 0x67, 0xF1, 0x00, 0x1B,
+    0x58, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC9, 0xB5, 0x80, 0x1B, 0x58, 0x0E, 0xD2, 0x49, 0x24,
+    0x96, 0xDE, 0xF0, 0x1B, 0x58, 0xD0, 0xCC, 0xC9, 0x7D, 0xC9, 0xD1, 0x5E, 0x95, 0x2A, 0x89, 0x1B,
+    0x58, 0x92, 0x49, 0x24, 0x92, 0x40, 0x1B, 0x59, 0xD8, 0x60, 0x6E, 0x3A, 0x8E, 0x27, 0x51, 0xB9,
+    0x83, 0xB0, 0xDA, 0xC0, 0x1B, 0x59, 0x43, 0x89, 0x71, 0xB8, 0xD0, 0xE9, 0x2A, 0xDA, 0xC0, 0x18,
+    0xE8, 0x56, 0x8A, 0x55, 0x12, 0x89, 0x44, 0xA2, 0x54, 0xAA, 0xB4, 0x63, 0xA0, 0x1B, 0x59, 0x19,
+    0xA3, 0x34, 0x66, 0x8C, 0xD1, 0x9A, 0x33, 0x53, 0x27, 0x20, 0x18, 0xE8, 0x56, 0x8A, 0x55, 0x12,
+    0x89, 0x47, 0xE8, 0x47, 0xE8, 0x52, 0xAA, 0xF8, 0x31, 0xF6, 0x80, 0x1B, 0x59, 0x19, 0xA3, 0x34,
+    0x66, 0x8C, 0xD1, 0xE8, 0x47, 0xF3, 0x29, 0xEC, 0x72, 0x90, 0x1C, 0x68, 0xF9, 0x55, 0x1A, 0xA3,
+    0x54, 0x6A, 0x8E, 0xE4, 0x77, 0x29, 0xED, 0x57, 0xA8, 0x82, 0x08, 0x20, 0xDA, 0xC8, 0x20, 0x82,
+    0x00, 0x1B, 0x6F, 0x2A, 0x49, 0x24, 0x92, 0x49, 0x56, 0xDB, 0xC0, 0x1D, 0x27, 0x21, 0xCC, 0x74,
+    0x9C, 0x4E, 0x93, 0x99, 0xC8, 0xE9, 0xE9, 0x39, 0x64, 0x7A, 0xCE, 0x27, 0x52, 0xFB, 0x9E, 0x04,
+    0x1E, 0x05, 0xF7, 0x1D, 0x47, 0x13, 0xD6, 0xE5, 0x93, 0xA4, 0x4A, 0x2A, 0xA5, 0x1C, 0x79, 0xD7,
+    0xCC, 0xC9, 0x7C, 0xDC, 0x79, 0xD4, 0xA2, 0x2A, 0x48, 0x83, 0xB0, 0x92, 0xF9, 0x1F, 0x7A, 0xF9,
+    0x24, 0xEC, 0x20, 0x4A, 0x38, 0xA3, 0xF5, 0x23, 0x82, 0x3E, 0x0F, 0x19, 0x7E, 0xC9, 0x74, 0xCA,
+    0x24, 0x1B, 0x79, 0xEE, 0x86, 0x70, 0xCC, 0xE9, 0x39, 0x64, 0x7A, 0xCE, 0x20, 0x86, 0x70, 0xCF,
+    0x6F, 0x3D, 0xC0, 0x64, 0xC1, 0xD8, 0x41, 0xD8, 0x60, 0x64, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x10, 0x50, 0x0F, 0xCA, 0xBF, 0x04, 0xF0, 0x4F, 0x04, 0xF7, 0x27, 0xDA, 0xBD,
+    0x80, 0x1B, 0x59, 0x7A, 0xA6, 0x53, 0x29, 0x95, 0xEA, 0x6F, 0x0D, 0xEB, 0xD5, 0x32, 0x99, 0x4C,
+    0xAF, 0x50, 0x0D, 0xEB, 0xD5, 0x32, 0x99, 0x4C, 0xAF, 0x56, 0xD6, 0x0D, 0xEB, 0xFB, 0x93, 0xC1,
+    0x3C, 0x13, 0xC1, 0x7F, 0x71, 0xF9, 0x00, 0x93, 0xCA, 0xCE, 0xF3, 0xBC, 0x0D, 0xF9, 0x5E, 0xB9,
+    0xCC, 0xE7, 0x33, 0x9C, 0xCE, 0x77, 0xAE, 0x58, 0xF3, 0x1B, 0x59, 0x72, 0x49, 0x24, 0xBD, 0x80,
+    0x1F, 0x8D, 0x80, 0x33, 0xFC, 0x7C, 0xF2, 0x1B, 0x58, 0x83, 0x43, 0xD0, 0x7F, 0x2A, 0xF5, 0x4C,
+    0x80, 0x1B, 0x58, 0x18, 0xB2, 0xE4, 0x92, 0x49, 0x7B, 0x2E, 0x49, 0x24, 0x97, 0xB0, 0x18, 0xB2,
+    0xE4, 0x92, 0x49, 0x7B, 0x00, 0x0D, 0xEB, 0xD5, 0x32, 0x99, 0x4C, 0xAF, 0x53, 0x78, 0x18, 0xF3,
+    0xDD, 0x7E, 0x29, 0x94, 0xCA, 0x65, 0x7A, 0x9B, 0xC0, 0x0D, 0xEB, 0xD5, 0x32, 0x99, 0x4C, 0xAF,
+    0x56, 0x3C, 0xF7, 0x00, 0x18, 0xB2, 0xE4, 0x92, 0x17, 0xFE, 0x84, 0xF0, 0x4F, 0x04, 0xF0, 0x4F,
+    0x05, 0xFB, 0x40, 0x93, 0xCA, 0xC9, 0x94, 0xC8, 0x18, 0xF7, 0x92, 0x49, 0x25, 0x58, 0xB0, 0xC0,
+    0xDC, 0x75, 0x1C, 0x4E, 0xA3, 0x73, 0x00, 0xC0, 0xDE, 0x71, 0x3A, 0x8D, 0xCC, 0x0D, 0xC7, 0x51,
+    0xC4, 0xDE, 0xC0, 0x99, 0x5E, 0xA7, 0xA8, 0xD0, 0xF5, 0x2F, 0x54, 0xC8, 0xC6, 0x47, 0xA3, 0x37,
+    0x6E, 0x6C, 0x64, 0xF8, 0x9C, 0xCC, 0x00, 0x99, 0x4F, 0x14, 0xFE, 0xA4, 0xF0, 0x4F, 0xC1, 0x89,
+    0x4C, 0x80, 0x68, 0x68, 0xF2, 0xFE, 0x19, 0x43, 0x38, 0x66, 0x1B, 0x79, 0xEE, 0x86, 0x70, 0xCF,
+    0xCB, 0xF8, 0x64, 0xD0, 0xD0, 0x66, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x64, 0x02, 0x7C, 0xF7,
+    0x00, 0x0D, 0xEB, 0xD7, 0x74, 0xF9, 0x27, 0xFB, 0x98, 0xD5, 0xF8, 0x54, 0xFA, 0x40, 0x6A, 0xF2,
+    0xFA, 0x9D, 0x3F, 0xD2, 0x8F, 0x62, 0x3E, 0xE4, 0x4A, 0x92, 0xAD, 0x40, 0x13, 0xF4, 0x2F, 0xA2,
+    0x61, 0x30, 0xBE, 0x89, 0xFA, 0x00, 0x8F, 0x4A, 0x9E, 0x97, 0x1F, 0x4A, 0xFF, 0x41, 0xF7, 0xAF,
+    0xF4, 0x38, 0xFA, 0x54, 0xF4, 0xA3, 0xD2, 0x1B, 0x7F, 0xF6, 0xE0, 0x7F, 0xC3, 0xC3, 0xE7, 0xCB,
+    0xF1, 0xA6, 0x7E, 0x34, 0xCE, 0x3D, 0x99, 0xC7, 0xDD, 0x9F, 0x67, 0xFD, 0xE4, 0xE7, 0x1B, 0x59,
+    0x1A, 0xBE, 0x7D, 0x5E, 0x9D, 0x51, 0xAB, 0xE7, 0xD5, 0xE9, 0xD5, 0x1A, 0xA2, 0x40, 0xC7, 0x42,
+    0xB4, 0x52, 0xAF, 0xC7, 0xFB, 0x1D, 0x7D, 0xEE, 0xBE, 0xF7, 0x5F, 0x7B, 0xAF, 0xBD, 0xDF, 0xC1,
+    0x4A, 0xAB, 0x46, 0x3A, 0x00, 0xFD, 0xC7, 0x7E, 0x4E, 0xBC, 0x9D, 0x79, 0x3C, 0xB2, 0x0D, 0x0F,
+    0x52, 0xF5, 0x34, 0x3D, 0x4B, 0xD4, 0x17, 0x2E, 0x5C, 0xB9, 0x72, 0xE5, 0xFA, 0x00, 0x41, 0x04,
+    0x10, 0xC7, 0x42, 0xB4, 0x52, 0xAF, 0xFD, 0xFC, 0xEE, 0xBD, 0x5D, 0x7A, 0xBA, 0xFE, 0x0E, 0xBF,
+    0xEB, 0x7E, 0x3D, 0xEA, 0x55, 0x5A, 0x31, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+    0xD0, 0x1D, 0x87, 0x79, 0xDE, 0x76, 0x00, 0x0D, 0x4D, 0x4D, 0x5C, 0xBF, 0x39, 0xA9, 0xA9, 0xA8,
+    0xA6, 0x4F, 0x1C, 0x9D, 0xF9, 0x3B, 0xF2, 0x76, 0x64, 0xF9, 0x11, 0x92, 0x32, 0x75, 0xE4, 0xFD,
+    0xE0, 0x02, 0x84, 0x00, 0x18, 0xF3, 0xDC, 0xA9, 0x24, 0x92, 0x55, 0x8B, 0x00, 0xF2, 0x36, 0x36,
+    0xC9, 0xB6, 0x4D, 0xBC, 0xF7, 0x41, 0x06, 0xDE, 0x7B, 0xA0, 0x01, 0x98, 0x0D, 0xEF, 0x97, 0xB9,
+    0x3C, 0x13, 0xC1, 0x3C, 0x1F, 0x2F, 0x71, 0xF9, 0x00, 0x14, 0x20, 0xDB, 0x20, 0xF2, 0x23, 0x24,
+    0x64, 0x8C, 0x9E, 0x40, 0x02, 0xF5, 0x3D, 0x46, 0x8B, 0xD4, 0xF5, 0x1A, 0x00, 0x14, 0x22, 0x5B,
+    0x7B, 0x0A, 0x1C, 0xE6, 0x6B, 0xE4, 0x9E, 0xC7, 0x67, 0x5A, 0x3D, 0xC7, 0xDE, 0x54, 0x14, 0x22,
+    0x5B, 0x7D, 0x44, 0x1A, 0x1B, 0x97, 0x38, 0xF0, 0x53, 0xFC, 0x11, 0xFA, 0x4F, 0xD2, 0x7F, 0x68,
+    0xF9, 0x11, 0x92, 0x35, 0x75, 0xFB, 0x1F, 0xBF, 0xA4, 0xD0, 0xDC, 0xB9, 0x3D, 0x8E, 0xCE, 0xB4,
+    0x7B, 0x8F, 0xBC, 0xA8, 0x00, 0x31, 0x93, 0x8E, 0xE7, 0xD7, 0x9B, 0xEB, 0xCC, 0xDC, 0xBE, 0x40,
+    0x0E, 0x27, 0x52, 0xFC, 0xCF, 0x0D, 0x11, 0xA3, 0xC3, 0x45, 0xF9, 0x8E, 0xA3, 0x88, 0x1B, 0x59,
+    0x1D, 0xC8, 0xEE, 0x47, 0x72, 0x3B, 0x91, 0xDC, 0x8F, 0xF2, 0x47, 0xD8, 0x1B, 0x59, 0x1A, 0xA3,
+    0x54, 0x6A, 0x8D, 0x51, 0xAA, 0x35, 0x7C, 0xBD, 0xAE, 0x3D, 0x40, 0x1B, 0x59, 0x04, 0x10, 0x41,
+    0x04, 0x1D, 0x20, 0x63, 0x27, 0x17, 0x97, 0xDA, 0xE9, 0x94, 0x4A, 0x25, 0x12, 0x89, 0x6D, 0x63,
+    0x19, 0x00, 0x1B, 0x59, 0x1A, 0xA3, 0x54, 0x6A, 0x8D, 0x51, 0xAA, 0x35, 0x46, 0xA8, 0x90, 0x89,
+    0x47, 0x17, 0x6F, 0x6B, 0x97, 0x3A, 0xFC, 0xC6, 0xE3, 0x36, 0xD6, 0x33, 0x37, 0x2F, 0xCC, 0xE5,
+    0xCE, 0xED, 0xED, 0x47, 0x14, 0x48, 0x15, 0xA2, 0x95, 0x44, 0xA3, 0xB9, 0x1D, 0xC8, 0xEE, 0x53,
+    0xDA, 0xE5, 0xFC, 0xE0, 0x1B, 0x58, 0xA9, 0x42, 0x0D, 0x0C, 0xCC, 0x97, 0x24, 0xDA, 0xC0, 0x1B,
+    0x58, 0xAB, 0x2A, 0x33, 0x86, 0x7A, 0x33, 0xCD, 0x96, 0x4B, 0x92, 0x6D, 0x60, 0x1B, 0x58, 0xC9,
+    0x7C, 0xD3, 0xA2, 0xB0, 0xA5, 0x11, 0x54, 0x48, 0x49, 0xC5, 0xE5, 0xEF, 0x41, 0x04, 0x10, 0x41,
+    0xB5, 0x80, 0x1B, 0x59, 0xD8, 0x60, 0x6E, 0x39, 0xCA, 0x1C, 0xE6, 0xE6, 0x0E, 0xC3, 0x6B, 0x00,
+    0x1B, 0x58, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC9, 0xB5, 0x80, 0x18, 0xE8, 0x56, 0x8A, 0x55,
+    0x12, 0x89, 0x44, 0xA2, 0x54, 0xAA, 0xB4, 0x63, 0xA0, 0x1B, 0x59, 0x04, 0x10, 0x41, 0x04, 0x10,
+    0x6D, 0x60, 0x1B, 0x59, 0x19, 0xA3, 0x34, 0x66, 0x8C, 0xD1, 0x9A, 0x33, 0x53, 0x27, 0x20, 0x18,
+    0xE8, 0x56, 0x8A, 0x55, 0x12, 0x89, 0x44, 0xA2, 0x51, 0x2A, 0x55, 0x5A, 0x00, 0x82, 0x08, 0x20,
+    0xDA, 0xC8, 0x20, 0x82, 0x00, 0x1D, 0xA7, 0x2B, 0xAF, 0xFE, 0xE7, 0xFE, 0x1F, 0x61, 0xCC, 0xC6,
+    0x4E, 0x27, 0x48, 0x18, 0xE8, 0x71, 0xE9, 0x56, 0x8A, 0xD1, 0x5A, 0x36, 0xB2, 0xB4, 0x56, 0x8A,
+    0xD1, 0xC7, 0xA5, 0x8E, 0x80, 0x89, 0x45, 0x54, 0xA3, 0x8F, 0x3A, 0xF9, 0x99, 0x2F, 0x9B, 0x8F,
+    0x3A, 0x94, 0x45, 0x51, 0x20, 0x1B, 0x58, 0x92, 0x49, 0x24, 0x92, 0x49, 0x6D, 0x63, 0x19, 0x00,
+    0x1B, 0x6E, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x6D, 0x60, 0x03, 0x6B, 0x12, 0x49, 0x24, 0xB6,
+    0xB1, 0x24, 0x92, 0x4B, 0x6B, 0x00, 0x03, 0x6B, 0x12, 0x49, 0x24, 0xB6, 0xB1, 0x24, 0x92, 0x4B,
+    0x6B, 0x18, 0xC8, 0x10, 0x41, 0x06, 0xD6, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3F, 0x59, 0xF9, 0x80,
+    0x1B, 0x58, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xFD, 0x67, 0xE6, 0x01, 0xB5, 0x80, 0x1B, 0x58, 0xD4,
+    0xD4, 0xD4, 0xD4, 0xD4, 0xFD, 0x67, 0xE6, 0x1D, 0x9D, 0x8A, 0x55, 0x12, 0x8D, 0x51, 0xAA, 0x35,
+    0x53, 0xEE, 0x53, 0xEA, 0x72, 0xDE, 0x1B, 0x58, 0xCC, 0xCC, 0xCD, 0x7E, 0x87, 0x2E, 0x97, 0x67,
+    0x63, 0xA7, 0x8A, 0x25, 0x12, 0xE9, 0xE2, 0xEC, 0xEC, 0x72, 0xE9, 0x5F, 0xA0, 0x03, 0xCB, 0xEE,
+    0x74, 0xFF, 0x22, 0x3D, 0x28, 0xF4, 0x23, 0x34, 0x66, 0x8C, 0xD1, 0x9B, 0x6B, 0x00, 0x0F, 0xCA,
+    0xBF, 0x04, 0xF0, 0x4F, 0x04, 0xF7, 0x27, 0xDA, 0xBD, 0x80, 0x1C, 0xB7, 0xBB, 0x3F, 0xD1, 0xF2,
+    0x97, 0xCA, 0x5F, 0x29, 0x7F, 0xD7, 0xDC, 0xE9, 0xF7, 0x9C, 0xE0, 0x18, 0xB2, 0x78, 0x27, 0x82,
+    0x78, 0x31, 0xFE, 0x6B, 0xFD, 0x60, 0x18, 0xB2, 0x49, 0x24, 0x90, 0x63, 0x27, 0x82, 0xFF, 0x6B,
+    0x12, 0x99, 0x4C, 0xA6, 0x58, 0xB1, 0x8C, 0x80, 0x0D, 0xEB, 0xFB, 0x93, 0xC1, 0x3C, 0x13, 0xC1,
+    0x7F, 0x71, 0xF9, 0x00, 0x99, 0x63, 0xC0, 0xF5, 0x1C, 0xE6, 0x8C, 0x58, 0xD0, 0xFE, 0x23, 0xEB,
+    0x63, 0x8A, 0x64, 0x17, 0xAA, 0x65, 0x3C, 0x13, 0xC1, 0x7F, 0xAC, 0x18, 0xB1, 0x52, 0x84, 0x1A,
+    0x19, 0xB1, 0x60, 0x18, 0xB2, 0x95, 0x56, 0x8A, 0xC2, 0xBA, 0x29, 0x9B, 0x16, 0x18, 0xB1, 0xA1,
+    0xCE, 0x7A, 0x98, 0xF0, 0x4C, 0x80, 0x09, 0x5E, 0xCC, 0x12, 0x49, 0x26, 0x2C, 0x18, 0xB2, 0x4C,
+    0x73, 0x1F, 0x61, 0xC4, 0xED, 0x63, 0x99, 0x26, 0x2C, 0x18, 0xB1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA3,
+    0x16, 0x0D, 0xEB, 0xD5, 0x32, 0x99, 0x4C, 0xAF, 0x53, 0x78, 0x18, 0xB2, 0x49, 0x24, 0x92, 0x4C,
+    0x58, 0x18, 0xF3, 0xDD, 0x7E, 0x29, 0x94, 0xCA, 0x65, 0x7A, 0x9B, 0xC0, 0x0D, 0xEB, 0xD5, 0x32,
+    0x99, 0x4C, 0xAF, 0x50, 0x92, 0x49, 0x31, 0x64, 0x92, 0x48, 0xC6, 0x47, 0xA3, 0x37, 0x6E, 0x6C,
+    0x64, 0xF8, 0x9C, 0xCC, 0x00, 0x17, 0xF7, 0xB1, 0xC5, 0x32, 0x99, 0x63, 0x8B, 0x97, 0x9E, 0xEC,
+    0x71, 0x4C, 0xA6, 0x58, 0xE2, 0xBF, 0xBC, 0x13, 0x2B, 0xD4, 0xF5, 0x1A, 0x1E, 0xA5, 0xEA, 0x99,
+    0x18, 0xB1, 0x24, 0x92, 0x49, 0x2C, 0x58, 0xC0, 0x18, 0xE6, 0x39, 0xC8, 0x20, 0x86, 0x2C, 0x18,
+    0xB1, 0x24, 0x92, 0x4B, 0x16, 0x24, 0x92, 0x49, 0x62, 0xC0, 0x18, 0xB1, 0x24, 0x92, 0x4B, 0x16,
+    0x24, 0x92, 0x58, 0xB1, 0x80, 0x12, 0x49, 0x8B, 0x1C, 0x0E, 0x07, 0x03, 0xFC, 0x4E, 0xD0, 0x18,
+    0xB1, 0xC0, 0xE0, 0x70, 0x38, 0x1F, 0xB4, 0xED, 0x0C, 0x58, 0x18, 0xB1, 0xC0, 0xE0, 0x70, 0x38,
+    0x1F, 0xB4, 0xED, 0x0F, 0xA5, 0x7A, 0xA7, 0x82, 0x78, 0x31, 0xEE, 0x5F, 0x78, 0x18, 0xB1, 0xA1,
+    0xA1, 0xEB, 0x5F, 0xFA, 0x98, 0xE2, 0x99, 0x63, 0x8A, 0xFF, 0x51, 0xBC, 0x17, 0xF8, 0x31, 0xFE,
+    0xA9, 0xE7, 0x4E, 0x89, 0xD1, 0x8F, 0x43, 0x16,
+};
+const uint8_t ArialMT_Plain_16_RU_huffman[] PROGMEM = {
+    0x01, 0x00, 0x00, 0x02, 0x05, 0x05, 0x05, 0x0E, 0x0B, 0x0C, 0x0D, 0x1E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x40, 0x10, 0x20, 0x7F, 0x80, 0xC0, 0x01, 0x02, 0x04, 0x41, 0xF8, 0x03, 0x1F, 0x44,
+    0x60, 0xE0, 0x07, 0x0C, 0x0F, 0x18, 0x1C, 0x28, 0x30, 0x38, 0x42, 0x48, 0x70, 0x88, 0xF0, 0xFF,
+    0x06, 0x0A, 0x1B, 0x1E, 0x21, 0x22, 0x24, 0x3F, 0x43, 0x78, 0x90, 0x05, 0x09, 0x0B, 0x11, 0x31,
+    0x3B, 0x3C, 0x5F, 0x61, 0x7E, 0xB8, 0xC8, 0x17, 0x39, 0x3E, 0x4F, 0x50, 0x52, 0x58, 0x63, 0x68,
+    0x6C, 0xD0, 0xD8, 0xFB, 0x0E, 0x12, 0x13, 0x19, 0x1A, 0x1D, 0x23, 0x2F, 0x33, 0x45, 0x47, 0x4C,
+    0x4E, 0x5C, 0x62, 0x64, 0x66, 0x6E, 0x73, 0x7A, 0x7C, 0x83, 0x86, 0x8F, 0x98, 0xD2, 0xE6, 0xE8,
+    0xF1, 0xFC,
+};
+const CompressedFont ArialMT_Plain_16_RU = {ArialMT_Plain_16_RU_header, ArialMT_Plain_16_RU_data, ArialMT_Plain_16_RU_huffman};
+
+const uint8_t ArialMT_Plain_24_RU_header[] PROGMEM = {
+    0x18, 0x1C, 0x20, 0xE0, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x13, 0x08, 0x00, 0x07, 0x1A, 0x09,
+    0x00, 0x0F, 0x33, 0x0D, 0x00, 0x2A, 0x2F, 0x0D, 0x00, 0x44, 0x4F, 0x15, 0x00, 0x6A, 0x3B, 0x10,
+    0x00, 0x8A, 0x0A, 0x05, 0x00, 0x8E, 0x1C, 0x08, 0x00, 0x9D, 0x1B, 0x08, 0x00, 0xAC, 0x21, 0x09,
+    0x00, 0xB9, 0x32, 0x0E, 0x00, 0xC6, 0x10, 0x07, 0x00, 0xCB, 0x1B, 0x08, 0x00, 0xD8, 0x0F, 0x07,
+    0x00, 0xDB, 0x19, 0x07, 0x00, 0xE5, 0x2F, 0x0D, 0x00, 0xFA, 0x23, 0x0D, 0x01, 0x05, 0x2F, 0x0D,
+    0x01, 0x1B, 0x2F, 0x0D, 0x01, 0x32, 0x2F, 0x0D, 0x01, 0x47, 0x2F, 0x0D, 0x01, 0x5F, 0x2F, 0x0D,
+    0x01, 0x79, 0x2D, 0x0D, 0x01, 0x8A, 0x2F, 0x0D, 0x01, 0xA4, 0x2F, 0x0D, 0x01, 0xBD, 0x0F, 0x07,
+    0x01, 0xC1, 0x10, 0x07, 0x01, 0xC7, 0x2F, 0x0E, 0x01, 0xDB, 0x2F, 0x0E, 0x01, 0xF3, 0x2E, 0x0E,
+    0x02, 0x07, 0x2E, 0x0D, 0x02, 0x19, 0x5B, 0x18, 0x02, 0x57, 0x3B, 0x0F, 0x02, 0x74, 0x3B, 0x10,
+    0x02, 0x8E, 0x3F, 0x11, 0x02, 0xA9, 0x3F, 0x11, 0x02, 0xC1, 0x3B, 0x10, 0x02, 0xD8, 0x35, 0x0F,
+    0x02, 0xE9, 0x43, 0x13, 0x03, 0x09, 0x3B, 0x11, 0x03, 0x1A, 0x0F, 0x06, 0x03, 0x1F, 0x27, 0x0C,
+    0x03, 0x2C, 0x3F, 0x10, 0x03, 0x46, 0x2F, 0x0D, 0x03, 0x52, 0x43, 0x13, 0x03, 0x6A, 0x3B, 0x11,
+    0x03, 0x80, 0x47, 0x13, 0x03, 0x9E, 0x3A, 0x10, 0x03, 0xB1, 0x47, 0x13, 0x03, 0xD2, 0x3F, 0x11,
+    0x03, 0xEE, 0x3B, 0x10, 0x04, 0x0D, 0x35, 0x0E, 0x04, 0x1C, 0x3B, 0x11, 0x04, 0x2F, 0x39, 0x0F,
+    0x04, 0x47, 0x59, 0x17, 0x04, 0x69, 0x3B, 0x0F, 0x04, 0x87, 0x3D, 0x10, 0x04, 0x9E, 0x37, 0x0F,
+    0x04, 0xB8, 0x14, 0x07, 0x04, 0xC1, 0x1B, 0x07, 0x04, 0xCB, 0x18, 0x07, 0x04, 0xD5, 0x2A, 0x0C,
+    0x04, 0xE2, 0x34, 0x0D, 0x04, 0xF1, 0x11, 0x08, 0x04, 0xF6, 0x2F, 0x0D, 0x05, 0x0E, 0x33, 0x0E,
+    0x05, 0x23, 0x2B, 0x0C, 0x05, 0x36, 0x2F, 0x0E, 0x05, 0x4B, 0x2F, 0x0D, 0x05, 0x63, 0x1A, 0x07,
+    0x05, 0x6E, 0x2F, 0x0E, 0x05, 0x8A, 0x2F, 0x0E, 0x05, 0x9A, 0x0F, 0x05, 0x05, 0xA0, 0x10, 0x06,
+    0x05, 0xA8, 0x2F, 0x0C, 0x05, 0xBB, 0x0F, 0x06, 0x05, 0xC0, 0x47, 0x14, 0x05, 0xD8, 0x2F, 0x0E,
+    0x05, 0xE7, 0x2F, 0x0D, 0x05, 0xFC, 0x33, 0x0E, 0x06, 0x12, 0x30, 0x0E, 0x06, 0x28, 0x1E, 0x08,
+    0x06, 0x31, 0x2B, 0x0C, 0x06, 0x49, 0x1B, 0x07, 0x06, 0x54, 0x2F, 0x0E, 0x06, 0x63, 0x2A, 0x0B,
+    0x06, 0x72, 0x42, 0x11, 0x06, 0x8D, 0x2B, 0x0B, 0x06, 0xA3, 0x2A, 0x0C, 0x06, 0xB6, 0x2B, 0x0C,
+    0x06, 0xCA, 0x1C, 0x08, 0x06, 0xD7, 0x10, 0x06, 0x06, 0xDE, 0x1B, 0x08, 0x06, 0xEB, 0x32, 0x0E,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x18,
+    0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x07, 0x06, 0xF7, 0x14, 0x08, 0x06, 0xFF, 0x2B, 0x0D,
+    0x07, 0x16, 0x2F, 0x0D, 0x07, 0x2F, 0x33, 0x0D, 0x07, 0x48, 0x31, 0x0D, 0x07, 0x66, 0x10, 0x06,
+    0x07, 0x6F, 0x2F, 0x0D, 0x07, 0x91, 0x3B, 0x10, 0x07, 0xAB, 0x46, 0x12, 0x07, 0xD6, 0x1A, 0x09,
+    0x07, 0xE2, 0x27, 0x0D, 0x07, 0xF4, 0x2F, 0x0E, 0x08, 0x04, 0x1B, 0x08, 0x08, 0x11, 0x46, 0x12,
+    0x08, 0x39, 0x31, 0x0D, 0x08, 0x49, 0x1E, 0x0A, 0x08, 0x59, 0x33, 0x0D, 0x08, 0x69, 0x1A, 0x08,
+    0x08, 0x79, 0x1A, 0x08, 0x08, 0x89, 0x19, 0x08, 0x08, 0x8F, 0x2F, 0x0E, 0x08, 0x9E, 0x31, 0x0D,
+    0x08, 0xB4, 0x12, 0x08, 0x08, 0xB7, 0x2F, 0x0D, 0x08, 0xD0, 0x16, 0x08, 0x08, 0xD7, 0x1E, 0x09,
+    0x08, 0xE3, 0x2E, 0x0D, 0x08, 0xF6, 0x4F, 0x14, 0x09, 0x18, 0x4B, 0x14, 0x09, 0x3C, 0x4B, 0x14,
+    0x09, 0x65, 0x3B, 0x12, 0x09, 0x7C, 0x3B, 0x0F, 0x09, 0x99, 0x3B, 0x10, 0x09, 0xB1, 0x3B, 0x10,
+    0x09, 0xCB, 0x31, 0x0D, 0x09, 0xD8, 0x3C, 0x10, 0x09, 0xF2, 0x3B, 0x10, 0x0A, 0x09, 0x57, 0x16,
+    0x0A, 0x2E, 0x33, 0x0F, 0x0A, 0x48, 0x3B, 0x11, 0x0A, 0x5F, 0x3B, 0x11, 0x0A, 0x7B, 0x37, 0x0E,
+    0x0A, 0x90, 0x37, 0x10, 0x0A, 0xA1, 0x43, 0x13, 0x0A, 0xB9, 0x3B, 0x11, 0x0A, 0xCA, 0x47, 0x13,
+    0x0A, 0xE8, 0x3B, 0x11, 0x0A, 0xF9, 0x3A, 0x10, 0x0B, 0x0C, 0x3F, 0x11, 0x0B, 0x27, 0x35, 0x0E,
+    0x0B, 0x36, 0x39, 0x0F, 0x0B, 0x4D, 0x42, 0x12, 0x0B, 0x6F, 0x3B, 0x0F, 0x0B, 0x8D, 0x43, 0x12,
+    0x0B, 0xA1, 0x37, 0x10, 0x0B, 0xB2, 0x4F, 0x16, 0x0B, 0xCA, 0x58, 0x17, 0x0B, 0xE6, 0x47, 0x13,
+    0x0B, 0xFE, 0x4B, 0x15, 0x0C, 0x18, 0x3B, 0x10, 0x0C, 0x2D, 0x3F, 0x11, 0x0C, 0x4A, 0x5B, 0x18,
+    0x0C, 0x6C, 0x3B, 0x11, 0x0C, 0x87, 0x2F, 0x0D, 0x0C, 0x9F, 0x33, 0x0E, 0x0C, 0xBC, 0x2F, 0x0D,
+    0x0C, 0xD4, 0x22, 0x09, 0x0C, 0xDF, 0x33, 0x0E, 0x0C, 0xF3, 0x2F, 0x0D, 0x0D, 0x0B, 0x3F, 0x10,
+    0x0D, 0x27, 0x27, 0x0B, 0x0D, 0x3A, 0x2F, 0x0D, 0x0D, 0x4A, 0x2F, 0x0D, 0x0D, 0x5E, 0x27, 0x0B,
+    0x0D, 0x6E, 0x2F, 0x0E, 0x0D, 0x7E, 0x3B, 0x11, 0x0D, 0x92, 0x2F, 0x0D, 0x0D, 0xA1, 0x2F, 0x0D,
+    0x0D, 0xB6, 0x2B, 0x0D, 0x0D, 0xC4, 0x33, 0x0E, 0x0D, 0xDA, 0x2B, 0x0C, 0x0D, 0xED, 0x2A, 0x0B,
+    0x0D, 0xFC, 0x2A, 0x0C, 0x0E, 0x0F, 0x4B, 0x14, 0x0E, 0x32, 0x2B, 0x0B, 0x0E, 0x48, 0x33, 0x0E,
+    0x0E, 0x56, 0x2B, 0x0D, 0x0E, 0x65, 0x47, 0x13, 0x0E, 0x79, 0x4B, 0x14, 0x0E, 0x8E, 0x37, 0x0F,
+    0x0E, 0xA1, 0x3B, 0x11, 0x0E, 0xB6, 0x2F, 0x0D, 0x0E, 0xC7, 0x2B, 0x0C, 0x0E, 0xDC, 0x43, 0x12,
+    0x0E, 0xF7, 0x2B, 0x0D,
+};
+const uint8_t ArialMT_Plain_24_RU_data[] PROGMEM = {
+    0x00, 0x0B, 0x5F, 0xD8, 0xB5, 0xFD, 0x80, 0x0B, 0x66, 0x5B, 0x30, 0x02, 0xD9, 0x96, 0xCC, 0x71,
+    0xC4, 0xE3, 0xEC, 0x38, 0xD0, 0xDF, 0x46, 0xD7, 0xC5, 0x6D, 0x31, 0x4F, 0x1F, 0x61, 0xC6, 0x86,
+    0xFA, 0x36, 0xBE, 0x2B, 0x69, 0x8A, 0x78, 0xE2, 0x71, 0xC4, 0x0D, 0xB3, 0xC9, 0x5D, 0x3C, 0x95,
+    0xE7, 0xAA, 0x79, 0xF6, 0x4C, 0x43, 0xBD, 0xEE, 0x98, 0x84, 0xCC, 0x2B, 0x3C, 0xD5, 0xFD, 0x7D,
+    0x1B, 0x7F, 0xCF, 0x30, 0x0D, 0xB4, 0x2B, 0xD0, 0x98, 0x3A, 0xF5, 0x3A, 0xF5, 0xEA, 0x98, 0xEC,
+    0xAF, 0x4F, 0x26, 0xDF, 0x6E, 0x85, 0x71, 0x3B, 0x8F, 0x31, 0xF6, 0xE8, 0xAF, 0xEC, 0xE8, 0xB4,
+    0xC2, 0x7A, 0xF5, 0x3A, 0xF5, 0x26, 0x0A, 0xF4, 0x36, 0xD0, 0x06, 0xD9, 0x95, 0xE8, 0xDB, 0xFB,
+    0xB5, 0x57, 0xE8, 0x85, 0xBC, 0xE1, 0x3D, 0xA1, 0x3E, 0xF8, 0x5B, 0xFF, 0x9D, 0x95, 0xFB, 0x7F,
+    0x8D, 0xB6, 0x3D, 0x06, 0x85, 0x68, 0x6D, 0xD8, 0x7A, 0x80, 0x0B, 0x66, 0x5B, 0x30, 0x07, 0x7D,
+    0x0F, 0x1F, 0x43, 0x6D, 0x3B, 0xE1, 0x5C, 0x36, 0xC6, 0x4C, 0xBA, 0x9C, 0x00, 0x0E, 0xA7, 0x09,
+    0x32, 0xAE, 0x1B, 0x63, 0xB6, 0x9D, 0xF0, 0x78, 0xFA, 0x0E, 0xFA, 0x00, 0x0D, 0x86, 0xDC, 0x0D,
+    0xB4, 0x2D, 0x89, 0x6C, 0x4D, 0xB4, 0x36, 0xE0, 0x6C, 0x04, 0x89, 0x12, 0x24, 0x48, 0xBE, 0x85,
+    0xF4, 0x24, 0x48, 0x91, 0x22, 0x40, 0x00, 0x23, 0x13, 0xBE, 0x00, 0x6D, 0x81, 0xB6, 0x06, 0xD8,
+    0x1B, 0x60, 0x6D, 0x81, 0xB6, 0x06, 0xD8, 0x00, 0x00, 0x20, 0x40, 0x20, 0x7B, 0x4B, 0x68, 0x6F,
+    0x83, 0x6A, 0x16, 0xC4, 0x90, 0x07, 0x8C, 0x5B, 0x5F, 0xA2, 0xB8, 0x6A, 0xB3, 0xB2, 0x50, 0x94,
+    0x25, 0x0B, 0x3B, 0x2B, 0x86, 0xAD, 0xAF, 0xA1, 0xE3, 0x10, 0x00, 0x06, 0x43, 0x31, 0x89, 0xB6,
+    0x05, 0xAF, 0x45, 0xAF, 0x40, 0x06, 0x30, 0xAE, 0x3D, 0x95, 0x79, 0xA5, 0xF9, 0x12, 0xF6, 0x27,
+    0x6F, 0x62, 0x6B, 0xEB, 0x4C, 0xC2, 0xB1, 0x0A, 0xF4, 0x83, 0x48, 0x0D, 0xB0, 0xC9, 0x5C, 0x39,
+    0x2A, 0xD5, 0x28, 0x4C, 0x42, 0x62, 0x13, 0x10, 0xAF, 0x68, 0x57, 0xFA, 0xF9, 0xB6, 0xFD, 0xBA,
+    0x1B, 0x66, 0x06, 0xD8, 0x95, 0xC4, 0xEF, 0x89, 0xE7, 0x89, 0xCB, 0x16, 0xD9, 0xE2, 0xAE, 0x18,
+    0xAD, 0x7A, 0x2D, 0x7A, 0x0C, 0x46, 0x20, 0x04, 0x64, 0xDA, 0x9E, 0x4B, 0x74, 0xE6, 0x9F, 0x96,
+    0x13, 0xC6, 0x13, 0xC6, 0x13, 0xC6, 0x13, 0xC6, 0x13, 0xCF, 0x54, 0xF7, 0xD0, 0xB6, 0x20, 0x06,
+    0xF8, 0xB6, 0xBE, 0x8A, 0xFF, 0xBF, 0x55, 0x63, 0xB2, 0x79, 0xC2, 0x79, 0xC2, 0x79, 0xC2, 0x79,
+    0xC2, 0xD1, 0xCD, 0x5F, 0xF0, 0xD1, 0xB7, 0xEB, 0xCC, 0x09, 0x12, 0x24, 0x4B, 0xCD, 0x3B, 0x51,
+    0x3D, 0xF1, 0x4F, 0xBC, 0x9E, 0x44, 0xE2, 0x5B, 0x02, 0x40, 0x06, 0xD9, 0xB6, 0xFD, 0xBD, 0x15,
+    0xFE, 0xBE, 0x6B, 0x76, 0x84, 0xC4, 0x26, 0x21, 0x31, 0x0B, 0x76, 0x85, 0x7E, 0x8E, 0x6D, 0xBF,
+    0x6F, 0x43, 0x6C, 0xC0, 0x07, 0x4E, 0x2D, 0xBE, 0x8D, 0x55, 0xFC, 0xFD, 0x93, 0x58, 0x4D, 0x61,
+    0x35, 0x84, 0xD6, 0x13, 0x3C, 0xD5, 0xF5, 0xF9, 0x36, 0xBE, 0x87, 0x8C, 0x00, 0x00, 0x65, 0x06,
+    0x50, 0x00, 0x65, 0x18, 0xB2, 0xEF, 0x80, 0x07, 0x51, 0xEE, 0x1F, 0xD2, 0x3F, 0x78, 0xFD, 0xE3,
+    0xE1, 0x81, 0xF0, 0xC0, 0xE1, 0x81, 0x96, 0x26, 0x58, 0x98, 0xE4, 0x07, 0xC3, 0x03, 0xE1, 0x81,
+    0xF0, 0xC0, 0xF8, 0x60, 0x7C, 0x30, 0x3E, 0x18, 0x1F, 0x0C, 0x0F, 0x86, 0x07, 0xC3, 0x03, 0xE1,
+    0x81, 0xF0, 0xC0, 0x06, 0x39, 0x19, 0x62, 0x65, 0x89, 0xC3, 0x03, 0xE1, 0x81, 0xF0, 0xC0, 0xFD,
+    0xE3, 0xF7, 0x8F, 0xE9, 0x1E, 0xE1, 0xD4, 0x06, 0x26, 0xD8, 0x95, 0xC0, 0xB0, 0x9D, 0xBD, 0x89,
+    0xAF, 0xB1, 0x36, 0x2D, 0x05, 0x7B, 0x15, 0xE8, 0x33, 0x05, 0xB4, 0x3D, 0x28, 0x79, 0x77, 0x33,
+    0xAE, 0x1B, 0x7E, 0xCF, 0xB3, 0x0A, 0xFF, 0x87, 0xFE, 0x31, 0xAF, 0x6E, 0x78, 0xD7, 0x8C, 0x63,
+    0x3C, 0xA3, 0x29, 0xCA, 0x32, 0x9C, 0xB9, 0xE5, 0x39, 0x6B, 0x94, 0xF1, 0xF2, 0xCA, 0x7D, 0x29,
+    0x95, 0xBC, 0x7A, 0xF2, 0xAF, 0x28, 0xCA, 0xB8, 0x73, 0xC7, 0x6C, 0x75, 0xC5, 0x9F, 0xDB, 0x83,
+    0xC7, 0xD9, 0x83, 0xD3, 0xF5, 0x8F, 0xCC, 0x20, 0x7B, 0x4D, 0xB4, 0x3B, 0xE2, 0x78, 0xC1, 0xB7,
+    0xDB, 0x82, 0xDF, 0x4E, 0x09, 0xDB, 0x05, 0xBE, 0x9C, 0x1B, 0x7D, 0xB8, 0x1E, 0x30, 0x3B, 0xE2,
+    0x6D, 0xA0, 0xF6, 0x88, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x98, 0x84, 0xC4, 0x26, 0x21, 0x31, 0x09,
+    0x88, 0x4C, 0x42, 0x62, 0x15, 0xF7, 0xC2, 0xB7, 0xE6, 0xDB, 0xF6, 0xF4, 0x36, 0xCC, 0x06, 0xF8,
+    0x17, 0xCD, 0xB6, 0x7C, 0x95, 0xC3, 0x55, 0x5C, 0xD2, 0x84, 0xA1, 0x28, 0x4A, 0x12, 0x84, 0xA1,
+    0x57, 0x35, 0x70, 0xD5, 0xB6, 0x3A, 0x1F, 0x26, 0x20, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x94, 0x25,
+    0x09, 0x42, 0x50, 0x94, 0x25, 0x09, 0x42, 0xCE, 0x6A, 0xE1, 0xAB, 0x6C, 0x79, 0x17, 0xCC, 0xDF,
+    0x00, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x98, 0x84, 0xC4, 0x26, 0x21, 0x31, 0x09, 0x88, 0x4C, 0x42,
+    0x62, 0x13, 0x10, 0x98, 0x84, 0xC4, 0x25, 0x00, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x98, 0x26, 0x09,
+    0x82, 0x60, 0x98, 0x26, 0x09, 0x82, 0x60, 0x98, 0x24, 0x06, 0xF8, 0x17, 0xCD, 0xB6, 0x7A, 0x2B,
+    0x86, 0xAA, 0xB9, 0xAC, 0xE6, 0x94, 0x25, 0x09, 0x42, 0x66, 0x13, 0x30, 0xB4, 0xF6, 0x56, 0x79,
+    0xAB, 0xF9, 0xF9, 0xB6, 0xFE, 0xED, 0x0F, 0xFD, 0xE8, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x40, 0x81,
+    0x02, 0x04, 0x08, 0x10, 0x20, 0x41, 0x6B, 0xD1, 0x6B, 0xD0, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x03,
+    0x90, 0xF2, 0x1D, 0x84, 0x08, 0x10, 0x3B, 0x2D, 0x7E, 0x8B, 0x5F, 0x40, 0x00, 0xB5, 0xE8, 0xB5,
+    0xE8, 0x58, 0x7B, 0x87, 0x61, 0xF3, 0x0F, 0x03, 0xFB, 0xF0, 0x6D, 0xF4, 0xE6, 0xAE, 0x1A, 0x2C,
+    0xF2, 0x4B, 0xB3, 0xAA, 0x07, 0x50, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x20, 0x40, 0x81, 0x02, 0x04,
+    0x08, 0x10, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0xB6, 0x05, 0x74, 0x1E, 0x05, 0xB3, 0x14, 0x10, 0x28,
+    0x5B, 0x33, 0xC1, 0x5D, 0x0B, 0x60, 0x5A, 0xF4, 0x5A, 0xF4, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0xAE,
+    0x06, 0xD9, 0x8E, 0x43, 0xCC, 0x7B, 0x85, 0xB0, 0x36, 0xC4, 0x68, 0x35, 0x5A, 0xF4, 0x5A, 0xF4,
+    0x06, 0xF8, 0x17, 0xCD, 0xB6, 0x7A, 0x2B, 0x86, 0xAA, 0xB9, 0xAC, 0xEC, 0x94, 0x25, 0x09, 0x42,
+    0x50, 0x94, 0x2C, 0xEC, 0xAB, 0x9A, 0xB8, 0x6A, 0xDB, 0x3D, 0x0B, 0xE6, 0x6F, 0x80, 0x00, 0xB5,
+    0xE8, 0xB5, 0xE8, 0x99, 0x26, 0x49, 0x92, 0x64, 0x99, 0x26, 0x49, 0x92, 0x64, 0xAC, 0x15, 0xA0,
+    0xD0, 0x06, 0xF8, 0x17, 0xCD, 0xB6, 0x7A, 0x2B, 0x86, 0xAA, 0xB9, 0xAC, 0xE6, 0x94, 0x25, 0x09,
+    0x42, 0x5F, 0x91, 0x2F, 0xC8, 0xB3, 0xCD, 0x56, 0xAA, 0xE1, 0xE6, 0xDB, 0x3A, 0x17, 0xFF, 0x91,
+    0xBF, 0xE7, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x98, 0x26, 0x09, 0x82, 0x60, 0x9F, 0x71, 0x3D, 0xC9,
+    0xEF, 0x8A, 0x7F, 0xF3, 0x9A, 0xDC, 0xFA, 0x2B, 0xD3, 0xCD, 0xB6, 0x90, 0x3A, 0x80, 0x03, 0x13,
+    0x3D, 0x15, 0xE9, 0xAA, 0xBC, 0xF9, 0xA7, 0xB7, 0x64, 0xC4, 0x26, 0x21, 0x31, 0x09, 0xF7, 0x42,
+    0x7D, 0xD0, 0xAC, 0xF3, 0x57, 0xFB, 0x75, 0x6D, 0xFB, 0x34, 0x3E, 0x9C, 0xC0, 0x91, 0x22, 0x44,
+    0x89, 0x12, 0x2D, 0x7A, 0x2D, 0x7A, 0x24, 0x48, 0x91, 0x22, 0x44, 0x80, 0x00, 0xB5, 0xF3, 0x5A,
+    0xFA, 0x0D, 0x47, 0x61, 0x02, 0x04, 0x08, 0x10, 0x3B, 0x0D, 0x56, 0xBE, 0x8B, 0x5F, 0x30, 0xEA,
+    0x2D, 0x81, 0x5D, 0x07, 0xB4, 0x7A, 0x60, 0x57, 0x41, 0xED, 0x1D, 0x87, 0xB4, 0xAE, 0x87, 0xA6,
+    0x07, 0xB4, 0xAE, 0x85, 0xB0, 0x3A, 0x80, 0x91, 0x6C, 0xCD, 0xAE, 0x3D, 0x34, 0x36, 0xA0, 0x81,
+    0x42, 0xDA, 0x1B, 0xE0, 0xDA, 0x85, 0xB1, 0x24, 0x5B, 0x13, 0x6E, 0x83, 0x7C, 0x0B, 0x68, 0x28,
+    0x20, 0xDA, 0x87, 0xA6, 0x8D, 0xAE, 0x5B, 0x32, 0x40, 0x3A, 0xBA, 0xA1, 0x2F, 0x35, 0xB0, 0xF2,
+    0x57, 0xE9, 0xD0, 0xFB, 0xF1, 0x3C, 0x60, 0x76, 0x1E, 0x30, 0x6D, 0xF7, 0xE2, 0xAF, 0xD3, 0x9A,
+    0xD8, 0x79, 0x25, 0xE6, 0xEA, 0x81, 0xD4, 0xEA, 0x24, 0x5B, 0x03, 0x6C, 0x46, 0x63, 0xC8, 0x79,
+    0x8E, 0xF4, 0x3B, 0xD0, 0xF3, 0x1E, 0x46, 0xD9, 0x95, 0xC4, 0xB6, 0x04, 0x8E, 0xA0, 0x21, 0x2E,
+    0xC9, 0x79, 0xA5, 0xFC, 0xE9, 0xDB, 0xD8, 0x9A, 0xFA, 0xD3, 0x68, 0x4F, 0x68, 0x4E, 0xB0, 0x9E,
+    0x50, 0x9C, 0xE1, 0x6C, 0x21, 0x64, 0x25, 0x00, 0x0B, 0x5E, 0xF9, 0xDA, 0xF7, 0xCE, 0x4C, 0xA4,
+    0xC8, 0x91, 0x6C, 0x4D, 0xA8, 0x37, 0xC0, 0xB6, 0x83, 0xDA, 0x20, 0x00, 0x93, 0x29, 0x32, 0xB5,
+    0xEF, 0x9D, 0xAF, 0x7C, 0xC0, 0x07, 0x51, 0xD8, 0x74, 0x2B, 0x99, 0x61, 0x61, 0x5C, 0xC7, 0x41,
+    0xD8, 0x75, 0x19, 0x0C, 0x86, 0x43, 0x21, 0x90, 0xC8, 0x64, 0x32, 0x19, 0x0C, 0x86, 0x43, 0x21,
+    0x90, 0x0E, 0xA2, 0x45, 0x86, 0xC0, 0x07, 0x3E, 0x46, 0xBD, 0x0F, 0x87, 0xE5, 0x3E, 0xBF, 0x59,
+    0xF5, 0xFA, 0xCF, 0x8C, 0x1F, 0x1E, 0x67, 0xDD, 0xA9, 0xBF, 0x43, 0xD2, 0x83, 0xA8, 0x00, 0xB5,
+    0xE8, 0xB5, 0xE8, 0x73, 0xE2, 0x71, 0xE6, 0x65, 0x06, 0x50, 0x65, 0x07, 0x2E, 0xC6, 0xBA, 0x9E,
+    0x9A, 0x1D, 0xF1, 0x07, 0x7C, 0xCF, 0x4D, 0x0D, 0x75, 0x39, 0x76, 0x32, 0x83, 0x28, 0x32, 0x83,
+    0x97, 0x33, 0x5D, 0x4E, 0x7C, 0x40, 0x07, 0x7C, 0x4F, 0x4D, 0x0D, 0x75, 0x39, 0x76, 0x32, 0x83,
+    0x28, 0x32, 0x83, 0x8F, 0x33, 0x9F, 0x15, 0xAF, 0x45, 0xAF, 0x40, 0x07, 0x7C, 0xCF, 0x4D, 0x0F,
+    0xDD, 0xA9, 0xF7, 0x76, 0x3E, 0x30, 0x7C, 0x60, 0xF8, 0xC1, 0xF7, 0x76, 0x3F, 0xB3, 0x99, 0xE9,
+    0xC4, 0xEF, 0xC0, 0x64, 0x32, 0x2B, 0x7A, 0x2D, 0x7A, 0x27, 0x22, 0x72, 0x27, 0x20, 0x05, 0xBE,
+    0x9C, 0x1E, 0x9F, 0x6E, 0x2D, 0x75, 0xCD, 0xCB, 0xB6, 0x4C, 0xA3, 0x26, 0x51, 0x93, 0x28, 0xC9,
+    0xC7, 0x9E, 0x6E, 0x7F, 0x0C, 0x5E, 0x2F, 0x8B, 0xC5, 0xC0, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x73,
+    0x1C, 0x46, 0x43, 0x21, 0x90, 0xE4, 0x37, 0xA1, 0xE9, 0x40, 0x00, 0x9F, 0x14, 0x4F, 0x8A, 0x00,
+    0x19, 0x0C, 0xA7, 0xC5, 0xF3, 0x9F, 0x17, 0xC4, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x54, 0x58, 0x77,
+    0xC0, 0xFF, 0xBE, 0x67, 0x1D, 0x0C, 0xBC, 0xCF, 0x92, 0x07, 0x50, 0x00, 0xB5, 0xE8, 0xB5, 0xE8,
+    0x00, 0x78, 0xA1, 0xE2, 0x87, 0x11, 0xC0, 0x64, 0x32, 0x1C, 0x86, 0xF4, 0x3D, 0x28, 0x71, 0x19,
+    0x0C, 0x86, 0x43, 0x90, 0xDE, 0x87, 0xA5, 0x00, 0x00, 0x78, 0xA1, 0xE2, 0x87, 0x31, 0xC4, 0x64,
+    0x32, 0x19, 0x0E, 0x43, 0x7A, 0x1E, 0x94, 0x07, 0x7C, 0xCF, 0x4D, 0x0D, 0x75, 0x39, 0x76, 0x32,
+    0x83, 0x28, 0x32, 0x83, 0x97, 0x63, 0x5D, 0x4F, 0x4D, 0x0E, 0xF9, 0x80, 0x00, 0x78, 0xBE, 0x6F,
+    0x17, 0xCD, 0xCF, 0x89, 0xC7, 0x99, 0x94, 0x19, 0x41, 0x94, 0x1C, 0xBB, 0x1A, 0xEA, 0x7A, 0x68,
+    0x77, 0xC4, 0x07, 0x7C, 0x4F, 0x4D, 0x0D, 0x75, 0x39, 0x76, 0x32, 0x83, 0x28, 0x32, 0x83, 0x8F,
+    0x33, 0x9F, 0x13, 0xC5, 0xF3, 0x78, 0xBE, 0x60, 0x00, 0x78, 0xA1, 0xE2, 0x87, 0x11, 0x90, 0xC8,
+    0x64, 0x07, 0x6E, 0x27, 0xCD, 0xA9, 0xFF, 0xDE, 0xC7, 0xC6, 0x0F, 0x8C, 0x1F, 0x1F, 0x59, 0xF1,
+    0xF5, 0x9F, 0xF5, 0xFC, 0xA7, 0xEA, 0xE8, 0x73, 0xD0, 0x64, 0x32, 0x2B, 0x7E, 0x8B, 0x5E, 0x86,
+    0x50, 0x65, 0x06, 0x50, 0x00, 0x78, 0xD0, 0xF1, 0xD0, 0x76, 0x10, 0x20, 0x40, 0xE6, 0x38, 0x9E,
+    0x28, 0x78, 0xA0, 0x64, 0x3D, 0xA3, 0xD0, 0x57, 0x31, 0xD0, 0x76, 0x1D, 0x0A, 0xE6, 0x7A, 0x0F,
+    0x68, 0xC8, 0x72, 0x1F, 0x38, 0xEF, 0x89, 0xB7, 0x41, 0xD8, 0xDB, 0xA1, 0x6C, 0x4F, 0x98, 0x72,
+    0x1F, 0x30, 0xB6, 0x26, 0xDD, 0x07, 0x63, 0x6E, 0x87, 0x7C, 0x4F, 0x9C, 0x72, 0x7C, 0x9D, 0x4C,
+    0xA0, 0xF2, 0xF3, 0x3B, 0x72, 0x3B, 0xE6, 0x57, 0x02, 0xD9, 0x9D, 0xB9, 0x1A, 0xF9, 0x9C, 0xA0,
+    0xF9, 0x3A, 0x80, 0x07, 0x21, 0xF3, 0xB2, 0x77, 0xC3, 0x26, 0xDA, 0x66, 0x78, 0xC4, 0xDC, 0xAF,
+    0x43, 0xD3, 0x13, 0xE7, 0x19, 0x00, 0x02, 0x0C, 0xBC, 0xCC, 0xBD, 0xA6, 0x5F, 0xCE, 0x7C, 0x7D,
+    0x87, 0xF0, 0x83, 0xFE, 0x30, 0x7B, 0x60, 0xF2, 0x83, 0x28, 0x06, 0xD8, 0x15, 0xC5, 0x5B, 0xDF,
+    0x1B, 0x53, 0x7C, 0xE4, 0xCA, 0x4C, 0x80, 0x00, 0xB5, 0xEF, 0xA5, 0xAF, 0x7D, 0x00, 0x09, 0x32,
+    0x93, 0x2B, 0x53, 0x7C, 0xEB, 0x7B, 0xE2, 0xAE, 0x26, 0xD8, 0x00, 0x04, 0x8F, 0x70, 0x81, 0x02,
+    0x04, 0x89, 0x15, 0x15, 0x15, 0x16, 0x12, 0x00, 0x07, 0xF0, 0xBE, 0x6F, 0xE1, 0x7C, 0xC0, 0x07,
+    0x7C, 0xCF, 0x4D, 0x0D, 0x7F, 0x56, 0x6E, 0x5E, 0xF3, 0x2A, 0x1F, 0xC2, 0x0F, 0x28, 0x5B, 0xFD,
+    0x3C, 0xCD, 0x79, 0x1E, 0xAC, 0x80, 0x4F, 0xA8, 0x9E, 0xCD, 0xBE, 0x8D, 0x55, 0xBF, 0x45, 0xAD,
+    0xF8, 0x13, 0x3C, 0xD3, 0x3C, 0xD3, 0x30, 0xB2, 0x15, 0xC2, 0x1B, 0x61, 0xD8, 0x7A, 0x80, 0x07,
+    0xC9, 0xC0, 0xFF, 0x3E, 0x47, 0x8C, 0xCE, 0x38, 0x99, 0x64, 0x65, 0x91, 0x96, 0x46, 0x59, 0x1C,
+    0x71, 0x3C, 0x66, 0x7F, 0x9F, 0x23, 0xE4, 0xE0, 0xB4, 0xE4, 0xAF, 0xE7, 0xC9, 0xB7, 0xE8, 0xC8,
+    0xFF, 0x86, 0x47, 0xCD, 0x91, 0xDE, 0x87, 0x7A, 0x1F, 0x36, 0x47, 0xCF, 0x93, 0x6F, 0xD1, 0x92,
+    0xBF, 0x9F, 0x25, 0xA7, 0x27, 0x50, 0x00, 0xB7, 0xD1, 0xE9, 0xA5, 0xBE, 0x8F, 0x4D, 0x00, 0x05,
+    0x8D, 0xBF, 0xFF, 0xFA, 0xD5, 0xE9, 0xFB, 0x31, 0xB7, 0x1C, 0xF1, 0x9D, 0x72, 0xCA, 0x79, 0xF1,
+    0xCA, 0x63, 0x5C, 0xAD, 0xEE, 0xED, 0x9D, 0x7F, 0xB7, 0xFC, 0x71, 0xDB, 0xF5, 0xFF, 0x7E, 0x0D,
+    0xB1, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x98, 0x87, 0xE9, 0x88, 0x7E, 0x98, 0x84, 0xC4, 0x26, 0x21,
+    0x31, 0x0F, 0xD3, 0x10, 0xFD, 0x31, 0x09, 0x88, 0x4C, 0x42, 0x50, 0x7A, 0x0F, 0x18, 0x99, 0xE6,
+    0xDB, 0x0E, 0x2A, 0xFB, 0xF5, 0x57, 0xC7, 0xE0, 0x4F, 0xD7, 0xEB, 0x4E, 0x3E, 0xC4, 0xE3, 0xEC,
+    0x4E, 0x3E, 0xC4, 0xE3, 0xEC, 0x4F, 0xD9, 0xEC, 0x57, 0xEB, 0xFC, 0x0A, 0xFF, 0xD3, 0x56, 0xD8,
+    0x71, 0x33, 0xCC, 0xF1, 0x89, 0xE8, 0x0A, 0xEA, 0x5B, 0xDA, 0x4F, 0xF3, 0x13, 0xFC, 0xC5, 0xA8,
+    0x56, 0x80, 0x06, 0xC2, 0xD8, 0x9E, 0xFD, 0x0D, 0x75, 0x3E, 0xAF, 0x51, 0x6C, 0x4F, 0x7E, 0x86,
+    0xBA, 0x9C, 0x3D, 0x40, 0x07, 0x11, 0xC4, 0x71, 0x1C, 0x47, 0x11, 0xC4, 0x71, 0x1C, 0x47, 0x11,
+    0xBE, 0x06, 0xF8, 0x00, 0x6D, 0x81, 0xB6, 0x06, 0xD8, 0x1B, 0x60, 0x6D, 0x81, 0xB6, 0x06, 0xD8,
+    0x00, 0x7A, 0x0F, 0x18, 0x99, 0xE6, 0xDB, 0x0E, 0x2A, 0xB5, 0x57, 0xC7, 0xF1, 0xA7, 0xC7, 0xB1,
+    0x3F, 0xD5, 0x09, 0xFE, 0xA8, 0x4F, 0xF0, 0x84, 0xF8, 0xF5, 0xA7, 0xCF, 0xD8, 0xAB, 0xFD, 0x4A,
+    0xE1, 0xAB, 0x6C, 0x38, 0x99, 0xE6, 0x78, 0xC4, 0xF4, 0xE2, 0x38, 0x8E, 0x23, 0x88, 0xE2, 0x38,
+    0x8E, 0x23, 0x88, 0xE2, 0x38, 0x8E, 0x23, 0x88, 0xE2, 0x0D, 0xB1, 0x3F, 0x37, 0x03, 0xAF, 0xCA,
+    0x75, 0xF9, 0x4E, 0xBF, 0x29, 0xF9, 0xB8, 0x1B, 0x62, 0x04, 0xC1, 0x30, 0x4C, 0x13, 0x04, 0xC1,
+    0x7A, 0x17, 0xA1, 0x30, 0x4C, 0x13, 0x04, 0xC1, 0x30, 0xFC, 0xDD, 0x49, 0x83, 0xAF, 0x63, 0xAF,
+    0xF2, 0x9D, 0x7F, 0x90, 0xB7, 0xFA, 0xCA, 0xFE, 0x20, 0xFC, 0xDE, 0xA2, 0x60, 0xEB, 0xD4, 0xEB,
+    0xF8, 0xCE, 0xBF, 0x8C, 0xB7, 0xF4, 0x15, 0xFC, 0x20, 0x00, 0x0D, 0x85, 0x84, 0x8E, 0xA0, 0x00,
+    0x78, 0xBE, 0x6F, 0x17, 0xCC, 0xD4, 0x40, 0x81, 0x02, 0x06, 0xA7, 0x8A, 0x1E, 0x28, 0x68, 0x56,
+    0x85, 0x68, 0x5B, 0xE8, 0x2D, 0xF4, 0x16, 0xBD, 0xF3, 0xB5, 0xEF, 0x9C, 0x89, 0x16, 0xBD, 0xF3,
+    0xB5, 0xEF, 0x9C, 0x89, 0x00, 0x04, 0x89, 0x07, 0x7C, 0xCF, 0x4E, 0x8D, 0xBF, 0x56, 0xA7, 0xC2,
+    0x0F, 0xAE, 0x0F, 0xAE, 0x0F, 0xAE, 0x0F, 0x84, 0x36, 0xFD, 0x5C, 0xCF, 0x4D, 0x4E, 0xFC, 0x40,
+    0x0D, 0xB0, 0x2A, 0x2A, 0x2D, 0x42, 0xD4, 0x0D, 0xB4, 0x2B, 0xD0, 0xB7, 0x62, 0x60, 0xB7, 0x62,
+    0xBD, 0x0D, 0xB4, 0x00, 0x07, 0x0F, 0x51, 0xAE, 0xA7, 0xBF, 0x42, 0xD8, 0x9F, 0x57, 0xA8, 0xD7,
+    0x53, 0xDF, 0xA1, 0x6C, 0x4D, 0x80, 0x0D, 0xB0, 0x2A, 0x2A, 0xEA, 0xB5, 0x3B, 0x2D, 0x4D, 0x47,
+    0x23, 0x6C, 0x4A, 0xE0, 0x58, 0x7B, 0xC6, 0xA3, 0x91, 0xB6, 0x7C, 0x55, 0xC3, 0x92, 0xDB, 0x7F,
+    0x12, 0x6B, 0xF2, 0x96, 0xA1, 0x6A, 0x0F, 0x94, 0x0D, 0xB0, 0x2A, 0x2A, 0xEA, 0xB5, 0x21, 0x6A,
+    0x6A, 0x39, 0x0C, 0xCA, 0xE0, 0x58, 0x7B, 0x86, 0xA3, 0xFD, 0xDD, 0x4F, 0xD1, 0x0A, 0xFE, 0x2E,
+    0xCB, 0x75, 0xFE, 0x54, 0xF5, 0xFE, 0x42, 0xDF, 0xEC, 0x2B, 0xF8, 0x80, 0xFC, 0xDE, 0xA2, 0x60,
+    0xEB, 0xD4, 0xEB, 0xF8, 0xFA, 0xBA, 0xFE, 0x38, 0x5B, 0xFA, 0x3B, 0x2B, 0xF8, 0x79, 0x0C, 0xCD,
+    0xB1, 0x2C, 0x3D, 0xC3, 0xB0, 0xE5, 0xC4, 0xCF, 0x93, 0x6F, 0xA7, 0xF8, 0x96, 0xAF, 0xFA, 0x13,
+    0x6A, 0x3A, 0xDA, 0x83, 0xE5, 0x00, 0x00, 0x03, 0xBE, 0x07, 0xA6, 0x27, 0x1C, 0x5F, 0xE5, 0x9E,
+    0x2F, 0xF2, 0xCF, 0x11, 0x88, 0xC4, 0xFF, 0xB6, 0x27, 0x7C, 0x0B, 0x00, 0x20, 0x7B, 0x4D, 0xB4,
+    0x3B, 0xE2, 0x78, 0xC1, 0xB7, 0xDB, 0x82, 0xDF, 0x4E, 0x09, 0xDB, 0x05, 0xBE, 0x9C, 0x1B, 0x7D,
+    0xB8, 0x1E, 0x30, 0x3B, 0xE2, 0x6D, 0xA0, 0xF6, 0x88, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x98, 0x84,
+    0xC4, 0x26, 0x21, 0x31, 0x09, 0x88, 0x4C, 0x42, 0x62, 0x13, 0x3D, 0x93, 0x6E, 0x85, 0x7A, 0x1B,
+    0x66, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x98, 0x84, 0xC4, 0x26, 0x21, 0x31, 0x09, 0x88, 0x4C, 0x42,
+    0x62, 0x15, 0xF7, 0xC2, 0xB7, 0xE6, 0xDB, 0xF6, 0xF4, 0x36, 0xCC, 0x00, 0xB5, 0xE8, 0xB5, 0xE8,
+    0x91, 0x22, 0x44, 0x89, 0x12, 0x24, 0x48, 0x90, 0x3B, 0xE0, 0x77, 0xC0, 0xF6, 0xB6, 0xBD, 0x16,
+    0xBF, 0xB1, 0x64, 0x25, 0x09, 0x42, 0x50, 0x94, 0x25, 0x09, 0x42, 0xD7, 0xA2, 0xD7, 0xBE, 0x07,
+    0x7C, 0x00, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x98, 0x84, 0xC4, 0x26, 0x21, 0x31, 0x09, 0x88, 0x4C,
+    0x42, 0x62, 0x13, 0x10, 0x98, 0x84, 0xC4, 0x25, 0x00, 0x97, 0x54, 0xA1, 0x2F, 0x35, 0x9D, 0x15,
+    0xFB, 0x33, 0x3E, 0xFC, 0x4D, 0xC7, 0xB8, 0x40, 0x82, 0xD7, 0xA2, 0xD7, 0xA1, 0x02, 0x07, 0xB8,
+    0x6E, 0x3E, 0xFC, 0x55, 0xFB, 0x33, 0x5B, 0x0E, 0x89, 0x79, 0xA5, 0xD9, 0x2E, 0xA0, 0x07, 0xC9,
+    0x93, 0x6C, 0x79, 0x2B, 0x8E, 0xAB, 0x3B, 0x25, 0x09, 0x88, 0x4C, 0x42, 0x62, 0x13, 0xEF, 0x85,
+    0xBE, 0x6E, 0xCA, 0xFF, 0xFB, 0xA1, 0xFB, 0x74, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x3C, 0xC6, 0x86,
+    0xD9, 0x96, 0xC0, 0xEE, 0x3C, 0xC7, 0x91, 0xB6, 0x65, 0x71, 0x2D, 0x7A, 0x2D, 0x7A, 0x00, 0x00,
+    0xB5, 0xE8, 0xB5, 0xE8, 0x35, 0x64, 0xD1, 0xC7, 0x6C, 0x5F, 0x2D, 0xB0, 0x7C, 0xBE, 0xE3, 0xE5,
+    0xF3, 0x38, 0xF2, 0x3E, 0xBC, 0xCA, 0xE0, 0x5A, 0xF4, 0x5A, 0xF4, 0x00, 0xB5, 0xE8, 0xB5, 0xE8,
+    0x40, 0x81, 0xEE, 0x1B, 0x8F, 0xBF, 0x15, 0x7E, 0xCC, 0xD6, 0x74, 0x4B, 0xCD, 0x28, 0x4B, 0xA8,
+    0x20, 0x40, 0x85, 0x6F, 0x45, 0xAF, 0xD1, 0x61, 0x22, 0x44, 0x89, 0x12, 0x24, 0x5A, 0xF4, 0x5A,
+    0xF4, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0xB0, 0xAE, 0x83, 0xC0, 0xB6, 0x63, 0x41, 0xCC, 0x68, 0x5B,
+    0x33, 0xC1, 0x5D, 0x0B, 0x0B, 0x5E, 0x8B, 0x5E, 0x80, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x40, 0x81,
+    0x02, 0x04, 0x08, 0x10, 0x20, 0x41, 0x6B, 0xD1, 0x6B, 0xD0, 0x06, 0xF8, 0x17, 0xCD, 0xB6, 0x7A,
+    0x2B, 0x86, 0xAA, 0xB9, 0xAC, 0xEC, 0x94, 0x25, 0x09, 0x42, 0x50, 0x94, 0x2C, 0xEC, 0xAB, 0x9A,
+    0xB8, 0x6A, 0xDB, 0x3D, 0x0B, 0xE6, 0x6F, 0x80, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x91, 0x22, 0x44,
+    0x89, 0x12, 0x24, 0x48, 0x91, 0x6B, 0xD1, 0x6B, 0xD0, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x99, 0x26,
+    0x49, 0x92, 0x64, 0x99, 0x26, 0x49, 0x92, 0x64, 0xAC, 0x15, 0xA0, 0xD0, 0x06, 0xF8, 0x17, 0xCD,
+    0xB6, 0x7C, 0x95, 0xC3, 0x55, 0x5C, 0xD2, 0x84, 0xA1, 0x28, 0x4A, 0x12, 0x84, 0xA1, 0x57, 0x35,
+    0x70, 0xD5, 0xB6, 0x3A, 0x1F, 0x26, 0x20, 0x91, 0x22, 0x44, 0x89, 0x12, 0x2D, 0x7A, 0x2D, 0x7A,
+    0x24, 0x48, 0x91, 0x22, 0x44, 0x80, 0xEA, 0x24, 0x5B, 0x08, 0x6D, 0x9C, 0x1E, 0x50, 0x7B, 0xE0,
+    0xB7, 0x62, 0xBA, 0x15, 0xCC, 0xEF, 0x81, 0xF3, 0x0D, 0x0A, 0xE2, 0x58, 0x75, 0x07, 0xA0, 0xF1,
+    0x81, 0xF6, 0xE2, 0x63, 0x9B, 0x6C, 0x32, 0x6D, 0x87, 0x16, 0xD8, 0x71, 0x5A, 0xF4, 0x5A, 0xF4,
+    0x6D, 0x87, 0x16, 0xD8, 0x71, 0x6D, 0x86, 0x46, 0x39, 0x9F, 0x66, 0x27, 0x8C, 0x0F, 0x40, 0xEA,
+    0xEA, 0xEA, 0x84, 0xBB, 0x2D, 0x87, 0x92, 0xBF, 0x4E, 0x67, 0xDF, 0x89, 0xE0, 0x7B, 0xC7, 0x83,
+    0x6F, 0xBF, 0x15, 0x7E, 0x9C, 0xD6, 0xC3, 0xC9, 0x2E, 0xCE, 0xA8, 0x75, 0x75, 0x00, 0xB5, 0xE8,
+    0xB5, 0xE8, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x21, 0x6B, 0xD1, 0x6B, 0xD0, 0x77, 0x1D,
+    0xC0, 0x0B, 0x74, 0x2D, 0x41, 0xEE, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x5A, 0xF4,
+    0x5A, 0xF4, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x20, 0x40, 0x81, 0x02, 0x04, 0x2D, 0x7A, 0x2D, 0x7A,
+    0x08, 0x10, 0x20, 0x40, 0x81, 0x0B, 0x5E, 0x8B, 0x5E, 0x80, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x20,
+    0x40, 0x81, 0x02, 0x04, 0x2D, 0x7A, 0x2D, 0x7A, 0x08, 0x10, 0x20, 0x40, 0x81, 0x0B, 0x5E, 0x8B,
+    0x5E, 0x83, 0xBE, 0x07, 0x7C, 0x00, 0x09, 0x12, 0x24, 0x48, 0xB5, 0xE8, 0xB5, 0xE8, 0x44, 0x11,
+    0x04, 0x41, 0x10, 0x44, 0x11, 0x04, 0x41, 0xEE, 0xEC, 0x5B, 0x52, 0xBA, 0x1B, 0x66, 0x00, 0xB5,
+    0xE8, 0xB5, 0xE8, 0x44, 0x11, 0x04, 0x41, 0x10, 0x44, 0x11, 0x04, 0x41, 0xEE, 0xEC, 0x5B, 0x52,
+    0xBA, 0x1B, 0x66, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x44, 0x11, 0x04,
+    0x41, 0x10, 0x44, 0x11, 0x04, 0x41, 0xEE, 0xEC, 0x5B, 0x52, 0xBA, 0x1B, 0x66, 0x06, 0x3F, 0x23,
+    0x6C, 0x79, 0x2B, 0x86, 0xAA, 0xB9, 0xA5, 0x09, 0x42, 0x62, 0x13, 0x10, 0x98, 0x84, 0xC4, 0x2B,
+    0x1C, 0xD5, 0x8D, 0x5B, 0x7B, 0x39, 0x17, 0xCC, 0xDF, 0x10, 0x00, 0xB5, 0xE8, 0xB5, 0xE8, 0x48,
+    0x91, 0x22, 0x47, 0x8C, 0x5B, 0x5F, 0x45, 0x71, 0xF2, 0x59, 0xCD, 0x28, 0x4A, 0x12, 0x84, 0xA1,
+    0x28, 0x4A, 0x16, 0x76, 0x57, 0x0D, 0x5B, 0x67, 0xA1, 0x7C, 0xCD, 0xF0, 0x00, 0x67, 0x0D, 0xB4,
+    0xEC, 0xAF, 0xE1, 0xF2, 0x5B, 0xFF, 0x5A, 0x27, 0xBE, 0x29, 0xEF, 0x82, 0x7D, 0xC4, 0xC1, 0x30,
+    0x4C, 0x13, 0x05, 0xAF, 0x45, 0xAF, 0x40, 0x07, 0x3E, 0x46, 0xBD, 0x0F, 0x87, 0xE5, 0x3E, 0xBF,
+    0x59, 0xF5, 0xFA, 0xCF, 0x8C, 0x1F, 0x1F, 0x51, 0xF7, 0x73, 0x37, 0xE8, 0x7A, 0x50, 0x75, 0x07,
+    0x8C, 0x5B, 0x5F, 0x45, 0x7F, 0x07, 0x92, 0xDC, 0x7B, 0x27, 0x8C, 0x27, 0x84, 0x27, 0x84, 0x27,
+    0x8C, 0x27, 0x8F, 0x64, 0xFB, 0xFC, 0x9E, 0xEE, 0xFA, 0x3D, 0x55, 0xC4, 0x00, 0x6F, 0x43, 0x7A,
+    0x1F, 0x57, 0xAC, 0xFA, 0xBD, 0x67, 0xD5, 0xEB, 0x3E, 0xAF, 0x59, 0xFB, 0xBD, 0x66, 0xFE, 0xB3,
+    0xDF, 0xFC, 0x63, 0x90, 0x00, 0x6F, 0x43, 0x7A, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x00, 0x3B,
+    0x8E, 0xE3, 0xDA, 0x6F, 0x43, 0x78, 0x38, 0x41, 0xC2, 0x0E, 0x10, 0x70, 0x83, 0x84, 0x1B, 0xD0,
+    0xDE, 0x83, 0xB8, 0x07, 0x7C, 0xCF, 0x4D, 0x0F, 0xDD, 0xA9, 0xF7, 0x76, 0x3E, 0x30, 0x7C, 0x60,
+    0xF8, 0xC1, 0xF7, 0x76, 0x3F, 0xB3, 0x99, 0xE9, 0xC4, 0xEF, 0xC0, 0x70, 0xEA, 0x70, 0xEC, 0x71,
+    0xF3, 0x3B, 0x68, 0x4E, 0x25, 0x70, 0x36, 0x1B, 0xD0, 0xDE, 0x86, 0xC2, 0xB8, 0x13, 0x89, 0xDB,
+    0x43, 0x8E, 0xA7, 0x0E, 0xC7, 0x0E, 0xA0, 0x07, 0x3D, 0x4D, 0x7C, 0xCE, 0x30, 0x7D, 0x7D, 0x4F,
+    0xAF, 0xA9, 0xF1, 0x83, 0x7F, 0x59, 0xF3, 0x50, 0x8E, 0x80, 0x00, 0x6F, 0x43, 0x7A, 0x0D, 0x46,
+    0x66, 0xD8, 0x96, 0x1E, 0xE1, 0xCC, 0x6F, 0x43, 0x7A, 0x00, 0x00, 0x6F, 0x44, 0xEF, 0x45, 0x5E,
+    0x6D, 0x9A, 0x36, 0xAE, 0x2D, 0xAD, 0x82, 0xBE, 0xE2, 0x79, 0x8D, 0xE8, 0x6F, 0x40, 0x00, 0x6F,
+    0x43, 0x7A, 0x1B, 0x60, 0x57, 0x03, 0xDD, 0x99, 0xE7, 0xE4, 0x71, 0xF3, 0x38, 0x40, 0x02, 0x04,
+    0x1E, 0x94, 0x37, 0xE8, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1B, 0xD0, 0xDE, 0x80, 0x00, 0x6F,
+    0x43, 0x7A, 0x1A, 0x8F, 0x78, 0xB6, 0x23, 0x41, 0xCC, 0x68, 0x5B, 0x13, 0xDE, 0x35, 0x1B, 0xD0,
+    0xDE, 0x80, 0x00, 0x6F, 0x43, 0x7A, 0x1B, 0x0D, 0x86, 0xC3, 0x61, 0xB0, 0xD8, 0x6F, 0x43, 0x7A,
+    0x00, 0x07, 0x7C, 0xCF, 0x4D, 0x0D, 0x75, 0x39, 0x76, 0x32, 0x83, 0x28, 0x32, 0x83, 0x97, 0x63,
+    0x5D, 0x4F, 0x4D, 0x0E, 0xF9, 0x80, 0x00, 0x6F, 0x43, 0x7A, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C,
+    0x06, 0xF4, 0x37, 0xA0, 0x00, 0x78, 0xBE, 0x6F, 0x17, 0xCD, 0xCF, 0x89, 0xC7, 0x99, 0x94, 0x19,
+    0x41, 0x94, 0x1C, 0xBB, 0x1A, 0xEA, 0x7A, 0x68, 0x77, 0xC4, 0x07, 0x7C, 0xCF, 0x4D, 0x0D, 0x75,
+    0x39, 0x76, 0x32, 0x83, 0x28, 0x32, 0x83, 0x97, 0x33, 0x5D, 0x4E, 0x7C, 0x40, 0x70, 0x1C, 0x07,
+    0x01, 0xC0, 0x6F, 0x43, 0x7A, 0x1B, 0xD0, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0x07, 0x21, 0xF3, 0xB2,
+    0x77, 0xC3, 0x26, 0xDA, 0x66, 0x78, 0xC4, 0xDC, 0xAF, 0x43, 0xD3, 0x13, 0xE7, 0x19, 0x00, 0x07,
+    0x7C, 0xCF, 0x4D, 0x0D, 0x79, 0x9C, 0x60, 0xCA, 0x0C, 0xBA, 0x9C, 0x20, 0xE3, 0xCD, 0xB5, 0xEF,
+    0x86, 0xD7, 0xBE, 0x0E, 0x3C, 0xCE, 0x10, 0x65, 0xD4, 0xCA, 0x0E, 0x30, 0x6B, 0xCC, 0xF4, 0xD0,
+    0xEF, 0x98, 0x7C, 0x9D, 0x4C, 0xA0, 0xF2, 0xF3, 0x3B, 0x72, 0x3B, 0xE6, 0x57, 0x02, 0xD9, 0x9D,
+    0xB9, 0x1A, 0xF9, 0x9C, 0xA0, 0xF9, 0x3A, 0x80, 0x00, 0x6F, 0x43, 0x7A, 0x08, 0x10, 0x20, 0x40,
+    0x81, 0x06, 0xF4, 0x37, 0xB8, 0xEE, 0x06, 0xE3, 0x7C, 0x0D, 0xB0, 0x18, 0x8C, 0x46, 0x23, 0x03,
+    0x6C, 0x0D, 0xE8, 0x6F, 0x40, 0x00, 0x6F, 0x43, 0x7A, 0x08, 0x10, 0x20, 0x40, 0x83, 0x7A, 0x1B,
+    0xD0, 0x40, 0x81, 0x02, 0x04, 0x1B, 0xD0, 0xDE, 0x80, 0x00, 0x6F, 0x43, 0x7A, 0x08, 0x10, 0x20,
+    0x40, 0x83, 0x7A, 0x1B, 0xD0, 0x40, 0x81, 0x02, 0x04, 0x1B, 0xD0, 0xDE, 0xE3, 0xB8, 0x00, 0x70,
+    0x1C, 0x06, 0xF4, 0x37, 0xA1, 0x58, 0x2B, 0x05, 0x60, 0xAC, 0x15, 0x83, 0x6F, 0xCA, 0x6D, 0xD0,
+    0x68, 0x00, 0x6F, 0x43, 0x7A, 0x15, 0x82, 0xB0, 0x56, 0x0A, 0xC1, 0x5F, 0x59, 0xB7, 0xE5, 0x36,
+    0xE8, 0x39, 0x01, 0xBD, 0x0D, 0xE8, 0x00, 0x6F, 0x43, 0x7A, 0x15, 0x82, 0xB0, 0x56, 0x0A, 0xC1,
+    0xB7, 0xAC, 0xDB, 0xFD, 0xA3, 0xA0, 0xE4, 0x07, 0xAB, 0xE4, 0x35, 0xE4, 0x71, 0xD4, 0xCB, 0xB1,
+    0xF1, 0x83, 0xE3, 0x07, 0xC6, 0x0F, 0xDD, 0xD8, 0xDF, 0xA1, 0xDF, 0x30, 0x00, 0x6F, 0x43, 0x7A,
+    0x1B, 0x0D, 0x85, 0xB1, 0x3D, 0x34, 0x3C, 0xFC, 0x8E, 0x30, 0x65, 0x06, 0x5D, 0x4C, 0xA0, 0xE3,
+    0x06, 0xBE, 0x67, 0xA7, 0x42, 0xD9, 0x80, 0x07, 0xBA, 0x0D, 0xFB, 0x1F, 0xBB, 0xF0, 0x9F, 0x0D,
+    0x0F, 0xAB, 0x13, 0xEA, 0xC0, 0xFA, 0xB0, 0x3E, 0xAC, 0x0D, 0xE8, 0x6F, 0x40,
+};
+const uint8_t ArialMT_Plain_24_RU_huffman[] PROGMEM = {
+    0x01, 0x00, 0x00, 0x02, 0x04, 0x08, 0x09, 0x03, 0x08, 0x0C, 0x11, 0x12, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x60, 0x3F, 0xC0, 0xE0, 0xFF, 0x01, 0x03, 0x06, 0x07, 0x0F, 0x1C, 0x80, 0xFC, 0x04,
+    0x0C, 0x0E, 0x18, 0x1F, 0x20, 0x38, 0xF0, 0xFE, 0x1E, 0x3C, 0xF8, 0x10, 0x31, 0x33, 0x3E, 0x70,
+    0x78, 0x8C, 0xC6, 0x02, 0x08, 0x7C, 0x7E, 0x7F, 0x83, 0x84, 0x86, 0x87, 0x8F, 0xCE, 0xCF, 0x19,
+    0x1D, 0x21, 0x22, 0x36, 0x39, 0x40, 0x61, 0x67, 0x6C, 0x9C, 0xC1, 0xC3, 0xC7, 0xCC, 0xD8, 0xE6,
+    0x0B, 0x1B, 0x26, 0x2C, 0x32, 0x37, 0x3D, 0x50, 0x66, 0x6F, 0xDC, 0xE1, 0xE3, 0xE7, 0xF1, 0xF4,
+    0xF6, 0xF7, 0x09, 0x0D, 0x1A, 0x23, 0x27, 0x3B, 0x4E, 0x63, 0x6E, 0x76, 0x77, 0x81, 0x85, 0x8E,
+    0x90, 0x98, 0x9F, 0xB0, 0xB8, 0xE2, 0xEC, 0xEE, 0xEF, 0xF3,
+};
+const CompressedFont ArialMT_Plain_24_RU = {ArialMT_Plain_24_RU_header, ArialMT_Plain_24_RU_data, ArialMT_Plain_24_RU_huffman};
+
+#endif
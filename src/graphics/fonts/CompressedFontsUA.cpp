@@ -0,0 +1,697 @@
+// Generated by bin/compress-oled-fonts.py from OLEDDisplayFontsUA.cpp, don't edit
+// trunk-ignore-all(clang-format): Generated
+#include "OLEDDisplayFontsUA.h"
+#if defined(OLED_UA) && FONT_COMPRESSED
+
+const uint8_t ArialMT_Plain_10_UA_header[] PROGMEM = {
+    0x0A, 0x0D, 0x20, 0xE0, 0xFF, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x04, 0x03, 0x00, 0x02, 0x05, 0x04,
+    0x00, 0x05, 0x09, 0x06, 0x00, 0x0B, 0x0A, 0x06, 0x00, 0x12, 0x10, 0x09, 0x00, 0x1B, 0x0E, 0x08,
+    0x00, 0x24, 0x01, 0x02, 0x00, 0x25, 0x06, 0x04, 0x00, 0x29, 0x06, 0x04, 0x00, 0x2D, 0x05, 0x04,
+    0x00, 0x31, 0x09, 0x06, 0x00, 0x36, 0x04, 0x03, 0x00, 0x38, 0x03, 0x03, 0x00, 0x3A, 0x04, 0x03,
+    0x00, 0x3C, 0x05, 0x04, 0x00, 0x3F, 0x0A, 0x06, 0x00, 0x45, 0x08, 0x05, 0x00, 0x49, 0x0A, 0x06,
+    0x00, 0x4F, 0x0A, 0x06, 0x00, 0x55, 0x0B, 0x07, 0x00, 0x5B, 0x0A, 0x06, 0x00, 0x62, 0x0A, 0x06,
+    0x00, 0x69, 0x09, 0x06, 0x00, 0x6E, 0x0A, 0x06, 0x00, 0x74, 0x0A, 0x06, 0x00, 0x7B, 0x04, 0x03,
+    0x00, 0x7D, 0x04, 0x03, 0x00, 0x7F, 0x0A, 0x06, 0x00, 0x84, 0x09, 0x06, 0x00, 0x89, 0x09, 0x06,
+    0x00, 0x8E, 0x0B, 0x07, 0x00, 0x94, 0x14, 0x0B, 0x00, 0xA6, 0x0E, 0x08, 0x00, 0xAE, 0x0C, 0x07,
+    0x00, 0xB4, 0x0C, 0x07, 0x00, 0xBA, 0x0B, 0x07, 0x00, 0xC0, 0x0C, 0x07, 0x00, 0xC6, 0x09, 0x06,
+    0x00, 0xCA, 0x0D, 0x08, 0x00, 0xD1, 0x0C, 0x07, 0x00, 0xD7, 0x04, 0x03, 0x00, 0xD9, 0x08, 0x05,
+    0x00, 0xDD, 0x0E, 0x08, 0x00, 0xE4, 0x0C, 0x07, 0x00, 0xE9, 0x10, 0x09, 0x00, 0xF1, 0x0C, 0x07,
+    0x00, 0xF7, 0x0E, 0x08, 0x00, 0xFE, 0x0B, 0x07, 0x01, 0x04, 0x0E, 0x08, 0x01, 0x0B, 0x0C, 0x07,
+    0x01, 0x11, 0x0C, 0x07, 0x01, 0x18, 0x0B, 0x07, 0x01, 0x1D, 0x0C, 0x07, 0x01, 0x22, 0x0D, 0x08,
+    0x01, 0x29, 0x11, 0x0A, 0x01, 0x32, 0x0E, 0x08, 0x01, 0x39, 0x0D, 0x08, 0x01, 0x3F, 0x0C, 0x07,
+    0x01, 0x47, 0x06, 0x04, 0x01, 0x4A, 0x06, 0x04, 0x01, 0x4D, 0x04, 0x03, 0x01, 0x50, 0x09, 0x06,
+    0x01, 0x55, 0x0C, 0x07, 0x01, 0x5A, 0x03, 0x03, 0x01, 0x5C, 0x0A, 0x06, 0x01, 0x61, 0x0A, 0x06,
+    0x01, 0x66, 0x0A, 0x06, 0x01, 0x6B, 0x0A, 0x06, 0x01, 0x70, 0x0A, 0x06, 0x01, 0x75, 0x05, 0x04,
+    0x01, 0x78, 0x0A, 0x06, 0x01, 0x7F, 0x0A, 0x06, 0x01, 0x84, 0x04, 0x03, 0x01, 0x86, 0x04, 0x03,
+    0x01, 0x89, 0x08, 0x05, 0x01, 0x8D, 0x04, 0x03, 0x01, 0x8F, 0x10, 0x09, 0x01, 0x96, 0x0A, 0x06,
+    0x01, 0x9B, 0x0A, 0x06, 0x01, 0xA0, 0x0A, 0x06, 0x01, 0xA5, 0x0A, 0x06, 0x01, 0xAA, 0x05, 0x04,
+    0x01, 0xAD, 0x08, 0x05, 0x01, 0xB1, 0x06, 0x04, 0x01, 0xB4, 0x0A, 0x06, 0x01, 0xB8, 0x09, 0x06,
+    0x01, 0xBD, 0x0E, 0x08, 0x01, 0xC4, 0x0A, 0x06, 0x01, 0xC9, 0x09, 0x06, 0x01, 0xCF, 0x0A, 0x06,
+    0x01, 0xD4, 0x06, 0x04, 0x01, 0xD8, 0x04, 0x03, 0x01, 0xDA, 0x05, 0x04, 0x01, 0xDE, 0x09, 0x06,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A,
+    0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0A, 0x01, 0xE3, 0x04, 0x03, 0x01, 0xE5, 0x0A, 0x06,
+    0x01, 0xEB, 0x0C, 0x07, 0x01, 0xF2, 0x0A, 0x06, 0x01, 0xF7, 0x09, 0x06, 0x01, 0xFC, 0x04, 0x03,
+    0x01, 0xFF, 0x0A, 0x06, 0x02, 0x09, 0x0C, 0x07, 0x02, 0x10, 0x0D, 0x08, 0x02, 0x18, 0x0C, 0x07,
+    0x02, 0x1F, 0x0A, 0x06, 0x02, 0x24, 0x09, 0x06, 0x02, 0x28, 0x03, 0x03, 0x02, 0x2A, 0x0D, 0x08,
+    0x02, 0x32, 0x0C, 0x07, 0x02, 0x39, 0x07, 0x05, 0x02, 0x3D, 0x0A, 0x06, 0x02, 0x43, 0x0C, 0x07,
+    0x02, 0x49, 0x0C, 0x07, 0x02, 0x4F, 0x07, 0x05, 0x02, 0x53, 0x0A, 0x06, 0x02, 0x58, 0x09, 0x06,
+    0x02, 0x5E, 0x03, 0x03, 0x02, 0x60, 0x0B, 0x07, 0x02, 0x66, 0x0B, 0x07, 0x02, 0x6C, 0x0C, 0x07,
+    0x02, 0x73, 0x0A, 0x06, 0x02, 0x78, 0x10, 0x09, 0x02, 0x81, 0x10, 0x09, 0x02, 0x8A, 0x10, 0x09,
+    0x02, 0x94, 0x06, 0x04, 0x02, 0x98, 0x0A, 0x06, 0x02, 0x9E, 0x0A, 0x06, 0x02, 0xA4, 0x0A, 0x06,
+    0x02, 0xAA, 0x09, 0x06, 0x02, 0xAF, 0x0A, 0x06, 0x02, 0xB5, 0x0A, 0x06, 0x02, 0xBA, 0x0A, 0x06,
+    0x02, 0xC1, 0x08, 0x05, 0x02, 0xC6, 0x0A, 0x06, 0x02, 0xCB, 0x0A, 0x06, 0x02, 0xD1, 0x0A, 0x06,
+    0x02, 0xD6, 0x0A, 0x06, 0x02, 0xDB, 0x0A, 0x06, 0x02, 0xE1, 0x0A, 0x06, 0x02, 0xE6, 0x0A, 0x06,
+    0x02, 0xEC, 0x0A, 0x06, 0x02, 0xF1, 0x09, 0x06, 0x02, 0xF6, 0x0A, 0x06, 0x02, 0xFC, 0x09, 0x06,
+    0x03, 0x00, 0x0A, 0x06, 0x03, 0x06, 0x09, 0x06, 0x03, 0x0C, 0x0A, 0x06, 0x03, 0x12, 0x0A, 0x06,
+    0x03, 0x17, 0x08, 0x05, 0x03, 0x1B, 0x0A, 0x06, 0x03, 0x20, 0x0C, 0x07, 0x03, 0x26, 0x0A, 0x06,
+    0x03, 0x2B, 0x0A, 0x06, 0x03, 0x31, 0x08, 0x05, 0x03, 0x36, 0x0A, 0x06, 0x03, 0x3C, 0x0A, 0x06,
+    0x03, 0x42, 0x0A, 0x06, 0x03, 0x48, 0x08, 0x05, 0x03, 0x4C, 0x08, 0x05, 0x03, 0x51, 0x08, 0x05,
+    0x03, 0x56, 0x07, 0x05, 0x03, 0x5A, 0x0A, 0x06, 0x03, 0x5F, 0x09, 0x06, 0x03, 0x64, 0x0A, 0x06,
+    0x03, 0x6A, 0x08, 0x05, 0x03, 0x6E, 0x0A, 0x06, 0x03, 0x73, 0x0A, 0x06, 0x03, 0x79, 0x06, 0x04,
+    0x03, 0x7D, 0x08, 0x05, 0x03, 0x81, 0x0A, 0x06, 0x03, 0x86, 0x08, 0x05, 0x03, 0x8A, 0x08, 0x05,
+    0x03, 0x8E, 0x08, 0x05, 0x03, 0x92, 0x05, 0x04, 0x03, 0x95, 0x08, 0x05, 0x03, 0x99, 0x05, 0x04,
+    0x03, 0x9C, 0x08, 0x05, 0x03, 0xA1, 0x09, 0x06, 0x03, 0xA6, 0x0A, 0x06, 0x03, 0xAB, 0x08, 0x05,
+    0x03, 0xB0, 0x08, 0x05, 0x03, 0xB4, 0x0A, 0x06, 0x03, 0xB9, 0x0C, 0x07, 0x03, 0xBF, 0x08, 0x05,
+    0x03, 0xC3, 0x08, 0x05, 0x03, 0xC7, 0x08, 0x05, 0x03, 0xCB, 0x08, 0x05, 0x03, 0xD0, 0x0A, 0x06,
+    0x03, 0xD6, 0x08, 0x05,
+};
+const uint8_t ArialMT_Plain_10_UA_data[] PROGMEM = {
+    0x0D, 0x20, 0xE8, 0x07, 0x40, 0xBB, 0xE4, 0xFE, 0x3E, 0x4F, 0xE0, 0xE6, 0xDC, 0x96, 0xBF, 0x35,
+    0x5D, 0xD8, 0x0E, 0x65, 0x4E, 0x6F, 0x83, 0xE9, 0xAA, 0xAC, 0xC0, 0xB3, 0x7A, 0xAF, 0x65, 0xF2,
+    0xB8, 0xB5, 0x9E, 0xC8, 0xE8, 0xCB, 0xED, 0xE5, 0x10, 0x88, 0xDB, 0xCB, 0x2E, 0xE4, 0x71, 0x39,
+    0x00, 0xA1, 0x43, 0x76, 0xA1, 0x40, 0x03, 0xCC, 0xB1, 0x60, 0x01, 0x00, 0x1F, 0x27, 0x10, 0xDD,
+    0xA1, 0x42, 0x85, 0xBB, 0x00, 0x09, 0x36, 0x34, 0xE0, 0xD9, 0x43, 0xF6, 0x55, 0x5C, 0xD0, 0xD9,
+    0xA1, 0x55, 0x55, 0x7D, 0x30, 0xC1, 0x73, 0xB9, 0xD8, 0xD3, 0xD8, 0xEA, 0xDD, 0x17, 0x25, 0xC9,
+    0x78, 0x60, 0xDD, 0xB9, 0x2E, 0x4B, 0x92, 0xFE, 0xB0, 0x82, 0x1F, 0xC1, 0xD0, 0x80, 0xFA, 0x6A,
+    0xAA, 0xAA, 0xAF, 0xA6, 0xF7, 0x6E, 0xCB, 0xB2, 0xEC, 0xB7, 0x60, 0x09, 0x40, 0x09, 0xF3, 0x0A,
+    0x17, 0x2E, 0x6C, 0xC0, 0xB9, 0x72, 0xE5, 0xCB, 0x80, 0x0D, 0x9A, 0xE5, 0xCA, 0x00, 0xD8, 0x82,
+    0x0F, 0x0A, 0xA7, 0x30, 0x0C, 0x3F, 0x3F, 0x2F, 0xEF, 0xEB, 0x97, 0xA7, 0x2F, 0x4F, 0x1F, 0xF7,
+    0xB7, 0xA6, 0xDF, 0x8C, 0xF9, 0x00, 0x16, 0x1B, 0xE8, 0xEC, 0x7D, 0x18, 0x61, 0x00, 0x0D, 0x3D,
+    0x55, 0x55, 0x56, 0xEC, 0x0D, 0xDA, 0x14, 0x28, 0x5B, 0x30, 0x0D, 0x3C, 0x28, 0x5B, 0x36, 0x40,
+    0x0D, 0x3D, 0x55, 0x55, 0x55, 0x50, 0x0D, 0x3D, 0x4A, 0x90, 0x0C, 0x9B, 0x34, 0x2A, 0xAF, 0x56,
+    0xC0, 0x0D, 0x3D, 0x0A, 0x14, 0x34, 0xE0, 0x0D, 0x38, 0x1C, 0x42, 0xD3, 0x00, 0x0D, 0x3D, 0x8E,
+    0xA7, 0x72, 0x18, 0x40, 0x0D, 0x38, 0x84, 0x21, 0x00, 0x0D, 0x3F, 0x33, 0x0C, 0x2C, 0x37, 0x33,
+    0x4E, 0x0D, 0x3F, 0x32, 0x85, 0x9B, 0x4E, 0x0D, 0xDA, 0x14, 0x28, 0x50, 0xB7, 0x60, 0x0D, 0x3D,
+    0x4A, 0x95, 0x39, 0x80, 0x0D, 0xDA, 0x14, 0x28, 0x78, 0x7D, 0xD0, 0x0D, 0x3D, 0x4A, 0x9E, 0x0E,
+    0x6E, 0x0E, 0x6D, 0x55, 0x55, 0x55, 0xDD, 0x80, 0x08, 0x20, 0xD3, 0xC1, 0x00, 0x0D, 0x30, 0x84,
+    0x2D, 0x30, 0x83, 0xDC, 0xB3, 0x0A, 0xCD, 0xEE, 0x40, 0xE2, 0x65, 0x85, 0xBB, 0x41, 0xBB, 0x0B,
+    0x2D, 0xC4, 0x14, 0x37, 0x73, 0xA9, 0xDC, 0x86, 0x10, 0x83, 0x62, 0x4C, 0x3C, 0x9B, 0x10, 0x87,
+    0xEC, 0xBC, 0x2F, 0x65, 0xD1, 0x71, 0x40, 0x0D, 0x70, 0x88, 0xE2, 0x64, 0x1C, 0x88, 0xD7, 0x00,
+    0xA1, 0xCC, 0x83, 0x99, 0x40, 0x20, 0x82, 0x08, 0x20, 0x80, 0x83, 0x60, 0x01, 0xEE, 0xAE, 0xB2,
+    0xE0, 0x0D, 0x3C, 0xA9, 0x58, 0x60, 0x0C, 0x34, 0xA9, 0x54, 0x60, 0x0C, 0x34, 0xA9, 0x5A, 0x70,
+    0x0C, 0x35, 0xD5, 0xD6, 0x10, 0x93, 0x77, 0xE4, 0x0C, 0x7E, 0x27, 0xD2, 0x7D, 0x33, 0xF9, 0x0D,
+    0x3C, 0x92, 0x61, 0xC0, 0x0F, 0xB7, 0x23, 0xEF, 0xF2, 0xD3, 0xD8, 0xC3, 0x4A, 0x0D, 0x38, 0x0C,
+    0xBC, 0x92, 0x65, 0xE4, 0x93, 0x0E, 0x0C, 0xBC, 0x92, 0x61, 0xC0, 0x0C, 0x34, 0xA9, 0x58, 0x60,
+    0x0C, 0xF0, 0x95, 0x2B, 0x0C, 0x0C, 0x34, 0xA9, 0x59, 0xE0, 0x0C, 0xBC, 0x80, 0xA2, 0xBA, 0xBA,
+    0x96, 0x93, 0x4F, 0x28, 0x0C, 0xB0, 0x85, 0x97, 0x93, 0x0C, 0x2C, 0x34, 0x80, 0xCB, 0x0B, 0x0D,
+    0x26, 0x18, 0x59, 0x60, 0x95, 0x46, 0xB1, 0x46, 0x94, 0x93, 0x1F, 0xA3, 0xCF, 0x0D, 0x20, 0x95,
+    0x2F, 0x75, 0xD5, 0x4A, 0xB1, 0xF1, 0xC2, 0x20, 0x0D, 0x70, 0x88, 0xF8, 0xE1, 0x60, 0xC1, 0x43,
+    0x05, 0x8C, 0x00, 0x0B, 0xF0, 0x0C, 0x35, 0xF8, 0x7C, 0x2A, 0x30, 0xA2, 0xF7, 0x7F, 0x0A, 0xAA,
+    0x16, 0xC8, 0x0C, 0xB4, 0xB4, 0xB6, 0x58, 0x0D, 0x3C, 0x10, 0x7F, 0xE0, 0x0E, 0x9C, 0x00, 0xFE,
+    0xF9, 0x72, 0xFD, 0x57, 0xF5, 0x5F, 0x4E, 0xFF, 0x80, 0x0C, 0xBF, 0xCA, 0xBA, 0xF9, 0x52, 0x80,
+    0xC9, 0xB3, 0x55, 0x7C, 0xAF, 0x95, 0xB3, 0x64, 0x0D, 0xDB, 0xF6, 0xF5, 0x50, 0xB6, 0x60, 0x0B,
+    0x35, 0x15, 0x9A, 0x88, 0x92, 0x49, 0x24, 0xC8, 0xB1, 0x60, 0xC9, 0xB3, 0x7D, 0xAF, 0x65, 0xE1,
+    0x6C, 0xD9, 0x08, 0x5E, 0x8B, 0x4F, 0xE8, 0xA1, 0x00, 0x0E, 0x87, 0x23, 0xA0, 0xA2, 0xA2, 0xDD,
+    0xE8, 0xA8, 0x80, 0x08, 0x50, 0xB4, 0xF0, 0xA1, 0x00, 0x09, 0x52, 0xBE, 0xDE, 0x54, 0xA0, 0x0C,
+    0xBC, 0x9C, 0xC0, 0x0C, 0xF0, 0x10, 0xB2, 0xE0, 0xF7, 0x35, 0xC2, 0x0D, 0x70, 0x80, 0x0A, 0x00,
+    0x0C, 0x37, 0xCA, 0xBA, 0xF9, 0x58, 0x0D, 0xDE, 0x85, 0x8D, 0x3C, 0x00, 0x0C, 0xB7, 0xAA, 0xF5,
+    0x5B, 0x29, 0x60, 0x0A, 0x2B, 0x35, 0x15, 0x98, 0x0D, 0x97, 0xC3, 0x60, 0x96, 0xEE, 0xDE, 0x1C,
+    0x60, 0x0D, 0x97, 0xC3, 0x58, 0xEA, 0x7A, 0xAA, 0xBE, 0x10, 0xA9, 0xFB, 0x3D, 0x9E, 0xC7, 0x56,
+    0xEE, 0xDE, 0x1C, 0x60, 0xE4, 0xB2, 0xFC, 0x90, 0xDD, 0xFB, 0x1D, 0x8E, 0xC6, 0xEE, 0xD3, 0xD5,
+    0x55, 0x55, 0x76, 0x60, 0xD3, 0xD5, 0x55, 0x55, 0x7D, 0x30, 0xD3, 0xC1, 0x04, 0x1C, 0x40, 0x17,
+    0xF9, 0xFC, 0x97, 0xF9, 0xC4, 0xD3, 0xD5, 0x55, 0x55, 0x42, 0xFE, 0x3D, 0x0D, 0x3D, 0x0F, 0xE3,
+    0x80, 0x85, 0x55, 0x55, 0xF4, 0xC0, 0xD3, 0xD8, 0xA1, 0x26, 0x9C, 0xCB, 0xC3, 0x77, 0x2A, 0x65,
+    0xC0, 0xD3, 0xD0, 0xB9, 0xB3, 0x42, 0x16, 0xED, 0x04, 0x1A, 0x70, 0xD3, 0xEC, 0x75, 0x36, 0x34,
+    0xE0, 0xD3, 0xD0, 0xA1, 0x43, 0x4E, 0xDD, 0xA1, 0x42, 0x85, 0xBB, 0x00, 0xD3, 0xC1, 0x04, 0x1A,
+    0x70, 0xD3, 0xD4, 0xA9, 0x53, 0x98, 0xDD, 0xA1, 0x42, 0x85, 0xB3, 0x00, 0x82, 0x0D, 0x3C, 0x10,
+    0xE8, 0x51, 0x51, 0x51, 0x69, 0x80, 0xF7, 0x3B, 0x1A, 0x7E, 0xC7, 0xB8, 0xE2, 0xF7, 0x28, 0x5C,
+    0xE2, 0xE0, 0xD3, 0x88, 0x5A, 0x71, 0x00, 0xE8, 0x50, 0xA1, 0xA7, 0xD3, 0x8B, 0x4E, 0x2D, 0x38,
+    0xD3, 0x8B, 0x4E, 0x2D, 0x39, 0xE6, 0x83, 0x4F, 0x45, 0x45, 0x66, 0xD3, 0xD1, 0x51, 0x59, 0xB4,
+    0xE0, 0xD3, 0xD1, 0x51, 0x59, 0x80, 0xD9, 0xA1, 0x55, 0x55, 0x6E, 0xC0, 0xD3, 0xD0, 0xDD, 0xA1,
+    0x6E, 0xC0, 0xE6, 0xAA, 0xDE, 0x0A, 0x9A, 0x70, 0x1A, 0xEA, 0xEB, 0x2C, 0xCB, 0x7A, 0xAA, 0xAE,
+    0xCC, 0xCB, 0xDD, 0x5D, 0x51, 0x80, 0xCB, 0xC9, 0x27, 0x50, 0x16, 0x1E, 0x56, 0x5C, 0x40, 0xC3,
+    0x5D, 0x5D, 0x5D, 0x60, 0xEA, 0xF6, 0x32, 0xF6, 0x3A, 0xB8, 0x95, 0x75, 0x75, 0x46, 0xCB, 0x8D,
+    0x62, 0x86, 0x5C, 0xCB, 0xC3, 0x76, 0x2A, 0x65, 0xC0, 0xCB, 0xD8, 0xEA, 0xE0, 0x16, 0x1A, 0x4C,
+    0xB8, 0xCB, 0xD0, 0xB1, 0x43, 0x2E, 0xCB, 0xD8, 0xB1, 0x97, 0xC3, 0x4A, 0x95, 0x86, 0xCB, 0xC9,
+    0x26, 0x5C, 0xCB, 0xDC, 0xA0, 0xC3, 0x4A, 0x95, 0x46, 0x93, 0x2F, 0x20, 0xEA, 0x59, 0x59, 0x65,
+    0x80, 0xC1, 0x2D, 0x97, 0x96, 0xC0, 0x95, 0x46, 0xB1, 0x46, 0x94, 0xCB, 0x8B, 0x2E, 0x79, 0x80,
+    0xEA, 0x58, 0xB1, 0x97, 0xCB, 0x8B, 0x2E, 0x2C, 0xB8, 0xCB, 0x8B, 0x2E, 0x2C, 0xB9, 0xE6, 0x93,
+    0x2F, 0x64, 0x30, 0xCB, 0xD9, 0x0D, 0x97, 0xCB, 0xD9, 0x59, 0x0C, 0xA3, 0x4A, 0xBA, 0xC3, 0x00,
+    0xCB, 0xD8, 0xC3, 0x4A, 0xC3, 0x00, 0xA2, 0xBB, 0x5C, 0xCB, 0x80,
+};
+const uint8_t ArialMT_Plain_10_UA_huffman[] PROGMEM = {
+    0x00, 0x01, 0x01, 0x04, 0x07, 0x02, 0x09, 0x0A, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x01, 0x03, 0x08, 0x20, 0x40, 0x48, 0x80, 0xA0, 0xC0, 0xE0, 0xF8, 0x10, 0xF0, 0x0F,
+    0x18, 0x28, 0x30, 0x38, 0x60, 0x88, 0x90, 0xC8, 0x04, 0x06, 0x0A, 0x50, 0x68, 0x70, 0x78, 0xA8,
+    0xB0, 0xE8, 0x05, 0x07, 0x09, 0x58, 0xB8, 0xD0, 0xFC, 0x0B, 0x0C,
+};
+const CompressedFont ArialMT_Plain_10_UA = {ArialMT_Plain_10_UA_header, ArialMT_Plain_10_UA_data, ArialMT_Plain_10_UA_huffman};
+
+const uint8_t ArialMT_Plain_16_UA_header[] PROGMEM = {
+    0x10, 0x13, 0x20, 0xE0, 0xFF, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x08, 0x05, 0x00, 0x03, 0x0D, 0x06,
+    0x00, 0x07, 0x1A, 0x09, 0x00, 0x16, 0x17, 0x09, 0x00, 0x24, 0x26, 0x0E, 0x00, 0x38, 0x1D, 0x0B,
+    0x00, 0x47, 0x04, 0x03, 0x00, 0x49, 0x0C, 0x05, 0x00, 0x4F, 0x0B, 0x05, 0x00, 0x55, 0x0D, 0x06,
+    0x00, 0x5C, 0x17, 0x09, 0x00, 0x64, 0x09, 0x04, 0x00, 0x67, 0x0B, 0x05, 0x00, 0x6A, 0x08, 0x04,
+    0x00, 0x6C, 0x0A, 0x04, 0x00, 0x72, 0x17, 0x09, 0x00, 0x7D, 0x11, 0x09, 0x00, 0x82, 0x17, 0x09,
+    0x00, 0x8E, 0x17, 0x09, 0x00, 0x99, 0x17, 0x09, 0x00, 0xA4, 0x17, 0x09, 0x00, 0xB1, 0x17, 0x09,
+    0x00, 0xBF, 0x16, 0x09, 0x00, 0xC8, 0x17, 0x09, 0x00, 0xD5, 0x17, 0x09, 0x00, 0xE2, 0x05, 0x04,
+    0x00, 0xE4, 0x06, 0x04, 0x00, 0xE7, 0x17, 0x09, 0x00, 0xF1, 0x17, 0x09, 0x00, 0xFA, 0x17, 0x09,
+    0x01, 0x04, 0x16, 0x09, 0x01, 0x0E, 0x2F, 0x10, 0x01, 0x30, 0x1D, 0x0B, 0x01, 0x3E, 0x1D, 0x0B,
+    0x01, 0x4C, 0x20, 0x0C, 0x01, 0x5A, 0x20, 0x0C, 0x01, 0x68, 0x1D, 0x0B, 0x01, 0x74, 0x19, 0x0A,
+    0x01, 0x7F, 0x20, 0x0C, 0x01, 0x90, 0x1D, 0x0B, 0x01, 0x9B, 0x05, 0x03, 0x01, 0x9D, 0x14, 0x08,
+    0x01, 0xA4, 0x1D, 0x0B, 0x01, 0xB1, 0x17, 0x09, 0x01, 0xB8, 0x23, 0x0D, 0x01, 0xC6, 0x1D, 0x0B,
+    0x01, 0xD1, 0x20, 0x0C, 0x01, 0xE0, 0x1C, 0x0B, 0x01, 0xED, 0x20, 0x0C, 0x01, 0xFD, 0x1D, 0x0B,
+    0x02, 0x0C, 0x1D, 0x0B, 0x02, 0x1B, 0x19, 0x09, 0x02, 0x23, 0x1D, 0x0B, 0x02, 0x2D, 0x1C, 0x0B,
+    0x02, 0x39, 0x2B, 0x0F, 0x02, 0x4E, 0x20, 0x0B, 0x02, 0x5E, 0x19, 0x09, 0x02, 0x68, 0x1A, 0x09,
+    0x02, 0x76, 0x0C, 0x04, 0x02, 0x7C, 0x0B, 0x04, 0x02, 0x82, 0x09, 0x04, 0x02, 0x88, 0x14, 0x07,
+    0x02, 0x8F, 0x1B, 0x09, 0x02, 0x98, 0x07, 0x05, 0x02, 0x9A, 0x17, 0x09, 0x02, 0xA5, 0x17, 0x09,
+    0x02, 0xAE, 0x14, 0x08, 0x02, 0xB6, 0x17, 0x09, 0x02, 0xBF, 0x17, 0x09, 0x02, 0xCA, 0x0A, 0x04,
+    0x02, 0xCF, 0x17, 0x09, 0x02, 0xDC, 0x14, 0x08, 0x02, 0xE3, 0x05, 0x04, 0x02, 0xE6, 0x06, 0x03,
+    0x02, 0xEA, 0x17, 0x08, 0x02, 0xF4, 0x05, 0x03, 0x02, 0xF6, 0x23, 0x0D, 0x03, 0x01, 0x14, 0x08,
+    0x03, 0x08, 0x17, 0x09, 0x03, 0x11, 0x17, 0x09, 0x03, 0x1B, 0x18, 0x09, 0x03, 0x26, 0x0D, 0x05,
+    0x03, 0x2A, 0x14, 0x08, 0x03, 0x34, 0x0B, 0x04, 0x03, 0x39, 0x14, 0x08, 0x03, 0x40, 0x13, 0x07,
+    0x03, 0x48, 0x1F, 0x0B, 0x03, 0x54, 0x14, 0x07, 0x03, 0x5D, 0x13, 0x07, 0x03, 0x68, 0x14, 0x07,
+    0x03, 0x72, 0x0F, 0x05, 0x03, 0x7A, 0x06, 0x03, 0x03, 0x7D, 0x0E, 0x05, 0x03, 0x85, 0x17, 0x09,
+    0x03, 0x8D, 0x1D, 0x0C, 0x03, 0x99, 0x26, 0x0E, 0x03, 0xA7, 0x19, 0x09, 0x03, 0xB0, 0x06, 0x04,
+    0x03, 0xB2, 0x10, 0x06, 0x03, 0xB8, 0x09, 0x05, 0x03, 0xBC, 0x26, 0x10, 0x03, 0xC2, 0x16, 0x09,
+    0x03, 0xCA, 0x17, 0x09, 0x03, 0xD4, 0x17, 0x09, 0x03, 0xE3, 0x32, 0x11, 0x03, 0xFC, 0x2F, 0x11,
+    0x04, 0x0C, 0x0B, 0x05, 0x04, 0x10, 0x2C, 0x10, 0x04, 0x1F, 0x1A, 0x09, 0x04, 0x2C, 0x23, 0x0D,
+    0x04, 0x3A, 0x1D, 0x0C, 0x04, 0x44, 0x15, 0x08, 0x04, 0x4F, 0x04, 0x04, 0x04, 0x51, 0x04, 0x04,
+    0x04, 0x53, 0x07, 0x05, 0x04, 0x56, 0x0A, 0x05, 0x04, 0x59, 0x0E, 0x06, 0x04, 0x60, 0x1A, 0x09,
+    0x04, 0x69, 0x2F, 0x10, 0x04, 0x79, 0x1D, 0x0C, 0x04, 0x85, 0x2C, 0x10, 0x04, 0x94, 0x29, 0x0F,
+    0x04, 0xA3, 0x0B, 0x05, 0x04, 0xA7, 0x23, 0x0D, 0x04, 0xB4, 0x14, 0x07, 0x04, 0xBD, 0x14, 0x08,
+    0x04, 0xC6, 0x14, 0x08, 0xFF, 0xFF, 0x00, 0x04, 0x04, 0xCD, 0x1C, 0x0A, 0x04, 0xDD, 0x13, 0x07,
+    0x04, 0xEA, 0x14, 0x08, 0x04, 0xF1, 0x14, 0x09, 0x04, 0xFB, 0x16, 0x08, 0x05, 0x02, 0x06, 0x03,
+    0x05, 0x06, 0x17, 0x09, 0x05, 0x1A, 0x1D, 0x0B, 0x05, 0x28, 0x23, 0x0C, 0x05, 0x3F, 0x20, 0x0C,
+    0x05, 0x4E, 0x14, 0x09, 0x05, 0x56, 0x17, 0x09, 0x05, 0x5E, 0x0B, 0x05, 0x05, 0x61, 0x23, 0x0C,
+    0x05, 0x78, 0x07, 0x03, 0x05, 0x7C, 0x0D, 0x06, 0x05, 0x82, 0x17, 0x09, 0x05, 0x8A, 0x05, 0x03,
+    0x05, 0x8C, 0x05, 0x04, 0x05, 0x8F, 0x10, 0x07, 0x05, 0x95, 0x17, 0x09, 0x05, 0x9E, 0x19, 0x09,
+    0x05, 0xAB, 0x08, 0x05, 0x05, 0xAD, 0x17, 0x09, 0x05, 0xBA, 0x2F, 0x11, 0x05, 0xCF, 0x14, 0x08,
+    0x05, 0xD8, 0x17, 0x09, 0x05, 0xE0, 0x06, 0x03, 0x05, 0xE4, 0x1D, 0x0B, 0x05, 0xF3, 0x14, 0x08,
+    0x05, 0xFD, 0x07, 0x03, 0x06, 0x01, 0x1D, 0x0B, 0x06, 0x0F, 0x1D, 0x0B, 0x06, 0x1B, 0x1D, 0x0B,
+    0x06, 0x29, 0x19, 0x09, 0x06, 0x30, 0x1E, 0x0B, 0x06, 0x3E, 0x1D, 0x0B, 0x06, 0x4A, 0x29, 0x0E,
+    0x06, 0x5D, 0x1A, 0x0A, 0x06, 0x6A, 0x20, 0x0C, 0x06, 0x76, 0x20, 0x0C, 0x06, 0x84, 0x1A, 0x09,
+    0x06, 0x90, 0x1D, 0x0B, 0x06, 0x9A, 0x23, 0x0D, 0x06, 0xA8, 0x1D, 0x0B, 0x06, 0xB3, 0x20, 0x0C,
+    0x06, 0xC2, 0x1D, 0x0B, 0x06, 0xCB, 0x1C, 0x0B, 0x06, 0xD8, 0x20, 0x0C, 0x06, 0xE6, 0x19, 0x09,
+    0x06, 0xEE, 0x1C, 0x0A, 0x06, 0xFB, 0x1D, 0x0B, 0x07, 0x09, 0x20, 0x0B, 0x07, 0x19, 0x21, 0x0C,
+    0x07, 0x24, 0x1A, 0x0A, 0x07, 0x2E, 0x23, 0x0D, 0x07, 0x39, 0x27, 0x0E, 0x07, 0x46, 0x23, 0x0D,
+    0x07, 0x52, 0x26, 0x0E, 0x07, 0x5E, 0x1D, 0x0B, 0x07, 0x68, 0x20, 0x0C, 0x07, 0x77, 0x2C, 0x10,
+    0x07, 0x8A, 0x20, 0x0C, 0x07, 0x9A, 0x17, 0x09, 0x07, 0xA5, 0x17, 0x09, 0x07, 0xB2, 0x17, 0x09,
+    0x07, 0xBD, 0x10, 0x06, 0x07, 0xC2, 0x18, 0x09, 0x07, 0xCD, 0x17, 0x09, 0x07, 0xD8, 0x1D, 0x0A,
+    0x07, 0xE4, 0x11, 0x07, 0x07, 0xED, 0x14, 0x08, 0x07, 0xF6, 0x14, 0x08, 0x08, 0x01, 0x14, 0x07,
+    0x08, 0x09, 0x14, 0x08, 0x08, 0x10, 0x1D, 0x0B, 0x08, 0x1D, 0x14, 0x08, 0x08, 0x24, 0x17, 0x09,
+    0x08, 0x2D, 0x14, 0x08, 0x08, 0x33, 0x17, 0x09, 0x08, 0x3D, 0x14, 0x08, 0x08, 0x45, 0x13, 0x07,
+    0x08, 0x4B, 0x13, 0x07, 0x08, 0x56, 0x23, 0x0D, 0x08, 0x66, 0x14, 0x07, 0x08, 0x6F, 0x1B, 0x09,
+    0x08, 0x78, 0x14, 0x08, 0x08, 0x7F, 0x1D, 0x0B, 0x08, 0x88, 0x21, 0x0B, 0x08, 0x93, 0x1A, 0x0A,
+    0x08, 0x9C, 0x20, 0x0C, 0x08, 0xA6, 0x17, 0x09, 0x08, 0xAE, 0x14, 0x08, 0x08, 0xB7, 0x20, 0x0C,
+    0x08, 0xC3, 0x17, 0x09,
+};
+const uint8_t ArialMT_Plain_16_UA_data[] PROGMEM = {
+    0x03, 0x7F, 0xF5, 0x1F, 0x20, 0x0F, 0x90, 0xBC, 0x2F, 0xF2, 0x63, 0x99, 0xFD, 0x61, 0x78, 0x5F,
+    0xE4, 0xC7, 0x33, 0xFA, 0xC2, 0xF0, 0x1E, 0x5A, 0xB5, 0xF5, 0xA3, 0xE0, 0xFF, 0xFF, 0x34, 0x77,
+    0x39, 0xFA, 0x94, 0xE9, 0x1F, 0x52, 0x32, 0x46, 0x48, 0xFD, 0xEF, 0xAF, 0x39, 0xE8, 0x63, 0x27,
+    0x67, 0xB5, 0x1D, 0xC7, 0x71, 0xDC, 0x7B, 0x40, 0x0E, 0x97, 0x87, 0x53, 0xC6, 0xA8, 0xF8, 0x3C,
+    0x76, 0x78, 0x75, 0x9A, 0x9D, 0x66, 0xC0, 0x1F, 0x20, 0x17, 0xF7, 0xBC, 0x31, 0x94, 0x33, 0x10,
+    0xCF, 0xC3, 0x19, 0x5F, 0xDE, 0xD4, 0xFE, 0xC7, 0x69, 0xFD, 0x8D, 0x40, 0x0C, 0xCC, 0xCC, 0xD8,
+    0xE2, 0x66, 0x66, 0x66, 0x01, 0x8C, 0x80, 0x41, 0x04, 0x10, 0x01, 0x20, 0x72, 0x3E, 0xF7, 0x96,
+    0x4E, 0x70, 0x1E, 0x5C, 0x5A, 0xD1, 0x12, 0x89, 0x44, 0xB5, 0xA3, 0xCB, 0x88, 0x02, 0x4A, 0x1A,
+    0x9B, 0xD8, 0x14, 0x96, 0xBC, 0x91, 0xF1, 0x47, 0x7A, 0x36, 0x6B, 0xF0, 0x79, 0x48, 0x14, 0xD5,
+    0xAD, 0x11, 0x54, 0x55, 0xE3, 0x57, 0xD7, 0xA8, 0xE9, 0x7A, 0x8F, 0xB4, 0xFC, 0x8C, 0x42, 0x90,
+    0xD6, 0x1B, 0xD8, 0x80, 0x18, 0xFB, 0x9F, 0xD6, 0x8F, 0x19, 0x78, 0xCB, 0xC6, 0x51, 0xEB, 0x47,
+    0xDE, 0x1E, 0x5C, 0x5A, 0xFA, 0xDE, 0x32, 0xF1, 0x97, 0x8C, 0xB5, 0xF5, 0xA9, 0xF7, 0x80, 0x02,
+    0x08, 0x23, 0xE4, 0xF1, 0xF4, 0xBF, 0x89, 0xCE, 0x1C, 0xBA, 0x5F, 0x3E, 0xA4, 0x55, 0x15, 0x45,
+    0x5F, 0x3E, 0xA7, 0x2E, 0x90, 0x1E, 0x5F, 0x73, 0x5E, 0xA4, 0x6C, 0x8D, 0x91, 0xB3, 0x5E, 0xA7,
+    0x97, 0x10, 0x13, 0x20, 0x13, 0x8C, 0x80, 0x0C, 0xCF, 0xB0, 0xFB, 0x17, 0x85, 0xE1, 0x78, 0x4E,
+    0xA0, 0x17, 0x85, 0xE1, 0x78, 0x5E, 0x17, 0x85, 0xE1, 0x78, 0x13, 0xAA, 0xF0, 0xBC, 0x2F, 0x07,
+    0xD8, 0x7D, 0x86, 0x60, 0x1C, 0x8D, 0x48, 0x23, 0xF7, 0x23, 0x36, 0xB9, 0x3C, 0x80, 0x0F, 0x7B,
+    0x12, 0xA5, 0xDA, 0xFD, 0xF9, 0x6B, 0xEB, 0xCB, 0xC6, 0x73, 0xEF, 0x9C, 0xFB, 0xE7, 0x3E, 0xFA,
+    0x67, 0xE3, 0xFF, 0x39, 0xFD, 0x3E, 0x19, 0xEB, 0x39, 0xEB, 0x4C, 0xB9, 0x6B, 0x95, 0xFF, 0xEC,
+    0x0E, 0x47, 0x4A, 0xFE, 0x97, 0x86, 0x88, 0xD1, 0xE1, 0xA2, 0xFE, 0x93, 0xA4, 0xE4, 0x1B, 0xD9,
+    0x15, 0x45, 0x51, 0x54, 0x55, 0x15, 0x45, 0x5F, 0x3E, 0xA7, 0x2E, 0x90, 0x18, 0xE6, 0x53, 0x56,
+    0xB4, 0x44, 0xA2, 0x51, 0x28, 0x94, 0x4B, 0x5A, 0x29, 0xA8, 0x1B, 0xD9, 0x12, 0x89, 0x44, 0xA2,
+    0x51, 0x28, 0x96, 0xB4, 0x53, 0x56, 0x39, 0x80, 0x1B, 0xD9, 0x15, 0x45, 0x51, 0x54, 0x55, 0x15,
+    0x45, 0x51, 0x54, 0x48, 0x1B, 0xD9, 0x19, 0xA3, 0x34, 0x66, 0x8C, 0xD1, 0x9A, 0x33, 0x40, 0x18,
+    0xE6, 0x53, 0x56, 0xB4, 0x44, 0xA2, 0x51, 0xDC, 0x8E, 0xE6, 0xBD, 0x4A, 0x7F, 0x81, 0xF9, 0x80,
+    0x1B, 0xD8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC9, 0xBD, 0x80, 0x1B, 0xD8, 0x0E, 0xD2, 0x49,
+    0x24, 0x96, 0xFE, 0xF0, 0x1B, 0xD8, 0xD0, 0xCC, 0xC9, 0x7E, 0x09, 0xD1, 0x4E, 0x76, 0xB4, 0x44,
+    0x80, 0x1B, 0xD8, 0x92, 0x49, 0x24, 0x92, 0x40, 0x1B, 0xD9, 0xD8, 0x60, 0x70, 0x3A, 0x4E, 0x47,
+    0x49, 0xC1, 0x83, 0xB0, 0xDE, 0xC0, 0x1B, 0xD9, 0xA9, 0xC8, 0xB8, 0xE0, 0x68, 0x73, 0x94, 0x6F,
+    0x60, 0x18, 0xE6, 0x53, 0x56, 0xB4, 0x44, 0xA2, 0x51, 0x28, 0x96, 0xB4, 0x53, 0x56, 0x39, 0x80,
+    0x1B, 0xD9, 0x19, 0xA3, 0x34, 0x66, 0x8C, 0xD1, 0x9A, 0x33, 0x6B, 0x93, 0xC8, 0x18, 0xE6, 0x53,
+    0x56, 0xB4, 0x44, 0xA2, 0x51, 0xF1, 0x47, 0xC5, 0xAD, 0x14, 0xF0, 0x63, 0xF1, 0x1B, 0xD9, 0x19,
+    0xA3, 0x34, 0x66, 0x8C, 0xD1, 0xF9, 0x91, 0xFA, 0x1A, 0xFA, 0xDE, 0x52, 0x1C, 0xB5, 0x7C, 0xE8,
+    0x8A, 0xA2, 0xA8, 0xAA, 0x3B, 0x91, 0xDC, 0xD7, 0xA9, 0x4E, 0x90, 0x82, 0x08, 0x20, 0xDE, 0xC8,
+    0x20, 0x82, 0x00, 0x1B, 0xF1, 0x28, 0x49, 0x24, 0x92, 0x49, 0x46, 0xFC, 0x40, 0x1C, 0xE7, 0x90,
+    0xF4, 0x9C, 0xE7, 0x23, 0x9C, 0xF4, 0xBC, 0x8E, 0x70, 0xE7, 0x3C, 0xB2, 0x3E, 0xF3, 0x91, 0xD2,
+    0xBF, 0x07, 0x81, 0x07, 0x81, 0x7E, 0x07, 0x49, 0xC8, 0xFB, 0xDE, 0x59, 0x39, 0xC0, 0x4A, 0x28,
+    0xD7, 0x9D, 0xCB, 0x45, 0xF3, 0x32, 0x5F, 0x37, 0x2F, 0x53, 0x5D, 0x51, 0x42, 0x40, 0x83, 0xB0,
+    0x92, 0xF9, 0x1F, 0xC9, 0x7C, 0x92, 0x76, 0x10, 0x4A, 0x39, 0x23, 0xF6, 0xA3, 0x64, 0x7C, 0x1E,
+    0x32, 0xFE, 0x32, 0xE7, 0x94, 0x48, 0x1B, 0xF9, 0xF0, 0x86, 0x70, 0xCC, 0xE7, 0x3C, 0xB2, 0x3E,
+    0xF3, 0x90, 0x86, 0x70, 0xCF, 0x7F, 0x3E, 0x00, 0x64, 0xC1, 0xD8, 0x41, 0xD8, 0x60, 0x64, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10, 0x6A, 0x0F, 0xD6, 0xBE, 0xC9, 0xD9, 0x3B,
+    0x27, 0xB9, 0x3D, 0x4B, 0xD8, 0x1B, 0xD9, 0x7A, 0x26, 0x53, 0x29, 0x95, 0xE8, 0x71, 0x0E, 0x2B,
+    0xD1, 0x32, 0x99, 0x4C, 0xAF, 0x40, 0x0E, 0x2B, 0xD1, 0x32, 0x99, 0x4C, 0xAF, 0x46, 0xF6, 0x0E,
+    0x2B, 0xFB, 0x13, 0xB2, 0x76, 0x4E, 0xCB, 0xFB, 0x0F, 0xCE, 0x93, 0xEB, 0x67, 0x79, 0xDE, 0x0E,
+    0x39, 0x5E, 0x99, 0xCC, 0xE7, 0x33, 0x9C, 0xCE, 0x77, 0xA6, 0x58, 0xF3, 0x1B, 0xD9, 0x72, 0x49,
+    0x24, 0xBD, 0x80, 0x1F, 0x4B, 0x00, 0x33, 0xFA, 0x79, 0xE4, 0x1B, 0xD8, 0x83, 0x43, 0xD0, 0x7F,
+    0x92, 0xF4, 0x4C, 0x80, 0x1B, 0xD8, 0x18, 0xB2, 0xE4, 0x92, 0x49, 0x7B, 0x2E, 0x49, 0x24, 0x97,
+    0xB0, 0x18, 0xB2, 0xE4, 0x92, 0x49, 0x7B, 0x00, 0x0E, 0x2B, 0xD1, 0x32, 0x99, 0x4C, 0xAF, 0x43,
+    0x88, 0x18, 0xF3, 0xE1, 0x7A, 0x26, 0x53, 0x29, 0x95, 0xE8, 0x71, 0x0E, 0x2B, 0xD1, 0x32, 0x99,
+    0x4C, 0xAF, 0x46, 0x3C, 0xF8, 0x00, 0x18, 0xB2, 0xE4, 0x92, 0x17, 0xFD, 0x29, 0xD9, 0x3B, 0x27,
+    0x64, 0xEC, 0xBF, 0x68, 0x93, 0xEB, 0x64, 0xCA, 0x64, 0x18, 0xF7, 0x92, 0x49, 0x25, 0x18, 0xB0,
+    0xC0, 0xE0, 0x74, 0x9C, 0x8E, 0x93, 0x83, 0x00, 0xC0, 0xE2, 0x72, 0x3A, 0x4E, 0x0C, 0x0E, 0x07,
+    0x49, 0xC8, 0xE2, 0xC0, 0x99, 0x5E, 0x87, 0x41, 0xA1, 0xD0, 0xBD, 0x13, 0x20, 0xC6, 0x47, 0xA3,
+    0x37, 0x6E, 0x6C, 0x64, 0xED, 0x3D, 0x2C, 0x00, 0x99, 0x4F, 0x24, 0xFE, 0xD4, 0xEC, 0x9F, 0x83,
+    0x12, 0x99, 0x68, 0x68, 0xFA, 0xFF, 0x7C, 0xA1, 0x9C, 0x33, 0x1B, 0xF9, 0xF0, 0x86, 0x70, 0xCF,
+    0xEB, 0xFD, 0xF2, 0x68, 0x68, 0x66, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x64, 0x03, 0xCA, 0xCA,
+    0x4A, 0x92, 0xA4, 0xA9, 0x2A, 0x4A, 0x92, 0xF2, 0xB0, 0x82, 0x08, 0x20, 0xDE, 0xC8, 0xCD, 0x19,
+    0x22, 0xA8, 0xA9, 0x52, 0xA5, 0x4F, 0x70, 0x1B, 0xD9, 0x07, 0xDA, 0x7E, 0x42, 0x08, 0x20, 0x80,
+    0x0C, 0x64, 0x18, 0xB2, 0x4F, 0x89, 0xDE, 0x48, 0x63, 0x20, 0xC6, 0x40, 0x01, 0x20, 0x00, 0x48,
+    0x00, 0x12, 0x12, 0x49, 0x26, 0xFE, 0x7C, 0x24, 0x92, 0x40, 0x13, 0x29, 0x94, 0xCB, 0x7F, 0x3E,
+    0x13, 0x29, 0x94, 0xC8, 0x7D, 0x8C, 0x71, 0x53, 0xFC, 0xDA, 0xFE, 0x08, 0xFC, 0x11, 0xF8, 0x23,
+    0xF0, 0x6B, 0x40, 0xFA, 0x91, 0x92, 0x32, 0x47, 0xFC, 0x3E, 0xBE, 0xA3, 0x83, 0xCB, 0xDA, 0xE7,
+    0xEE, 0x3B, 0x8E, 0xE3, 0xDA, 0x0F, 0x69, 0xDC, 0x77, 0x1D, 0xC7, 0xB4, 0x49, 0x2D, 0xFD, 0xE8,
+    0x20, 0x82, 0x08, 0x37, 0xB1, 0x52, 0xA5, 0x4A, 0x95, 0x2A, 0x7B, 0x80, 0x0D, 0x0E, 0x85, 0xE8,
+    0x1B, 0xD8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC9, 0xBD, 0x8A, 0x95, 0x2A, 0x54, 0xA9, 0x53, 0xDC, 0x1B,
+    0xD8, 0xC8, 0xC9, 0xFD, 0x33, 0x7E, 0xFD, 0x1A, 0xC2, 0x3B, 0x11, 0x20, 0x82, 0x08, 0x20, 0xDE,
+    0xC8, 0xCD, 0x19, 0x23, 0x24, 0x64, 0x64, 0x64, 0x7F, 0x20, 0x1B, 0xD8, 0x92, 0x49, 0x31, 0xC1,
+    0x24, 0x92, 0xDE, 0xC0, 0xD4, 0xDE, 0xCF, 0x99, 0xF1, 0x3E, 0x24, 0xB3, 0xBF, 0x9F, 0x00, 0x1D,
+    0xA0, 0x1D, 0xA0, 0xED, 0x07, 0x68, 0x1D, 0xA0, 0xED, 0x0E, 0x0B, 0xFA, 0x57, 0xF4, 0x9C, 0x00,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x03, 0xCA, 0xCA, 0x4A, 0x92, 0xA4, 0xA9,
+    0x2A, 0x4A, 0x92, 0xF2, 0xB0, 0x02, 0x08, 0x37, 0xC9, 0x04, 0x03, 0x7C, 0x9C, 0xE7, 0x90, 0xC9,
+    0xE4, 0x73, 0x9B, 0xE4, 0x49, 0x2C, 0x7B, 0xD2, 0x49, 0x24, 0x98, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+    0xFE, 0xE7, 0x68, 0x17, 0xA1, 0xD0, 0x68, 0x18, 0xB1, 0xA1, 0xA1, 0xA1, 0xA3, 0x16, 0x36, 0x36,
+    0x36, 0x36, 0x3B, 0x40, 0x18, 0xB1, 0xA3, 0x5D, 0x11, 0xD0, 0xC5, 0x13, 0x20, 0xD4, 0xDE, 0xCF,
+    0x99, 0xF1, 0x3E, 0x24, 0x97, 0xB0, 0x18, 0xB1, 0x24, 0x98, 0xE0, 0x96, 0x2C, 0x1C, 0xE7, 0x29,
+    0x7F, 0x3A, 0xB3, 0xFE, 0x0C, 0xF9, 0xD9, 0xFA, 0x1F, 0xCF, 0x27, 0x23, 0x9C, 0xC6, 0x48, 0xF4,
+    0x67, 0xAF, 0x6E, 0x7A, 0xE3, 0x2D, 0x7B, 0x51, 0xE9, 0x60, 0x0E, 0xD2, 0x49, 0x24, 0x96, 0xFE,
+    0xF0, 0x13, 0xF9, 0x57, 0xD1, 0x30, 0x98, 0x5F, 0x44, 0xFE, 0x50, 0x1B, 0xD9, 0x04, 0x10, 0x41,
+    0x07, 0x30, 0x1B, 0xFF, 0xF7, 0x00, 0x7F, 0xD3, 0xC3, 0xF2, 0x65, 0xF4, 0xD7, 0x3F, 0x1D, 0x73,
+    0x8F, 0x5E, 0x71, 0xFB, 0xF3, 0xEC, 0xFF, 0xCC, 0x9E, 0xA0, 0x1B, 0xD9, 0x15, 0x7D, 0xB5, 0x45,
+    0x5F, 0x6D, 0x51, 0x54, 0x55, 0x15, 0x44, 0x80, 0xC7, 0x32, 0x9A, 0xB5, 0xA3, 0xE9, 0xFE, 0x8E,
+    0xBE, 0xF7, 0x5F, 0x7B, 0xAF, 0xBD, 0xD7, 0xDE, 0xEF, 0xD9, 0xAD, 0x14, 0xD5, 0x8E, 0x60, 0x18,
+    0xE6, 0x53, 0xEE, 0x6B, 0xEB, 0x45, 0x51, 0x54, 0x55, 0x12, 0x89, 0x6B, 0x45, 0x35, 0x0D, 0x0E,
+    0x85, 0xE8, 0x68, 0x74, 0x2F, 0x40, 0x17, 0x2E, 0x5C, 0xB9, 0x72, 0xE5, 0xF9, 0x80, 0x41, 0x04,
+    0x10, 0xC7, 0x32, 0x9A, 0xB5, 0xA3, 0xFF, 0x7F, 0x17, 0x5D, 0x5D, 0x75, 0x75, 0xFC, 0x1D, 0x7F,
+    0x83, 0xE9, 0xDE, 0xD6, 0x8A, 0x6A, 0xC7, 0x30, 0xCC, 0xDE, 0xCC, 0xC0, 0x1D, 0x87, 0x79, 0xDE,
+    0x76, 0x00, 0x0A, 0x95, 0x2A, 0xF2, 0xFC, 0x4A, 0x95, 0x2A, 0x1B, 0xD8, 0x1F, 0x4B, 0x00, 0x18,
+    0xB2, 0x49, 0x24, 0xF9, 0x00, 0x18, 0xF3, 0xE0, 0xA1, 0x24, 0x92, 0x51, 0x8B, 0x00, 0xFA, 0x9B,
+    0x9B, 0xE4, 0xDF, 0x26, 0xFE, 0x7C, 0x20, 0x83, 0x7F, 0x3E, 0x10, 0x01, 0x98, 0x0E, 0x2B, 0xFB,
+    0x1F, 0x1D, 0x93, 0xB3, 0xE3, 0xB2, 0xFE, 0xC3, 0xF3, 0x80, 0x1B, 0xD9, 0x43, 0x03, 0x23, 0xD0,
+    0x41, 0xAB, 0x7B, 0x05, 0xFF, 0x52, 0x7A, 0xD3, 0xD6, 0x9E, 0xB4, 0xF5, 0xAF, 0xFA, 0x80, 0x0E,
+    0x2B, 0xFB, 0x13, 0xB2, 0x76, 0x5E, 0x87, 0xDC, 0x02, 0xF4, 0x3A, 0x0D, 0x17, 0xA1, 0xD0, 0x68,
+    0x33, 0xFA, 0x79, 0xE4, 0x1C, 0xB5, 0x7C, 0xE8, 0x8A, 0xA2, 0xA8, 0xAA, 0x3B, 0x91, 0xDC, 0xD7,
+    0xA9, 0x4E, 0x90, 0x17, 0xFD, 0x29, 0xD9, 0x3B, 0x27, 0x64, 0xEC, 0xBF, 0x68, 0xD4, 0xC5, 0x9A,
+    0x80, 0x0E, 0x47, 0x4A, 0xFE, 0x97, 0x86, 0x88, 0xD1, 0xE1, 0xA2, 0xFE, 0x93, 0xA4, 0xE4, 0x1B,
+    0xD9, 0x15, 0x45, 0x51, 0x54, 0x55, 0x15, 0x45, 0x51, 0x53, 0xDC, 0x1B, 0xD9, 0x15, 0x45, 0x51,
+    0x54, 0x55, 0x15, 0x45, 0x5F, 0x3E, 0xA7, 0x2E, 0x90, 0x1B, 0xD9, 0x04, 0x10, 0x41, 0x04, 0x10,
+    0x63, 0x83, 0x91, 0xFB, 0x9B, 0xFC, 0x11, 0x28, 0x94, 0x4A, 0x25, 0xBD, 0x8C, 0x70, 0x1B, 0xD9,
+    0x15, 0x45, 0x51, 0x54, 0x55, 0x15, 0x45, 0x51, 0x54, 0x48, 0x8E, 0xC6, 0xB0, 0xE5, 0xA2, 0xF9,
+    0x99, 0x19, 0x37, 0xB1, 0x91, 0x92, 0xF9, 0xB9, 0x68, 0xD6, 0x11, 0xD8, 0x89, 0x14, 0xD5, 0xAD,
+    0x11, 0x28, 0xAA, 0x2A, 0xF1, 0xEE, 0x78, 0x77, 0x1E, 0xD0, 0x1B, 0xD8, 0xEC, 0x20, 0xD0, 0xCC,
+    0xC9, 0x72, 0x4E, 0xC3, 0x7B, 0x00, 0x1B, 0xD8, 0xEC, 0x21, 0x96, 0x8C, 0xF3, 0x67, 0x93, 0xFA,
+    0x15, 0x3B, 0x0D, 0xEC, 0x1B, 0xD8, 0xC8, 0xC9, 0x7C, 0xDC, 0xB4, 0x6B, 0x08, 0xEC, 0x44, 0x80,
+    0x49, 0x2D, 0xFD, 0xE8, 0x20, 0x82, 0x08, 0x20, 0xDE, 0xC0, 0x1B, 0xD9, 0xD8, 0x60, 0x70, 0x3A,
+    0x4E, 0x47, 0x49, 0xC1, 0x83, 0xB0, 0xDE, 0xC0, 0x1B, 0xD8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+    0xC9, 0xBD, 0x80, 0x18, 0xE6, 0x53, 0x56, 0xB4, 0x44, 0xA2, 0x51, 0x28, 0x96, 0xB4, 0x53, 0x56,
+    0x39, 0x80, 0x1B, 0xD9, 0x04, 0x10, 0x41, 0x04, 0x10, 0x6F, 0x60, 0x1B, 0xD9, 0x19, 0xA3, 0x34,
+    0x66, 0x8C, 0xD1, 0x9A, 0x33, 0x6B, 0x93, 0xC8, 0x18, 0xE6, 0x53, 0x56, 0xB4, 0x44, 0xA2, 0x51,
+    0x28, 0x94, 0x4B, 0x5A, 0x29, 0xA8, 0x82, 0x08, 0x20, 0xDE, 0xC8, 0x20, 0x82, 0x00, 0x1C, 0xE7,
+    0x29, 0x5E, 0xA7, 0xF0, 0x39, 0xCF, 0x42, 0xF9, 0x39, 0x1C, 0xE0, 0x17, 0xF4, 0xA6, 0x14, 0xD5,
+    0x4D, 0x5B, 0xD9, 0x4D, 0x54, 0xD5, 0x30, 0xBF, 0xA4, 0x4A, 0x28, 0xD7, 0x9D, 0xCB, 0x45, 0xF3,
+    0x32, 0x5F, 0x37, 0x2F, 0x53, 0x5D, 0x51, 0x42, 0x40, 0x1B, 0xD8, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x6F, 0x63, 0x1C, 0x00, 0x1B, 0xF0, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x6F, 0x60, 0x1B, 0xD8,
+    0x92, 0x49, 0x25, 0xBD, 0x89, 0x24, 0x92, 0x5B, 0xD8, 0x1B, 0xD8, 0x92, 0x49, 0x25, 0xBD, 0x89,
+    0x24, 0x92, 0x5B, 0xD8, 0xC7, 0x00, 0x82, 0x08, 0x37, 0xB1, 0x52, 0xA5, 0x4A, 0x95, 0x2A, 0x54,
+    0xF7, 0x00, 0x1B, 0xD8, 0xA9, 0x52, 0xA5, 0x4A, 0x95, 0x2A, 0x7B, 0x80, 0x6F, 0x60, 0x1B, 0xD8,
+    0xA9, 0x52, 0xA5, 0x4A, 0x95, 0x2A, 0x7B, 0x80, 0x14, 0xD5, 0xAD, 0x11, 0x28, 0x94, 0x55, 0x15,
+    0x45, 0x5A, 0xFA, 0xD4, 0xFB, 0x98, 0xE6, 0x1B, 0xD8, 0xCC, 0xCC, 0xCD, 0x8E, 0x65, 0x35, 0x6B,
+    0x44, 0x4A, 0x25, 0x12, 0x89, 0x6B, 0x45, 0x35, 0x63, 0x98, 0x03, 0xCA, 0x5A, 0xFA, 0xD1, 0xFA,
+    0x11, 0xF9, 0x91, 0x9A, 0x33, 0x46, 0x68, 0xCD, 0xBD, 0x80, 0x0F, 0xD6, 0xBE, 0xC9, 0xD9, 0x3B,
+    0x27, 0xB9, 0x3D, 0x4B, 0xD8, 0x1E, 0x5C, 0x5F, 0x3A, 0x3B, 0xE5, 0xDF, 0x2E, 0xF9, 0x78, 0xD1,
+    0x1C, 0x40, 0x18, 0xB2, 0x76, 0x4E, 0xC9, 0xD9, 0x3B, 0x27, 0x65, 0xFF, 0x60, 0x18, 0xB2, 0x49,
+    0x24, 0x90, 0x63, 0x27, 0x83, 0x1F, 0x8A, 0x65, 0x32, 0x99, 0x62, 0xC6, 0x32, 0x0E, 0x2B, 0xFB,
+    0x13, 0xB2, 0x76, 0x4E, 0xCB, 0xFB, 0x0F, 0xCE, 0xC5, 0x0E, 0x83, 0x43, 0x46, 0x2C, 0x68, 0x68,
+    0x74, 0x31, 0x44, 0xC8, 0xBD, 0x13, 0x29, 0xD9, 0x3B, 0x27, 0x65, 0xFF, 0x60, 0x18, 0xB1, 0xD8,
+    0x7A, 0x8C, 0xD7, 0xC9, 0x8B, 0x00, 0x18, 0xB2, 0x3B, 0x1A, 0xFA, 0x9A, 0xE6, 0xF9, 0xE4, 0xFA,
+    0x58, 0x18, 0xB1, 0xA1, 0xA1, 0xD0, 0xC5, 0x13, 0x20, 0x4B, 0x1E, 0xF4, 0x92, 0x49, 0x26, 0x2C,
+    0x18, 0xB3, 0x19, 0x1E, 0x83, 0x9C, 0xE4, 0x73, 0x9E, 0x86, 0x32, 0x62, 0xC0, 0x18, 0xB1, 0xA1,
+    0xA1, 0xA1, 0xA3, 0x16, 0x0E, 0x2B, 0xD1, 0x32, 0x99, 0x4C, 0xAF, 0x43, 0x88, 0x18, 0xB2, 0x49,
+    0x24, 0x93, 0x16, 0x18, 0xF3, 0xE1, 0x7A, 0x26, 0x53, 0x29, 0x95, 0xE8, 0x71, 0x0E, 0x2B, 0xD1,
+    0x32, 0x99, 0x4C, 0xAF, 0x40, 0x92, 0x49, 0x31, 0x64, 0x92, 0x48, 0xC6, 0x47, 0xA3, 0x37, 0x6E,
+    0x6C, 0x64, 0xED, 0x3D, 0x2C, 0x00, 0x0E, 0x2B, 0xD1, 0x32, 0x99, 0x5E, 0x8D, 0xFC, 0xF8, 0x5E,
+    0x89, 0x94, 0xCA, 0xF4, 0x38, 0x80, 0x99, 0x5E, 0x87, 0x41, 0xA1, 0xD0, 0xBD, 0x13, 0x20, 0x18,
+    0xB1, 0x24, 0x92, 0x49, 0x2C, 0x58, 0xC7, 0x00, 0x18, 0xE0, 0x68, 0x41, 0x04, 0x31, 0x60, 0x18,
+    0xB1, 0x24, 0x92, 0xC5, 0x89, 0x24, 0x96, 0x2C, 0x18, 0xB1, 0x24, 0x92, 0xC5, 0x89, 0x24, 0x96,
+    0x2C, 0x63, 0x80, 0x12, 0x49, 0x8B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1D, 0xA0, 0x18, 0xB1, 0xB1, 0xB1,
+    0xB1, 0xB1, 0xB1, 0xDA, 0x03, 0x16, 0x18, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xDA, 0x0F, 0xB9,
+    0x7A, 0x27, 0x64, 0xEC, 0xBF, 0xB0, 0xE2, 0x18, 0xB1, 0xA1, 0xA1, 0xC5, 0x7A, 0x26, 0x53, 0x29,
+    0x95, 0xE8, 0x71, 0x17, 0xFF, 0x64, 0xFF, 0x8A, 0x7D, 0x49, 0xD1, 0x3A, 0x27, 0x46, 0x2C,
+};
+const uint8_t ArialMT_Plain_16_UA_huffman[] PROGMEM = {
+    0x01, 0x00, 0x00, 0x02, 0x05, 0x06, 0x03, 0x0E, 0x0E, 0x06, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x40, 0x20, 0x41, 0x7F, 0x80, 0xC0, 0x01, 0x02, 0x04, 0x10, 0x44, 0xF8, 0x03, 0x1F,
+    0x60, 0x0F, 0x18, 0x1B, 0x1C, 0x22, 0x28, 0x30, 0x38, 0x42, 0x48, 0x70, 0x88, 0xE0, 0xFF, 0x06,
+    0x07, 0x0C, 0x21, 0x24, 0x3C, 0x3E, 0x3F, 0x43, 0x50, 0x78, 0x90, 0xC8, 0xF0, 0x05, 0x0A, 0x11,
+    0x1E, 0x45, 0x4F, 0x09, 0x0B, 0x0E, 0x17, 0x1A, 0x23, 0x27, 0x39, 0x3B, 0x58, 0x5C, 0x61, 0x66,
+    0x68, 0x7E, 0x81, 0x82, 0xB8, 0xD0, 0xFB, 0x12, 0x14, 0x19, 0x25, 0x47, 0x5F, 0x63, 0x64, 0x71,
+    0x7C, 0x86, 0x8F, 0xD2, 0xE8, 0xF1, 0xFC,
+};
+const CompressedFont ArialMT_Plain_16_UA = {ArialMT_Plain_16_UA_header, ArialMT_Plain_16_UA_data, ArialMT_Plain_16_UA_huffman};
+
+const uint8_t ArialMT_Plain_24_UA_header[] PROGMEM = {
+    0x18, 0x1C, 0x20, 0xE0, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x13, 0x08, 0x00, 0x07, 0x1A, 0x09,
+    0x00, 0x0F, 0x33, 0x0D, 0x00, 0x2E, 0x2F, 0x0D, 0x00, 0x47, 0x4F, 0x15, 0x00, 0x68, 0x3B, 0x10,
+    0x00, 0x87, 0x0A, 0x05, 0x00, 0x8B, 0x1C, 0x08, 0x00, 0x98, 0x1B, 0x08, 0x00, 0xA5, 0x22, 0x09,
+    0x00, 0xB2, 0x33, 0x0E, 0x00, 0xC5, 0x10, 0x07, 0x00, 0xCA, 0x1B, 0x08, 0x00, 0xD3, 0x0F, 0x07,
+    0x00, 0xD6, 0x1A, 0x07, 0x00, 0xE0, 0x2F, 0x0D, 0x00, 0xF6, 0x23, 0x0D, 0x01, 0x00, 0x2F, 0x0D,
+    0x01, 0x18, 0x2F, 0x0D, 0x01, 0x2E, 0x2F, 0x0D, 0x01, 0x41, 0x2F, 0x0D, 0x01, 0x5A, 0x2F, 0x0D,
+    0x01, 0x73, 0x2E, 0x0D, 0x01, 0x88, 0x2F, 0x0D, 0x01, 0x9F, 0x2F, 0x0D, 0x01, 0xB9, 0x0F, 0x07,
+    0x01, 0xBD, 0x10, 0x07, 0x01, 0xC3, 0x2F, 0x0E, 0x01, 0xD8, 0x2F, 0x0E, 0x01, 0xEF, 0x2E, 0x0E,
+    0x02, 0x04, 0x2E, 0x0D, 0x02, 0x17, 0x5C, 0x18, 0x02, 0x53, 0x3B, 0x0F, 0x02, 0x6C, 0x3B, 0x10,
+    0x02, 0x85, 0x3F, 0x11, 0x02, 0xA3, 0x3F, 0x11, 0x02, 0xBE, 0x3B, 0x10, 0x02, 0xD7, 0x36, 0x0F,
+    0x02, 0xEA, 0x43, 0x13, 0x03, 0x0E, 0x3B, 0x11, 0x03, 0x1E, 0x0F, 0x06, 0x03, 0x23, 0x27, 0x0C,
+    0x03, 0x2F, 0x3F, 0x10, 0x03, 0x48, 0x2F, 0x0D, 0x03, 0x54, 0x43, 0x13, 0x03, 0x6C, 0x3B, 0x11,
+    0x03, 0x80, 0x47, 0x13, 0x03, 0xA2, 0x3A, 0x10, 0x03, 0xBC, 0x48, 0x13, 0x03, 0xE2, 0x3F, 0x11,
+    0x03, 0xFD, 0x3B, 0x10, 0x04, 0x1C, 0x36, 0x0E, 0x04, 0x30, 0x3B, 0x11, 0x04, 0x42, 0x39, 0x0F,
+    0x04, 0x55, 0x5A, 0x17, 0x04, 0x79, 0x3B, 0x0F, 0x04, 0x94, 0x3D, 0x10, 0x04, 0xA8, 0x37, 0x0F,
+    0x04, 0xC7, 0x14, 0x07, 0x04, 0xD0, 0x1B, 0x07, 0x04, 0xDA, 0x18, 0x07, 0x04, 0xE4, 0x2A, 0x0C,
+    0x04, 0xF1, 0x34, 0x0D, 0x04, 0xFE, 0x12, 0x08, 0x05, 0x04, 0x2F, 0x0D, 0x05, 0x1B, 0x33, 0x0E,
+    0x05, 0x2F, 0x2B, 0x0C, 0x05, 0x41, 0x2F, 0x0E, 0x05, 0x55, 0x2F, 0x0D, 0x05, 0x6C, 0x1A, 0x07,
+    0x05, 0x77, 0x30, 0x0E, 0x05, 0x92, 0x2F, 0x0E, 0x05, 0xA0, 0x0F, 0x05, 0x05, 0xA6, 0x10, 0x06,
+    0x05, 0xAE, 0x2F, 0x0C, 0x05, 0xBF, 0x0F, 0x06, 0x05, 0xC4, 0x47, 0x14, 0x05, 0xDA, 0x2F, 0x0E,
+    0x05, 0xE8, 0x2F, 0x0D, 0x05, 0xFC, 0x33, 0x0E, 0x06, 0x11, 0x30, 0x0E, 0x06, 0x26, 0x1E, 0x08,
+    0x06, 0x2E, 0x2B, 0x0C, 0x06, 0x44, 0x1B, 0x07, 0x06, 0x4E, 0x2F, 0x0E, 0x06, 0x5C, 0x2A, 0x0B,
+    0x06, 0x6B, 0x42, 0x11, 0x06, 0x84, 0x2B, 0x0B, 0x06, 0x97, 0x2A, 0x0C, 0x06, 0xA8, 0x2B, 0x0C,
+    0x06, 0xBB, 0x1C, 0x08, 0x06, 0xC8, 0x10, 0x06, 0x06, 0xCE, 0x1B, 0x08, 0x06, 0xDB, 0x33, 0x0E,
+    0xFF, 0xFF, 0x00, 0x12, 0x06, 0xEA, 0x4F, 0x15, 0x07, 0x0A, 0x32, 0x0D, 0x07, 0x1F, 0x0C, 0x05,
+    0x07, 0x23, 0x22, 0x09, 0x07, 0x2F, 0x1C, 0x08, 0x07, 0x37, 0x4B, 0x18, 0x07, 0x43, 0x32, 0x0D,
+    0x07, 0x55, 0x33, 0x0D, 0x07, 0x68, 0x2F, 0x0D, 0x07, 0x85, 0x63, 0x1A, 0x07, 0xAC, 0x5F, 0x19,
+    0x07, 0xCE, 0x17, 0x08, 0x07, 0xD9, 0x5B, 0x18, 0x07, 0xF4, 0x37, 0x0E, 0x08, 0x0D, 0x4F, 0x16,
+    0x08, 0x29, 0x3B, 0x11, 0x08, 0x3A, 0x30, 0x0E, 0x08, 0x4F, 0x0A, 0x05, 0x08, 0x53, 0x0A, 0x05,
+    0x08, 0x57, 0x1A, 0x08, 0x08, 0x5F, 0x1A, 0x08, 0x08, 0x68, 0x1B, 0x08, 0x08, 0x73, 0x33, 0x0D,
+    0x08, 0x84, 0x5F, 0x18, 0xFF, 0xFF, 0x00, 0x12, 0x08, 0xA2, 0x5B, 0x18, 0x08, 0xC0, 0x53, 0x16,
+    0x08, 0xDA, 0x1B, 0x08, 0x08, 0xE5, 0x4B, 0x14, 0x08, 0xFD, 0x2B, 0x0B, 0x09, 0x0F, 0x2F, 0x0E,
+    0x09, 0x21, 0x2F, 0x0D, 0xFF, 0xFF, 0x00, 0x07, 0x09, 0x2F, 0x36, 0x0F, 0x09, 0x4A, 0x2A, 0x0C,
+    0x09, 0x61, 0x27, 0x0C, 0x09, 0x6D, 0x33, 0x0D, 0x09, 0x87, 0x2A, 0x0C, 0x09, 0x96, 0x10, 0x06,
+    0x09, 0x9D, 0x2F, 0x0D, 0x09, 0xBE, 0x3B, 0x10, 0x09, 0xDB, 0x47, 0x12, 0x0A, 0x0B, 0x3F, 0x11,
+    0x0A, 0x2B, 0x27, 0x0D, 0x0A, 0x3F, 0x2F, 0x0E, 0x0A, 0x4F, 0x1B, 0x08, 0x0A, 0x58, 0x47, 0x12,
+    0x0A, 0x84, 0x15, 0x06, 0x0A, 0x8C, 0x1E, 0x0A, 0x0A, 0x99, 0x33, 0x0D, 0x0A, 0xAC, 0x0F, 0x06,
+    0x0A, 0xB1, 0x0F, 0x05, 0x0A, 0xB7, 0x22, 0x0A, 0x0A, 0xC1, 0x2F, 0x0E, 0x0A, 0xD0, 0x32, 0x0D,
+    0x0A, 0xE6, 0x13, 0x08, 0x0A, 0xEB, 0x2F, 0x0D, 0x0B, 0x04, 0x63, 0x1A, 0x0B, 0x2C, 0x2B, 0x0C,
+    0x0B, 0x3F, 0x2F, 0x0D, 0x0B, 0x54, 0x10, 0x06, 0x0B, 0x5C, 0x3B, 0x10, 0x0B, 0x7B, 0x2B, 0x0C,
+    0x0B, 0x91, 0x16, 0x06, 0x0B, 0x99, 0x3B, 0x0F, 0x0B, 0xB2, 0x3B, 0x10, 0x0B, 0xCB, 0x3B, 0x10,
+    0x0B, 0xE4, 0x32, 0x0D, 0x0B, 0xF5, 0x40, 0x10, 0x0C, 0x11, 0x3B, 0x10, 0x0C, 0x2A, 0x57, 0x16,
+    0x0C, 0x4F, 0x37, 0x0F, 0x0C, 0x6B, 0x3B, 0x11, 0x0C, 0x7F, 0x3B, 0x11, 0x0C, 0x98, 0x37, 0x0E,
+    0x0C, 0xAD, 0x37, 0x10, 0x0C, 0xC2, 0x43, 0x13, 0x0C, 0xDA, 0x3B, 0x11, 0x0C, 0xEA, 0x47, 0x13,
+    0x0D, 0x0C, 0x3B, 0x11, 0x0D, 0x20, 0x3A, 0x10, 0x0D, 0x3A, 0x3F, 0x11, 0x0D, 0x58, 0x36, 0x0E,
+    0x0D, 0x6C, 0x36, 0x0F, 0x0D, 0x81, 0x43, 0x12, 0x0D, 0xA1, 0x3B, 0x0F, 0x0D, 0xBC, 0x44, 0x12,
+    0x0D, 0xCF, 0x37, 0x10, 0x0D, 0xE1, 0x53, 0x16, 0x0D, 0xF8, 0x5C, 0x17, 0x0E, 0x12, 0x47, 0x13,
+    0x0E, 0x2B, 0x4B, 0x15, 0x0E, 0x43, 0x3B, 0x10, 0x0E, 0x56, 0x3F, 0x11, 0x0E, 0x76, 0x5B, 0x18,
+    0x0E, 0x9D, 0x3B, 0x11, 0x0E, 0xB7, 0x2F, 0x0D, 0x0E, 0xCE, 0x33, 0x0E, 0x0E, 0xEB, 0x2F, 0x0D,
+    0x0E, 0xFE, 0x22, 0x09, 0x0F, 0x07, 0x34, 0x0E, 0x0F, 0x1C, 0x2F, 0x0D, 0x0F, 0x33, 0x3B, 0x10,
+    0x0F, 0x4C, 0x27, 0x0B, 0x0F, 0x5E, 0x2F, 0x0D, 0x0F, 0x6E, 0x2F, 0x0D, 0x0F, 0x83, 0x2B, 0x0B,
+    0x0F, 0x92, 0x2F, 0x0E, 0x0F, 0xA1, 0x3B, 0x11, 0x0F, 0xB6, 0x2F, 0x0D, 0x0F, 0xC5, 0x2F, 0x0D,
+    0x0F, 0xD9, 0x2F, 0x0D, 0x0F, 0xE6, 0x33, 0x0E, 0x0F, 0xFB, 0x2B, 0x0C, 0x10, 0x0D, 0x26, 0x0B,
+    0x10, 0x18, 0x2A, 0x0C, 0x10, 0x29, 0x4B, 0x14, 0x10, 0x49, 0x2B, 0x0B, 0x10, 0x5C, 0x34, 0x0E,
+    0x10, 0x6B, 0x2B, 0x0D, 0x10, 0x7A, 0x47, 0x13, 0x10, 0x8D, 0x4C, 0x14, 0x10, 0xA3, 0x37, 0x0F,
+    0x10, 0xB5, 0x3B, 0x11, 0x10, 0xC8, 0x2F, 0x0D, 0x10, 0xD7, 0x2B, 0x0C, 0x10, 0xEA, 0x43, 0x12,
+    0x11, 0x03, 0x2B, 0x0D,
+};
+const uint8_t ArialMT_Plain_24_UA_data[] PROGMEM = {
+    0x00, 0x08, 0xAF, 0xDC, 0x8A, 0xFD, 0xC0, 0x08, 0xDA, 0x46, 0xD0, 0x02, 0x36, 0x91, 0xB4, 0x6E,
+    0xEA, 0x37, 0x7E, 0x06, 0xEF, 0x99, 0xD3, 0x81, 0xF3, 0xD6, 0x8E, 0x1D, 0x48, 0xF6, 0x7E, 0x06,
+    0xEF, 0x99, 0xD3, 0x81, 0xF3, 0xFA, 0x11, 0xC3, 0xA9, 0x1E, 0xCE, 0xA3, 0x77, 0x50, 0x06, 0xCB,
+    0x9C, 0x3C, 0x0F, 0x6F, 0x24, 0x77, 0xE6, 0x8C, 0xA5, 0x35, 0x58, 0x46, 0x52, 0x8F, 0x2C, 0x8F,
+    0xD1, 0xDE, 0x63, 0xE2, 0x7E, 0x4D, 0x80, 0x07, 0x70, 0xF1, 0x23, 0x22, 0x20, 0x88, 0x84, 0x65,
+    0x99, 0xE3, 0xE0, 0x77, 0x77, 0x0D, 0x64, 0xE0, 0x74, 0x1D, 0xBD, 0xC6, 0xBF, 0x14, 0x7E, 0x8C,
+    0x91, 0x10, 0x44, 0x11, 0x90, 0xF1, 0x1D, 0xC0, 0x03, 0x60, 0xF1, 0x3F, 0xC7, 0xEE, 0x3F, 0x8F,
+    0xC1, 0x1F, 0xFE, 0x94, 0x7C, 0x25, 0x1F, 0x0C, 0x91, 0xFF, 0xBF, 0x89, 0xC3, 0xFB, 0x4E, 0xBF,
+    0xBC, 0x76, 0x8F, 0x11, 0xFE, 0xA3, 0xEC, 0x08, 0xDA, 0x46, 0xD0, 0x04, 0xF0, 0x34, 0xAB, 0x3B,
+    0xA7, 0x16, 0x2E, 0xB8, 0xB2, 0xF0, 0x7A, 0x80, 0x08, 0x3D, 0x51, 0x65, 0xD8, 0xBA, 0xDD, 0xD3,
+    0x8B, 0x4A, 0xB2, 0x78, 0x00, 0x07, 0xA0, 0x7F, 0x30, 0xEE, 0x23, 0x59, 0x1A, 0xC7, 0x70, 0xFE,
+    0x61, 0xE8, 0x04, 0x58, 0x8B, 0x11, 0x62, 0x2C, 0x45, 0x8F, 0x3E, 0x07, 0x9F, 0x02, 0x2C, 0x45,
+    0x88, 0xB1, 0x16, 0x22, 0xC0, 0x00, 0x27, 0xA8, 0x9C, 0x40, 0x35, 0x0D, 0x43, 0x50, 0xD4, 0x35,
+    0x0D, 0x43, 0x50, 0x00, 0x24, 0x48, 0x24, 0x68, 0x47, 0x03, 0xA6, 0x27, 0xCC, 0x8D, 0x64, 0x58,
+    0x06, 0x9A, 0xCF, 0x9F, 0x03, 0x1E, 0x48, 0xC3, 0x34, 0x5A, 0x51, 0x69, 0x45, 0xA5, 0x18, 0x66,
+    0x63, 0xC8, 0xF9, 0xF0, 0x34, 0xD6, 0x00, 0x05, 0xC7, 0x60, 0xEA, 0x1A, 0x88, 0xAA, 0x45, 0x50,
+    0x07, 0x54, 0x9A, 0xF3, 0x30, 0xE8, 0x8B, 0x7E, 0xF4, 0x5B, 0xF0, 0x45, 0xBF, 0x62, 0x2D, 0xCD,
+    0x1E, 0x59, 0x1C, 0xE4, 0xF1, 0x93, 0xB6, 0x40, 0x07, 0xE4, 0xB9, 0x8E, 0xF3, 0x0E, 0x48, 0xB4,
+    0xA3, 0x29, 0x46, 0x52, 0x8C, 0xA4, 0xF8, 0xC9, 0xFA, 0xFB, 0xCD, 0x9C, 0x06, 0xC0, 0x03, 0xAC,
+    0x6B, 0x27, 0x59, 0xD3, 0xA8, 0xDF, 0xD4, 0x6C, 0xEA, 0x31, 0xEA, 0x45, 0x52, 0x2A, 0x87, 0x50,
+    0xEA, 0x04, 0xDC, 0xF9, 0xEF, 0x47, 0x8F, 0x14, 0x7F, 0xC2, 0x51, 0xEC, 0x94, 0x7B, 0x25, 0x1E,
+    0xC9, 0x47, 0xB2, 0x51, 0xDF, 0xC9, 0x19, 0x70, 0x23, 0x58, 0x07, 0x4D, 0x67, 0xCF, 0x81, 0xFF,
+    0x7F, 0xB4, 0xE7, 0x9A, 0x3B, 0xE5, 0x1D, 0xF2, 0x8E, 0xF9, 0x47, 0x7C, 0xA3, 0x9F, 0x13, 0xDF,
+    0xC0, 0xD5, 0xB4, 0x08, 0xB1, 0x16, 0x22, 0xC4, 0x5B, 0xA2, 0x2D, 0xF3, 0x46, 0x5A, 0xD1, 0xF0,
+    0xB2, 0x3F, 0x29, 0x1F, 0x41, 0x18, 0x91, 0x60, 0x03, 0x61, 0xB3, 0xC4, 0xFD, 0x7D, 0xE8, 0xF8,
+    0xCA, 0x32, 0x94, 0x65, 0x28, 0xCA, 0x51, 0xF1, 0x93, 0xF5, 0xF7, 0x9B, 0x3C, 0x46, 0xC0, 0x07,
+    0xDF, 0xB8, 0xF9, 0xFD, 0xA7, 0xE9, 0xF8, 0x22, 0xDC, 0xD1, 0x6E, 0x68, 0xB7, 0x34, 0x5B, 0x9A,
+    0x3C, 0xBB, 0xCF, 0x7F, 0x81, 0xF3, 0xE0, 0x69, 0x88, 0x00, 0x5E, 0x4B, 0xC8, 0x00, 0x5E, 0x7A,
+    0x97, 0x9C, 0x40, 0x04, 0x09, 0xB1, 0xF6, 0x58, 0xE3, 0x81, 0xC7, 0x03, 0x76, 0xA3, 0x76, 0xA3,
+    0xD5, 0xF9, 0x0B, 0xF5, 0x17, 0xEA, 0x3A, 0xAE, 0x06, 0xED, 0x46, 0xED, 0x46, 0xED, 0x46, 0xED,
+    0x46, 0xED, 0x46, 0xED, 0x46, 0xED, 0x46, 0xED, 0x46, 0xED, 0x46, 0xED, 0x46, 0xED, 0x40, 0x07,
+    0x55, 0xCB, 0xF5, 0x17, 0xEA, 0x3D, 0x5F, 0x90, 0xDD, 0xA8, 0xDD, 0xA8, 0xE3, 0x81, 0xC7, 0x03,
+    0xEC, 0xB1, 0x36, 0x20, 0x07, 0x50, 0xEB, 0x18, 0x91, 0x81, 0x16, 0xFD, 0xA8, 0xB7, 0xEE, 0x47,
+    0x95, 0x91, 0x90, 0xF8, 0x8F, 0x11, 0xD8, 0x04, 0x70, 0x33, 0xA3, 0xC2, 0x70, 0x76, 0x31, 0x75,
+    0xED, 0xD4, 0xF7, 0xF8, 0xF5, 0xBE, 0x3C, 0x7A, 0x9F, 0x5C, 0xF5, 0x47, 0xE5, 0x9B, 0xC7, 0xAE,
+    0x6F, 0x1E, 0xBE, 0x37, 0x8F, 0x5E, 0xEB, 0xC7, 0xB3, 0xC2, 0xF1, 0xF0, 0xAB, 0xC7, 0xFB, 0x7B,
+    0xEE, 0xFC, 0xD3, 0x76, 0x3C, 0x7A, 0x9D, 0x7C, 0xBA, 0x9D, 0x9D, 0xBA, 0x9A, 0x6D, 0xD4, 0xCF,
+    0x1C, 0x05, 0x80, 0x24, 0x68, 0x3B, 0x89, 0xD6, 0x69, 0x89, 0xDD, 0xA9, 0x1A, 0xF5, 0x22, 0xDA,
+    0x91, 0xAF, 0x51, 0xDD, 0xA8, 0xD3, 0x12, 0x75, 0x8E, 0xE1, 0xA0, 0x90, 0x00, 0x8A, 0xA4, 0x55,
+    0x23, 0x29, 0x46, 0x52, 0x8C, 0xA5, 0x19, 0x4A, 0x32, 0x94, 0x65, 0x28, 0xCA, 0x4F, 0x8E, 0x45,
+    0x77, 0x9B, 0x3C, 0x46, 0xC0, 0x07, 0x4C, 0x4F, 0x3D, 0xA6, 0xCE, 0xD3, 0x1E, 0x46, 0x1C, 0x51,
+    0x69, 0x45, 0xA5, 0x16, 0x94, 0x5A, 0x51, 0x69, 0x45, 0xA4, 0xC3, 0x89, 0x8F, 0x23, 0xAF, 0xB4,
+    0xF4, 0xF5, 0x00, 0x00, 0x8A, 0xA4, 0x55, 0x22, 0xD2, 0x8B, 0x4A, 0x2D, 0x28, 0xB4, 0xA2, 0xD2,
+    0x8B, 0x4A, 0x2D, 0x28, 0xC3, 0x89, 0x8F, 0x23, 0xAF, 0x79, 0xE7, 0xB4, 0xE9, 0x88, 0x00, 0x8A,
+    0xA4, 0x55, 0x23, 0x29, 0x46, 0x52, 0x8C, 0xA5, 0x19, 0x4A, 0x32, 0x94, 0x65, 0x28, 0xCA, 0x51,
+    0x94, 0xA3, 0x29, 0x46, 0x52, 0x8B, 0x48, 0x00, 0x8A, 0xA4, 0x55, 0x23, 0x22, 0x32, 0x23, 0x22,
+    0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x2C, 0x07, 0x4C, 0x4F, 0x3D, 0xA6, 0xCE,
+    0xD3, 0x1E, 0x46, 0x1C, 0x51, 0x87, 0x14, 0x5A, 0x51, 0x69, 0x45, 0xA5, 0x1E, 0x59, 0x23, 0xCB,
+    0x24, 0x7E, 0x8C, 0x8F, 0xD1, 0xDE, 0x7E, 0x9E, 0xF3, 0xFC, 0x78, 0x1F, 0xE1, 0xC0, 0x00, 0x8A,
+    0xA4, 0x55, 0x12, 0x24, 0x48, 0x91, 0x22, 0x44, 0x89, 0x12, 0x45, 0x52, 0x2A, 0x80, 0x00, 0x8A,
+    0xA4, 0x55, 0x00, 0x03, 0x78, 0xF0, 0x19, 0x89, 0x12, 0x24, 0x66, 0x8A, 0xF1, 0x45, 0x70, 0x00,
+    0x8A, 0xA4, 0x55, 0x11, 0x81, 0x36, 0x33, 0x1D, 0x2C, 0x69, 0x81, 0xFF, 0x8C, 0x4E, 0xBD, 0x86,
+    0x3D, 0xA8, 0xC3, 0xC1, 0x16, 0xCD, 0x09, 0x10, 0x00, 0x8A, 0xA4, 0x55, 0x09, 0x12, 0x24, 0x48,
+    0x91, 0x22, 0x44, 0x80, 0x00, 0x8A, 0xA4, 0x55, 0x23, 0x11, 0xC0, 0x69, 0x81, 0x1B, 0x47, 0x98,
+    0x91, 0xE6, 0x46, 0xD3, 0x4C, 0x0E, 0x04, 0x62, 0x45, 0x52, 0x2A, 0x80, 0x00, 0x8A, 0xA4, 0x55,
+    0x18, 0x8E, 0xB1, 0xBC, 0x74, 0x13, 0x62, 0x31, 0x1D, 0x63, 0x78, 0xE4, 0x8A, 0xA4, 0x55, 0x00,
+    0x07, 0x4C, 0x4F, 0x3D, 0xA6, 0xCE, 0xD3, 0x1E, 0x46, 0x1C, 0x51, 0x86, 0x68, 0xB4, 0xA2, 0xD2,
+    0x8B, 0x4A, 0x2D, 0x28, 0xB4, 0xA3, 0x0C, 0xCC, 0x38, 0x98, 0xF2, 0x36, 0x76, 0x9E, 0x7B, 0x4E,
+    0x98, 0x80, 0x00, 0x8A, 0xA4, 0x55, 0x23, 0xCA, 0xC8, 0xF2, 0xB2, 0x3C, 0xAC, 0x8F, 0x2B, 0x23,
+    0xCA, 0xC8, 0xF2, 0xB2, 0x3C, 0xAC, 0x8F, 0x2B, 0x1C, 0xC5, 0x0E, 0xD0, 0x07, 0x4C, 0x4F, 0x3D,
+    0xA6, 0xCE, 0xD3, 0x1D, 0xC6, 0x1C, 0x51, 0x87, 0x14, 0x5A, 0x51, 0x69, 0x45, 0xA5, 0x16, 0xFD,
+    0xE8, 0xB7, 0xEF, 0x46, 0x1D, 0x0C, 0x39, 0x18, 0xF2, 0x36, 0x79, 0x9E, 0x7F, 0xC6, 0xCE, 0x9F,
+    0xA6, 0xC0, 0x00, 0x8A, 0xA4, 0x55, 0x23, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x2B, 0x23, 0x2C,
+    0x11, 0x96, 0xB4, 0x65, 0xB1, 0x1E, 0xDF, 0xBC, 0xF1, 0xE8, 0x77, 0x48, 0x80, 0x03, 0xA8, 0xEC,
+    0xED, 0x3C, 0x79, 0x1E, 0xDE, 0x28, 0xF8, 0x66, 0x8C, 0xA5, 0x19, 0x4A, 0x32, 0x94, 0x65, 0x28,
+    0xCB, 0x24, 0x7E, 0x8F, 0x81, 0xFA, 0x7D, 0xA7, 0x5F, 0x03, 0xAB, 0x60, 0x8B, 0x11, 0x62, 0x2C,
+    0x45, 0x88, 0xB1, 0x16, 0x22, 0xA9, 0x15, 0x48, 0xB1, 0x16, 0x22, 0xC4, 0x58, 0x8B, 0x11, 0x60,
+    0x00, 0x8A, 0xD6, 0x8A, 0xE0, 0x39, 0x0C, 0xC4, 0x89, 0x12, 0x24, 0x48, 0xCC, 0x72, 0x45, 0x70,
+    0x45, 0x6B, 0x81, 0x18, 0x8E, 0x03, 0x41, 0x9E, 0x23, 0x80, 0xD0, 0x66, 0x34, 0x1C, 0x0C, 0xF1,
+    0x34, 0x1C, 0x08, 0xC4, 0x80, 0x8B, 0x11, 0xB4, 0x7C, 0xF0, 0x33, 0xE0, 0x3E, 0x62, 0x47, 0x99,
+    0x1C, 0x0E, 0x98, 0x9E, 0xE2, 0x35, 0x91, 0x62, 0x35, 0x8F, 0x70, 0xE9, 0x89, 0x1C, 0x07, 0x98,
+    0x91, 0xF3, 0x33, 0xE0, 0x7C, 0xF0, 0x46, 0xD2, 0x2C, 0x21, 0x09, 0x45, 0xBA, 0x23, 0x1F, 0x03,
+    0x5E, 0xC3, 0xB7, 0x59, 0xA6, 0x26, 0x76, 0x34, 0xC4, 0xD9, 0xAC, 0xD7, 0xD8, 0x8C, 0x7C, 0x11,
+    0x6E, 0x88, 0x48, 0x80, 0x81, 0x16, 0x18, 0x0E, 0xB1, 0xD8, 0x3C, 0x07, 0x41, 0x34, 0x4D, 0x1D,
+    0x07, 0x80, 0xEC, 0x1A, 0xC8, 0xC0, 0x8B, 0x10, 0x25, 0x16, 0xCD, 0x16, 0xE8, 0x8B, 0x7F, 0x04,
+    0x5B, 0xF6, 0xA2, 0xDE, 0xF4, 0x79, 0x73, 0x47, 0xC2, 0x51, 0xF6, 0xCA, 0x3F, 0x2C, 0xA3, 0xFA,
+    0x65, 0x18, 0xCA, 0x30, 0x94, 0x5A, 0x40, 0x08, 0xAA, 0xDB, 0x15, 0x5B, 0x62, 0xCB, 0xC5, 0x97,
+    0x8B, 0x11, 0xAC, 0x7C, 0xC7, 0x4C, 0x48, 0xE0, 0x34, 0x12, 0x00, 0x8B, 0x2F, 0x16, 0x5E, 0x2A,
+    0xB6, 0xC5, 0x56, 0xD0, 0x04, 0x0C, 0xC7, 0xDE, 0x36, 0x91, 0x81, 0x18, 0x0D, 0xA3, 0xEF, 0x19,
+    0x88, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x08, 0x11,
+    0x62, 0x30, 0x1E, 0x80, 0x07, 0x1D, 0xE7, 0x2F, 0xBC, 0xDD, 0xFC, 0x8B, 0xFE, 0xC2, 0xFF, 0xB0,
+    0xBF, 0x32, 0xFE, 0xD3, 0x7F, 0xB4, 0xE9, 0xE2, 0x67, 0x42, 0x00, 0x00, 0x8A, 0xA4, 0x55, 0x1C,
+    0x77, 0x1B, 0xB8, 0x97, 0x92, 0xF2, 0x5E, 0x4D, 0xF9, 0x9C, 0xB9, 0x19, 0xF0, 0x23, 0x58, 0x04,
+    0xED, 0x33, 0xE0, 0x72, 0xE4, 0x6F, 0xCC, 0xBC, 0x97, 0x92, 0xF2, 0x6F, 0xCC, 0xE5, 0xC8, 0xE3,
+    0xB8, 0x04, 0x6B, 0x33, 0xE0, 0x72, 0xE4, 0x6F, 0xCC, 0xBC, 0x97, 0x92, 0xF2, 0x6E, 0xE2, 0x72,
+    0xDC, 0x8A, 0xA4, 0x55, 0x00, 0x04, 0x6D, 0x33, 0xE0, 0x72, 0xFB, 0x8D, 0xFF, 0x12, 0xFC, 0xCB,
+    0xF3, 0x2F, 0xCC, 0xDF, 0xF1, 0x39, 0x7B, 0x4C, 0xFE, 0xB2, 0x7F, 0x9C, 0x5C, 0x5C, 0x55, 0x22,
+    0xA9, 0x1E, 0xB2, 0x3D, 0x64, 0x7A, 0xC0, 0x04, 0x6B, 0xD4, 0xCF, 0x87, 0x5B, 0x97, 0x2E, 0xC6,
+    0xFC, 0xEE, 0xBC, 0xDD, 0x79, 0xBA, 0xF3, 0x76, 0xEE, 0x3D, 0x8E, 0x3B, 0xBA, 0xDA, 0x56, 0x2D,
+    0x2B, 0x00, 0x00, 0x8A, 0xA4, 0x55, 0x1C, 0x46, 0xE1, 0x71, 0x71, 0x71, 0xBC, 0x74, 0xA3, 0x3A,
+    0x00, 0x8F, 0x95, 0x23, 0xE5, 0x40, 0x17, 0x17, 0x8F, 0x95, 0x6D, 0x8F, 0x95, 0x6B, 0x00, 0x8A,
+    0xA4, 0x55, 0x0C, 0x08, 0xC0, 0x9C, 0x4E, 0x3B, 0x0D, 0xDB, 0xCB, 0xF4, 0x3D, 0x32, 0x20, 0x00,
+    0x8A, 0xA4, 0x55, 0x00, 0x00, 0x69, 0x46, 0x94, 0x6E, 0x1E, 0xA1, 0x71, 0x71, 0xBC, 0x74, 0xA3,
+    0x3A, 0x37, 0x0B, 0x8B, 0x8B, 0x8D, 0xE3, 0xA5, 0x19, 0xD0, 0x00, 0x69, 0x46, 0x94, 0x71, 0x1B,
+    0x85, 0xC5, 0xC5, 0xC6, 0xF1, 0xD2, 0x8C, 0xE8, 0x04, 0xED, 0x33, 0xE0, 0x72, 0xE4, 0x6F, 0xCC,
+    0xBC, 0x97, 0x92, 0xF2, 0x6F, 0xCC, 0xE5, 0xC8, 0xCF, 0x81, 0x3B, 0x40, 0x00, 0x69, 0x5B, 0x5A,
+    0x56, 0xD7, 0x1D, 0xC6, 0xEE, 0x25, 0xE4, 0xBC, 0x97, 0x93, 0x7E, 0x67, 0x2E, 0x46, 0x7C, 0x09,
+    0xD6, 0x04, 0xEB, 0x33, 0xE0, 0x72, 0xE4, 0x6F, 0xCC, 0xBC, 0x97, 0x92, 0xF2, 0x6E, 0xE2, 0x71,
+    0xDC, 0x69, 0x5B, 0x5A, 0x56, 0xD0, 0x00, 0x69, 0x46, 0x94, 0x6E, 0x17, 0x17, 0x17, 0x06, 0x7B,
+    0x8E, 0x9F, 0x69, 0xFE, 0x9F, 0x12, 0xFC, 0xCB, 0xF3, 0x2F, 0xEF, 0x2F, 0xEF, 0x37, 0xFF, 0x23,
+    0x97, 0xB8, 0xE3, 0xDA, 0x5C, 0x5C, 0x57, 0x8A, 0x2A, 0x8B, 0xC9, 0x79, 0x2F, 0x20, 0x00, 0x69,
+    0xC0, 0xD3, 0xC4, 0x66, 0x24, 0x48, 0x91, 0xC4, 0x6E, 0x34, 0xA3, 0x4A, 0x5C, 0x68, 0x33, 0xC0,
+    0x6D, 0x1F, 0x78, 0xCC, 0x7D, 0xE3, 0x69, 0x9E, 0x06, 0x82, 0xE0, 0x6F, 0x1A, 0x58, 0x9D, 0x63,
+    0xDC, 0x33, 0x1E, 0xE2, 0x35, 0x9D, 0x2C, 0x6F, 0x1D, 0x2C, 0x46, 0xB1, 0xEE, 0x19, 0x8F, 0x71,
+    0x3A, 0xCD, 0x2C, 0x6F, 0x7A, 0x60, 0xBC, 0x9E, 0x1D, 0x0C, 0xF7, 0x93, 0xB4, 0x62, 0x46, 0xD3,
+    0x3D, 0xE7, 0x2E, 0x85, 0xE4, 0xF4, 0xC0, 0x06, 0xF1, 0xA5, 0xAE, 0x9C, 0x6E, 0x77, 0x76, 0x1A,
+    0x6B, 0x3A, 0x60, 0x78, 0x99, 0xEB, 0x34, 0x17, 0x02, 0x4B, 0xF4, 0x2F, 0xA1, 0x7F, 0xE0, 0x5F,
+    0xF7, 0x1F, 0xE5, 0xCC, 0xFD, 0xF9, 0x1A, 0x49, 0xE1, 0x25, 0xE4, 0x03, 0x50, 0xD6, 0x57, 0xCB,
+    0x5C, 0x57, 0x4D, 0xB1, 0x65, 0xE2, 0xCB, 0x80, 0x00, 0x8A, 0xAE, 0x11, 0x55, 0xC0, 0x08, 0xB2,
+    0xF1, 0x65, 0xE2, 0xBA, 0x6D, 0x57, 0xFF, 0xF5, 0x9A, 0xC6, 0xA0, 0x04, 0x58, 0x9B, 0x12, 0x24,
+    0x48, 0x8B, 0x11, 0x61, 0x80, 0xC0, 0x60, 0x46, 0x04, 0x58, 0x08, 0xB1, 0x16, 0x22, 0xC4, 0x58,
+    0x8B, 0x11, 0x62, 0x2A, 0x91, 0x54, 0x8C, 0x88, 0xC8, 0x8E, 0xF2, 0x3B, 0xF8, 0xA3, 0xBE, 0x51,
+    0xDF, 0x27, 0x19, 0x33, 0xCC, 0x9F, 0xB4, 0x8E, 0x03, 0x68, 0x00, 0x8A, 0xA4, 0x55, 0x22, 0xC4,
+    0x58, 0xFF, 0xD5, 0x8F, 0xF4, 0xB1, 0xFE, 0x56, 0x3F, 0xC2, 0xC4, 0x58, 0x8B, 0x11, 0x60, 0x02,
+    0x7A, 0x89, 0xC4, 0x00, 0x69, 0x46, 0x94, 0x7F, 0x41, 0x1F, 0x49, 0x1E, 0xB2, 0x2E, 0x2E, 0x02,
+    0x7A, 0x89, 0xC4, 0x00, 0x9E, 0xA2, 0x71, 0x00, 0x02, 0x44, 0x80, 0x00, 0x00, 0x91, 0x20, 0x00,
+    0x00, 0x24, 0x48, 0x06, 0xE1, 0xB8, 0x6E, 0x1B, 0x86, 0xE2, 0x2A, 0xB5, 0xC5, 0x56, 0xB6, 0xE1,
+    0xB8, 0x6E, 0x1B, 0x86, 0xE0, 0x05, 0xE4, 0xBC, 0x97, 0x92, 0xF2, 0x5E, 0x51, 0x55, 0xAE, 0x2A,
+    0xB5, 0xAF, 0x25, 0xE4, 0xBC, 0x97, 0x92, 0xF2, 0x6E, 0xC0, 0xD3, 0x13, 0xE7, 0xB4, 0xFF, 0x8F,
+    0xE6, 0x3E, 0xBF, 0xB8, 0xFA, 0xFD, 0xA8, 0xF6, 0x73, 0x47, 0xB3, 0x9A, 0x3D, 0x9C, 0xD1, 0xEC,
+    0xE6, 0x8F, 0x64, 0x98, 0x71, 0x07, 0x70, 0xF1, 0x23, 0x22, 0x20, 0x8C, 0xB3, 0x3C, 0x74, 0x3B,
+    0xBB, 0x89, 0xC4, 0xE9, 0x63, 0xBB, 0xB9, 0x1A, 0xFC, 0x51, 0xE5, 0x91, 0x10, 0x46, 0x43, 0xC4,
+    0x77, 0x00, 0xEE, 0x1E, 0x24, 0x64, 0x44, 0x11, 0x90, 0xF1, 0x1D, 0xC0, 0x3E, 0xC1, 0x23, 0x34,
+    0x57, 0x8A, 0x2B, 0x82, 0x2C, 0x45, 0x88, 0xB1, 0x16, 0x22, 0xC4, 0x58, 0x8B, 0x11, 0x54, 0x8A,
+    0xA2, 0x64, 0x99, 0x26, 0x49, 0x92, 0x64, 0x99, 0x26, 0x48, 0xEF, 0x23, 0xC4, 0x6C, 0x03, 0xD0,
+    0x46, 0xB3, 0x3F, 0xCE, 0x72, 0xE4, 0x7A, 0xBE, 0xC0, 0x00, 0x8A, 0xA4, 0x55, 0x12, 0x24, 0x48,
+    0x91, 0x22, 0x44, 0x91, 0x54, 0x8A, 0xA2, 0x64, 0x99, 0x26, 0x49, 0x92, 0x64, 0x99, 0x26, 0x48,
+    0xEF, 0x23, 0xC4, 0x6C, 0x00, 0x8A, 0xA4, 0x55, 0x12, 0x24, 0x4D, 0x9F, 0x57, 0x1C, 0x1B, 0xFC,
+    0x31, 0x5F, 0x67, 0x5B, 0xD3, 0x8E, 0xF4, 0x5B, 0xA2, 0x2D, 0x28, 0xB4, 0x00, 0x08, 0xB1, 0x16,
+    0x22, 0xC4, 0x58, 0x8B, 0x11, 0x62, 0x2A, 0x91, 0x54, 0x8C, 0x88, 0xC8, 0x8E, 0xF2, 0x3B, 0xC8,
+    0xEF, 0x23, 0xBC, 0x71, 0x19, 0x89, 0xB1, 0x34, 0x28, 0x00, 0x8A, 0xA4, 0x55, 0x09, 0x12, 0x24,
+    0x48, 0x9D, 0xA4, 0xED, 0x24, 0x48, 0x94, 0x55, 0x22, 0xA8, 0x60, 0x30, 0x22, 0xA9, 0x15, 0x47,
+    0xDC, 0x3E, 0xB1, 0xF4, 0x8F, 0xA5, 0x75, 0xD7, 0x6F, 0x5D, 0xD2, 0xB6, 0xB3, 0xAD, 0x60, 0x06,
+    0xD2, 0x3D, 0x60, 0x08, 0xF5, 0x91, 0xAC, 0x06, 0xD2, 0x3D, 0x60, 0x03, 0x69, 0x1E, 0xB0, 0x08,
+    0xF5, 0x91, 0xAC, 0x00, 0x8F, 0x59, 0x1A, 0xC0, 0x04, 0xE0, 0x67, 0x89, 0x9E, 0x26, 0x78, 0x99,
+    0xE2, 0x4E, 0x00, 0x35, 0x0D, 0x43, 0x50, 0xD4, 0x35, 0x0D, 0x43, 0x50, 0xD4, 0x35, 0x0D, 0x43,
+    0x50, 0xD4, 0x35, 0x00, 0x35, 0x0D, 0x43, 0x50, 0xD4, 0x35, 0x0D, 0x43, 0x50, 0xD4, 0x35, 0x0D,
+    0x43, 0x50, 0xD4, 0x35, 0x0D, 0x43, 0x50, 0xD4, 0x35, 0x0D, 0x43, 0x50, 0xD4, 0x35, 0x0D, 0x43,
+    0x50, 0xD4, 0x00, 0x08, 0xB1, 0x16, 0x22, 0xC4, 0x55, 0x91, 0x56, 0x45, 0x88, 0xB1, 0x16, 0x02,
+    0x2A, 0xC8, 0xAB, 0x23, 0x01, 0xB0, 0x74, 0x11, 0x63, 0xA0, 0xD8, 0x46, 0x04, 0x55, 0x91, 0x56,
+    0x24, 0x48, 0x93, 0x4A, 0x34, 0xF1, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x34, 0xA3, 0x4A, 0x1C,
+    0xC7, 0x31, 0xCC, 0x73, 0x1C, 0xC7, 0xE2, 0x3D, 0xC3, 0xB4, 0x00, 0x7A, 0xBE, 0xC3, 0x97, 0x23,
+    0x3F, 0xCE, 0x46, 0xB1, 0xE8, 0x00, 0x69, 0x46, 0x94, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x03, 0x4A,
+    0x34, 0xA1, 0xCC, 0x73, 0x1C, 0xC7, 0x31, 0xCC, 0x7E, 0x23, 0xDC, 0x3B, 0x40, 0x00, 0x69, 0x46,
+    0x94, 0x7A, 0x3D, 0x08, 0xC3, 0x14, 0x65, 0xF4, 0x23, 0xA6, 0xF2, 0xFC, 0x8B, 0xE6, 0x20, 0x60,
+    0x30, 0x22, 0xA9, 0x15, 0x47, 0xDC, 0x3E, 0xB1, 0xF4, 0x8F, 0xA4, 0x5C, 0x6F, 0x1D, 0x28, 0xCE,
+    0x80, 0x00, 0x69, 0x46, 0x94, 0x24, 0x48, 0x9D, 0xA4, 0xED, 0x24, 0x49, 0xA5, 0x1A, 0x50, 0x08,
+    0xB1, 0x18, 0x8D, 0x92, 0xBF, 0x84, 0xB7, 0x67, 0x93, 0xEA, 0x8F, 0xEE, 0x7D, 0x4E, 0xE7, 0xD5,
+    0x18, 0xB7, 0x67, 0x65, 0xFC, 0x06, 0xC2, 0x31, 0x22, 0xC0, 0x06, 0xF1, 0xA5, 0xAF, 0x19, 0x63,
+    0x76, 0x1D, 0xDD, 0x8F, 0x46, 0x9A, 0xDE, 0x8E, 0x98, 0x3D, 0x1E, 0x27, 0xC7, 0x5A, 0x3E, 0x42,
+    0xE0, 0x03, 0x78, 0xF0, 0x19, 0x89, 0x12, 0x24, 0x66, 0x8A, 0xF1, 0x45, 0x70, 0x07, 0xA7, 0xD4,
+    0x7F, 0x0F, 0xCC, 0x69, 0xB4, 0xDD, 0xD4, 0x5E, 0xE5, 0xEE, 0x5E, 0xE5, 0xEE, 0x6E, 0xEA, 0x34,
+    0xDA, 0x7F, 0x0F, 0xCC, 0x7A, 0x7D, 0x40, 0x00, 0x8A, 0xA4, 0x55, 0x22, 0xC4, 0x58, 0x8B, 0x11,
+    0x62, 0x2C, 0x79, 0xD8, 0xF3, 0xB0, 0x00, 0x8A, 0xF8, 0x70, 0x8A, 0xF8, 0x70, 0x04, 0x60, 0x7E,
+    0xDC, 0x70, 0x78, 0xF5, 0x6B, 0x8F, 0xAF, 0xB3, 0xAA, 0x3E, 0xDB, 0xDE, 0x3B, 0xF7, 0x5E, 0x32,
+    0xE5, 0x78, 0xE7, 0xF0, 0xEC, 0x7E, 0x9F, 0xFE, 0x6B, 0x6A, 0xFF, 0xCE, 0x27, 0x58, 0x00, 0x8A,
+    0xA4, 0x55, 0x23, 0x29, 0x7E, 0xAC, 0xA5, 0xFA, 0xB2, 0x94, 0x65, 0x28, 0xCA, 0x5F, 0xAB, 0x29,
+    0x7E, 0xAC, 0xA5, 0x19, 0x4A, 0x32, 0x94, 0x65, 0x28, 0xB4, 0x80, 0x67, 0x81, 0xA6, 0xB3, 0xB3,
+    0xB0, 0xD5, 0xB8, 0xFC, 0x7E, 0xD3, 0xFD, 0xBF, 0xAD, 0x1E, 0xBF, 0xD8, 0x8F, 0xA3, 0xF0, 0x47,
+    0xD1, 0xF8, 0x23, 0xE8, 0xFC, 0x11, 0xF4, 0x7E, 0x08, 0xFE, 0x9F, 0xDA, 0x7D, 0x3F, 0xF2, 0x3F,
+    0xDF, 0xFF, 0x53, 0x56, 0xE3, 0xB3, 0xB0, 0xD3, 0x59, 0x9E, 0x00, 0x07, 0x4C, 0x4F, 0x3D, 0xA7,
+    0xED, 0xED, 0x3D, 0xFC, 0x8E, 0x7C, 0x51, 0x94, 0xA3, 0x29, 0x46, 0x52, 0x8C, 0xA5, 0x16, 0x94,
+    0x61, 0x99, 0x87, 0x13, 0x5F, 0x81, 0xB3, 0xB4, 0xF4, 0xFA, 0x40, 0x03, 0xD0, 0x46, 0xB3, 0x3F,
+    0xCE, 0x72, 0xE4, 0x7A, 0xBF, 0xA8, 0x8D, 0x66, 0x7F, 0x9C, 0xE5, 0xC8, 0xF5, 0x7D, 0x80, 0x06,
+    0xE1, 0xB8, 0x6E, 0x1B, 0x86, 0xE1, 0xB8, 0x6E, 0x1B, 0x86, 0xE1, 0xD3, 0x13, 0xA6, 0x20, 0x35,
+    0x0D, 0x43, 0x50, 0xD4, 0x35, 0x0D, 0x43, 0x50, 0x67, 0x81, 0xA6, 0xB3, 0xB3, 0xB0, 0xD5, 0xB8,
+    0xC7, 0x91, 0xFE, 0xDF, 0xF4, 0x47, 0xCB, 0xF7, 0x23, 0xFC, 0xF2, 0x47, 0xF9, 0xE4, 0x8F, 0xF3,
+    0xE6, 0x8F, 0x97, 0xBD, 0x1F, 0xFD, 0xFC, 0x0C, 0x3F, 0xE6, 0x63, 0xC8, 0xD5, 0xB8, 0xEC, 0xEC,
+    0x34, 0xD6, 0x67, 0x80, 0xDC, 0x37, 0x08, 0xAA, 0x45, 0x53, 0x70, 0xDC, 0x07, 0x58, 0xFF, 0x71,
+    0x1F, 0x51, 0x1F, 0x51, 0x1F, 0x50, 0xFF, 0x70, 0xEB, 0x04, 0x64, 0x46, 0x44, 0x64, 0x46, 0x44,
+    0x64, 0x79, 0xD1, 0xE7, 0x44, 0x64, 0x46, 0x44, 0x64, 0x46, 0x44, 0x64, 0x00, 0x8A, 0xA4, 0x55,
+    0x00, 0x00, 0x8F, 0x95, 0x23, 0xE5, 0x40, 0x00, 0x69, 0x46, 0x94, 0x5C, 0x5C, 0x5C, 0x8D, 0xA4,
+    0x6D, 0x00, 0x69, 0x5B, 0x5A, 0x56, 0xD3, 0x88, 0x91, 0x22, 0x44, 0x8E, 0x26, 0x94, 0x69, 0x40,
+    0x76, 0x8A, 0x14, 0x45, 0x59, 0x15, 0x64, 0x55, 0x6D, 0x8A, 0xAD, 0xB1, 0x62, 0x2C, 0x45, 0x56,
+    0xD8, 0xAA, 0xDB, 0x16, 0x22, 0xC0, 0x00, 0x04, 0x58, 0x8B, 0x00, 0x04, 0x6D, 0x33, 0xE0, 0x72,
+    0xFB, 0x8F, 0xCD, 0xF1, 0x3E, 0x9E, 0x65, 0xF9, 0x97, 0xE6, 0x7E, 0x6F, 0x89, 0xF7, 0x7B, 0x4C,
+    0xFE, 0xB2, 0x7F, 0x9C, 0x00, 0x8A, 0xA4, 0x55, 0x1A, 0xC7, 0x60, 0xDE, 0x3A, 0x09, 0xB1, 0x18,
+    0x8E, 0xB1, 0xD8, 0x3C, 0x11, 0x54, 0x8A, 0xA0, 0x03, 0x3F, 0x69, 0xD3, 0xFA, 0xCD, 0xFF, 0xDA,
+    0x5F, 0xFB, 0x0B, 0xFF, 0x61, 0xBF, 0xFB, 0x4E, 0x9F, 0xD6, 0x67, 0xED, 0x04, 0xED, 0x33, 0xF1,
+    0x39, 0x7D, 0xC5, 0xF9, 0x97, 0xE6, 0x5F, 0x99, 0x79, 0x37, 0xF1, 0x39, 0x78, 0x1C, 0x6E, 0x00,
+    0x07, 0xAB, 0xEC, 0x39, 0x72, 0x33, 0xFC, 0xE4, 0x6B, 0x3D, 0x5F, 0xD4, 0x72, 0xE4, 0x67, 0xF9,
+    0xC8, 0xD6, 0x3D, 0x00, 0x17, 0x17, 0x8F, 0x95, 0x6D, 0x8F, 0x95, 0x6B, 0x03, 0xA8, 0xEC, 0xED,
+    0x3C, 0x79, 0x1E, 0xDE, 0x28, 0xF8, 0x66, 0x8C, 0xA5, 0x19, 0x4A, 0x32, 0x94, 0x65, 0x28, 0xCB,
+    0x24, 0x7E, 0x8F, 0x81, 0xFA, 0x7D, 0xA7, 0x5F, 0x03, 0xAB, 0x60, 0x06, 0x7B, 0x8E, 0x9F, 0x69,
+    0xFE, 0x9F, 0x12, 0xFC, 0xCB, 0xF3, 0x2F, 0xEF, 0x2F, 0xEF, 0x37, 0xFF, 0x23, 0x97, 0xB8, 0xE3,
+    0xDA, 0x60, 0x30, 0x1A, 0x51, 0xA5, 0x18, 0x0C, 0x00, 0x24, 0x68, 0x3B, 0x89, 0xD6, 0x69, 0x89,
+    0xDD, 0xA9, 0x1A, 0xF5, 0x22, 0xDA, 0x91, 0xAF, 0x51, 0xDD, 0xA8, 0xD3, 0x12, 0x75, 0x8E, 0xE1,
+    0xA0, 0x90, 0x00, 0x8A, 0xA4, 0x55, 0x23, 0x29, 0x46, 0x52, 0x8C, 0xA5, 0x19, 0x4A, 0x32, 0x94,
+    0x65, 0x28, 0xCA, 0x51, 0x94, 0xA3, 0xCB, 0xBC, 0x8F, 0x11, 0xB0, 0x00, 0x8A, 0xA4, 0x55, 0x23,
+    0x29, 0x46, 0x52, 0x8C, 0xA5, 0x19, 0x4A, 0x32, 0x94, 0x65, 0x28, 0xCA, 0x4F, 0x8E, 0x45, 0x77,
+    0x9B, 0x3C, 0x46, 0xC0, 0x00, 0x8A, 0xA4, 0x55, 0x22, 0xC4, 0x58, 0x8B, 0x11, 0x62, 0x2C, 0x45,
+    0x88, 0xB1, 0x16, 0x22, 0xC0, 0x27, 0x59, 0x9E, 0xB3, 0xA0, 0xFE, 0x28, 0xAF, 0x7A, 0x3C, 0x65,
+    0x16, 0x94, 0x5A, 0x51, 0x69, 0x45, 0xA5, 0x16, 0x94, 0x5A, 0x51, 0x54, 0x8A, 0xA1, 0x3A, 0xC9,
+    0xD6, 0x00, 0x8A, 0xA4, 0x55, 0x23, 0x29, 0x46, 0x52, 0x8C, 0xA5, 0x19, 0x4A, 0x32, 0x94, 0x65,
+    0x28, 0xCA, 0x51, 0x94, 0xA3, 0x29, 0x46, 0x52, 0x8B, 0x48, 0x8B, 0x42, 0x2D, 0x28, 0xB7, 0x43,
+    0x1E, 0xD3, 0x67, 0x59, 0xBF, 0x13, 0x3C, 0x09, 0xB1, 0x22, 0x48, 0xAA, 0x45, 0x51, 0x22, 0x44,
+    0xD8, 0xCF, 0x03, 0x7E, 0x26, 0xCE, 0xB3, 0x1E, 0xD4, 0x5B, 0xA2, 0x2D, 0x28, 0xB4, 0x00, 0x07,
+    0x57, 0xA4, 0xD9, 0xDA, 0x63, 0xE0, 0x8C, 0x38, 0xA2, 0xD9, 0xA3, 0x29, 0x46, 0x52, 0x8C, 0xA5,
+    0x19, 0x49, 0xF1, 0xF8, 0x1F, 0xAF, 0xEE, 0x3B, 0x38, 0x0D, 0x80, 0x00, 0x8A, 0xA4, 0x55, 0x0E,
+    0x43, 0xB4, 0x75, 0x91, 0x89, 0x36, 0x3A, 0x0D, 0xE3, 0x60, 0xC4, 0x8A, 0xA4, 0x55, 0x00, 0x00,
+    0x8A, 0xA4, 0x55, 0x0E, 0x4B, 0xBB, 0x5B, 0x9D, 0x6F, 0xAA, 0x31, 0x7D, 0x53, 0x67, 0xD5, 0xD0,
+    0xDD, 0xBC, 0xBE, 0xC1, 0x89, 0x15, 0x48, 0xAA, 0x00, 0x8A, 0xA4, 0x55, 0x12, 0x24, 0x4D, 0x8E,
+    0x38, 0x1E, 0x18, 0x9B, 0x3A, 0xCC, 0x77, 0xA2, 0xDD, 0x11, 0x69, 0x45, 0xA0, 0x3E, 0xC1, 0x23,
+    0x34, 0x57, 0x8A, 0x2B, 0x82, 0x2C, 0x45, 0x88, 0xB1, 0x16, 0x22, 0xC4, 0x58, 0x8B, 0x11, 0x54,
+    0x8A, 0xA0, 0x00, 0x8A, 0xA4, 0x55, 0x23, 0x11, 0xC0, 0x69, 0x81, 0x1B, 0x47, 0x98, 0x91, 0xE6,
+    0x46, 0xD3, 0x4C, 0x0E, 0x04, 0x62, 0x45, 0x52, 0x2A, 0x80, 0x00, 0x8A, 0xA4, 0x55, 0x12, 0x24,
+    0x48, 0x91, 0x22, 0x44, 0x89, 0x12, 0x45, 0x52, 0x2A, 0x80, 0x07, 0x4C, 0x4F, 0x3D, 0xA6, 0xCE,
+    0xD3, 0x1E, 0x46, 0x1C, 0x51, 0x86, 0x68, 0xB4, 0xA2, 0xD2, 0x8B, 0x4A, 0x2D, 0x28, 0xB4, 0xA3,
+    0x0C, 0xCC, 0x38, 0x98, 0xF2, 0x36, 0x76, 0x9E, 0x7B, 0x4E, 0x98, 0x80, 0x00, 0x8A, 0xA4, 0x55,
+    0x22, 0xC4, 0x58, 0x8B, 0x11, 0x62, 0x2C, 0x45, 0x88, 0xB1, 0x16, 0x22, 0xC4, 0x55, 0x22, 0xA8,
+    0x00, 0x8A, 0xA4, 0x55, 0x23, 0xCA, 0xC8, 0xF2, 0xB2, 0x3C, 0xAC, 0x8F, 0x2B, 0x23, 0xCA, 0xC8,
+    0xF2, 0xB2, 0x3C, 0xAC, 0x8F, 0x2B, 0x1C, 0xC5, 0x0E, 0xD0, 0x07, 0x4C, 0x4F, 0x3D, 0xA6, 0xCE,
+    0xD3, 0x1E, 0x46, 0x1C, 0x51, 0x69, 0x45, 0xA5, 0x16, 0x94, 0x5A, 0x51, 0x69, 0x45, 0xA4, 0xC3,
+    0x89, 0x8F, 0x23, 0xAF, 0xB4, 0xF4, 0xF5, 0x00, 0x8B, 0x11, 0x62, 0x2C, 0x45, 0x88, 0xB1, 0x16,
+    0x22, 0xA9, 0x15, 0x48, 0xB1, 0x16, 0x22, 0xC4, 0x58, 0x8B, 0x11, 0x60, 0x08, 0xB1, 0x18, 0x8D,
+    0x92, 0x78, 0x49, 0x9E, 0x44, 0x7F, 0x70, 0xEE, 0x23, 0x13, 0x3B, 0x1E, 0x03, 0x61, 0x18, 0x91,
+    0x60, 0x06, 0x78, 0x1A, 0x6B, 0x3B, 0x3B, 0x0E, 0xAB, 0x9D, 0x7B, 0xCD, 0x5B, 0x8D, 0x5B, 0x91,
+    0x54, 0x8A, 0xA3, 0x56, 0xE3, 0x56, 0xE3, 0xAF, 0x79, 0xD5, 0x73, 0xB3, 0xB0, 0xD3, 0x59, 0x9E,
+    0x00, 0x21, 0x09, 0x45, 0xBA, 0x23, 0x1F, 0x03, 0x5E, 0xC3, 0xB7, 0x59, 0xA6, 0x26, 0x76, 0x34,
+    0xC4, 0xD9, 0xAC, 0xD7, 0xD8, 0x8C, 0x7C, 0x11, 0x6E, 0x88, 0x48, 0x80, 0x00, 0x8A, 0xA4, 0x55,
+    0x09, 0x12, 0x24, 0x48, 0x91, 0x22, 0x44, 0x89, 0x45, 0x52, 0x2A, 0x84, 0xED, 0x27, 0x68, 0x00,
+    0x8F, 0x12, 0x2A, 0xC4, 0x58, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x04, 0x58, 0x8B, 0x22, 0xA9, 0x15,
+    0x40, 0x08, 0xAA, 0x45, 0x50, 0x91, 0x22, 0x44, 0x89, 0x12, 0x25, 0x15, 0x48, 0xAA, 0x12, 0x24,
+    0x48, 0x91, 0x22, 0x44, 0xA2, 0xA9, 0x15, 0x40, 0x08, 0xAA, 0x45, 0x50, 0x91, 0x22, 0x44, 0x89,
+    0x12, 0x25, 0x15, 0x48, 0xAA, 0x12, 0x24, 0x48, 0x91, 0x22, 0x44, 0xA2, 0xA9, 0x15, 0x42, 0x76,
+    0x93, 0xB4, 0x8B, 0x11, 0x62, 0x2C, 0x45, 0x88, 0xB1, 0x15, 0x48, 0xAA, 0x26, 0x49, 0x92, 0x64,
+    0x99, 0x26, 0x49, 0x92, 0x64, 0x99, 0x23, 0xBC, 0x8F, 0x11, 0xB0, 0x00, 0x8A, 0xA4, 0x55, 0x13,
+    0x24, 0xC9, 0x32, 0x4C, 0x93, 0x24, 0xC9, 0x32, 0x4C, 0x91, 0xDE, 0x47, 0x88, 0xD8, 0x00, 0x8A,
+    0xA4, 0x55, 0x00, 0x00, 0x8A, 0xA4, 0x55, 0x13, 0x24, 0xC9, 0x32, 0x4C, 0x93, 0x24, 0xC9, 0x32,
+    0x4C, 0x91, 0xDE, 0x47, 0x88, 0xD8, 0x07, 0xA7, 0xD2, 0x6C, 0xED, 0x35, 0xF8, 0x18, 0x71, 0x46,
+    0x19, 0xA2, 0xD2, 0x8C, 0xA5, 0x19, 0x4A, 0x32, 0x94, 0x65, 0x27, 0x3E, 0x27, 0xBF, 0x91, 0xFB,
+    0x77, 0x9E, 0x7B, 0x4E, 0x98, 0x80, 0x00, 0x8A, 0xA4, 0x55, 0x11, 0x62, 0x2C, 0x45, 0x8E, 0x98,
+    0x9E, 0x7B, 0x4D, 0x9D, 0xA6, 0x3C, 0x8C, 0x38, 0xA2, 0xD2, 0x8B, 0x4A, 0x2D, 0x28, 0xB4, 0xA2,
+    0xD2, 0x8B, 0x49, 0x87, 0x13, 0x1E, 0x46, 0xCE, 0xD3, 0xCF, 0x69, 0xD3, 0x10, 0x02, 0x0E, 0xE9,
+    0x3C, 0x7A, 0x23, 0xDB, 0xF7, 0xA3, 0x2D, 0x88, 0xCB, 0x5A, 0x32, 0xC1, 0x19, 0x59, 0x19, 0x11,
+    0x91, 0x19, 0x11, 0x91, 0x15, 0x48, 0xAA, 0x07, 0x1D, 0xE7, 0x2F, 0xBC, 0xDD, 0xFC, 0x8B, 0xFE,
+    0xC2, 0xFF, 0xB0, 0xBF, 0x32, 0xFE, 0xD3, 0x7F, 0xB4, 0xE9, 0xE2, 0x67, 0x42, 0x00, 0x06, 0x9A,
+    0xCF, 0x9F, 0x03, 0xEE, 0xE4, 0x7B, 0x33, 0x47, 0xAE, 0x51, 0xEB, 0x94, 0x7A, 0xE5, 0x1E, 0xB9,
+    0x47, 0xE5, 0xCD, 0x1F, 0x6F, 0x24, 0x7C, 0x38, 0x22, 0x35, 0x80, 0x00, 0x69, 0x46, 0x94, 0x5F,
+    0x99, 0x7E, 0x65, 0xF9, 0x97, 0xE6, 0x5F, 0x99, 0xD3, 0xF1, 0x3A, 0x7B, 0x87, 0x68, 0x00, 0x69,
+    0x46, 0x94, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x27, 0x59, 0x9E, 0xB3, 0xCC, 0xD3, 0xF8, 0x9A, 0x73,
+    0x2F, 0x25, 0xE4, 0xBC, 0x97, 0x93, 0x4A, 0x34, 0xA1, 0x3A, 0xC9, 0xD6, 0x04, 0x6D, 0x33, 0xE0,
+    0x72, 0xFB, 0x8D, 0xFF, 0x12, 0xFC, 0xCB, 0xF3, 0x2F, 0xCC, 0xDF, 0xF1, 0x39, 0x7B, 0x4C, 0xFE,
+    0xB2, 0x7F, 0x9C, 0x5F, 0x32, 0xFC, 0x8D, 0x37, 0x99, 0xFD, 0x04, 0x62, 0x3D, 0x06, 0x94, 0x69,
+    0x43, 0xD0, 0x46, 0x26, 0x7F, 0x41, 0xA6, 0xF2, 0xFC, 0x8B, 0xE6, 0x20, 0x07, 0xD9, 0xB8, 0xE5,
+    0xC8, 0xDF, 0x99, 0x79, 0x2F, 0xCC, 0xBF, 0x33, 0x7F, 0xE2, 0x74, 0xF1, 0x33, 0xED, 0x00, 0x69,
+    0x46, 0x94, 0x3A, 0x0E, 0xD1, 0xAC, 0x8C, 0x4C, 0xEC, 0x78, 0x0D, 0x28, 0xD2, 0x80, 0x00, 0x69,
+    0x46, 0x94, 0x8B, 0x74, 0x30, 0xED, 0x3D, 0x1A, 0xCF, 0xFB, 0x62, 0x7F, 0xAD, 0x8F, 0xEF, 0x23,
+    0xE5, 0x46, 0x94, 0x00, 0x69, 0x46, 0x94, 0x3D, 0x03, 0x12, 0x7E, 0x83, 0xA6, 0xF2, 0xFC, 0x8B,
+    0xE6, 0x20, 0x24, 0x49, 0xA5, 0x1A, 0x78, 0x97, 0x17, 0x17, 0x17, 0x17, 0x17, 0x1A, 0x51, 0xA5,
+    0x00, 0x00, 0x69, 0x46, 0x94, 0x78, 0x0E, 0x98, 0x11, 0xC0, 0x79, 0x8C, 0xC7, 0x99, 0x1B, 0x4E,
+    0x98, 0x1E, 0x03, 0x4A, 0x34, 0xA0, 0x06, 0x94, 0x69, 0x43, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18,
+    0x0C, 0x0D, 0x28, 0xD2, 0x80, 0x04, 0xED, 0x33, 0xE0, 0x72, 0xE4, 0x6F, 0xCC, 0xBC, 0x97, 0x92,
+    0xF2, 0x6F, 0xCC, 0xE5, 0xC8, 0xCF, 0x81, 0x3B, 0x40, 0x00, 0x69, 0x46, 0x94, 0x5C, 0x5C, 0x5C,
+    0x5C, 0x5C, 0x5C, 0x69, 0x46, 0x94, 0x00, 0x69, 0x5B, 0x5A, 0x56, 0xD7, 0x1D, 0xC6, 0xEE, 0x25,
+    0xE4, 0xBC, 0x97, 0x93, 0x7E, 0x67, 0x2E, 0x46, 0x7C, 0x09, 0xD6, 0x04, 0xED, 0x33, 0xE0, 0x72,
+    0xE4, 0x6F, 0xCC, 0xBC, 0x97, 0x92, 0xF2, 0x6F, 0xCC, 0xE5, 0xC8, 0xE3, 0xB8, 0x5C, 0x5C, 0x5C,
+    0x5C, 0x69, 0x46, 0x94, 0x5C, 0x5C, 0x5C, 0x5C, 0x06, 0xF1, 0xA5, 0xAE, 0x9C, 0x6E, 0x77, 0x76,
+    0x1A, 0x6B, 0x3A, 0x60, 0x78, 0x99, 0xEB, 0x34, 0x17, 0x04, 0xED, 0x33, 0xE0, 0x72, 0xE4, 0x6F,
+    0xCC, 0xBC, 0x97, 0x92, 0xF2, 0x72, 0xE2, 0x8A, 0xAD, 0xB1, 0x55, 0xB5, 0xCB, 0x89, 0x79, 0x2F,
+    0x25, 0xE4, 0xBE, 0x67, 0x2E, 0x46, 0x7C, 0x09, 0xDA, 0x7A, 0x60, 0xBC, 0x9E, 0x1D, 0x0C, 0xF7,
+    0x93, 0xB4, 0x62, 0x46, 0xD3, 0x3D, 0xE7, 0x2E, 0x85, 0xE4, 0xF4, 0xC0, 0x00, 0x69, 0x46, 0x94,
+    0x24, 0x48, 0x91, 0x22, 0x44, 0x9A, 0x51, 0xA5, 0x6D, 0x27, 0x68, 0x06, 0x96, 0x34, 0xC4, 0x75,
+    0x8E, 0xA1, 0xD4, 0x3A, 0x87, 0x50, 0xD4, 0x69, 0x46, 0x94, 0x00, 0x69, 0x46, 0x94, 0x24, 0x48,
+    0x91, 0x22, 0x4D, 0x28, 0xD2, 0x84, 0x89, 0x12, 0x24, 0x49, 0xA5, 0x1A, 0x50, 0x00, 0x69, 0x46,
+    0x94, 0x24, 0x48, 0x91, 0x22, 0x4D, 0x28, 0xD2, 0x84, 0x89, 0x12, 0x24, 0x49, 0xA5, 0x1A, 0x56,
+    0xD2, 0x76, 0x80, 0x05, 0xC5, 0xC5, 0xC6, 0x94, 0x69, 0x43, 0x98, 0xE6, 0x39, 0x8E, 0x63, 0x98,
+    0xFC, 0x47, 0xB8, 0x76, 0x80, 0x00, 0x69, 0x46, 0x94, 0x39, 0x8E, 0x63, 0x98, 0xE6, 0x39, 0x8F,
+    0xC4, 0x7B, 0x87, 0x68, 0x1A, 0x51, 0xA5, 0x00, 0x00, 0x69, 0x46, 0x94, 0x39, 0x8E, 0x63, 0x98,
+    0xE6, 0x39, 0x8F, 0xC4, 0x7B, 0x87, 0x68, 0x07, 0x1B, 0x9C, 0xBC, 0x0D, 0xFC, 0x4B, 0xC9, 0x7E,
+    0x65, 0xF9, 0x97, 0xE6, 0x72, 0xFB, 0x8C, 0xFC, 0x49, 0xDA, 0x00, 0x69, 0x46, 0x94, 0x30, 0x18,
+    0x13, 0xB4, 0xCF, 0x81, 0xCB, 0x91, 0xBF, 0x32, 0xF2, 0x5E, 0x4B, 0xC9, 0xBF, 0x33, 0x97, 0x23,
+    0x3E, 0x04, 0xED, 0x06, 0x79, 0x1D, 0x3E, 0x26, 0xFF, 0xEF, 0x2F, 0xFD, 0x05, 0xFA, 0xCB, 0xEA,
+    0x2F, 0xA8, 0xBE, 0xA3, 0x4A, 0x34, 0xA0,
+};
+const uint8_t ArialMT_Plain_24_UA_huffman[] PROGMEM = {
+    0x01, 0x00, 0x00, 0x03, 0x02, 0x05, 0x0B, 0x0A, 0x0C, 0x0A, 0x0F, 0x11, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xC0, 0xFF, 0x01, 0x18, 0x03, 0x07, 0xC1, 0xE0, 0xF8, 0x06, 0x0F, 0x1E, 0x1F, 0x30,
+    0x38, 0x3F, 0x60, 0x70, 0xC3, 0xF0, 0x0C, 0x0E, 0x1C, 0x3C, 0x3E, 0x61, 0x78, 0x7F, 0x81, 0xFC,
+    0x02, 0x08, 0x10, 0x19, 0x31, 0x63, 0x7E, 0xC7, 0xE1, 0xE3, 0xF9, 0xFE, 0x0D, 0x1B, 0x20, 0x33,
+    0x40, 0x71, 0x73, 0x7C, 0xCC, 0xE7, 0x04, 0x39, 0x3B, 0x3D, 0x83, 0x87, 0xB0, 0xBF, 0xC6, 0xCE,
+    0xCF, 0xD8, 0xDC, 0xDF, 0xE6, 0x12, 0x13, 0x1A, 0x1D, 0x42, 0x67, 0x6C, 0x6E, 0x77, 0x7B, 0x88,
+    0x8E, 0x98, 0x99, 0xB8, 0xE2, 0xFB, 0x11, 0x17, 0x21, 0x36, 0x66, 0x68, 0x6F, 0x72, 0x82, 0x8F,
+    0x9C, 0x9F, 0xA0, 0xB3, 0xD3, 0xF1, 0xF3, 0xFD,
+};
+const CompressedFont ArialMT_Plain_24_UA = {ArialMT_Plain_24_UA_header, ArialMT_Plain_24_UA_data, ArialMT_Plain_24_UA_huffman};
+
+#endif
@@ -1,4 +1,4 @@
-#ifdef OLED_CS
+#if defined(OLED_CS) && !FONT_COMPRESSED
 
 #include "OLEDDisplayFontsCS.h"
 
@@ -6,11 +6,18 @@
 #elif __MBED__
 #define PROGMEM
 #endif
+#include "CompressedFont.h"
 
 /**
  * Localization for Czech and Slovak language containing glyphs with diacritic.
  */
+#if FONT_COMPRESSED
+extern const CompressedFont ArialMT_Plain_10_CS;
+extern const CompressedFont ArialMT_Plain_16_CS;
+extern const CompressedFont ArialMT_Plain_24_CS;
+#else
 extern const uint8_t ArialMT_Plain_10_CS[] PROGMEM;
 extern const uint8_t ArialMT_Plain_16_CS[] PROGMEM;
 extern const uint8_t ArialMT_Plain_24_CS[] PROGMEM;
+#endif
 #endif
\ No newline at end of file
@@ -1,5 +1,5 @@
 // trunk-ignore-all(clang-format): Preserve long lines
-#ifdef OLED_PL
+#if defined(OLED_PL) && !FONT_COMPRESSED
 #include "OLEDDisplayFontsPL.h"
 
 const uint8_t ArialMT_Plain_10_PL[] PROGMEM = {
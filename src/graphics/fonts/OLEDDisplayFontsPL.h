@@ -6,7 +6,14 @@
 #elif __MBED__
 #define PROGMEM
 #endif
+#include "CompressedFont.h"
+#if FONT_COMPRESSED
+extern const CompressedFont ArialMT_Plain_10_PL;
+extern const CompressedFont ArialMT_Plain_16_PL;
+extern const CompressedFont ArialMT_Plain_24_PL;
+#else
 extern const uint8_t ArialMT_Plain_10_PL[] PROGMEM;
 extern const uint8_t ArialMT_Plain_16_PL[] PROGMEM;
 extern const uint8_t ArialMT_Plain_24_PL[] PROGMEM;
+#endif
 #endif
\ No newline at end of file
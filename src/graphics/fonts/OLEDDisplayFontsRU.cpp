@@ -1,4 +1,4 @@
-#ifdef OLED_RU
+#if defined(OLED_RU) && !FONT_COMPRESSED
 
 #include "OLEDDisplayFontsRU.h"
 
@@ -6,8 +6,15 @@
 #elif __MBED__
 #define PROGMEM
 #endif
+#include "CompressedFont.h"
 
+#if FONT_COMPRESSED
+extern const CompressedFont ArialMT_Plain_10_RU;
+extern const CompressedFont ArialMT_Plain_16_RU;
+extern const CompressedFont ArialMT_Plain_24_RU;
+#else
 extern const uint8_t ArialMT_Plain_10_RU[] PROGMEM;
 extern const uint8_t ArialMT_Plain_16_RU[] PROGMEM;
 extern const uint8_t ArialMT_Plain_24_RU[] PROGMEM;
+#endif
 #endif
\ No newline at end of file
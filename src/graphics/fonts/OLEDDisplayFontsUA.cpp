@@ -1,4 +1,4 @@
-#ifdef OLED_UA
+#if defined(OLED_UA) && !FONT_COMPRESSED
 
 #include "OLEDDisplayFontsUA.h"
 
@@ -6,8 +6,15 @@
 #elif __MBED__
 #define PROGMEM
 #endif
+#include "CompressedFont.h"
 
+#if FONT_COMPRESSED
+extern const CompressedFont ArialMT_Plain_10_UA;
+extern const CompressedFont ArialMT_Plain_16_UA;
+extern const CompressedFont ArialMT_Plain_24_UA;
+#else
 extern const uint8_t ArialMT_Plain_10_UA[] PROGMEM;
 extern const uint8_t ArialMT_Plain_16_UA[] PROGMEM;
 extern const uint8_t ArialMT_Plain_24_UA[] PROGMEM;
+#endif
 #endif
\ No newline at end of file
@@ -153,7 +153,7 @@ void LCMEN213EFC1::reset()
 void LCMEN213EFC1::sendCommand(const uint8_t command)
 {
     // Take firmware's SPI lock
-    spiLock->lock();
+    spiAcquire(SPI_CLIENT_DISPLAY);
 
     spi->beginTransaction(spiSettings);
     digitalWrite(pin_dc, LOW); // DC pin low indicates command
@@ -163,7 +163,7 @@ void LCMEN213EFC1::sendCommand(const uint8_t command)
     digitalWrite(pin_dc, HIGH);
     spi->endTransaction();
 
-    spiLock->unlock();
+    spiRelease(SPI_CLIENT_DISPLAY);
 }
 
 void LCMEN213EFC1::sendData(uint8_t data)
@@ -174,7 +174,7 @@ void LCMEN213EFC1::sendData(uint8_t data)
 void LCMEN213EFC1::sendData(const uint8_t *data, uint32_t size)
 {
     // Take firmware's SPI lock
-    spiLock->lock();
+    spiAcquire(SPI_CLIENT_DISPLAY);
 
     spi->beginTransaction(spiSettings);
     digitalWrite(pin_dc, HIGH); // DC pin HIGH indicates data, instead of command
@@ -194,7 +194,7 @@ void LCMEN213EFC1::sendData(const uint8_t *data, uint32_t size)
     digitalWrite(pin_dc, HIGH);
     spi->endTransaction();
 
-    spiLock->unlock();
+    spiRelease(SPI_CLIENT_DISPLAY);
 }
 
 void LCMEN213EFC1::configFull()
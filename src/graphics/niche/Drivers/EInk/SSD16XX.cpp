@@ -86,7 +86,7 @@ void SSD16XX::sendCommand(const uint8_t command)
         return;
 
     // Take firmware's SPI lock
-    spiLock->lock();
+    spiAcquire(SPI_CLIENT_DISPLAY);
 
     spi->beginTransaction(spiSettings);
     digitalWrite(pin_dc, LOW); // DC pin low indicates command
@@ -96,7 +96,7 @@ void SSD16XX::sendCommand(const uint8_t command)
     digitalWrite(pin_dc, HIGH);
     spi->endTransaction();
 
-    spiLock->unlock();
+    spiRelease(SPI_CLIENT_DISPLAY);
 }
 
 void SSD16XX::sendData(uint8_t data)
@@ -111,27 +111,33 @@ void SSD16XX::sendData(const uint8_t *data, uint32_t size)
     if (failed)
         return;
 
-    // Take firmware's SPI lock
-    spiLock->lock();
+    // Send a full image in chunks, taking firmware's SPI lock for one chunk at a time so the radio can get in between.
+    // The controller carries on writing RAM where it left off when CS is raised between bytes.
+    for (uint32_t sent = 0; sent < size;) {
+        uint32_t chunk = size - sent > SPI_MAX_CHUNK_BYTES ? SPI_MAX_CHUNK_BYTES : size - sent;
+        spiYieldToRadio();
+        spiAcquire(SPI_CLIENT_DISPLAY);
 
-    spi->beginTransaction(spiSettings);
-    digitalWrite(pin_dc, HIGH); // DC pin HIGH indicates data, instead of command
-    digitalWrite(pin_cs, LOW);
+        spi->beginTransaction(spiSettings);
+        digitalWrite(pin_dc, HIGH); // DC pin HIGH indicates data, instead of command
+        digitalWrite(pin_cs, LOW);
 
-    // Platform-specific SPI command
+        // Platform-specific SPI command
 #if defined(ARCH_ESP32)
-    spi->transferBytes(data, NULL, size); // NULL for a "write only" transfer
+        spi->transferBytes(data + sent, NULL, chunk); // NULL for a "write only" transfer
 #elif defined(ARCH_NRF52)
-    spi->transfer(data, NULL, size); // NULL for a "write only" transfer
+        spi->transfer(data + sent, NULL, chunk); // NULL for a "write only" transfer
 #else
 #error Not implemented yet? Feel free to add other platforms here.
 #endif
 
-    digitalWrite(pin_cs, HIGH);
-    digitalWrite(pin_dc, HIGH);
-    spi->endTransaction();
+        digitalWrite(pin_cs, HIGH);
+        digitalWrite(pin_dc, HIGH);
+        spi->endTransaction();
 
-    spiLock->unlock();
+        spiRelease(SPI_CLIENT_DISPLAY);
+        sent += chunk;
+    }
 }
 
 void SSD16XX::configFullscreen()
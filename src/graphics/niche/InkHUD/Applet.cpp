@@ -26,7 +26,7 @@ InkHUD::Applet::Applet() : GFX(0, 0)
 }
 
 // Draw a single pixel
-// The raw pixel output generated by AdafruitGFX drawing all passes through here
+// The raw pixel output generated by AdafruitGFX drawing all passes through here, unless it comes as a run (drawFastHLine)
 // Hand off to the applet's tile, which will in-turn pass to the renderer
 void InkHUD::Applet::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
@@ -35,6 +35,106 @@ void InkHUD::Applet::drawPixel(int16_t x, int16_t y, uint16_t color)
         assignedTile->handleAppletPixel(x, y, (Color)color);
 }
 
+// Draw a filled rect of pixels
+// Cropped once here, then handed to the tile whole, so that the renderer can rotate it once and fill whole bytes of the
+// image buffer. Text (via write), lines, rects and fills all end up here, rather than making one trip through drawPixel per
+// pixel
+void InkHUD::Applet::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    int16_t x0 = max(x, cropLeft);
+    int16_t x1 = min((int16_t)(x + w), (int16_t)(cropLeft + cropWidth)); // Exclusive
+    int16_t y0 = max(y, cropTop);
+    int16_t y1 = min((int16_t)(y + h), (int16_t)(cropTop + cropHeight)); // Exclusive
+    if (x1 > x0 && y1 > y0)
+        assignedTile->handleAppletRect(x0, y0, x1 - x0, y1 - y0, (Color)color);
+}
+
+// Draw a horizontal run of pixels
+// A negative width runs leftwards from x, as AdafruitGFX draws it
+void InkHUD::Applet::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    if (w < 0) {
+        x += w + 1;
+        w = -w;
+    }
+    fillRect(x, y, w, 1, color);
+}
+
+// Draw a vertical run of pixels
+// With the display rotated, this is the one which lands on a row of the image buffer
+void InkHUD::Applet::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    if (h < 0) {
+        y += h + 1;
+        h = -h;
+    }
+    fillRect(x, y, 1, h, color);
+}
+
+// Print a character
+// Same behavior as AdafruitGFX for our (always custom, unscaled, unwrapped) fonts,
+// but each row of the glyph is drawn as runs of pixels, instead of one drawPixel call per pixel
+size_t InkHUD::Applet::write(uint8_t c)
+{
+    if (!gfxFont || textsize_x != 1 || textsize_y != 1)
+        return GFX::write(c);
+
+    if (c == '\n') {
+        cursor_x = 0;
+        cursor_y += gfxFont->yAdvance;
+        return 1;
+    }
+
+    if (c == '\r' || c < gfxFont->first || c > gfxFont->last)
+        return 1;
+
+    const GFXglyph *glyph = &gfxFont->glyph[c - gfxFont->first];
+    if (glyph->width && glyph->height) {
+        if (wrap && (cursor_x + glyph->xOffset + glyph->width) > _width) {
+            cursor_x = 0;
+            cursor_y += gfxFont->yAdvance;
+        }
+        drawGlyph(glyph, cursor_x, cursor_y, textcolor);
+    }
+    cursor_x += glyph->xAdvance;
+    return 1;
+}
+
+// Draw one glyph of the current font, with its cursor position at x,y
+// Glyph bitmaps are packed bits, rows running on without padding
+void InkHUD::Applet::drawGlyph(const GFXglyph *glyph, int16_t x, int16_t y, uint16_t color)
+{
+    x += glyph->xOffset;
+    y += glyph->yOffset;
+
+    // Skip glyphs which are entirely above or below the crop (long text, scrolled)
+    if (y + glyph->height <= cropTop || y >= cropTop + cropHeight)
+        return;
+
+    const uint8_t *bitmap = gfxFont->bitmap + glyph->bitmapOffset;
+    uint8_t bits = 0;
+    uint8_t bit = 0;
+
+    for (uint8_t yy = 0; yy < glyph->height; yy++) {
+        int16_t runStart = -1;
+        for (uint8_t xx = 0; xx < glyph->width; xx++) {
+            if (!(bit++ & 7))
+                bits = *bitmap++;
+
+            if (bits & 0x80) {
+                if (runStart < 0)
+                    runStart = xx;
+            } else if (runStart >= 0) {
+                drawFastHLine(x + runStart, y + yy, xx - runStart, color);
+                runStart = -1;
+            }
+            bits <<= 1;
+        }
+        if (runStart >= 0)
+            drawFastHLine(x + runStart, y + yy, glyph->width - runStart, color);
+    }
+}
+
 // Link our applet to a tile
 // This can only be called by Tile::assignApplet
 // The tile determines the applets dimensions
@@ -366,13 +466,34 @@ bool InkHUD::Applet::isPrintable(std::string text)
 
 // Gets rendered width of a string
 // Wrapper for getTextBounds
+// Layout code asks for the same few widths over and over (headers, names, every word of printWrapped),
+// so recent results are remembered, keyed by font and a hash of the text
 uint16_t InkHUD::Applet::getTextWidth(const char *text)
 {
+    struct CachedWidth {
+        const GFXfont *font;
+        uint32_t hash;
+        uint16_t length;
+        uint16_t width;
+    };
+    static CachedWidth cache[TEXT_WIDTH_CACHE_SIZE] = {};
+
+    // FNV-1a
+    uint32_t hash = 2166136261UL;
+    uint16_t length = 0;
+    for (const char *c = text; *c; c++, length++)
+        hash = (hash ^ (uint8_t)*c) * 16777619UL;
+
+    CachedWidth &entry = cache[hash % TEXT_WIDTH_CACHE_SIZE];
+    if (entry.font && entry.font == currentFont.gfxFont && entry.hash == hash && entry.length == length)
+        return entry.width;
+
     // We do still have to run getTextBounds to find the width
     int16_t textOffsetX, textOffsetY;
     uint16_t textWidth, textHeight;
     getTextBounds(text, 0, 0, &textOffsetX, &textOffsetY, &textWidth, &textHeight);
 
+    entry = {currentFont.gfxFont, hash, length, textWidth};
     return textWidth;
 }
 
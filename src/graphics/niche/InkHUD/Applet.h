@@ -24,6 +24,10 @@
 #include "./Tile.h"
 #include "graphics/niche/Drivers/EInk/EInk.h"
 
+#ifndef TEXT_WIDTH_CACHE_SIZE
+#define TEXT_WIDTH_CACHE_SIZE 32 // How many recent getTextWidth results to remember
+#endif
+
 namespace NicheGraphics::InkHUD
 {
 
@@ -100,7 +104,13 @@ class Applet : public GFX
     const char *name = nullptr; // Shown in applet selection menu. Also used as an identifier by InkHUD::getSystemApplet
 
   protected:
-    void drawPixel(int16_t x, int16_t y, uint16_t color) override; // Place a single pixel. All drawing output passes through here
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override; // Place a single pixel
+
+    // All drawing output passes through drawPixel, or through here as a filled rect of pixels
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    size_t write(uint8_t c) override;                                                   // Glyph rows as runs
 
     void requestUpdate(EInk::UpdateTypes type = EInk::UpdateTypes::UNSPECIFIED); // Ask WindowManager to schedule a display update
     void requestAutoshow();                                                      // Ask for applet to be moved to foreground
@@ -162,6 +172,8 @@ class Applet : public GFX
     using GFX::setFont;     // Make sure derived classes use AppletFont instead of AdafruitGFX fonts directly
     using GFX::setRotation; // Block setRotation calls. Rotation is handled globally by WindowManager.
 
+    void drawGlyph(const GFXglyph *glyph, int16_t x, int16_t y, uint16_t color); // Glyph rows as runs, for write()
+
     AppletFont currentFont; // As passed to setFont
 
     // As set by setCrop
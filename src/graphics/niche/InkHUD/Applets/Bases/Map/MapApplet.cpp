@@ -17,6 +17,7 @@ void InkHUD::MapApplet::onRender()
     // - latitude and longitude
     // - will be placed at X(0.5), Y(0.5)
     getMapCenter(&latCenter, &lngCenter);
+    center = GeoOrigin(int32_t(latCenter * 1e+7), int32_t(lngCenter * 1e+7));
 
     // Calculate North+East distance of each node to map center
     // - which nodes to use controlled by virtual shouldDrawNode method
@@ -229,18 +230,20 @@ void InkHUD::MapApplet::getMapSize(uint32_t *widthMeters, uint32_t *heightMeters
 // Convert and store info we need for drawing a marker
 // Lat / long to "meters relative to map center", for position on screen
 // Info about hopsAway, for marker size
-InkHUD::MapApplet::Marker InkHUD::MapApplet::calculateMarker(float lat, float lng, bool hasHopsAway, uint8_t hopsAway)
+InkHUD::MapApplet::Marker InkHUD::MapApplet::calculateMarker(int32_t lat, int32_t lng, bool hasHopsAway, uint8_t hopsAway)
 {
     assert(lat != 0 || lng != 0); // Not null island. Applets should check this before calling.
 
-    // Bearing and distance from map center to node
-    float distanceFromCenter = GeoCoord::latLongToMeter(latCenter, lngCenter, lat, lng);
-    float bearingFromCenter = GeoCoord::bearing(latCenter, lngCenter, lat, lng); // in radians
-
-    // Split into meters north and meters east components (signed)
-    // - signedness of cos / sin automatically sets negative if south or west
-    float northMeters = cos(bearingFromCenter) * distanceFromCenter;
-    float eastMeters = sin(bearingFromCenter) * distanceFromCenter;
+    // Meters north and east of map center (signed: negative if south or west)
+    // - nearby nodes are measured directly on a flat map around the center
+    float northMeters, eastMeters;
+    if (!center.toLocal(lat, lng, northMeters, eastMeters)) {
+        // Far away: bearing and distance from map center, split into north and east components
+        float distanceFromCenter = center.distanceTo(lat, lng);
+        float bearingFromCenter = center.bearingTo(lat, lng); // in radians
+        northMeters = cos(bearingFromCenter) * distanceFromCenter;
+        eastMeters = sin(bearingFromCenter) * distanceFromCenter;
+    }
 
     // Store this as a new marker
     Marker m;
@@ -256,10 +259,10 @@ void InkHUD::MapApplet::drawLabeledMarker(meshtastic_NodeInfoLite *node)
 {
     // Find x and y position based on node's position in nodeDB
     assert(nodeDB->hasValidPosition(node));
-    Marker m = calculateMarker(node->position.latitude_i * 1e-7,  // Lat, converted from Meshtastic's internal int32 style
-                               node->position.longitude_i * 1e-7, // Long, converted from Meshtastic's internal int32 style
-                               node->has_hops_away,               // Is the hopsAway number valid
-                               node->hops_away                    // Hops away
+    Marker m = calculateMarker(node->position.latitude_i,  // Lat, in Meshtastic's internal int32 style
+                               node->position.longitude_i, // Long, in Meshtastic's internal int32 style
+                               node->has_hops_away,        // Is the hopsAway number valid
+                               node->hops_away             // Hops away
     );
 
     // Convert to pixel coords
@@ -390,10 +393,10 @@ void InkHUD::MapApplet::calculateAllMarkers()
 
         // Calculate marker and store it
         markers.push_back(
-            calculateMarker(node->position.latitude_i * 1e-7,  // Lat, converted from Meshtastic's internal int32 style
-                            node->position.longitude_i * 1e-7, // Long, converted from Meshtastic's internal int32 style
-                            node->has_hops_away,               // Is the hopsAway number valid
-                            node->hops_away                    // Hops away
+            calculateMarker(node->position.latitude_i,  // Lat, in Meshtastic's internal int32 style
+                            node->position.longitude_i, // Long, in Meshtastic's internal int32 style
+                            node->has_hops_away,        // Is the hopsAway number valid
+                            node->hops_away             // Hops away
                             ));
     }
 }
@@ -20,6 +20,7 @@ The base applet doesn't handle any events; this is left to the derived applets.
 
 #include "MeshModule.h"
 #include "gps/GeoCoord.h"
+#include <list>
 
 namespace NicheGraphics::InkHUD
 {
@@ -46,7 +47,7 @@ class MapApplet : public Applet
         uint8_t hopsAway = 0; // Determines marker size
     };
 
-    Marker calculateMarker(float lat, float lng, bool hasHopsAway, uint8_t hopsAway);
+    Marker calculateMarker(int32_t lat, int32_t lng, bool hasHopsAway, uint8_t hopsAway);
     void calculateAllMarkers();
     void calculateMapScale();                           // Conversion factor for meters to pixels
     void drawCross(int16_t x, int16_t y, uint8_t size); // Draw the X used for most markers
@@ -54,6 +55,7 @@ class MapApplet : public Applet
     float metersToPx = 0; // Conversion factor for meters to pixels
     float latCenter = 0;  // Map center: latitude
     float lngCenter = 0;  // Map center: longitude
+    GeoOrigin center;     // Map center, for measuring markers from
 
     std::list<Marker> markers;
     uint32_t widthMeters = 0;  // Map width: meters
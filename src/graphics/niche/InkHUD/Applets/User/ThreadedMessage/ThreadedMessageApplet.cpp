@@ -64,9 +64,9 @@ void InkHUD::ThreadedMessageApplet::onRender()
     uint8_t i = 0;               // Index of stored message
 
     // Loop over messages
-    // - until no messages left, or
+    // - until no messages left (in RAM, or older ones in the flash log), or
     // - until no part of message fits on screen
-    while (msgB >= (0 - fontSmall.lineHeight()) && i < store->messages.size()) {
+    while (msgB >= (0 - fontSmall.lineHeight()) && (i < store->messages.size() || store->loadOlder())) {
 
         // Grab data for message
         MessageStore::Message &m = store->messages.at(i);
@@ -161,7 +161,7 @@ void InkHUD::ThreadedMessageApplet::onRender()
     hatchRegion(0, dividerY + 1, width(), fontSmall.lineHeight() / 3, 2, WHITE);
 
     // If we've run out of screen to draw messages, we can drop any leftover data from the queue
-    // Those messages have been pushed off the screen-top by newer ones
+    // Those messages have been pushed off the screen-top by newer ones. They remain in the flash log
     while (i < store->messages.size())
         store->messages.pop_back();
 }
@@ -206,8 +206,8 @@ ProcessMessage InkHUD::ThreadedMessageApplet::handleReceived(const meshtastic_Me
     newMessage.text = std::string((const char *)mp.decoded.payload.bytes, mp.decoded.payload.size);
 
     // Store newest message at front
-    // These records are used when rendering, and also stored in flash at shutdown
-    store->messages.push_front(newMessage);
+    // These records are used when rendering, and also appended to the log in flash right away
+    store->append(newMessage);
 
     // If this was an incoming message, suggest that our applet becomes foreground, if permitted
     if (getFrom(&mp) != nodeDB->getNodeNum())
@@ -232,37 +232,13 @@ bool InkHUD::ThreadedMessageApplet::approveNotification(Notification &n)
         return true;
 }
 
-// Save several recent messages to flash
-// Stores the contents of ThreadedMessageApplet::messages
-// Just enough messages to fill the display
-// Messages are packed "back-to-back", to minimize blocks of flash used
-void InkHUD::ThreadedMessageApplet::saveMessagesToFlash()
-{
-    // Create a label (will become the filename in flash)
-    std::string label = "ch" + to_string(channelIndex);
-
-    store->saveToFlash();
-}
-
-// Load recent messages to flash
-// Fills ThreadedMessageApplet::messages with previous messages
-// Just enough messages have been stored to cover the display
+// Load recent messages from flash
+// Fills ThreadedMessageApplet::messages with the newest messages from the store's log
+// Roughly enough to cover the display. If more are needed, onRender will read them from flash as it goes
+// Nothing needs saving at shutdown: each message was written to the log as it arrived
 void InkHUD::ThreadedMessageApplet::loadMessagesFromFlash()
 {
-    // Create a label (will become the filename in flash)
-    std::string label = "ch" + to_string(channelIndex);
-
-    store->loadFromFlash();
-}
-
-// Code to run when device is shutting down
-// This is in addition to any onDeactivate() code, which will also run
-// Todo: implement before a reboot also
-void InkHUD::ThreadedMessageApplet::onShutdown()
-{
-    // Save our current set of messages to flash, provided the applet isn't disabled
-    if (isActive())
-        saveMessagesToFlash();
+    store->loadRecent(MAX_MESSAGES_SAVED);
 }
 
 #endif
\ No newline at end of file
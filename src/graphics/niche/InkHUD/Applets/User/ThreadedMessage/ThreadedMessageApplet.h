@@ -7,9 +7,8 @@ Displays a thread-view of incoming and outgoing message for a specific channel
 The channel for this applet is set in the constructor,
 when the applet is added to WindowManager in the setupNicheGraphics method.
 
-Several messages are saved to flash at shutdown, to preseve applet between reboots.
-This class has its own internal method for saving and loading to fs, which interacts directly with the FSCommon layer.
-If the amount of flash usage is unacceptable, we could keep these in RAM only.
+Each message is appended to a log in flash as it arrives (see MessageStore), to preserve the applet between reboots.
+Only the messages on screen are held in RAM. Flash usage is capped at two pages of MESSAGE_LOG_PAGE_SIZE per channel.
 
 Multiple instances of this channel may be used. This must be done at buildtime.
 Suggest a max of two channel, to minimize fs usage?
@@ -40,16 +39,14 @@ class ThreadedMessageApplet : public Applet, public SinglePortModule
 
     void onActivate() override;
     void onDeactivate() override;
-    void onShutdown() override;
     ProcessMessage handleReceived(const meshtastic_MeshPacket &mp) override;
 
     bool approveNotification(Notification &n) override; // Which notifications to suppress
 
   protected:
-    void saveMessagesToFlash();
     void loadMessagesFromFlash();
 
-    MessageStore *store; // Messages, held in RAM for use, ready to save to flash on shutdown
+    MessageStore *store; // Messages, a window of recent ones held in RAM, all written to a log in flash as they arrive
     uint8_t channelIndex = 0;
 };
 
@@ -215,4 +215,11 @@ void InkHUD::InkHUD::drawPixel(int16_t x, int16_t y, Color c)
     renderer->handlePixel(x, y, c);
 }
 
+// Place a filled rect of pixels into the image buffer
+// Same coordinate handling as drawPixel, but lets the Renderer rotate the rect once and fill whole bytes at a time
+void InkHUD::InkHUD::fillRect(int16_t x, int16_t y, uint16_t w, uint16_t h, Color c)
+{
+    renderer->handleRect(x, y, w, h, c);
+}
+
 #endif
\ No newline at end of file
@@ -93,6 +93,7 @@ class InkHUD
 
     // Pass drawing output to Renderer
     void drawPixel(int16_t x, int16_t y, Color c);
+    void fillRect(int16_t x, int16_t y, uint16_t w, uint16_t h, Color c); // A filled rect: runs, lines and fills
 
     // Shared data which persists between boots
     Persistence *persistence = nullptr;
@@ -12,6 +12,10 @@ using namespace NicheGraphics;
 constexpr uint8_t MAX_MESSAGES_SAVED = 10;
 constexpr uint32_t MAX_MESSAGE_SIZE = 250;
 
+// Each record of the message log: text length, timestamp, sender, channel index, text, and the text length again
+// The trailing length lets us walk the log backwards from its end. The leading copy lets us spot a torn write.
+constexpr uint32_t LOG_RECORD_OVERHEAD = 1 + sizeof(uint32_t) + sizeof(NodeNum) + sizeof(uint8_t) + 1;
+
 InkHUD::MessageStore::MessageStore(std::string label)
 {
     filename = "";
@@ -19,6 +23,18 @@ InkHUD::MessageStore::MessageStore(std::string label)
     filename += "/";
     filename += label;
     filename += ".msgs";
+
+    logFilename = "";
+    logFilename += "/NicheGraphics";
+    logFilename += "/";
+    logFilename += label;
+    logFilename += ".log";
+}
+
+// Current page of the message log, or the older page
+std::string InkHUD::MessageStore::pageFilename(uint8_t page)
+{
+    return page == 0 ? logFilename : logFilename + ".old";
 }
 
 // Write the contents of the MessageStore::messages object to flash
@@ -150,4 +166,189 @@ void InkHUD::MessageStore::loadFromFlash()
     return;
 }
 
-#endif
\ No newline at end of file
+// Store a new message as the newest, and write its record to the end of the message log
+// Only this one record is written, so nothing is lost if we never get to shut down cleanly
+void InkHUD::MessageStore::append(const Message &m)
+{
+    messages.push_front(m);
+    cursor.valid = false; // Cursor counted records back from the newest
+
+#ifdef FSCom
+    uint8_t length = min(MAX_MESSAGE_SIZE, m.text.size());
+    std::string current = pageFilename(0);
+    std::string older = pageFilename(1);
+
+    spiLock->lock();
+    FSCom.mkdir("/NicheGraphics");
+    uint32_t pageSize = 0;
+    if (FSCom.exists(current.c_str())) {
+        auto f = FSCom.open(current.c_str(), FILE_O_READ);
+        if (f) {
+            pageSize = f.size();
+            f.close();
+        }
+    }
+
+    // If the record won't fit on the current page, it becomes the older page, and we start a new one
+    if (pageSize && pageSize + LOG_RECORD_OVERHEAD + length > MESSAGE_LOG_PAGE_SIZE) {
+        FSCom.remove(older.c_str());
+        spiLock->unlock(); // renameFile takes the lock for itself
+        if (!renameFile(current.c_str(), older.c_str()))
+            LOG_ERROR("Can't start a new page of %s", current.c_str());
+        spiLock->lock();
+    }
+
+    auto f = FSCom.open(current.c_str(), FILE_O_APPEND);
+    if (f) {
+        f.write(length);
+        f.write((uint8_t *)&m.timestamp, sizeof(m.timestamp));
+        f.write((uint8_t *)&m.sender, sizeof(m.sender));
+        f.write((uint8_t *)&m.channelIndex, sizeof(m.channelIndex));
+        f.write((uint8_t *)m.text.c_str(), length);
+        f.write(length);
+        f.close();
+        fileManifestChanged();
+    } else {
+        LOG_ERROR("Can't append to %s", current.c_str());
+    }
+    spiLock->unlock();
+#endif
+}
+
+// Replace the contents of MessageStore::messages with (up to) the newest few records from the message log
+// Any older records stay on flash, until loadOlder asks for them
+void InkHUD::MessageStore::loadRecent(uint8_t count)
+{
+    migrateSnapshot();
+
+    messages.clear();
+    cursor.valid = false;
+    while (messages.size() < count && loadOlder())
+        ;
+}
+
+// Add the record which is next oldest after those in MessageStore::messages to its back, reading it from flash
+// Returns false if the log holds no older records
+bool InkHUD::MessageStore::loadOlder()
+{
+#ifdef FSCom
+    concurrency::LockGuard guard(spiLock);
+
+    // If our cached place in the log doesn't line up with the messages we hold (some were dropped),
+    // walk back again from the newest record, skipping over as many records as we hold
+    if (!cursor.valid || cursor.index != messages.size()) {
+        cursor = LogCursor();
+        cursor.valid = true;
+        auto f = FSCom.open(pageFilename(0).c_str(), FILE_O_READ);
+        if (f) {
+            cursor.offset = f.size();
+            f.close();
+        }
+        while (cursor.index < messages.size()) {
+            if (!readOlderRecord(cursor, nullptr))
+                return false;
+        }
+    }
+
+    Message m;
+    if (!readOlderRecord(cursor, &m))
+        return false;
+
+    messages.push_back(m);
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Read the log record which ends at the cursor, and move the cursor back to its start
+// If m is nullptr, the record is only stepped over
+// Caller must hold spiLock
+bool InkHUD::MessageStore::readOlderRecord(LogCursor &c, Message *m)
+{
+#ifdef FSCom
+    while (c.page < 2) {
+        // Reached the start of this page: carry on from the end of the older page
+        if (c.offset == 0) {
+            c.page++;
+            if (c.page < 2) {
+                auto older = FSCom.open(pageFilename(c.page).c_str(), FILE_O_READ);
+                if (older) {
+                    c.offset = older.size();
+                    older.close();
+                }
+            }
+            continue;
+        }
+
+        auto f = FSCom.open(pageFilename(c.page).c_str(), FILE_O_READ);
+        if (!f) {
+            c.offset = 0;
+            continue;
+        }
+
+        // Trailing length tells us where the record starts
+        uint8_t length = 0;
+        uint8_t leadingLength = 0;
+        f.seek(c.offset - 1);
+        f.readBytes((char *)&length, 1);
+        if (c.offset < LOG_RECORD_OVERHEAD + length) {
+            LOG_WARN("Damaged record in %s", pageFilename(c.page).c_str());
+            f.close();
+            c.offset = 0; // Skip the rest of this page
+            continue;
+        }
+        uint32_t start = c.offset - (LOG_RECORD_OVERHEAD + length);
+        f.seek(start);
+        f.readBytes((char *)&leadingLength, 1);
+        if (leadingLength != length) {
+            LOG_WARN("Damaged record in %s", pageFilename(c.page).c_str());
+            f.close();
+            c.offset = 0;
+            continue;
+        }
+
+        if (m) {
+            char text[MAX_MESSAGE_SIZE];
+            f.readBytes((char *)&m->timestamp, sizeof(m->timestamp));
+            f.readBytes((char *)&m->sender, sizeof(m->sender));
+            f.readBytes((char *)&m->channelIndex, sizeof(m->channelIndex));
+            f.readBytes(text, length);
+            m->text.assign(text, length);
+        }
+        f.close();
+
+        c.offset = start;
+        c.index++;
+        return true;
+    }
+#endif
+    return false;
+}
+
+// Messages used to be saved as a single snapshot at shutdown (saveToFlash)
+// If we find one of those but no log yet, move its messages into the log
+void InkHUD::MessageStore::migrateSnapshot()
+{
+#ifdef FSCom
+    spiLock->lock();
+    bool haveSnapshot = FSCom.exists(filename.c_str()) && !FSCom.exists(pageFilename(0).c_str());
+    spiLock->unlock();
+    if (!haveSnapshot)
+        return;
+
+    LOG_INFO("Moving messages from %s to %s", filename.c_str(), pageFilename(0).c_str());
+    loadFromFlash();
+    std::deque<Message> snapshot;
+    snapshot.swap(messages);
+    for (auto it = snapshot.rbegin(); it != snapshot.rend(); ++it) // Oldest first
+        append(*it);
+
+    spiLock->lock();
+    FSCom.remove(filename.c_str());
+    fileManifestChanged();
+    spiLock->unlock();
+#endif
+}
+
+#endif
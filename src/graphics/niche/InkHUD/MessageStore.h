@@ -6,6 +6,13 @@ We hold a few recent messages, for features like the threaded message applet.
 This class contains a struct for storing those messages,
 and methods for serializing them to flash.
 
+Two ways to use flash:
+- saveToFlash / loadFromFlash: snapshot the whole of MessageStore::messages, in one file
+- append / loadRecent / loadOlder: a log, for message history which should outlive RAM.
+  Each new message writes one record. The log is kept as two pages of at most MESSAGE_LOG_PAGE_SIZE bytes:
+  when the current page fills, it becomes the older page, and the previous older page is deleted.
+  Only a window of recent messages is held in RAM. Older records are read back from flash only when asked for.
+
 */
 
 #pragma once
@@ -16,6 +23,11 @@ and methods for serializing them to flash.
 
 #include "mesh/MeshTypes.h"
 
+// Bytes per page of message log. Two pages are kept
+#ifndef MESSAGE_LOG_PAGE_SIZE
+#define MESSAGE_LOG_PAGE_SIZE 4096
+#endif
+
 namespace NicheGraphics::InkHUD
 {
 
@@ -36,10 +48,28 @@ class MessageStore
     void saveToFlash();
     void loadFromFlash();
 
+    void append(const Message &m);  // Add a new message to the front of messages, and write its record to the log
+    void loadRecent(uint8_t count); // Replace messages with up to count of the newest records in the log
+    bool loadOlder();               // Add the next older record to the back of messages. False if the log has no more
+
     std::deque<Message> messages; // Interact with this object!
 
   private:
+    // Where in the log a backwards walk over its records has got to
+    struct LogCursor {
+        uint32_t index = 0;  // How many records newer than this point
+        uint8_t page = 0;    // 0: current page, 1: older page, 2: off the end of the log
+        uint32_t offset = 0; // End of the next record, in that page
+        bool valid = false;
+    };
+
+    bool readOlderRecord(LogCursor &cursor, Message *m);
+    void migrateSnapshot();
+    std::string pageFilename(uint8_t page);
+
     std::string filename;
+    std::string logFilename;
+    LogCursor cursor; // Cached, so loading records one after another doesn't rewalk the log from its newest end
 };
 
 } // namespace NicheGraphics::InkHUD
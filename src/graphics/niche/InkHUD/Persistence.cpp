@@ -4,6 +4,26 @@
 
 using namespace NicheGraphics;
 
+InkHUD::Persistence::Persistence() : concurrency::OSThread("InkHUDPersistence")
+{
+    // Nothing to write until settings are loaded
+    OSThread::disable();
+}
+
+static bool sameMessage(const InkHUD::MessageStore::Message &a, const InkHUD::MessageStore::Message &b)
+{
+    return a.timestamp == b.timestamp && a.sender == b.sender && a.channelIndex == b.channelIndex && a.text == b.text;
+}
+
+// Write back whatever changed since the last check
+// Many small changes (rotating applets, incoming messages) become one write per interval, instead of one each
+int32_t InkHUD::Persistence::runOnce()
+{
+    saveSettings();
+    saveLatestMessage();
+    return INKHUD_PERSISTENCE_INTERVAL_MS;
+}
+
 // Load settings and latestMessage data
 void InkHUD::Persistence::loadSettings()
 {
@@ -15,6 +35,13 @@ void InkHUD::Persistence::loadSettings()
         settings = loadedSettings; // Version matched, replace the defaults with the loaded values
     else
         LOG_WARN("Settings version changed. Using defaults");
+
+    // Bytewise, as FlashData hashes it
+    memcpy(&savedSettings, &settings, sizeof(Settings));
+
+    // Start checking for changes
+    OSThread::setIntervalFromNow(INKHUD_PERSISTENCE_INTERVAL_MS);
+    OSThread::enabled = true;
 }
 
 // Load settings and latestMessage data
@@ -34,23 +61,34 @@ void InkHUD::Persistence::loadLatestMessage()
         latestMessage.broadcast = store.messages.at(1);
         latestMessage.wasBroadcast = true;
     }
+
+    savedLatestMessage = latestMessage;
 }
 
 // Save the InkHUD settings to flash
 void InkHUD::Persistence::saveSettings()
 {
+    if (memcmp(&savedSettings, &settings, sizeof(Settings)) == 0)
+        return;
+
     FlashData<Settings>::save(&settings, "settings");
+    memcpy(&savedSettings, &settings, sizeof(Settings));
 }
 
 // Save latestMessage data to flash
 void InkHUD::Persistence::saveLatestMessage()
 {
+    if (latestMessage.wasBroadcast == savedLatestMessage.wasBroadcast && sameMessage(latestMessage.dm, savedLatestMessage.dm) &&
+        (!latestMessage.wasBroadcast || sameMessage(latestMessage.broadcast, savedLatestMessage.broadcast)))
+        return;
+
     // Number of strings saved determines whether last message was broadcast or dm
     MessageStore store("latest");
     store.messages.push_back(latestMessage.dm);
     if (latestMessage.wasBroadcast)
         store.messages.push_back(latestMessage.broadcast);
     store.saveToFlash();
+    savedLatestMessage = latestMessage;
 }
 
 /*
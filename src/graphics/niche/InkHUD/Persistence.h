@@ -8,6 +8,9 @@ Potentially a polite option, to avoid polluting the generated code with values f
 
 The save / load mechanism is a shared NicheGraphics feature.
 
+Changes are written back in batches: every INKHUD_PERSISTENCE_INTERVAL_MS we compare with what was last loaded or saved,
+and write only the parts that differ. Also at shutdown / reboot, again only if something changed.
+
 */
 
 #pragma once
@@ -15,15 +18,24 @@ The save / load mechanism is a shared NicheGraphics feature.
 #include "configuration.h"
 
 #include "./InkHUD.h"
+#include "concurrency/OSThread.h"
 #include "graphics/niche/InkHUD/MessageStore.h"
 #include "graphics/niche/Utils/FlashData.h"
 
+// How often changed settings / latest message are written to flash, so they survive losing power without a shutdown
+// Changes made meanwhile (rotating applets, new messages) share a single write
+#ifndef INKHUD_PERSISTENCE_INTERVAL_MS
+#define INKHUD_PERSISTENCE_INTERVAL_MS (10 * 60 * 1000UL)
+#endif
+
 namespace NicheGraphics::InkHUD
 {
 
-class Persistence
+class Persistence : protected concurrency::OSThread
 {
   public:
+    Persistence();
+
     static constexpr uint8_t MAX_TILES_GLOBAL = 4;
     static constexpr uint8_t MAX_USERAPPLETS_GLOBAL = 16;
 
@@ -113,18 +125,25 @@ class Persistence
     struct LatestMessage {
         MessageStore::Message broadcast; // Most recent message received broadcast
         MessageStore::Message dm;        // Most recent received DM
-        bool wasBroadcast;               // True if most recent broadcast is newer than most recent dm
+        bool wasBroadcast = false;       // True if most recent broadcast is newer than most recent dm
     };
 
     void loadSettings();
-    void saveSettings();
+    void saveSettings(); // Only writes if changed since last load / save
     void loadLatestMessage();
-    void saveLatestMessage();
+    void saveLatestMessage(); // Only writes if changed since last load / save
 
     // void printSettings(Settings *settings); // Debugging use only
 
     Settings settings;
     LatestMessage latestMessage;
+
+  private:
+    int32_t runOnce() override; // Periodically write anything which changed
+
+    // Copies of what flash holds, to tell whether a write is needed
+    Settings savedSettings;
+    LatestMessage savedLatestMessage;
 };
 
 } // namespace NicheGraphics::InkHUD
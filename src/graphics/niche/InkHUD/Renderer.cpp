@@ -121,6 +121,64 @@ void InkHUD::Renderer::handlePixel(int16_t x, int16_t y, Color c)
     bitWrite(imageBuffer[byteNum], bitNum, c);
 }
 
+// Receives a filled rect of pixels from an applet (via a tile, which translates and crops the coordinates)
+// Any rotation we use turns a rect into another rect, so we rotate just two opposite corners, then fill the image buffer a row
+// at a time. Whichever way the display is turned, runs of text, lines and fills are set a byte at a time where they can be
+void InkHUD::Renderer::handleRect(int16_t x, int16_t y, uint16_t w, uint16_t h, Color c)
+{
+    if (!w || !h)
+        return;
+
+    // Rotate opposite corners, then order them top-left to bottom-right
+    int16_t x0 = x, y0 = y;
+    int16_t x1 = x + w - 1, y1 = y + h - 1;
+    rotatePixelCoords(&x0, &y0);
+    rotatePixelCoords(&x1, &y1);
+    if (x0 > x1) {
+        int16_t swap = x0;
+        x0 = x1;
+        x1 = swap;
+    }
+    if (y0 > y1) {
+        int16_t swap = y0;
+        y0 = y1;
+        y1 = swap;
+    }
+
+    for (int16_t row = y0; row <= y1; row++)
+        fillBufferRow(row, x0, x1, c);
+}
+
+// Set a run of one row of the image buffer
+// Leftmost pixel of each byte is its most significant bit; the bytes between the two ends are set whole
+void InkHUD::Renderer::fillBufferRow(int16_t y, int16_t x0, int16_t x1, Color c)
+{
+    uint8_t *row = imageBuffer + (y * imageBufferWidth);
+    uint16_t firstByte = x0 / 8;
+    uint16_t lastByte = x1 / 8;
+    uint8_t firstMask = 0xFF >> (x0 % 8); // Leftmost pixel is most significant bit
+    uint8_t lastMask = 0xFF << (7 - (x1 % 8));
+
+    if (firstByte == lastByte)
+        firstMask &= lastMask;
+
+    if (c == WHITE)
+        row[firstByte] |= firstMask;
+    else
+        row[firstByte] &= ~firstMask;
+
+    if (firstByte == lastByte)
+        return;
+
+    if (lastByte - firstByte > 1)
+        memset(row + firstByte + 1, (c == WHITE) ? 0xFF : 0x00, lastByte - firstByte - 1);
+
+    if (c == WHITE)
+        row[lastByte] |= lastMask;
+    else
+        row[lastByte] &= ~lastMask;
+}
+
 // Width of the display, relative to rotation
 uint16_t InkHUD::Renderer::width()
 {
@@ -219,16 +277,29 @@ void InkHUD::Renderer::render(bool async)
         Drivers::EInk::UpdateTypes updateType = decideUpdateType();
 
         // Render the new image
-        clearBuffer();
-        renderUserApplets();
-        renderPlaceholders();
-        renderSystemApplets();
+        // If nothing has moved since last time, redraw only the user applets which asked, over the old image
+        std::vector<Applet *> shown = getShownApplets();
+        if (canRenderChanges(shown)) {
+            if (imageBufferInverted)
+                invertBuffer();
+            renderChangedUserApplets();
+            renderSystemApplets(); // Back on top of any tile they overlap
+        } else {
+            clearBuffer();
+            renderUserApplets();
+            renderPlaceholders();
+            renderSystemApplets();
+        }
+        renderedApplets = shown;
+        renderedRotation = settings->rotation;
+        renderedValid = true;
 
         // Invert Buffer if set by user
+        // Left inverted while the driver reads it; put back before the next render draws over it
+        imageBufferInverted = false;
         if (config.display.displaymode == meshtastic_Config_DisplayConfig_DisplayMode_INVERTED) {
-            for (size_t i = 0; i < imageBufferWidth * imageBufferHeight; ++i) {
-                imageBuffer[i] = ~imageBuffer[i];
-            }
+            invertBuffer();
+            imageBufferInverted = true;
         }
 
         // Tell display to begin process of drawing new image
@@ -252,13 +323,19 @@ void InkHUD::Renderer::render(bool async)
 // Manually fill the image buffer with WHITE
 // Clears any old drawing
 // Note: benchmarking revealed that this is *much* faster than setting pixels individually
-// So much so that it's more efficient to re-render all applets,
-// rather than rendering selectively, and manually blanking a portion of the display
+// Blanking a single tile is now done a byte at a time too (fillBufferRow), see Tile::clear
 void InkHUD::Renderer::clearBuffer()
 {
     memset(imageBuffer, 0xFF, imageBufferHeight * imageBufferWidth);
 }
 
+void InkHUD::Renderer::invertBuffer()
+{
+    for (size_t i = 0; i < imageBufferWidth * imageBufferHeight; ++i) {
+        imageBuffer[i] = ~imageBuffer[i];
+    }
+}
+
 void InkHUD::Renderer::checkLocks()
 {
     lockRendering = nullptr;
@@ -336,6 +413,38 @@ Drivers::EInk::UpdateTypes InkHUD::Renderer::decideUpdateType()
     return displayHealth.decideUpdateType();
 }
 
+// Applets which would be drawn if we rendered now: user applets by tile, then system applets
+// If this matches the last render, every applet still has the same place on screen
+std::vector<InkHUD::Applet *> InkHUD::Renderer::getShownApplets()
+{
+    std::vector<Applet *> shown;
+    for (Applet *ua : inkhud->userApplets) {
+        if (ua && ua->isActive() && ua->isForeground())
+            shown.push_back(ua);
+    }
+    for (SystemApplet *sa : inkhud->systemApplets) {
+        if (sa->isForeground())
+            shown.push_back(sa);
+    }
+    return shown;
+}
+
+// Can we keep the image from the last render, and redraw only the user applets which requested an update?
+// Layout, rotation, tile highlighting and menu changes all arrive as forceUpdate, so those always render everything.
+// System applets draw over user tiles (without always blanking behind them), so any change there renders everything too.
+bool InkHUD::Renderer::canRenderChanges(const std::vector<Applet *> &shown)
+{
+    if (forced || lockRendering || !renderedValid || renderedRotation != settings->rotation)
+        return false;
+
+    for (SystemApplet *sa : inkhud->systemApplets) {
+        if (sa->isForeground() && sa->wantsToRender())
+            return false;
+    }
+
+    return shown == renderedApplets;
+}
+
 // Run the drawing operations of any user applets which are currently displayed
 // Pixel output is placed into the framebuffer, ready for handoff to the EInk driver
 void InkHUD::Renderer::renderUserApplets()
@@ -355,6 +464,21 @@ void InkHUD::Renderer::renderUserApplets()
     }
 }
 
+// Redraw only the displayed user applets which requested an update, over their blanked tile
+// The other tiles keep what they drew last time
+void InkHUD::Renderer::renderChangedUserApplets()
+{
+    for (Applet *ua : inkhud->userApplets) {
+        if (ua && ua->isActive() && ua->isForeground() && ua->wantsToRender()) {
+            uint32_t start = millis();
+            ua->getTile()->clear();
+            ua->render(); // Draw!
+            uint32_t stop = millis();
+            LOG_DEBUG("%s took %dms to render (alone)", ua->name, stop - start);
+        }
+    }
+}
+
 // Run the drawing operations of any system applets which are currently displayed
 // Pixel output is placed into the framebuffer, ready for handoff to the EInk driver
 void InkHUD::Renderer::renderSystemApplets()
@@ -46,6 +46,7 @@ class Renderer : protected concurrency::OSThread
 
     // Receives pixel output from an applet (via a tile, which translates the coordinates)
     void handlePixel(int16_t x, int16_t y, Color c);
+    void handleRect(int16_t x, int16_t y, uint16_t w, uint16_t h, Color c); // Filled, already cropped to the display
 
     // Size of display, in context of current rotation
 
@@ -59,16 +60,23 @@ class Renderer : protected concurrency::OSThread
     // Apply the display rotation to handled pixels
     void rotatePixelCoords(int16_t *x, int16_t *y);
 
+    // Set pixels x0 to x1 (inclusive) of one row of the image buffer, a byte at a time
+    void fillBufferRow(int16_t y, int16_t x0, int16_t x1, Color c);
+
     // Execute the render process now, then hand off to driver for display update
     void render(bool async = true);
 
     // Steps of the rendering process
 
     void clearBuffer();
+    void invertBuffer();
     void checkLocks();
     bool shouldUpdate();
     Drivers::EInk::UpdateTypes decideUpdateType();
+    std::vector<Applet *> getShownApplets();
+    bool canRenderChanges(const std::vector<Applet *> &shown);
     void renderUserApplets();
+    void renderChangedUserApplets();
     void renderSystemApplets();
     void renderPlaceholders();
 
@@ -79,6 +87,12 @@ class Renderer : protected concurrency::OSThread
     uint16_t imageBufferHeight = 0;
     uint16_t imageBufferWidth = 0;
     uint32_t imageBufferSize = 0; // Bytes
+    bool imageBufferInverted = false; // Left inverted after the last render, for the displaymode setting
+
+    // What the image buffer holds from the last render, so the next can redraw only the applets which changed
+    std::vector<Applet *> renderedApplets; // Shown applets, user then system
+    uint8_t renderedRotation = 0;
+    bool renderedValid = false;
 
     SystemApplet *lockRendering = nullptr; // Render this applet *only*
     SystemApplet *lockRequests = nullptr;  // Honor update requests from this applet *only*
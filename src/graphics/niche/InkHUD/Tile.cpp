@@ -190,6 +190,27 @@ void InkHUD::Tile::handleAppletPixel(int16_t x, int16_t y, Color c)
     }
 }
 
+// Receive a filled rect of pixels from our assigned applet (a run, a line or a fill), translated and cropped like
+// handleAppletPixel
+void InkHUD::Tile::handleAppletRect(int16_t x, int16_t y, uint16_t w, uint16_t h, Color c)
+{
+    x += left;
+    y += top;
+
+    int16_t x0 = max(x, left);
+    int16_t x1 = min((int16_t)(x + w), (int16_t)(left + width)); // Exclusive
+    int16_t y0 = max(y, top);
+    int16_t y1 = min((int16_t)(y + h), (int16_t)(top + height)); // Exclusive
+    if (x1 > x0 && y1 > y0)
+        inkhud->fillRect(x0, y0, x1 - x0, y1 - y0, c);
+}
+
+// Blank our region of the image, so our applet can redraw without re-rendering the whole display
+void InkHUD::Tile::clear()
+{
+    handleAppletRect(0, 0, width, height, WHITE);
+}
+
 // Called by Applet base class, when setting applet dimensions, immediately before render
 uint16_t InkHUD::Tile::getWidth()
 {
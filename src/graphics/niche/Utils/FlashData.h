@@ -161,6 +161,7 @@ inline void clearFlashData()
         LOG_DEBUG("Erasing %s", path.c_str());
         file.close();
         FSCom.remove(path.c_str());
+        fileManifestChanged();
 
         file = dir.openNextFile();
     }
@@ -274,7 +274,21 @@ int32_t ButtonThread::runOnce()
         }
     }
     btnEvent = BUTTON_EVENT_NONE;
-    return 50;
+
+    // Between gestures only an edge, which wakeFromIsr() tells us about, can start the next one, so don't keep the CPU up
+    // polling for it
+    if (userButton.isIdle() && !buttonCurrentlyPressed && !waitingForLongPress)
+        return INT32_MAX;
+    return BUTTON_POLL_MS;
+}
+
+IRAM_ATTR void ButtonThread::wakeFromIsr()
+{
+    userButton.tick();
+    setInterval(0);
+    runASAP = true;
+    BaseType_t higherWake = 0;
+    mainDelay.interruptFromISR(&higherWake);
 }
 
 /*
@@ -311,6 +325,7 @@ int ButtonThread::beforeLightSleep(void *unused)
 int ButtonThread::afterLightSleep(esp_sleep_wakeup_cause_t cause)
 {
     attachButtonInterrupts();
+    setIntervalFromNow(0); // The press that woke us came while our interrupt was detached
     return 0; // Indicates success
 }
 
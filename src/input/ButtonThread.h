@@ -43,6 +43,8 @@ struct ButtonConfig {
 #define BUTTON_LEADUP_MS 2200 // Play lead-up sound after 2.5 seconds of holding
 #endif
 
+#define BUTTON_POLL_MS 50 // While a gesture is under way
+
 class ButtonThread : public Observable<const InputEvent *>, public concurrency::OSThread
 {
   public:
@@ -67,6 +69,9 @@ class ButtonThread : public Observable<const InputEvent *>, public concurrency::
     OneButton userButton;
     void attachButtonInterrupts();
     void detachButtonInterrupts();
+
+    /// For the button's interrupt routine: feed the edge to OneButton and run the thread now
+    void wakeFromIsr();
     void storeClickCount();
     bool isButtonPressed(int buttonPin)
     {
@@ -1,9 +1,14 @@
 #include "InputBroker.h"
 #include "PowerFSM.h" // needed for event trigger
+#include "main.h"
+#include <string.h>
 
 InputBroker *inputBroker = nullptr;
 
-InputBroker::InputBroker(){};
+InputBroker::InputBroker() : concurrency::OSThread("InputBroker")
+{
+    disable(); // Nothing to dispatch until a source sends us something
+};
 
 void InputBroker::registerSource(Observable<const InputEvent *> *source)
 {
@@ -15,4 +20,56 @@ int InputBroker::handleInputEvent(const InputEvent *event)
     powerFSM.trigger(EVENT_INPUT); // todo: not every input should wake, like long hold release
     this->notifyObservers(event);
     return 0;
-}
\ No newline at end of file
+}
+
+static bool isMotion(input_broker_event e)
+{
+    return e == INPUT_BROKER_UP || e == INPUT_BROKER_DOWN || e == INPUT_BROKER_LEFT || e == INPUT_BROKER_RIGHT;
+}
+
+int InputBroker::queueInputEvent(const InputEvent *event)
+{
+    if (queued) {
+        QueuedEvent &last = queue[queued - 1];
+        if (isMotion(event->inputEvent) && last.event.inputEvent == event->inputEvent && last.event.source == event->source &&
+            last.repeat < UINT8_MAX) {
+            last.repeat++;
+            return 0;
+        }
+    }
+    if (queued == INPUT_BROKER_QUEUE_SIZE)
+        dispatchQueue(); // Keep the order rather than dropping anything
+
+    queue[queued].event = *event;
+    queue[queued].repeat = 0;
+    queued++;
+
+    enabled = true;
+    setInterval(0);
+    runASAP = true;
+    return 0;
+}
+
+void InputBroker::dispatchQueue()
+{
+    if (!queued)
+        return;
+    powerFSM.trigger(EVENT_INPUT); // todo: not every input should wake, like long hold release
+
+    // Observers may send us more events while we deliver these, those wait for the next pass
+    uint8_t n = queued;
+    QueuedEvent batch[INPUT_BROKER_QUEUE_SIZE];
+    memcpy(batch, queue, n * sizeof(queue[0]));
+    queued = 0;
+
+    for (uint8_t i = 0; i < n; i++) {
+        for (uint16_t r = 0; r <= batch[i].repeat; r++)
+            this->notifyObservers(&batch[i].event);
+    }
+}
+
+int32_t InputBroker::runOnce()
+{
+    dispatchQueue();
+    return queued ? 0 : disable();
+}
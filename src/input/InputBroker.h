@@ -1,5 +1,6 @@
 #pragma once
 #include "Observer.h"
+#include "concurrency/OSThread.h"
 
 enum input_broker_event {
     INPUT_BROKER_NONE = 0,
@@ -31,6 +32,13 @@ enum input_broker_event {
 #define INPUT_BROKER_MSG_TAB 0x09
 #define INPUT_BROKER_MSG_EMOTE_LIST 0x8F
 
+#ifndef INPUT_BROKER_IRQ_IDLE_MSEC
+#define INPUT_BROKER_IRQ_IDLE_MSEC (30 * 1000) // How often keyboards that interrupt on a keypress are still polled while idle
+#endif
+#ifndef INPUT_BROKER_QUEUE_SIZE
+#define INPUT_BROKER_QUEUE_SIZE 8 // Events from input sources waiting for the next pass of the main loop
+#endif
+
 typedef struct _InputEvent {
     const char *source;
     input_broker_event inputEvent;
@@ -38,10 +46,16 @@ typedef struct _InputEvent {
     uint16_t touchX;
     uint16_t touchY;
 } InputEvent;
-class InputBroker : public Observable<const InputEvent *>
+/**
+ * Events from the registered sources are queued and handed to our observers together on the next pass of the main loop,
+ * so a burst of encoder detents or key repeats costs one wakeup of the power FSM and lets the screen redraw once for all
+ * of them.  Back to back repeats of the same motion event from one source share a queue slot with a repeat count, so a
+ * fast spin can't overflow the queue.  Injected events are still handled right away.
+ */
+class InputBroker : public Observable<const InputEvent *>, public concurrency::OSThread
 {
     CallbackObserver<InputBroker, const InputEvent *> inputEventObserver =
-        CallbackObserver<InputBroker, const InputEvent *>(this, &InputBroker::handleInputEvent);
+        CallbackObserver<InputBroker, const InputEvent *>(this, &InputBroker::queueInputEvent);
 
   public:
     InputBroker();
@@ -50,6 +64,18 @@ class InputBroker : public Observable<const InputEvent *>
 
   protected:
     int handleInputEvent(const InputEvent *event);
+    int queueInputEvent(const InputEvent *event);
+    virtual int32_t runOnce() override;
+
+  private:
+    struct QueuedEvent {
+        InputEvent event;
+        uint8_t repeat; // How many more times to deliver event after the first
+    };
+    QueuedEvent queue[INPUT_BROKER_QUEUE_SIZE];
+    uint8_t queued = 0;
+
+    void dispatchQueue();
 };
 
 extern InputBroker *inputBroker;
\ No newline at end of file
@@ -24,166 +24,276 @@ LinuxInput::LinuxInput(const char *name) : concurrency::OSThread(name)
 }
 
 void LinuxInput::deInit()
+{
+    if (waiter) {
+        uint64_t one = 1;
+        if (write(stopfd, &one, sizeof(one)) == sizeof(one))
+            waiter->join();
+        else
+            waiter->detach();
+        delete waiter;
+        waiter = nullptr;
+    }
+    closeDevice();
+    if (inotifyfd >= 0)
+        close(inotifyfd);
+    if (stopfd >= 0)
+        close(stopfd);
+    if (epollfd >= 0)
+        close(epollfd);
+    inotifyfd = stopfd = epollfd = -1;
+}
+
+bool LinuxInput::openDevice()
+{
+    fd = open(settingsStrings[keyboardDevice].c_str(), O_RDWR | O_NONBLOCK);
+    if (fd < 0)
+        return false;
+    if (ioctl(fd, EVIOCGRAB, (void *)1) != 0) {
+        LOG_WARN("Can't grab %s, is something else using it?", settingsStrings[keyboardDevice].c_str());
+        closeDevice();
+        return false;
+    }
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.fd = fd;
+    if (epoll_ctl(epollfd, EPOLL_CTL_ADD, fd, &ev)) {
+        perror("unable to epoll add");
+        closeDevice();
+        return false;
+    }
+    LOG_INFO("Opened keyboard %s", settingsStrings[keyboardDevice].c_str());
+    kb_found = true;
+    return true;
+}
+
+void LinuxInput::closeDevice()
 {
     if (fd >= 0)
-        close(fd);
+        close(fd); // Also takes it out of the epoll set
+    fd = -1;
+    modifiers = 0;
 }
 
-int32_t LinuxInput::runOnce()
+/// Watch the directory the device lives in, so we notice when it is plugged back in
+void LinuxInput::watchDirectory()
 {
+    std::string dir = settingsStrings[keyboardDevice];
+    size_t slash = dir.rfind('/');
+    dir = slash == std::string::npos ? "." : dir.substr(0, slash ? slash : 1);
+
+    inotifyfd = inotify_init1(IN_NONBLOCK);
+    if (inotifyfd < 0)
+        return;
+    if (inotify_add_watch(inotifyfd, dir.c_str(), IN_CREATE | IN_ATTRIB | IN_MOVED_TO) < 0) {
+        close(inotifyfd);
+        inotifyfd = -1;
+        return;
+    }
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.fd = inotifyfd;
+    epoll_ctl(epollfd, EPOLL_CTL_ADD, inotifyfd, &ev);
+}
 
+/// Re-enable a EPOLLONESHOT fd after we have drained it
+void LinuxInput::rearm(int which)
+{
+    if (which < 0)
+        return;
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.fd = which;
+    epoll_ctl(epollfd, EPOLL_CTL_MOD, which, &ev);
+}
+
+/**
+ * Runs on its own std::thread and sleeps in the kernel until one of our fds is readable, then wakes the main loop to read
+ * it.  The fds are EPOLLONESHOT, so we don't wake again until runOnce() has drained and rearmed them.
+ */
+void LinuxInput::waitForEvents()
+{
+    while (true) {
+        struct epoll_event ready[MAX_EVENTS];
+        int nfds = epoll_wait(epollfd, ready, MAX_EVENTS, -1);
+        if (nfds < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("epoll_wait failed");
+            return;
+        }
+        for (int i = 0; i < nfds; i++) {
+            if (ready[i].data.fd == stopfd)
+                return;
+        }
+        pending = true;
+        setInterval(0);
+        runASAP = true;
+        concurrency::mainDelay.interrupt();
+    }
+}
+
+int32_t LinuxInput::runOnce()
+{
     if (firstTime) {
+        // This is the first time the OSThread library has called this function, so do port setup
+        firstTime = 0;
         if (settingsStrings[keyboardDevice] == "")
             return disable();
-        fd = open(settingsStrings[keyboardDevice].c_str(), O_RDWR);
-        if (fd < 0)
-            return disable();
-        ret = ioctl(fd, EVIOCGRAB, (void *)1);
-        if (ret != 0)
-            return disable();
 
         epollfd = epoll_create1(0);
         assert(epollfd >= 0);
-
+        stopfd = eventfd(0, 0);
         ev.events = EPOLLIN;
-        ev.data.fd = fd;
-        if (epoll_ctl(epollfd, EPOLL_CTL_ADD, fd, &ev)) {
+        ev.data.fd = stopfd;
+        if (stopfd < 0 || epoll_ctl(epollfd, EPOLL_CTL_ADD, stopfd, &ev)) {
             perror("unable to epoll add");
             return disable();
         }
-        kb_found = true;
-        // This is the first time the OSThread library has called this function, so do port setup
-        firstTime = 0;
+        watchDirectory();
+        if (!openDevice() && inotifyfd < 0)
+            return disable();
+        waiter = new std::thread([this] { waitForEvents(); });
+        return INPUT_BROKER_IRQ_IDLE_MSEC;
     }
+    pending = false;
 
-    int nfds = epoll_wait(epollfd, events, MAX_EVENTS, 1);
-    if (nfds < 0) {
-        printf("%d ", nfds);
-        perror("epoll_wait failed");
-        return disable();
-    } else if (nfds == 0) {
-        return 50;
+    if (inotifyfd >= 0) {
+        char buf[sizeof(struct inotify_event) + NAME_MAX + 1];
+        bool changed = false;
+        while (read(inotifyfd, buf, sizeof(buf)) > 0)
+            changed = true;
+        if (changed && fd < 0)
+            openDevice();
+        rearm(inotifyfd);
     }
 
-    int keys = 0;
-    memset(report, 0, 8);
-    for (int i = 0; i < nfds; i++) {
-
-        struct input_event ev[64];
-        int rd = read(events[i].data.fd, ev, sizeof(ev));
-        assert(rd > ((signed int)sizeof(struct input_event)));
-        for (int j = 0; j < rd / ((signed int)sizeof(struct input_event)); j++) {
-            InputEvent e;
-            e.inputEvent = INPUT_BROKER_NONE;
-            e.source = this->_originName;
-            e.kbchar = 0;
-            unsigned int type, code;
-            type = ev[j].type;
-            code = ev[j].code;
-            int value = ev[j].value;
-            // printf("Event: time %ld.%06ld, ", ev[j].time.tv_sec, ev[j].time.tv_usec);
-
-            if (type == EV_KEY) {
-                uint8_t mod = 0;
-
-                switch (code) {
-                case KEY_LEFTCTRL:
-                    mod = 0x01;
-                    break;
-                case KEY_RIGHTCTRL:
-                    mod = 0x10;
-                    break;
-                case KEY_LEFTSHIFT:
-                    mod = 0x02;
-                    break;
-                case KEY_RIGHTSHIFT:
-                    mod = 0x20;
-                    break;
-                case KEY_LEFTALT:
-                    mod = 0x04;
-                    break;
-                case KEY_RIGHTALT:
-                    mod = 0x40;
-                    break;
-                case KEY_LEFTMETA:
-                    mod = 0x08;
-                    break;
-                }
-                if (value == 1) {
-                    switch (code) {
-                    case KEY_LEFTCTRL:
-                        mod = 0x01;
-                        break;
-                    case KEY_RIGHTCTRL:
-                        mod = 0x10;
-                        break;
-                    case KEY_LEFTSHIFT:
-                        mod = 0x02;
-                        break;
-                    case KEY_RIGHTSHIFT:
-                        mod = 0x20;
-                        break;
-                    case KEY_LEFTALT:
-                        mod = 0x04;
-                        break;
-                    case KEY_RIGHTALT:
-                        mod = 0x40;
-                        break;
-                    case KEY_LEFTMETA:
-                        mod = 0x08;
-                        break;
-                    case KEY_ESC: // ESC
-                        e.inputEvent = INPUT_BROKER_CANCEL;
-                        break;
-                    case KEY_BACK: // Back
-                        e.inputEvent = INPUT_BROKER_BACK;
-                        // e.kbchar = key;
-                        break;
-
-                    case KEY_UP: // Up
-                        e.inputEvent = INPUT_BROKER_UP;
-                        break;
-                    case KEY_DOWN: // Down
-                        e.inputEvent = INPUT_BROKER_DOWN;
-                        break;
-                    case KEY_LEFT: // Left
-                        e.inputEvent = INPUT_BROKER_LEFT;
-                        break;
-                        e.kbchar = INPUT_BROKER_LEFT;
-                    case KEY_RIGHT: // Right
-                        e.inputEvent = INPUT_BROKER_RIGHT;
-                        break;
-                        e.kbchar = 0;
-                    case KEY_ENTER: // Enter
-                        e.inputEvent = INPUT_BROKER_SELECT;
-                        break;
-                    case KEY_POWER:
-                        system("poweroff");
-                        break;
-                    default: // all other keys
-                        if (keymap[code]) {
-                            e.inputEvent = INPUT_BROKER_ANYKEY;
-                            e.kbchar = keymap[code];
-                        }
-                        break;
-                    }
-                }
-                if (ev[j].value) {
-                    modifiers |= mod;
-                } else {
-                    modifiers &= ~mod;
+    if (fd >= 0) {
+        // Everything that queued up since we were woken, in as many reads as it takes
+        struct input_event evs[64];
+        int rd;
+        while ((rd = read(fd, evs, sizeof(evs))) > 0) {
+            for (int j = 0; j < rd / ((signed int)sizeof(struct input_event)); j++)
+                handleEvent(evs[j]);
+        }
+        if (rd == 0 || (errno != EAGAIN && errno != EINTR)) {
+            LOG_WARN("Lost keyboard %s", settingsStrings[keyboardDevice].c_str());
+            closeDevice();
+        } else {
+            rearm(fd);
+        }
+    }
+
+    // Only a wakeup that raced with us returning lands here, to be safe we still look in every now and then
+    return pending ? 0 : INPUT_BROKER_IRQ_IDLE_MSEC;
+}
+
+void LinuxInput::handleEvent(const struct input_event &input)
+{
+    InputEvent e;
+    e.inputEvent = INPUT_BROKER_NONE;
+    e.source = this->_originName;
+    e.kbchar = 0;
+    unsigned int type, code;
+    type = input.type;
+    code = input.code;
+    int value = input.value;
+    // printf("Event: time %ld.%06ld, ", input.time.tv_sec, input.time.tv_usec);
+
+    if (type == EV_KEY) {
+        uint8_t mod = 0;
+
+        switch (code) {
+        case KEY_LEFTCTRL:
+            mod = 0x01;
+            break;
+        case KEY_RIGHTCTRL:
+            mod = 0x10;
+            break;
+        case KEY_LEFTSHIFT:
+            mod = 0x02;
+            break;
+        case KEY_RIGHTSHIFT:
+            mod = 0x20;
+            break;
+        case KEY_LEFTALT:
+            mod = 0x04;
+            break;
+        case KEY_RIGHTALT:
+            mod = 0x40;
+            break;
+        case KEY_LEFTMETA:
+            mod = 0x08;
+            break;
+        }
+        if (value == 1) {
+            switch (code) {
+            case KEY_LEFTCTRL:
+                mod = 0x01;
+                break;
+            case KEY_RIGHTCTRL:
+                mod = 0x10;
+                break;
+            case KEY_LEFTSHIFT:
+                mod = 0x02;
+                break;
+            case KEY_RIGHTSHIFT:
+                mod = 0x20;
+                break;
+            case KEY_LEFTALT:
+                mod = 0x04;
+                break;
+            case KEY_RIGHTALT:
+                mod = 0x40;
+                break;
+            case KEY_LEFTMETA:
+                mod = 0x08;
+                break;
+            case KEY_ESC: // ESC
+                e.inputEvent = INPUT_BROKER_CANCEL;
+                break;
+            case KEY_BACK: // Back
+                e.inputEvent = INPUT_BROKER_BACK;
+                // e.kbchar = key;
+                break;
+
+            case KEY_UP: // Up
+                e.inputEvent = INPUT_BROKER_UP;
+                break;
+            case KEY_DOWN: // Down
+                e.inputEvent = INPUT_BROKER_DOWN;
+                break;
+            case KEY_LEFT: // Left
+                e.inputEvent = INPUT_BROKER_LEFT;
+                break;
+                e.kbchar = INPUT_BROKER_LEFT;
+            case KEY_RIGHT: // Right
+                e.inputEvent = INPUT_BROKER_RIGHT;
+                break;
+                e.kbchar = 0;
+            case KEY_ENTER: // Enter
+                e.inputEvent = INPUT_BROKER_SELECT;
+                break;
+            case KEY_POWER:
+                system("poweroff");
+                break;
+            default: // all other keys
+                if (keymap[code]) {
+                    e.inputEvent = INPUT_BROKER_ANYKEY;
+                    e.kbchar = keymap[code];
                 }
-                report[0] = modifiers;
-            }
-            if (e.inputEvent != INPUT_BROKER_NONE) {
-                if (e.inputEvent == INPUT_BROKER_ANYKEY && (modifiers && 0x22))
-                    e.kbchar = uppers[e.kbchar]; // doesn't get punctuation. Meh.
-                this->notifyObservers(&e);
+                break;
             }
         }
+        if (input.value) {
+            modifiers |= mod;
+        } else {
+            modifiers &= ~mod;
+        }
+        report[0] = modifiers;
+    }
+    if (e.inputEvent != INPUT_BROKER_NONE) {
+        if (e.inputEvent == INPUT_BROKER_ANYKEY && (modifiers && 0x22))
+            e.kbchar = uppers[e.kbchar]; // doesn't get punctuation. Meh.
+        this->notifyObservers(&e);
     }
-
-    return 50; // Keyscan every 50msec to avoid key bounce
 }
 
 #endif
\ No newline at end of file
@@ -3,20 +3,30 @@
 #include "InputBroker.h"
 #include "concurrency/OSThread.h"
 #include <assert.h>
+#include <atomic>
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <linux/input.h>
 #include <map>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <thread>
 #include <unistd.h>
 
 #define MAX_EVENTS 10
 
+/**
+ * Reads the evdev keyboard from settingsStrings[keyboardDevice].  A helper thread blocks in epoll_wait() and wakes the main
+ * loop only when the device has something for us, so an idle keyboard costs no wakeups.  If the device is missing or gets
+ * unplugged we watch its directory with inotify and open it again when it comes back.
+ */
 class LinuxInput : public Observable<const InputEvent *>, public concurrency::OSThread
 {
   public:
@@ -27,6 +37,13 @@ class LinuxInput : public Observable<const InputEvent *>, public concurrency::OS
     virtual int32_t runOnce() override;
 
   private:
+    bool openDevice();
+    void closeDevice();
+    void watchDirectory();
+    void rearm(int which);
+    void waitForEvents();
+    void handleEvent(const struct input_event &input);
+
     const char *_originName;
     bool firstTime = 1;
     int shift = 0;
@@ -37,11 +54,13 @@ class LinuxInput : public Observable<const InputEvent *>, public concurrency::OS
     int queue_length = 0;
     int queue_progress = 0;
 
-    struct epoll_event events[MAX_EVENTS];
     int fd = -1;
-    int ret;
     uint8_t report[8];
-    int epollfd;
+    int epollfd = -1;
+    int inotifyfd = -1;
+    int stopfd = -1; // Written by deInit() to end the waiter thread
+    std::thread *waiter = nullptr;
+    std::atomic<bool> pending{false}; // Set by the waiter thread when it wakes us
     struct epoll_event ev;
     uint8_t modifiers = 0;
     std::map<int, char> keymap{
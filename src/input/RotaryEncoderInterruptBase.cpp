@@ -47,19 +47,30 @@ int32_t RotaryEncoderInterruptBase::runOnce()
     e.inputEvent = INPUT_BROKER_NONE;
     e.source = this->_originName;
 
+    // Wrapping differences, so a detent counted while we read is picked up next time rather than lost
+    uint8_t cw = this->detentsCW - this->sentCW;
+    uint8_t ccw = this->detentsCCW - this->sentCCW;
+    this->sentCW += cw;
+    this->sentCCW += ccw;
+    int steps = 0;
+
     if (this->action == ROTARY_ACTION_PRESSED) {
         LOG_DEBUG("Rotary event Press");
         e.inputEvent = this->_eventPressed;
-    } else if (this->action == ROTARY_ACTION_CW) {
-        LOG_DEBUG("Rotary event CW");
+        steps = 1;
+    } else if (cw > ccw) {
+        LOG_DEBUG("Rotary event CW x%d", cw - ccw);
         e.inputEvent = this->_eventCw;
-    } else if (this->action == ROTARY_ACTION_CCW) {
-        LOG_DEBUG("Rotary event CCW");
+        steps = cw - ccw;
+    } else if (ccw > cw) {
+        LOG_DEBUG("Rotary event CCW x%d", ccw - cw);
         e.inputEvent = this->_eventCcw;
+        steps = ccw - cw;
     }
 
     if (e.inputEvent != INPUT_BROKER_NONE) {
-        this->notifyObservers(&e);
+        for (int i = 0; i < steps; i++)
+            this->notifyObservers(&e);
     }
 
     this->action = ROTARY_ACTION_NONE;
@@ -112,8 +123,12 @@ RotaryEncoderInterruptBaseStateType RotaryEncoderInterruptBase::intHandler(bool
     if (actualPinRaising && (otherPinLevel == LOW)) {
         if (state == ROTARY_EVENT_CLEARED) {
             newState = ROTARY_EVENT_OCCURRED;
-            if ((this->action != ROTARY_ACTION_PRESSED) && (this->action != action)) {
+            if (this->action != ROTARY_ACTION_PRESSED) {
                 this->action = action;
+                if (action == ROTARY_ACTION_CW)
+                    this->detentsCW++;
+                else
+                    this->detentsCCW++;
             }
         }
     } else if (!actualPinRaising && (otherPinLevel == HIGH)) {
@@ -31,6 +31,9 @@ class RotaryEncoderInterruptBase : public Observable<const InputEvent *>, public
     volatile int rotaryLevelA = LOW;
     volatile int rotaryLevelB = LOW;
     volatile RotaryEncoderInterruptBaseActionType action = ROTARY_ACTION_NONE;
+    // Detents counted by the ISRs, which only ever increment these, so runOnce() can send every detent since its last run
+    volatile uint8_t detentsCW = 0;
+    volatile uint8_t detentsCCW = 0;
 
   private:
     uint8_t _pinA = 0;
@@ -39,4 +42,6 @@ class RotaryEncoderInterruptBase : public Observable<const InputEvent *>, public
     input_broker_event _eventCcw = INPUT_BROKER_NONE;
     input_broker_event _eventPressed = INPUT_BROKER_NONE;
     const char *_originName;
+    uint8_t sentCW = 0;
+    uint8_t sentCCW = 0;
 };
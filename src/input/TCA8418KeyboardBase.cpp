@@ -297,6 +297,13 @@ void TCA8418KeyboardBase::enableInterrupts()
     writeRegister(TCA8418_REG_CFG, value);
 };
 
+bool TCA8418KeyboardBase::clearInterrupt()
+{
+    // Clear K_INT and GPI_INT, then look again in case an event landed in the FIFO just before
+    writeRegister(TCA8418_REG_INT_STAT, 3);
+    return keyCount() == 0;
+}
+
 void TCA8418KeyboardBase::disableInterrupts()
 {
     uint8_t value = readRegister(TCA8418_REG_CFG);
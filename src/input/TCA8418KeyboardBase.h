@@ -41,6 +41,14 @@ class TCA8418KeyboardBase
 
     virtual void setBacklight(bool on);
 
+    // enable / disable interrupts for matrix and GPI pins
+    void enableInterrupts();
+    void disableInterrupts();
+
+    // Release the INT pin once every key event has been read
+    // @return false if more events came in meanwhile, so the caller should read those first
+    bool clearInterrupt();
+
     // Key events available
     virtual bool hasEvent(void) const;
     virtual char dequeueEvent(void);
@@ -141,10 +149,6 @@ class TCA8418KeyboardBase
     void enableDebounce();
     void disableDebounce();
 
-    // enable / disable interrupts for matrix and GPI pins
-    void enableInterrupts();
-    void disableInterrupts();
-
     // ignore key events when FIFO buffer is full or not.
     void enableMatrixOverflow();
     void disableMatrixOverflow();
@@ -2,6 +2,7 @@
 #include "configuration.h"
 #include "detect/ScanI2C.h"
 #include "detect/ScanI2CTwoWire.h"
+#include "main.h"
 
 #if defined(T_DECK_PRO)
 #include "TDeckProKeyboard.h"
@@ -14,6 +15,18 @@
 extern ScanI2C::DeviceAddress cardkb_found;
 extern uint8_t kb_model;
 
+#ifdef KB_INT
+static KbI2cBase *interruptInstance;
+
+IRAM_ATTR void KbI2cBase::keyInterrupt()
+{
+    interruptInstance->setInterval(0);
+    runASAP = true;
+    BaseType_t higherPriWoken = 0;
+    concurrency::mainDelay.interruptFromISR(&higherPriWoken);
+}
+#endif
+
 KbI2cBase::KbI2cBase(const char *name)
     : concurrency::OSThread(name),
 #if defined(T_DECK_PRO)
@@ -82,6 +95,17 @@ int32_t KbI2cBase::runOnce()
         default:
             i2cBus = 0;
         }
+
+#ifdef KB_INT
+        if (i2cBus && cardkb_found.address == TCA8418_KB_ADDR) {
+            interruptInstance = this;
+            pinMode(KB_INT, INPUT_PULLUP);
+            attachInterrupt(digitalPinToInterrupt(KB_INT), keyInterrupt, FALLING);
+            TCAKeyboard.enableInterrupts();
+            usingInterrupt = true;
+            LOG_DEBUG("TCA8418 key events interrupt on pin %d", KB_INT);
+        }
+#endif
     }
 
     switch (kb_model) {
@@ -333,6 +357,12 @@ int32_t KbI2cBase::runOnce()
             }
             TCAKeyboard.trigger();
         }
+#ifdef KB_INT
+        if (usingInterrupt) {
+            // Read any event still in the FIFO straight away, else sleep until the next one pulls KB_INT low
+            return TCAKeyboard.clearInterrupt() ? INPUT_BROKER_IRQ_IDLE_MSEC : 0;
+        }
+#endif
         break;
     }
     case 0x02: {
@@ -25,4 +25,9 @@ class KbI2cBase : public Observable<const InputEvent *>, public concurrency::OST
     MPR121Keyboard MPRkeyboard;
     TCA8418KeyboardBase &TCAKeyboard;
     bool is_sym = false;
+
+#ifdef KB_INT
+    bool usingInterrupt = false; // The keyboard pulls KB_INT low on key events, so we only need to poll after that
+    static void keyInterrupt();
+#endif
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "kbMatrixBase.h"
 #include "configuration.h"
+#include "main.h"
 
 #ifdef INPUTBROKER_MATRIX_TYPE
 
@@ -30,9 +31,29 @@ unsigned char KeyMap[3][sizeof(keys_rows)][sizeof(keys_cols)] = {{{' ', '.', 'm'
                                                                   {'1', '2', '3', '4', '5', 0x1a}}};
 #endif
 
+static KbMatrixBase *matrixInstance;
+
 KbMatrixBase::KbMatrixBase(const char *name) : concurrency::OSThread(name)
 {
     this->_originName = name;
+    matrixInstance = this;
+}
+
+IRAM_ATTR void KbMatrixBase::keyInterrupt()
+{
+    matrixInstance->setInterval(0);
+    runASAP = true;
+    BaseType_t higherPriWoken = 0;
+    concurrency::mainDelay.interruptFromISR(&higherPriWoken);
+}
+
+void KbMatrixBase::waitForKey()
+{
+    for (byte i = 0; i < sizeof(keys_rows); i++)
+        digitalWrite(keys_rows[i], LOW);
+    for (byte i = 0; i < sizeof(keys_cols); i++)
+        attachInterrupt(digitalPinToInterrupt(keys_cols[i]), keyInterrupt, FALLING);
+    waitingForKey = true;
 }
 
 int32_t KbMatrixBase::runOnce()
@@ -54,6 +75,15 @@ int32_t KbMatrixBase::runOnce()
         }
     }
 
+    if (waitingForKey) {
+        for (byte i = 0; i < sizeof(keys_cols); i++)
+            detachInterrupt(digitalPinToInterrupt(keys_cols[i]));
+        for (byte i = 0; i < sizeof(keys_rows); i++)
+            digitalWrite(keys_rows[i], HIGH);
+        waitingForKey = false;
+    }
+
+    bool wasReleased = key == 0;
     key = 0;
 
     if (INPUTBROKER_MATRIX_TYPE == 1) {
@@ -125,6 +155,11 @@ int32_t KbMatrixBase::runOnce()
         LOG_WARN("Unknown kb_model 0x%02x", INPUTBROKER_MATRIX_TYPE);
         return disable();
     }
+    if (key == 0 && wasReleased) {
+        // Nothing held down for two scans in a row, so no bounce to wait out until the next keypress
+        waitForKey();
+        return INPUT_BROKER_IRQ_IDLE_MSEC;
+    }
     return 50; // Keyscan every 50msec to avoid key bounce
 }
 
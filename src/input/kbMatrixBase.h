@@ -14,6 +14,11 @@ class KbMatrixBase : public Observable<const InputEvent *>, public concurrency::
   private:
     const char *_originName;
     bool firstTime = 1;
+    bool waitingForKey = false; // All rows are driven low and any column going low interrupts us
+
+    /// Stop scanning until a key goes down
+    void waitForKey();
+    static void keyInterrupt();
     int shift = 0;
     char key = 0;
     char prevkey = 0;
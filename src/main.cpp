@@ -13,6 +13,8 @@
 
 #include "FSCommon.h"
 #include "Led.h"
+#include "LinkRate.h"
+#include "PresetAdvisor.h"
 #include "RTC.h"
 #include "SPILock.h"
 #include "Throttle.h"
@@ -30,6 +32,7 @@
 #include "graphics/RAKled.h"
 #include "graphics/Screen.h"
 #include "main.h"
+#include "memGet.h"
 #include "mesh/generated/meshtastic/config.pb.h"
 #include "meshUtils.h"
 #include "modules/Modules.h"
@@ -92,7 +95,9 @@ NRF52Bluetooth *nrf52Bluetooth = nullptr;
 
 #ifdef ARCH_PORTDUINO
 #include "linux/LinuxHardwareI2C.h"
+#include "mesh/api/UnixServerAPI.h"
 #include "mesh/raspihttp/PiWebServer.h"
+#include "platform/portduino/PacketCapture.h"
 #include "platform/portduino/PortduinoGlue.h"
 #include "platform/portduino/USBHal.h"
 #include <cstdlib>
@@ -270,6 +275,7 @@ static OSThread *ambientLightingThread;
 RadioInterface *rIf = NULL;
 #ifdef ARCH_PORTDUINO
 RadioLibHal *RadioLibHAL = NULL;
+static RadioInterface *secondaryRIf = NULL; // Lora: Secondary in config.yaml
 #endif
 
 /**
@@ -417,8 +423,7 @@ void setup()
 
 #if ARCH_PORTDUINO
     struct timeval tv;
-    tv.tv_sec = time(NULL);
-    tv.tv_usec = 0;
+    gettimeofday(&tv, NULL); // Down to the msec, for SlottedTx
     perhapsSetRTC(RTCQualityNTP, &tv);
 #endif
 
@@ -793,6 +798,12 @@ void setup()
     } else
         router = new ReliableRouter();
 
+#ifdef CRYPTO_BENCHMARK
+    crypto->benchmark(); // Also selects the AES backends
+#elif CRYPTO_SELECT_BACKEND
+    crypto->selectAESBackend();
+#endif
+
     // only play start melody when role is not tracker or sensor
     if (config.power.is_power_saving == true &&
         IS_ONE_OF(config.device.role, meshtastic_Config_DeviceConfig_Role_TRACKER,
@@ -990,12 +1001,7 @@ void setup()
             config.activeLow = true;
             config.activePullup = true;
             config.pullupSense = INPUT_PULLUP;
-            config.intRoutine = []() {
-                UserButtonThread->userButton.tick();
-                runASAP = true;
-                BaseType_t higherWake = 0;
-                mainDelay.interruptFromISR(&higherWake);
-            };
+            config.intRoutine = []() { UserButtonThread->wakeFromIsr(); };
             config.singlePress = INPUT_BROKER_USER_PRESS;
             config.longPress = INPUT_BROKER_SELECT;
             UserButtonThread->initButton(config);
@@ -1010,12 +1016,7 @@ void setup()
     touchConfig.activeLow = true;
     touchConfig.activePullup = true;
     touchConfig.pullupSense = pullup_sense;
-    touchConfig.intRoutine = []() {
-        TouchButtonThread->userButton.tick();
-        runASAP = true;
-        BaseType_t higherWake = 0;
-        mainDelay.interruptFromISR(&higherWake);
-    };
+    touchConfig.intRoutine = []() { TouchButtonThread->wakeFromIsr(); };
     touchConfig.singlePress = INPUT_BROKER_NONE;
     touchConfig.longPress = INPUT_BROKER_BACK;
     TouchButtonThread->initButton(touchConfig);
@@ -1029,12 +1030,7 @@ void setup()
     cancelConfig.activeLow = CANCEL_BUTTON_ACTIVE_LOW;
     cancelConfig.activePullup = CANCEL_BUTTON_ACTIVE_PULLUP;
     cancelConfig.pullupSense = pullup_sense;
-    cancelConfig.intRoutine = []() {
-        CancelButtonThread->userButton.tick();
-        runASAP = true;
-        BaseType_t higherWake = 0;
-        mainDelay.interruptFromISR(&higherWake);
-    };
+    cancelConfig.intRoutine = []() { CancelButtonThread->wakeFromIsr(); };
     cancelConfig.singlePress = INPUT_BROKER_CANCEL;
     cancelConfig.longPress = INPUT_BROKER_SHUTDOWN;
     cancelConfig.longPressTime = 4000;
@@ -1049,12 +1045,7 @@ void setup()
     backConfig.activeLow = ALT_BUTTON_ACTIVE_LOW;
     backConfig.activePullup = ALT_BUTTON_ACTIVE_PULLUP;
     backConfig.pullupSense = pullup_sense;
-    backConfig.intRoutine = []() {
-        BackButtonThread->userButton.tick();
-        runASAP = true;
-        BaseType_t higherWake = 0;
-        mainDelay.interruptFromISR(&higherWake);
-    };
+    backConfig.intRoutine = []() { BackButtonThread->wakeFromIsr(); };
     backConfig.singlePress = INPUT_BROKER_ALT_PRESS;
     backConfig.longPress = INPUT_BROKER_ALT_LONG;
     backConfig.longPressTime = 500;
@@ -1083,12 +1074,7 @@ void setup()
         userConfig.activeLow = BUTTON_ACTIVE_LOW;
         userConfig.activePullup = BUTTON_ACTIVE_PULLUP;
         userConfig.pullupSense = pullup_sense;
-        userConfig.intRoutine = []() {
-            UserButtonThread->userButton.tick();
-            runASAP = true;
-            BaseType_t higherWake = 0;
-            mainDelay.interruptFromISR(&higherWake);
-        };
+        userConfig.intRoutine = []() { UserButtonThread->wakeFromIsr(); };
         userConfig.singlePress = INPUT_BROKER_USER_PRESS;
         userConfig.longPress = INPUT_BROKER_SELECT;
         userConfig.longPressTime = 500;
@@ -1100,12 +1086,7 @@ void setup()
         userConfigNoScreen.activeLow = BUTTON_ACTIVE_LOW;
         userConfigNoScreen.activePullup = BUTTON_ACTIVE_PULLUP;
         userConfigNoScreen.pullupSense = pullup_sense;
-        userConfigNoScreen.intRoutine = []() {
-            UserButtonThread->userButton.tick();
-            runASAP = true;
-            BaseType_t higherWake = 0;
-            mainDelay.interruptFromISR(&higherWake);
-        };
+        userConfigNoScreen.intRoutine = []() { UserButtonThread->wakeFromIsr(); };
         userConfigNoScreen.singlePress = INPUT_BROKER_USER_PRESS;
         userConfigNoScreen.longPress = INPUT_BROKER_NONE;
         userConfigNoScreen.longPressTime = 500;
@@ -1209,6 +1190,32 @@ void setup()
             }
         }
     }
+    if (rIf && settingsStrings[lora2_module] != "") {
+        for (auto &loraModule : loraModules) {
+            if (settingsStrings[lora2_module] != loraModule.strName)
+                continue;
+            if (settingsStrings[spidev] == "ch341") {
+                LOG_ERROR("A secondary radio needs kernel SPI, not ch341");
+                break;
+            }
+            LOG_DEBUG("Activate secondary %s radio on SPI port %s", loraModule.strName.c_str(), settingsStrings[spidev].c_str());
+            secondaryRIf = loraModuleInterface(loraModule.cfgName, (LockingArduinoHal *)RadioLibHAL, settingsMap[lora2_cs_pin],
+                                               settingsMap[lora2_irq_pin], settingsMap[lora2_reset_pin],
+                                               settingsMap[lora2_busy_pin]);
+            secondaryRIf->setModemOverride((meshtastic_Config_LoRaConfig_ModemPreset)settingsMap[lora2_modem_preset],
+                                           settingsMap[lora2_channel_num]);
+            if (!secondaryRIf->init()) {
+                LOG_ERROR("No secondary %s radio", loraModule.strName.c_str());
+                delete secondaryRIf;
+                secondaryRIf = NULL;
+            } else {
+                LOG_INFO("Secondary %s init success", loraModule.strName.c_str());
+            }
+            break;
+        }
+        if (!secondaryRIf)
+            LOG_ERROR("Secondary radio %s not started, carry on with one", settingsStrings[lora2_module].c_str());
+    }
 #elif defined(HW_SPI1_DEVICE)
     LockingArduinoHal *RadioLibHAL = new LockingArduinoHal(SPI1, spiSettings);
 #else // HW_SPI1_DEVICE
@@ -1460,6 +1467,7 @@ void setup()
     }
 #endif
     initApiServer(TCPPort);
+    initUnixApiServer(settingsStrings[apiSocket]);
 #endif
 
     // Start airtime logger thread.
@@ -1469,6 +1477,21 @@ void setup()
         RECORD_CRITICALERROR(meshtastic_CriticalErrorCode_NO_RADIO);
     else {
         router->addInterface(rIf);
+#ifdef ARCH_PORTDUINO
+        if (secondaryRIf)
+            router->addInterface(secondaryRIf);
+#endif
+#if LINK_RATE_ADAPTATION
+        if (rIf->setLinkSpreadingFactor(0)) // Only radios that can switch spreading factor on the fly
+            linkRate = new LinkRate(rIf);
+#endif
+#if !MESHTASTIC_EXCLUDE_PRESET_ADVISOR
+        presetAdvisor = new PresetAdvisor(rIf);
+#endif
+#ifdef ARCH_PORTDUINO
+        if (replayPath)
+            new PacketReplay(replayPath);
+#endif
 
         // Log bit rate to debug output
         LOG_DEBUG("LoRA bitrate = %f bytes / sec", (float(meshtastic_Constants_DATA_PAYLOAD_LEN) /
@@ -1587,12 +1610,17 @@ void loop()
     nrf52Loop();
 #endif
     power->powerCommandsCheck();
+    memGet.track();
 
 #ifdef DEBUG_STACK
     static uint32_t lastPrint = 0;
     if (!Throttle::isWithinTimespanMs(lastPrint, 10 * 1000L)) {
         lastPrint = millis();
         meshtastic::printThreadInfo("main");
+#if OSTHREAD_PROFILE
+        concurrency::OSThread::logProfiles();
+#endif
+        logSPIHoldStats();
     }
 #endif
 
@@ -1604,11 +1632,15 @@ void loop()
             static_cast<TFTDisplay *>(dispdev)->sdlLoop();
     }
 #endif
+    concurrency::OSThread::startPass();
     long delayMsec = mainController.runOrDelay();
 
     // We want to sleep as long as possible here - because it saves power
     if (!runASAP && loopCanSleep()) {
-        mainDelay.delay(delayMsec);
+#ifdef ARCH_ESP32
+        if (!doIdleSleep(delayMsec))
+#endif
+            mainDelay.delay(delayMsec);
     }
 }
 #endif
@@ -10,11 +10,17 @@
 #include "memGet.h"
 #include "configuration.h"
 
+#include "Throttle.h"
+
 #ifdef ARCH_STM32WL
 #include <malloc.h>
 #endif
+#ifdef ARCH_ESP32
+#include <esp_heap_caps.h>
+#endif
 
 MemGet memGet;
+volatile uint32_t MemGet::allocFailures;
 
 /**
  * Returns the amount of free heap memory in bytes.
@@ -88,4 +94,53 @@ uint32_t MemGet::getPsramSize()
 #else
     return 0;
 #endif
-}
\ No newline at end of file
+}
+/**
+ * Returns the least free heap memory there has been since boot, in bytes.
+ *
+ * ESP-IDF keeps this itself, elsewhere it is the lowest of the samples track() took, so short dips between samples are
+ * missed.
+ */
+uint32_t MemGet::getMinFreeHeap()
+{
+#ifdef ARCH_ESP32
+    return ESP.getMinFreeHeap();
+#else
+    uint32_t free = getFreeHeap();
+    return free < minFreeHeap ? free : minFreeHeap;
+#endif
+}
+
+/**
+ * Returns the largest block of heap memory we could allocate right now, which falls well below the free heap as it
+ * fragments.
+ * @return uint32_t The size of the largest free block in bytes, or 0 if the platform can't tell.
+ */
+uint32_t MemGet::getMaxAllocHeap()
+{
+#ifdef ARCH_ESP32
+    return ESP.getMaxAllocHeap();
+#elif defined(ARCH_PORTDUINO)
+    return UINT32_MAX;
+#else
+    return 0;
+#endif
+}
+
+void MemGet::track()
+{
+#ifdef ARCH_ESP32
+    if (!tracking) {
+        tracking = true;
+        heap_caps_register_failed_alloc_callback([](size_t, uint32_t, const char *) { allocFailures++; });
+    }
+#else
+    if (tracking && Throttle::isWithinTimespanMs(lastSample, MEMGET_SAMPLE_MSEC))
+        return;
+    tracking = true;
+    lastSample = millis();
+    uint32_t free = getFreeHeap();
+    if (free < minFreeHeap)
+        minFreeHeap = free;
+#endif
+}
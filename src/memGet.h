@@ -4,6 +4,10 @@
 
 #include <Arduino.h>
 
+#ifndef MEMGET_SAMPLE_MSEC
+#define MEMGET_SAMPLE_MSEC 1000 // How often track() samples the free heap, where the platform doesn't keep the minimum itself
+#endif
+
 class MemGet
 {
   public:
@@ -11,6 +15,24 @@ class MemGet
     uint32_t getHeapSize();
     uint32_t getFreePsram();
     uint32_t getPsramSize();
+
+    /// The least free heap there has been since boot (exact on ESP32, the lowest track() saw elsewhere)
+    uint32_t getMinFreeHeap();
+
+    /// The largest block we could allocate right now, 0 if the platform can't tell
+    uint32_t getMaxAllocHeap();
+
+    /// Heap allocations that have failed since boot (ESP32 only, always 0 elsewhere)
+    uint32_t getAllocFailures() { return allocFailures; }
+
+    /// Call often, from the main loop
+    void track();
+
+  private:
+    uint32_t minFreeHeap = UINT32_MAX;
+    uint32_t lastSample = 0;
+    bool tracking = false;
+    static volatile uint32_t allocFailures;
 };
 
 extern MemGet memGet;
@@ -0,0 +1,71 @@
+#include "AutoHopLimit.h"
+#include "NodeDB.h"
+#include "configuration.h"
+#if !MESHTASTIC_EXCLUDE_TRACEROUTE
+#include "modules/TraceRouteModule.h"
+#endif
+
+AutoHopLimit autoHopLimit;
+
+uint8_t AutoHopLimit::forPacket(const meshtastic_MeshPacket *p, uint8_t configured)
+{
+    if (!AUTO_HOP_LIMIT || p->hop_limit != configured)
+        return p->hop_limit;
+    if (p->which_payload_variant == meshtastic_MeshPacket_decoded_tag && p->decoded.portnum == meshtastic_PortNum_TRACEROUTE_APP)
+        return p->hop_limit;
+
+    int need;
+    if (isBroadcast(p->to)) {
+        need = radius();
+        if (need == 0)
+            need = 1; // Everyone we know is a neighbour, still let one relay pass it on to whoever we don't know yet
+    } else {
+        need = hopsTo(p->to);
+        if (need >= 0)
+            need += AUTO_HOP_MARGIN;
+    }
+    if (need < 0 || need >= configured)
+        return configured;
+
+    LOG_DEBUG("Auto hop limit %d instead of %u for packet to 0x%x", need, configured, p->to);
+    return need;
+}
+
+int AutoHopLimit::hopsTo(NodeNum n)
+{
+#if !MESHTASTIC_EXCLUDE_TRACEROUTE
+    if (traceRouteModule) {
+        int traced = traceRouteModule->hopsTowards(n, AUTO_HOP_FRESH_SECS * 1000);
+        if (traced >= 0)
+            return traced;
+    }
+#endif
+    // Hop counts of nodes heard through MQTT say nothing about the way over the air
+    const meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(n);
+    if (!node || !node->has_hops_away || node->via_mqtt || sinceLastSeen(node) >= AUTO_HOP_FRESH_SECS)
+        return -1;
+    return node->hops_away;
+}
+
+int AutoHopLimit::radius()
+{
+    uint32_t now = millis();
+    if (haveRadius && now - radiusMsec < AUTO_HOP_RADIUS_MSEC)
+        return cachedRadius;
+
+    int widest = 0;
+    size_t known = 0;
+    for (size_t i = 0; i < nodeDB->getNumMeshNodes(); i++) {
+        const meshtastic_NodeInfoLite *node = nodeDB->getMeshNodeByIndex(i);
+        if (node->num == nodeDB->getNodeNum() || !node->has_hops_away || node->via_mqtt ||
+            sinceLastSeen(node) >= AUTO_HOP_FRESH_SECS)
+            continue;
+        if (node->hops_away > widest)
+            widest = node->hops_away;
+        known++;
+    }
+    cachedRadius = known >= AUTO_HOP_MIN_NODES ? widest : -1;
+    radiusMsec = now;
+    haveRadius = true;
+    return cachedRadius;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "MeshTypes.h"
+
+// Pick the hop limit of the packets we originate from what we know of the mesh, 0 always sends the configured one
+#ifndef AUTO_HOP_LIMIT
+#define AUTO_HOP_LIMIT 1
+#endif
+// Hops a unicast gets beyond what it should need, as the way there needn't be the way their packets came to us
+#ifndef AUTO_HOP_MARGIN
+#define AUTO_HOP_MARGIN 1
+#endif
+// Hop counts older than this don't count
+#ifndef AUTO_HOP_FRESH_SECS
+#define AUTO_HOP_FRESH_SECS (3 * 60 * 60)
+#endif
+// Nodes with a fresh hop count we need to have heard before broadcasts go by the radius they span
+#ifndef AUTO_HOP_MIN_NODES
+#define AUTO_HOP_MIN_NODES 3
+#endif
+#define AUTO_HOP_RADIUS_MSEC (10 * 60 * 1000) // How long a radius is reused before the node DB is scanned again
+
+/**
+ * The hop limit for a packet we originate, instead of the configured one whatever the destination.
+ *
+ * A unicast gets the relays between us and the destination plus AUTO_HOP_MARGIN.  That count comes from a recent
+ * traceroute through us if there is one, otherwise from hops_away in the node DB: hop_start - hop_limit of their last
+ * packet, or the bound NeighborInfo gives for a node next to one whose count we know.  A broadcast gets the most hops any
+ * node we heard lately was away, which is as far as the mesh we know of reaches from here.
+ *
+ * Only packets left at the configured hop limit are touched, and the limit only ever goes down.  An app or module that
+ * chose its own limit keeps it, as do traceroutes, which are meant to find out how far things are.
+ */
+class AutoHopLimit
+{
+  public:
+    /// The hop limit p should go out with
+    uint8_t forPacket(const meshtastic_MeshPacket *p, uint8_t configured);
+
+    /// Relays between us and n, -1 if we don't know
+    int hopsTo(NodeNum n);
+
+    /// Hops that reach every node we heard lately, -1 if we heard too few to say
+    int radius();
+
+  private:
+    int cachedRadius = -1;
+    uint32_t radiusMsec = 0;
+    bool haveRadius = false;
+};
+
+extern AutoHopLimit autoHopLimit;
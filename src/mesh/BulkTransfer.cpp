@@ -0,0 +1,172 @@
+#include "BulkTransfer.h"
+#include <string.h>
+
+static void put16(uint8_t *out, uint16_t v)
+{
+    out[0] = v;
+    out[1] = v >> 8;
+}
+
+static uint16_t get16(const uint8_t *in)
+{
+    return in[0] | (in[1] << 8);
+}
+
+size_t BulkTransfer::encodeData(uint8_t *out, uint16_t id, uint16_t seq, uint16_t port, uint32_t total, const uint8_t *data,
+                                size_t len)
+{
+    out[0] = DATA;
+    put16(out + 1, id);
+    put16(out + 3, seq);
+    size_t used = BULK_HEADER_LEN;
+    if (seq == 0) {
+        put16(out + 5, port);
+        put16(out + 7, total);
+        put16(out + 9, total >> 16);
+        used = BULK_FIRST_HEADER_LEN;
+    }
+    memcpy(out + used, data, len);
+    return used + len;
+}
+
+size_t BulkTransfer::encodeAck(uint8_t *out, uint16_t id, uint16_t next, uint16_t bitmap)
+{
+    out[0] = ACK;
+    put16(out + 1, id);
+    put16(out + 3, next);
+    put16(out + 5, bitmap);
+    return BULK_ACK_LEN;
+}
+
+size_t BulkTransfer::encodeCancel(uint8_t *out, uint16_t id)
+{
+    out[0] = CANCEL;
+    put16(out + 1, id);
+    return 3;
+}
+
+bool BulkTransfer::decode(const uint8_t *in, size_t len, Message &m)
+{
+    memset(&m, 0, sizeof(m));
+    if (len < 3)
+        return false;
+    m.type = (Type)in[0];
+    m.id = get16(in + 1);
+    switch (m.type) {
+    case DATA: {
+        if (len < BULK_HEADER_LEN)
+            return false;
+        m.seq = get16(in + 3);
+        size_t used = BULK_HEADER_LEN;
+        if (m.seq == 0) {
+            if (len < BULK_FIRST_HEADER_LEN)
+                return false;
+            m.port = get16(in + 5);
+            m.total = get16(in + 7) | ((uint32_t)get16(in + 9) << 16);
+            used = BULK_FIRST_HEADER_LEN;
+        }
+        m.data = in + used;
+        m.len = len - used;
+        return m.len <= BULK_FRAGMENT_LEN;
+    }
+    case ACK:
+        if (len < BULK_ACK_LEN)
+            return false;
+        m.seq = get16(in + 3);
+        m.bitmap = get16(in + 5);
+        return true;
+    case CANCEL:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void BulkSendWindow::start(uint32_t count)
+{
+    this->count = count;
+    base = next = 0;
+    acked = resend = 0;
+}
+
+uint32_t BulkSendWindow::sentMask() const
+{
+    uint32_t inFlight = next - base;
+    return inFlight >= 32 ? UINT32_MAX : (1u << inFlight) - 1;
+}
+
+int32_t BulkSendWindow::take()
+{
+    if (resend) {
+        uint32_t i = __builtin_ctz(resend);
+        resend &= ~(1u << i);
+        return base + i;
+    }
+    if (next < count && next < base + BULK_WINDOW)
+        return next++;
+    return -1;
+}
+
+bool BulkSendWindow::onAck(uint32_t ackNext, uint16_t bitmap)
+{
+    if (ackNext < base || ackNext > next)
+        return false; // Older than what we know, or about fragments we never sent
+    bool moved = ackNext > base;
+    uint32_t shift = ackNext - base;
+    acked = shift >= 32 ? 0 : acked >> shift;
+    resend = shift >= 32 ? 0 : resend >> shift;
+    base = ackNext;
+
+    acked |= ((uint32_t)bitmap << 1) & sentMask();
+    resend &= ~acked;
+    if (acked) {
+        // Everything in front of the last one it has should have been there by now
+        uint32_t holes = ((1u << (31 - __builtin_clz(acked))) - 1) & ~acked;
+        resend |= holes;
+    }
+    return moved;
+}
+
+void BulkSendWindow::onTimeout()
+{
+    resend = sentMask() & ~acked;
+}
+
+void BulkReceiveWindow::start(uint8_t *buffer)
+{
+    this->buffer = buffer;
+    next = 0;
+    have = 0;
+}
+
+BulkReceiveWindow::Result BulkReceiveWindow::put(uint32_t seq, const uint8_t *data, size_t len)
+{
+    if (seq < next)
+        return DUPLICATE;
+    if (seq >= next + BULK_WINDOW)
+        return AHEAD;
+    uint32_t i = seq - next;
+    if (have & (1u << i))
+        return DUPLICATE;
+    uint8_t slot = seq % BULK_WINDOW;
+    memcpy(buffer + slot * BULK_FRAGMENT_LEN, data, len);
+    lens[slot] = len;
+    have |= 1u << i;
+    return NEW;
+}
+
+bool BulkReceiveWindow::peek(const uint8_t *&data, size_t &len) const
+{
+    if (!(have & 1))
+        return false;
+    uint8_t slot = next % BULK_WINDOW;
+    data = buffer + slot * BULK_FRAGMENT_LEN;
+    len = lens[slot];
+    return true;
+}
+
+void BulkReceiveWindow::pop()
+{
+    have >>= 1;
+    next++;
+}
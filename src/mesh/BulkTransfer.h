@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Object bytes in one fragment.  With the transfer header, PKI and the Data protobuf around it, a fragment still leaves a
+// frame room for ForwardErrorCorrection's parity.
+#ifndef BULK_FRAGMENT_LEN
+#define BULK_FRAGMENT_LEN 180
+#endif
+// Fragments a sender may have unacknowledged, and so a receiver may have to hold out of order
+#ifndef BULK_WINDOW
+#define BULK_WINDOW 8
+#endif
+
+#define BULK_HEADER_LEN 5        // type, transfer id, sequence number
+#define BULK_FIRST_HEADER_LEN 11 // The first fragment also has the port and total length
+#define BULK_ACK_LEN 7           // type, transfer id, next wanted, bitmap of what came after it
+
+static_assert(BULK_FRAGMENT_LEN <= UINT8_MAX, "BulkReceiveWindow keeps fragment lengths in a uint8_t");
+static_assert(BULK_WINDOW >= 2 && BULK_WINDOW <= 17, "An ACK has 16 bits for the fragments after the next one wanted");
+
+/**
+ * The wire format of bulk transfers, see BulkTransferModule.  All numbers are little endian.
+ *
+ * DATA:   type, id (2), seq (2), then for seq 0 only port (2) and total length (4), then the fragment's bytes
+ * ACK:    type, id (2), next (2), bitmap (2): everything before next has arrived, and next + 1 + i if bit i is set
+ * CANCEL: type, id (2)
+ */
+class BulkTransfer
+{
+  public:
+    enum Type : uint8_t { DATA = 1, ACK = 2, CANCEL = 3 };
+
+    struct Message {
+        Type type;
+        uint16_t id;
+        uint16_t seq;    // DATA: which fragment, ACK: the next one wanted
+        uint16_t bitmap; // ACK
+        uint16_t port;   // DATA with seq 0
+        uint32_t total;  // DATA with seq 0
+        const uint8_t *data;
+        size_t len;
+    };
+
+    /// Fragments an object of total bytes goes in
+    static uint32_t fragmentCount(uint32_t total) { return (total + BULK_FRAGMENT_LEN - 1) / BULK_FRAGMENT_LEN; }
+
+    /// Put a DATA message in out, @return its length
+    static size_t encodeData(uint8_t *out, uint16_t id, uint16_t seq, uint16_t port, uint32_t total, const uint8_t *data,
+                             size_t len);
+    static size_t encodeAck(uint8_t *out, uint16_t id, uint16_t next, uint16_t bitmap);
+    static size_t encodeCancel(uint8_t *out, uint16_t id);
+
+    /// @return false if in[0, len) isn't a message we know
+    static bool decode(const uint8_t *in, size_t len, Message &m);
+};
+
+/**
+ * What a sender has in flight: selective repeat over a window of BULK_WINDOW fragments.
+ */
+class BulkSendWindow
+{
+  public:
+    void start(uint32_t count);
+
+    bool done() const { return base >= count; }
+
+    /// Is there a fragment to send right now
+    bool ready() const { return resend || (next < count && next < base + BULK_WINDOW); }
+
+    /// The fragment to send now, holes the receiver told us about first, -1 if there is none
+    int32_t take();
+
+    /**
+     * The receiver has everything before ackNext, and bit i of bitmap says it has ackNext + 1 + i.  Anything missing in front
+     * of a fragment it has is sent again.
+     * @return true if that moved the window on
+     */
+    bool onAck(uint32_t ackNext, uint16_t bitmap);
+
+    /// Nothing heard back for too long, everything sent and not acknowledged goes again
+    void onTimeout();
+
+    uint32_t count = 0;
+    uint32_t base = 0;  // Oldest fragment not acknowledged
+    uint32_t next = 0;  // First fragment never sent
+    uint32_t acked = 0; // Bit i for base + i
+    uint32_t resend = 0;
+
+  private:
+    uint32_t sentMask() const;
+};
+
+/**
+ * Fragments a receiver holds until the ones in front of them arrive, so they can be handed on in order.
+ */
+class BulkReceiveWindow
+{
+  public:
+    enum Result { NEW, DUPLICATE, AHEAD };
+
+    /// buffer has room for BULK_WINDOW fragments and stays the caller's
+    void start(uint8_t *buffer);
+
+    Result put(uint32_t seq, const uint8_t *data, size_t len);
+
+    /// The next fragment in order, if it is here.  It stays valid until pop().
+    bool peek(const uint8_t *&data, size_t &len) const;
+    void pop();
+
+    /// For an ACK: bit i set if next + 1 + i is here
+    uint16_t bitmap() const { return have >> 1; }
+
+    uint32_t next = 0; // Oldest fragment not handed on
+
+  private:
+    uint8_t *buffer = NULL;
+    uint8_t lens[BULK_WINDOW] = {};
+    uint32_t have = 0; // Bit i for next + i
+};
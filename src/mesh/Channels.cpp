@@ -72,10 +72,53 @@ meshtastic_Channel &Channels::fixupChannel(ChannelIndex chIndex)
     }
 
     hashes[chIndex] = generateHash(chIndex);
+    rebuildHashCandidates();
 
     return ch;
 }
 
+void Channels::rebuildHashCandidates()
+{
+    static_assert(MAX_NUM_CHANNELS <= 8, "hashCandidates holds one bit per channel");
+    memset(hashCandidates, 0, sizeof(hashCandidates));
+    for (ChannelIndex i = 0; i < getNumChannels() && i < MAX_NUM_CHANNELS; i++) {
+        if (hashes[i] >= 0)
+            hashCandidates[hashes[i]] |= (1 << i);
+    }
+}
+
+/// FNV-1a over the lower cased name, matching the strcasecmp() in getByName()
+static uint32_t hashGlobalId(const char *globalId)
+{
+    uint32_t h = 2166136261u;
+    for (const char *c = globalId; *c; c++)
+        h = (h ^ (uint8_t)tolower(*c)) * 16777619u;
+    return h;
+}
+
+void Channels::rebuildMqttLookup()
+{
+    uplinkMask = downlinkMask = 0;
+    for (ChannelIndex i = 0; i < getNumChannels() && i < MAX_NUM_CHANNELS; i++) {
+        const meshtastic_ChannelSettings &settings = channelFile.channels[i].settings;
+        globalIdHashes[i] = hashGlobalId(getGlobalId(i));
+        if (settings.uplink_enabled)
+            uplinkMask |= (1 << i);
+        if (settings.downlink_enabled)
+            downlinkMask |= (1 << i);
+    }
+}
+
+int8_t Channels::getIndexByGlobalId(const char *globalId)
+{
+    uint32_t h = hashGlobalId(globalId);
+    for (ChannelIndex i = 0; i < getNumChannels() && i < MAX_NUM_CHANNELS; i++) {
+        if (globalIdHashes[i] == h && strcasecmp(getGlobalId(i), globalId) == 0)
+            return i;
+    }
+    return -1;
+}
+
 void Channels::initDefaultLoraConfig()
 {
     meshtastic_Config_LoRaConfig &loraConfig = config.lora;
@@ -293,6 +336,9 @@ void Channels::onConfigChanged()
         if (ch.role == meshtastic_Channel_Role_PRIMARY)
             primaryIndex = i;
     }
+    // PSKs might have changed, don't keep expanded copies of old keys around
+    crypto->clearKeyCache();
+    rebuildMqttLookup();
 #if !MESHTASTIC_EXCLUDE_MQTT
     if (channels.anyMqttEnabled() && mqtt && !mqtt->isEnabled()) {
         LOG_DEBUG("MQTT is enabled on at least one channel, so set MQTT thread to run immediately");
@@ -28,6 +28,15 @@ class Channels
     /// the precomputed hashes for each of our channels, or -1 for invalid
     int16_t hashes[MAX_NUM_CHANNELS] = {};
 
+    /// for every possible channel hash, a bitmask of the channel indexes that have that hash
+    uint8_t hashCandidates[256] = {};
+
+    /// a case insensitive hash of each channel's global id, so MQTT can find a channel by name without string compares
+    uint32_t globalIdHashes[MAX_NUM_CHANNELS] = {};
+
+    /// bitmasks of the channel indexes with MQTT uplink or downlink enabled
+    uint8_t uplinkMask = 0, downlinkMask = 0;
+
   public:
     Channels() {}
 
@@ -42,6 +51,14 @@ class Channels
     /** Return the Channel for a specified name, return primary if not found. */
     meshtastic_Channel &getByName(const char *chName);
 
+    /** Return the index of the channel with this global id (compared case insensitively, like getByName), or -1 if none */
+    int8_t getIndexByGlobalId(const char *globalId);
+
+    /** MQTT uplink/downlink flags of our channels, precomputed by onConfigChanged() for the per message checks */
+    bool isUplinkEnabled(ChannelIndex chIndex) const { return chIndex < MAX_NUM_CHANNELS && (uplinkMask & (1 << chIndex)); }
+    bool isDownlinkEnabled(ChannelIndex chIndex) const { return chIndex < MAX_NUM_CHANNELS && (downlinkMask & (1 << chIndex)); }
+    bool anyUplinkEnabled() const { return uplinkMask != 0; }
+
     /** Using the index inside the channel, update the specified channel's settings and role.  If this channel is being promoted
      * to be primary, force all other channels to be secondary.
      */
@@ -75,6 +92,12 @@ class Channels
      */
     bool decryptForHash(ChannelIndex chIndex, ChannelHash channelHash);
 
+    /** Return a bitmask of the channel indexes an inbound packet with this channel hash could have been sent on
+     *
+     * Lets the decoder skip channels that can't possibly match instead of trying each one
+     */
+    uint8_t getCandidatesForHash(ChannelHash channelHash) const { return hashCandidates[channelHash]; }
+
     /** Given a channel index setup crypto for encoding that channel (or the primary channel if that channel is unsecured)
      *
      * This method is called before encoding outbound packets
@@ -113,6 +136,12 @@ class Channels
 
     int16_t getHash(ChannelIndex i) { return hashes[i]; }
 
+    /// Recompute hashCandidates from hashes, called whenever a channel hash changes
+    void rebuildHashCandidates();
+
+    /// Recompute globalIdHashes and the uplink/downlink masks, called by onConfigChanged()
+    void rebuildMqttLookup();
+
     /**
      * Validate a channel, fixing any errors as needed
      */
@@ -33,6 +33,7 @@ void CryptoEngine::generateKeyPair(uint8_t *pubKey, uint8_t *privKey)
 
     LOG_DEBUG("Generate Curve25519 keypair");
     Curve25519::dh1(public_key, private_key);
+    clearSharedKeyCache();
     memcpy(pubKey, public_key, sizeof(public_key));
     memcpy(privKey, private_key, sizeof(private_key));
 }
@@ -54,6 +55,7 @@ bool CryptoEngine::regeneratePublicKey(uint8_t *pubKey, uint8_t *privKey)
         }
         memcpy(private_key, privKey, sizeof(private_key));
         memcpy(public_key, pubKey, sizeof(public_key));
+        clearSharedKeyCache();
     } else {
         LOG_WARN("X25519 key generation failed due to blank private key");
         return false;
@@ -65,6 +67,51 @@ void CryptoEngine::clearKeys()
 {
     memset(public_key, 0, sizeof(public_key));
     memset(private_key, 0, sizeof(private_key));
+    clearSharedKeyCache();
+}
+
+void CryptoEngine::clearSharedKeyCache()
+{
+    memset(sharedKeyCache, 0, sizeof(sharedKeyCache));
+    memset(shared_key, 0, sizeof(shared_key));
+}
+
+void CryptoEngine::forgetSharedKey(uint32_t nodeNum)
+{
+    for (uint8_t i = 0; i < MAX_CACHED_SHARED_KEYS; i++) {
+        if (sharedKeyCache[i].nodeNum == nodeNum)
+            memset(&sharedKeyCache[i], 0, sizeof(CachedSharedKey));
+    }
+}
+
+bool CryptoEngine::loadSharedKey(uint32_t nodeNum, meshtastic_UserLite_public_key_t &remotePublic)
+{
+    CachedSharedKey *victim = &sharedKeyCache[0];
+    for (uint8_t i = 0; i < MAX_CACHED_SHARED_KEYS; i++) {
+        CachedSharedKey &entry = sharedKeyCache[i];
+        if (entry.nodeNum != 0 && entry.nodeNum == nodeNum &&
+            memcmp(entry.keyPrefix, remotePublic.bytes, sizeof(entry.keyPrefix)) == 0) {
+            entry.lastUsed = ++sharedKeyUseCounter;
+            memcpy(shared_key, entry.key, sizeof(shared_key));
+            return true;
+        }
+        if (entry.lastUsed < victim->lastUsed)
+            victim = &entry;
+    }
+
+    if (!crypto->setDHPublicKey(remotePublic.bytes)) {
+        return false;
+    }
+    crypto->hash(shared_key, 32);
+
+    // nodeNum 0 would be indistinguishable from an empty slot, so don't cache it
+    if (nodeNum != 0) {
+        victim->nodeNum = nodeNum;
+        memcpy(victim->keyPrefix, remotePublic.bytes, sizeof(victim->keyPrefix));
+        victim->lastUsed = ++sharedKeyUseCounter;
+        memcpy(victim->key, shared_key, sizeof(victim->key));
+    }
+    return true;
 }
 
 /**
@@ -92,10 +139,9 @@ bool CryptoEngine::encryptCurve25519(uint32_t toNode, uint32_t fromNode, meshtas
         LOG_DEBUG("Node %d or their public_key not found", toNode);
         return false;
     }
-    if (!crypto->setDHPublicKey(remotePublic.bytes)) {
+    if (!loadSharedKey(toNode, remotePublic)) {
         return false;
     }
-    crypto->hash(shared_key, 32);
     initNonce(fromNode, packetNum, extraNonceTmp);
 
     // Calculate the shared secret with the destination node and encrypt
@@ -126,18 +172,17 @@ bool CryptoEngine::decryptCurve25519(uint32_t fromNode, meshtastic_UserLite_publ
     uint32_t extraNonce;                         // pointer was not really used
     memcpy(&extraNonce, auth + 8,
            sizeof(uint32_t)); // do not use dereference on potential non aligned pointers : (uint32_t *)(auth + 8);
-    LOG_INFO("Random nonce value: %d", extraNonce);
+    LOG_DEBUG("Random nonce value: %d", extraNonce);
 
     if (remotePublic.size == 0) {
         LOG_DEBUG("Node or its public key not found in database");
         return false;
     }
 
-    // Calculate the shared secret with the sending node and decrypt
-    if (!crypto->setDHPublicKey(remotePublic.bytes)) {
+    // Calculate (or look up) the shared secret with the sending node and decrypt
+    if (!loadSharedKey(fromNode, remotePublic)) {
         return false;
     }
-    crypto->hash(shared_key, 32);
 
     initNonce(fromNode, packetNum, extraNonce);
     printBytes("Attempt decrypt with nonce: ", nonce, 13);
@@ -147,6 +192,8 @@ bool CryptoEngine::decryptCurve25519(uint32_t fromNode, meshtastic_UserLite_publ
 
 void CryptoEngine::setDHPrivateKey(uint8_t *_private_key)
 {
+    if (memcmp(private_key, _private_key, 32) != 0)
+        clearSharedKeyCache();
     memcpy(private_key, _private_key, 32);
 }
 
@@ -233,24 +280,192 @@ void CryptoEngine::decrypt(uint32_t fromNode, uint64_t packetId, size_t numBytes
     encryptPacket(fromNode, packetId, numBytes, bytes);
 }
 
-// Generic implementation of AES-CTR encryption.
 void CryptoEngine::encryptAESCtr(CryptoKey _key, uint8_t *_nonce, size_t numBytes, uint8_t *bytes)
 {
-    delete ctr;
-    ctr = nullptr;
-    if (_key.length == 16)
-        ctr = new CTR<AES128>();
-    else
-        ctr = new CTR<AES256>();
-    ctr->setKey(_key.bytes, _key.length);
+    if (aesBackend[_key.length > 16] == AES_PLATFORM && platformAESCtr(_key, _nonce, numBytes, bytes))
+        return;
+    softwareAESCtr(_key, _nonce, numBytes, bytes);
+}
+
+// Generic implementation of AES-CTR encryption.
+void CryptoEngine::softwareAESCtr(CryptoKey _key, uint8_t *_nonce, size_t numBytes, uint8_t *bytes)
+{
+    bool isNew;
+    uint8_t slot = getCachedKeySlot(_key, isNew);
+    if (isNew) {
+        // Only allocate and run the key schedule the first time we see this key
+        delete ctr[slot];
+        if (_key.length == 16)
+            ctr[slot] = new CTR<AES128>();
+        else
+            ctr[slot] = new CTR<AES256>();
+        ctr[slot]->setKey(_key.bytes, _key.length);
+    }
     static uint8_t scratch[MAX_BLOCKSIZE];
     memcpy(scratch, bytes, numBytes);
     memset(scratch + numBytes, 0,
            sizeof(scratch) - numBytes); // Fill rest of buffer with zero (in case cypher looks at it)
 
-    ctr->setIV(_nonce, 16);
-    ctr->setCounterSize(4);
-    ctr->encrypt(bytes, scratch, numBytes);
+    ctr[slot]->setIV(_nonce, 16);
+    ctr[slot]->setCounterSize(4);
+    ctr[slot]->encrypt(bytes, scratch, numBytes);
+}
+
+uint8_t CryptoEngine::getCachedKeySlot(const CryptoKey &k, bool &isNew)
+{
+    for (uint8_t i = 0; i < MAX_CACHED_KEYS; i++) {
+        if (k.length > 0 && cachedKeys[i].length == k.length && memcmp(cachedKeys[i].bytes, k.bytes, k.length) == 0) {
+            isNew = false;
+            return i;
+        }
+    }
+
+    uint8_t slot = nextCachedKey;
+    nextCachedKey = (nextCachedKey + 1) % MAX_CACHED_KEYS;
+    cachedKeys[slot] = k;
+    isNew = true;
+    return slot;
+}
+
+void CryptoEngine::clearKeyCache()
+{
+    for (uint8_t i = 0; i < MAX_CACHED_KEYS; i++) {
+        delete ctr[i]; // CTR and AES clean() their key schedules on destruction
+        ctr[i] = nullptr;
+    }
+    memset(cachedKeys, 0, sizeof(cachedKeys));
+    nextCachedKey = 0;
+}
+
+#define CRYPTO_BENCHMARK_AES_REPS 16 // Full size packets per AES-CTR timing
+#define CRYPTO_BENCHMARK_PKI_REPS 4  // Full size packets per Curve25519 timing, an uncached one costs a key exchange
+#define CRYPTO_BENCHMARK_NODE 1      // Node number the throwaway shared secret is cached under
+
+static float nsPerByte(uint32_t startUsec, uint32_t reps, size_t numBytes)
+{
+    return (micros() - startUsec) * 1000.0f / (reps * numBytes);
+}
+
+/// @return the CPU clock, or 0 if we don't know it
+static uint32_t cpuMhz()
+{
+#if defined(ARCH_ESP32)
+    return getCpuFrequencyMhz();
+#elif defined(F_CPU)
+    return F_CPU / 1000000;
+#else
+    return 0;
+#endif
+}
+
+static void logBenchmark(const char *what, float ns)
+{
+    uint32_t mhz = cpuMhz();
+    if (mhz)
+        LOG_INFO("Crypto benchmark %s: %.1f cycles/byte", what, ns * mhz / 1000);
+    else
+        LOG_INFO("Crypto benchmark %s: %.1f ns/byte", what, ns);
+}
+
+float CryptoEngine::timeAESCtr(int8_t keyLength, AESBackend backend)
+{
+    CryptoKey savedKey = key;
+    AESBackend savedBackend = aesBackend[keyLength > 16];
+    aesBackend[keyLength > 16] = backend;
+    key.length = keyLength;
+    for (int8_t i = 0; i < keyLength; i++)
+        key.bytes[i] = i * 37 + 1;
+
+    uint8_t bytes[meshtastic_Constants_DATA_PAYLOAD_LEN] = {0};
+    encryptPacket(CRYPTO_BENCHMARK_NODE, 0, sizeof(bytes), bytes); // Don't count the key schedule
+    uint32_t start = micros();
+    for (uint32_t i = 1; i <= CRYPTO_BENCHMARK_AES_REPS; i++)
+        encryptPacket(CRYPTO_BENCHMARK_NODE, i, sizeof(bytes), bytes);
+    float ns = nsPerByte(start, CRYPTO_BENCHMARK_AES_REPS, sizeof(bytes));
+
+    aesBackend[keyLength > 16] = savedBackend;
+    key = savedKey;
+    clearKeyCache(); // Both backends file their contexts under the same slots, and the throwaway key shouldn't linger
+    return ns;
+}
+
+void CryptoEngine::selectAESBackend()
+{
+    for (uint8_t i = 0; i < 2; i++) {
+        int8_t keyLength = i ? 32 : 16;
+        CryptoKey probe = {};
+        probe.length = keyLength;
+        uint8_t probeNonce[16] = {0}, block[16] = {0};
+        if (!platformAESCtr(probe, probeNonce, sizeof(block), block)) {
+            aesBackend[i] = AES_SOFTWARE;
+            continue;
+        }
+        clearKeyCache();
+
+        float platform = timeAESCtr(keyLength, AES_PLATFORM);
+        float software = timeAESCtr(keyLength, AES_SOFTWARE);
+        aesBackend[i] = software < platform ? AES_SOFTWARE : AES_PLATFORM;
+        LOG_INFO("AES%d-CTR on the %s backend (platform %.1f, software %.1f ns/byte)", keyLength * 8,
+                 aesBackend[i] == AES_PLATFORM ? "platform" : "software", platform, software);
+    }
+}
+
+CryptoEngine::BenchmarkResult CryptoEngine::benchmark()
+{
+    BenchmarkResult r = {};
+    selectAESBackend();
+    for (uint8_t i = 0; i < 2; i++) {
+        int8_t keyLength = i ? 32 : 16;
+        r.aesCtr[i] = timeAESCtr(keyLength, AES_PLATFORM);
+        r.aesCtrSoftware[i] = timeAESCtr(keyLength, AES_SOFTWARE);
+        logBenchmark(i ? "AES256-CTR" : "AES128-CTR", aesBackend[i] == AES_PLATFORM ? r.aesCtr[i] : r.aesCtrSoftware[i]);
+        if (aesBackend[i] == AES_PLATFORM)
+            logBenchmark(i ? "AES256-CTR software" : "AES128-CTR software", r.aesCtrSoftware[i]);
+    }
+
+#if !(MESHTASTIC_EXCLUDE_PKI) && !(MESHTASTIC_EXCLUDE_PKI_KEYGEN)
+    uint8_t savedPublic[32], savedPrivate[32];
+    memcpy(savedPublic, public_key, sizeof(savedPublic));
+    memcpy(savedPrivate, private_key, sizeof(savedPrivate));
+    meshtastic_UserLite_public_key_t peer = {32, {0}};
+    uint8_t peerPrivate[32];
+    Curve25519::dh1(peer.bytes, peerPrivate);
+    Curve25519::dh1(public_key, private_key);
+    clearSharedKeyCache();
+
+    const size_t numBytes = meshtastic_Constants_DATA_PAYLOAD_LEN - 12; // Room for the auth tag and extra nonce
+    uint8_t plain[numBytes] = {0}, encrypted[numBytes + 16];            // aes_ccm_ae() may write 15 bytes past the end
+    uint32_t start = micros();
+    for (uint32_t i = 0; i < CRYPTO_BENCHMARK_PKI_REPS; i++)
+        encryptCurve25519(0, CRYPTO_BENCHMARK_NODE, peer, i, numBytes, plain, encrypted); // Node 0 is never cached
+    r.pkiEncryptUncached = nsPerByte(start, CRYPTO_BENCHMARK_PKI_REPS, numBytes);
+
+    encryptCurve25519(CRYPTO_BENCHMARK_NODE, CRYPTO_BENCHMARK_NODE, peer, 0, numBytes, plain, encrypted);
+    start = micros();
+    for (uint32_t i = 0; i < CRYPTO_BENCHMARK_AES_REPS; i++)
+        encryptCurve25519(CRYPTO_BENCHMARK_NODE, CRYPTO_BENCHMARK_NODE, peer, i, numBytes, plain, encrypted);
+    r.pkiEncryptCached = nsPerByte(start, CRYPTO_BENCHMARK_AES_REPS, numBytes);
+
+    // The peer's public key and our private key give the same shared secret both ways, so we can decrypt our own packet
+    bool decrypted = true;
+    start = micros();
+    for (uint32_t i = 0; i < CRYPTO_BENCHMARK_AES_REPS; i++)
+        decrypted &= decryptCurve25519(CRYPTO_BENCHMARK_NODE, peer, CRYPTO_BENCHMARK_AES_REPS - 1, numBytes + 12, encrypted,
+                                       plain);
+    r.pkiDecryptCached = nsPerByte(start, CRYPTO_BENCHMARK_AES_REPS, numBytes);
+    if (!decrypted)
+        LOG_WARN("Crypto benchmark could not decrypt its own PKI packet");
+
+    memcpy(public_key, savedPublic, sizeof(public_key));
+    memcpy(private_key, savedPrivate, sizeof(private_key));
+    clearSharedKeyCache();
+    memset(peerPrivate, 0, sizeof(peerPrivate));
+
+    logBenchmark("PKI encrypt with key exchange", r.pkiEncryptUncached);
+    logBenchmark("PKI encrypt", r.pkiEncryptCached);
+    logBenchmark("PKI decrypt", r.pkiDecryptCached);
+#endif
+    return r;
 }
 
 /**
@@ -21,7 +21,13 @@ struct CryptoKey {
  */
 
 #define MAX_BLOCKSIZE 256
+#define MAX_CACHED_KEYS 8 // Expanded AES-CTR key contexts we keep around, one per channel is enough
+#define MAX_CACHED_SHARED_KEYS 16 // Curve25519 shared secrets of the peers we most recently exchanged PKI packets with
 #define TEST_CURVE25519_FIELD_OPS // Exposes Curve25519::isWeakPoint() for testing keys
+#ifndef CRYPTO_SELECT_BACKEND
+#define CRYPTO_SELECT_BACKEND 1 // At boot, time the platform AES-CTR against the software one and keep the faster
+#endif
+// #define CRYPTO_BENCHMARK // Log how fast each crypto operation is at boot
 
 class CryptoEngine
 {
@@ -46,6 +52,11 @@ class CryptoEngine
     virtual bool setDHPublicKey(uint8_t *publicKey);
     virtual void hash(uint8_t *bytes, size_t numBytes);
 
+    /**
+     * Drop the cached shared secret for a node, must be called when its public key changes or it is removed
+     */
+    void forgetSharedKey(uint32_t nodeNum);
+
     virtual void aesSetKey(const uint8_t *key, size_t key_len);
 
     virtual void aesEncrypt(uint8_t *in, uint8_t *out);
@@ -71,17 +82,92 @@ class CryptoEngine
      */
     virtual void encryptPacket(uint32_t fromNode, uint64_t packetId, size_t numBytes, uint8_t *bytes);
     virtual void decrypt(uint32_t fromNode, uint64_t packetId, size_t numBytes, uint8_t *bytes);
-    virtual void encryptAESCtr(CryptoKey key, uint8_t *nonce, size_t numBytes, uint8_t *bytes);
+
+    /// AES-CTR with the backend that selectAESBackend() picked for the key length
+    void encryptAESCtr(CryptoKey key, uint8_t *nonce, size_t numBytes, uint8_t *bytes);
+
+    /**
+     * Time the platform's AES-CTR (e.g. hardware) against the generic software one for each key length, and use whichever
+     * is faster from now on.  Takes some tens of milliseconds, call with cryptLock held or before other threads start.
+     */
+    void selectAESBackend();
+
+    /// Nanoseconds per byte of each operation, as measured by benchmark()
+    struct BenchmarkResult {
+        float aesCtr[2];          // encryptPacket with an AES128 and an AES256 key, on the platform backend if there is one
+        float aesCtrSoftware[2];  // The same on the generic software backend
+        float pkiEncryptUncached; // encryptCurve25519 including the X25519 key exchange
+        float pkiEncryptCached;   // encryptCurve25519 with the shared secret already cached
+        float pkiDecryptCached;
+    };
+
+    /**
+     * Time encryptPacket, encryptCurve25519 and decryptCurve25519 on a full size packet, log the results in cycles per byte
+     * and select the faster AES backends.  Uses a throwaway key pair, our own keys are put back afterwards but all cached
+     * keys are dropped.  Call with cryptLock held or before other threads start.
+     */
+    BenchmarkResult benchmark();
+
+    /**
+     * Forget (and zeroize) all expanded channel keys, must be called whenever channel PSKs might have changed
+     */
+    virtual void clearKeyCache();
 #ifndef PIO_UNIT_TESTING
   protected:
 #endif
+    enum AESBackend : uint8_t { AES_PLATFORM, AES_SOFTWARE };
+    AESBackend aesBackend[2] = {AES_PLATFORM, AES_PLATFORM}; // For AES128 and AES256 keys
+
+    /**
+     * The platform's own AES-CTR, overridden where there is hardware or a faster library for it
+     * @return false if there is none for this key length, in which case nothing was done
+     */
+    virtual bool platformAESCtr(CryptoKey, uint8_t *, size_t, uint8_t *) { return false; }
+
+    /// Generic implementation of AES-CTR, on any platform
+    void softwareAESCtr(CryptoKey _key, uint8_t *_nonce, size_t numBytes, uint8_t *bytes);
+
+    /// Time encryptPacket with a throwaway key of keyLength bytes on the given backend
+    float timeAESCtr(int8_t keyLength, AESBackend backend);
+
     /** Our per packet nonce */
     uint8_t nonce[16] = {0};
     CryptoKey key = {};
-    CTRCommon *ctr = NULL;
+
+    /** Keys whose expanded context is held in the matching slot of the subclass' context cache (length 0 means empty) */
+    CryptoKey cachedKeys[MAX_CACHED_KEYS] = {};
+    uint8_t nextCachedKey = 0; // Round robin replacement, we only ever have a handful of channels
+    CTRCommon *ctr[MAX_CACHED_KEYS] = {};
+
+    /**
+     * Find the cache slot holding the expanded context for k, claiming a slot if it isn't cached yet
+     *
+     * @param isNew set to true if the slot was just claimed and its context still needs to be set up for k
+     * @return slot index into the context cache
+     */
+    uint8_t getCachedKeySlot(const CryptoKey &k, bool &isNew);
 #if !(MESHTASTIC_EXCLUDE_PKI)
     uint8_t shared_key[32] = {0};
     uint8_t private_key[32] = {0};
+
+    /** An already derived (X25519 + SHA256) shared secret, so a warm peer only costs us AES-CCM */
+    struct CachedSharedKey {
+        uint32_t nodeNum;     // 0 means empty
+        uint8_t keyPrefix[8]; // Fingerprint of the remote public key the secret was derived from
+        uint32_t lastUsed;    // For LRU replacement
+        uint8_t key[32];
+    };
+    CachedSharedKey sharedKeyCache[MAX_CACHED_SHARED_KEYS] = {};
+    uint32_t sharedKeyUseCounter = 0;
+
+    /**
+     * Set shared_key to the secret shared with nodeNum, from cache if possible, otherwise by running X25519 and SHA256
+     * @return false if the key exchange failed
+     */
+    bool loadSharedKey(uint32_t nodeNum, meshtastic_UserLite_public_key_t &remotePublic);
+
+    /// Zeroize all cached shared secrets, e.g. because our own private key changed
+    void clearSharedKeyCache();
 #endif
     /**
      * Init our 128 bit nonce for a new packet
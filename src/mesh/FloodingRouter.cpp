@@ -43,16 +43,64 @@ bool FloodingRouter::shouldFilterReceived(const meshtastic_MeshPacket *p)
     return Router::shouldFilterReceived(p);
 }
 
+uint8_t FloodingRouter::countOverheardRelayer(const meshtastic_MeshPacket *p)
+{
+    OverheardRelays *r = NULL;
+    for (OverheardRelays &o : overheard) {
+        if (o.numRelayers && o.from == p->from && o.id == p->id) {
+            r = &o;
+            break;
+        }
+    }
+    if (!r) {
+        // Round robin is fine, an entry only matters for as long as our rebroadcast sits in the TX queue
+        r = &overheard[nextOverheard];
+        nextOverheard = (nextOverheard + 1) % FLOOD_SUPPRESS_NUM_PACKETS;
+        r->from = p->from;
+        r->id = p->id;
+        r->numRelayers = 0;
+    }
+
+    for (uint8_t i = 0; i < r->numRelayers; i++) {
+        // Relayers that don't fill in relay_node (0) can't be told apart, so each of those counts
+        if (p->relay_node != 0 && r->relayers[i] == p->relay_node)
+            return r->numRelayers;
+    }
+    if (r->numRelayers < FLOOD_SUPPRESS_MAX_K)
+        r->relayers[r->numRelayers++] = p->relay_node;
+    return r->numRelayers;
+}
+
 void FloodingRouter::perhapsCancelDupe(const meshtastic_MeshPacket *p)
 {
-    if (config.device.role != meshtastic_Config_DeviceConfig_Role_ROUTER &&
-        config.device.role != meshtastic_Config_DeviceConfig_Role_REPEATER &&
-        config.device.role != meshtastic_Config_DeviceConfig_Role_ROUTER_LATE &&
-        p->transport_mechanism == meshtastic_MeshPacket_TransportMechanism_TRANSPORT_LORA) {
-        // cancel rebroadcast of this message *if* there was already one, unless we're a router/repeater!
-        // But only LoRa packets should be able to trigger this.
-        if (Router::cancelSending(p->from, p->id))
+    // cancel rebroadcast of this message once enough others did it, but only LoRa packets should be able to trigger this.
+    uint8_t k;
+    float minSnr;
+    switch (config.device.role) {
+    case meshtastic_Config_DeviceConfig_Role_ROUTER:
+    case meshtastic_Config_DeviceConfig_Role_REPEATER:
+        k = USERPREFS_FLOOD_SUPPRESS_K_ROUTER;
+        minSnr = USERPREFS_FLOOD_SUPPRESS_MIN_SNR_ROUTER;
+        break;
+    case meshtastic_Config_DeviceConfig_Role_ROUTER_LATE:
+        k = 0; // Moves to the late window instead, below
+        minSnr = 0;
+        break;
+    default:
+        k = USERPREFS_FLOOD_SUPPRESS_K_CLIENT;
+        minSnr = USERPREFS_FLOOD_SUPPRESS_MIN_SNR_CLIENT;
+        break;
+    }
+    if (k > FLOOD_SUPPRESS_MAX_K)
+        k = FLOOD_SUPPRESS_MAX_K;
+
+    if (k && p->transport_mechanism == meshtastic_MeshPacket_TransportMechanism_TRANSPORT_LORA && p->rx_snr >= minSnr &&
+        (k == 1 || countOverheardRelayer(p) >= k)) {
+        if (Router::cancelSending(p->from, p->id)) {
+            if (k > 1)
+                LOG_DEBUG("Heard %u relayers of 0x%08x, drop our rebroadcast", k, p->id);
             txRelayCanceled++;
+        }
     }
     if (config.device.role == meshtastic_Config_DeviceConfig_Role_ROUTER_LATE && iface) {
         iface->clampToLateRebroadcastWindow(getFrom(p), p->id);
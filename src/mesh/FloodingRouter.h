@@ -2,6 +2,27 @@
 
 #include "Router.h"
 
+/*
+  Counter based flood suppression: we drop our queued rebroadcast once k distinct relayers heard at or above a minimum SNR
+  have already rebroadcast the packet.  k = 0 never cancels.  Clients keep the classic rule of cancelling on the first dupe
+  we hear, routers and repeaters only step back when they are clearly redundant.  Override per role with USERPREFS_.
+*/
+#ifndef USERPREFS_FLOOD_SUPPRESS_K_CLIENT
+#define USERPREFS_FLOOD_SUPPRESS_K_CLIENT 1
+#endif
+#ifndef USERPREFS_FLOOD_SUPPRESS_MIN_SNR_CLIENT
+#define USERPREFS_FLOOD_SUPPRESS_MIN_SNR_CLIENT -128 // Any dupe counts
+#endif
+#ifndef USERPREFS_FLOOD_SUPPRESS_K_ROUTER
+#define USERPREFS_FLOOD_SUPPRESS_K_ROUTER 3
+#endif
+#ifndef USERPREFS_FLOOD_SUPPRESS_MIN_SNR_ROUTER
+#define USERPREFS_FLOOD_SUPPRESS_MIN_SNR_ROUTER 0 // dB, a relay this strong covers much the same area we would
+#endif
+
+#define FLOOD_SUPPRESS_MAX_K 4       // Most relayers we remember per packet, k is capped to this
+#define FLOOD_SUPPRESS_NUM_PACKETS 8 // Most rebroadcasts we count relayers for at once
+
 /**
  * This is a mixin that extends Router with the ability to do Naive Flooding (in the standard mesh protocol sense)
  *
@@ -28,6 +49,19 @@
 class FloodingRouter : public Router
 {
   private:
+    /** Distinct strong relayers overheard for a packet we may still rebroadcast */
+    struct OverheardRelays {
+        NodeNum from;
+        PacketId id;
+        uint8_t numRelayers;
+        uint8_t relayers[FLOOD_SUPPRESS_MAX_K];
+    };
+    OverheardRelays overheard[FLOOD_SUPPRESS_NUM_PACKETS] = {};
+    uint8_t nextOverheard = 0;
+
+    /** Count p's relayer towards its packet, and return how many distinct relayers we have heard for it so far */
+    uint8_t countOverheardRelayer(const meshtastic_MeshPacket *p);
+
     /* Check if we should rebroadcast this packet, and do so if needed */
     void perhapsRebroadcast(const meshtastic_MeshPacket *p);
 
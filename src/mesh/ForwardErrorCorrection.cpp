@@ -0,0 +1,72 @@
+#include "ForwardErrorCorrection.h"
+#include "NodeDB.h"
+#include "ReedSolomon.h"
+#include "Router.h"
+#include "configuration.h"
+#include <assert.h>
+
+// A neighbour we haven't heard from for this long no longer gets a say in whether floods are protected
+#define FEC_NEIGHBOUR_SECS (60 * 60 * 2)
+
+static_assert(FEC_PARITY_BYTES % 2 == 0 && FEC_PARITY_BYTES <= REED_SOLOMON_MAX_PARITY, "FEC_PARITY_BYTES out of range");
+
+bool ForwardErrorCorrection::shouldProtect(const meshtastic_MeshPacket *p, uint8_t sf)
+{
+#if LORA_FEC
+    if (sf < FEC_MIN_SF || p->encrypted.size < FEC_MIN_PAYLOAD || p->encrypted.size > FEC_MAX_PAYLOAD)
+        return false;
+    return receiversCapable(p);
+#else
+    (void)p;
+    (void)sf;
+    return false;
+#endif
+}
+
+bool ForwardErrorCorrection::receiversCapable(const meshtastic_MeshPacket *p)
+{
+    size_t receivers = 0;
+    for (size_t i = 0; i < nodeDB->getNumMeshNodes(); i++) {
+        const meshtastic_NodeInfoLite *node = nodeDB->getMeshNodeByIndex(i);
+        if (node->num == nodeDB->getNodeNum() || node->via_mqtt)
+            continue;
+        if (p->next_hop != NO_NEXT_HOP_PREFERENCE) {
+            // Only the last byte of the next hop is on the wire, every node it could be has to manage
+            if ((node->num & 0xff) != p->next_hop)
+                continue;
+        } else if (!node->has_hops_away || node->hops_away != 0 || sinceLastSeen(node) >= FEC_NEIGHBOUR_SECS) {
+            continue;
+        }
+        if (!(node->bitfield & NODEINFO_BITFIELD_READS_FEC_MASK))
+            return false;
+        receivers++;
+    }
+    return receivers > 0;
+}
+
+size_t ForwardErrorCorrection::protect(uint8_t *frame, size_t len)
+{
+    assert(len + FEC_PARITY_BYTES <= MAX_LORA_PAYLOAD_LEN);
+    ReedSolomon::encode(frame, len, FEC_PARITY_BYTES);
+    return len + FEC_PARITY_BYTES;
+}
+
+size_t ForwardErrorCorrection::unwrap(uint8_t *frame, size_t len, bool crcOk)
+{
+    if (len < sizeof(PacketHeader) + FEC_PARITY_BYTES || len > MAX_LORA_PAYLOAD_LEN)
+        return 0;
+    // A clean frame is never "corrected", that would turn an unprotected one that is almost a codeword into garbage
+    bool ok = crcOk ? ReedSolomon::isCodeword(frame, len, FEC_PARITY_BYTES) : ReedSolomon::decode(frame, len, FEC_PARITY_BYTES);
+    return ok ? len - FEC_PARITY_BYTES : 0;
+}
+
+void ForwardErrorCorrection::heardNodeInfo(NodeNum node, const meshtastic_Data &d)
+{
+    meshtastic_NodeInfoLite *info = nodeDB->getMeshNode(node);
+    if (!info)
+        return;
+    if (d.has_bitfield && (d.bitfield & BITFIELD_READS_FEC_MASK))
+        info->bitfield |= NODEINFO_BITFIELD_READS_FEC_MASK;
+    else
+        info->bitfield &= ~NODEINFO_BITFIELD_READS_FEC_MASK;
+}
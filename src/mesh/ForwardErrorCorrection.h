@@ -0,0 +1,65 @@
+#pragma once
+
+#include "MeshTypes.h"
+#include "RadioInterface.h"
+
+// Set to 1 to add Reed-Solomon parity to large frames for next hops that can use it, on the slow presets.  A frame with a few
+// bytes hit by noise is then repaired by the receiver instead of costing a retransmission.  Receiving them is always on.
+#ifndef LORA_FEC
+#define LORA_FEC 0
+#endif
+// Parity bytes on a protected frame, up to half of them anywhere in the frame can be wrong
+#ifndef FEC_PARITY_BYTES
+#define FEC_PARITY_BYTES 16
+#endif
+// Packets with less encrypted payload than this are rarely hit, and cheap to send again when they are
+#ifndef FEC_MIN_PAYLOAD
+#define FEC_MIN_PAYLOAD 64
+#endif
+// Below this spreading factor a retransmission costs less than the parity on every frame
+#ifndef FEC_MIN_SF
+#define FEC_MIN_SF 11
+#endif
+// The most encrypted payload a frame can have and still take the parity
+#define FEC_MAX_PAYLOAD (MAX_LORA_PAYLOAD_LEN - sizeof(PacketHeader) - FEC_PARITY_BYTES)
+
+/**
+ * Reed-Solomon parity on a LoRa frame, see ReedSolomon.
+ *
+ * A protected frame is the usual PacketHeader and encrypted payload, followed by FEC_PARITY_BYTES of parity over both of them.
+ * Nothing in the header says so: a frame whose last FEC_PARITY_BYTES make it a valid codeword is one, any other frame having
+ * that happen by chance is as likely as guessing 128 bits.  Older firmware takes the parity for part of the payload, which
+ * then fails to decrypt, so we only protect frames for receivers that said they can take the parity off.
+ *
+ * The radio still checks its CRC.  When that fails we don't drop the frame straight away but try to repair it, and if that
+ * works it goes on as if it had been heard clean.
+ *
+ * Every node running this firmware takes the parity off and says so in the Data bitfield of its NodeInfo (BITFIELD_READS_FEC),
+ * which we remember in NodeInfoLite.bitfield.  With LORA_FEC we protect packets of at least FEC_MIN_PAYLOAD bytes, on
+ * spreading factor FEC_MIN_SF and up, for a next hop that said so, or floods when every neighbour we've heard lately did.
+ * Aggregates and frames too full for the parity (more than FEC_MAX_PAYLOAD) go without.
+ */
+class ForwardErrorCorrection
+{
+  public:
+    /// Should p, alone in its frame, get parity when sent at spreading factor sf
+    static bool shouldProtect(const meshtastic_MeshPacket *p, uint8_t sf);
+
+    /// Can whoever has to hear packets going p's way take the parity off
+    static bool receiversCapable(const meshtastic_MeshPacket *p);
+
+    /**
+     * Add the parity after frame[0, len), which has room for it.
+     * @return the length of the protected frame
+     */
+    static size_t protect(uint8_t *frame, size_t len);
+
+    /**
+     * Take the parity off frame[0, len) if it is a protected frame, repairing it first if the radio said its CRC was bad.
+     * @return the length without the parity, 0 if it isn't a protected frame or is beyond repair (a clean one stays as it is)
+     */
+    static size_t unwrap(uint8_t *frame, size_t len, bool crcOk);
+
+    /// Note what a NodeInfo from node said about reading protected frames
+    static void heardNodeInfo(NodeNum node, const meshtastic_Data &d);
+};
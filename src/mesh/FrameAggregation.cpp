@@ -0,0 +1,91 @@
+#include "FrameAggregation.h"
+#include "NodeDB.h"
+#include "Router.h"
+#include "configuration.h"
+
+// A neighbour we haven't heard from for this long no longer gets a say in whether floods are aggregated
+#define FRAME_AGGREGATE_NEIGHBOUR_SECS (60 * 60 * 2)
+
+bool FrameAggregation::canJoin(const meshtastic_MeshPacket *lead, const meshtastic_MeshPacket *p)
+{
+    if (p->encrypted.size > FRAME_AGGREGATE_MAX_PART || p->next_hop != lead->next_hop)
+        return false;
+    // A flood we relay waits out a delay scaled by how well we heard it, so better placed relays go first. Sending it early
+    // with something else would undo that, only our own packets and those with a next hop have nothing to wait for.
+    if (!isFromUs(p) && p->next_hop == NO_NEXT_HOP_PREFERENCE)
+        return false;
+    return !p->tx_after || (int32_t)(millis() - p->tx_after) >= 0;
+}
+
+bool FrameAggregation::receiversCapable(const meshtastic_MeshPacket *p)
+{
+    size_t receivers = 0;
+    for (size_t i = 0; i < nodeDB->getNumMeshNodes(); i++) {
+        const meshtastic_NodeInfoLite *node = nodeDB->getMeshNodeByIndex(i);
+        if (node->num == nodeDB->getNodeNum() || node->via_mqtt)
+            continue;
+        if (p->next_hop != NO_NEXT_HOP_PREFERENCE) {
+            // Only the last byte of the next hop is on the wire, every node it could be has to manage
+            if ((node->num & 0xff) != p->next_hop)
+                continue;
+        } else if (!node->has_hops_away || node->hops_away != 0 || sinceLastSeen(node) >= FRAME_AGGREGATE_NEIGHBOUR_SECS) {
+            continue;
+        }
+        if (!(node->bitfield & NODEINFO_BITFIELD_READS_AGGREGATES_MASK))
+            return false;
+        receivers++;
+    }
+    return receivers > 0;
+}
+
+void FrameAggregation::initHeader(PacketHeader &h, NodeNum from)
+{
+    h.from = from;
+    h.to = NODENUM_BROADCAST;
+    h.id = 0;
+    h.flags = 0; // No hops left, and no hop_start so older firmware ignores next_hop and relay_node too
+    h.channel = 0;
+    h.next_hop = FRAME_AGGREGATE_MAGIC;
+    h.relay_node = from & 0xff;
+}
+
+bool FrameAggregation::appendPart(uint8_t *out, size_t room, size_t &used, const PacketHeader &h, const uint8_t *payload,
+                                  size_t len)
+{
+    if (len > 0xff || used + 1 + sizeof(h) + len > room)
+        return false;
+    out[used] = len;
+    memcpy(out + used + 1, &h, sizeof(h));
+    memcpy(out + used + 1 + sizeof(h), payload, len);
+    used += 1 + sizeof(h) + len;
+    return true;
+}
+
+bool FrameAggregation::forEachPart(const uint8_t *payload, size_t len,
+                                   const std::function<void(const PacketHeader &h, const uint8_t *payload, size_t len)> &onPart)
+{
+    size_t pos = 0;
+    while (pos < len) {
+        size_t partLen = payload[pos];
+        if (pos + 1 + sizeof(PacketHeader) + partLen > len)
+            return false;
+        PacketHeader h;
+        memcpy(&h, payload + pos + 1, sizeof(h));
+        if (h.from == 0 || isAggregate(h)) // Aggregates don't nest
+            return false;
+        onPart(h, payload + pos + 1 + sizeof(h), partLen);
+        pos += 1 + sizeof(h) + partLen;
+    }
+    return true;
+}
+
+void FrameAggregation::heardNodeInfo(NodeNum node, const meshtastic_Data &d)
+{
+    meshtastic_NodeInfoLite *info = nodeDB->getMeshNode(node);
+    if (!info)
+        return;
+    if (d.has_bitfield && (d.bitfield & BITFIELD_READS_AGGREGATES_MASK))
+        info->bitfield |= NODEINFO_BITFIELD_READS_AGGREGATES_MASK;
+    else
+        info->bitfield &= ~NODEINFO_BITFIELD_READS_AGGREGATES_MASK;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "MeshTypes.h"
+#include "RadioInterface.h"
+#include <functional>
+
+// Set to 1 to send small packets that are due at the same time, going the same way, in one LoRa frame.  Every frame saved is a
+// preamble, a header and a contention window, which on the slow presets is seconds of airtime.  Receiving them is always on.
+#ifndef LORA_FRAME_AGGREGATION
+#define LORA_FRAME_AGGREGATION 0
+#endif
+// Packets with more encrypted payload than this are better off in a frame of their own
+#ifndef FRAME_AGGREGATE_MAX_PART
+#define FRAME_AGGREGATE_MAX_PART 96
+#endif
+#define FRAME_AGGREGATE_MAX_PARTS 8 // That we send
+// That a frame can hold, every part takes its length and header even if it has no payload
+#define FRAME_AGGREGATE_MAX_RX_PARTS ((MAX_LORA_PAYLOAD_LEN - sizeof(PacketHeader)) / (1 + sizeof(PacketHeader)))
+
+// In the next_hop byte of an aggregate's outer header, see FrameAggregation
+#define FRAME_AGGREGATE_MAGIC 0xa6
+
+/**
+ * Several packets in one LoRa frame.
+ *
+ * An aggregate is an outer PacketHeader from the sender with id 0, no hops and FRAME_AGGREGATE_MAGIC as next_hop, followed by
+ * the parts: one byte of payload length, the part's own PacketHeader and its still encrypted payload.  A receiver that knows
+ * the format handles every part as if that frame alone had been heard in its place.  Older firmware sees a packet it can't
+ * decrypt, that nobody may relay, and drops it.
+ *
+ * Every node running this firmware takes aggregates apart and says so in the Data bitfield of its NodeInfo
+ * (BITFIELD_READS_AGGREGATES), which we remember in NodeInfoLite.bitfield.  We only aggregate packets for a next hop that said
+ * so, or floods when every neighbour we've heard lately did.
+ */
+class FrameAggregation
+{
+  public:
+    /// Bytes a packet takes up as a part of an aggregate
+    static size_t partLength(const meshtastic_MeshPacket *p) { return 1 + sizeof(PacketHeader) + p->encrypted.size; }
+
+    /// Can p go in the same frame as lead: small enough, going the same way, and not waiting out a relay delay of its own
+    static bool canJoin(const meshtastic_MeshPacket *lead, const meshtastic_MeshPacket *p);
+
+    /// Can whoever has to hear packets going p's way take an aggregate apart
+    static bool receiversCapable(const meshtastic_MeshPacket *p);
+
+    /// Make h the outer header of an aggregate sent by from
+    static void initHeader(PacketHeader &h, NodeNum from);
+
+    static bool isAggregate(const PacketHeader &h) { return h.id == 0 && h.flags == 0 && h.next_hop == FRAME_AGGREGATE_MAGIC; }
+
+    /// Append a part at out + used, @return false (leaving out alone) if it doesn't fit in room
+    static bool appendPart(uint8_t *out, size_t room, size_t &used, const PacketHeader &h, const uint8_t *payload, size_t len);
+
+    /**
+     * Hand each part of an aggregate's payload to onPart, in order.
+     * @return false if it is malformed, the parts in front of the damage have been handed over by then
+     */
+    static bool forEachPart(const uint8_t *payload, size_t len,
+                            const std::function<void(const PacketHeader &h, const uint8_t *payload, size_t len)> &onPart);
+
+    /// Note what a NodeInfo from node said about reading aggregates
+    static void heardNodeInfo(NodeNum node, const meshtastic_Data &d);
+};
@@ -0,0 +1,177 @@
+#include "FrameCapture.h"
+#include "RTC.h"
+#include <math.h>
+#include <mutex>
+#include <string.h>
+
+FrameCapture frameCapture;
+
+#define LORATAP_SYNC_WORD 0x2b
+#define LORATAP_RSSI_OFFSET 139 // LoRaTap RSSI bytes are dBm + 139
+
+// pcapng, https://www.ietf.org/archive/id/draft-ietf-opsawg-pcapng-02.html
+#define PCAPNG_SHB 0x0A0D0D0A
+#define PCAPNG_IDB 0x00000001
+#define PCAPNG_EPB 0x00000006
+#define PCAPNG_BYTE_ORDER_MAGIC 0x1A2B3C4D
+#define PCAPNG_OPT_EPB_FLAGS 2
+#define PCAPNG_EPB_INBOUND 1
+#define PCAPNG_EPB_OUTBOUND 2
+#define PCAPNG_EPB_CRC_ERROR (1 << 24)
+
+void FrameCapture::put(const void *data, size_t len)
+{
+#if FRAME_CAPTURE_BYTES
+    size_t first = len < FRAME_CAPTURE_BYTES - head ? len : FRAME_CAPTURE_BYTES - head;
+    memcpy(ring + head, data, first);
+    memcpy(ring, (const uint8_t *)data + first, len - first);
+    head = (head + len) % FRAME_CAPTURE_BYTES;
+#endif
+}
+
+void FrameCapture::get(size_t at, void *data, size_t len) const
+{
+#if FRAME_CAPTURE_BYTES
+    size_t first = len < FRAME_CAPTURE_BYTES - at ? len : FRAME_CAPTURE_BYTES - at;
+    memcpy(data, ring + at, first);
+    memcpy((uint8_t *)data + first, ring, len - first);
+#endif
+}
+
+void FrameCapture::add(bool tx, const uint8_t *frame, size_t len, float freqMHz, float bwKHz, uint8_t sf, int16_t rssi,
+                       float snr, bool crcOk)
+{
+#if FRAME_CAPTURE_BYTES
+    size_t need = sizeof(Record) + len;
+    if (need > FRAME_CAPTURE_BYTES)
+        return;
+
+    Record r;
+    r.msec = millis();
+    r.freqHz = (uint32_t)lround((double)freqMHz * 1000000);
+    r.rssi = rssi;
+    r.snrX4 = (int8_t)lroundf(snr < -32 ? -128 : snr > 31.75f ? 127 : snr * 4);
+    r.flags = (tx ? FLAG_TX : 0) | (crcOk ? 0 : FLAG_CRC_BAD);
+    r.len = len;
+    r.sf = sf;
+    long steps = lroundf(bwKHz / 125);
+    r.bwSteps = steps < 1 ? 1 : steps;
+
+    std::lock_guard<decltype(lock)> g(lock);
+    // Make room by forgetting the oldest frames
+    while (FRAME_CAPTURE_BYTES - used < need) {
+        Record oldest;
+        get(tail, &oldest, sizeof(oldest));
+        size_t oldLen = sizeof(Record) + oldest.len;
+        tail = (tail + oldLen) % FRAME_CAPTURE_BYTES;
+        used -= oldLen;
+        count--;
+    }
+    put(&r, sizeof(r));
+    put(frame, len);
+    used += need;
+    count++;
+#endif
+}
+
+void FrameCapture::clear()
+{
+    std::lock_guard<decltype(lock)> g(lock);
+    head = tail = used = count = 0;
+}
+
+static void append32(std::vector<uint8_t> &out, uint32_t v)
+{
+    out.insert(out.end(), (const uint8_t *)&v, (const uint8_t *)&v + sizeof(v)); // pcapng is in our byte order
+}
+
+static void append16(std::vector<uint8_t> &out, uint16_t v)
+{
+    out.insert(out.end(), (const uint8_t *)&v, (const uint8_t *)&v + sizeof(v));
+}
+
+void FrameCapture::writePcapng(std::vector<uint8_t> &out)
+{
+    // Section header, no options
+    append32(out, PCAPNG_SHB);
+    append32(out, 28);
+    append32(out, PCAPNG_BYTE_ORDER_MAGIC);
+    append16(out, 1); // Version 1.0
+    append16(out, 0);
+    append32(out, 0xffffffff); // Section length unknown
+    append32(out, 0xffffffff);
+    append32(out, 28);
+
+    // One interface, timestamps in the default microseconds
+    append32(out, PCAPNG_IDB);
+    append32(out, 20);
+    append16(out, FRAME_CAPTURE_LINKTYPE_LORATAP);
+    append16(out, 0);
+    append32(out, 0); // No snap length
+    append32(out, 20);
+
+#if FRAME_CAPTURE_BYTES
+    // Copy the ring out first, so the radio isn't held up while we encode
+    std::vector<uint8_t> frames;
+    size_t numFrames;
+    {
+        std::lock_guard<decltype(lock)> g(lock);
+        frames.resize(used);
+        get(tail, frames.data(), used);
+        numFrames = count;
+    }
+    // Records only have millis(), go back from the wall clock now
+    uint32_t nowMsec = millis();
+    uint64_t nowUsec = getTimeMsec() * 1000;
+
+    size_t at = 0;
+    for (size_t i = 0; i < numFrames; i++) {
+        Record r;
+        memcpy(&r, frames.data() + at, sizeof(r));
+        const uint8_t *frame = frames.data() + at + sizeof(r);
+        at += sizeof(r) + r.len;
+
+        uint64_t usec = nowUsec - (uint64_t)(nowMsec - r.msec) * 1000;
+        size_t capLen = FRAME_CAPTURE_LORATAP_LEN + r.len;
+        size_t padding = (4 - capLen % 4) % 4;
+        uint32_t blockLen = 28 + capLen + padding + 12 + 4;
+
+        append32(out, PCAPNG_EPB);
+        append32(out, blockLen);
+        append32(out, 0); // Interface
+        append32(out, usec >> 32);
+        append32(out, (uint32_t)usec);
+        append32(out, capLen);
+        append32(out, capLen);
+
+        // LoRaTap v0 header, big endian
+        int rssi = r.rssi + LORATAP_RSSI_OFFSET;
+        uint8_t rssiByte = rssi < 0 ? 0 : rssi > 255 ? 255 : rssi;
+        uint8_t tap[FRAME_CAPTURE_LORATAP_LEN] = {0,
+                                                  0,
+                                                  0,
+                                                  FRAME_CAPTURE_LORATAP_LEN,
+                                                  (uint8_t)(r.freqHz >> 24),
+                                                  (uint8_t)(r.freqHz >> 16),
+                                                  (uint8_t)(r.freqHz >> 8),
+                                                  (uint8_t)r.freqHz,
+                                                  r.bwSteps,
+                                                  r.sf,
+                                                  rssiByte, // Packet
+                                                  rssiByte, // Max
+                                                  rssiByte, // Current
+                                                  (uint8_t)r.snrX4,
+                                                  LORATAP_SYNC_WORD};
+        out.insert(out.end(), tap, tap + sizeof(tap));
+        out.insert(out.end(), frame, frame + r.len);
+        out.insert(out.end(), padding, 0);
+
+        append16(out, PCAPNG_OPT_EPB_FLAGS);
+        append16(out, 4);
+        append32(out, ((r.flags & FLAG_TX) ? PCAPNG_EPB_OUTBOUND : PCAPNG_EPB_INBOUND) |
+                          ((r.flags & FLAG_CRC_BAD) ? PCAPNG_EPB_CRC_ERROR : 0));
+        append32(out, 0); // End of options
+        append32(out, blockLen);
+    }
+#endif
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "concurrency/Lock.h"
+#include "configuration.h"
+#ifdef ARCH_PORTDUINO
+#include <mutex>
+#endif
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// Bytes of the most recent frames we keep, as sent and received on the air.  Each frame costs its length plus 16 bytes, so
+// a few KB holds the last few dozen.  0 leaves capture out
+#ifndef FRAME_CAPTURE_BYTES
+#if defined(ARCH_PORTDUINO)
+#define FRAME_CAPTURE_BYTES (256 * 1024)
+#elif defined(ARCH_STM32WL)
+#define FRAME_CAPTURE_BYTES 0
+#else
+#define FRAME_CAPTURE_BYTES 4096
+#endif
+#endif
+
+#define FRAME_CAPTURE_LINKTYPE_LORATAP 270 // Wireshark dissects the LoRaTap header, then the frame as LoRa payload
+#define FRAME_CAPTURE_LORATAP_LEN 15
+
+/**
+ * The last FRAME_CAPTURE_BYTES of LoRa frames we sent and received, with their RSSI, SNR, frequency and time, ready to be
+ * downloaded as a pcapng file for Wireshark (from /capture.pcapng on the web server).  Capturing is one copy into a ring of
+ * bytes, the oldest frames make room for new ones, so it can stay on all the time.
+ *
+ * Frames are kept as they were on the air: forward error correction parity and aggregation included, and a received frame
+ * whether or not its CRC was good (the pcapng flags say which).
+ */
+class FrameCapture
+{
+  public:
+    /// Keep a copy of a frame that just went out or came in
+    void add(bool tx, const uint8_t *frame, size_t len, float freqMHz, float bwKHz, uint8_t sf, int16_t rssi, float snr,
+             bool crcOk = true);
+
+    /// Append everything we have, oldest first, to out as a pcapng file
+    void writePcapng(std::vector<uint8_t> &out);
+
+    size_t size() const { return count; }
+    void clear();
+
+  private:
+    struct __attribute__((packed)) Record {
+        uint32_t msec;   // millis() when it went out or came in
+        uint32_t freqHz; // Frequency it was on
+        int16_t rssi;
+        int8_t snrX4;
+        uint8_t flags;
+        uint16_t len; // Of the frame that follows
+        uint8_t sf;
+        uint8_t bwSteps; // Bandwidth in steps of 125kHz, as LoRaTap has it
+    };
+    static_assert(sizeof(Record) == 16, "Record is 16 bytes");
+
+    enum { FLAG_TX = 1, FLAG_CRC_BAD = 2 };
+
+#if FRAME_CAPTURE_BYTES
+    uint8_t ring[FRAME_CAPTURE_BYTES];
+#endif
+    size_t head = 0; // Where the next record goes
+    size_t tail = 0; // The oldest record
+    size_t used = 0;
+    size_t count = 0;
+#ifdef ARCH_PORTDUINO
+    std::mutex lock; // The Linux web server reads us from its own threads, which concurrency::Lock doesn't guard against here
+#else
+    concurrency::Lock lock;
+#endif
+
+    void put(const void *data, size_t len);
+    void get(size_t at, void *data, size_t len) const;
+};
+
+extern FrameCapture frameCapture;
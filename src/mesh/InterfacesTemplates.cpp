@@ -27,12 +27,18 @@ template class SX126xInterface<STM32WLx>;
 
 #if HAS_ETHERNET && !defined(USE_WS5500)
 #include "api/ethServerAPI.h"
-template class ServerAPI<EthernetClient>;
-template class APIServerPort<ethServerAPI, EthernetServer>;
+template class ServerAPI<ethBurstClient>;
+template class APIServerPort<ethServerAPI, ethBurstServer>;
 #endif
 
 #if HAS_WIFI
 #include "api/WiFiServerAPI.h"
 template class ServerAPI<WiFiClient>;
 template class APIServerPort<WiFiServerAPI, WiFiServer>;
+#endif
+
+#ifdef ARCH_PORTDUINO
+#include "api/UnixServerAPI.h"
+template class ServerAPI<UnixClient>;
+template class APIServerPort<UnixServerAPI, UnixServer>;
 #endif
\ No newline at end of file
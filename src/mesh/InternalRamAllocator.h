@@ -0,0 +1,44 @@
+#pragma once
+
+#include "configuration.h"
+#include <stdlib.h>
+
+#ifdef ARCH_ESP32
+#include <esp_heap_caps.h>
+#endif
+
+/**
+ * A std::allocator stand-in for containers that are read on every packet.  On ESP32 boards with PSRAM, malloc hands
+ * anything bigger than CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL out of PSRAM, which suits bulk data but makes every cache
+ * miss a trip over SPI.  This keeps the container in internal RAM instead, and falls back to malloc (so to PSRAM) rather
+ * than fail when internal RAM runs out.  Everywhere else it is just malloc.
+ */
+template <class T> struct InternalRamAllocator {
+    typedef T value_type;
+
+    InternalRamAllocator() {}
+    template <class U> InternalRamAllocator(const InternalRamAllocator<U> &) {}
+
+    T *allocate(size_t n)
+    {
+        size_t bytes = n * sizeof(T);
+#ifdef ARCH_ESP32
+        void *p = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (p)
+            return static_cast<T *>(p);
+#endif
+        return static_cast<T *>(malloc(bytes));
+    }
+
+    void deallocate(T *p, size_t) { free(p); }
+};
+
+template <class T, class U> bool operator==(const InternalRamAllocator<T> &, const InternalRamAllocator<U> &)
+{
+    return true;
+}
+
+template <class T, class U> bool operator!=(const InternalRamAllocator<T> &, const InternalRamAllocator<U> &)
+{
+    return false;
+}
@@ -242,13 +242,14 @@ template <typename T> void LR11x0Interface<T>::startReceive()
 
     // We use a 16 bit preamble so this should save some power by letting radio sit in standby mostly.
     int err =
-        lora.startReceive(RADIOLIB_LR11X0_RX_TIMEOUT_INF, MESHTASTIC_RADIOLIB_IRQ_RX_FLAGS, RADIOLIB_IRQ_RX_DEFAULT_MASK, 0);
+        lora.startReceive(RADIOLIB_LR11X0_RX_TIMEOUT_INF, MESHTASTIC_RADIOLIB_IRQ_RX_FLAGS, MESHTASTIC_RADIOLIB_IRQ_RX_MASK, 0);
     assert(err == RADIOLIB_ERR_NONE);
+    rxActivityIrq = RX_ACTIVITY_IRQ;
 
     RadioLibInterface::startReceive();
 
     // Must be done AFTER, starting transmit, because startTransmit clears (possibly stale) interrupt pending register bits
-    enableInterrupt(isrRxLevel0);
+    enableInterrupt(rxIsr());
 #endif
 }
 
@@ -278,10 +279,14 @@ template <typename T> bool LR11x0Interface<T>::isChannelActive()
 /** Could we send right now (i.e. either not actively receiving or transmitting)? */
 template <typename T> bool LR11x0Interface<T>::isActivelyReceiving()
 {
+#if RX_ACTIVITY_IRQ
+    return rxActivitySeen();
+#else
     // The IRQ status will be cleared when we start our read operation. Check if we've started a header, but haven't yet
     // received and handled the interrupt for reading the packet/handling errors.
     return receiveDetected(lora.getIrqStatus(), RADIOLIB_LR11X0_IRQ_SYNC_WORD_HEADER_VALID,
                            RADIOLIB_LR11X0_IRQ_PREAMBLE_DETECTED);
+#endif
 }
 
 template <typename T> bool LR11x0Interface<T>::sleep()
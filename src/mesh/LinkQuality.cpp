@@ -0,0 +1,103 @@
+#include "LinkQuality.h"
+#include "configuration.h"
+#include <Throttle.h>
+
+LinkQuality linkQuality;
+
+LinkStats *LinkQuality::find(NodeNum node)
+{
+    if (!node)
+        return nullptr;
+    for (size_t i = slotFor(node);; i = (i + 1) % LINK_QUALITY_CAPACITY) {
+        if (table[i].node == node)
+            return &table[i];
+        if (!table[i].node)
+            return nullptr; // The table is never full, so every probe ends at a free slot
+    }
+}
+
+LinkStats *LinkQuality::heard(NodeNum node, float snr)
+{
+    if (!node)
+        return nullptr;
+
+    LinkStats *link = find(node);
+    if (link) {
+        link->snr += LINK_QUALITY_SNR_SMOOTHING * (snr - link->snr);
+        link->lastHeard = millis();
+        return link;
+    }
+
+    if (count >= LINK_QUALITY_MAX_NEIGHBORS) {
+        // Make room by forgetting whoever we heard from longest ago
+        size_t oldest = LINK_QUALITY_CAPACITY;
+        uint32_t now = millis();
+        for (size_t i = 0; i < LINK_QUALITY_CAPACITY; i++)
+            if (table[i].node && (oldest == LINK_QUALITY_CAPACITY || now - table[i].lastHeard > now - table[oldest].lastHeard))
+                oldest = i;
+        LOG_DEBUG("Neighbor table full, forget 0x%x", table[oldest].node);
+        removeAt(oldest);
+    }
+
+    size_t i = slotFor(node);
+    while (table[i].node)
+        i = (i + 1) % LINK_QUALITY_CAPACITY;
+    table[i].node = node;
+    table[i].snr = snr;
+    table[i].lastHeard = millis();
+    table[i].broadcastIntervalSecs = 0;
+    count++;
+    return &table[i];
+}
+
+bool LinkQuality::getRelaySnr(uint8_t relay, float &snr) const
+{
+    bool found = false;
+    forEach([&](const LinkStats &link) {
+        if ((link.node & 0xFF) == relay && (!found || link.snr > snr)) {
+            snr = link.snr;
+            found = true;
+        }
+    });
+    return found;
+}
+
+void LinkQuality::expire(uint32_t defaultIntervalSecs)
+{
+    for (size_t i = 0; i < LINK_QUALITY_CAPACITY;) {
+        const LinkStats &link = table[i];
+        uint32_t intervalSecs = link.broadcastIntervalSecs ? link.broadcastIntervalSecs : defaultIntervalSecs;
+        if (link.node && !Throttle::isWithinTimespanMs(link.lastHeard, intervalSecs * 2 * 1000)) {
+            LOG_DEBUG("Remove neighbor with node ID 0x%x", link.node);
+            removeAt(i); // May move another entry into slot i, so look at it again
+        } else {
+            i++;
+        }
+    }
+}
+
+void LinkQuality::clear()
+{
+    for (LinkStats &link : table)
+        link = LinkStats();
+    count = 0;
+}
+
+/**
+ * Backward shift deletion: pull later entries of the probe sequence into the hole so lookups never need tombstones
+ */
+void LinkQuality::removeAt(size_t hole)
+{
+    table[hole].node = 0;
+    count--;
+    for (size_t i = (hole + 1) % LINK_QUALITY_CAPACITY; table[i].node; i = (i + 1) % LINK_QUALITY_CAPACITY) {
+        size_t home = slotFor(table[i].node);
+        // Move the entry unless its home slot lies cyclically in (hole, i]
+        bool homeBetween = hole < i ? (home > hole && home <= i) : (home > hole || home <= i);
+        if (!homeBetween) {
+            table[hole] = table[i];
+            table[i].node = 0;
+            hole = i;
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "MeshTypes.h"
+#include <stddef.h>
+
+#define LINK_QUALITY_CAPACITY 32      // Slots in the neighbor table, a power of two
+#define LINK_QUALITY_MAX_NEIGHBORS 24 // Keep the table at most 3/4 full so probe sequences stay short
+#define LINK_QUALITY_SNR_SMOOTHING 0.25f
+
+/**
+ * What we know about the link to a node we hear directly
+ */
+struct LinkStats {
+    NodeNum node;                   // 0 if the slot is free
+    float snr;                      // Moving average of the SNR we hear it at
+    uint32_t lastHeard;             // millis() of the last packet heard straight from it
+    uint32_t broadcastIntervalSecs; // How often it says it sends NeighborInfo, 0 if it never told us
+};
+
+/**
+ * Our 0-hop neighbors, shared by NeighborInfo, the routers and the contention window logic so they don't each keep their
+ * own copy.  A fixed size open addressed table keyed by node number, so noting a packet is O(1) and nothing is allocated.
+ */
+class LinkQuality
+{
+  public:
+    /// Note a packet heard straight from node at snr, @return its entry (nullptr for node 0)
+    LinkStats *heard(NodeNum node, float snr);
+
+    LinkStats *find(NodeNum node);
+    const LinkStats *find(NodeNum node) const { return const_cast<LinkQuality *>(this)->find(node); }
+
+    /// Best SNR of the neighbors whose node number ends in relay (next hops are only known by that byte)
+    /// @return false if we don't hear any of them
+    bool getRelaySnr(uint8_t relay, float &snr) const;
+
+    /// Forget neighbors not heard for twice their broadcast interval, defaultIntervalSecs for the ones that never told us
+    void expire(uint32_t defaultIntervalSecs);
+
+    void clear();
+    size_t size() const { return count; }
+
+    /// Call f(const LinkStats &) for every neighbor, in no particular order
+    template <typename F> void forEach(F f) const
+    {
+        for (size_t i = 0; i < LINK_QUALITY_CAPACITY; i++)
+            if (table[i].node)
+                f(table[i]);
+    }
+
+  private:
+    LinkStats table[LINK_QUALITY_CAPACITY] = {};
+    size_t count = 0;
+
+    static size_t slotFor(NodeNum node) { return (node * 2654435761u) >> 27; } // Top 5 bits of a Fibonacci hash
+    void removeAt(size_t i);
+};
+
+static_assert(LINK_QUALITY_CAPACITY == 32, "slotFor() picks 5 bits");
+
+extern LinkQuality linkQuality;
@@ -0,0 +1,186 @@
+#include "LinkRate.h"
+#include "LinkQuality.h"
+#include "NodeDB.h"
+#include "Router.h"
+#include "Throttle.h"
+#include "configuration.h"
+
+LinkRate *linkRate;
+
+LinkRate::LinkRate(RadioInterface *radio) : concurrency::OSThread("LinkRate"), radio(radio) {}
+
+uint8_t LinkRate::pickSpreadingFactor(float snr, uint8_t presetSf)
+{
+    for (uint8_t sf = LINK_RATE_MIN_SF; sf < presetSf; sf++) {
+        // Demodulation floor from the SX126x/SX127x datasheets: -7.5 dB at SF7, 2.5 dB lower for every step up
+        float floorDb = -7.5f - 2.5f * (sf - 7);
+        if (snr - LINK_RATE_SNR_MARGIN >= floorDb)
+            return sf;
+    }
+    return 0;
+}
+
+void LinkRate::heardNodeInfo(NodeNum node, const meshtastic_Data &d)
+{
+    meshtastic_NodeInfoLite *info = nodeDB->getMeshNode(node);
+    if (!info)
+        return;
+    if (d.has_bitfield && (d.bitfield & BITFIELD_READS_LINK_RATE_MASK))
+        info->bitfield |= NODEINFO_BITFIELD_READS_LINK_RATE_MASK;
+    else
+        info->bitfield &= ~NODEINFO_BITFIELD_READS_LINK_RATE_MASK;
+}
+
+bool LinkRate::isForPeer(const meshtastic_MeshPacket *p) const
+{
+    return p->to == peer || (p->next_hop != NO_NEXT_HOP_PREFERENCE && p->next_hop == (peer & 0xff));
+}
+
+void LinkRate::setState(State s)
+{
+    state = s;
+    stateSince = millis();
+    setIntervalFromNow(0);
+}
+
+void LinkRate::onEncode(meshtastic_MeshPacket *p)
+{
+    p->decoded.bitfield &= ~BITFIELD_LINK_SF_MASK; // A retransmission may have been encoded with an offer before
+    if (isBroadcast(p->to))
+        return;
+
+    if (state == SWITCHING || state == ACTIVE) {
+        if (isForPeer(p))
+            lastActivity = millis();
+        return;
+    }
+    if (state == ACCEPTING) {
+        if (p->to == peer) {
+            p->decoded.has_bitfield = true;
+            p->decoded.bitfield |= linkSf << BITFIELD_LINK_SF_SHIFT;
+            acceptId = p->id;
+        }
+        return;
+    }
+    if (state == OFFERED && p->to != peer)
+        return; // One offer at a time
+
+    const meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(p->to);
+    if (!node || !(node->bitfield & NODEINFO_BITFIELD_READS_LINK_RATE_MASK))
+        return;
+    const LinkStats *link = linkQuality.find(p->to);
+    if (!link || !Throttle::isWithinTimespanMs(link->lastHeard, LINK_RATE_NEIGHBOUR_MSEC))
+        return;
+    if (radio->numQueuedFor(p->to) < LINK_RATE_MIN_BACKLOG)
+        return; // Not worth the trouble for a packet or two
+    uint8_t sf = pickSpreadingFactor(link->snr, radio->getPresetSpreadingFactor());
+    if (!sf)
+        return;
+
+    LOG_DEBUG("Offer 0x%x SF%u for a backlog of %u", p->to, sf, (unsigned)radio->numQueuedFor(p->to));
+    p->decoded.has_bitfield = true;
+    p->decoded.bitfield |= sf << BITFIELD_LINK_SF_SHIFT;
+    peer = p->to;
+    linkSf = sf;
+    setState(OFFERED);
+}
+
+void LinkRate::onDecoded(const meshtastic_MeshPacket *p)
+{
+    // Only what the neighbour itself sent us counts
+    if (!isToUs(p) || isFromUs(p) || p->hop_start == 0 || p->hop_start != p->hop_limit)
+        return;
+    if (state == ACTIVE && p->from == peer)
+        lastActivity = millis();
+
+    uint8_t sf = p->decoded.has_bitfield ? (p->decoded.bitfield & BITFIELD_LINK_SF_MASK) >> BITFIELD_LINK_SF_SHIFT : 0;
+    if (!sf || sf >= radio->getPresetSpreadingFactor())
+        return;
+
+    if (state == OFFERED && p->from == peer) {
+        // Their acceptance, or an offer that crossed ours: either way the slower of the two works for both of us
+        if (sf > linkSf)
+            linkSf = sf;
+        LOG_DEBUG("0x%x accepted SF%u", peer, linkSf);
+        setState(SWITCHING);
+    } else if (state == IDLE) {
+        const LinkStats *link = linkQuality.find(p->from);
+        uint8_t ours = pickSpreadingFactor(link ? link->snr : p->rx_snr, radio->getPresetSpreadingFactor());
+        if (!ours)
+            return; // Declined by saying nothing
+        peer = p->from;
+        linkSf = ours > sf ? ours : sf;
+        acceptId = 0;
+        LOG_DEBUG("0x%x offered SF%u, accept SF%u", peer, sf, linkSf);
+        setState(ACCEPTING);
+    }
+}
+
+bool LinkRate::beforeTransmit(const meshtastic_MeshPacket *txp)
+{
+    if (state != ACTIVE)
+        return false;
+    if (isForPeer(txp)) {
+        lastActivity = millis();
+        return true;
+    }
+    return !endWindow("traffic for others");
+}
+
+bool LinkRate::endWindow(const char *why)
+{
+    if (!radio->setLinkSpreadingFactor(0))
+        return false;
+    LOG_INFO("Back to SF%u, window with 0x%x over: %s", radio->getPresetSpreadingFactor(), peer, why);
+    setState(IDLE);
+    return true;
+}
+
+int32_t LinkRate::runOnce()
+{
+    switch (state) {
+    case IDLE:
+        return INT32_MAX;
+
+    case OFFERED:
+        if (Throttle::isWithinTimespanMs(stateSince, LINK_RATE_OFFER_MSEC))
+            return LINK_RATE_OFFER_MSEC - (millis() - stateSince);
+        setState(IDLE);
+        return INT32_MAX;
+
+    case ACCEPTING:
+    case SWITCHING:
+        if (!Throttle::isWithinTimespanMs(stateSince, LINK_RATE_OFFER_MSEC)) {
+            LOG_DEBUG("Gave up on a window with 0x%x", peer);
+            setState(IDLE);
+            return INT32_MAX;
+        }
+        // Our acceptance has to go out at the preset's rate
+        if (state == ACCEPTING && (!acceptId || radio->findInTxQueue(nodeDB->getNodeNum(), acceptId)))
+            return LINK_RATE_POLL_MSEC;
+        if (!radio->setLinkSpreadingFactor(linkSf))
+            return LINK_RATE_POLL_MSEC; // Still sending or receiving
+        LOG_INFO("SF%u window with 0x%x", linkSf, peer);
+        setState(ACTIVE);
+        lastActivity = stateSince;
+        return LINK_RATE_POLL_MSEC;
+
+    case ACTIVE: {
+        if (radio->getSpreadingFactor() != linkSf) {
+            setState(IDLE); // Reconfigured under us
+            return INT32_MAX;
+        }
+        bool idle = !Throttle::isWithinTimespanMs(lastActivity, LINK_RATE_IDLE_MSEC);
+        bool tooLong = !Throttle::isWithinTimespanMs(stateSince, LINK_RATE_MAX_WINDOW_MSEC);
+        if (idle || tooLong) {
+            if (!endWindow(idle ? "idle" : "too long"))
+                return LINK_RATE_POLL_MSEC;
+            return INT32_MAX;
+        }
+        uint32_t idleLeft = LINK_RATE_IDLE_MSEC - (millis() - lastActivity);
+        uint32_t windowLeft = LINK_RATE_MAX_WINDOW_MSEC - (millis() - stateSince);
+        return idleLeft < windowLeft ? idleLeft : windowLeft;
+    }
+    }
+    return INT32_MAX;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "MeshTypes.h"
+#include "RadioInterface.h"
+#include "concurrency/OSThread.h"
+
+// Set to 1 to let strong direct links trade the preset's spreading factor for a faster one while a burst of unicasts goes
+// between the two nodes.  Both of them stop hearing the rest of the mesh for the length of the window, so it is off by default.
+#ifndef LINK_RATE_ADAPTATION
+#define LINK_RATE_ADAPTATION 0
+#endif
+// SNR (dB) a link needs above the demodulation floor of a spreading factor to use it, for fading and for the way back
+#ifndef LINK_RATE_SNR_MARGIN
+#define LINK_RATE_SNR_MARGIN 10
+#endif
+#define LINK_RATE_MIN_SF 7 // Below this SX127x need an implicit header
+// Packets still queued for the neighbour, besides the one being sent, before we offer a window
+#ifndef LINK_RATE_MIN_BACKLOG
+#define LINK_RATE_MIN_BACKLOG 2
+#endif
+#ifndef LINK_RATE_OFFER_MSEC
+#define LINK_RATE_OFFER_MSEC 15000 // How long an offer, ours or theirs, stands
+#endif
+#ifndef LINK_RATE_IDLE_MSEC
+#define LINK_RATE_IDLE_MSEC 3000 // A window with nothing going either way for this long is over
+#endif
+#ifndef LINK_RATE_MAX_WINDOW_MSEC
+#define LINK_RATE_MAX_WINDOW_MSEC 60000 // Longest we are away from the rest of the mesh in one go
+#endif
+#define LINK_RATE_NEIGHBOUR_MSEC (15 * 60 * 1000) // Only a link we heard this recently can be strong enough
+#define LINK_RATE_POLL_MSEC 50                    // While we wait for the radio to be free to switch
+
+/**
+ * A faster spreading factor for a burst of unicasts between two direct neighbours: S&F replays, XModem, admin sessions.
+ *
+ * When we have a backlog for a neighbour that LinkQuality hears well enough for a faster spreading factor, and whose NodeInfo
+ * says it can do this (BITFIELD_READS_LINK_RATE), the next packet to it offers that spreading factor in its Data bitfield
+ * (BITFIELD_LINK_SF).  The neighbour accepts by putting the one it can live with, never faster than the offer, on its next
+ * packet back to us, usually the ACK, and switches once that has gone out.  When we hear it we switch too, and the rest of
+ * the backlog and its ACKs go at the faster rate, on the preset's bandwidth and frequency.
+ *
+ * Either side goes back to the preset as soon as it has something to send to anyone else, after LINK_RATE_IDLE_MSEC with
+ * nothing between the two, and after LINK_RATE_MAX_WINDOW_MSEC in any case.  A lost offer or acceptance just means no window,
+ * and a packet sent while only one side has switched is retransmitted like any other lost packet.
+ */
+class LinkRate : private concurrency::OSThread
+{
+  public:
+    explicit LinkRate(RadioInterface *radio);
+
+    /// Add an offer or acceptance to p, one of our own packets, just before it is encrypted
+    void onEncode(meshtastic_MeshPacket *p);
+
+    /// Look for an offer or acceptance on p, which was just decoded
+    void onDecoded(const meshtastic_MeshPacket *p);
+
+    /**
+     * txp is about to go on the air, leave the window if it is for someone else.
+     * @return true if we are (still) in a window, so nothing else may share txp's frame
+     */
+    bool beforeTransmit(const meshtastic_MeshPacket *txp);
+
+    /// The fastest spreading factor a link heard at snr can take, 0 if none is faster than presetSf
+    static uint8_t pickSpreadingFactor(float snr, uint8_t presetSf);
+
+    /// Note what a NodeInfo from node said about link rate windows
+    static void heardNodeInfo(NodeNum node, const meshtastic_Data &d);
+
+  protected:
+    virtual int32_t runOnce() override;
+
+  private:
+    enum State {
+        IDLE,
+        OFFERED,   // We offered peer linkSf, waiting to hear it accept
+        ACCEPTING, // Peer offered, we switch once acceptId, which says so, has gone out
+        SWITCHING, // Peer accepted, we switch as soon as the radio is free
+        ACTIVE     // Radio is on linkSf
+    };
+
+    RadioInterface *radio;
+    State state = IDLE;
+    NodeNum peer = 0;
+    uint8_t linkSf = 0;
+    PacketId acceptId = 0;
+    uint32_t stateSince = 0;
+    uint32_t lastActivity = 0;
+
+    bool isForPeer(const meshtastic_MeshPacket *p) const;
+    void setState(State s);
+
+    /// Back to the preset's spreading factor, false if the radio is busy and we have to try again
+    bool endWindow(const char *why);
+};
+
+extern LinkRate *linkRate;
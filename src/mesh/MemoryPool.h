@@ -2,11 +2,20 @@
 
 #include <Arduino.h>
 #include <assert.h>
+#include <atomic>
 #include <functional>
 #include <memory>
 
 #include "PointerQueue.h"
 
+/// Occupancy counters for an allocator, so pool sizes can be tuned from real use
+struct AllocatorStats {
+    uint32_t capacity;      // Number of preallocated buffers (0 for purely dynamic allocators)
+    uint32_t inUse;         // Buffers currently handed out from the preallocated area
+    uint32_t highWater;     // Most buffers ever handed out at once from the preallocated area
+    uint32_t allocFailures; // Allocations that found the preallocated area empty
+};
+
 template <class T> class Allocator
 {
 
@@ -65,6 +74,17 @@ template <class T> class Allocator
     /// Return a buffer for use by others
     virtual void release(T *p) = 0;
 
+    /// Return another reference to a buffer that the caller promises not to modify, the reference must be released like any
+    /// other allocation. Allocators that don't track references just hand out a copy.
+    virtual T *share(const T *p) { return allocCopy(*p); }
+
+    /// Make sure the caller owns the only reference to p before modifying it. Returns p itself or a private copy, in the
+    /// latter case the reference to p has been released.
+    virtual T *makeWritable(T *p) { return p; }
+
+    /// Fill in occupancy counters, returns false if this allocator doesn't keep any
+    virtual bool getStats(AllocatorStats &stats) { return false; }
+
   protected:
     // Alloc some storage
     virtual T *alloc(TickType_t maxWait) = 0;
@@ -96,3 +116,116 @@ template <class T> class MemoryDynamic : public Allocator<T>
         return p;
     }
 };
+
+/**
+ * An allocator backed by a fixed array of MaxSize buffers, so steady state traffic never touches the heap.
+ *
+ * Free buffers are kept on a lock-free stack (safe to use from ISR code). The head carries a tag which is bumped on
+ * every update so a pop can't be fooled by the same buffer being released and reallocated underneath it. If the array
+ * runs dry we count a failure and fall back to malloc rather than asserting, release() tells the two apart by address.
+ *
+ * Buffers from the array are reference counted, so share() lets several consumers hold the same packet without copying
+ * it. Overflow buffers from malloc are not counted and get copied instead.
+ */
+template <class T, uint16_t MaxSize> class MemoryStatic : public Allocator<T>
+{
+    enum : uint16_t { NONE = 0xFFFF };
+
+    T buf[MaxSize];
+    uint16_t next[MaxSize]; // Next free buffer after this one, only meaningful while the buffer is free
+    std::atomic<uint32_t> refs[MaxSize];
+    std::atomic<uint32_t> freeHead; // tag << 16 | index of first free buffer
+
+    std::atomic<uint32_t> inUse;
+    std::atomic<uint32_t> highWater;
+    std::atomic<uint32_t> allocFailures;
+
+  public:
+    MemoryStatic() : freeHead(0), inUse(0), highWater(0), allocFailures(0)
+    {
+        static_assert(MaxSize > 0 && MaxSize < NONE, "MemoryStatic size out of range");
+        for (uint16_t i = 0; i < MaxSize; i++) {
+            next[i] = (i + 1 < MaxSize) ? i + 1 : NONE;
+            refs[i] = 0;
+        }
+    }
+
+    /// Return a buffer for use by others
+    virtual void release(T *p) override
+    {
+        assert(p);
+
+        if (!isPooled(p)) {
+            free(p); // This came from the overflow path in alloc()
+            return;
+        }
+
+        uint16_t index = p - buf;
+        assert(refs[index] > 0);
+        if (--refs[index] > 0)
+            return; // Somebody else still holds this buffer
+
+        inUse--; // Before the push, so a racing alloc() can't count this buffer twice
+        uint32_t head = freeHead.load();
+        do {
+            next[index] = head & 0xFFFF;
+        } while (!freeHead.compare_exchange_weak(head, ((head >> 16) + 1) << 16 | index));
+    }
+
+    virtual T *share(const T *p) override
+    {
+        assert(p);
+        if (!isPooled(p))
+            return Allocator<T>::share(p);
+
+        refs[p - buf]++;
+        return const_cast<T *>(p);
+    }
+
+    virtual T *makeWritable(T *p) override
+    {
+        assert(p);
+        if (!isPooled(p) || refs[p - buf] == 1)
+            return p;
+
+        T *copy = this->allocCopy(*p);
+        release(p);
+        return copy;
+    }
+
+    virtual bool getStats(AllocatorStats &stats) override
+    {
+        stats.capacity = MaxSize;
+        stats.inUse = inUse.load();
+        stats.highWater = highWater.load();
+        stats.allocFailures = allocFailures.load();
+        return true;
+    }
+
+  protected:
+    // Alloc some storage
+    virtual T *alloc(TickType_t maxWait) override
+    {
+        uint32_t head = freeHead.load();
+        uint16_t index;
+        do {
+            index = head & 0xFFFF;
+            if (index == NONE) {
+                allocFailures++;
+                T *p = (T *)malloc(sizeof(T));
+                assert(p);
+                return p;
+            }
+        } while (!freeHead.compare_exchange_weak(head, ((head >> 16) + 1) << 16 | next[index]));
+
+        refs[index] = 1;
+        uint32_t used = ++inUse;
+        uint32_t high = highWater.load();
+        while (used > high && !highWater.compare_exchange_weak(high, used))
+            ;
+        return &buf[index];
+    }
+
+  private:
+    bool isPooled(const T *p) const { return p >= buf && p < buf + MaxSize; }
+};
@@ -2,12 +2,17 @@
 #include "Channels.h"
 #include "MeshService.h"
 #include "NodeDB.h"
+#include "PerfCounters.h"
 #include "configuration.h"
 #include "modules/RoutingModule.h"
 #include <algorithm>
 #include <assert.h>
 
 std::vector<MeshModule *> *MeshModule::modules;
+std::vector<MeshModule::PortModules> MeshModule::portModules;
+std::vector<MeshModule *> MeshModule::anyPortModules;
+std::vector<MeshModule *> MeshModule::encryptedModules;
+bool MeshModule::dispatchStale = true;
 
 const meshtastic_MeshPacket *MeshModule::currentRequest;
 uint8_t MeshModule::numPeriodicModules = 0;
@@ -25,6 +30,7 @@ MeshModule::MeshModule(const char *_name) : name(_name)
         modules = new std::vector<MeshModule *>();
 
     modules->push_back(this);
+    dispatchStale = true;
 }
 
 void MeshModule::setup() {}
@@ -34,6 +40,7 @@ MeshModule::~MeshModule()
     auto it = std::find(modules->begin(), modules->end(), this);
     assert(it != modules->end());
     modules->erase(it);
+    dispatchStale = true;
 }
 
 // ⚠️ **Only call once** to set the initial delay before a module starts broadcasting periodically
@@ -85,8 +92,68 @@ meshtastic_MeshPacket *MeshModule::allocErrorResponse(meshtastic_Routing_Error e
     return r;
 }
 
+bool MeshModule::anySnifferNeedsPlaintext()
+{
+    for (auto i = modules->begin(); i != modules->end(); ++i)
+        if ((*i)->isPromiscuous && !(*i)->encryptedOk)
+            return true;
+    return false;
+}
+
+bool MeshModule::portBefore(const PortModules &pm, int port)
+{
+    return pm.port < port;
+}
+
+// Modules only know their port once fully constructed, so the lists are made on first use rather than as they register
+void MeshModule::buildDispatch()
+{
+    portModules.clear();
+    anyPortModules.clear();
+    encryptedModules.clear();
+
+    for (auto m : *modules) {
+        if (m->encryptedOk)
+            encryptedModules.push_back(m);
+        int port = m->getDispatchPort();
+        if (port == MESHMODULE_ANY_PORT) {
+            anyPortModules.push_back(m);
+            continue;
+        }
+        auto it = std::lower_bound(portModules.begin(), portModules.end(), port, portBefore);
+        if (it == portModules.end() || it->port != port) {
+            PortModules pm;
+            pm.port = port;
+            portModules.insert(it, pm);
+        }
+    }
+
+    // Creation order is the order callModules always asked in, which matters once a module returns STOP
+    for (auto &pm : portModules)
+        for (auto m : *modules)
+            if (m->getDispatchPort() == pm.port || m->getDispatchPort() == MESHMODULE_ANY_PORT)
+                pm.modules.push_back(m);
+
+    dispatchStale = false;
+    LOG_DEBUG("Module dispatch: %u ports, %u modules on any port", (unsigned)portModules.size(),
+              (unsigned)anyPortModules.size());
+}
+
+const std::vector<MeshModule *> &MeshModule::getDispatch(const meshtastic_MeshPacket &mp)
+{
+    if (dispatchStale)
+        buildDispatch();
+    if (mp.which_payload_variant != meshtastic_MeshPacket_decoded_tag)
+        return encryptedModules;
+
+    int port = mp.decoded.portnum;
+    auto it = std::lower_bound(portModules.begin(), portModules.end(), port, portBefore);
+    return (it != portModules.end() && it->port == port) ? it->modules : anyPortModules;
+}
+
 void MeshModule::callModules(meshtastic_MeshPacket &mp, RxSource src, const char *specificModule)
 {
+    PERF_SCOPE(PERF_CALL_MODULES);
     if (specificModule) {
         LOG_DEBUG("Calling specific module: %s", specificModule);
     }
@@ -104,7 +171,9 @@ void MeshModule::callModules(meshtastic_MeshPacket &mp, RxSource src, const char
     auto ourNodeNum = nodeDB->getNodeNum();
     bool toUs = isBroadcast(mp.to) || isToUs(&mp);
 
-    for (auto i = modules->begin(); i != modules->end(); ++i) {
+    // Only the modules that could want this packet, asking every module costs a virtual call each
+    const std::vector<MeshModule *> &candidates = specificModule ? *modules : getDispatch(mp);
+    for (auto i = candidates.begin(); i != candidates.end(); ++i) {
         auto &pi = **i;
 
         // If specificModule is provided, only call that specific module
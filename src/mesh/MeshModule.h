@@ -12,6 +12,8 @@
 #define MESHMODULE_MIN_BROADCAST_DELAY_MS 30 * 1000 // Min. delay after boot before sending first broadcast by any module
 #define MESHMODULE_BROADCAST_SPACING_MS 15 * 1000   // Initial spacing between broadcasts of different modules
 
+#define MESHMODULE_ANY_PORT -1 // getDispatchPort() of a module that may want packets on more than one port
+
 /** handleReceived return enumeration
  *
  * Use ProcessMessage::CONTINUE to allows other modules to process a message.
@@ -63,6 +65,20 @@ class MeshModule
 {
     static std::vector<MeshModule *> *modules;
 
+    /// The modules callModules asks about a decoded packet on port, in the order they were created
+    struct PortModules {
+        int port;
+        std::vector<MeshModule *> modules; // Those registered for port, and the MESHMODULE_ANY_PORT ones
+    };
+    static std::vector<PortModules> portModules; // Sorted by port
+    static std::vector<MeshModule *> anyPortModules;
+    static std::vector<MeshModule *> encryptedModules; // Asked about packets we couldn't decode
+    static bool dispatchStale;                         // A module came or went since the lists were made
+
+    static bool portBefore(const PortModules &pm, int port);
+    static void buildDispatch();
+    static const std::vector<MeshModule *> &getDispatch(const meshtastic_MeshPacket &mp);
+
   public:
     /** Constructor
      * name is for debugging output
@@ -75,6 +91,9 @@ class MeshModule
      */
     static void callModules(meshtastic_MeshPacket &mp, RxSource src = RX_SRC_RADIO, const char *specificModule = nullptr);
 
+    /** @return true if some module sniffs packets that aren't for us and can only make sense of them decoded */
+    static bool anySnifferNeedsPlaintext();
+
     static std::vector<MeshModule *> GetMeshModulesWithUIFrames(int startIndex);
     static void observeUIEvents(Observer<const UIFrameEvent *> *observer);
     static AdminMessageHandleResult handleAdminMessageForAllModules(const meshtastic_MeshPacket &mp,
@@ -144,6 +163,12 @@ class MeshModule
      */
     virtual bool wantPacket(const meshtastic_MeshPacket *p) = 0;
 
+    /**
+     * The only portnum wantPacket() can be true for, so callModules doesn't need to ask about any other.  Override this
+     * together with wantPacket(), MESHMODULE_ANY_PORT if it may want more than one port.
+     */
+    virtual int getDispatchPort() const { return MESHMODULE_ANY_PORT; }
+
     /** Called to handle a particular incoming message
 
     @return ProcessMessage::STOP if you've guaranteed you've handled this message and no other handlers should be considered for
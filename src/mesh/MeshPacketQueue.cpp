@@ -28,11 +28,196 @@ bool CompareMeshPacketFunc(const meshtastic_MeshPacket *p1, const meshtastic_Mes
     return (p1p != p2p) ? (p1p > p2p) : (!isFromUs(p1) && isFromUs(p2));
 }
 
-MeshPacketQueue::MeshPacketQueue(size_t _maxLen) : maxLen(_maxLen) {}
+MeshPacketQueue::MeshPacketQueue(size_t _maxLen) : maxLen(_maxLen)
+{
+    assert(maxLen < NONE);
+    entries.resize(maxLen);
+    heap.reserve(maxLen);
+    freeEntries.reserve(maxLen);
+    for (size_t i = maxLen; i > 0; i--)
+        freeEntries.push_back(i - 1);
+
+    // Keep the index at most half full
+    size_t numBuckets = 4;
+    while (numBuckets < 2 * maxLen)
+        numBuckets <<= 1;
+    buckets.assign(numBuckets, NONE);
+}
 
 bool MeshPacketQueue::empty()
 {
-    return queue.empty();
+    return heap.empty();
+}
+
+bool MeshPacketQueue::isBefore(uint16_t a, uint16_t b) const
+{
+    const meshtastic_MeshPacket *pa = entries[a].p, *pb = entries[b].p;
+    if (CompareMeshPacketFunc(pa, pb))
+        return true;
+    if (CompareMeshPacketFunc(pb, pa))
+        return false;
+    return (int32_t)(entries[a].seq - entries[b].seq) < 0; // equal otherwise, so first in first out
+}
+
+bool MeshPacketQueue::isFairerThan(uint16_t a, uint16_t b) const
+{
+    const meshtastic_MeshPacket *pa = entries[a].p, *pb = entries[b].p;
+    if (pa->tx_after) {
+        // Late packets were all given a deadline, serve the most pressing one
+        int32_t diff = (int32_t)(pa->tx_after - pb->tx_after);
+        if (diff != 0)
+            return diff < 0;
+    } else {
+        // Otherwise charge each packet what it would cost its origin, cheapest first
+        uint32_t costA = getOriginAirtime(getFrom(pa)) + entries[a].airtimeMsec;
+        uint32_t costB = getOriginAirtime(getFrom(pb)) + entries[b].airtimeMsec;
+        if (costA != costB)
+            return costA < costB;
+    }
+    return isBefore(a, b);
+}
+
+void MeshPacketQueue::pickFrom(size_t pos, uint16_t &best) const
+{
+    if (pos >= heap.size())
+        return;
+
+    // Nothing below an entry the front outranks can tie with the front either, so that prunes the walk
+    uint16_t e = heap[pos];
+    if (CompareMeshPacketFunc(entries[heap.front()].p, entries[e].p))
+        return;
+
+    if (isFairerThan(e, best))
+        best = e;
+    pickFrom(2 * pos + 1, best);
+    pickFrom(2 * pos + 2, best);
+}
+
+uint16_t MeshPacketQueue::pickNext() const
+{
+    uint16_t best = heap.front();
+    pickFrom(1, best);
+    pickFrom(2, best);
+    return best;
+}
+
+uint32_t MeshPacketQueue::getOriginAirtime(NodeNum from) const
+{
+    for (const OriginAirtime &o : originAirtime) {
+        if (o.msec && o.from == from)
+            return o.msec;
+    }
+    return 0;
+}
+
+void MeshPacketQueue::noteAirtime(NodeNum from, uint32_t airtimeMsec)
+{
+    // Decay lazily, only when usage changes, so getFront() and dequeue() always agree on what goes next
+    uint32_t now = millis();
+    uint32_t halvings = (now - lastHalvingMsec) / FAIRNESS_HALFLIFE_MSEC;
+    if (halvings) {
+        for (OriginAirtime &o : originAirtime)
+            o.msec = halvings < 32 ? o.msec >> halvings : 0;
+        lastHalvingMsec += halvings * FAIRNESS_HALFLIFE_MSEC;
+    }
+
+    // Find this origin, or take over the slot of whoever has used the least
+    OriginAirtime *slot = &originAirtime[0];
+    for (OriginAirtime &o : originAirtime) {
+        if (o.msec && o.from == from) {
+            slot = &o;
+            break;
+        }
+        if (o.msec < slot->msec)
+            slot = &o;
+    }
+    if (slot->from != from || !slot->msec) {
+        slot->from = from;
+        slot->msec = 0;
+    }
+    slot->msec += airtimeMsec;
+}
+
+uint16_t MeshPacketQueue::bucketFor(NodeNum from, PacketId id) const
+{
+    uint32_t h = (from * 0x9E3779B1u) ^ id;
+    h ^= h >> 16;
+    return h & (buckets.size() - 1);
+}
+
+void MeshPacketQueue::heapSwap(size_t i, size_t j)
+{
+    std::swap(heap[i], heap[j]);
+    entries[heap[i]].heapPos = i;
+    entries[heap[j]].heapPos = j;
+}
+
+void MeshPacketQueue::siftUp(size_t pos)
+{
+    while (pos > 0) {
+        size_t parent = (pos - 1) / 2;
+        if (!isBefore(heap[pos], heap[parent]))
+            break;
+        heapSwap(pos, parent);
+        pos = parent;
+    }
+}
+
+void MeshPacketQueue::siftDown(size_t pos)
+{
+    for (;;) {
+        size_t best = pos, left = 2 * pos + 1, right = left + 1;
+        if (left < heap.size() && isBefore(heap[left], heap[best]))
+            best = left;
+        if (right < heap.size() && isBefore(heap[right], heap[best]))
+            best = right;
+        if (best == pos)
+            break;
+        heapSwap(pos, best);
+        pos = best;
+    }
+}
+
+uint16_t MeshPacketQueue::findEntry(NodeNum from, PacketId id, bool tx_normal, bool tx_late)
+{
+    uint16_t found = NONE;
+    for (uint16_t e = buckets[bucketFor(from, id)]; e != NONE; e = entries[e].nextInBucket) {
+        const meshtastic_MeshPacket *p = entries[e].p;
+        if (getFrom(p) == from && p->id == id && ((tx_normal && !p->tx_after) || (tx_late && p->tx_after))) {
+            // Should the same packet be queued more than once, behave as if we looked front to back
+            if (found == NONE || isBefore(e, found))
+                found = e;
+        }
+    }
+    return found;
+}
+
+meshtastic_MeshPacket *MeshPacketQueue::removeEntry(uint16_t e)
+{
+    Entry &entry = entries[e];
+    meshtastic_MeshPacket *p = entry.p;
+
+    // Unlink from the index
+    uint16_t *link = &buckets[entry.bucket];
+    while (*link != e)
+        link = &entries[*link].nextInBucket;
+    *link = entry.nextInBucket;
+
+    // Unlink from the heap, the last entry takes our place and then moves to wherever it belongs
+    size_t pos = entry.heapPos;
+    size_t last = heap.size() - 1;
+    if (pos != last) {
+        heapSwap(pos, last);
+        heap.pop_back();
+        siftDown(pos);
+        siftUp(pos);
+    } else {
+        heap.pop_back();
+    }
+
+    entry.p = NULL;
+    freeEntries.push_back(e);
+    return p;
 }
 
 /**
@@ -65,20 +250,33 @@ void fixPriority(meshtastic_MeshPacket *p)
 }
 
 /** enqueue a packet, return false if full */
-bool MeshPacketQueue::enqueue(meshtastic_MeshPacket *p)
+bool MeshPacketQueue::enqueue(meshtastic_MeshPacket *p, uint32_t airtimeMsec)
 {
     // no space - try to replace a lower priority packet in the queue
-    if (queue.size() >= maxLen) {
-        bool replaced = replaceLowerPriorityPacket(p);
+    if (heap.size() >= maxLen) {
+        bool replaced = replaceLowerPriorityPacket(p, airtimeMsec);
         if (!replaced) {
             LOG_WARN("TX queue is full, and there is no lower-priority packet available to evict in favour of 0x%08x", p->id);
         }
         return replaced;
     }
 
-    // Find the correct position using upper_bound to maintain a stable order
-    auto it = std::upper_bound(queue.begin(), queue.end(), p, CompareMeshPacketFunc);
-    queue.insert(it, p); // Insert packet at the found position
+    uint16_t e = freeEntries.back();
+    freeEntries.pop_back();
+    Entry &entry = entries[e];
+    entry.p = p;
+    entry.seq = nextSeq++;
+    entry.airtimeMsec = airtimeMsec;
+
+    entry.bucket = bucketFor(getFrom(p), p->id);
+    entry.nextInBucket = buckets[entry.bucket];
+    buckets[entry.bucket] = e;
+
+    entry.heapPos = heap.size();
+    heap.push_back(e);
+    siftUp(entry.heapPos);
+    if (heap.size() > highWater)
+        highWater = heap.size();
     return true;
 }
 
@@ -88,9 +286,7 @@ meshtastic_MeshPacket *MeshPacketQueue::dequeue()
         return NULL;
     }
 
-    auto *p = queue.front();
-    queue.erase(queue.begin()); // Remove the highest-priority packet
-    return p;
+    return removeEntry(pickNext()); // Remove the highest-priority packet
 }
 
 meshtastic_MeshPacket *MeshPacketQueue::getFront()
@@ -99,77 +295,50 @@ meshtastic_MeshPacket *MeshPacketQueue::getFront()
         return NULL;
     }
 
-    auto *p = queue.front();
-    return p;
+    return entries[pickNext()].p;
 }
 
 /** Attempt to find and remove a packet from this queue.  Returns a pointer to the removed packet, or NULL if not found */
 meshtastic_MeshPacket *MeshPacketQueue::remove(NodeNum from, PacketId id, bool tx_normal, bool tx_late)
 {
-    for (auto it = queue.begin(); it != queue.end(); it++) {
-        auto p = (*it);
-        if (getFrom(p) == from && p->id == id && ((tx_normal && !p->tx_after) || (tx_late && p->tx_after))) {
-            queue.erase(it);
-            return p;
-        }
-    }
-
-    return NULL;
+    uint16_t e = findEntry(from, id, tx_normal, tx_late);
+    return e != NONE ? removeEntry(e) : NULL;
 }
 
 /* Attempt to find a packet from this queue. Return true if it was found. */
 bool MeshPacketQueue::find(const NodeNum from, const PacketId id)
 {
-    for (auto it = queue.begin(); it != queue.end(); it++) {
-        const auto *p = *it;
-        if (getFrom(p) == from && p->id == id) {
-            return true;
-        }
-    }
-
-    return false;
+    return findEntry(from, id) != NONE;
 }
 
 /**
  * Attempt to find a lower-priority packet in the queue and replace it with the provided one.
  * @return True if the replacement succeeded, false otherwise
  */
-bool MeshPacketQueue::replaceLowerPriorityPacket(meshtastic_MeshPacket *p)
+bool MeshPacketQueue::replaceLowerPriorityPacket(meshtastic_MeshPacket *p, uint32_t airtimeMsec)
 {
 
-    if (queue.empty()) {
+    if (empty()) {
         return false; // No packets to replace
     }
 
-    // Check if the packet at the back has a lower priority than the new packet
-    auto *backPacket = queue.back();
-    if (!backPacket->tx_after && backPacket->priority < p->priority) {
-        LOG_WARN("Dropping packet 0x%08x to make room in the TX queue for higher-priority packet 0x%08x", backPacket->id, p->id);
-        // Remove the back packet
-        queue.pop_back();
-        packetPool.release(backPacket);
-        // Insert the new packet in the correct order
-        enqueue(p);
-        return true;
+    // Late (rebroadcast window) packets are never evicted. Of the others, find the one that would be sent last.
+    // The heap doesn't keep that one in a known place, but this only runs when the queue is full.
+    uint16_t worst = NONE;
+    for (uint16_t e : heap) {
+        if (!entries[e].p->tx_after && (worst == NONE || isBefore(worst, e)))
+            worst = e;
     }
 
-    if (backPacket->tx_after) {
-        // Check if there's a non-late packet with lower priority
-        auto it = queue.end();
-        auto refPacket = *--it;
-        for (; refPacket->tx_after && it != queue.begin(); refPacket = *--it)
-            ;
-        if (!refPacket->tx_after && refPacket->priority < p->priority) {
-            LOG_WARN("Dropping non-late packet 0x%08x to make room in the TX queue for higher-priority packet 0x%08x",
-                     refPacket->id, p->id);
-            queue.erase(it);
-            packetPool.release(refPacket);
-            // Insert the new packet in the correct order
-            enqueue(p);
-            return true;
-        }
+    if (worst != NONE && entries[worst].p->priority < p->priority) {
+        meshtastic_MeshPacket *victim = removeEntry(worst);
+        LOG_WARN("Dropping packet 0x%08x to make room in the TX queue for higher-priority packet 0x%08x", victim->id, p->id);
+        packetPool.release(victim);
+        // Insert the new packet in the correct order
+        enqueue(p, airtimeMsec);
+        return true;
     }
 
-    // If the back packet's priority is not lower, no replacement occurs
+    // If no packet has a lower priority, no replacement occurs
     return false;
-}
\ No newline at end of file
+}
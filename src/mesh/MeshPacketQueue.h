@@ -2,42 +2,109 @@
 
 #include "MeshTypes.h"
 
-#include <queue>
+#include <vector>
 
 /**
  * A priority queue of packets
+ *
+ * Implemented as a binary heap over a fixed pool of entries, plus a hash index by (from, id), so enqueue/dequeue are
+ * O(log n) and finding or cancelling a packet doesn't need to walk the whole queue.
+ *
+ * Among packets of equal priority the queue is fair rather than strictly FIFO: whichever origin has recently used the
+ * least airtime (including what this packet would cost) goes first, so one chatty node can't starve everyone else it
+ * shares a relay with. Packets in the late rebroadcast window go by earliest deadline instead.
  */
 class MeshPacketQueue
 {
+    enum : uint16_t { NONE = 0xFFFF };
+
+    /// How many origins we keep airtime usage for, and how often that usage is halved
+    enum : uint32_t { FAIRNESS_ORIGINS = 8, FAIRNESS_HALFLIFE_MSEC = 60 * 1000 };
+
+    struct Entry {
+        meshtastic_MeshPacket *p;
+        uint32_t seq;          // Enqueue order, breaks ties between otherwise equal packets
+        uint32_t airtimeMsec;  // Expected time on air, as estimated by the radio when enqueued
+        uint16_t heapPos;      // Where this entry currently sits in heap
+        uint16_t bucket;       // Index bucket it was filed under when enqueued
+        uint16_t nextInBucket; // Next entry in the same hash bucket, or NONE
+    };
+
     size_t maxLen;
-    std::vector<meshtastic_MeshPacket *> queue;
+    std::vector<Entry> entries;        // Fixed pool of maxLen entries
+    std::vector<uint16_t> freeEntries; // Unused entry indexes
+    std::vector<uint16_t> heap;        // Binary heap of entry indexes, the packet to send next is heap[0]
+    std::vector<uint16_t> buckets;     // Hash of (from, id) -> first entry in that bucket, or NONE
+    uint32_t nextSeq = 0;
+    size_t highWater = 0; // Most packets there have been at once
+
+    struct OriginAirtime {
+        NodeNum from;
+        uint32_t msec;
+    };
+    OriginAirtime originAirtime[FAIRNESS_ORIGINS] = {};
+    uint32_t lastHalvingMsec = 0;
+
+    /// @return decayed airtime recently sent on behalf of 'from'
+    uint32_t getOriginAirtime(NodeNum from) const;
+
+    /// Walk the part of the heap that ties with its front, and return the entry that should actually go next.
+    uint16_t pickNext() const;
+    void pickFrom(size_t pos, uint16_t &best) const;
+
+    /// @return true if entry a should go before entry b, given that neither outranks the other by priority
+    bool isFairerThan(uint16_t a, uint16_t b) const;
 
     /** Replace a lower priority package in the queue with 'mp' (provided there are lower pri packages). Return true if replaced.
      */
-    bool replaceLowerPriorityPacket(meshtastic_MeshPacket *mp);
+    bool replaceLowerPriorityPacket(meshtastic_MeshPacket *mp, uint32_t airtimeMsec);
+
+    /// @return true if entry a should be sent before entry b
+    bool isBefore(uint16_t a, uint16_t b) const;
+
+    uint16_t bucketFor(NodeNum from, PacketId id) const;
+
+    /// Find the best placed entry for (from, id) that passes the tx_normal/tx_late filter, or NONE
+    uint16_t findEntry(NodeNum from, PacketId id, bool tx_normal = true, bool tx_late = true);
+
+    /// Take an entry out of both the heap and the index, and return it to the pool.  Returns the packet it held.
+    meshtastic_MeshPacket *removeEntry(uint16_t e);
+
+    void heapSwap(size_t i, size_t j);
+    void siftUp(size_t pos);
+    void siftDown(size_t pos);
 
   public:
     explicit MeshPacketQueue(size_t _maxLen);
 
-    /** enqueue a packet, return false if full */
-    bool enqueue(meshtastic_MeshPacket *p);
+    /** enqueue a packet, return false if full.  airtimeMsec is what it is expected to cost to send, for fairness */
+    bool enqueue(meshtastic_MeshPacket *p, uint32_t airtimeMsec = 0);
 
     /** return true if the queue is empty */
     bool empty();
 
     /** return amount of free packets in Queue */
-    size_t getFree() { return maxLen - queue.size(); }
+    size_t getFree() { return maxLen - heap.size(); }
 
     /** return total size of the Queue */
     size_t getMaxLen() { return maxLen; }
 
+    /** return the most packets there have been in the Queue at once */
+    size_t getHighWater() { return highWater; }
+
     meshtastic_MeshPacket *dequeue();
 
     meshtastic_MeshPacket *getFront();
 
+    /** return the i-th queued packet, roughly in sending order, or NULL past the end.  It stays queued */
+    meshtastic_MeshPacket *peek(size_t i) { return i < heap.size() ? entries[heap[i]].p : NULL; }
+
     /** Attempt to find and remove a packet from this queue.  Returns the packet which was removed from the queue */
     meshtastic_MeshPacket *remove(NodeNum from, PacketId id, bool tx_normal = true, bool tx_late = true);
 
     /* Attempt to find a packet from this queue. Return true if it was found. */
     bool find(const NodeNum from, const PacketId id);
-};
\ No newline at end of file
+
+    /** Charge airtime that was just spent transmitting on behalf of 'from' against its fair share */
+    void noteAirtime(NodeNum from, uint32_t airtimeMsec);
+};
@@ -17,7 +17,11 @@
 #include "modules/NodeInfoModule.h"
 #include "modules/PositionModule.h"
 #include "modules/RoutingModule.h"
+#if !MESHTASTIC_EXCLUDE_TRACEROUTE
+#include "modules/TraceRouteModule.h"
+#endif
 #include "power.h"
+#include <algorithm>
 #include <assert.h>
 #include <string>
 
@@ -102,10 +106,12 @@ int MeshService::handleFromRadio(const meshtastic_MeshPacket *mp)
         } else {
             LOG_DEBUG("Skip sending NodeInfo > 25%% ch. util");
         }
+    } else if (nodeInfoModule && !isPreferredRebroadcaster) {
+        nodeInfoModule->checkUserHash(*mp);
     }
 
     printPacket("Forwarding to phone", mp);
-    sendToPhone(packetPool.allocCopy(*mp));
+    sendToPhone(packetPool.share(mp)); // The router is done modifying mp, so the phone can hold on to the same buffer
 
     return 0;
 }
@@ -118,6 +124,9 @@ void MeshService::loop()
         if (qs.free != lastQueueStatus.free)
             (void)sendQueueStatusToPhone(qs, 0, 0);
     }
+    reportPhoneDrops(toPhoneQueue, toPhoneDropped);
+    for (auto &c : clientQueues)
+        reportPhoneDrops(*c.q, c.dropped);
     if (oldFromNum != fromNum) { // We don't want to generate extra notifies for multiple new packets
         int result = fromNumChanged.notifyObservers(fromNum);
         if (result == 0) // If any observer returns non-zero, we will try again
@@ -128,13 +137,13 @@ void MeshService::loop()
 /// The radioConfig object just changed, call this to force the hw to change to the new settings
 void MeshService::reloadConfig(int saveWhat)
 {
-    // If we can successfully set this radio to these settings, save them to disk
+    // If we can successfully set this radio to these settings, save them to disk (once the client is done editing)
 
     // This will also update the region as needed
     nodeDB->resetRadioConfig(); // Don't let the phone send us fatally bad settings
 
     configChanged.notifyObservers(NULL); // This will cause radio hardware to change freqs etc
-    nodeDB->saveToDisk(saveWhat);
+    nodeDB->saveToDiskSoon(saveWhat);
 }
 
 /// The owner User record just got updated, update our node DB and broadcast the info into the mesh
@@ -150,6 +159,29 @@ void MeshService::reloadOwner(bool shouldSave)
     }
 }
 
+void MeshService::addClientQueue(PointerQueue<meshtastic_MeshPacket> *q)
+{
+    // Start the client off with the backlog, leaving the packets in toPhoneQueue for everyone else
+    for (int i = 0; i < toPhoneQueue.numUsed(); i++) {
+        meshtastic_MeshPacket *p = toPhoneQueue.dequeuePtr(0);
+        meshtastic_MeshPacket *shared = packetPool.share(p);
+        if (shared && !q->enqueue(shared, 0))
+            releaseToPool(shared);
+        toPhoneQueue.enqueue(p, 0);
+    }
+    clientQueues.push_back({q, 0});
+}
+
+void MeshService::removeClientQueue(PointerQueue<meshtastic_MeshPacket> *q)
+{
+    clientQueues.erase(std::remove_if(clientQueues.begin(), clientQueues.end(),
+                                      [q](const ClientQueue &c) { return c.q == q; }),
+                       clientQueues.end());
+    meshtastic_MeshPacket *p;
+    while ((p = q->dequeuePtr(0)) != NULL)
+        releaseToPool(p);
+}
+
 // search the queue for a request id and return the matching nodenum
 NodeNum MeshService::getNodenumFromRequestId(uint32_t request_id)
 {
@@ -190,6 +222,11 @@ void MeshService::handleToRadio(meshtastic_MeshPacket &p)
     p.rx_time = getValidTime(RTCQualityFromNet); // Record the time the packet arrived from the phone
                                                  // (so we update our nodedb for the local node)
 
+#if !MESHTASTIC_EXCLUDE_TRACEROUTE
+    if (traceRouteModule && traceRouteModule->replyFromCache(p))
+        return; // Traced through us moments ago, no need to spend the airtime again
+#endif
+
     // Send the packet into the mesh
 
     sendToMesh(packetPool.allocCopy(p), RX_SRC_USER);
@@ -280,8 +317,107 @@ bool MeshService::trySendPosition(NodeNum dest, bool wantReplies)
     return false;
 }
 
+enum PhoneKeepPriority : uint8_t { PHONE_KEEP_ROUTINE, PHONE_KEEP_NORMAL, PHONE_KEEP_MOST };
+
+/// How much a client wants a packet it hasn't read yet, the least wanted go first when its queue has to drop some
+static uint8_t phoneKeepPriority(const meshtastic_MeshPacket *p)
+{
+    if (p->which_payload_variant != meshtastic_MeshPacket_decoded_tag)
+        return PHONE_KEEP_NORMAL;
+    if (MeshService::isTextPayload(p))
+        return PHONE_KEEP_MOST;
+    switch (p->decoded.portnum) {
+    case meshtastic_PortNum_ADMIN_APP:
+    case meshtastic_PortNum_ROUTING_APP:
+    case meshtastic_PortNum_WAYPOINT_APP:
+    case meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP:
+        return PHONE_KEEP_MOST;
+    case meshtastic_PortNum_TELEMETRY_APP:
+    case meshtastic_PortNum_POSITION_APP:
+    case meshtastic_PortNum_NODEINFO_APP:
+    case meshtastic_PortNum_NEIGHBORINFO_APP:
+    case meshtastic_PortNum_MAP_REPORT_APP:
+        return PHONE_KEEP_ROUTINE; // Sent periodically, a newer one will be along
+    default:
+        return PHONE_KEEP_NORMAL;
+    }
+}
+
+static bool isPacketPoolLow()
+{
+    AllocatorStats stats;
+    return packetPool.getStats(stats) && stats.inUse * 100 > stats.capacity * TOPHONE_POOL_HIGH_WATER;
+}
+
+bool MeshService::makeRoomForPhone(PointerQueue<meshtastic_MeshPacket> &q, const meshtastic_MeshPacket *p, bool poolLow,
+                                   uint32_t &dropped)
+{
+    bool full = q.numFree() == 0;
+    if (!full && !poolLow)
+        return true;
+
+    uint8_t limit = phoneKeepPriority(p);
+    if (!full)
+        limit = PHONE_KEEP_ROUTINE;
+
+    // Find the oldest of the least wanted packets, one full turn of the queue leaves it in the order it was
+    int n = q.numUsed();
+    int victim = -1;
+    uint8_t victimPriority = limit + 1;
+    for (int i = 0; i < n; i++) {
+        meshtastic_MeshPacket *d = q.dequeuePtr(0);
+        if (!d)
+            break;
+        uint8_t priority = phoneKeepPriority(d);
+        if (priority < victimPriority) {
+            victim = i;
+            victimPriority = priority;
+        }
+        q.enqueue(d, 0);
+    }
+
+    if (victim < 0) {
+        if (!full)
+            return true;
+        LOG_WARN("Phone queue is full, drop packet (id=0x%08x)", p->id);
+        dropped++;
+        return false;
+    }
+
+    for (int i = 0; i < n; i++) {
+        meshtastic_MeshPacket *d = q.dequeuePtr(0);
+        if (!d)
+            break;
+        if (i == victim) {
+            LOG_WARN("Phone queue is %s, discard older packet (id=0x%08x)", full ? "full" : "holding scarce buffers", d->id);
+            releaseToPool(d);
+            dropped++;
+        } else {
+            q.enqueue(d, 0);
+        }
+    }
+    return true;
+}
+
+void MeshService::reportPhoneDrops(PointerQueue<meshtastic_MeshPacket> &q, uint32_t &dropped)
+{
+    if (!dropped || q.numUsed() > TOPHONE_LOW_WATER)
+        return;
+
+    // Notifications aren't addressed, so with several clients connected whichever reads next is the one told
+    meshtastic_ClientNotification *cn = clientNotificationPool.allocZeroed();
+    cn->level = meshtastic_LogRecord_Level_WARNING;
+    cn->time = getValidTime(RTCQualityFromNet);
+    snprintf(cn->message, sizeof(cn->message), "%u packets were dropped while the client was behind", dropped);
+    LOG_WARN("%s", cn->message);
+    sendClientNotification(cn);
+    dropped = 0;
+}
+
 void MeshService::sendToPhone(meshtastic_MeshPacket *p)
 {
+    if (p->which_payload_variant == meshtastic_MeshPacket_encrypted_tag)
+        p = packetPool.makeWritable(p); // Decoding rewrites the payload, don't do that under other holders of a shared packet
     perhapsDecode(p);
 
 #ifdef ARCH_ESP32
@@ -295,19 +431,19 @@ void MeshService::sendToPhone(meshtastic_MeshPacket *p)
 #endif
 #endif
 
-    if (toPhoneQueue.numFree() == 0) {
-        if (p->decoded.portnum == meshtastic_PortNum_TEXT_MESSAGE_APP ||
-            p->decoded.portnum == meshtastic_PortNum_RANGE_TEST_APP) {
-            LOG_WARN("ToPhone queue is full, discard oldest");
-            meshtastic_MeshPacket *d = toPhoneQueue.dequeuePtr(0);
-            if (d)
-                releaseToPool(d);
-        } else {
-            LOG_WARN("ToPhone queue is full, drop packet");
-            releaseToPool(p);
-            fromNum++; // Make sure to notify observers in case they are reconnected so they can get the packets
-            return;
-        }
+    bool poolLow = isPacketPoolLow();
+    for (auto &c : clientQueues) {
+        if (!makeRoomForPhone(*c.q, p, poolLow, c.dropped))
+            continue;
+        meshtastic_MeshPacket *shared = packetPool.share(p);
+        if (shared && !c.q->enqueue(shared, 0))
+            releaseToPool(shared);
+    }
+
+    if (!makeRoomForPhone(toPhoneQueue, p, poolLow, toPhoneDropped)) {
+        releaseToPool(p);
+        fromNum++; // Make sure to notify observers in case they are reconnected so they can get the packets
+        return;
     }
 
     if (toPhoneQueue.enqueue(p, 0) == false) {
@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include <assert.h>
 #include <string>
+#include <vector>
 
 #include "GPSStatus.h"
 #include "MemoryPool.h"
@@ -19,6 +20,13 @@
 #endif
 #endif
 
+#ifndef TOPHONE_POOL_HIGH_WATER
+#define TOPHONE_POOL_HIGH_WATER 85 // Percent of the packet pool in use beyond which clients' queues shed routine packets
+#endif
+#ifndef TOPHONE_LOW_WATER
+#define TOPHONE_LOW_WATER (MAX_RX_TOPHONE / 4) // Once a queue that dropped packets drains to this, the client is told
+#endif
+
 extern Allocator<meshtastic_QueueStatus> &queueStatusPool;
 extern Allocator<meshtastic_MqttClientProxyMessage> &mqttClientProxyMessagePool;
 extern Allocator<meshtastic_ClientNotification> &clientNotificationPool;
@@ -57,6 +65,18 @@ class MeshService
     /// Updated in loop() to detect when fromNum changes
     uint32_t oldFromNum = 0;
 
+    /// Packets toPhoneQueue dropped since we last told the client
+    uint32_t toPhoneDropped = 0;
+
+    /// A client with a queue of its own, and how many packets it dropped since we last told it
+    struct ClientQueue {
+        PointerQueue<meshtastic_MeshPacket> *q;
+        uint32_t dropped;
+    };
+
+    /// Clients with a queue of their own, they get a share of every packet toPhoneQueue gets
+    std::vector<ClientQueue> clientQueues;
+
   public:
     static bool isTextPayload(const meshtastic_MeshPacket *p)
     {
@@ -84,6 +104,18 @@ class MeshService
     /// last few packets if needs to.
     meshtastic_MeshPacket *getForPhone() { return toPhoneQueue.dequeuePtr(0); }
 
+    /// The most packets there have been waiting for the phone at once
+    int getToPhoneHighWater() { return toPhoneQueue.getHighWater(); }
+
+    /**
+     * Have every packet for the phone also shared (not copied) into q, starting with what is already waiting for the phone.
+     * For clients that can be connected side by side, so they don't take packets away from each other.
+     */
+    void addClientQueue(PointerQueue<meshtastic_MeshPacket> *q);
+
+    /// Stop feeding q and release whatever it still holds
+    void removeClientQueue(PointerQueue<meshtastic_MeshPacket> *q);
+
     /// Allows the bluetooth handler to free packets after they have been sent
     void releaseToPool(meshtastic_MeshPacket *p) { packetPool.release(p); }
 
@@ -163,6 +195,18 @@ class MeshService
     /// returns 0 to allow further processing
     int onGPSChanged(const meshtastic::GPSStatus *arg);
 #endif
+    /**
+     * Make room for p in a queue for the phone, if it is full or the packet pool is running low, by dropping the oldest of
+     * its least wanted packets (see phoneKeepPriority).  While the pool is low only routine packets are shed, so a slow
+     * client can't grow its hold on buffers the radio needs.
+     * @return false if p is the least wanted and should be dropped itself
+     */
+    bool makeRoomForPhone(PointerQueue<meshtastic_MeshPacket> &q, const meshtastic_MeshPacket *p, bool poolLow,
+                          uint32_t &dropped);
+
+    /// Tell the client how many packets q dropped, once it has caught up again
+    void reportPhoneDrops(PointerQueue<meshtastic_MeshPacket> &q, uint32_t &dropped);
+
     /// Handle a packet that just arrived from the radio.  This method does _not_ free the provided packet.  If it
     /// needs to keep the packet around it makes a copy
     int handleFromRadio(const meshtastic_MeshPacket *p);
@@ -1,6 +1,99 @@
 #include "NextHopRouter.h"
+#include "FSCommon.h"
+#include "LinkQuality.h"
+#include "RTC.h"
+#include "SPILock.h"
+#include "SafeFile.h"
+#include "sleep.h"
 
-NextHopRouter::NextHopRouter() {}
+#include <algorithm>
+
+#define ROUTING_SNAPSHOT_MAGIC 0x52534e50  // "RSNP"
+#define ROUTING_SNAPSHOT_VERSION (0x0100 | sizeof(RouteCacheEntry)) // Bump the top byte when the layout changes
+
+NextHopRouter::NextHopRouter()
+{
+    rebootObserver.observe(&notifyReboot);
+    deepSleepObserver.observe(&notifyDeepSleep);
+    loadRoutingSnapshot();
+}
+
+void NextHopRouter::saveRoutingSnapshot()
+{
+    lastRoutingSnapshot = millis();
+#ifdef FSCom
+    spiLock->lock();
+    FSCom.mkdir("/prefs");
+    spiLock->unlock();
+    SafeFile f(ROUTING_SNAPSHOT_FILE, true);
+
+    uint32_t header[3] = {ROUTING_SNAPSHOT_MAGIC, ROUTING_SNAPSHOT_VERSION, getValidTime(RTCQualityDevice)};
+    f.write((const uint8_t *)header, sizeof(header));
+    uint32_t numPackets = saveSnapshot(f, ROUTING_SNAPSHOT_MAX_AGE_MSEC);
+
+    uint32_t numRoutes = 0;
+    for (const RouteCacheEntry &route : routeCache)
+        if (route.dest)
+            numRoutes++;
+    f.write((const uint8_t *)&numRoutes, sizeof(numRoutes));
+    for (const RouteCacheEntry &route : routeCache)
+        if (route.dest)
+            f.write((const uint8_t *)&route, sizeof(route));
+
+    if (f.close())
+        LOG_DEBUG("Saved routing snapshot: %u packets, %u routes", numPackets, numRoutes);
+    else
+        LOG_ERROR("Can't write routing snapshot");
+#endif
+}
+
+void NextHopRouter::loadRoutingSnapshot()
+{
+#ifdef FSCom
+    concurrency::LockGuard g(spiLock);
+    if (!FSCom.exists(ROUTING_SNAPSHOT_FILE))
+        return;
+    auto f = FSCom.open(ROUTING_SNAPSHOT_FILE, FILE_O_READ);
+    if (!f)
+        return;
+
+    uint32_t header[3];
+    if (f.read((uint8_t *)header, sizeof(header)) != sizeof(header) || header[0] != ROUTING_SNAPSHOT_MAGIC ||
+        header[1] != ROUTING_SNAPSHOT_VERSION) {
+        LOG_WARN("Ignore routing snapshot from another firmware");
+        f.close();
+        return;
+    }
+
+    // If the clock can tell us how long we were down, age everything by that as well
+    uint32_t now = getValidTime(RTCQualityDevice);
+    uint32_t downMsec = 0;
+    if (header[2] && now > header[2])
+        downMsec = (now - header[2]) < ROUTING_SNAPSHOT_MAX_AGE_MSEC / 1000 ? (now - header[2]) * 1000
+                                                                             : ROUTING_SNAPSHOT_MAX_AGE_MSEC;
+    int32_t numPackets = restoreSnapshot(f, downMsec, ROUTING_SNAPSHOT_MAX_AGE_MSEC);
+
+    uint32_t numRoutes = 0, restoredRoutes = 0;
+    if (numPackets >= 0 && f.read((uint8_t *)&numRoutes, sizeof(numRoutes)) == sizeof(numRoutes)) {
+        for (uint32_t i = 0; i < numRoutes && restoredRoutes < NEXTHOP_ROUTE_CACHE_SIZE; i++) {
+            RouteCacheEntry route;
+            if (f.read((uint8_t *)&route, sizeof(route)) != sizeof(route) || !route.dest)
+                break;
+            route.lastUpdate = millis();
+            routeCache[restoredRoutes] = route;
+            sortRoute(routeCache[restoredRoutes++]);
+        }
+    }
+    f.close();
+    LOG_INFO("Restored routing snapshot: %d packets, %u routes", numPackets, restoredRoutes);
+#endif
+}
+
+/// Heap order for retransmissionTimers: true if a is due after b.  Compares the difference so millis() rollover is safe.
+static bool isTimerLater(const RetransmissionTimer &a, const RetransmissionTimer &b)
+{
+    return (int32_t)(a.nextTxMsec - b.nextTxMsec) > 0;
+}
 
 PendingPacket::PendingPacket(meshtastic_MeshPacket *p, uint8_t numRetransmissions)
 {
@@ -20,6 +113,11 @@ ErrorCode NextHopRouter::send(meshtastic_MeshPacket *p)
     p->next_hop = getNextHop(p->to, p->relay_node); // set the next hop
     LOG_DEBUG("Setting next hop for packet with dest %x to %x", p->to, p->next_hop);
 
+    // Remember which hop this attempt went to, so a retransmission knows which one let us down
+    PendingPacket *pend = findPendingPacket(getFrom(p), p->id);
+    if (pend && pend->packet != p)
+        pend->packet->next_hop = p->next_hop;
+
     // If it's from us, ReliableRouter already handles retransmissions if want_ack is set. If a next hop is set and hop limit is
     // not 0 or want_ack is set, start retransmissions
     if ((!isFromUs(p) || !p->want_ack) && p->next_hop != NO_NEXT_HOP_PREFERENCE && (p->hop_limit > 0 || p->want_ack))
@@ -75,10 +173,8 @@ void NextHopRouter::sniffReceived(const meshtastic_MeshPacket *p, const meshtast
                 // the destination
                 if (wasRelayer(p->relay_node, p->decoded.request_id, p->to) ||
                     (wasRelayer(ourRelayID, p->decoded.request_id, p->to) && p->hop_start != 0 && p->hop_start == p->hop_limit)) {
-                    if (origTx->next_hop != p->relay_node) { // Not already set
-                        LOG_INFO("Update next hop of 0x%x to 0x%x based on ACK/reply", p->from, p->relay_node);
-                        origTx->next_hop = p->relay_node;
-                    }
+                    LOG_DEBUG("ACK/reply confirms 0x%x as a next hop for 0x%x", p->relay_node, p->from);
+                    noteRouteSuccess(p->from, p->relay_node);
                 }
             }
         }
@@ -86,6 +182,7 @@ void NextHopRouter::sniffReceived(const meshtastic_MeshPacket *p, const meshtast
             Router::cancelSending(p->to, p->decoded.request_id); // cancel rebroadcast for this DM
             // stop retransmission for the original packet
             stopRetransmission(p->to, p->decoded.request_id); // for original packet, from = to and id = request_id
+            stopRetransmissionsAckedBy(p, c, true);
         }
     }
 
@@ -127,7 +224,11 @@ uint8_t NextHopRouter::getNextHop(NodeNum to, uint8_t relay_node)
     if (isBroadcast(to))
         return NO_NEXT_HOP_PREFERENCE;
 
-    meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(to);
+    uint8_t cached = getBestCachedHop(to, relay_node);
+    if (cached != NO_NEXT_HOP_PREFERENCE)
+        return cached;
+
+    const NodeHot *node = nodeDB->getHotNode(to);
     if (node && node->next_hop) {
         // We are careful not to return the relay node as the next hop
         if (node->next_hop != relay_node) {
@@ -139,6 +240,138 @@ uint8_t NextHopRouter::getNextHop(NodeNum to, uint8_t relay_node)
     return NO_NEXT_HOP_PREFERENCE;
 }
 
+// Starting quality of a hop, either confirmed by an ACK or only seen in a traceroute, and the quality below which we forget it
+#define ROUTE_QUALITY_ACKED 192
+#define ROUTE_QUALITY_TRACED 160
+#define ROUTE_QUALITY_MIN 32
+
+// A traced hop starts at ROUTE_QUALITY_TRACED if every link on the path is heard at least ROUTE_TRACED_GOOD_SNR, down to
+// ROUTE_QUALITY_TRACED_WEAK at ROUTE_TRACED_WEAK_SNR or worse (in dB)
+#define ROUTE_TRACED_GOOD_SNR 0
+#define ROUTE_TRACED_WEAK_SNR -15
+#define ROUTE_QUALITY_TRACED_WEAK 64
+
+void NextHopRouter::learnRouteFromTraceroute(NodeNum dest, NodeNum firstHop, int8_t worstSnr)
+{
+    if (dest == getNodeNum() || firstHop == getNodeNum())
+        return;
+
+    uint8_t quality = ROUTE_QUALITY_TRACED;
+    if (worstSnr != INT8_MIN && worstSnr < ROUTE_TRACED_GOOD_SNR * 4) {
+        int16_t margin = worstSnr - ROUTE_TRACED_WEAK_SNR * 4;
+        const int16_t range = (ROUTE_TRACED_GOOD_SNR - ROUTE_TRACED_WEAK_SNR) * 4;
+        quality = margin <= 0 ? ROUTE_QUALITY_TRACED_WEAK
+                              : ROUTE_QUALITY_TRACED_WEAK + (ROUTE_QUALITY_TRACED - ROUTE_QUALITY_TRACED_WEAK) * margin / range;
+    }
+    noteRouteSuccess(dest, nodeDB->getLastByteOfNodeNum(firstHop), quality);
+}
+
+RouteCacheEntry *NextHopRouter::findRoute(NodeNum dest, bool create)
+{
+    if (!dest)
+        return NULL; // 0 marks unused entries
+
+    uint32_t now = millis();
+    RouteCacheEntry *oldest = NULL;
+    for (RouteCacheEntry &route : routeCache) {
+        if (route.dest == dest)
+            return &route;
+        if (!oldest || (oldest->dest && (!route.dest || now - route.lastUpdate > now - oldest->lastUpdate)))
+            oldest = &route;
+    }
+    if (!create)
+        return NULL;
+
+    memset(oldest, 0, sizeof(*oldest));
+    oldest->dest = dest;
+    return oldest;
+}
+
+/// Should candidate a go before b? Equally good hops are ranked by how well we hear them
+static bool isBetterCandidate(const RouteCandidate &a, const RouteCandidate &b)
+{
+    if (a.quality != b.quality || !a.quality)
+        return a.quality > b.quality;
+    float snrA, snrB;
+    bool heardA = linkQuality.getRelaySnr(a.relay, snrA), heardB = linkQuality.getRelaySnr(b.relay, snrB);
+    return heardA && (!heardB || snrA > snrB);
+}
+
+void NextHopRouter::sortRoute(RouteCacheEntry &route)
+{
+    RouteCandidate *c = route.candidates;
+    for (int i = 1; i < NEXTHOP_ROUTE_CANDIDATES; i++)
+        for (int j = i; j > 0 && isBetterCandidate(c[j], c[j - 1]); j--)
+            std::swap(c[j], c[j - 1]);
+
+    meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(route.dest);
+    uint8_t best = c[0].quality ? c[0].relay : NO_NEXT_HOP_PREFERENCE;
+    if (node && node->next_hop != best) {
+        LOG_INFO("Update next hop of 0x%x to 0x%x (ETX %.1f)", route.dest, best, best ? 255.0f / c[0].quality : 0.0f);
+        node->next_hop = best;
+        nodeDB->syncHotNode(node);
+    }
+}
+
+void NextHopRouter::noteRouteSuccess(NodeNum dest, uint8_t relay, uint8_t tracedQuality)
+{
+    if (relay == NO_NEXT_HOP_PREFERENCE || !dest || isBroadcast(dest))
+        return;
+
+    RouteCacheEntry *route = findRoute(dest, true);
+    route->lastUpdate = millis();
+
+    RouteCandidate *c = route->candidates;
+    int i = 0;
+    while (i < NEXTHOP_ROUTE_CANDIDATES && !(c[i].quality && c[i].relay == relay))
+        i++;
+
+    if (i < NEXTHOP_ROUTE_CANDIDATES) {
+        // Already a candidate, move its delivery ratio towards 1.  A traceroute is weaker evidence than an ACK.
+        c[i].quality += (255 - c[i].quality) / (tracedQuality ? 8 : 4);
+    } else {
+        // New candidate, it takes the place of the worst one if it is likely to be better
+        uint8_t quality = tracedQuality ? tracedQuality : ROUTE_QUALITY_ACKED;
+        RouteCandidate &worst = c[NEXTHOP_ROUTE_CANDIDATES - 1];
+        if (worst.quality >= quality)
+            return;
+        worst.relay = relay;
+        worst.quality = quality;
+    }
+    sortRoute(*route);
+}
+
+void NextHopRouter::noteRouteFailure(NodeNum dest, uint8_t relay)
+{
+    RouteCacheEntry *route = findRoute(dest, false);
+    if (!route || relay == NO_NEXT_HOP_PREFERENCE)
+        return;
+
+    for (RouteCandidate &c : route->candidates) {
+        if (c.quality && c.relay == relay) {
+            c.quality /= 2;
+            if (c.quality < ROUTE_QUALITY_MIN)
+                c.quality = 0;
+            sortRoute(*route);
+            return;
+        }
+    }
+}
+
+uint8_t NextHopRouter::getBestCachedHop(NodeNum dest, uint8_t exclude1, uint8_t exclude2)
+{
+    RouteCacheEntry *route = findRoute(dest, false);
+    if (!route)
+        return NO_NEXT_HOP_PREFERENCE;
+
+    // Candidates are kept best first
+    for (const RouteCandidate &c : route->candidates) {
+        if (c.quality && c.relay != exclude1 && c.relay != exclude2)
+            return c.relay;
+    }
+    return NO_NEXT_HOP_PREFERENCE;
+}
+
 PendingPacket *NextHopRouter::findPendingPacket(GlobalPacketId key)
 {
     auto old = pending.find(key); // If we have an old record, someone messed up because id got reused
@@ -182,6 +415,23 @@ bool NextHopRouter::stopRetransmission(GlobalPacketId key)
         return false;
 }
 
+bool NextHopRouter::isMultiAck(const meshtastic_MeshPacket *p, const meshtastic_Routing *c)
+{
+    return c && c->which_variant == meshtastic_Routing_route_reply_tag &&
+           p->which_payload_variant == meshtastic_MeshPacket_decoded_tag && p->decoded.portnum == meshtastic_PortNum_ROUTING_APP && p->decoded.request_id != 0;
+}
+
+void NextHopRouter::stopRetransmissionsAckedBy(const meshtastic_MeshPacket *p, const meshtastic_Routing *c, bool cancelRelay)
+{
+    if (!isMultiAck(p, c))
+        return;
+    for (pb_size_t i = 0; i < c->route_reply.route_count; i++) {
+        if (cancelRelay)
+            Router::cancelSending(p->to, c->route_reply.route[i]);
+        stopRetransmission(p->to, c->route_reply.route[i]);
+    }
+}
+
 /**
  * Add p to the list of packets to retransmit occasionally.  We will free it once we stop retransmitting.
  */
@@ -204,66 +454,92 @@ PendingPacket *NextHopRouter::startRetransmission(meshtastic_MeshPacket *p, uint
 int32_t NextHopRouter::doRetransmissions()
 {
     uint32_t now = millis();
-    int32_t d = INT32_MAX;
-
-    // FIXME, we should use a better datastructure rather than walking through this map.
-    // for(auto el: pending) {
-    for (auto it = pending.begin(), nextIt = it; it != pending.end(); it = nextIt) {
-        ++nextIt; // we use this odd pattern because we might be deleting it...
-        auto &p = it->second;
-
-        bool stillValid = true; // assume we'll keep this record around
-
-        // FIXME, handle 51 day rolloever here!!!
-        if (p.nextTxMsec <= now) {
-            if (p.numRetransmissions == 0) {
-                if (isFromUs(p.packet)) {
-                    LOG_DEBUG("Reliable send failed, returning a nak for fr=0x%x,to=0x%x,id=0x%x", p.packet->from, p.packet->to,
-                              p.packet->id);
-                    sendAckNak(meshtastic_Routing_Error_MAX_RETRANSMIT, getFrom(p.packet), p.packet->id, p.packet->channel);
-                }
-                // Note: we don't stop retransmission here, instead the Nak packet gets processed in sniffReceived
-                stopRetransmission(it->first);
-                stillValid = false; // just deleted it
-            } else {
-                LOG_DEBUG("Sending retransmission fr=0x%x,to=0x%x,id=0x%x, tries left=%d", p.packet->from, p.packet->to,
-                          p.packet->id, p.numRetransmissions);
-
-                if (!isBroadcast(p.packet->to)) {
-                    if (p.numRetransmissions == 1) {
-                        // Last retransmission, reset next_hop (fallback to FloodingRouter)
-                        p.packet->next_hop = NO_NEXT_HOP_PREFERENCE;
-                        // Also reset it in the nodeDB
-                        meshtastic_NodeInfoLite *sentTo = nodeDB->getMeshNode(p.packet->to);
-                        if (sentTo) {
-                            LOG_INFO("Resetting next hop for packet with dest 0x%x\n", p.packet->to);
-                            sentTo->next_hop = NO_NEXT_HOP_PREFERENCE;
-                        }
-                        FloodingRouter::send(packetPool.allocCopy(*p.packet));
-                    } else {
-                        NextHopRouter::send(packetPool.allocCopy(*p.packet));
+
+    while (!retransmissionTimers.empty()) {
+        RetransmissionTimer timer = retransmissionTimers.front();
+        std::pop_heap(retransmissionTimers.begin(), retransmissionTimers.end(), isTimerLater);
+        retransmissionTimers.pop_back();
+
+        PendingPacket *p = findPendingPacket(timer.key);
+        if (!p || p->timerSeq != timer.seq)
+            continue; // Stopped or rescheduled since this timer was set
+
+        if (p->nextTxMsec != timer.nextTxMsec || (int32_t)(timer.nextTxMsec - now) > 0) {
+            // Not due (yet), put it back at its current deadline
+            timer.nextTxMsec = p->nextTxMsec;
+            retransmissionTimers.push_back(timer);
+            std::push_heap(retransmissionTimers.begin(), retransmissionTimers.end(), isTimerLater);
+            if ((int32_t)(timer.nextTxMsec - now) > 0 && retransmissionTimers.front().seq == timer.seq)
+                break; // The earliest live deadline is in the future
+            continue;
+        }
+
+        if (p->numRetransmissions == 0) {
+            if (isFromUs(p->packet)) {
+                LOG_DEBUG("Reliable send failed, returning a nak for fr=0x%x,to=0x%x,id=0x%x", p->packet->from, p->packet->to,
+                          p->packet->id);
+                sendAckNak(meshtastic_Routing_Error_MAX_RETRANSMIT, getFrom(p->packet), p->packet->id, p->packet->channel);
+            }
+            // Note: we don't stop retransmission here, instead the Nak packet gets processed in sniffReceived
+            stopRetransmission(timer.key);
+        } else {
+            LOG_DEBUG("Sending retransmission fr=0x%x,to=0x%x,id=0x%x, tries left=%d", p->packet->from, p->packet->to,
+                      p->packet->id, p->numRetransmissions);
+
+            bool spentRetransmission = true;
+            if (!isBroadcast(p->packet->to)) {
+                // No ACK came back through the hop we used, so it counts against that hop
+                uint8_t failedHop = p->packet->next_hop;
+                noteRouteFailure(p->packet->to, failedHop);
+
+                uint8_t alternateHop = NO_NEXT_HOP_PREFERENCE;
+                if (p->numRetransmissions == 1 && !p->triedAlternateHop)
+                    alternateHop =
+                        getBestCachedHop(p->packet->to, nodeDB->getLastByteOfNodeNum(getNodeNum()), failedHop);
+
+                if (alternateHop != NO_NEXT_HOP_PREFERENCE) {
+                    // Before the last resort of a flood, give the next-best hop one try.  This doesn't use up the retransmission.
+                    LOG_INFO("Retry packet for dest 0x%x via next-best hop 0x%x before flooding", p->packet->to, alternateHop);
+                    p->triedAlternateHop = true;
+                    spentRetransmission = false;
+                    p->packet->next_hop = alternateHop;
+                    FloodingRouter::send(packetPool.allocCopy(*p->packet));
+                } else if (p->numRetransmissions == 1) {
+                    // Last retransmission, reset next_hop (fallback to FloodingRouter)
+                    p->packet->next_hop = NO_NEXT_HOP_PREFERENCE;
+                    // Also reset it in the nodeDB
+                    meshtastic_NodeInfoLite *sentTo = nodeDB->getMeshNode(p->packet->to);
+                    if (sentTo) {
+                        LOG_INFO("Resetting next hop for packet with dest 0x%x\n", p->packet->to);
+                        sentTo->next_hop = NO_NEXT_HOP_PREFERENCE;
+                        nodeDB->syncHotNode(sentTo);
                     }
+                    FloodingRouter::send(packetPool.allocCopy(*p->packet));
                 } else {
-                    // Note: we call the superclass version because we don't want to have our version of send() add a new
-                    // retransmission record
-                    FloodingRouter::send(packetPool.allocCopy(*p.packet));
+                    NextHopRouter::send(packetPool.allocCopy(*p->packet));
                 }
-
-                // Queue again
-                --p.numRetransmissions;
-                setNextTx(&p);
+            } else {
+                // Note: we call the superclass version because we don't want to have our version of send() add a new
+                // retransmission record
+                FloodingRouter::send(packetPool.allocCopy(*p->packet));
             }
-        }
-
-        if (stillValid) {
-            // Update our desired sleep delay
-            int32_t t = p.nextTxMsec - now;
 
-            d = min(t, d);
+            // Sending can add to pending (and so move records around), look ours up again before queueing it again
+            p = findPendingPacket(timer.key);
+            if (p) {
+                if (spentRetransmission)
+                    --p->numRetransmissions;
+                setNextTx(p);
+            }
         }
     }
 
-    return d;
+    if (retransmissionTimers.empty())
+        return INT32_MAX;
+
+    // Update our desired sleep delay
+    int32_t d = retransmissionTimers.front().nextTxMsec - now;
+    return d > 0 ? d : 0;
 }
 
 void NextHopRouter::setNextTx(PendingPacket *pending)
@@ -271,6 +547,9 @@ void NextHopRouter::setNextTx(PendingPacket *pending)
     assert(iface);
     auto d = iface->getRetransmissionMsec(pending->packet);
     pending->nextTxMsec = millis() + d;
+    pending->timerSeq = ++nextTimerSeq;
+    retransmissionTimers.push_back({pending->nextTxMsec, pending->timerSeq, GlobalPacketId(pending->packet)});
+    std::push_heap(retransmissionTimers.begin(), retransmissionTimers.end(), isTimerLater);
     LOG_DEBUG("Setting next retransmission in %u msecs: ", d);
     printPacket("", pending->packet);
     setReceivedMessage(); // Run ASAP, so we can figure out our correct sleep time
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "FloodingRouter.h"
+#include "Observer.h"
 #include <unordered_map>
+#include <vector>
 
 /**
  * An identifier for a globally unique message - a pair of the sending nodenum and the packet id assigned
@@ -38,10 +40,51 @@ struct PendingPacket {
     /** Starts at NUM_RETRANSMISSIONS -1 and counts down.  Once zero it will be removed from the list */
     uint8_t numRetransmissions = 0;
 
+    /** Identifies the live entry for this packet in the retransmission timer heap, older entries are ignored */
+    uint32_t timerSeq = 0;
+
+    /** Set once we spent our last retransmission on the next-best hop, so the one after that floods */
+    bool triedAlternateHop = false;
+
     PendingPacket() {}
     explicit PendingPacket(meshtastic_MeshPacket *p, uint8_t numRetransmissions);
 };
 
+/**
+ * An entry in the retransmission timer heap, ordered by nextTxMsec
+ */
+struct RetransmissionTimer {
+    uint32_t nextTxMsec;
+    uint32_t seq; // Only valid while it matches PendingPacket::timerSeq for key
+    GlobalPacketId key;
+};
+
+#define NEXTHOP_ROUTE_CACHE_SIZE 32 // Destinations we keep candidate next hops for
+#define NEXTHOP_ROUTE_CANDIDATES 3  // Candidate next hops per destination
+
+/**
+ * A relay we could use to reach a destination, with its estimated delivery ratio (0-255).  The ETX of the hop is
+ * 255 / quality, so we simply prefer the highest quality.
+ */
+struct RouteCandidate {
+    uint8_t relay;
+    uint8_t quality;
+};
+
+struct RouteCacheEntry {
+    NodeNum dest; // 0 if unused
+    uint32_t lastUpdate;
+    RouteCandidate candidates[NEXTHOP_ROUTE_CANDIDATES]; // Sorted best first, unused ones have quality 0
+};
+
+/* Recent packet history and learned routes are snapshotted to flash so a restart doesn't cause a storm of duplicate
+   rebroadcasts and DM floods.  Saved on reboot/deep sleep and every ROUTING_SNAPSHOT_INTERVAL_MSEC, 0 disables the timer. */
+#define ROUTING_SNAPSHOT_FILE "/prefs/routing.snap"
+#ifndef ROUTING_SNAPSHOT_INTERVAL_MSEC
+#define ROUTING_SNAPSHOT_INTERVAL_MSEC (15 * 60 * 1000)
+#endif
+#define ROUTING_SNAPSHOT_MAX_AGE_MSEC (10 * 60 * 1000) // History older than this no longer matters for dupes
+
 class GlobalPacketIdHashFunction
 {
   public:
@@ -57,6 +100,8 @@ class GlobalPacketIdHashFunction
   NextHopRouter only 1 time). For the final retry, if no one actually relayed the packet, it will reset the next hop in order to
   fall back to the FloodingRouter again. Note that thus also intermediate hops will do a single retransmission if the intended
   next-hop didn’t relay, in order to fix changes in the middle of the route.
+  We keep up to NEXTHOP_ROUTE_CANDIDATES next hops per destination, scored by how often they delivered. Each retransmission
+  demotes the hop it replaces, and before the final flood we give the next-best hop a single try.
 */
 class NextHopRouter : public FloodingRouter
 {
@@ -73,6 +118,8 @@ class NextHopRouter : public FloodingRouter
      */
     virtual ErrorCode send(meshtastic_MeshPacket *p) override;
 
+    virtual void learnRouteFromTraceroute(NodeNum dest, NodeNum firstHop, int8_t worstSnr) override;
+
     /** Do our retransmission handling */
     virtual int32_t runOnce() override
     {
@@ -83,9 +130,20 @@ class NextHopRouter : public FloodingRouter
 
         // Also after calling runOnce there might be new packets to retransmit
         auto d = doRetransmissions();
+
+#if ROUTING_SNAPSHOT_INTERVAL_MSEC
+        if (millis() - lastRoutingSnapshot >= ROUTING_SNAPSHOT_INTERVAL_MSEC)
+            saveRoutingSnapshot();
+#endif
         return min(d, r);
     }
 
+    /** Write recent packet history and the route cache to flash */
+    void saveRoutingSnapshot();
+
+    /** Is p, whose Routing payload is c, an ACK for more than one packet (see ReliableRouter) */
+    static bool isMultiAck(const meshtastic_MeshPacket *p, const meshtastic_Routing *c);
+
     // The number of retransmissions intermediate nodes will do (actually 1 less than this)
     constexpr static uint8_t NUM_INTERMEDIATE_RETX = 2;
     // The number of retransmissions the original sender will do
@@ -97,6 +155,14 @@ class NextHopRouter : public FloodingRouter
      */
     std::unordered_map<GlobalPacketId, PendingPacket, GlobalPacketIdHashFunction> pending;
 
+    /**
+     * Min-heap of retransmission deadlines, so doRetransmissions() only looks at packets that are due.  Entries are not
+     * removed when a retransmission is stopped or rescheduled, they are just skipped once they surface.  If a deadline got
+     * pushed back (see ReliableRouter), the entry is refiled at the new time when it surfaces.
+     */
+    std::vector<RetransmissionTimer> retransmissionTimers;
+    uint32_t nextTimerSeq = 0;
+
     /**
      * Should this incoming filter be dropped?
      *
@@ -129,6 +195,9 @@ class NextHopRouter : public FloodingRouter
     bool stopRetransmission(NodeNum from, PacketId id);
     bool stopRetransmission(GlobalPacketId p);
 
+    /** A multi-ACK also acks the packets in its route, stop retransmitting (and relaying if cancelRelay) those too */
+    void stopRetransmissionsAckedBy(const meshtastic_MeshPacket *p, const meshtastic_Routing *c, bool cancelRelay = false);
+
     /**
      * Do any retransmissions that are scheduled (FIXME - for the time being called from loop)
      *
@@ -139,6 +208,42 @@ class NextHopRouter : public FloodingRouter
     void setNextTx(PendingPacket *pending);
 
   private:
+    CallbackObserver<NextHopRouter, void *> rebootObserver =
+        CallbackObserver<NextHopRouter, void *>(this, &NextHopRouter::onShutdown);
+    CallbackObserver<NextHopRouter, void *> deepSleepObserver =
+        CallbackObserver<NextHopRouter, void *>(this, &NextHopRouter::onShutdown);
+    uint32_t lastRoutingSnapshot = 0;
+
+    int onShutdown(void *unused)
+    {
+        saveRoutingSnapshot();
+        return 0;
+    }
+
+    /** Restore what saveRoutingSnapshot() wrote, if it is there */
+    void loadRoutingSnapshot();
+
+    /**
+     * Candidate next hops per destination, learned from ACKs and traceroutes and demoted when a retransmission shows the hop
+     * didn't deliver.  The NodeDB next_hop always mirrors the best candidate, so it keeps working for anything that reads it.
+     */
+    RouteCacheEntry routeCache[NEXTHOP_ROUTE_CACHE_SIZE] = {};
+
+    /** @return the cache entry for dest, optionally claiming the least recently updated one if there is none */
+    RouteCacheEntry *findRoute(NodeNum dest, bool create);
+
+    /** A packet to dest got through via relay, or was traced through it if tracedQuality is the quality to start it at */
+    void noteRouteSuccess(NodeNum dest, uint8_t relay, uint8_t tracedQuality = 0);
+
+    /** A packet to dest via relay had to be retransmitted */
+    void noteRouteFailure(NodeNum dest, uint8_t relay);
+
+    /** @return the best candidate next hop for dest other than the excluded ones, or NO_NEXT_HOP_PREFERENCE */
+    uint8_t getBestCachedHop(NodeNum dest, uint8_t exclude1, uint8_t exclude2 = NO_NEXT_HOP_PREFERENCE);
+
+    /** Keep the candidates best first and mirror the best one to the NodeDB */
+    void sortRoute(RouteCacheEntry &route);
+
     /**
      * Get the next hop for a destination, given the relay node
      * @return the node number of the next hop, 0 if no preference (fallback to FloodingRouter)
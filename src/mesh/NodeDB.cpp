@@ -17,11 +17,14 @@
 #include "SPILock.h"
 #include "SafeFile.h"
 #include "TypeConversions.h"
+#include "concurrency/OSThread.h"
 #include "error.h"
+#include "gps/GeoCoord.h"
 #include "main.h"
 #include "mesh-pb-constants.h"
 #include "meshUtils.h"
 #include "modules/NeighborInfoModule.h"
+#include "sleep.h"
 #include <ErriezCRC32.h>
 #include <algorithm>
 #include <pb_decode.h>
@@ -58,6 +61,13 @@
 
 NodeDB *nodeDB = nullptr;
 
+/// Spread NodeNums (which are often derived from sequential MAC addresses) across the node index table
+static inline uint32_t nodeNumHash(NodeNum n)
+{
+    uint32_t h = n * 2654435761u;
+    return h ^ (h >> 16);
+}
+
 // we have plenty of ram so statically alloc this tempbuf (for now)
 EXT_RAM_BSS_ATTR meshtastic_DeviceState devicestate;
 meshtastic_MyNodeInfo &myNodeInfo = devicestate.my_node;
@@ -296,6 +306,7 @@ NodeDB::NodeDB()
     meshtastic_NodeInfoLite *info = getOrCreateMeshNode(getNodeNum());
     info->user = TypeConversions::ConvertToUserLite(owner);
     info->has_user = true;
+    syncHotNode(info);
 
     // If node database has not been saved for the first time, save it now
 #ifdef FSCom
@@ -318,21 +329,7 @@ NodeDB::NodeDB()
     // Uncomment below to always enable UDP broadcasts
     // config.network.enabled_protocols = meshtastic_Config_NetworkConfig_ProtocolFlags_UDP_BROADCAST;
 
-    // If we are setup to broadcast on the default channel, ensure that the telemetry intervals are coerced to the minimum value
-    // of 30 minutes or more
-    if (channels.isDefaultChannel(channels.getPrimaryIndex())) {
-        LOG_DEBUG("Coerce telemetry to min of 30 minutes on defaults");
-        moduleConfig.telemetry.device_update_interval = Default::getConfiguredOrMinimumValue(
-            moduleConfig.telemetry.device_update_interval, min_default_telemetry_interval_secs);
-        moduleConfig.telemetry.environment_update_interval = Default::getConfiguredOrMinimumValue(
-            moduleConfig.telemetry.environment_update_interval, min_default_telemetry_interval_secs);
-        moduleConfig.telemetry.air_quality_interval = Default::getConfiguredOrMinimumValue(
-            moduleConfig.telemetry.air_quality_interval, min_default_telemetry_interval_secs);
-        moduleConfig.telemetry.power_update_interval = Default::getConfiguredOrMinimumValue(
-            moduleConfig.telemetry.power_update_interval, min_default_telemetry_interval_secs);
-        moduleConfig.telemetry.health_update_interval = Default::getConfiguredOrMinimumValue(
-            moduleConfig.telemetry.health_update_interval, min_default_telemetry_interval_secs);
-    }
+    coerceTelemetryIntervals();
     // FIXME: UINT32_MAX intervals overflows Apple clients until they are fully patched
     if (config.device.node_info_broadcast_secs > MAX_INTERVAL)
         config.device.node_info_broadcast_secs = MAX_INTERVAL;
@@ -458,6 +455,25 @@ bool isBroadcast(uint32_t dest)
     return dest == NODENUM_BROADCAST || dest == NODENUM_BROADCAST_NO_LORA;
 }
 
+/// If we are setup to broadcast on the default channel, ensure that the telemetry intervals are coerced to the minimum value of
+/// 30 minutes or more
+void NodeDB::coerceTelemetryIntervals()
+{
+    if (channels.isDefaultChannel(channels.getPrimaryIndex())) {
+        LOG_DEBUG("Coerce telemetry to min of 30 minutes on defaults");
+        moduleConfig.telemetry.device_update_interval = Default::getConfiguredOrMinimumValue(
+            moduleConfig.telemetry.device_update_interval, min_default_telemetry_interval_secs);
+        moduleConfig.telemetry.environment_update_interval = Default::getConfiguredOrMinimumValue(
+            moduleConfig.telemetry.environment_update_interval, min_default_telemetry_interval_secs);
+        moduleConfig.telemetry.air_quality_interval = Default::getConfiguredOrMinimumValue(
+            moduleConfig.telemetry.air_quality_interval, min_default_telemetry_interval_secs);
+        moduleConfig.telemetry.power_update_interval = Default::getConfiguredOrMinimumValue(
+            moduleConfig.telemetry.power_update_interval, min_default_telemetry_interval_secs);
+        moduleConfig.telemetry.health_update_interval = Default::getConfiguredOrMinimumValue(
+            moduleConfig.telemetry.health_update_interval, min_default_telemetry_interval_secs);
+    }
+}
+
 void NodeDB::resetRadioConfig(bool is_fresh_install)
 {
     if (is_fresh_install) {
@@ -479,6 +495,7 @@ void NodeDB::resetRadioConfig(bool is_fresh_install)
 bool NodeDB::factoryReset(bool eraseBleBonds)
 {
     LOG_INFO("Perform factory reset!");
+    pendingSaveWhat = 0; // Don't write the old settings back when we reboot
     // first, remove the "/prefs" (this removes most prefs)
     spiLock->lock();
     rmDir("/prefs"); // this uses spilock internally...
@@ -521,6 +538,8 @@ void NodeDB::installDefaultNodeDatabase()
     nodeDatabase.nodes = std::vector<meshtastic_NodeInfoLite>(MAX_NUM_NODES);
     numMeshNodes = 0;
     meshNodes = &nodeDatabase.nodes;
+    rebuildNodeIndex();
+    sortMeshDB();
 }
 
 void NodeDB::installDefaultConfig(bool preserveKey = false)
@@ -986,8 +1005,14 @@ void NodeDB::resetNodes()
 {
     if (!config.position.fixed_position)
         clearLocalPosition();
+    // Our own node is kept, everything else is wiped
+    meshtastic_NodeInfoLite *us = getMeshNode(getNodeNum());
+    if (us && us != &meshNodes->at(0))
+        meshNodes->at(0) = *us;
     numMeshNodes = 1;
     std::fill(nodeDatabase.nodes.begin() + 1, nodeDatabase.nodes.end(), meshtastic_NodeInfoLite());
+    rebuildNodeIndex();
+    sortMeshDB();
     devicestate.has_rx_text_message = false;
     devicestate.has_rx_waypoint = false;
     saveNodeDatabaseToDisk();
@@ -1008,8 +1033,15 @@ void NodeDB::removeNodeByNum(NodeNum nodeNum)
     numMeshNodes -= removed;
     std::fill(nodeDatabase.nodes.begin() + numMeshNodes, nodeDatabase.nodes.begin() + numMeshNodes + 1,
               meshtastic_NodeInfoLite());
+#if !(MESHTASTIC_EXCLUDE_PKI)
+    crypto->forgetSharedKey(nodeNum);
+#endif
+    rebuildNodeIndex();
+    sortMeshDB();
     LOG_DEBUG("NodeDB::removeNodeByNum purged %d entries. Save changes", removed);
-    saveNodeDatabaseToDisk();
+    meshtastic_NodeInfoLite gone = meshtastic_NodeInfoLite_init_default;
+    gone.num = nodeNum;
+    appendNodeJournal(NODE_JOURNAL_REMOVE, gone);
 }
 
 void NodeDB::clearLocalPosition()
@@ -1025,9 +1057,11 @@ void NodeDB::clearLocalPosition()
 void NodeDB::cleanupMeshDB()
 {
     int newPos = 0, removed = 0;
+    // Entries only move down, so nodeBits (still as indexed before the purge) stay right for the ones yet to look at.
+    // Until the first node to purge, only the nodes with a key get touched.
     for (int i = 0; i < numMeshNodes; i++) {
-        if (meshNodes->at(i).has_user) {
-            if (meshNodes->at(i).user.public_key.size > 0) {
+        if (testNodeBit(NODE_BIT_HAS_USER, i)) {
+            if (testNodeBit(NODE_BIT_HAS_KEY, i)) {
                 if (memfll(meshNodes->at(i).user.public_key.bytes, 0, meshNodes->at(i).user.public_key.size)) {
                     meshNodes->at(i).user.public_key.size = 0;
                 }
@@ -1043,6 +1077,8 @@ void NodeDB::cleanupMeshDB()
     numMeshNodes -= removed;
     std::fill(nodeDatabase.nodes.begin() + numMeshNodes, nodeDatabase.nodes.begin() + numMeshNodes + removed,
               meshtastic_NodeInfoLite());
+    rebuildNodeIndex();
+    sortMeshDB();
     LOG_DEBUG("cleanupMeshDB purged %d entries", removed);
 }
 
@@ -1192,6 +1228,9 @@ void NodeDB::loadFromDisk()
         numMeshNodes = MAX_NUM_NODES;
     }
     meshNodes->resize(MAX_NUM_NODES);
+    loadNodeJournal();
+    rebuildNodeIndex();
+    sortMeshDB();
 
     // static DeviceState scratch; We no longer read into a tempbuf because this structure is 15KB of valuable RAM
     state = loadProto(deviceStateFileName, meshtastic_DeviceState_size, sizeof(meshtastic_DeviceState),
@@ -1400,7 +1439,135 @@ bool NodeDB::saveNodeDatabaseToDisk()
 #endif
     size_t nodeDatabaseSize;
     pb_get_encoded_size(&nodeDatabaseSize, meshtastic_NodeDatabase_fields, &nodeDatabase);
-    return saveProto(nodeDatabaseFileName, nodeDatabaseSize, &meshtastic_NodeDatabase_msg, &nodeDatabase, false);
+    bool okay = saveProto(nodeDatabaseFileName, nodeDatabaseSize, &meshtastic_NodeDatabase_msg, &nodeDatabase, false);
+#ifdef FSCom
+    // Everything the journal held is in nodes.proto now
+    if (okay) {
+        spiLock->lock();
+        if (FSCom.exists(nodeJournalFileName))
+            FSCom.remove(nodeJournalFileName);
+        fileManifestChanged();
+        spiLock->unlock();
+        nodeJournalBytes = 0;
+    }
+#endif
+    return okay;
+}
+
+bool NodeDB::saveNodeToDisk(const meshtastic_NodeInfoLite &node)
+{
+    return appendNodeJournal(NODE_JOURNAL_UPDATE, node);
+}
+
+/**
+ * Journal records are [type][length][NodeInfoLite protobuf][crc32 of everything before it]. A removal only carries the
+ * node number. Replay stops at the first record that doesn't check out, which is what a write torn by a reset looks like.
+ */
+bool NodeDB::appendNodeJournal(uint8_t type, const meshtastic_NodeInfoLite &node)
+{
+#ifdef FSCom
+    if (nodeJournalBytes >= NODEDB_JOURNAL_MAX_BYTES) {
+        LOG_INFO("Node journal has %u bytes, compact into %s", nodeJournalBytes, nodeDatabaseFileName);
+        return saveNodeDatabaseToDisk();
+    }
+
+    uint8_t record[2 + meshtastic_NodeInfoLite_size + sizeof(uint32_t)];
+    pb_ostream_t stream = pb_ostream_from_buffer(record + 2, meshtastic_NodeInfoLite_size);
+    if (!pb_encode(&stream, &meshtastic_NodeInfoLite_msg, &node)) {
+        LOG_ERROR("Error: can't encode node journal record %s", PB_GET_ERROR(&stream));
+        return false;
+    }
+    record[0] = type;
+    record[1] = stream.bytes_written;
+    uint32_t crc = crc32Buffer(record, 2 + stream.bytes_written);
+    memcpy(record + 2 + stream.bytes_written, &crc, sizeof(crc));
+    size_t recordLen = 2 + stream.bytes_written + sizeof(crc);
+
+    concurrency::LockGuard g(spiLock);
+    FSCom.mkdir("/prefs");
+    auto f = FSCom.open(nodeJournalFileName, FILE_O_APPEND);
+    if (!f) {
+        LOG_ERROR("Could not open %s", nodeJournalFileName);
+        return false;
+    }
+    bool okay = f.write(record, recordLen) == recordLen;
+    f.close();
+    fileManifestChanged();
+    if (!okay) {
+        LOG_ERROR("Can't write %s", nodeJournalFileName);
+        return false;
+    }
+    nodeJournalBytes += recordLen;
+    LOG_DEBUG("Journaled node 0x%x (%u bytes)", node.num, recordLen);
+    return true;
+#else
+    LOG_ERROR("ERROR: Filesystem not implemented");
+    return false;
+#endif
+}
+
+void NodeDB::loadNodeJournal()
+{
+    nodeJournalBytes = 0;
+#ifdef FSCom
+    concurrency::LockGuard g(spiLock);
+    if (!FSCom.exists(nodeJournalFileName))
+        return;
+    auto f = FSCom.open(nodeJournalFileName, FILE_O_READ);
+    if (!f)
+        return;
+    nodeJournalBytes = f.size();
+
+    uint8_t record[2 + meshtastic_NodeInfoLite_size + sizeof(uint32_t)];
+    uint32_t replayed = 0;
+    while (f.read(record, 2) == 2) {
+        size_t len = record[1];
+        if (len > meshtastic_NodeInfoLite_size || f.read(record + 2, len + sizeof(uint32_t)) != len + sizeof(uint32_t))
+            break;
+        uint32_t crc;
+        memcpy(&crc, record + 2 + len, sizeof(crc));
+        if (crc != crc32Buffer(record, 2 + len))
+            break;
+
+        meshtastic_NodeInfoLite node = meshtastic_NodeInfoLite_init_default;
+        pb_istream_t stream = pb_istream_from_buffer(record + 2, len);
+        if (!pb_decode(&stream, &meshtastic_NodeInfoLite_msg, &node))
+            break;
+
+        int found = -1;
+        for (int i = 0; i < numMeshNodes; i++)
+            if (meshNodes->at(i).num == node.num) {
+                found = i;
+                break;
+            }
+
+        if (record[0] == NODE_JOURNAL_REMOVE) {
+            if (found >= 0) {
+                for (int i = found; i < numMeshNodes - 1; i++)
+                    meshNodes->at(i) = meshNodes->at(i + 1);
+                meshNodes->at(--numMeshNodes) = meshtastic_NodeInfoLite();
+            }
+        } else if (found >= 0) {
+            meshNodes->at(found) = node;
+        } else if (numMeshNodes < MAX_NUM_NODES) {
+            meshNodes->at(numMeshNodes++) = node;
+        } else {
+            // The DB filled up after this record was written, and whoever got evicted to make room for it wasn't
+            // journaled. Make room the same way again, by dropping the stalest unprotected node
+            int oldest = -1;
+            for (int i = 1; i < numMeshNodes; i++) {
+                const meshtastic_NodeInfoLite &n = meshNodes->at(i);
+                if (!n.is_favorite && !n.is_ignored && (oldest < 0 || n.last_heard < meshNodes->at(oldest).last_heard))
+                    oldest = i;
+            }
+            if (oldest >= 0)
+                meshNodes->at(oldest) = node;
+        }
+        replayed++;
+    }
+    f.close();
+    LOG_INFO("Replayed %u node journal records (%u bytes)", replayed, nodeJournalBytes);
+#endif
 }
 
 bool NodeDB::saveToDiskNoRetry(int saveWhat)
@@ -1457,8 +1624,67 @@ bool NodeDB::saveToDiskNoRetry(int saveWhat)
     return success;
 }
 
+/// Calls NodeDB::flushPendingSave() once the oldest pending change is NODEDB_SAVE_DELAY_MSEC old, or before we go away
+class DeferredSaveThread : private concurrency::OSThread
+{
+  public:
+    DeferredSaveThread() : concurrency::OSThread("DeferredSave")
+    {
+        rebootObserver.observe(&notifyReboot);
+        deepSleepObserver.observe(&notifyDeepSleep);
+        disable();
+    }
+
+    /// Start the clock, unless it's already running for an older change
+    void schedule()
+    {
+        if (!enabled) {
+            enabled = true;
+            setIntervalFromNow(NODEDB_SAVE_DELAY_MSEC);
+        }
+    }
+
+  protected:
+    virtual int32_t runOnce() override
+    {
+        nodeDB->flushPendingSave();
+        return disable();
+    }
+
+  private:
+    CallbackObserver<DeferredSaveThread, void *> rebootObserver =
+        CallbackObserver<DeferredSaveThread, void *>(this, &DeferredSaveThread::onShutdown);
+    CallbackObserver<DeferredSaveThread, void *> deepSleepObserver =
+        CallbackObserver<DeferredSaveThread, void *>(this, &DeferredSaveThread::onShutdown);
+
+    int onShutdown(void *unused)
+    {
+        nodeDB->flushPendingSave();
+        return 0;
+    }
+};
+
+static DeferredSaveThread *deferredSaveThread;
+
+void NodeDB::saveToDiskSoon(int saveWhat)
+{
+    if (!deferredSaveThread)
+        deferredSaveThread = new DeferredSaveThread();
+    LOG_DEBUG("Save to disk %d soon", saveWhat);
+    pendingSaveWhat |= saveWhat;
+    deferredSaveThread->schedule();
+}
+
+bool NodeDB::flushPendingSave()
+{
+    return !pendingSaveWhat || saveToDisk(0);
+}
+
 bool NodeDB::saveToDisk(int saveWhat)
 {
+    // Take along anything saveToDiskSoon() was holding, whoever is saving now
+    saveWhat |= pendingSaveWhat;
+    pendingSaveWhat = 0;
     LOG_DEBUG("Save to disk %d", saveWhat);
     bool success = saveToDiskNoRetry(saveWhat);
 
@@ -1482,7 +1708,7 @@ bool NodeDB::saveToDisk(int saveWhat)
 const meshtastic_NodeInfoLite *NodeDB::readNextMeshNode(uint32_t &readIndex)
 {
     if (readIndex < numMeshNodes)
-        return &meshNodes->at(readIndex++);
+        return getMeshNodeByIndex(readIndex++);
     else
         return NULL;
 }
@@ -1515,13 +1741,16 @@ uint32_t sinceReceived(const meshtastic_MeshPacket *p)
 size_t NodeDB::getNumOnlineMeshNodes(bool localOnly)
 {
     size_t numseen = 0;
+    uint32_t now = getTime();
 
-    // FIXME this implementation is kinda expensive
-    for (int i = 0; i < numMeshNodes; i++) {
-        if (localOnly && meshNodes->at(i).via_mqtt)
-            continue;
-        if (sinceLastSeen(&meshNodes->at(i)) < NUM_ONLINE_SECS)
-            numseen++;
+    // Runs on every notifyObservers(), so only the packed lastHeard and via_mqtt bits are read, never the nodes
+    for (size_t w = 0; w * 32 < numMeshNodes; w++) {
+        uint32_t skip = localOnly ? nodeBits[NODE_BIT_VIA_MQTT][w] : 0;
+        size_t end = numMeshNodes < (w + 1) * 32 ? numMeshNodes : (w + 1) * 32;
+        for (size_t i = w * 32; i < end; i++) {
+            int delta = (int)(now - lastHeard[i]); // Same as sinceLastSeen(), ahead of our clock counts as just now
+            numseen += (delta < NUM_ONLINE_SECS) & !((skip >> (i % 32)) & 1);
+        }
     }
 
     return numseen;
@@ -1570,6 +1799,7 @@ void NodeDB::updatePosition(uint32_t nodeId, const meshtastic_Position &p, RxSou
             info->position.time = tmp_time;
     }
     info->has_position = true;
+    markNodeChanged(nodeId);
     updateGUIforNode = info;
     notifyObservers(true); // Force an update whether or not our node counts have changed
 }
@@ -1593,6 +1823,7 @@ void NodeDB::updateTelemetry(uint32_t nodeId, const meshtastic_Telemetry &t, RxS
     }
     info->device_metrics = t.variant.device_metrics;
     info->has_device_metrics = true;
+    markNodeChanged(nodeId);
     updateGUIforNode = info;
     notifyObservers(true); // Force an update whether or not our node counts have changed
 }
@@ -1624,14 +1855,35 @@ void NodeDB::addFromContact(meshtastic_SharedContact contact)
         // Mark the node's key as manually verified to indicate trustworthiness.
         updateGUIforNode = info;
         // powerFSM.trigger(EVENT_NODEDB_UPDATED); This event has been retired
-        sortMeshDB();
+        updateNodeOrder(info);
         notifyObservers(true); // Force an update whether or not our node counts have changed
     }
-    saveNodeDatabaseToDisk();
+    markNodeChanged(contact.node_num);
+    saveNodeToDisk(*info);
 }
 
 /** Update user info and channel for this node based on received user data
  */
+uint8_t NodeDB::getUserHash(const meshtastic_UserLite &u)
+{
+    uint32_t h = 2166136261u; // FNV-1a, folded to a byte
+    auto add = [&h](const void *bytes, size_t len) {
+        for (size_t i = 0; i < len; i++)
+            h = (h ^ ((const uint8_t *)bytes)[i]) * 16777619u;
+    };
+    add(u.long_name, strnlen(u.long_name, sizeof(u.long_name)));
+    add(u.short_name, strnlen(u.short_name, sizeof(u.short_name)));
+    uint8_t fixed[] = {(uint8_t)u.hw_model, (uint8_t)u.role, u.is_licensed, u.is_unmessagable, (uint8_t)u.public_key.size};
+    add(fixed, sizeof(fixed));
+    add(u.public_key.bytes, u.public_key.size);
+    return h ^ (h >> 8) ^ (h >> 16) ^ (h >> 24);
+}
+
+uint8_t NodeDB::getOwnerHash()
+{
+    return getUserHash(TypeConversions::ConvertToUserLite(owner));
+}
+
 bool NodeDB::updateUser(uint32_t nodeId, meshtastic_User &p, uint8_t channelIndex)
 {
     meshtastic_NodeInfoLite *info = getOrCreateMeshNode(nodeId);
@@ -1672,6 +1924,7 @@ bool NodeDB::updateUser(uint32_t nodeId, meshtastic_User &p, uint8_t channelInde
         memcpy(p.public_key.bytes, info->user.public_key.bytes, 32);
     } else if (p.public_key.size == 32) {
         LOG_INFO("Update Node Pubkey!");
+        crypto->forgetSharedKey(nodeId); // Don't keep using a secret derived from an older key
     }
 #endif
 
@@ -1688,20 +1941,15 @@ bool NodeDB::updateUser(uint32_t nodeId, meshtastic_User &p, uint8_t channelInde
     LOG_DEBUG("Update changed=%d user %s/%s, id=0x%08x, channel=%d", changed, info->user.long_name, info->user.short_name, nodeId,
               info->channel);
     info->has_user = true;
+    syncHotNode(info);
 
     if (changed) {
+        markNodeChanged(nodeId);
         updateGUIforNode = info;
         notifyObservers(true); // Force an update whether or not our node counts have changed
 
-        // We just changed something about a User,
-        // store our DB unless we just did so less than a minute ago
-
-        if (!Throttle::isWithinTimespanMs(lastNodeDbSave, ONE_MINUTE_MS)) {
-            saveToDisk(SEGMENT_NODEDATABASE);
-            lastNodeDbSave = millis();
-        } else {
-            LOG_DEBUG("Defer NodeDB saveToDisk for now");
-        }
+        // We just changed something about a User, journaling just this node is cheap enough to do every time
+        saveNodeToDisk(*info);
     }
 
     return changed;
@@ -1723,6 +1971,7 @@ void NodeDB::updateFrom(const meshtastic_MeshPacket &mp)
             return;
         }
 
+        recency.heard(info - meshNodes->data(), millis() / 1000);
         if (mp.rx_time) // if the packet has a valid timestamp use it to update our last_heard
             info->last_heard = mp.rx_time;
 
@@ -1736,73 +1985,277 @@ void NodeDB::updateFrom(const meshtastic_MeshPacket &mp)
             info->has_hops_away = true;
             info->hops_away = mp.hop_start - mp.hop_limit;
         }
-        sortMeshDB();
+        markNodeChanged(info->num);
+        updateNodeOrder(info);
     }
 }
 
+void NodeDB::noteHopsAway(NodeNum n, uint8_t hops)
+{
+    meshtastic_NodeInfoLite *lite = getMeshNode(n);
+    if (!lite || n == getNodeNum() || (lite->has_hops_away && lite->hops_away <= hops))
+        return;
+    // Only ever brings a count down, the next packet we hear from it says how far it really is
+    lite->has_hops_away = true;
+    lite->hops_away = hops;
+    markNodeChanged(n);
+}
+
 void NodeDB::set_favorite(bool is_favorite, uint32_t nodeId)
 {
     meshtastic_NodeInfoLite *lite = getMeshNode(nodeId);
     if (lite && lite->is_favorite != is_favorite) {
         lite->is_favorite = is_favorite;
-        sortMeshDB();
-        saveNodeDatabaseToDisk();
+        markNodeChanged(nodeId);
+        updateNodeOrder(lite);
+        saveNodeToDisk(*lite);
     }
 }
 
 void NodeDB::pause_sort(bool paused)
 {
     sortingIsPaused = paused;
+    if (!paused && sortPending)
+        sortMeshDB();
+}
+
+bool NodeDB::isSortedBefore(const meshtastic_NodeInfoLite &a, const meshtastic_NodeInfoLite &b)
+{
+    NodeNum us = getNodeNum();
+    if (a.num == us || b.num == us)
+        return a.num == us && b.num != us;
+    if (a.is_favorite != b.is_favorite)
+        return a.is_favorite;
+    return a.last_heard > b.last_heard;
 }
 
 void NodeDB::sortMeshDB()
 {
-    if (!sortingIsPaused && (lastSort == 0 || !Throttle::isWithinTimespanMs(lastSort, 1000 * 5))) {
-        lastSort = millis();
-        bool changed = true;
-        while (changed) { // dumb reverse bubble sort, but probably not bad for what we're doing
-            changed = false;
-            for (int i = numMeshNodes - 1; i > 0; i--) { // lowest case this should examine is i == 1
-                if (meshNodes->at(i - 1).num == getNodeNum()) {
-                    // noop
-                } else if (meshNodes->at(i).num ==
-                           getNodeNum()) { // in the oddball case our own node num is not at location 0, put it there
-                    // TODO: Look for at(i-1) also matching own node num, and throw the DB in the trash
-                    std::swap(meshNodes->at(i), meshNodes->at(i - 1));
-                    changed = true;
-                } else if (meshNodes->at(i).is_favorite && !meshNodes->at(i - 1).is_favorite) {
-                    std::swap(meshNodes->at(i), meshNodes->at(i - 1));
-                    changed = true;
-                } else if (!meshNodes->at(i).is_favorite && meshNodes->at(i - 1).is_favorite) {
-                    // noop
-                } else if (meshNodes->at(i).last_heard > meshNodes->at(i - 1).last_heard) {
-                    std::swap(meshNodes->at(i), meshNodes->at(i - 1));
-                    changed = true;
-                }
-            }
-        }
-        LOG_INFO("Sort took %u milliseconds", millis() - lastSort);
+    uint32_t start = millis();
+    nodeOrder.reserve(MAX_NUM_NODES);
+    nodeOrder.resize(numMeshNodes);
+    for (size_t i = 0; i < numMeshNodes; i++)
+        nodeOrder[i] = i;
+    std::stable_sort(nodeOrder.begin(), nodeOrder.end(),
+                     [this](uint16_t a, uint16_t b) { return isSortedBefore(meshNodes->at(a), meshNodes->at(b)); });
+    sortPending = false;
+    LOG_DEBUG("Sort of %u nodes took %u milliseconds", numMeshNodes, millis() - start);
+}
+
+void NodeDB::updateNodeOrder(const meshtastic_NodeInfoLite *lite)
+{
+    uint16_t x = lite - meshNodes->data();
+    auto it = std::find(nodeOrder.begin(), nodeOrder.end(), x);
+
+    if (sortingIsPaused) {
+        // Don't shuffle the list under the node picker, but new nodes still need to be reachable
+        if (it == nodeOrder.end())
+            nodeOrder.push_back(x);
+        sortPending = true;
+        return;
     }
+
+    // Only 2 byte entries shift here, the NodeInfoLite itself stays put and finding its new place is a binary search
+    if (it != nodeOrder.end())
+        nodeOrder.erase(it);
+    auto pos = std::upper_bound(nodeOrder.begin(), nodeOrder.end(), x, [this](uint16_t a, uint16_t b) {
+        return isSortedBefore(meshNodes->at(a), meshNodes->at(b));
+    });
+    nodeOrder.insert(pos, x);
 }
 
 uint8_t NodeDB::getMeshNodeChannel(NodeNum n)
 {
-    const meshtastic_NodeInfoLite *info = getMeshNode(n);
-    if (!info) {
+    const NodeHot *hot = getHotNode(n);
+    if (!hot) {
         return 0; // defaults to PRIMARY
     }
-    return info->channel;
+    return hot->channel;
+}
+
+int NodeDB::findMeshNode(NodeNum n)
+{
+    if (nodeIndex.empty())
+        return -1;
+
+    // Slots are only ever filled while the table is in sync with meshNodes, and every hit is verified against the
+    // node itself, so a lookup racing a rebuild can at worst miss, never return the wrong node.
+    for (uint32_t slot = nodeNumHash(n) & nodeIndexMask;; slot = (slot + 1) & nodeIndexMask) {
+        uint16_t entry = nodeIndex[slot];
+        if (entry == 0)
+            return -1;
+        size_t x = entry - 1;
+        if (x < numMeshNodes && hotNodes[x].num == n)
+            return x;
+    }
 }
 
 /// Find a node in our DB, return null for missing
 /// NOTE: This function might be called from an ISR
 meshtastic_NodeInfoLite *NodeDB::getMeshNode(NodeNum n)
 {
-    for (int i = 0; i < numMeshNodes; i++)
-        if (meshNodes->at(i).num == n)
-            return &meshNodes->at(i);
+    int x = findMeshNode(n);
+    return x < 0 ? NULL : &(*meshNodes)[x];
+}
+
+const NodeHot *NodeDB::getHotNode(NodeNum n)
+{
+    int x = findMeshNode(n);
+    return x < 0 ? NULL : &hotNodes[x];
+}
+
+void NodeDB::syncHotNode(const meshtastic_NodeInfoLite *lite)
+{
+    size_t x = lite - meshNodes->data();
+    NodeHot &hot = hotNodes[x];
+    hot.num = lite->num;
+    float snr = lite->snr * 4;
+    hot.snr = snr > INT8_MAX ? INT8_MAX : snr < INT8_MIN ? INT8_MIN : (int8_t)snr;
+    hot.next_hop = lite->next_hop;
+    hot.channel = lite->channel;
+    hot.flags = (lite->has_user ? NODE_HOT_HAS_USER : 0) | (lite->is_favorite ? NODE_HOT_IS_FAVORITE : 0) |
+                (lite->is_ignored ? NODE_HOT_IS_IGNORED : 0) | (lite->via_mqtt ? NODE_HOT_VIA_MQTT : 0);
+
+    lastHeard[x] = lite->last_heard;
+    const bool bits[NODE_BIT_COUNT] = {lite->via_mqtt, lite->has_user, lite->user.public_key.size > 0,
+                                       (lite->bitfield & NODEINFO_BITFIELD_IS_KEY_MANUALLY_VERIFIED_MASK) != 0,
+                                       lite->is_favorite || lite->is_ignored};
+    for (int b = 0; b < NODE_BIT_COUNT; b++) {
+        if (bits[b])
+            nodeBits[b][x / 32] |= 1UL << (x % 32);
+        else
+            nodeBits[b][x / 32] &= ~(1UL << (x % 32));
+    }
+}
+
+void NodeDB::rebuildNodeIndex()
+{
+    if (nodeIndex.empty()) {
+        // Keep the load factor at or below 50% so probe sequences stay short
+        uint32_t slots = 16;
+        while (slots < 2 * (uint32_t)MAX_NUM_NODES)
+            slots <<= 1;
+        nodeIndex.resize(slots);
+        nodeIndexMask = slots - 1;
+        hotNodes.resize(MAX_NUM_NODES);
+        lastHeard.resize(MAX_NUM_NODES);
+        for (auto &bits : nodeBits)
+            bits.resize((MAX_NUM_NODES + 31) / 32);
+        recency.reset(MAX_NUM_NODES);
+    }
+    std::fill(nodeIndex.begin(), nodeIndex.end(), 0);
+    spatialIndex.clear();
+    for (size_t i = 0; i < numMeshNodes; i++) {
+        indexMeshNode(i);
+        const meshtastic_NodeInfoLite &n = (*meshNodes)[i];
+        spatialIndex.update(i, hasValidPosition(&n), n.position.latitude_i, n.position.longitude_i);
+    }
+    recency.rebuild(lastHeard.data(), numMeshNodes);
+
+    // Entries only move around when nodes are removed, evicted or reloaded, which a change cursor can't express
+    removedSeq = ++changeSeq;
+    nodeChanges.erase(std::remove_if(nodeChanges.begin(), nodeChanges.end(),
+                                     [this](const NodeChange &c) { return getMeshNode(c.num) == NULL; }),
+                      nodeChanges.end());
+}
+
+void NodeDB::markNodeChanged(NodeNum n)
+{
+    auto it = std::lower_bound(nodeChanges.begin(), nodeChanges.end(), n,
+                               [](const NodeChange &c, NodeNum num) { return c.num < num; });
+    if (it == nodeChanges.end() || it->num != n)
+        it = nodeChanges.insert(it, NodeChange{n, 0});
+    it->seq = ++changeSeq;
+
+    const meshtastic_NodeInfoLite *lite = getMeshNode(n);
+    if (lite) {
+        syncHotNode(lite);
+        spatialIndex.update(lite - meshNodes->data(), hasValidPosition(lite), lite->position.latitude_i,
+                            lite->position.longitude_i);
+    }
+}
+
+std::vector<meshtastic_NodeInfoLite *> NodeDB::getNodesWithin(int32_t latitude_i, int32_t longitude_i, float meters,
+                                                              size_t max)
+{
+    std::vector<uint16_t> candidates;
+    spatialIndex.candidates(latitude_i, longitude_i, meters, candidates);
+
+    // Measure from the positions the nodes have now, in case one changed without markNodeChanged()
+    GeoOrigin origin(latitude_i, longitude_i);
+    std::vector<std::pair<float, meshtastic_NodeInfoLite *>> found;
+    for (uint16_t x : candidates) {
+        if (x >= numMeshNodes)
+            continue;
+        meshtastic_NodeInfoLite *lite = &(*meshNodes)[x];
+        if (!hasValidPosition(lite))
+            continue;
+        float d = origin.distanceTo(lite->position.latitude_i, lite->position.longitude_i);
+        if (d <= meters)
+            found.push_back(std::make_pair(d, lite));
+    }
+
+    std::sort(found.begin(), found.end(),
+              [](const std::pair<float, meshtastic_NodeInfoLite *> &a, const std::pair<float, meshtastic_NodeInfoLite *> &b) {
+                  return a.first < b.first;
+              });
+    if (max && found.size() > max)
+        found.resize(max);
+
+    std::vector<meshtastic_NodeInfoLite *> nodes;
+    nodes.reserve(found.size());
+    for (auto &f : found)
+        nodes.push_back(f.second);
+    return nodes;
+}
+
+std::vector<meshtastic_NodeInfoLite *> NodeDB::getNearestNodes(int32_t latitude_i, int32_t longitude_i, size_t k)
+{
+    // Widen the search until it holds k nodes, the k nearest of everything within a radius are the k nearest overall
+    float meters = (1 << NODEDB_GRID_SHIFT) * 1e-7f * 111000;
+    std::vector<meshtastic_NodeInfoLite *> nodes;
+    while (k) {
+        nodes = getNodesWithin(latitude_i, longitude_i, meters, k);
+        if (nodes.size() >= k || meters > 20100000) // Half way round the earth, so that was everything
+            break;
+        meters *= 4;
+    }
+    return nodes;
+}
+
+uint32_t NodeDB::getNodeChangeSeq(NodeNum n) const
+{
+    auto it = std::lower_bound(nodeChanges.begin(), nodeChanges.end(), n,
+                               [](const NodeChange &c, NodeNum num) { return c.num < num; });
+    return (it != nodeChanges.end() && it->num == n) ? it->seq : 0;
+}
 
-    return NULL;
+void NodeDB::indexMeshNode(size_t x)
+{
+    syncHotNode(&meshNodes->at(x)); // Before the slot, findMeshNode() checks the num in hotNodes
+    uint32_t slot = nodeNumHash(meshNodes->at(x).num) & nodeIndexMask;
+    while (nodeIndex[slot] != 0)
+        slot = (slot + 1) & nodeIndexMask;
+    nodeIndex[slot] = (uint16_t)(x + 1);
+}
+
+void NodeDB::unindexMeshNode(size_t x)
+{
+    uint32_t slot = nodeNumHash(hotNodes[x].num) & nodeIndexMask;
+    while (nodeIndex[slot] != x + 1) {
+        if (nodeIndex[slot] == 0)
+            return;
+        slot = (slot + 1) & nodeIndexMask;
+    }
+    // Close the gap, moving back each entry after it whose probe sequence passes through the hole
+    for (uint32_t next = (slot + 1) & nodeIndexMask; nodeIndex[next] != 0; next = (next + 1) & nodeIndexMask) {
+        uint32_t home = nodeNumHash(hotNodes[nodeIndex[next] - 1].num) & nodeIndexMask;
+        if (((next - home) & nodeIndexMask) >= ((next - slot) & nodeIndexMask)) {
+            nodeIndex[slot] = nodeIndex[next];
+            slot = next;
+        }
+    }
+    nodeIndex[slot] = 0;
 }
 
 // returns true if the maximum number of nodes is reached or we are running low on memory
@@ -1817,48 +2270,44 @@ meshtastic_NodeInfoLite *NodeDB::getOrCreateMeshNode(NodeNum n)
     meshtastic_NodeInfoLite *lite = getMeshNode(n);
 
     if (!lite) {
+        size_t x = numMeshNodes;
         if (isFull()) {
-            LOG_INFO("Node database full with %i nodes and %u bytes free. Erasing oldest entry", numMeshNodes,
-                     memGet.getFreeHeap());
-            // look for oldest node and erase it
-            uint32_t oldest = UINT32_MAX;
-            uint32_t oldestBoring = UINT32_MAX;
-            int oldestIndex = -1;
-            int oldestBoringIndex = -1;
-            for (int i = 1; i < numMeshNodes; i++) {
-                // Simply the oldest non-favorite, non-ignored, non-verified node
-                if (!meshNodes->at(i).is_favorite && !meshNodes->at(i).is_ignored &&
-                    !(meshNodes->at(i).bitfield & NODEINFO_BITFIELD_IS_KEY_MANUALLY_VERIFIED_MASK) &&
-                    meshNodes->at(i).last_heard < oldest) {
-                    oldest = meshNodes->at(i).last_heard;
-                    oldestIndex = i;
-                }
-                // The oldest "boring" node
-                if (!meshNodes->at(i).is_favorite && !meshNodes->at(i).is_ignored && meshNodes->at(i).user.public_key.size == 0 &&
-                    meshNodes->at(i).last_heard < oldestBoring) {
-                    oldestBoring = meshNodes->at(i).last_heard;
-                    oldestBoringIndex = i;
-                }
-            }
-            // if we found a "boring" node, evict it
-            if (oldestBoringIndex != -1) {
-                oldestIndex = oldestBoringIndex;
-            }
-
-            if (oldestIndex != -1) {
-                // Shove the remaining nodes down the chain
-                for (int i = oldestIndex; i < numMeshNodes - 1; i++) {
-                    meshNodes->at(i) = meshNodes->at(i + 1);
-                }
-                (numMeshNodes)--;
+            // Never us, a favorite or ignored node, or one whose key was verified by hand
+            int us = findMeshNode(getNodeNum());
+            int victim = recency.victim([this, us](uint16_t i) {
+                return (int)i != us && i < numMeshNodes && !testNodeBit(NODE_BIT_KEEP, i) &&
+                       !testNodeBit(NODE_BIT_VERIFIED, i);
+            });
+            if (victim >= 0) {
+                NodeNum gone = hotNodes[victim].num;
+                LOG_INFO("Node database full with %i nodes and %u bytes free. Erasing 0x%x (%s)", numMeshNodes,
+                         memGet.getFreeHeap(), gone,
+                         recency.segmentOf(victim) == NodeRecency::PROBATION ? "on probation" : "protected");
+                // The new node takes its slot, so nothing else moves
+                x = victim;
+                unindexMeshNode(x);
+                recency.remove(x);
+                spatialIndex.update(x, false, 0, 0);
+                removedSeq = ++changeSeq;
+                nodeChanges.erase(std::remove_if(nodeChanges.begin(), nodeChanges.end(),
+                                                 [gone](const NodeChange &c) { return c.num == gone; }),
+                                  nodeChanges.end());
+            } else if (numMeshNodes >= MAX_NUM_NODES) {
+                LOG_WARN("Node database full of nodes we keep, not adding 0x%x", n);
+                return NULL;
             }
         }
-        // add the node at the end
-        lite = &meshNodes->at((numMeshNodes)++);
+        lite = &meshNodes->at(x);
 
         // everything is missing except the nodenum
         memset(lite, 0, sizeof(*lite));
         lite->num = n;
+        if (x == numMeshNodes)
+            numMeshNodes++;
+        indexMeshNode(x);
+        recency.add(x, millis() / 1000);
+        markNodeChanged(n);
+        updateNodeOrder(lite);
         LOG_INFO("Adding node to database with %i nodes and %u bytes free!", numMeshNodes, memGet.getFreeHeap());
     }
 
@@ -7,7 +7,10 @@
 #include <pb_encode.h>
 #include <vector>
 
+#include "InternalRamAllocator.h"
 #include "MeshTypes.h"
+#include "NodeRecency.h"
+#include "NodeSpatialIndex.h"
 #include "NodeStatus.h"
 #include "configuration.h"
 #include "mesh-pb-constants.h"
@@ -81,6 +84,19 @@ DeviceState versions used to be defined in the .proto file but really only this
 #define SEGMENT_CHANNELS 8
 #define SEGMENT_NODEDATABASE 16
 
+#ifndef NODEDB_SAVE_DELAY_MSEC
+#define NODEDB_SAVE_DELAY_MSEC (5 * 1000) // How long saveToDiskSoon() holds changed segments before writing them
+#endif
+
+// Record types in the node journal
+#define NODE_JOURNAL_UPDATE 1
+#define NODE_JOURNAL_REMOVE 2
+
+// Once the journal grows past this many bytes, the next node save rewrites nodes.proto and starts a fresh journal
+#ifndef NODEDB_JOURNAL_MAX_BYTES
+#define NODEDB_JOURNAL_MAX_BYTES 4096
+#endif
+
 #define DEVICESTATE_CUR_VER 24
 #define DEVICESTATE_MIN_VER 24
 
@@ -97,6 +113,7 @@ extern meshtastic_Position localPosition;
 static constexpr const char *deviceStateFileName = "/prefs/device.proto";
 static constexpr const char *legacyPrefFileName = "/prefs/db.proto";
 static constexpr const char *nodeDatabaseFileName = "/prefs/nodes.proto";
+static constexpr const char *nodeJournalFileName = "/prefs/nodes.journal";
 static constexpr const char *configFileName = "/prefs/config.proto";
 static constexpr const char *uiconfigFileName = "/prefs/uiconfig.proto";
 static constexpr const char *moduleConfigFileName = "/prefs/module.proto";
@@ -124,6 +141,25 @@ enum LoadFileResult {
 
 enum UserLicenseStatus { NotKnown, NotLicensed, Licensed };
 
+// NodeHot::flags
+#define NODE_HOT_HAS_USER 0x01
+#define NODE_HOT_IS_FAVORITE 0x02
+#define NODE_HOT_IS_IGNORED 0x04
+#define NODE_HOT_VIA_MQTT 0x08
+
+/**
+ * The few fields of a node the routing path reads for every packet, copied out of its NodeInfoLite into a compact array
+ * in internal RAM (same index as meshNodes).  On boards with PSRAM the NodeInfoLite entries themselves end up there, so
+ * looking a node up to route a packet shouldn't have to touch them.  last_heard is kept apart, see NodeDB::lastHeard.
+ */
+struct NodeHot {
+    NodeNum num;
+    int8_t snr; // In quarter dB
+    uint8_t next_hop;
+    uint8_t channel;
+    uint8_t flags; // NODE_HOT_*
+};
+
 class NodeDB
 {
     // NodeNum provisionalNodeNum; // if we are trying to find a node num this is our current attempt
@@ -152,6 +188,20 @@ class NodeDB
     bool saveToDisk(int saveWhat = SEGMENT_CONFIG | SEGMENT_MODULECONFIG | SEGMENT_DEVICESTATE | SEGMENT_CHANNELS |
                                    SEGMENT_NODEDATABASE);
 
+    /// Mark segments as changed and write them out together once NODEDB_SAVE_DELAY_MSEC has passed (or sooner if we
+    /// reboot or deep sleep), so a burst of edits from a client costs one write of each segment instead of one per edit.
+    /// Any saveToDisk() in the meantime writes the pending segments too.
+    void saveToDiskSoon(int saveWhat);
+
+    /// Write out whatever saveToDiskSoon() has left pending now
+    /// @return true if the save was successful (or there was nothing to save)
+    bool flushPendingSave();
+
+    /// Persist a single node by appending it to the node journal, instead of rewriting the whole node database.
+    /// The journal gets folded back into nodes.proto by the next full save.
+    /// @return true if the save was successful
+    bool saveNodeToDisk(const meshtastic_NodeInfoLite &node);
+
     /** Reinit radio config if needed, because either:
      * a) sometimes a buggy android app might send us bogus settings or
      * b) the client set factory_reset
@@ -162,6 +212,9 @@ class NodeDB
      */
     void resetRadioConfig(bool is_fresh_install = false);
 
+    /// Hold telemetry intervals to their minimum while we are on the default channel
+    void coerceTelemetryIntervals();
+
     /// given a subpacket sniffed from the network, update our DB state
     /// we updateGUI and updateGUIforNode if we think our this change is big enough for a redraw
     void updateFrom(const meshtastic_MeshPacket &p);
@@ -180,6 +233,10 @@ class NodeDB
      */
     bool updateUser(uint32_t nodeId, meshtastic_User &p, uint8_t channelIndex = 0);
 
+    /// A byte that changes whenever anything shown of the user does, sent with our broadcasts so others see when theirs is old
+    static uint8_t getUserHash(const meshtastic_UserLite &u);
+    static uint8_t getOwnerHash();
+
     /*
      * Sets a node either favorite or unfavorite
      */
@@ -228,15 +285,47 @@ class NodeDB
 
     const meshtastic_NodeInfoLite *readNextMeshNode(uint32_t &readIndex);
 
+    /// @return the x'th node in display order (our own node first, then favorites, then most recently heard)
     meshtastic_NodeInfoLite *getMeshNodeByIndex(size_t x)
     {
         assert(x < numMeshNodes);
-        return &meshNodes->at(x);
+        return &meshNodes->at(nodeOrder[x]);
     }
 
     virtual meshtastic_NodeInfoLite *getMeshNode(NodeNum n);
     size_t getNumMeshNodes() { return numMeshNodes; }
 
+    /// Like getMeshNode(), but only the routing fields, which stay in internal RAM.  Prefer this on the per-packet path.
+    /// NOTE: This function might be called from an ISR
+    const NodeHot *getHotNode(NodeNum n);
+
+    /// Copy the routing fields of a node into its NodeHot, for changes made without markNodeChanged()
+    void syncHotNode(const meshtastic_NodeInfoLite *lite);
+
+    /// We learnt n is at most hops relays away some other way than hearing it, e.g. it is next to a node we know the hops to
+    void noteHopsAway(NodeNum n, uint8_t hops);
+
+    /// Something a client would want to know about changed for node n, give it a new change sequence number
+    /// (this is also where a new position lands in the spatial index, so call it after changing one)
+    void markNodeChanged(NodeNum n);
+
+    /// @return the change sequence number of the last change to node n, 0 if it didn't change since boot
+    uint32_t getNodeChangeSeq(NodeNum n) const;
+
+    /// @return the sequence number of the most recent change to any node, a cursor for getNodeChangeSeq()
+    uint32_t getChangeSeq() const { return changeSeq; }
+
+    /// @return true if a node may have been dropped from the DB after cursor seq, so a client can't just apply the changes
+    bool nodesRemovedSince(uint32_t seq) const { return removedSeq > seq; }
+
+    /// Nodes with a valid position within meters of lat/lon, nearest first, at most max of them (0 for no limit)
+    /// The pointers stay valid until nodes are added or removed
+    std::vector<meshtastic_NodeInfoLite *> getNodesWithin(int32_t latitude_i, int32_t longitude_i, float meters,
+                                                          size_t max = 0);
+
+    /// The (up to) k nodes with a valid position nearest to lat/lon, nearest first
+    std::vector<meshtastic_NodeInfoLite *> getNearestNodes(int32_t latitude_i, int32_t longitude_i, size_t k);
+
     UserLicenseStatus getLicenseStatus(uint32_t nodeNum);
 
     size_t getMaxNodesAllocatedSize()
@@ -284,12 +373,70 @@ class NodeDB
 
   private:
     bool duplicateWarned = false;
-    uint32_t lastNodeDbSave = 0;    // when we last saved our db to flash
     uint32_t lastBackupAttempt = 0; // when we last tried a backup automatically or manually
-    uint32_t lastSort = 0;          // When last sorted the nodeDB
+
+    /// Open-addressing NodeNum -> meshNodes index side table so getMeshNode() doesn't need to scan the whole DB.
+    /// Each slot holds (index + 1), zero marks an empty slot.  The table is allocated once (power of two, at least
+    /// twice MAX_NUM_NODES) and never reallocated, so lookups from an ISR never see freed memory.
+    std::vector<uint16_t, InternalRamAllocator<uint16_t>> nodeIndex;
+    uint32_t nodeIndexMask = 0;
+
+    /// The routing fields of every node, allocated along with nodeIndex and never reallocated either
+    std::vector<NodeHot, InternalRamAllocator<NodeHot>> hotNodes;
+
+    /// @return the meshNodes index of node n, -1 if we don't know it
+    int findMeshNode(NodeNum n);
+
+    /// last_heard of every node, same index as meshNodes, so the online count and eviction scans read 4 bytes a node
+    std::vector<uint32_t, InternalRamAllocator<uint32_t>> lastHeard;
+
+    /// What those scans test, one bit per node: bit x % 32 of word x / 32 of each nodeBits[]
+    enum NodeBit { NODE_BIT_VIA_MQTT, NODE_BIT_HAS_USER, NODE_BIT_HAS_KEY, NODE_BIT_VERIFIED, NODE_BIT_KEEP, NODE_BIT_COUNT };
+    std::vector<uint32_t, InternalRamAllocator<uint32_t>> nodeBits[NODE_BIT_COUNT]; // NODE_BIT_KEEP: favorite or ignored
+
+    bool testNodeBit(NodeBit b, size_t x) const { return nodeBits[b][x / 32] & (1UL << (x % 32)); }
+
+    /// How recently and how often we heard each node, to pick which one to drop when the DB is full
+    NodeRecency recency;
+
     /// Find a node in our DB, create an empty NodeInfoLite if missing
     meshtastic_NodeInfoLite *getOrCreateMeshNode(NodeNum n);
 
+    /// Change sequence numbers of the nodes that changed since boot, sorted by node number.  Kept in RAM only, a client
+    /// cursor doesn't survive our reboot anyway.
+    struct NodeChange {
+        NodeNum num;
+        uint32_t seq;
+    };
+    std::vector<NodeChange> nodeChanges;
+    uint32_t changeSeq = 0;
+    uint32_t removedSeq = 0; // changeSeq when nodes last moved around or went away
+
+    /// Rebuild nodeIndex from scratch, must be called whenever entries in meshNodes move around
+    void rebuildNodeIndex();
+
+    /// Add meshNodes[x] to nodeIndex and fill in its NodeHot
+    void indexMeshNode(size_t x);
+
+    /// Take meshNodes[x] out of nodeIndex, so its slot can be reused for another node
+    void unindexMeshNode(size_t x);
+
+    /// Grid cells of the nodes with a position, rebuilt along with nodeIndex and kept current by markNodeChanged()
+    NodeSpatialIndex spatialIndex;
+
+    /// Permutation of meshNodes indexes in display order.  Sorting this instead of meshNodes itself means a reorder never
+    /// moves whole NodeInfoLite structs, and pointers into meshNodes stay valid across a sort.
+    std::vector<uint16_t> nodeOrder;
+
+    /// true if a node changed while sorting was paused, so nodeOrder needs a full sort once unpaused
+    bool sortPending = false;
+
+    /// @return true if a belongs before b in nodeOrder
+    bool isSortedBefore(const meshtastic_NodeInfoLite &a, const meshtastic_NodeInfoLite &b);
+
+    /// Move a single node to its correct place in nodeOrder after its sort key changed (or it was just added)
+    void updateNodeOrder(const meshtastic_NodeInfoLite *lite);
+
     /*
      * Internal boolean to track sorting paused
      */
@@ -312,9 +459,22 @@ class NodeDB
     /// @return true if the save was successful
     bool saveToDiskNoRetry(int saveWhat);
 
+    int pendingSaveWhat = 0; // Segments saveToDiskSoon() hasn't written yet
+
     bool saveChannelsToDisk();
     bool saveDeviceStateToDisk();
     bool saveNodeDatabaseToDisk();
+
+    /// Bytes currently in nodeJournalFileName, once this grows too big the next journal write does a full save instead
+    size_t nodeJournalBytes = 0;
+
+    /// Append one record (NODE_JOURNAL_*) for node to the node journal
+    bool appendNodeJournal(uint8_t type, const meshtastic_NodeInfoLite &node);
+
+    /// Replay the node journal on top of the nodes just loaded from nodes.proto
+    void loadNodeJournal();
+
+    /// Rebuild nodeOrder from scratch, must be called whenever entries in meshNodes move around
     void sortMeshDB();
 };
 
@@ -352,6 +512,16 @@ extern meshtastic_CriticalErrorCode error_code;
 extern uint32_t error_address;
 #define NODEINFO_BITFIELD_IS_KEY_MANUALLY_VERIFIED_SHIFT 0
 #define NODEINFO_BITFIELD_IS_KEY_MANUALLY_VERIFIED_MASK (1 << NODEINFO_BITFIELD_IS_KEY_MANUALLY_VERIFIED_SHIFT)
+#define NODEINFO_BITFIELD_READS_COMPRESSED_TEXT_SHIFT 1 // Its NodeInfo says it decompresses text, see TextCompression
+#define NODEINFO_BITFIELD_READS_COMPRESSED_TEXT_MASK (1 << NODEINFO_BITFIELD_READS_COMPRESSED_TEXT_SHIFT)
+#define NODEINFO_BITFIELD_READS_AGGREGATES_SHIFT 2 // Its NodeInfo says it takes aggregate frames apart, see FrameAggregation
+#define NODEINFO_BITFIELD_READS_AGGREGATES_MASK (1 << NODEINFO_BITFIELD_READS_AGGREGATES_SHIFT)
+#define NODEINFO_BITFIELD_READS_MULTI_ACK_SHIFT 3 // Its NodeInfo says it understands multi-ACKs, see ReliableRouter
+#define NODEINFO_BITFIELD_READS_MULTI_ACK_MASK (1 << NODEINFO_BITFIELD_READS_MULTI_ACK_SHIFT)
+#define NODEINFO_BITFIELD_READS_LINK_RATE_SHIFT 4 // Its NodeInfo says it can do link rate windows, see LinkRate
+#define NODEINFO_BITFIELD_READS_LINK_RATE_MASK (1 << NODEINFO_BITFIELD_READS_LINK_RATE_SHIFT)
+#define NODEINFO_BITFIELD_READS_FEC_SHIFT 5 // Its NodeInfo says it takes parity off frames, see ForwardErrorCorrection
+#define NODEINFO_BITFIELD_READS_FEC_MASK (1 << NODEINFO_BITFIELD_READS_FEC_SHIFT)
 
 #define Module_Config_size                                                                                                       \
     (ModuleConfig_CannedMessageConfig_size + ModuleConfig_ExternalNotificationConfig_size + ModuleConfig_MQTTConfig_size +       \
@@ -0,0 +1,93 @@
+#include "NodeRecency.h"
+#include <algorithm>
+
+void NodeRecency::reset(size_t capacity)
+{
+    links.assign(capacity, Link{END, END, NONE, 0});
+    for (int s = 0; s < 3; s++) {
+        head[s] = tail[s] = END;
+        count[s] = 0;
+    }
+    protectedMax = capacity * NODEDB_PROTECTED_PERCENT / 100;
+}
+
+void NodeRecency::rebuild(const uint32_t *lastHeard, size_t n)
+{
+    reset(links.size());
+    std::vector<uint16_t> order(n);
+    for (size_t x = 0; x < n; x++)
+        order[x] = x;
+    std::stable_sort(order.begin(), order.end(), [lastHeard](uint16_t a, uint16_t b) { return lastHeard[a] < lastHeard[b]; });
+
+    // Oldest first, so each push leaves the most recently heard at the head
+    size_t probation = n > protectedMax ? n - protectedMax : 0;
+    for (size_t i = 0; i < n; i++)
+        pushHead(order[i], i < probation ? PROBATION : PROTECTED);
+}
+
+void NodeRecency::add(uint16_t x, uint32_t nowSecs)
+{
+    if (x >= links.size())
+        return;
+    if (links[x].segment != NONE)
+        unlink(x);
+    links[x].since = nowSecs;
+    pushHead(x, PROBATION);
+}
+
+void NodeRecency::heard(uint16_t x, uint32_t nowSecs)
+{
+    if (x >= links.size() || links[x].segment == NONE)
+        return;
+
+    Segment s = (Segment)links[x].segment;
+    if (s == PROBATION && nowSecs - links[x].since >= NODEDB_PROBATION_SECS) {
+        s = PROTECTED;
+        // Make room by sending the protected node heard longest ago back to probation, where it starts over
+        if (count[PROTECTED] >= protectedMax && tail[PROTECTED] != END) {
+            uint16_t demoted = tail[PROTECTED];
+            unlink(demoted);
+            links[demoted].since = nowSecs;
+            pushHead(demoted, PROBATION);
+        }
+    }
+    unlink(x);
+    pushHead(x, s);
+}
+
+void NodeRecency::remove(uint16_t x)
+{
+    if (x < links.size() && links[x].segment != NONE)
+        unlink(x);
+}
+
+void NodeRecency::pushHead(uint16_t x, Segment s)
+{
+    Link &l = links[x];
+    l.segment = s;
+    l.prev = END;
+    l.next = head[s];
+    if (head[s] != END)
+        links[head[s]].prev = x;
+    else
+        tail[s] = x;
+    head[s] = x;
+    count[s]++;
+}
+
+void NodeRecency::unlink(uint16_t x)
+{
+    Link &l = links[x];
+    Segment s = (Segment)l.segment;
+    if (l.prev != END)
+        links[l.prev].next = l.next;
+    else
+        head[s] = l.next;
+    if (l.next != END)
+        links[l.next].prev = l.prev;
+    else
+        tail[s] = l.prev;
+    count[s]--;
+    l.prev = l.next = END;
+    l.segment = NONE;
+}
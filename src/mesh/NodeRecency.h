@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// Share of the node DB the protected segment may fill, in percent.  The rest is left to probationers
+#ifndef NODEDB_PROTECTED_PERCENT
+#define NODEDB_PROTECTED_PERCENT 75
+#endif
+
+// A new node has to be heard again at least this long after it first was to leave probation, so a burst of packets
+// from a one-off sender (an MQTT neighbour replaying its nodeinfo, position and telemetry at once) doesn't count
+#ifndef NODEDB_PROBATION_SECS
+#define NODEDB_PROBATION_SECS 600
+#endif
+
+/**
+ * Which NodeDB entry to give up when the DB is full, along the lines of 2Q: nodes we have heard just once wait in a
+ * probation segment, and only move on to the protected segment once they are heard again later.  Both are lists with the
+ * most recently heard at the head, and eviction takes from the tail of probation first.  So a stream of nodes heard once
+ * displaces each other rather than the neighbours we hear all the time.
+ *
+ * Entries are meshNodes indexes, linked through arrays of the same size, so adding, hearing and evicting a node never
+ * scan the DB.
+ */
+class NodeRecency
+{
+  public:
+    enum Segment : uint8_t { NONE, PROBATION, PROTECTED };
+
+    /// Forget every node, and size for capacity of them
+    void reset(size_t capacity);
+
+    /// Start again from the n nodes in meshNodes, heard at lastHeard[x].  We don't know how often they were heard, so the
+    /// most recently heard get protected up to its limit, and the rest are on probation.
+    void rebuild(const uint32_t *lastHeard, size_t n);
+
+    /// x is a node we have just heard of for the first time
+    void add(uint16_t x, uint32_t nowSecs);
+
+    /// We heard x again
+    void heard(uint16_t x, uint32_t nowSecs);
+
+    /// x is no longer in use
+    void remove(uint16_t x);
+
+    /// The least valuable node that eligible(x) allows us to drop, -1 if none.  Starts from the tail of probation, so
+    /// normally the first node looked at is the one to go.
+    template <typename F> int victim(F eligible) const
+    {
+        for (Segment s : {PROBATION, PROTECTED})
+            for (uint16_t x = tail[s]; x != END; x = links[x].prev)
+                if (eligible(x))
+                    return x;
+        return -1;
+    }
+
+    Segment segmentOf(uint16_t x) const { return x < links.size() ? (Segment)links[x].segment : NONE; }
+    size_t size(Segment s) const { return count[s]; }
+
+  private:
+    enum : uint16_t { END = 0xFFFF };
+
+    struct Link {
+        uint16_t prev; // Towards the head, which is the most recently heard
+        uint16_t next;
+        uint8_t segment;
+        uint32_t since; // When it went on probation, in seconds
+    };
+
+    std::vector<Link> links; // By meshNodes index
+    uint16_t head[3] = {END, END, END};
+    uint16_t tail[3] = {END, END, END};
+    size_t count[3] = {};
+    size_t protectedMax = 0;
+
+    void pushHead(uint16_t x, Segment s);
+    void unlink(uint16_t x);
+};
@@ -0,0 +1,104 @@
+#include "NodeSpatialIndex.h"
+#include "gps/GeoCoord.h"
+#include <algorithm>
+
+static_assert(NODEDB_GRID_SHIFT >= 16 && NODEDB_GRID_SHIFT < 31, "A cell row or column number must fit in 16 bits");
+
+#define GRID_NO_CELL UINT32_MAX
+#define GRID_MAX_LAT 900000000
+#define GRID_MAX_LON 1800000000
+#define GRID_METERS_PER_DEG_I (6366000.0 * (PI / 180) * 1e-7) // Same earth radius as GeoCoord::latLongToMeter()
+
+// Rows and columns are offset so cell numbers sort the same way as the (signed) rows and columns do
+static inline uint32_t cellAt(int32_t row, int32_t col)
+{
+    return ((uint32_t)(row + 0x8000) << 16) | (uint16_t)(col + 0x8000);
+}
+
+uint32_t NodeSpatialIndex::cellFor(int32_t latitude_i, int32_t longitude_i)
+{
+    return cellAt(latitude_i >> NODEDB_GRID_SHIFT, longitude_i >> NODEDB_GRID_SHIFT);
+}
+
+void NodeSpatialIndex::clear()
+{
+    entries.clear();
+    std::fill(cellOf.begin(), cellOf.end(), GRID_NO_CELL);
+}
+
+void NodeSpatialIndex::update(uint16_t x, bool valid, int32_t latitude_i, int32_t longitude_i)
+{
+    if (x >= cellOf.size())
+        cellOf.resize(x + 1, GRID_NO_CELL);
+
+    uint32_t cell = valid ? cellFor(latitude_i, longitude_i) : GRID_NO_CELL;
+    uint32_t old = cellOf[x];
+    if (cell == old)
+        return;
+
+    if (old != GRID_NO_CELL) {
+        auto it = std::lower_bound(entries.begin(), entries.end(), Entry{old, x});
+        if (it != entries.end() && it->cell == old && it->x == x)
+            entries.erase(it);
+    }
+    if (cell != GRID_NO_CELL) {
+        Entry e{cell, x};
+        entries.insert(std::lower_bound(entries.begin(), entries.end(), e), e);
+    }
+    cellOf[x] = cell;
+}
+
+void NodeSpatialIndex::appendRow(int32_t row, int32_t colLo, int32_t colHi, std::vector<uint16_t> &out) const
+{
+    uint32_t last = cellAt(row, colHi);
+    for (auto it = std::lower_bound(entries.begin(), entries.end(), Entry{cellAt(row, colLo), 0});
+         it != entries.end() && it->cell <= last; ++it)
+        out.push_back(it->x);
+}
+
+bool NodeSpatialIndex::candidates(int32_t latitude_i, int32_t longitude_i, float meters, std::vector<uint16_t> &out) const
+{
+    // Half the sides of a lat/lon box around the circle, a little larger for the rounding in the distance formulas
+    double dLat = meters * 1.01 / GRID_METERS_PER_DEG_I + 1;
+    double poleward = fabs((double)latitude_i) + dLat;
+    double dLon = poleward >= GRID_MAX_LAT ? 2.0 * GRID_MAX_LON : dLat / cos(poleward * 1e-7 * (PI / 180));
+
+    int64_t latLo = std::max((int64_t)latitude_i - (int64_t)dLat, (int64_t)-GRID_MAX_LAT);
+    int64_t latHi = std::min((int64_t)latitude_i + (int64_t)dLat, (int64_t)GRID_MAX_LAT);
+    int32_t rowLo = (int32_t)latLo >> NODEDB_GRID_SHIFT, rowHi = (int32_t)latHi >> NODEDB_GRID_SHIFT;
+
+    // Up to two ranges of columns, when the box wraps round the antimeridian
+    int32_t colLo[2], colHi[2];
+    int ranges = 1;
+    if (dLon >= GRID_MAX_LON) {
+        colLo[0] = -GRID_MAX_LON >> NODEDB_GRID_SHIFT;
+        colHi[0] = GRID_MAX_LON >> NODEDB_GRID_SHIFT;
+    } else {
+        int64_t lonLo = (int64_t)longitude_i - (int64_t)dLon, lonHi = (int64_t)longitude_i + (int64_t)dLon;
+        if (lonLo < -GRID_MAX_LON) {
+            colLo[1] = (int32_t)(lonLo + 2LL * GRID_MAX_LON) >> NODEDB_GRID_SHIFT;
+            colHi[1] = GRID_MAX_LON >> NODEDB_GRID_SHIFT;
+            lonLo = -GRID_MAX_LON;
+            ranges = 2;
+        } else if (lonHi > GRID_MAX_LON) {
+            colLo[1] = -GRID_MAX_LON >> NODEDB_GRID_SHIFT;
+            colHi[1] = (int32_t)(lonHi - 2LL * GRID_MAX_LON) >> NODEDB_GRID_SHIFT;
+            lonHi = GRID_MAX_LON;
+            ranges = 2;
+        }
+        colLo[0] = (int32_t)lonLo >> NODEDB_GRID_SHIFT;
+        colHi[0] = (int32_t)lonHi >> NODEDB_GRID_SHIFT;
+    }
+
+    // Each row of each range costs a binary search, past a point walking every entry is cheaper
+    if ((size_t)(rowHi - rowLo + 1) * ranges * 8 >= entries.size()) {
+        for (const Entry &e : entries)
+            out.push_back(e.x);
+        return true;
+    }
+
+    for (int32_t row = rowLo; row <= rowHi; row++)
+        for (int r = 0; r < ranges; r++)
+            appendRow(row, colLo[r], colHi[r], out);
+    return false;
+}
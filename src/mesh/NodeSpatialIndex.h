@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#ifndef NODEDB_GRID_SHIFT
+#define NODEDB_GRID_SHIFT 20 // Grid cells are 2^this 1e-7 degrees on a side, 20 is about 12 km of latitude
+#endif
+
+/**
+ * A grid over latitude and longitude telling which NodeDB entries have a position near a given point, so "which nodes
+ * are near X" only has to measure the few nodes in the cells around X instead of every node in the DB.
+ *
+ * Entries are kept sorted by cell, and cells are numbered row by row, so the cells of one row that a query covers are
+ * one run of entries found with a binary search.  Only the cell of each entry is known here: callers measure the
+ * candidates against the node's current position, so an entry whose cell is stale can't give a wrong answer, only miss.
+ */
+class NodeSpatialIndex
+{
+  public:
+    /// Forget every entry, e.g. before meshNodes entries move around
+    void clear();
+
+    /// File meshNodes[x] in the cell for lat/lon, or take it out of the grid if its position isn't valid
+    void update(uint16_t x, bool valid, int32_t latitude_i, int32_t longitude_i);
+
+    /// Append the meshNodes indexes of all entries in the cells within meters of lat/lon to out
+    /// When that would be more cells than there are entries, every entry is appended instead
+    /// @return true if every entry was appended
+    bool candidates(int32_t latitude_i, int32_t longitude_i, float meters, std::vector<uint16_t> &out) const;
+
+    size_t size() const { return entries.size(); }
+
+  private:
+    struct Entry {
+        uint32_t cell;
+        uint16_t x;
+        bool operator<(const Entry &o) const { return cell < o.cell || (cell == o.cell && x < o.x); }
+    };
+
+    std::vector<Entry> entries;    // Sorted
+    std::vector<uint32_t> cellOf;  // By meshNodes index, UINT32_MAX if not in the grid
+
+    static uint32_t cellFor(int32_t latitude_i, int32_t longitude_i);
+
+    /// Append the entries in columns colLo..colHi of row to out
+    void appendRow(int32_t row, int32_t colLo, int32_t colHi, std::vector<uint16_t> &out) const;
+};
@@ -23,15 +23,24 @@ PacketHistory::PacketHistory(uint32_t size) : recentPacketsCapacity(0), recentPa
         size = PACKETHISTORY_MAX; // Use default size if invalid
     }
 
-    // Allocate memory for the recent packets array
-    recentPacketsCapacity = size;
-    recentPackets = new PacketRecord[recentPacketsCapacity];
-    if (!recentPackets) { // No logging here, console/log probably uninitialized yet.
+    // Round up to whole buckets
+    numBuckets = (size + PACKETHISTORY_WAYS - 1) / PACKETHISTORY_WAYS;
+    size = numBuckets * PACKETHISTORY_WAYS;
+
+    // Allocate memory for the recent packets array, with some slack so each bucket can start on a cache line
+    const uint32_t slack = PACKETHISTORY_BUCKET_BYTES / sizeof(PacketRecord) - 1;
+    recentPacketsAlloc = new PacketRecord[size + slack];
+    if (!recentPacketsAlloc) { // No logging here, console/log probably uninitialized yet.
         LOG_ERROR("Packet History - Memory allocation failed for size=%d entries / %d Bytes", size,
-                  sizeof(PacketRecord) * recentPacketsCapacity);
-        recentPacketsCapacity = 0; // mark allocation fail
-        return;                    // return early
+                  sizeof(PacketRecord) * (size + slack));
+        numBuckets = 0;
+        return; // return early
     }
+    static_assert(sizeof(PacketRecord) * PACKETHISTORY_WAYS == PACKETHISTORY_BUCKET_BYTES, "PacketRecord must stay 16 bytes");
+    uintptr_t aligned =
+        ((uintptr_t)recentPacketsAlloc + PACKETHISTORY_BUCKET_BYTES - 1) & ~(uintptr_t)(PACKETHISTORY_BUCKET_BYTES - 1);
+    recentPackets = (PacketRecord *)aligned;
+    recentPacketsCapacity = size;
 
     // Initialize the recent packets array to zero
     memset(recentPackets, 0, sizeof(PacketRecord) * recentPacketsCapacity);
@@ -40,10 +49,20 @@ PacketHistory::PacketHistory(uint32_t size) : recentPacketsCapacity(0), recentPa
 PacketHistory::~PacketHistory()
 {
     recentPacketsCapacity = 0;
-    delete[] recentPackets;
+    numBuckets = 0;
+    delete[] recentPacketsAlloc;
+    recentPacketsAlloc = NULL;
     recentPackets = NULL;
 }
 
+PacketHistory::PacketRecord *PacketHistory::bucketFor(NodeNum sender, PacketId id)
+{
+    // Packet ids are mostly sequential per sender, so mix both before picking a bucket
+    uint32_t h = (sender * 0x9E3779B1u) ^ (id * 0x85EBCA77u);
+    h ^= h >> 15;
+    return recentPackets + (h % numBuckets) * PACKETHISTORY_WAYS;
+}
+
 /** Update recentPackets and return true if we have already seen this packet */
 bool PacketHistory::wasSeenRecently(const meshtastic_MeshPacket *p, bool withUpdate, bool *wasFallback, bool *weWereNextHop)
 {
@@ -161,8 +180,9 @@ PacketHistory::PacketRecord *PacketHistory::find(NodeNum sender, PacketId id)
         return NULL;
     }
 
-    PacketRecord *it = NULL;
-    for (it = recentPackets; it < (recentPackets + recentPacketsCapacity); ++it) {
+    // A record can only ever live in the bucket it hashes to, so that is all we need to look at
+    PacketRecord *bucket = bucketFor(sender, id);
+    for (PacketRecord *it = bucket; it < bucket + PACKETHISTORY_WAYS; ++it) {
         if (it->id == id && it->sender == sender) {
 #if VERBOSE_PACKET_HISTORY
             LOG_DEBUG("Packet History - find: s=%08x id=%08x FOUND nh=%02x rby=%02x %02x %02x age=%d slot=%d/%d", it->sender,
@@ -180,23 +200,22 @@ PacketHistory::PacketRecord *PacketHistory::find(NodeNum sender, PacketId id)
     return NULL; // Not found
 }
 
-/** Insert/Replace oldest PacketRecord in recentPackets. */
+/** Insert/Replace oldest PacketRecord in the bucket of r. */
 void PacketHistory::insert(const PacketRecord &r)
 {
     uint32_t now_millis = millis(); // Should not jump with time changes
     uint32_t OldtrxTimeMsec = 0;
     PacketRecord *tu = NULL; // Will insert here.
-    PacketRecord *it = NULL;
+    PacketRecord *bucket = bucketFor(r.sender, r.id);
 
-    // Find a free, matching or oldest used slot in the recentPackets array
-    for (it = recentPackets; it < (recentPackets + recentPacketsCapacity); ++it) {
+    // Find a free, matching or oldest used slot in this bucket
+    for (PacketRecord *it = bucket; it < bucket + PACKETHISTORY_WAYS; ++it) {
         if (it->id == 0 && it->sender == 0 /*&& rxTimeMsec == 0*/) { // Record is empty
             tu = it;                                                 // Remember the free slot
 #if VERBOSE_PACKET_HISTORY >= 2
             LOG_DEBUG("Packet History - insert: Free slot@ %d/%d", tu - recentPackets, recentPacketsCapacity);
 #endif
-            // We have that, Exit the loop
-            it = (recentPackets + recentPacketsCapacity);
+            break;
         } else if (it->id == r.id && it->sender == r.sender) { // Record matches the packet we want to insert
             tu = it;                                           // Remember the matching slot
             OldtrxTimeMsec = now_millis - it->rxTimeMsec;      // ..and save current entry's age
@@ -204,15 +223,15 @@ void PacketHistory::insert(const PacketRecord &r)
             LOG_DEBUG("Packet History - insert: Matched slot@ %d/%d age=%d", tu - recentPackets, recentPacketsCapacity,
                       OldtrxTimeMsec);
 #endif
-            // We have that, Exit the loop
-            it = (recentPackets + recentPacketsCapacity);
+            break;
         } else {
             if (it->rxTimeMsec == 0) {
                 LOG_WARN(
                     "Packet History - insert: Found packet s=%08x id=%08x with rxTimeMsec = 0, slot %d/%d. Should never happen!",
                     it->sender, it->id, it - recentPackets, recentPacketsCapacity);
             }
-            if ((now_millis - it->rxTimeMsec) > OldtrxTimeMsec) { // 49.7 days rollover friendly
+            // Evict whichever slot of this bucket went longest without being refreshed
+            if (tu == NULL || (now_millis - it->rxTimeMsec) > OldtrxTimeMsec) { // 49.7 days rollover friendly
                 OldtrxTimeMsec = now_millis - it->rxTimeMsec;
                 tu = it; // remember the oldest packet
 #if VERBOSE_PACKET_HISTORY >= 2
@@ -220,7 +239,7 @@ void PacketHistory::insert(const PacketRecord &r)
                           OldtrxTimeMsec);
 #endif
             }
-            // keep looking for oldest till entire array is checked
+            // keep looking for a free or matching slot till the whole bucket is checked
         }
     }
 
@@ -292,6 +311,55 @@ void PacketHistory::insert(const PacketRecord &r)
 #endif
 }
 
+uint32_t PacketHistory::saveSnapshot(Print &out, uint32_t maxAgeMsec)
+{
+    uint32_t now = millis();
+    uint32_t count = 0;
+    for (uint32_t i = 0; initOk() && i < recentPacketsCapacity; i++) {
+        const PacketRecord &r = recentPackets[i];
+        if (r.rxTimeMsec && now - r.rxTimeMsec < maxAgeMsec)
+            count++;
+    }
+
+    out.write((const uint8_t *)&count, sizeof(count));
+    // Same filter as above, so exactly count records follow
+    uint32_t written = 0;
+    for (uint32_t i = 0; initOk() && i < recentPacketsCapacity && written < count; i++) {
+        PacketRecord r = recentPackets[i];
+        if (!r.rxTimeMsec || now - r.rxTimeMsec >= maxAgeMsec)
+            continue;
+        r.rxTimeMsec = now - r.rxTimeMsec;
+        out.write((const uint8_t *)&r, sizeof(r));
+        written++;
+    }
+    return written;
+}
+
+int32_t PacketHistory::restoreSnapshot(Stream &in, uint32_t extraAgeMsec, uint32_t maxAgeMsec)
+{
+    uint32_t count;
+    if (!initOk() || in.readBytes((char *)&count, sizeof(count)) != sizeof(count))
+        return -1;
+
+    uint32_t now = millis();
+    int32_t restored = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        PacketRecord r;
+        if (in.readBytes((char *)&r, sizeof(r)) != sizeof(r))
+            return -1;
+        uint32_t age = r.rxTimeMsec + extraAgeMsec;
+        if (age >= maxAgeMsec || r.sender == 0 || r.id == 0 || find(r.sender, r.id))
+            continue;
+        // We haven't been up as long as the record is old, so this may wrap, which the age math elsewhere is fine with
+        r.rxTimeMsec = now - age;
+        if (r.rxTimeMsec == 0)
+            r.rxTimeMsec = 1;
+        insert(r);
+        restored++;
+    }
+    return restored;
+}
+
 /* Check if a certain node was a relayer of a packet in the history given an ID and sender
  * @return true if node was indeed a relayer, false if not */
 bool PacketHistory::wasRelayer(const uint8_t relayer, const uint32_t id, const NodeNum sender)
@@ -5,6 +5,9 @@
 #define NUM_RELAYERS                                                                                                             \
     3 // Number of relayer we keep track of. Use 3 to be efficient with memory alignment of PacketRecord to 16 bytes
 
+#define PACKETHISTORY_WAYS 4 // Records per hash bucket. 4 x 16B records = one 64B cache line
+#define PACKETHISTORY_BUCKET_BYTES (PACKETHISTORY_WAYS * 16)
+
 /**
  * This is a mixin that adds a record of past packets we have seen
  */
@@ -21,7 +24,12 @@ class PacketHistory
 
     uint32_t recentPacketsCapacity =
         0; // Can be set in constructor, no need to recompile. Used to allocate memory for mx_recentPackets.
-    PacketRecord *recentPackets = NULL; // Simple and fixed in size. Debloat.
+    PacketRecord *recentPackets = NULL; // Simple and fixed in size. Debloat. Aligned to PACKETHISTORY_BUCKET_BYTES.
+    PacketRecord *recentPacketsAlloc = NULL; // What we actually got from new[], recentPackets points inside it
+    uint32_t numBuckets = 0; // recentPackets is split in buckets of PACKETHISTORY_WAYS records, picked by hashing (sender, id)
+
+    /** @return the first record of the bucket that (sender, id) hashes to */
+    PacketRecord *bucketFor(NodeNum sender, PacketId id);
 
     /** Find a packet record in history.
      * @param sender NodeNum
@@ -29,7 +37,7 @@ class PacketHistory
      * @return pointer to PacketRecord if found, NULL if not found */
     PacketRecord *find(NodeNum sender, PacketId id);
 
-    /** Insert/Replace oldest PacketRecord in mx_recentPackets.
+    /** Insert/Replace oldest PacketRecord in the bucket r belongs to.
      * @param r PacketRecord to insert or replace */
     void insert(const PacketRecord &r); // Insert or replace a packet record in the history
 
@@ -62,4 +70,14 @@ class PacketHistory
 
     // To check if the PacketHistory was initialized correctly by constructor
     bool initOk(void) { return recentPackets != NULL && recentPacketsCapacity != 0; }
+
+    /** Write a count followed by every record younger than maxAgeMsec, with its age in place of the receive time, so a
+     * restart doesn't forget what we already relayed.
+     * @return the number of records written */
+    uint32_t saveSnapshot(Print &out, uint32_t maxAgeMsec);
+
+    /** Read back what saveSnapshot() wrote, treating every record as extraAgeMsec older (time we were down), and skipping
+     * those that are then older than maxAgeMsec.
+     * @return the number of records restored, or -1 if the snapshot was unreadable */
+    int32_t restoreSnapshot(Stream &in, uint32_t extraAgeMsec, uint32_t maxAgeMsec);
 };
@@ -0,0 +1,97 @@
+#include "PacketLatency.h"
+#include "configuration.h"
+
+PacketLatency packetLatency;
+
+struct SpanDef {
+    PacketStage from, to;
+    const char *name;
+};
+
+// Indexed by PacketLatency::Span
+static const SpanDef spans[PacketLatency::SPAN_COUNT] = {
+    {PACKET_STAGE_RADIO_RX, PACKET_STAGE_ROUTER_QUEUED, "handoff"},
+    {PACKET_STAGE_ROUTER_QUEUED, PACKET_STAGE_ROUTER_HANDLED, "router_queue"},
+    {PACKET_STAGE_ROUTER_HANDLED, PACKET_STAGE_DECODED, "decode"},
+    {PACKET_STAGE_DECODED, PACKET_STAGE_MODULES_DONE, "modules"},
+    {PACKET_STAGE_RADIO_RX, PACKET_STAGE_TX_QUEUED, "relay_decision"},
+    {PACKET_STAGE_TX_QUEUED, PACKET_STAGE_TX_STARTED, "contention"},
+};
+
+const char *PacketLatency::getSpanName(Span span)
+{
+    return spans[span].name;
+}
+
+void PacketLatency::mark(PacketStage stage, NodeNum from, PacketId id)
+{
+    if (id == 0)
+        return; // Not unique, we couldn't tell packets apart
+
+    uint32_t now = micros();
+    InFlight *f = NULL;
+    for (InFlight &candidate : inFlight) {
+        if (candidate.seen && candidate.from == from && candidate.id == id) {
+            f = &candidate;
+            break;
+        }
+    }
+
+    if (stage == PACKET_STAGE_RADIO_RX) {
+        // A new reception, even if it is a dupe of one we follow
+        if (!f) {
+            f = &inFlight[nextInFlight];
+            nextInFlight = (nextInFlight + 1) % PACKET_LATENCY_INFLIGHT;
+        }
+        f->from = from;
+        f->id = id;
+        f->seen = 0;
+    } else if (!f || (f->seen & (1 << stage))) {
+        return; // Not one of ours, or only the first pass through a stage counts
+    }
+
+    f->micros[stage] = now;
+    f->seen |= 1 << stage;
+
+    for (int s = 0; s < SPAN_COUNT; s++) {
+        if (spans[s].to == stage && (f->seen & (1 << spans[s].from)))
+            record((Span)s, now - f->micros[spans[s].from]);
+    }
+}
+
+void PacketLatency::record(Span span, uint32_t us)
+{
+    Histogram &h = histograms[span];
+    h.count++;
+    h.totalMicros += us;
+    if (us > h.maxMicros)
+        h.maxMicros = us;
+
+    uint8_t bucket = 0;
+    for (uint32_t v = us >> 6; v && bucket < PACKET_LATENCY_BUCKETS - 1; v >>= 1)
+        bucket++;
+    if (h.buckets[bucket] < UINT16_MAX)
+        h.buckets[bucket]++;
+}
+
+void PacketLatency::logHistograms() const
+{
+    for (int s = 0; s < SPAN_COUNT; s++) {
+        const Histogram &h = histograms[s];
+        if (!h.count)
+            continue;
+
+        char buckets[PACKET_LATENCY_BUCKETS * 12 + 1] = "";
+        size_t len = 0;
+        for (int b = 0; b < PACKET_LATENCY_BUCKETS && len < sizeof(buckets); b++) {
+            if (!h.buckets[b])
+                continue;
+            if (b == PACKET_LATENCY_BUCKETS - 1) // The catch-all
+                len += snprintf(buckets + len, sizeof(buckets) - len, " >=%luus:%u", 32UL << b, h.buckets[b]);
+            else
+                len += snprintf(buckets + len, sizeof(buckets) - len, " <%luus:%u", 64UL << b, h.buckets[b]);
+        }
+        LOG_INFO("latency %s: n=%u mean=%uus max=%uus%s", spans[s].name, h.count, (uint32_t)(h.totalMicros / h.count),
+                 h.maxMicros, buckets);
+    }
+}
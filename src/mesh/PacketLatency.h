@@ -0,0 +1,65 @@
+#pragma once
+
+#include "MeshTypes.h"
+
+/**
+ * Where a received packet is in our RX -> TX pipeline
+ */
+enum PacketStage {
+    PACKET_STAGE_RADIO_RX,       // Drained from the radio FIFO
+    PACKET_STAGE_ROUTER_QUEUED,  // Handed to the router's receive queue
+    PACKET_STAGE_ROUTER_HANDLED, // Pulled off that queue by the router thread
+    PACKET_STAGE_DECODED,        // Decryption attempted (or deliberately skipped)
+    PACKET_STAGE_MODULES_DONE,   // All modules had their look at it
+    PACKET_STAGE_TX_QUEUED,      // A relay of it entered the TX queue
+    PACKET_STAGE_TX_STARTED,     // That relay went on air
+    PACKET_STAGE_COUNT
+};
+
+#define PACKET_LATENCY_INFLIGHT 8 // Packets we follow through the pipeline at once
+#define PACKET_LATENCY_BUCKETS 16 // Log2 histogram buckets, the first is < 64us and the last is >= ~1s
+
+/**
+ * Lightweight per-stage latency histograms.  A small side table timestamps the most recent received packets as they pass
+ * each stage, and the time between selected stages is binned, so we can tell queueing delay from CPU time from channel
+ * contention.  Everything runs on our cooperative threads, so nothing here needs locking.
+ */
+class PacketLatency
+{
+  public:
+    /** The spans we keep a histogram for */
+    enum Span { SPAN_HANDOFF, SPAN_ROUTER_QUEUE, SPAN_DECODE, SPAN_MODULES, SPAN_RELAY_DECISION, SPAN_CONTENTION, SPAN_COUNT };
+
+    struct Histogram {
+        uint32_t count;
+        uint32_t maxMicros;
+        uint64_t totalMicros;
+        uint16_t buckets[PACKET_LATENCY_BUCKETS];
+    };
+
+    /** Timestamp packet (from, id) reaching stage.  PACKET_STAGE_RADIO_RX starts following a packet, other stages of
+     * packets we don't follow are ignored. */
+    void mark(PacketStage stage, NodeNum from, PacketId id);
+
+    const Histogram &getHistogram(Span span) const { return histograms[span]; }
+    static const char *getSpanName(Span span);
+
+    /** Write a line per span with its count, mean, max and the non-empty buckets */
+    void logHistograms() const;
+
+  private:
+    struct InFlight {
+        NodeNum from;
+        PacketId id;
+        uint8_t seen; // bitmask of PacketStage
+        uint32_t micros[PACKET_STAGE_COUNT];
+    };
+
+    InFlight inFlight[PACKET_LATENCY_INFLIGHT] = {};
+    uint8_t nextInFlight = 0;
+    Histogram histograms[SPAN_COUNT] = {};
+
+    void record(Span span, uint32_t micros);
+};
+
+extern PacketLatency packetLatency;
@@ -28,16 +28,26 @@
 #if !MESHTASTIC_EXCLUDE_MQTT
 #include "mqtt/MQTT.h"
 #endif
+#if !MESHTASTIC_EXCLUDE_ATAK
+#include "modules/AtakPluginModule.h"
+#endif
 #include "Throttle.h"
 #include <RTC.h>
 
 // Flag to indicate a heartbeat was received and we should send queue status
 bool heartbeatReceived = false;
 
+// Recently completed config downloads, shared by all our API links because a phone may come back over a different one
+struct CompletedConfig {
+    uint32_t nonce;
+    uint32_t seq; // 0 if unused
+};
+static CompletedConfig completedConfigs[CONFIG_RESUME_SLOTS];
+static uint8_t nextCompletedConfig;
+
 PhoneAPI::PhoneAPI()
 {
     lastContactMsec = millis();
-    std::fill(std::begin(recentToRadioPacketIds), std::end(recentToRadioPacketIds), 0);
 }
 
 PhoneAPI::~PhoneAPI()
@@ -65,16 +75,55 @@ void PhoneAPI::handleStartConfig()
         state = STATE_SEND_MY_INFO;
     }
     pauseBluetoothLogging = true;
-    spiLock->lock();
-    filesManifest = getFiles("/", 10);
-    spiLock->unlock();
+    if (config_nonce == SPECIAL_NONCE_NO_FILES || config_nonce == SPECIAL_NONCE_ONLY_NODES) {
+        filesManifest.clear();
+    } else {
+        // Only walks the filesystem when something was written since the last client connected
+        spiLock->lock();
+        filesManifest = getFileManifest();
+        spiLock->unlock();
+    }
     LOG_DEBUG("Got %d files in manifest", filesManifest.size());
 
-    LOG_INFO("Start API client config");
+    configStartSeq = nodeDB->getChangeSeq();
+    resumeFromSeq = findResumeSeq(config_nonce);
+    if (resumeFromSeq)
+        LOG_INFO("Start API client config, resuming node changes after %u", resumeFromSeq);
+    else
+        LOG_INFO("Start API client config");
     nodeInfoForPhone.num = 0; // Don't keep returning old nodeinfos
     resetReadIndex();
 }
 
+uint32_t PhoneAPI::findResumeSeq(uint32_t nonce)
+{
+    uint32_t previous = nonce ^ CONFIG_RESUME_NONCE_XOR;
+    for (const CompletedConfig &c : completedConfigs) {
+        if (c.seq && c.nonce == previous) {
+            if (nodeDB->nodesRemovedSince(c.seq)) {
+                LOG_INFO("Nodes were removed since config %u, send them all", previous);
+                return 0;
+            }
+            return c.seq;
+        }
+    }
+    return 0;
+}
+
+void PhoneAPI::rememberCompletedConfig(uint32_t nonce, uint32_t seq)
+{
+    if (nonce == SPECIAL_NONCE_ONLY_CONFIG || seq == 0)
+        return; // No nodes were sent, or there was nothing to resume from anyway
+
+    // Resuming from one download supersedes it
+    for (CompletedConfig &c : completedConfigs) {
+        if (c.seq && c.nonce == (nonce ^ CONFIG_RESUME_NONCE_XOR))
+            c.seq = 0;
+    }
+    completedConfigs[nextCompletedConfig] = {nonce, seq};
+    nextCompletedConfig = (nextCompletedConfig + 1) % CONFIG_RESUME_SLOTS;
+}
+
 void PhoneAPI::close()
 {
     LOG_DEBUG("PhoneAPI::close()");
@@ -97,8 +146,11 @@ void PhoneAPI::close()
         packetForPhone = NULL;
         filesManifest.clear();
         fromRadioNum = 0;
+        clientFrames = false;
         config_nonce = 0;
         config_state = 0;
+        configStartSeq = 0;
+        resumeFromSeq = 0;
         pauseBluetoothLogging = false;
     }
 }
@@ -116,10 +168,31 @@ bool PhoneAPI::checkConnectionTimeout()
     return false;
 }
 
+bool PhoneAPI::handleToRadio(const uint8_t *buf, size_t bufLength)
+{
+    if (bufLength < TORADIO_FRAME_HEADER_LEN || buf[0] != TORADIO_FRAME_START1 || buf[1] != TORADIO_FRAME_START2)
+        return handleToRadioMessage(buf, bufLength);
+
+    // A batch, so a client sending many things at once needn't wait for a round trip through the transport for each
+    clientFrames = true;
+    bool queued = false;
+    const uint8_t *end = buf + bufLength;
+    while ((size_t)(end - buf) >= TORADIO_FRAME_HEADER_LEN && buf[0] == TORADIO_FRAME_START1 && buf[1] == TORADIO_FRAME_START2) {
+        size_t len = (buf[2] << 8) | buf[3];
+        if (len > MAX_TO_FROM_RADIO_SIZE || (size_t)(end - buf) - TORADIO_FRAME_HEADER_LEN < len)
+            break;
+        queued |= handleToRadioMessage(buf + TORADIO_FRAME_HEADER_LEN, len);
+        buf += TORADIO_FRAME_HEADER_LEN + len;
+    }
+    if (buf != end)
+        LOG_ERROR("Error: ignore %u malformed bytes at the end of a toradio batch", (unsigned)(end - buf));
+    return queued;
+}
+
 /**
  * Handle a ToRadio protobuf
  */
-bool PhoneAPI::handleToRadio(const uint8_t *buf, size_t bufLength)
+bool PhoneAPI::handleToRadioMessage(const uint8_t *buf, size_t bufLength)
 {
     powerFSM.trigger(EVENT_CONTACT_FROM_PHONE); // As long as the phone keeps talking to us, don't let the radio go to sleep
     lastContactMsec = millis();
@@ -515,11 +588,54 @@ size_t PhoneAPI::getFromRadio(uint8_t *buf)
     return 0;
 }
 
+static size_t frameFromRadio(uint8_t *buf, size_t len)
+{
+    buf[0] = TORADIO_FRAME_START1;
+    buf[1] = TORADIO_FRAME_START2;
+    buf[2] = (len >> 8) & 0xff;
+    buf[3] = len & 0xff;
+    return len + TORADIO_FRAME_HEADER_LEN;
+}
+
+size_t PhoneAPI::getFromRadioBatch(uint8_t *buf, size_t bufSize)
+{
+    size_t len = getFromRadio(buf);
+    if (!clientFrames || len == 0 || len + TORADIO_FRAME_HEADER_LEN > bufSize ||
+        fromRadioScratch.which_payload_variant != meshtastic_FromRadio_mqttClientProxyMessage_tag)
+        return len;
+
+    memmove(buf + TORADIO_FRAME_HEADER_LEN, buf, len);
+    size_t used = frameFromRadio(buf, len);
+    size_t batched = 1;
+    // Queue status goes first, as getFromRadio() would send it
+    while (state == STATE_SEND_PACKETS && !heartbeatReceived && !queueStatusPacketForPhone) {
+        if (!mqttClientProxyMessageForPhone)
+            mqttClientProxyMessageForPhone = service->getMqttClientProxyMessageForPhone();
+        if (!mqttClientProxyMessageForPhone)
+            break;
+
+        memset(&fromRadioScratch, 0, sizeof(fromRadioScratch));
+        fromRadioScratch.which_payload_variant = meshtastic_FromRadio_mqttClientProxyMessage_tag;
+        fromRadioScratch.mqttClientProxyMessage = *mqttClientProxyMessageForPhone;
+        size_t next;
+        if (!pb_get_encoded_size(&next, &meshtastic_FromRadio_msg, &fromRadioScratch) ||
+            used + TORADIO_FRAME_HEADER_LEN + next > bufSize)
+            break; // It stays held for the next read
+        next = pb_encode_to_bytes(buf + used + TORADIO_FRAME_HEADER_LEN, next, &meshtastic_FromRadio_msg, &fromRadioScratch);
+        used += frameFromRadio(buf + used, next);
+        releaseMqttClientProxyPhonePacket();
+        batched++;
+    }
+    LOG_DEBUG("FromRadio batch of %u MQTT proxy messages, %u bytes", batched, used);
+    return used;
+}
+
 void PhoneAPI::sendConfigComplete()
 {
     LOG_INFO("Config Send Complete");
     fromRadioScratch.which_payload_variant = meshtastic_FromRadio_config_complete_id_tag;
     fromRadioScratch.config_complete_id = config_nonce;
+    rememberCompletedConfig(config_nonce, configStartSeq);
     config_nonce = 0;
     state = STATE_SEND_PACKETS;
     pauseBluetoothLogging = false;
@@ -579,6 +695,9 @@ bool PhoneAPI::available()
     case STATE_SEND_OTHER_NODEINFOS:
         if (nodeInfoForPhone.num == 0) {
             auto nextNode = nodeDB->readNextMeshNode(readIndex);
+            // When resuming, skip what the client already has
+            while (nextNode && resumeFromSeq && nodeDB->getNodeChangeSeq(nextNode->num) <= resumeFromSeq)
+                nextNode = nodeDB->readNextMeshNode(readIndex);
             if (nextNode) {
                 nodeInfoForPhone = TypeConversions::ConvertToNodeInfo(nextNode);
                 bool isUs = nodeInfoForPhone.num == nodeDB->getNodeNum();
@@ -619,7 +738,7 @@ bool PhoneAPI::available()
 #endif
 
         if (!packetForPhone)
-            packetForPhone = service->getForPhone();
+            packetForPhone = clientQueue ? clientQueue->dequeuePtr(0) : service->getForPhone();
         hasPacket = !!packetForPhone;
         return hasPacket;
     }
@@ -643,18 +762,25 @@ void PhoneAPI::sendNotification(meshtastic_LogRecord_Level level, uint32_t reply
 
 bool PhoneAPI::wasSeenRecently(uint32_t id)
 {
-    for (int i = 0; i < 20; i++) {
-        if (recentToRadioPacketIds[i] == id) {
+    auto bucketOf = [](uint32_t id) { return (id * 2654435761u) >> (32 - TORADIO_RECENT_BUCKET_BITS); };
+
+    uint8_t &bucket = recentIdBuckets[bucketOf(id)];
+    for (uint8_t i = bucket; i; i = recentIdChain[i - 1])
+        if (recentIds[i - 1] == id)
             return true;
-        }
-        if (recentToRadioPacketIds[i] == 0) {
-            recentToRadioPacketIds[i] = id;
-            return false;
-        }
+
+    // Take over the oldest slot, unchaining the id it held
+    uint8_t slot = recentIdNext;
+    if (recentIds[slot]) {
+        uint8_t *link = &recentIdBuckets[bucketOf(recentIds[slot])];
+        while (*link != slot + 1)
+            link = &recentIdChain[*link - 1];
+        *link = recentIdChain[slot];
     }
-    // If the array is full, shift all elements to the left and add the new id at the end
-    memmove(recentToRadioPacketIds, recentToRadioPacketIds + 1, (19) * sizeof(uint32_t));
-    recentToRadioPacketIds[19] = id;
+    recentIds[slot] = id;
+    recentIdChain[slot] = bucket;
+    bucket = slot + 1;
+    recentIdNext = (slot + 1) % TORADIO_RECENT_IDS;
     return false;
 }
 
@@ -707,6 +833,14 @@ bool PhoneAPI::handleToRadioPacket(meshtastic_MeshPacket &p)
         return false;
     }
     lastPortNumToRadio[p.decoded.portnum] = millis();
+#if !MESHTASTIC_EXCLUDE_ATAK
+    // ATAK sends PLIs far more often than a busy channel can carry, they are coalesced before they reach the mesh
+    if (p.decoded.portnum == meshtastic_PortNum_ATAK_PLUGIN && atakPluginModule && atakPluginModule->coalescePli(p)) {
+        meshtastic_QueueStatus qs = router->getQueueStatus();
+        service->sendQueueStatusToPhone(qs, 0, p.id);
+        return true;
+    }
+#endif
     service->handleToRadio(p);
     return true;
 }
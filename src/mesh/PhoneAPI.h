@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Observer.h"
+#include "PointerQueue.h"
 #include "mesh-pb-constants.h"
 #include "meshtastic/portnums.pb.h"
 #include <iterator>
@@ -18,8 +19,38 @@
 #error "meshtastic_ToRadio_size is too large for our BLE packets"
 #endif
 
+// A write to toradio (BLE characteristic or HTTP PUT) may carry several ToRadio, each framed as on the serial stream: 0x94
+// 0xc3 and a 16 bit big endian length.  No ToRadio starts with those two bytes, so a write without them is a single ToRadio.
+// Nor does any FromRadio, so a client that frames its writes gets reads framed the same way when getFromRadioBatch() packs
+// several into one.
+#define TORADIO_FRAME_START1 0x94
+#define TORADIO_FRAME_START2 0xc3
+#define TORADIO_FRAME_HEADER_LEN 4
+
+// Most bytes one HTTP PUT to toradio may carry, a BLE write is limited to MAX_TO_FROM_RADIO_SIZE by the characteristic
+#ifndef MAX_TO_RADIO_BATCH_SIZE
+#define MAX_TO_RADIO_BATCH_SIZE 4096
+#endif
+
+// How many MeshPacket ids from the phone we remember, so a packet it sends again (e.g. after reconnecting) goes out once
+#ifndef TORADIO_RECENT_IDS
+#define TORADIO_RECENT_IDS 32
+#endif
+#define TORADIO_RECENT_BUCKET_BITS 6 // Hash buckets for those, twice as many keeps the chains short
+
 #define SPECIAL_NONCE_ONLY_CONFIG 69420
 #define SPECIAL_NONCE_ONLY_NODES 69421 // ( ͡° ͜ʖ ͡°)
+#define SPECIAL_NONCE_NO_FILES 69422   // Everything but the file manifest
+
+/*
+ * Incremental config: a client that completed a config download (config_complete_id N) can ask for want_config_id
+ * N ^ CONFIG_RESUME_NONCE_XOR next time.  It then gets the full config but only the nodes that changed since download N
+ * started, and can resume from that download the same way.  If we rebooted, forgot N, or nodes were removed since, the client
+ * gets every node again instead.  A client merging into what it has can spot the removals by comparing its node count with
+ * MyNodeInfo.nodedb_count.
+ */
+#define CONFIG_RESUME_NONCE_XOR 0x6e6f6465 // "node"
+#define CONFIG_RESUME_SLOTS 4              // Completed downloads we remember
 
 /**
  * Provides our protobuf based API which phone/PC clients can use to talk to our device
@@ -54,7 +85,16 @@ class PhoneAPI
 
     // Hashmap of timestamps for last time we received a packet on the API per portnum
     std::unordered_map<meshtastic_PortNum, uint32_t> lastPortNumToRadio;
-    uint32_t recentToRadioPacketIds[20]; // Last 20 ToRadio MeshPacket IDs we have seen
+
+    /// The last TORADIO_RECENT_IDS MeshPacket ids from the phone, 0 if unused.  A ring, recentIdNext is the oldest once full.
+    /// Each id is also chained (index + 1, 0 ends a chain) from the bucket of its hash, so looking one up reads only a few
+    uint32_t recentIds[TORADIO_RECENT_IDS] = {};
+    uint8_t recentIdChain[TORADIO_RECENT_IDS] = {};
+    uint8_t recentIdBuckets[1 << TORADIO_RECENT_BUCKET_BITS] = {};
+    uint8_t recentIdNext = 0;
+
+    /// The client framed a toradio write, so it can also take several FromRadio framed in one read
+    bool clientFrames = false;
 
     /**
      * Each packet sent to the phone has an incrementing count
@@ -85,6 +125,10 @@ class PhoneAPI
 
     /// Use to ensure that clients don't get confused about old messages from the radio
     uint32_t config_nonce = 0;
+
+    /// NodeDB change sequence when this config download started, and the one the client already has (0 for everything)
+    uint32_t configStartSeq = 0;
+    uint32_t resumeFromSeq = 0;
     uint32_t readIndex = 0;
 
     std::vector<meshtastic_FileInfo> filesManifest = {};
@@ -102,7 +146,7 @@ class PhoneAPI
     virtual void close();
 
     /**
-     * Handle a ToRadio protobuf
+     * Handle a ToRadio protobuf, or several framed as TORADIO_FRAME_* says
      * @return true true if a packet was queued for sending (so that caller can yield)
      */
     virtual bool handleToRadio(const uint8_t *buf, size_t len);
@@ -120,6 +164,15 @@ class PhoneAPI
      */
     size_t getFromRadio(uint8_t *buf);
 
+    /**
+     * Like getFromRadio(), but for transports that pay per read (BLE).  If the client frames its writes, MQTT proxy messages
+     * queued behind the next one come with it, each framed, as many as fit in bufSize.  A proxying phone then needn't read
+     * once per envelope on a busy channel.
+     *
+     * We assume buf is at least FromRadio_size bytes long.
+     */
+    size_t getFromRadioBatch(uint8_t *buf, size_t bufSize);
+
     void sendConfigComplete();
 
     /**
@@ -136,6 +189,9 @@ class PhoneAPI
     /** the last msec we heard from the client on the other side of this link */
     uint32_t lastContactMsec = 0;
 
+    /// If set (see MeshService::addClientQueue) we take our packets from here instead of competing for the shared queue
+    PointerQueue<meshtastic_MeshPacket> *clientQueue = NULL;
+
     /// Hookable to find out when connection changes
     virtual void onConnectionChanged(bool connected) {}
 
@@ -153,6 +209,9 @@ class PhoneAPI
     /// begin a new connection
     void handleStartConfig();
 
+    /// Handle one ToRadio protobuf, handleToRadio() calls this for each of a batch
+    virtual bool handleToRadioMessage(const uint8_t *buf, size_t len);
+
   private:
     void releasePhonePacket();
 
@@ -162,8 +221,15 @@ class PhoneAPI
 
     void releaseClientNotification();
 
+    /// @return true if the phone sent packetId lately, otherwise remember it
     bool wasSeenRecently(uint32_t packetId);
 
+    /// @return the NodeDB change sequence the client asking for config_nonce already has, 0 if it needs everything
+    uint32_t findResumeSeq(uint32_t nonce);
+
+    /// Remember a finished download, so the client can resume from it
+    void rememberCompletedConfig(uint32_t nonce, uint32_t seq);
+
     /**
      * Handle a packet that the phone wants us to send.  We can write to it but can not keep a reference to it
      * @return true true if a packet was queued for sending
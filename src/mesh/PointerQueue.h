@@ -18,7 +18,6 @@ template <class T> class PointerQueue : public TypedQueue<T *>
         return this->dequeue(&p, maxWait) ? p : nullptr;
     }
 
-#ifdef HAS_FREE_RTOS
     // returns a ptr or null if the queue was empty
     T *dequeuePtrFromISR(BaseType_t *higherPriWoken)
     {
@@ -26,5 +25,4 @@ template <class T> class PointerQueue : public TypedQueue<T *>
 
         return this->dequeueFromISR(&p, higherPriWoken) ? p : nullptr;
     }
-#endif
 };
@@ -0,0 +1,209 @@
+#include "PresetAdvisor.h"
+#include "DisplayFormatters.h"
+#include "LinkQuality.h"
+#include "NodeDB.h"
+#include "airtime.h"
+#include "configuration.h"
+#include <math.h>
+
+PresetAdvisor *presetAdvisor;
+
+// Every preset a node can be set to, VERY_LONG_SLOW is deprecated
+static const meshtastic_Config_LoRaConfig_ModemPreset candidates[] = {
+    meshtastic_Config_LoRaConfig_ModemPreset_SHORT_TURBO, meshtastic_Config_LoRaConfig_ModemPreset_SHORT_FAST,
+    meshtastic_Config_LoRaConfig_ModemPreset_SHORT_SLOW,  meshtastic_Config_LoRaConfig_ModemPreset_MEDIUM_FAST,
+    meshtastic_Config_LoRaConfig_ModemPreset_MEDIUM_SLOW, meshtastic_Config_LoRaConfig_ModemPreset_LONG_FAST,
+    meshtastic_Config_LoRaConfig_ModemPreset_LONG_MODERATE, meshtastic_Config_LoRaConfig_ModemPreset_LONG_SLOW};
+
+// Demodulation floor from the SX126x/SX127x datasheets: -7.5 dB at SF7, 2.5 dB lower for every step up
+static float floorDb(uint8_t sf)
+{
+    return -7.5f - 2.5f * (sf - 7);
+}
+
+static uint8_t percent(float fraction)
+{
+    return (uint8_t)(fraction < 0 ? 0 : fraction > 1 ? 100 : fraction * 100 + 0.5f);
+}
+
+PresetAdvisor::PresetAdvisor(RadioInterface *radio) : concurrency::OSThread("PresetAdvisor"), radio(radio)
+{
+    if (airTime) {
+        lastRx = airTime->airtimeReport(RX_LOG)[0];
+        lastRxAll = airTime->airtimeReport(RX_ALL_LOG)[0];
+    }
+}
+
+float PresetAdvisor::estimate(const PresetConditions &c, float curBw, uint8_t curSf, uint8_t curCr, float bw, uint8_t sf,
+                              uint8_t cr, float &reach)
+{
+    // Noise grows with bandwidth, so a neighbour's SNR moves by the ratio
+    float bwDb = 10 * log10f(curBw / bw);
+    size_t reached = 0;
+    for (size_t i = 0; i < c.numNeighbours; i++)
+        if (c.snr[i] + bwDb - PRESET_ADVISOR_SNR_MARGIN >= floorDb(sf))
+            reached++;
+    reach = c.numNeighbours ? (float)reached / c.numNeighbours : 1;
+
+    // More link budget, longer hops, fewer of them
+    float budgetDb = floorDb(curSf) - floorDb(sf) + bwDb;
+    float curHops = c.hops < 1 ? 1 : c.hops;
+    float hops = curHops / powf(10, budgetDb / (10 * PRESET_ADVISOR_PATH_LOSS_EXP));
+    if (hops < 1)
+        hops = 1;
+
+    // Fraction of frames lost to collisions is 1 - exp(-k * load), with k from what we see now
+    float curLoad = c.channelUtil < 0.01f ? 0.01f : c.channelUtil;
+    float rxBad = c.rxBad > 0.9f ? 0.9f : c.rxBad;
+    float k = rxBad > 0 ? -logf(1 - rxBad) / curLoad : 1;
+    if (k < 1)
+        k = 1; // Too few frames lost to tell, assume at least pure ALOHA's half
+    float curMsec = RadioInterface::packetTimeMsec(PRESET_ADVISOR_PACKET_LEN, curBw, curSf, curCr, 16);
+    float msec = RadioInterface::packetTimeMsec(PRESET_ADVISOR_PACKET_LEN, bw, sf, cr, 16);
+    // The same packets, each taking msec over hops
+    float load = curLoad * (msec / curMsec) * (hops / curHops);
+    if (load >= 1)
+        return 0; // The channel could not carry it
+
+    float perHop = expf(-k * load);
+    return reach * powf(perHop, hops) / (msec * hops);
+}
+
+int32_t PresetAdvisor::runOnce()
+{
+    sample();
+    if (++samples >= 60 * 60 * 1000 / PRESET_ADVISOR_SAMPLE_MSEC) {
+        closeHour();
+        advise();
+    }
+    return PRESET_ADVISOR_SAMPLE_MSEC;
+}
+
+void PresetAdvisor::sample()
+{
+    if (airTime) {
+        sumUtil += airTime->channelUtilizationPercent();
+        sumTx += airTime->utilizationTXPercent();
+
+        // RX_ALL includes frames that were not ours to read, the rest of it is other LoRa users on our frequency
+        uint32_t rx = airTime->airtimeReport(RX_LOG)[0];
+        uint32_t rxAll = airTime->airtimeReport(RX_ALL_LOG)[0];
+        uint32_t newRx = rx >= lastRx ? rx - lastRx : rx; // Smaller when AirTime starts a new period
+        uint32_t newRxAll = rxAll >= lastRxAll ? rxAll - lastRxAll : rxAll;
+        if (newRxAll > newRx)
+            foreignMsec += newRxAll - newRx;
+        lastRx = rx;
+        lastRxAll = rxAll;
+    }
+    sumRxBad += radio->getRxBadRate();
+    sumCadBusy += radio->getCadBusyRate();
+}
+
+void PresetAdvisor::closeHour()
+{
+    Hour &h = hours[nextHour];
+    h.channelUtil = percent(sumUtil / samples / 100);
+    h.txUtil = percent(sumTx / samples / 100);
+    h.rxBad = percent(sumRxBad / samples);
+    h.cadBusy = percent(sumCadBusy / samples);
+    h.foreign = percent((float)foreignMsec / (samples * PRESET_ADVISOR_SAMPLE_MSEC));
+    h.neighbours = linkQuality.size() > UINT8_MAX ? UINT8_MAX : linkQuality.size();
+    h.hopsX10 = (uint8_t)(meanHops() * 10 + 0.5f);
+    LOG_DEBUG("PresetAdvisor: hour util=%u%% tx=%u%% rx_bad=%u%% cad_busy=%u%% foreign=%u%% neighbours=%u hops=%.1f",
+              h.channelUtil, h.txUtil, h.rxBad, h.cadBusy, h.foreign, h.neighbours, h.hopsX10 / 10.0f);
+
+    nextHour = (nextHour + 1) % PRESET_ADVISOR_HOURS;
+    if (numHours < PRESET_ADVISOR_HOURS)
+        numHours++;
+    sumUtil = sumTx = sumRxBad = sumCadBusy = 0;
+    samples = 0;
+    foreignMsec = 0;
+}
+
+float PresetAdvisor::meanHops()
+{
+    float sum = 0;
+    size_t known = 0;
+    for (size_t i = 0; i < nodeDB->getNumMeshNodes(); i++) {
+        const meshtastic_NodeInfoLite *node = nodeDB->getMeshNodeByIndex(i);
+        if (node->num == nodeDB->getNodeNum() || !node->has_hops_away || sinceLastSeen(node) >= PRESET_ADVISOR_HOPS_SECS)
+            continue;
+        sum += node->hops_away + 1; // hops_away counts the relays, a neighbour is 0 of them and 1 hop
+        known++;
+    }
+    return known ? sum / known : 0;
+}
+
+bool PresetAdvisor::getAdvice(Advice &out) const
+{
+    if (haveAdvice)
+        out = advice;
+    return haveAdvice;
+}
+
+void PresetAdvisor::advise()
+{
+    if (numHours < PRESET_ADVISOR_MIN_HOURS)
+        return;
+
+    float util = 0, rxBad = 0, hops = 0, foreign = 0;
+    size_t hopHours = 0;
+    for (uint8_t i = 0; i < numHours; i++) {
+        util += hours[i].channelUtil;
+        rxBad += hours[i].rxBad;
+        foreign += hours[i].foreign;
+        if (hours[i].hopsX10) {
+            hops += hours[i].hopsX10 / 10.0f;
+            hopHours++;
+        }
+    }
+    PresetConditions c = {util / numHours / 100, rxBad / numHours / 100, hopHours ? hops / hopHours : 1, NULL, 0};
+    float snr[LINK_QUALITY_CAPACITY];
+    linkQuality.forEach([&](const LinkStats &s) { snr[c.numNeighbours++] = s.snr; });
+    c.snr = snr;
+
+    Advice a = {};
+    a.hours = numHours;
+    a.foreign = (uint8_t)(foreign / numHours + 0.5f);
+    a.changeSlot = a.foreign > PRESET_ADVISOR_MAX_FOREIGN;
+    a.gain = 1;
+
+    // Only presets pick a modem, there is nothing to compare custom settings with
+    if (config.lora.use_preset && c.numNeighbours) {
+        float curBw = radio->getBandwidth();
+        uint8_t curSf = radio->getPresetSpreadingFactor(), curCr = radio->getCodingRate();
+        float curReach;
+        float now = estimate(c, curBw, curSf, curCr, curBw, curSf, curCr, curReach);
+        for (meshtastic_Config_LoRaConfig_ModemPreset preset : candidates) {
+            if (preset == config.lora.modem_preset)
+                continue;
+            float bw;
+            uint8_t cr, sf;
+            RadioInterface::presetModem(preset, myRegion->wideLora, bw, cr, sf);
+            if ((myRegion->freqEnd - myRegion->freqStart) < bw / 1000)
+                continue;
+            float reach;
+            float delivered = estimate(c, curBw, curSf, curCr, bw, sf, cr, reach);
+            float gain = now > 0 ? delivered / now : 0;
+            if (reach * 100 < curReach * PRESET_ADVISOR_MIN_REACH)
+                continue; // Would leave neighbours behind
+            if (gain > a.gain) {
+                a.gain = gain;
+                a.preset = preset;
+            }
+        }
+        a.changePreset = a.gain * 100 >= 100 + PRESET_ADVISOR_MIN_GAIN;
+    }
+
+    advice = a;
+    haveAdvice = true;
+    if (a.changePreset)
+        LOG_INFO("PresetAdvisor: over %u hours (util %.0f%%, rx_bad %.0f%%, %u neighbours, %.1f hops), %s would deliver %.1fx "
+                 "what %s does. Set it on every node to switch",
+                 numHours, c.channelUtil * 100, c.rxBad * 100, (unsigned)c.numNeighbours, c.hops,
+                 DisplayFormatters::getModemPresetDisplayName(a.preset, false), a.gain,
+                 DisplayFormatters::getModemPresetDisplayName(config.lora.modem_preset, false));
+    if (a.changeSlot)
+        LOG_INFO("PresetAdvisor: other LoRa traffic was on our frequency %u%% of the time, consider another channel_num",
+                 a.foreign);
+}
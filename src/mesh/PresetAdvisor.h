@@ -0,0 +1,116 @@
+#pragma once
+
+#include "RadioInterface.h"
+#include "concurrency/OSThread.h"
+
+// Hours of history the advice is based on, 7 bytes each
+#ifndef PRESET_ADVISOR_HOURS
+#define PRESET_ADVISOR_HOURS 72
+#endif
+// Hours we must have watched before we advise anything, so one busy evening doesn't decide it
+#ifndef PRESET_ADVISOR_MIN_HOURS
+#define PRESET_ADVISOR_MIN_HOURS 24
+#endif
+// How much more a preset must deliver than the one we are on before we suggest it (percent)
+#ifndef PRESET_ADVISOR_MIN_GAIN
+#define PRESET_ADVISOR_MIN_GAIN 25
+#endif
+// Share of the neighbours the current preset reaches that another one must still reach (percent)
+#ifndef PRESET_ADVISOR_MIN_REACH
+#define PRESET_ADVISOR_MIN_REACH 90
+#endif
+// Share of the time other LoRa traffic is on our frequency before we suggest another slot (percent)
+#ifndef PRESET_ADVISOR_MAX_FOREIGN
+#define PRESET_ADVISOR_MAX_FOREIGN 10
+#endif
+#define PRESET_ADVISOR_SNR_MARGIN 5      // dB a neighbour must be above a spreading factor's floor to count as reached
+#define PRESET_ADVISOR_PATH_LOSS_EXP 3.0f // Range grows as 10^(dB / (10 * this)) with link budget
+#define PRESET_ADVISOR_PACKET_LEN 64      // Bytes on the air of a typical packet, header included
+#define PRESET_ADVISOR_SAMPLE_MSEC (60 * 1000)
+#define PRESET_ADVISOR_HOPS_SECS (2 * 60 * 60) // Nodes heard this recently count towards the mean hop count
+
+/**
+ * What the mesh looked like over the history, as the model in PresetAdvisor::estimate() takes it
+ */
+struct PresetConditions {
+    float channelUtil; // Fraction of the time the channel was busy
+    float rxBad;       // Fraction of the frames we heard that did not decode
+    float hops;        // Mean hops to the nodes we hear, 1 for a neighbour
+    const float *snr;  // Of our neighbours, on the current modem settings
+    size_t numNeighbours;
+};
+
+/**
+ * Watches channel utilization, frames lost, CAD busy, foreign LoRa traffic, neighbours and hop counts for days, and says in
+ * the log (and to anyone who calls getAdvice()) when another modem preset or frequency slot would deliver more.
+ *
+ * The estimate compares presets by packets delivered per second of airtime.  For each preset it works out which neighbours
+ * would still hear us (their SNR moved by the change in bandwidth, against the spreading factor's demodulation floor), how
+ * many hops the mesh would need with the link budget gained or lost, how busy the channel would be with every packet taking
+ * that preset's airtime over that many hops, and so how many packets would get through each hop, with the collision model
+ * calibrated against the fraction of frames we see lost now.
+ *
+ * We only advise.  A preset is a mesh-wide setting, and a node that changed it alone would stop hearing the mesh, so an
+ * admin applies the advice to every node with set_config.
+ */
+class PresetAdvisor : private concurrency::OSThread
+{
+  public:
+    struct Advice {
+        bool changePreset;
+        meshtastic_Config_LoRaConfig_ModemPreset preset;
+        float gain;      // Estimated delivered throughput relative to now
+        bool changeSlot; // Other LoRa traffic on our frequency costs us too much airtime
+        uint8_t foreign; // Percent of the time it was on the air
+        uint8_t hours;   // History the advice is based on
+    };
+
+    explicit PresetAdvisor(RadioInterface *radio);
+
+    /// @return false until we have watched for long enough to say anything
+    bool getAdvice(Advice &advice) const;
+
+    /**
+     * Packets delivered per second of airtime on bw, sf, cr in conditions c, measured on curBw, curSf, curCr.
+     * Only the ratio of two estimates means anything.
+     * @param reach set to the fraction of the neighbours that preset reaches
+     */
+    static float estimate(const PresetConditions &c, float curBw, uint8_t curSf, uint8_t curCr, float bw, uint8_t sf, uint8_t cr,
+                          float &reach);
+
+  protected:
+    virtual int32_t runOnce() override;
+
+  private:
+    struct Hour {
+        uint8_t channelUtil; // Percent
+        uint8_t txUtil;      // Percent
+        uint8_t rxBad;       // Percent of the frames heard
+        uint8_t cadBusy;     // Percent of the CADs before a TX
+        uint8_t foreign;     // Percent of the time other LoRa traffic was on our frequency
+        uint8_t neighbours;
+        uint8_t hopsX10;     // Mean hops to the nodes heard, times 10, 0 if we heard none
+    };
+
+    RadioInterface *radio;
+    Hour hours[PRESET_ADVISOR_HOURS] = {};
+    uint8_t numHours = 0;
+    uint8_t nextHour = 0;
+
+    // The hour being summed up
+    float sumUtil = 0, sumTx = 0, sumRxBad = 0, sumCadBusy = 0;
+    uint16_t samples = 0;
+    uint32_t lastRx = 0, lastRxAll = 0, foreignMsec = 0;
+
+    Advice advice = {};
+    bool haveAdvice = false;
+
+    void sample();
+    void closeHour();
+    void advise();
+
+    /// Mean hops to the nodes heard recently, 1 for a neighbour, 0 if we don't know any
+    static float meanHops();
+};
+
+extern PresetAdvisor *presetAdvisor;
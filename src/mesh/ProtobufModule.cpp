@@ -1,2 +1,24 @@
 #include "ProtobufModule.h"
 #include "configuration.h"
+
+const pb_msgdesc_t *ProtobufDecodeCache::fields;
+meshtastic_Data_payload_t ProtobufDecodeCache::payload;
+ProtobufDecodeCache::Decoded ProtobufDecodeCache::decoded;
+
+bool ProtobufDecodeCache::get(const meshtastic_Data_payload_t &p, const pb_msgdesc_t *f, void *out, size_t size)
+{
+    if (f != fields || size > sizeof(decoded) || p.size != payload.size || memcmp(p.bytes, payload.bytes, p.size) != 0)
+        return false;
+    memcpy(out, &decoded, size);
+    return true;
+}
+
+void ProtobufDecodeCache::put(const meshtastic_Data_payload_t &p, const pb_msgdesc_t *f, const void *in, size_t size)
+{
+    if (size > sizeof(decoded))
+        return;
+    fields = f;
+    payload.size = p.size;
+    memcpy(payload.bytes, p.bytes, p.size);
+    memcpy(&decoded, in, size);
+}
@@ -1,5 +1,33 @@
 #pragma once
 #include "SinglePortModule.h"
+#include "mesh/generated/meshtastic/mesh.pb.h"
+#include "mesh/generated/meshtastic/telemetry.pb.h"
+
+/**
+ * The last payload a ProtobufModule decoded, so the others handed the same packet by MeshModule::callModules() (the six
+ * telemetry modules, and every module's alterReceived() after its handleReceived()) copy it instead of decoding it again.
+ * Keyed by the payload bytes and message type rather than the packet, so a module altering the payload can't leave a stale
+ * entry behind.  Messages bigger than the ones several modules decode are decoded every time.
+ */
+class ProtobufDecodeCache
+{
+  public:
+    /// Copy the cached decode of payload as fields into decoded, @return false if it isn't the one cached
+    static bool get(const meshtastic_Data_payload_t &payload, const pb_msgdesc_t *fields, void *decoded, size_t size);
+
+    /// Remember decoded as the decode of payload as fields, if it fits
+    static void put(const meshtastic_Data_payload_t &payload, const pb_msgdesc_t *fields, const void *decoded, size_t size);
+
+  private:
+    static const pb_msgdesc_t *fields; // NULL if nothing is cached
+    static meshtastic_Data_payload_t payload;
+    static union Decoded {
+        meshtastic_Telemetry telemetry;
+        meshtastic_Position position;
+        meshtastic_User user;
+        meshtastic_Routing routing;
+    } decoded;
+};
 
 /**
  * A base class for mesh modules that assume that they are sending/receiving one particular protobuf based
@@ -71,6 +99,19 @@ template <class T> class ProtobufModule : protected SinglePortModule
     }
 
   private:
+    /// Decode the payload of mp into scratch, @return false if it doesn't decode
+    bool decodePayload(const meshtastic_MeshPacket &mp, T &scratch)
+    {
+        const meshtastic_Data &p = mp.decoded;
+        if (ProtobufDecodeCache::get(p.payload, fields, &scratch, sizeof(scratch)))
+            return true;
+        memset(&scratch, 0, sizeof(scratch));
+        if (!pb_decode_from_bytes(p.payload.bytes, p.payload.size, fields, &scratch))
+            return false;
+        ProtobufDecodeCache::put(p.payload, fields, &scratch, sizeof(scratch));
+        return true;
+    }
+
     /** Called to handle a particular incoming message
 
     @return ProcessMessage::STOP if you've guaranteed you've handled this message and no other handlers should be considered for
@@ -87,8 +128,7 @@ template <class T> class ProtobufModule : protected SinglePortModule
         T scratch;
         T *decoded = NULL;
         if (mp.which_payload_variant == meshtastic_MeshPacket_decoded_tag && mp.decoded.portnum == ourPortNum) {
-            memset(&scratch, 0, sizeof(scratch));
-            if (pb_decode_from_bytes(p.payload.bytes, p.payload.size, fields, &scratch)) {
+            if (decodePayload(mp, scratch)) {
                 decoded = &scratch;
             } else {
                 LOG_ERROR("Error decoding proto module!");
@@ -107,9 +147,7 @@ template <class T> class ProtobufModule : protected SinglePortModule
         T scratch;
         T *decoded = NULL;
         if (mp.which_payload_variant == meshtastic_MeshPacket_decoded_tag && mp.decoded.portnum == ourPortNum) {
-            memset(&scratch, 0, sizeof(scratch));
-            const meshtastic_Data &p = mp.decoded;
-            if (pb_decode_from_bytes(p.payload.bytes, p.payload.size, fields, &scratch)) {
+            if (decodePayload(mp, scratch)) {
                 decoded = &scratch;
             } else {
                 LOG_ERROR("Error decoding proto module!");
@@ -1,6 +1,10 @@
 #include "RadioInterface.h"
 #include "Channels.h"
+#include "Default.h"
 #include "DisplayFormatters.h"
+#include "ForwardErrorCorrection.h"
+#include "FrameAggregation.h"
+#include "LinkQuality.h"
 #include "MeshRadio.h"
 #include "MeshService.h"
 #include "NodeDB.h"
@@ -227,6 +231,58 @@ The band is from 902 to 928 MHz. It mentions channel number and its respective c
 separated by 2.16 MHz with respect to the adjacent channels. Channel zero starts at 903.08 MHz center frequency.
 */
 
+void RadioInterface::presetModem(meshtastic_Config_LoRaConfig_ModemPreset preset, bool wideLora, float &bw, uint8_t &cr,
+                                 uint8_t &sf)
+{
+    switch (preset) {
+    case meshtastic_Config_LoRaConfig_ModemPreset_SHORT_TURBO:
+        bw = (wideLora) ? 1625.0 : 500;
+        cr = 5;
+        sf = 7;
+        break;
+    case meshtastic_Config_LoRaConfig_ModemPreset_SHORT_FAST:
+        bw = (wideLora) ? 812.5 : 250;
+        cr = 5;
+        sf = 7;
+        break;
+    case meshtastic_Config_LoRaConfig_ModemPreset_SHORT_SLOW:
+        bw = (wideLora) ? 812.5 : 250;
+        cr = 5;
+        sf = 8;
+        break;
+    case meshtastic_Config_LoRaConfig_ModemPreset_MEDIUM_FAST:
+        bw = (wideLora) ? 812.5 : 250;
+        cr = 5;
+        sf = 9;
+        break;
+    case meshtastic_Config_LoRaConfig_ModemPreset_MEDIUM_SLOW:
+        bw = (wideLora) ? 812.5 : 250;
+        cr = 5;
+        sf = 10;
+        break;
+    default: // Config_LoRaConfig_ModemPreset_LONG_FAST is default. Gracefully use this is preset is something illegal.
+        bw = (wideLora) ? 812.5 : 250;
+        cr = 5;
+        sf = 11;
+        break;
+    case meshtastic_Config_LoRaConfig_ModemPreset_LONG_MODERATE:
+        bw = (wideLora) ? 406.25 : 125;
+        cr = 8;
+        sf = 11;
+        break;
+    case meshtastic_Config_LoRaConfig_ModemPreset_LONG_SLOW:
+        bw = (wideLora) ? 406.25 : 125;
+        cr = 8;
+        sf = 12;
+        break;
+    }
+}
+
+uint32_t RadioInterface::getPacketTime(uint32_t pl)
+{
+    return packetTimeMsec(pl, bw, sf, cr, preambleLength);
+}
+
 /**
  * Calculate airtime per
  * https://www.rs-online.com/designspark/rel-assets/ds-assets/uploads/knowledge-items/application-notes-for-the-internet-of-things/LoRa%20Design%20Guide.pdf
@@ -234,7 +290,7 @@ separated by 2.16 MHz with respect to the adjacent channels. Channel zero starts
  *
  * @return num msecs for the packet
  */
-uint32_t RadioInterface::getPacketTime(uint32_t pl)
+uint32_t RadioInterface::packetTimeMsec(uint32_t pl, float bw, uint8_t sf, uint8_t cr, uint16_t preambleLength)
 {
     float bandwidthHz = bw * 1000.0f;
     bool headDisable = false; // we currently always use the header
@@ -273,7 +329,7 @@ uint32_t RadioInterface::getRetransmissionMsec(const meshtastic_MeshPacket *p)
     // Make sure enough time has elapsed for this packet to be sent and an ACK is received.
     // LOG_DEBUG("Waiting for flooding message with airtime %d and slotTime is %d", packetAirtime, slotTimeMsec);
     float channelUtil = airTime->channelUtilizationPercent();
-    uint8_t CWsize = map(channelUtil, 0, 100, CWmin, CWmax);
+    uint8_t CWsize = max(cwFloor, (uint8_t)map(channelUtil, 0, 100, CWmin, CWmax));
     // Assuming we pick max. of CWsize and there will be a client with SNR at half the range
     return 2 * packetAirtime + (pow_of_2(CWsize) + 2 * CWmax + pow_of_2(int((CWmax + CWmin) / 2))) * slotTimeMsec +
            PROCESSING_TIME_MSEC;
@@ -286,7 +342,7 @@ uint32_t RadioInterface::getTxDelayMsec()
     The pool to take a random multiple from is the contention window (CW), which size depends on the
     current channel utilization. */
     float channelUtil = airTime->channelUtilizationPercent();
-    uint8_t CWsize = map(channelUtil, 0, 100, CWmin, CWmax);
+    uint8_t CWsize = max(cwFloor, (uint8_t)map(channelUtil, 0, 100, CWmin, CWmax));
     // LOG_DEBUG("Current channel utilization is %f so setting CWsize to %d", channelUtil, CWsize);
     return random(0, pow_of_2(CWsize)) * slotTimeMsec;
 }
@@ -300,7 +356,54 @@ uint8_t RadioInterface::getCWsize(float snr)
     // The maximum value for a LoRa SNR
     const uint32_t SNR_MAX = 10;
 
-    return map(snr, SNR_MIN, SNR_MAX, CWmin, CWmax);
+    return map(snr, SNR_MIN, SNR_MAX, cwFloor, CWmax);
+}
+
+#define CONTENTION_UPDATE_MSEC (60 * 1000)
+// How much of each new minute's rates to blend into the smoothed ones
+#define CONTENTION_SMOOTHING 0.25f
+
+void RadioInterface::updateContentionWindow(uint32_t cadBusy, uint32_t cadClear, uint32_t rxBad, uint32_t rxGood)
+{
+    uint32_t now = millis();
+    if (lastContentionUpdate && now - lastContentionUpdate < CONTENTION_UPDATE_MSEC)
+        return;
+    lastContentionUpdate = now;
+
+    uint32_t checks = (cadBusy - lastCadBusy) + (cadClear - lastCadClear);
+    if (checks)
+        cadBusyRate += CONTENTION_SMOOTHING * ((float)(cadBusy - lastCadBusy) / checks - cadBusyRate);
+    uint32_t received = (rxBad - lastRxBad) + (rxGood - lastRxGood);
+    if (received)
+        rxBadRate += CONTENTION_SMOOTHING * ((float)(rxBad - lastRxBad) / received - rxBadRate);
+    lastCadBusy = cadBusy;
+    lastCadClear = cadClear;
+    lastRxBad = rxBad;
+    lastRxGood = rxGood;
+
+    // Who we heard directly lately, NeighborInfo also expires these when it runs
+    linkQuality.expire(
+        Default::getConfiguredOrDefault(moduleConfig.neighbor_info.update_interval, default_neighbor_info_broadcast_secs));
+    size_t neighbors = linkQuality.size();
+    contentionNeighbors = min(neighbors, (size_t)UINT8_MAX);
+
+    // One step per doubling of neighbors beyond 4, and one each for a channel that is often busy or a lot of garbage
+    uint8_t newFloor = CWmin;
+    for (size_t n = neighbors; n > 4; n >>= 1)
+        newFloor++;
+    if (cadBusyRate > 0.25f)
+        newFloor++;
+    if (cadBusyRate > 0.5f)
+        newFloor++;
+    if (rxBadRate > 0.2f)
+        newFloor++;
+    // Keep at least one step of SNR ranking
+    newFloor = min(newFloor, (uint8_t)(CWmax - 1));
+
+    if (newFloor != cwFloor)
+        LOG_INFO("Contention window floor %u -> %u (neighbors=%u, cad_busy=%.2f, rx_bad=%.2f)", cwFloor, newFloor,
+                 contentionNeighbors, cadBusyRate, rxBadRate);
+    cwFloor = newFloor;
 }
 
 /** The worst-case SNR_based packet delay */
@@ -335,6 +438,8 @@ uint32_t RadioInterface::getTxDelayMsecWeighted(float snr)
 void printPacket(const char *prefix, const meshtastic_MeshPacket *p)
 {
 #if defined(DEBUG_PORT) && !defined(DEBUG_MUTE)
+    if (LOG_NUM_DEBUG > DEBUG_LOG_MAX_LEVEL || !DEBUG_PORT.wantsLog(LOG_NUM_DEBUG))
+        return; // Don't build a line nobody will see
     std::string out =
         DEBUG_PORT.mt_sprintf("%s (id=0x%08x fr=0x%08x to=0x%08x, transport = %u, WantAck=%d, HopLim=%d Ch=0x%x", prefix, p->id,
                               p->from, p->to, p->transport_mechanism, p->want_ack, p->hop_limit, p->channel);
@@ -479,53 +584,21 @@ void RadioInterface::applyModemConfig()
 {
     // Set up default configuration
     // No Sync Words in LORA mode
-    meshtastic_Config_LoRaConfig &loraConfig = config.lora;
+    // A second radio only borrows the rest of config.lora, and must not write its preset back to it
+    meshtastic_Config_LoRaConfig overridden;
+    if (hasModemOverride) {
+        overridden = config.lora;
+        overridden.use_preset = true;
+        overridden.modem_preset = overridePreset;
+        overridden.channel_num = overrideChannelNum;
+        overridden.override_frequency = 0;
+    }
+    meshtastic_Config_LoRaConfig &loraConfig = hasModemOverride ? overridden : config.lora;
     bool validConfig = false; // We need to check for a valid configuration
     while (!validConfig) {
         if (loraConfig.use_preset) {
 
-            switch (loraConfig.modem_preset) {
-            case meshtastic_Config_LoRaConfig_ModemPreset_SHORT_TURBO:
-                bw = (myRegion->wideLora) ? 1625.0 : 500;
-                cr = 5;
-                sf = 7;
-                break;
-            case meshtastic_Config_LoRaConfig_ModemPreset_SHORT_FAST:
-                bw = (myRegion->wideLora) ? 812.5 : 250;
-                cr = 5;
-                sf = 7;
-                break;
-            case meshtastic_Config_LoRaConfig_ModemPreset_SHORT_SLOW:
-                bw = (myRegion->wideLora) ? 812.5 : 250;
-                cr = 5;
-                sf = 8;
-                break;
-            case meshtastic_Config_LoRaConfig_ModemPreset_MEDIUM_FAST:
-                bw = (myRegion->wideLora) ? 812.5 : 250;
-                cr = 5;
-                sf = 9;
-                break;
-            case meshtastic_Config_LoRaConfig_ModemPreset_MEDIUM_SLOW:
-                bw = (myRegion->wideLora) ? 812.5 : 250;
-                cr = 5;
-                sf = 10;
-                break;
-            default: // Config_LoRaConfig_ModemPreset_LONG_FAST is default. Gracefully use this is preset is something illegal.
-                bw = (myRegion->wideLora) ? 812.5 : 250;
-                cr = 5;
-                sf = 11;
-                break;
-            case meshtastic_Config_LoRaConfig_ModemPreset_LONG_MODERATE:
-                bw = (myRegion->wideLora) ? 406.25 : 125;
-                cr = 8;
-                sf = 11;
-                break;
-            case meshtastic_Config_LoRaConfig_ModemPreset_LONG_SLOW:
-                bw = (myRegion->wideLora) ? 406.25 : 125;
-                cr = 8;
-                sf = 12;
-                break;
-            }
+            presetModem(loraConfig.modem_preset, myRegion->wideLora, bw, cr, sf);
         } else {
             sf = loraConfig.spread_factor;
             cr = loraConfig.coding_rate;
@@ -585,8 +658,9 @@ void RadioInterface::applyModemConfig()
     uint32_t channel_num = (loraConfig.channel_num ? loraConfig.channel_num - 1 : hash(channelName)) % numChannels;
 
     // Check if we use the default frequency slot
-    RadioInterface::uses_default_frequency_slot =
-        channel_num == hash(DisplayFormatters::getModemPresetDisplayName(config.lora.modem_preset, false)) % numChannels;
+    if (!hasModemOverride)
+        RadioInterface::uses_default_frequency_slot =
+            channel_num == hash(DisplayFormatters::getModemPresetDisplayName(config.lora.modem_preset, false)) % numChannels;
 
     // Old frequency selection formula
     // float freq = myRegion->freqStart + ((((myRegion->freqEnd - myRegion->freqStart) / numChannels) / 2) * channel_num);
@@ -603,9 +677,8 @@ void RadioInterface::applyModemConfig()
     saveChannelNum(channel_num);
     saveFreq(freq + loraConfig.frequency_offset);
 
-    slotTimeMsec = computeSlotTimeMsec();
-    preambleTimeMsec = getPacketTime((uint32_t)0);
-    maxPacketTimeMsec = getPacketTime(meshtastic_Constants_DATA_PAYLOAD_LEN + sizeof(PacketHeader));
+    presetSf = sf;
+    updateModemTimings();
 
     LOG_INFO("Radio freq=%.3f, config.lora.frequency_offset=%.3f", freq, loraConfig.frequency_offset);
     LOG_INFO("Set radio: region=%s, name=%s, config=%u, ch=%d, power=%d", myRegion->name, channelName, loraConfig.modem_preset,
@@ -618,6 +691,13 @@ void RadioInterface::applyModemConfig()
     LOG_INFO("Slot time: %u msec", slotTimeMsec);
 }
 
+void RadioInterface::updateModemTimings()
+{
+    slotTimeMsec = computeSlotTimeMsec();
+    preambleTimeMsec = getPacketTime((uint32_t)0);
+    maxPacketTimeMsec = getPacketTime(meshtastic_Constants_DATA_PAYLOAD_LEN + sizeof(PacketHeader));
+}
+
 /** Slottime is the time to detect a transmission has started, consisting of:
   - CAD duration;
   - roundtrip air propagation time (assuming max. 30km between nodes);
@@ -668,39 +748,61 @@ void RadioInterface::deliverToReceiver(meshtastic_MeshPacket *p)
 {
     if (router) {
         p->transport_mechanism = meshtastic_MeshPacket_TransportMechanism_TRANSPORT_LORA;
+        router->heardOnInterface(p, this);
         router->enqueueReceivedMessage(p);
     }
 }
 
-/***
- * given a packet set sendingPacket and decode the protobufs into radiobuf.  Returns # of payload bytes to send
- */
-size_t RadioInterface::beginSending(meshtastic_MeshPacket *p)
+void RadioInterface::fillHeader(PacketHeader &h, meshtastic_MeshPacket *p)
 {
-    assert(!sendingPacket);
-
-    // LOG_DEBUG("Send queued packet on mesh (txGood=%d,rxGood=%d,rxBad=%d)", rf95.txGood(), rf95.rxGood(), rf95.rxBad());
     assert(p->which_payload_variant == meshtastic_MeshPacket_encrypted_tag); // It should have already been encoded by now
 
-    radioBuffer.header.from = p->from;
-    radioBuffer.header.to = p->to;
-    radioBuffer.header.id = p->id;
-    radioBuffer.header.channel = p->channel;
-    radioBuffer.header.next_hop = p->next_hop;
-    radioBuffer.header.relay_node = p->relay_node;
+    h.from = p->from;
+    h.to = p->to;
+    h.id = p->id;
+    h.channel = p->channel;
+    h.next_hop = p->next_hop;
+    h.relay_node = p->relay_node;
     if (p->hop_limit > HOP_MAX) {
         LOG_WARN("hop limit %d is too high, setting to %d", p->hop_limit, HOP_RELIABLE);
         p->hop_limit = HOP_RELIABLE;
     }
-    radioBuffer.header.flags =
-        p->hop_limit | (p->want_ack ? PACKET_FLAGS_WANT_ACK_MASK : 0) | (p->via_mqtt ? PACKET_FLAGS_VIA_MQTT_MASK : 0);
-    radioBuffer.header.flags |= (p->hop_start << PACKET_FLAGS_HOP_START_SHIFT) & PACKET_FLAGS_HOP_START_MASK;
+    h.flags = p->hop_limit | (p->want_ack ? PACKET_FLAGS_WANT_ACK_MASK : 0) | (p->via_mqtt ? PACKET_FLAGS_VIA_MQTT_MASK : 0);
+    h.flags |= (p->hop_start << PACKET_FLAGS_HOP_START_SHIFT) & PACKET_FLAGS_HOP_START_MASK;
 
     // if the sender nodenum is zero, that means uninitialized
-    assert(radioBuffer.header.from);
+    assert(h.from);
+}
+
+/***
+ * given a packet set sendingPacket and decode the protobufs into radiobuf.  Returns # of payload bytes to send
+ */
+size_t RadioInterface::beginSending(meshtastic_MeshPacket *p, meshtastic_MeshPacket *const *more, size_t numMore, bool protect)
+{
+    assert(!sendingPacket);
+
+    // LOG_DEBUG("Send queued packet on mesh (txGood=%d,rxGood=%d,rxBad=%d)", rf95.txGood(), rf95.rxGood(), rf95.rxBad());
+    if (numMore) {
+        size_t used = 0;
+        PacketHeader h;
+        for (size_t i = 0; i <= numMore; i++) {
+            meshtastic_MeshPacket *part = i ? more[i - 1] : p;
+            fillHeader(h, part);
+            if (!FrameAggregation::appendPart(radioBuffer.payload, sizeof(radioBuffer.payload), used, h, part->encrypted.bytes,
+                                              part->encrypted.size))
+                assert(0); // The caller made sure they all fit
+        }
+        FrameAggregation::initHeader(radioBuffer.header, nodeDB->getNodeNum());
+        sendingPacket = p;
+        return used + sizeof(PacketHeader);
+    }
+
+    fillHeader(radioBuffer.header, p);
     assert(p->encrypted.size <= sizeof(radioBuffer.payload));
     memcpy(radioBuffer.payload, p->encrypted.bytes, p->encrypted.size);
 
     sendingPacket = p;
+    if (protect)
+        return ForwardErrorCorrection::protect((uint8_t *)&radioBuffer, p->encrypted.size + sizeof(PacketHeader));
     return p->encrypted.size + sizeof(PacketHeader);
 }
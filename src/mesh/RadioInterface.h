@@ -9,6 +9,15 @@
 
 #define MAX_TX_QUEUE 16 // max number of packets which can be waiting for transmission
 
+// Radios one node can drive at once, only meshtasticd has the pins and the memory for a second one (see Router::addInterface)
+#ifndef MAX_RADIO_INTERFACES
+#ifdef ARCH_PORTDUINO
+#define MAX_RADIO_INTERFACES 2
+#else
+#define MAX_RADIO_INTERFACES 1
+#endif
+#endif
+
 #define MAX_LORA_PAYLOAD_LEN 255 // max length of 255 per Semtech's datasheets on SX12xx
 #define MESHTASTIC_HEADER_LENGTH 16
 #define MESHTASTIC_PKC_OVERHEAD 12
@@ -82,6 +91,7 @@ class RadioInterface
 
     float bw = 125;
     uint8_t sf = 9;
+    uint8_t presetSf = 9; // sf is only different during a LinkRate window
     uint8_t cr = 5;
 
     const uint8_t NUM_SYM_CAD = 2;       // Number of symbols used for CAD, 2 is the default since RadioLib 6.3.0 as per AN1200.48
@@ -95,11 +105,29 @@ class RadioInterface
     const uint8_t CWmin = 3; // minimum CWsize
     const uint8_t CWmax = 8; // maximum CWsize
 
+    /**
+     * Learned contention state. cwFloor replaces CWmin as the bottom of the SNR ranked window and rises with the number of
+     * direct neighbors and how often we find the channel busy or receive garbage, so dense meshes spread out more while
+     * sparse ones keep rebroadcast delays short.  CWmax is never moved, other nodes' timing depends on it.
+     */
+    uint8_t cwFloor = CWmin;
+    uint8_t contentionNeighbors = 0;
+    float cadBusyRate = 0; // Smoothed fraction of channel checks before TX that found the channel busy
+    float rxBadRate = 0;   // Smoothed fraction of received packets we couldn't read, our best proxy for collisions
+    uint32_t lastContentionUpdate = 0;
+    uint32_t lastCadBusy = 0, lastCadClear = 0, lastRxBad = 0, lastRxGood = 0;
+
+    /** Refresh the contention model from running counter totals, at most once per CONTENTION_UPDATE_MSEC */
+    void updateContentionWindow(uint32_t cadBusy, uint32_t cadClear, uint32_t rxBad, uint32_t rxGood);
+
     meshtastic_MeshPacket *sendingPacket = NULL; // The packet we are currently sending
     uint32_t lastTxStart = 0L;
 
     uint32_t computeSlotTimeMsec();
 
+    /** Work out slot, preamble and packet times again, after sf changed */
+    void updateModemTimings();
+
     /**
      * A temporary buffer used for sending/receiving packets, sized to hold the biggest buffer we might need
      * */
@@ -156,6 +184,33 @@ class RadioInterface
     /** Attempt to find a packet in the TxQueue. Returns true if the packet was found. */
     virtual bool findInTxQueue(NodeNum from, PacketId id) { return false; }
 
+    /** How many packets in the TX queue go to node, or through it as their next hop */
+    virtual size_t numQueuedFor(NodeNum node) { return 0; }
+
+    /**
+     * Use spreading factor linkSf, or the preset's for 0, for a window with one neighbour (see LinkRate).  Bandwidth,
+     * frequency and everything else stay as the preset has them.
+     * @return false if the radio can't, or can't right now because it is busy
+     */
+    virtual bool setLinkSpreadingFactor(uint8_t linkSf) { return false; }
+
+    uint8_t getSpreadingFactor() const { return sf; }
+    uint8_t getPresetSpreadingFactor() const { return presetSf; }
+    float getBandwidth() const { return bw; }
+    uint8_t getCodingRate() const { return cr; }
+    uint16_t getPreambleLength() const { return preambleLength; }
+
+    /**
+     * Run this radio on preset and frequency slot channelNum (1 based, 0 to hash the primary channel's name like
+     * config.lora.channel_num does) instead of config.lora's.  For a second radio, set before init().
+     */
+    void setModemOverride(meshtastic_Config_LoRaConfig_ModemPreset preset, uint32_t channelNum)
+    {
+        hasModemOverride = true;
+        overridePreset = preset;
+        overrideChannelNum = channelNum;
+    }
+
     // methods from radiohead
 
     /// Initialise the Driver transport hardware and software.
@@ -177,6 +232,12 @@ class RadioInterface
     /** The CW to use when calculating SNR_based delays */
     uint8_t getCWsize(float snr);
 
+    /** The learned bottom of the contention window, see cwFloor */
+    uint8_t getCWFloor() const { return cwFloor; }
+    uint8_t getContentionNeighbors() const { return contentionNeighbors; }
+    float getCadBusyRate() const { return cadBusyRate; }
+    float getRxBadRate() const { return rxBadRate; }
+
     /** The worst-case SNR_based packet delay */
     uint32_t getTxDelayMsecWeightedWorst(float snr);
 
@@ -196,6 +257,13 @@ class RadioInterface
     uint32_t getPacketTime(const meshtastic_MeshPacket *p);
     uint32_t getPacketTime(uint32_t totalPacketLen);
 
+    /// getPacketTime() for any modem settings, not only ours
+    static uint32_t packetTimeMsec(uint32_t totalPacketLen, float bw, uint8_t sf, uint8_t cr, uint16_t preambleLength);
+
+    /// The bandwidth (kHz), coding rate and spreading factor of preset
+    static void presetModem(meshtastic_Config_LoRaConfig_ModemPreset preset, bool wideLora, float &bw, uint8_t &cr,
+                            uint8_t &sf);
+
     /**
      * Get the channel we saved.
      */
@@ -218,13 +286,25 @@ class RadioInterface
     float savedFreq;
     uint32_t savedChannelNum;
 
+    bool hasModemOverride = false;
+    meshtastic_Config_LoRaConfig_ModemPreset overridePreset = meshtastic_Config_LoRaConfig_ModemPreset_LONG_FAST;
+    uint32_t overrideChannelNum = 0;
+
     /***
      * given a packet set sendingPacket and decode the protobufs into radiobuf.  Returns # of bytes to send (including the
      * PacketHeader & payload).
      *
      * Used as the first step of
+     *
+     * With more, the numMore packets from there go in the same frame after p, as an aggregate (see FrameAggregation).  They
+     * stay the caller's, only p becomes sendingPacket.  With protect, a frame with p alone gets FEC_PARITY_BYTES of parity
+     * (see ForwardErrorCorrection).
      */
-    size_t beginSending(meshtastic_MeshPacket *p);
+    size_t beginSending(meshtastic_MeshPacket *p, meshtastic_MeshPacket *const *more = NULL, size_t numMore = 0,
+                        bool protect = false);
+
+    /// The header p goes on the air with
+    static void fillHeader(PacketHeader &h, meshtastic_MeshPacket *p);
 
     /**
      * Some regulatory regions limit xmit power.
@@ -1,8 +1,15 @@
 #include "RadioLibInterface.h"
+#include "ForwardErrorCorrection.h"
+#include "FrameAggregation.h"
+#include "FrameCapture.h"
+#include "LinkRate.h"
 #include "MeshTypes.h"
 #include "NodeDB.h"
+#include "PacketLatency.h"
 #include "PowerMon.h"
+#include "RTC.h"
 #include "SPILock.h"
+#include "SlottedTx.h"
 #include "Throttle.h"
 #include "configuration.h"
 #include "error.h"
@@ -12,12 +19,13 @@
 #include <pb_encode.h>
 
 #if ARCH_PORTDUINO
+#include "PacketCapture.h"
 #include "PortduinoGlue.h"
 #include "meshUtils.h"
 #endif
 void LockingArduinoHal::spiBeginTransaction()
 {
-    spiLock->lock();
+    spiAcquire(SPI_CLIENT_RADIO);
 
     ArduinoHal::spiBeginTransaction();
 }
@@ -26,20 +34,38 @@ void LockingArduinoHal::spiEndTransaction()
 {
     ArduinoHal::spiEndTransaction();
 
-    spiLock->unlock();
+    spiRelease(SPI_CLIENT_RADIO);
 }
 #if ARCH_PORTDUINO
 void LockingArduinoHal::spiTransfer(uint8_t *out, size_t len, uint8_t *in)
 {
     spi->transfer(out, in, len);
 }
+#elif defined(ARCH_ESP32)
+void LockingArduinoHal::spiTransfer(uint8_t *out, size_t len, uint8_t *in)
+{
+    // Fills the SPI peripheral's 64 byte FIFO per chunk instead of one transaction per byte
+    spi->transferBytes(out, in, len);
+}
+#elif defined(ARCH_NRF52)
+void LockingArduinoHal::spiTransfer(uint8_t *out, size_t len, uint8_t *in)
+{
+    // A single SPIM EasyDMA transfer instead of one DMA setup per byte
+    spi->transfer(out, in, len);
+}
 #endif
 
 RadioLibInterface::RadioLibInterface(LockingArduinoHal *hal, RADIOLIB_PIN_TYPE cs, RADIOLIB_PIN_TYPE irq, RADIOLIB_PIN_TYPE rst,
                                      RADIOLIB_PIN_TYPE busy, PhysicalLayer *_iface)
     : NotifiedWorkerThread("RadioIf"), module(hal, cs, irq, rst, busy), iface(_iface)
 {
-    instance = this;
+    // A radio that failed to init is deleted before the next one is tried, so it leaves its slot free
+    while (instanceIndex < MAX_RADIO_INTERFACES - 1 && instances[instanceIndex])
+        instanceIndex++;
+    instances[instanceIndex] = this;
+    if (instanceIndex == 0)
+        instance = this;
+    setPriority(concurrency::PRIORITY_RADIO);
 #if defined(ARCH_STM32WL) && defined(USE_SX1262)
     module.setCb_digitalWrite(stm32wl_emulate_digitalWrite);
     module.setCb_digitalRead(stm32wl_emulate_digitalRead);
@@ -53,12 +79,18 @@ RadioLibInterface::RadioLibInterface(LockingArduinoHal *hal, RADIOLIB_PIN_TYPE c
 #define YIELD_FROM_ISR(x) portYIELD_FROM_ISR(x)
 #endif
 
-void INTERRUPT_ATTR RadioLibInterface::isrLevel0Common(PendingISR cause)
+RadioLibInterface::~RadioLibInterface()
 {
-    instance->disableInterrupt();
+    if (instances[instanceIndex] == this)
+        instances[instanceIndex] = NULL;
+}
+
+void INTERRUPT_ATTR RadioLibInterface::isrLevel0Common(RadioLibInterface *radio, PendingISR cause)
+{
+    radio->disableInterrupt();
 
     BaseType_t xHigherPriorityTaskWoken;
-    instance->notifyFromISR(&xHigherPriorityTaskWoken, cause, true);
+    radio->notifyFromISR(&xHigherPriorityTaskWoken, cause, true);
 
     /* Force a context switch if xHigherPriorityTaskWoken is now set to pdTRUE.
     The macro used to do this is dependent on the port and may be called
@@ -68,17 +100,48 @@ void INTERRUPT_ATTR RadioLibInterface::isrLevel0Common(PendingISR cause)
 
 void INTERRUPT_ATTR RadioLibInterface::isrRxLevel0()
 {
-    isrLevel0Common(ISR_RX);
+    isrLevel0Common(instances[0], ISR_RX);
 }
 
 void INTERRUPT_ATTR RadioLibInterface::isrTxLevel0()
 {
-    isrLevel0Common(ISR_TX);
+    isrLevel0Common(instances[0], ISR_TX);
+}
+
+#if MAX_RADIO_INTERFACES > 1
+void INTERRUPT_ATTR RadioLibInterface::isrRxLevel1()
+{
+    isrLevel0Common(instances[1], ISR_RX);
+}
+
+void INTERRUPT_ATTR RadioLibInterface::isrTxLevel1()
+{
+    isrLevel0Common(instances[1], ISR_TX);
+}
+#endif
+
+void (*RadioLibInterface::rxIsr() const)()
+{
+#if MAX_RADIO_INTERFACES > 1
+    if (instanceIndex == 1)
+        return isrRxLevel1;
+#endif
+    return isrRxLevel0;
+}
+
+void (*RadioLibInterface::txIsr() const)()
+{
+#if MAX_RADIO_INTERFACES > 1
+    if (instanceIndex == 1)
+        return isrTxLevel1;
+#endif
+    return isrTxLevel0;
 }
 
 /** Our ISR code currently needs this to find our active instance
  */
 RadioLibInterface *RadioLibInterface::instance;
+RadioLibInterface *RadioLibInterface::instances[MAX_RADIO_INTERFACES];
 
 /** Could we send right now (i.e. either not actively receiving or transmitting)? */
 bool RadioLibInterface::canSendImmediately()
@@ -131,6 +194,38 @@ bool RadioLibInterface::receiveDetected(uint16_t irq, ulong syncWordHeaderValidF
     return detected;
 }
 
+bool RadioLibInterface::rxActivitySeen()
+{
+    if (!rxSeen)
+        return false;
+    if (receiveDetected(rxSeen, RX_SEEN_HEADER, RX_SEEN_PREAMBLE))
+        return true;
+    rxSeen = 0; // Timed out, nothing is coming after all
+    return false;
+}
+
+bool RadioLibInterface::handleRxActivityInterrupt()
+{
+    if (!rxActivityIrq || !isReceiving || iface->checkIrq(RADIOLIB_IRQ_RX_DONE) == 1)
+        return false;
+
+    bool header = iface->checkIrq(RADIOLIB_IRQ_HEADER_VALID) == 1;
+    if (header || iface->checkIrq(RADIOLIB_IRQ_PREAMBLE_DETECTED) == 1) {
+        if (!activeReceiveStart)
+            activeReceiveStart = millis();
+        rxSeen |= RX_SEEN_PREAMBLE | (header ? RX_SEEN_HEADER : 0);
+    } // else a notification left over from before we restarted receiving
+
+    // The IRQ line only goes up on an edge, it has to come down before the end of the packet can raise it again
+    iface->clearIrq((1 << RADIOLIB_IRQ_PREAMBLE_DETECTED) | (1 << RADIOLIB_IRQ_HEADER_VALID));
+    enableInterrupt(rxIsr());
+    // If the packet ended before we got here the line never came down, and no edge is coming for it.  An edge right after
+    // we enabled the interrupt sets the same notification, so either way it is handled once.
+    if (iface->checkIrq(RADIOLIB_IRQ_RX_DONE) == 1)
+        notify(ISR_RX, true);
+    return true;
+}
+
 /// Send a packet (possibly by enquing in a private fifo).  This routine will
 /// later free() the packet to pool.  This routine is not allowed to stall because it is called from
 /// bluetooth comms code.  If the txmit queue is empty it might return an error
@@ -172,12 +267,13 @@ ErrorCode RadioLibInterface::send(meshtastic_MeshPacket *p)
     printPacket("enqueue for send", p);
 
     LOG_DEBUG("txGood=%d,txRelay=%d,rxGood=%d,rxBad=%d", txGood, txRelay, rxGood, rxBad);
-    ErrorCode res = txQueue.enqueue(p) ? ERRNO_OK : ERRNO_UNKNOWN;
+    ErrorCode res = txQueue.enqueue(p, getPacketTime(p)) ? ERRNO_OK : ERRNO_UNKNOWN;
 
     if (res != ERRNO_OK) { // we weren't able to queue it, so we must drop it to prevent leaks
         packetPool.release(p);
         return res;
     }
+    packetLatency.mark(PACKET_STAGE_TX_QUEUED, getFrom(p), p->id);
 
     // set (random) transmit delay to let others reconfigure their radio,
     // to avoid collisions and implement timing-based flooding
@@ -236,6 +332,16 @@ bool RadioLibInterface::findInTxQueue(NodeNum from, PacketId id)
     return txQueue.find(from, id);
 }
 
+size_t RadioLibInterface::numQueuedFor(NodeNum node)
+{
+    size_t n = 0;
+    meshtastic_MeshPacket *p;
+    for (size_t i = 0; (p = txQueue.peek(i)) != NULL; i++)
+        if (p->to == node || (p->next_hop != NO_NEXT_HOP_PREFERENCE && p->next_hop == (node & 0xff)))
+            n++;
+    return n;
+}
+
 /** radio helper thread callback.
 We never immediately transmit after any operation (either Rx or Tx). Instead we should wait a random multiple of
 'slotTimes' (see definition in RadioInterface.h) taken from a contention window (CW) to lower the chance of collision.
@@ -251,11 +357,22 @@ void RadioLibInterface::onNotify(uint32_t notification)
         startReceive();
         setTransmitDelay();
         break;
-    case ISR_RX:
-        handleReceiveInterrupt();
+    case ISR_RX: {
+        if (handleRxActivityInterrupt()) {
+            setTransmitDelay(); // The interrupt took the place of a pending TRANSMIT_DELAY_COMPLETED
+            break;
+        }
+        meshtastic_MeshPacket *received[FRAME_AGGREGATE_MAX_RX_PARTS];
+        size_t numReceived = handleReceiveInterrupt(received);
+        // Re-arm before logging and handing the packets off, so back to back packets find the radio listening
         startReceive();
+        for (size_t i = 0; i < numReceived; i++) {
+            printPacket("Lora RX", received[i]);
+            deliverToReceiver(received[i]);
+        }
         setTransmitDelay();
         break;
+    }
     case TRANSMIT_DELAY_COMPLETED:
 
         // If we are not currently in receive mode, then restart the random delay (this can happen if the main thread
@@ -267,23 +384,54 @@ void RadioLibInterface::onNotify(uint32_t notification)
                 meshtastic_MeshPacket *txp = txQueue.getFront();
                 assert(txp);
                 long delay_remaining = txp->tx_after ? txp->tx_after - millis() : 0;
+                if (delay_remaining <= 0)
+                    delay_remaining = airTime->getTxBudgetWaitMsec(txp->priority, getPacketTime(txp));
                 if (delay_remaining > 0) {
-                    // There's still some delay pending on this packet, so resume waiting for it to elapse
+                    // There's still some delay pending on this packet (or its priority is out of airtime budget), so resume
+                    // waiting for it to elapse
                     notifyLater(delay_remaining, TRANSMIT_DELAY_COMPLETED, false);
                 } else {
+                    // Leaves a LinkRate window first if txp is for someone else, so the channel check is on the right rate
+                    bool inLinkWindow = linkRate && linkRate->beforeTransmit(txp);
                     if (isChannelActive()) { // check if there is currently a LoRa packet on the channel
-                        startReceive();      // try receiving this packet, afterwards we'll be trying to transmit again
+                        txCadBusy++;
+                        startReceive(); // try receiving this packet, afterwards we'll be trying to transmit again
                         setTransmitDelay();
                     } else {
+                        txCadClear++;
                         // Send any outgoing packets we have ready as fast as possible to keep the time between channel scan and
                         // actual transmission as short as possible
                         txp = txQueue.dequeue();
                         assert(txp);
-                        bool sent = startSend(txp);
+                        meshtastic_MeshPacket *more[FRAME_AGGREGATE_MAX_PARTS - 1];
+                        size_t frameLen;
+                        size_t numMore = 0;
+                        if (inLinkWindow) // The peer is the only one listening at this rate
+                            frameLen = sizeof(PacketHeader) + txp->encrypted.size;
+                        else
+                            numMore = takeAggregateParts(txp, more, frameLen);
+                        bool protect = !numMore && ForwardErrorCorrection::shouldProtect(txp, getSpreadingFactor());
+                        if (protect)
+                            frameLen += FEC_PARITY_BYTES;
+                        bool sent = startSend(txp, more, numMore, protect);
                         if (sent) {
+                            packetLatency.mark(PACKET_STAGE_TX_STARTED, getFrom(txp), txp->id);
                             // Packet has been sent, count it toward our TX airtime utilization.
-                            uint32_t xmitMsec = getPacketTime(txp);
+                            uint32_t xmitMsec = numMore || protect ? getPacketTime(frameLen) : getPacketTime(txp);
                             airTime->logAirtime(TX_LOG, xmitMsec);
+                            airTime->spendTxBudget(txp->priority, xmitMsec);
+                            txQueue.noteAirtime(getFrom(txp), numMore ? getPacketTime(txp) : xmitMsec);
+                        }
+                        // The packets that rode along were copied into the frame, so we are done with them
+                        for (size_t i = 0; i < numMore; i++) {
+                            if (sent) {
+                                packetLatency.mark(PACKET_STAGE_TX_STARTED, getFrom(more[i]), more[i]->id);
+                                txQueue.noteAirtime(getFrom(more[i]), getPacketTime(more[i]));
+                                txGood++;
+                                if (!isFromUs(more[i]))
+                                    txRelay++;
+                            }
+                            packetPool.release(more[i]);
                         }
                         LOG_DEBUG("%d packets remain in the TX queue", txQueue.getMaxLen() - txQueue.getFree());
                     }
@@ -305,6 +453,8 @@ void RadioLibInterface::setTransmitDelay()
         return; // noop if there's nothing in the queue
     }
 
+    updateContentionWindow(txCadBusy, txCadClear, rxBad, rxGood);
+
     // We want all sending/receiving to be done by our daemon thread.
     // We use a delay here because this packet might have been sent in response to a packet we just received.
     // So we want to make sure the other side has had a chance to reconfigure its radio.
@@ -314,6 +464,13 @@ void RadioLibInterface::setTransmitDelay()
         unsigned long now = millis();
         p->tx_after = min(max(p->tx_after + add_delay, now + add_delay), now + 2 * getTxDelayMsecWeightedWorst(p->rx_snr));
         notifyLater(p->tx_after - now, TRANSMIT_DELAY_COMPLETED, false);
+#if SLOTTED_TX
+    } else if (!isFromUs(p) && SlottedTx::isActive()) {
+        // Our slot keeps us clear of the other ROUTERs, CAD still checks for everybody else
+        uint32_t delay = SlottedTx::msecUntilSlot(getTimeMsec(), SlottedTx::slotMsec(this), SLOTTED_TX_SLOTS,
+                                                  SlottedTx::ourSlot(), getPacketTime(p), SLOTTED_TX_GUARD_MSEC);
+        notifyLater(max(delay, (uint32_t)1), TRANSMIT_DELAY_COMPLETED, false);
+#endif
     } else if (p->rx_snr == 0 && p->rx_rssi == 0) {
         /* We assume if rx_snr = 0 and rx_rssi = 0, the packet was generated locally.
          *   This assumption is valid because of the offset generated by the radio to account for the noise
@@ -354,7 +511,7 @@ void RadioLibInterface::clampToLateRebroadcastWindow(NodeNum from, PacketId id)
     meshtastic_MeshPacket *p = txQueue.remove(from, id, true, false);
     if (p) {
         p->tx_after = millis() + getTxDelayMsecWeightedWorst(p->rx_snr);
-        if (txQueue.enqueue(p)) {
+        if (txQueue.enqueue(p, getPacketTime(p))) {
             LOG_DEBUG("Move existing queued packet to the late rebroadcast window %dms from now", p->tx_after - millis());
         } else {
             packetPool.release(p);
@@ -362,6 +519,49 @@ void RadioLibInterface::clampToLateRebroadcastWindow(NodeNum from, PacketId id)
     }
 }
 
+size_t RadioLibInterface::takeAggregateParts(const meshtastic_MeshPacket *lead, meshtastic_MeshPacket **more, size_t &frameLen)
+{
+    frameLen = sizeof(PacketHeader) + lead->encrypted.size;
+#if LORA_FRAME_AGGREGATION
+    if (lead->encrypted.size > FRAME_AGGREGATE_MAX_PART)
+        return 0;
+
+    // Find them first, taking them out of the queue reshuffles it
+    struct {
+        NodeNum from;
+        PacketId id;
+    } found[FRAME_AGGREGATE_MAX_PARTS - 1];
+    size_t numFound = 0;
+    size_t aggregateLen = sizeof(PacketHeader) + FrameAggregation::partLength(lead);
+    const meshtastic_MeshPacket *p;
+    for (size_t i = 0; numFound < FRAME_AGGREGATE_MAX_PARTS - 1 && (p = txQueue.peek(i)); i++) {
+        if (!FrameAggregation::canJoin(lead, p) || aggregateLen + FrameAggregation::partLength(p) > MAX_LORA_PAYLOAD_LEN)
+            continue;
+        aggregateLen += FrameAggregation::partLength(p);
+        found[numFound].from = p->from;
+        found[numFound].id = p->id;
+        numFound++;
+    }
+    if (!numFound || !FrameAggregation::receiversCapable(lead))
+        return 0;
+
+    size_t numMore = 0;
+    frameLen = sizeof(PacketHeader) + FrameAggregation::partLength(lead);
+    for (size_t i = 0; i < numFound; i++) {
+        meshtastic_MeshPacket *part = txQueue.remove(found[i].from, found[i].id);
+        if (part) {
+            more[numMore++] = part;
+            frameLen += FrameAggregation::partLength(part);
+        }
+    }
+    LOG_DEBUG("Send %u packets in one aggregate frame of %u bytes", (unsigned)numMore + 1, (unsigned)frameLen);
+    return numMore;
+#else
+    (void)more;
+    return 0;
+#endif
+}
+
 void RadioLibInterface::handleTransmitInterrupt()
 {
     // This can be null if we forced the device to enter standby mode.  In that case
@@ -389,7 +589,38 @@ void RadioLibInterface::completeSending()
     }
 }
 
-void RadioLibInterface::handleReceiveInterrupt()
+meshtastic_MeshPacket *RadioLibInterface::packetFromFrame(const PacketHeader &h, const uint8_t *payload, size_t len)
+{
+    // Note: we deliver _all_ packets to our router (i.e. our interface is intentionally promiscuous).
+    // This allows the router and other apps on our node to sniff packets (usually routing) between other
+    // nodes.
+    meshtastic_MeshPacket *mp = packetPool.allocZeroed();
+
+    // Keep the assigned fields in sync with src/mqtt/MQTT.cpp:onReceiveProto and SimRadio::receivePart
+    mp->from = h.from;
+    mp->to = h.to;
+    mp->id = h.id;
+    packetLatency.mark(PACKET_STAGE_RADIO_RX, mp->from, mp->id);
+    mp->channel = h.channel;
+    assert(HOP_MAX <= PACKET_FLAGS_HOP_LIMIT_MASK); // If hopmax changes, carefully check this code
+    mp->hop_limit = h.flags & PACKET_FLAGS_HOP_LIMIT_MASK;
+    mp->hop_start = (h.flags & PACKET_FLAGS_HOP_START_MASK) >> PACKET_FLAGS_HOP_START_SHIFT;
+    mp->want_ack = !!(h.flags & PACKET_FLAGS_WANT_ACK_MASK);
+    mp->via_mqtt = !!(h.flags & PACKET_FLAGS_VIA_MQTT_MASK);
+    // If hop_start is not set, next_hop and relay_node are invalid (firmware <2.3)
+    mp->next_hop = mp->hop_start == 0 ? NO_NEXT_HOP_PREFERENCE : h.next_hop;
+    mp->relay_node = mp->hop_start == 0 ? NO_RELAY_NODE : h.relay_node;
+
+    addReceiveMetadata(mp);
+
+    mp->which_payload_variant = meshtastic_MeshPacket_encrypted_tag; // Mark that the payload is still encrypted at this point
+    assert(len <= sizeof(mp->encrypted.bytes));
+    memcpy(mp->encrypted.bytes, payload, len);
+    mp->encrypted.size = len;
+    return mp;
+}
+
+size_t RadioLibInterface::handleReceiveInterrupt(meshtastic_MeshPacket **received)
 {
     uint32_t xmitMsec;
 
@@ -397,7 +628,7 @@ void RadioLibInterface::handleReceiveInterrupt()
     // Condition?
     if (!isReceiving) {
         LOG_ERROR("handleReceiveInterrupt called when not in rx mode, which shouldn't happen");
-        return;
+        return 0;
     }
 
     isReceiving = false;
@@ -411,7 +642,7 @@ void RadioLibInterface::handleReceiveInterrupt()
     if (config.lora.region == meshtastic_Config_LoRaConfig_RegionCode_UNSET) {
         LOG_WARN("lora rx disabled: Region unset");
         airTime->logAirtime(RX_ALL_LOG, xmitMsec);
-        return;
+        return 0;
     }
 #endif
 
@@ -421,9 +652,24 @@ void RadioLibInterface::handleReceiveInterrupt()
         printBytes("Raw incoming packet: ", (uint8_t *)&radioBuffer, length);
     }
 #endif
+    // The data is still read when the CRC fails, if the frame has parity it may be repairable
+    if (state == RADIOLIB_ERR_NONE || state == RADIOLIB_ERR_CRC_MISMATCH) {
+        size_t unwrapped = ForwardErrorCorrection::unwrap((uint8_t *)&radioBuffer, length, state == RADIOLIB_ERR_NONE);
+        if (unwrapped) {
+            if (state != RADIOLIB_ERR_NONE)
+                LOG_INFO("Repaired a frame with a bad CRC from its parity");
+            state = RADIOLIB_ERR_NONE;
+            length = unwrapped;
+        }
+    }
     if (state != RADIOLIB_ERR_NONE) {
         LOG_ERROR("Ignore received packet due to error=%d", state);
         rxBad++;
+#if FRAME_CAPTURE_BYTES
+        if (state == RADIOLIB_ERR_CRC_MISMATCH)
+            frameCapture.add(false, (uint8_t *)&radioBuffer, length, getFreq(), bw, sf, lround(iface->getRSSI()),
+                             iface->getSNR(), false);
+#endif
 
         airTime->logAirtime(RX_ALL_LOG, xmitMsec);
 
@@ -441,48 +687,44 @@ void RadioLibInterface::handleReceiveInterrupt()
             // altered packet with "from == 0" can do Remote Node Administration without permission
             if (radioBuffer.header.from == 0) {
                 LOG_WARN("Ignore received packet without sender");
-                return;
+                return 0;
             }
 
-            // Note: we deliver _all_ packets to our router (i.e. our interface is intentionally promiscuous).
-            // This allows the router and other apps on our node to sniff packets (usually routing) between other
-            // nodes.
-            meshtastic_MeshPacket *mp = packetPool.allocZeroed();
-
-            // Keep the assigned fields in sync with src/mqtt/MQTT.cpp:onReceiveProto
-            mp->from = radioBuffer.header.from;
-            mp->to = radioBuffer.header.to;
-            mp->id = radioBuffer.header.id;
-            mp->channel = radioBuffer.header.channel;
-            assert(HOP_MAX <= PACKET_FLAGS_HOP_LIMIT_MASK); // If hopmax changes, carefully check this code
-            mp->hop_limit = radioBuffer.header.flags & PACKET_FLAGS_HOP_LIMIT_MASK;
-            mp->hop_start = (radioBuffer.header.flags & PACKET_FLAGS_HOP_START_MASK) >> PACKET_FLAGS_HOP_START_SHIFT;
-            mp->want_ack = !!(radioBuffer.header.flags & PACKET_FLAGS_WANT_ACK_MASK);
-            mp->via_mqtt = !!(radioBuffer.header.flags & PACKET_FLAGS_VIA_MQTT_MASK);
-            // If hop_start is not set, next_hop and relay_node are invalid (firmware <2.3)
-            mp->next_hop = mp->hop_start == 0 ? NO_NEXT_HOP_PREFERENCE : radioBuffer.header.next_hop;
-            mp->relay_node = mp->hop_start == 0 ? NO_RELAY_NODE : radioBuffer.header.relay_node;
-
-            addReceiveMetadata(mp);
-
-            mp->which_payload_variant =
-                meshtastic_MeshPacket_encrypted_tag; // Mark that the payload is still encrypted at this point
-            assert(((uint32_t)payloadLen) <= sizeof(mp->encrypted.bytes));
-            memcpy(mp->encrypted.bytes, radioBuffer.payload, payloadLen);
-            mp->encrypted.size = payloadLen;
-
-            printPacket("Lora RX", mp);
+            size_t numReceived = 0;
+            if (FrameAggregation::isAggregate(radioBuffer.header)) {
+                // Each part goes on as if it had come in a frame of its own
+                if (!FrameAggregation::forEachPart(
+                        radioBuffer.payload, payloadLen, [&](const PacketHeader &h, const uint8_t *payload, size_t len) {
+                            if (numReceived < FRAME_AGGREGATE_MAX_RX_PARTS)
+                                received[numReceived++] = packetFromFrame(h, payload, len);
+                        }))
+                    LOG_WARN("Malformed aggregate frame from 0x%08x, %u packets taken from it", radioBuffer.header.from,
+                             (unsigned)numReceived);
+            } else {
+                received[numReceived++] = packetFromFrame(radioBuffer.header, radioBuffer.payload, payloadLen);
+            }
+#if FRAME_CAPTURE_BYTES
+            if (numReceived)
+                frameCapture.add(false, (uint8_t *)&radioBuffer, length, getFreq(), bw, sf, received[0]->rx_rssi,
+                                 received[0]->rx_snr);
+#endif
+#if ARCH_PORTDUINO
+            if (numReceived)
+                packetCaptureWrite((uint8_t *)&radioBuffer, length, received[0]->rx_rssi, received[0]->rx_snr);
+#endif
 
             airTime->logAirtime(RX_LOG, xmitMsec);
 
-            deliverToReceiver(mp);
+            return numReceived;
         }
     }
+    return 0;
 }
 
 void RadioLibInterface::startReceive()
 {
     isReceiving = true;
+    rxSeen = 0;
     powerMon->setState(meshtastic_PowerMon_State_Lora_RXOn);
 }
 
@@ -499,7 +741,7 @@ void RadioLibInterface::setStandby()
 }
 
 /** start an immediate transmit */
-bool RadioLibInterface::startSend(meshtastic_MeshPacket *txp)
+bool RadioLibInterface::startSend(meshtastic_MeshPacket *txp, meshtastic_MeshPacket *const *more, size_t numMore, bool protect)
 {
     /* NOTE: Minimize the actions before startTransmit() to keep the time between
              channel scan and actual transmit as low as possible to avoid collisions. */
@@ -510,7 +752,7 @@ bool RadioLibInterface::startSend(meshtastic_MeshPacket *txp)
     } else {
         configHardwareForSend(); // must be after setStandby
 
-        size_t numbytes = beginSending(txp);
+        size_t numbytes = beginSending(txp, more, numMore, protect);
 
         int res = iface->startTransmit((uint8_t *)&radioBuffer, numbytes);
         if (res != RADIOLIB_ERR_NONE) {
@@ -524,8 +766,11 @@ bool RadioLibInterface::startSend(meshtastic_MeshPacket *txp)
         } else {
             // Must be done AFTER, starting transmit, because startTransmit clears (possibly stale) interrupt pending register
             // bits
-            enableInterrupt(isrTxLevel0);
+            enableInterrupt(txIsr());
             lastTxStart = millis();
+#if FRAME_CAPTURE_BYTES
+            frameCapture.add(true, (uint8_t *)&radioBuffer, numbytes, getFreq(), bw, sf, 0, 0);
+#endif
             printPacket("Started Tx", txp);
         }
 
@@ -19,6 +19,18 @@
 // In addition to the default Rx flags, we need the PREAMBLE_DETECTED flag to detect whether we are actively receiving
 #define MESHTASTIC_RADIOLIB_IRQ_RX_FLAGS (RADIOLIB_IRQ_RX_DEFAULT_FLAGS | (1 << RADIOLIB_IRQ_PREAMBLE_DETECTED))
 
+// Set to 0 to have SX126x and LR11x0 only interrupt at the end of a packet, and be asked over SPI whether one is coming in
+// every time we want to transmit.  By default the start of a packet interrupts too, and we keep track of it ourselves.
+#ifndef RX_ACTIVITY_IRQ
+#define RX_ACTIVITY_IRQ 1
+#endif
+#if RX_ACTIVITY_IRQ
+#define MESHTASTIC_RADIOLIB_IRQ_RX_MASK                                                                                         \
+    (RADIOLIB_IRQ_RX_DEFAULT_MASK | (1 << RADIOLIB_IRQ_PREAMBLE_DETECTED) | (1 << RADIOLIB_IRQ_HEADER_VALID))
+#else
+#define MESHTASTIC_RADIOLIB_IRQ_RX_MASK RADIOLIB_IRQ_RX_DEFAULT_MASK
+#endif
+
 /**
  * We need to override the RadioLib ArduinoHal class to add mutex protection for SPI bus access
  */
@@ -29,9 +41,9 @@ class LockingArduinoHal : public ArduinoHal
 
     void spiBeginTransaction() override;
     void spiEndTransaction() override;
-#if ARCH_PORTDUINO
+#if ARCH_PORTDUINO || defined(ARCH_ESP32) || defined(ARCH_NRF52)
+    // The stock ArduinoHal clocks one byte per call, these platforms can move the whole buffer in one go
     void spiTransfer(uint8_t *out, size_t len, uint8_t *in) override;
-
 #endif
 };
 
@@ -54,9 +66,15 @@ class RadioLibInterface : public RadioInterface, protected concurrency::Notified
     enum PendingISR { ISR_NONE = 0, ISR_RX, ISR_TX, TRANSMIT_DELAY_COMPLETED };
 
     /**
-     * Raw ISR handler that just calls our polymorphic method
+     * Raw ISR handler that just calls our polymorphic method, one per radio as an ISR can't take an argument
      */
-    static void isrTxLevel0(), isrLevel0Common(PendingISR code);
+    static void isrTxLevel0(), isrLevel0Common(RadioLibInterface *radio, PendingISR code);
+#if MAX_RADIO_INTERFACES > 1
+    static void isrTxLevel1();
+#endif
+
+    /// Which of instances we are, and so which ISR handlers are ours
+    size_t instanceIndex = 0;
 
     MeshPacketQueue txQueue = MeshPacketQueue(MAX_TX_QUEUE);
 
@@ -87,10 +105,13 @@ class RadioLibInterface : public RadioInterface, protected concurrency::Notified
     bool isReceiving = false;
 
   public:
-    /** Our ISR code currently needs this to find our active instance
+    /** Our ISR code currently needs this to find our active instance, with more than one radio it is the first of them
      */
     static RadioLibInterface *instance;
 
+    /// Every radio, in the order they were created
+    static RadioLibInterface *instances[MAX_RADIO_INTERFACES];
+
     /**
      * Glue functions called from ISR land
      */
@@ -106,10 +127,17 @@ class RadioLibInterface : public RadioInterface, protected concurrency::Notified
      */
     uint32_t rxBad = 0, rxGood = 0, txGood = 0, txRelay = 0;
 
+    /**
+     * How often the channel check before a TX found the channel busy or clear, feeds the contention window model
+     */
+    uint32_t txCadBusy = 0, txCadClear = 0;
+
   public:
     RadioLibInterface(LockingArduinoHal *hal, RADIOLIB_PIN_TYPE cs, RADIOLIB_PIN_TYPE irq, RADIOLIB_PIN_TYPE rst,
                       RADIOLIB_PIN_TYPE busy, PhysicalLayer *iface = NULL);
 
+    virtual ~RadioLibInterface();
+
     virtual ErrorCode send(meshtastic_MeshPacket *p) override;
 
     /**
@@ -146,6 +174,8 @@ class RadioLibInterface : public RadioInterface, protected concurrency::Notified
     /** Attempt to find a packet in the TxQueue. Returns true if the packet was found. */
     virtual bool findInTxQueue(NodeNum from, PacketId id) override;
 
+    virtual size_t numQueuedFor(NodeNum node) override;
+
   private:
     /** if we have something waiting to send, start a short (random) timer so we can come check for collision before actually
      * doing the transmit */
@@ -164,7 +194,18 @@ class RadioLibInterface : public RadioInterface, protected concurrency::Notified
     void startTransmitTimerSNR(float snr);
 
     void handleTransmitInterrupt();
-    void handleReceiveInterrupt();
+
+    /** An RX interrupt with rxActivityIrq, note it if it was for the start of a packet rather than its end.
+     *  @return true if that's all it was */
+    bool handleRxActivityInterrupt();
+
+    /** Drain the frame the radio just received out of its FIFO.
+     *  @return how many packets it put in received, to deliver once we are listening again.  None if it was bad or ignored,
+     *  several if it was an aggregate */
+    size_t handleReceiveInterrupt(meshtastic_MeshPacket **received);
+
+    /// A received packet, as if the frame had been h followed by payload
+    meshtastic_MeshPacket *packetFromFrame(const PacketHeader &h, const uint8_t *payload, size_t len);
 
     static void timerCallback(void *p1, uint32_t p2);
 
@@ -174,15 +215,36 @@ class RadioLibInterface : public RadioInterface, protected concurrency::Notified
      *  This method is virtual so subclasses can hook as needed, subclasses should not call directly
      *  @return true if packet was sent
      */
-    virtual bool startSend(meshtastic_MeshPacket *txp);
+    virtual bool startSend(meshtastic_MeshPacket *txp, meshtastic_MeshPacket *const *more = NULL, size_t numMore = 0,
+                           bool protect = false);
+
+    /**
+     * Take the packets out of txQueue that can go in the same frame as lead, see FrameAggregation.
+     * @param frameLen set to the length of the frame that will carry lead
+     * @return how many packets went into more
+     */
+    size_t takeAggregateParts(const meshtastic_MeshPacket *lead, meshtastic_MeshPacket **more, size_t &frameLen);
 
     meshtastic_QueueStatus getQueueStatus();
 
+    /** The most packets there have been in our TX queue at once */
+    size_t getTxQueueHighWater() { return txQueue.getHighWater(); }
+
   protected:
     uint32_t activeReceiveStart = 0;
 
     bool receiveDetected(uint16_t irq, ulong syncWordHeaderValidFlag, ulong preambleDetectedFlag);
 
+    /// Set by subclasses that listen with MESHTASTIC_RADIOLIB_IRQ_RX_MASK, so the start of a packet interrupts us too
+    bool rxActivityIrq = false;
+
+    /// RX_SEEN_* for the packet coming in, as its interrupts told us
+    uint8_t rxSeen = 0;
+    static const uint8_t RX_SEEN_PREAMBLE = 1, RX_SEEN_HEADER = 2;
+
+    /// isActivelyReceiving() for radios with rxActivityIrq, from what the interrupts told us instead of over SPI
+    bool rxActivitySeen();
+
     /** Do any hardware setup needed on entry into send configuration for the radio.
      * Subclasses can customize, but must also call this base method */
     virtual void configHardwareForSend();
@@ -194,6 +256,13 @@ class RadioLibInterface : public RadioInterface, protected concurrency::Notified
      * Raw ISR handler that just calls our polymorphic method
      */
     static void isrRxLevel0();
+#if MAX_RADIO_INTERFACES > 1
+    static void isrRxLevel1();
+#endif
+
+    /// The RX and TX ISR handlers that find this radio
+    void (*rxIsr() const)();
+    void (*txIsr() const)();
 
     /**
      * If a send was in progress finish it and return the buffer to the pool */
@@ -0,0 +1,145 @@
+#include "ReedSolomon.h"
+#include <string.h>
+
+uint8_t ReedSolomon::gfExp[512], ReedSolomon::gfLog[256];
+bool ReedSolomon::ready;
+
+void ReedSolomon::init()
+{
+    // Powers of alpha = 2 modulo x^8 + x^4 + x^3 + x^2 + 1, twice over so mul() doesn't have to reduce
+    uint16_t x = 1;
+    for (int i = 0; i < 255; i++) {
+        gfExp[i] = x;
+        gfLog[x] = i;
+        x <<= 1;
+        if (x & 0x100)
+            x ^= 0x11d;
+    }
+    for (int i = 255; i < 512; i++)
+        gfExp[i] = gfExp[i - 255];
+    ready = true;
+}
+
+uint8_t ReedSolomon::eval(const uint8_t *p, size_t len, uint8_t x)
+{
+    uint8_t y = 0;
+    for (size_t i = len; i-- > 0;)
+        y = mul(y, x) ^ p[i];
+    return y;
+}
+
+void ReedSolomon::encode(uint8_t *data, size_t len, uint8_t numParity)
+{
+    if (!ready)
+        init();
+
+    // Generator (x - alpha^0)...(x - alpha^(numParity-1)), highest power first
+    uint8_t g[REED_SOLOMON_MAX_PARITY + 1] = {1};
+    for (uint8_t i = 0; i < numParity; i++) {
+        for (uint8_t j = i + 1; j > 0; j--)
+            g[j] ^= mul(g[j - 1], gfExp[i]);
+    }
+
+    // What's left of data * x^numParity divided by the generator
+    uint8_t *parity = data + len;
+    memset(parity, 0, numParity);
+    for (size_t i = 0; i < len; i++) {
+        uint8_t feedback = data[i] ^ parity[0];
+        for (uint8_t j = 0; j + 1 < numParity; j++)
+            parity[j] = parity[j + 1] ^ mul(feedback, g[j + 1]);
+        parity[numParity - 1] = mul(feedback, g[numParity]);
+    }
+}
+
+bool ReedSolomon::syndromes(const uint8_t *codeword, size_t len, uint8_t numParity, uint8_t *s)
+{
+    bool clean = true;
+    for (uint8_t i = 0; i < numParity; i++) {
+        uint8_t x = gfExp[i], y = 0;
+        for (size_t j = 0; j < len; j++)
+            y = mul(y, x) ^ codeword[j];
+        s[i] = y;
+        clean = clean && !y;
+    }
+    return clean;
+}
+
+bool ReedSolomon::isCodeword(const uint8_t *codeword, size_t len, uint8_t numParity)
+{
+    if (!ready)
+        init();
+    if (len <= numParity || len > 255)
+        return false;
+
+    uint8_t s[REED_SOLOMON_MAX_PARITY];
+    return syndromes(codeword, len, numParity, s);
+}
+
+bool ReedSolomon::decode(uint8_t *codeword, size_t len, uint8_t numParity)
+{
+    if (!ready)
+        init();
+    if (len <= numParity || len > 255)
+        return false;
+
+    uint8_t s[REED_SOLOMON_MAX_PARITY];
+    if (syndromes(codeword, len, numParity, s))
+        return true;
+
+    // Berlekamp-Massey for the error locator, lowest power first
+    uint8_t locator[REED_SOLOMON_MAX_PARITY + 1] = {1}, prev[REED_SOLOMON_MAX_PARITY + 1] = {1};
+    uint8_t numErrors = 0, shift = 1, prevDiscrepancy = 1;
+    for (uint8_t n = 0; n < numParity; n++) {
+        uint8_t d = s[n];
+        for (uint8_t i = 1; i <= numErrors; i++)
+            d ^= mul(locator[i], s[n - i]);
+        if (!d) {
+            shift++;
+            continue;
+        }
+        uint8_t saved[REED_SOLOMON_MAX_PARITY + 1];
+        memcpy(saved, locator, sizeof(saved));
+        uint8_t scale = div(d, prevDiscrepancy);
+        for (uint8_t i = 0; i + shift <= numParity; i++)
+            locator[i + shift] ^= mul(scale, prev[i]);
+        if (2 * numErrors <= n) {
+            numErrors = n + 1 - numErrors;
+            memcpy(prev, saved, sizeof(prev));
+            prevDiscrepancy = d;
+            shift = 1;
+        } else {
+            shift++;
+        }
+    }
+    if (2 * numErrors > numParity)
+        return false;
+
+    // Error evaluator: syndromes times locator, modulo x^numParity
+    uint8_t evaluator[REED_SOLOMON_MAX_PARITY] = {0};
+    for (uint8_t i = 0; i < numParity; i++)
+        for (uint8_t j = 0; j <= numErrors && j <= i; j++)
+            evaluator[i] ^= mul(s[i - j], locator[j]);
+
+    // Formal derivative of the locator, only odd powers survive in GF(2^8)
+    uint8_t derivative[REED_SOLOMON_MAX_PARITY] = {0};
+    for (uint8_t i = 1; i <= numErrors; i += 2)
+        derivative[i - 1] = locator[i];
+
+    // Chien search for the positions, Forney for what to fix them with
+    uint8_t found = 0;
+    for (size_t j = 0; j < len; j++) {
+        uint8_t power = (len - 1 - j) % 255;    // Byte j is the coefficient of x^power
+        uint8_t xInv = gfExp[255 - power];      // X^-1, X = alpha^power
+        if (eval(locator, numErrors + 1, xInv)) // Not a root
+            continue;
+        uint8_t denominator = eval(derivative, numErrors, xInv);
+        if (!denominator)
+            return false;
+        codeword[j] ^= mul(gfExp[power], div(eval(evaluator, numParity, xInv), denominator));
+        found++;
+    }
+    if (found != numErrors)
+        return false; // The locator's roots aren't all in the codeword, more damage than we can tell apart
+
+    return syndromes(codeword, len, numParity, s);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define REED_SOLOMON_MAX_PARITY 32
+
+/**
+ * Reed-Solomon over GF(256), in as short a codeword as the data needs: len bytes of data followed by numParity bytes of
+ * parity, 255 bytes at most.  Up to numParity / 2 bytes anywhere in the codeword can be wrong and still be told apart from
+ * the right ones and corrected.
+ */
+class ReedSolomon
+{
+  public:
+    /// Put numParity (even, at most REED_SOLOMON_MAX_PARITY) bytes of parity for data[0, len) at data + len
+    static void encode(uint8_t *data, size_t len, uint8_t numParity);
+
+    /**
+     * Correct codeword[0, len), the last numParity bytes of which are parity, in place.
+     * @return false if it is too damaged, it may have been changed by then
+     */
+    static bool decode(uint8_t *codeword, size_t len, uint8_t numParity);
+
+    /// Is codeword[0, len) exactly as encode() left it, without trying to correct anything
+    static bool isCodeword(const uint8_t *codeword, size_t len, uint8_t numParity);
+
+  private:
+    static uint8_t gfExp[512], gfLog[256];
+    static bool ready;
+
+    static void init();
+    static uint8_t mul(uint8_t a, uint8_t b) { return a && b ? gfExp[gfLog[a] + gfLog[b]] : 0; }
+    static uint8_t div(uint8_t a, uint8_t b) { return a ? gfExp[gfLog[a] + 255 - gfLog[b]] : 0; }
+
+    /// The value at x of polynomial p[0, len), lowest power first
+    static uint8_t eval(const uint8_t *p, size_t len, uint8_t x);
+
+    /// @return true if every syndrome is 0, that is codeword is a valid one
+    static bool syndromes(const uint8_t *codeword, size_t len, uint8_t numParity, uint8_t *s);
+};
@@ -1,6 +1,7 @@
 #include "ReliableRouter.h"
 #include "Default.h"
 #include "MeshTypes.h"
+#include "NodeDB.h"
 #include "configuration.h"
 #include "mesh-pb-constants.h"
 #include "modules/NodeInfoModule.h"
@@ -14,6 +15,12 @@
  */
 ErrorCode ReliableRouter::send(meshtastic_MeshPacket *p)
 {
+#if ACK_COALESCING
+    // The ACKs we hold for this peer go right in front of it, a response stands in for the ACK of its request
+    if (isFromUs(p) && !isBroadcast(p->to))
+        flushAcks(p->to, p->which_payload_variant == meshtastic_MeshPacket_decoded_tag ? p->decoded.request_id : 0);
+#endif
+
     if (p->want_ack) {
         // If someone asks for acks on broadcast, we need the hop limit to be at least one, so that first node that receives our
         // message will rebroadcast.  But asking for hop_limit 0 in that context means the client app has no preference on hop
@@ -98,10 +105,9 @@ void ReliableRouter::sniffReceived(const meshtastic_MeshPacket *p, const meshtas
                 // A response may be set to want_ack for retransmissions, but we don't need to ACK a response if it received an
                 // implicit ACK already. If we received it directly, only ACK with a hop limit of 0
                 if (!p->decoded.request_id)
-                    sendAckNak(meshtastic_Routing_Error_NONE, getFrom(p), p->id, p->channel,
-                               routingModule->getHopLimitForResponse(p->hop_start, p->hop_limit));
+                    sendAck(p, routingModule->getHopLimitForResponse(p->hop_start, p->hop_limit));
                 else if (p->hop_start > 0 && p->hop_start == p->hop_limit)
-                    sendAckNak(meshtastic_Routing_Error_NONE, getFrom(p), p->id, p->channel, 0);
+                    sendAck(p, 0);
             } else if (p->which_payload_variant == meshtastic_MeshPacket_encrypted_tag && p->channel == 0 &&
                        (nodeDB->getMeshNode(p->from) == nullptr || nodeDB->getMeshNode(p->from)->user.public_key.size == 0)) {
                 LOG_INFO("PKI packet from unknown node, send PKI_UNKNOWN_PUBKEY");
@@ -113,7 +119,9 @@ void ReliableRouter::sniffReceived(const meshtastic_MeshPacket *p, const meshtas
                            routingModule->getHopLimitForResponse(p->hop_start, p->hop_limit));
             }
         }
-        if (p->which_payload_variant == meshtastic_MeshPacket_decoded_tag && c &&
+        // error_reason shares its storage with the route of a multi-ACK
+        bool isError = c && c->which_variant == meshtastic_Routing_error_reason_tag;
+        if (p->which_payload_variant == meshtastic_MeshPacket_decoded_tag && isError &&
             c->error_reason == meshtastic_Routing_Error_PKI_UNKNOWN_PUBKEY) {
             if (owner.public_key.size == 32) {
                 LOG_INFO("PKI decrypt failure, send a NodeInfo");
@@ -121,16 +129,17 @@ void ReliableRouter::sniffReceived(const meshtastic_MeshPacket *p, const meshtas
             }
         }
         // We consider an ack to be either a !routing packet with a request ID or a routing packet with !error
-        PacketId ackId = ((c && c->error_reason == meshtastic_Routing_Error_NONE) || !c) ? p->decoded.request_id : 0;
+        PacketId ackId = (!isError || c->error_reason == meshtastic_Routing_Error_NONE) ? p->decoded.request_id : 0;
 
         // A nak is a routing packt that has an  error code
-        PacketId nakId = (c && c->error_reason != meshtastic_Routing_Error_NONE) ? p->decoded.request_id : 0;
+        PacketId nakId = (isError && c->error_reason != meshtastic_Routing_Error_NONE) ? p->decoded.request_id : 0;
 
         // We intentionally don't check wasSeenRecently, because it is harmless to delete non existent retransmission records
         if (ackId || nakId) {
             LOG_DEBUG("Received a %s for 0x%x, stopping retransmissions", ackId ? "ACK" : "NAK", ackId);
             if (ackId) {
                 stopRetransmission(p->to, ackId);
+                stopRetransmissionsAckedBy(p, c);
             } else {
                 stopRetransmission(p->to, nakId);
             }
@@ -139,4 +148,103 @@ void ReliableRouter::sniffReceived(const meshtastic_MeshPacket *p, const meshtas
 
     // handle the packet as normal
     isBroadcast(p->to) ? FloodingRouter::sniffReceived(p, c) : NextHopRouter::sniffReceived(p, c);
-}
\ No newline at end of file
+}
+
+/**
+ * ACKs for a peer that understands multi-ACKs wait for the next of its packets, for about as long as the one we ACK took to
+ * send, so a burst of them gets one ACK.  Its retransmission timer allows for twice that plus the contention window, and every
+ * packet it sends in the meantime pushes it back further (see send()).
+ */
+void ReliableRouter::sendAck(const meshtastic_MeshPacket *p, uint8_t hopLimit)
+{
+#if ACK_COALESCING
+    NodeNum to = getFrom(p);
+    const meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(to);
+    if (iface && !isFromUs(p) && node && (node->bitfield & NODEINFO_BITFIELD_READS_MULTI_ACK_MASK)) {
+        PendingAcks *acks = NULL;
+        for (size_t i = 0; i < ACK_COALESCE_PEERS && !acks; i++)
+            if (pendingAcks[i].to == to)
+                acks = &pendingAcks[i];
+        if (acks && acks->channel != p->channel)
+            flushAcks(*acks); // One packet can't ACK on two channels, start over
+        if (!acks || !acks->to) {
+            if (!acks) {
+                // A free slot, or else the one that is due first
+                acks = &pendingAcks[0];
+                for (size_t i = 0; i < ACK_COALESCE_PEERS && acks->to; i++)
+                    if (!pendingAcks[i].to || (int32_t)(pendingAcks[i].dueMsec - acks->dueMsec) < 0)
+                        acks = &pendingAcks[i];
+                if (acks->to)
+                    flushAcks(*acks);
+            }
+            acks->to = to;
+            acks->channel = p->channel;
+            acks->hopLimit = hopLimit;
+            acks->numIds = 0;
+            acks->dueMsec = millis() + min(iface->getPacketTime(p), (uint32_t)ACK_COALESCE_MAX_MSEC);
+        }
+        acks->ids[acks->numIds++] = p->id;
+        if (hopLimit > acks->hopLimit)
+            acks->hopLimit = hopLimit;
+        if (acks->numIds == ACK_COALESCE_MAX_IDS)
+            flushAcks(*acks);
+        else
+            setReceivedMessage(); // So runOnce() works out when to wake up for it
+        return;
+    }
+#endif
+    sendAckNak(meshtastic_Routing_Error_NONE, getFrom(p), p->id, p->channel, hopLimit);
+}
+
+void ReliableRouter::flushAcks(NodeNum to, PacketId exceptId)
+{
+    for (size_t i = 0; i < ACK_COALESCE_PEERS; i++)
+        if (pendingAcks[i].to == to)
+            flushAcks(pendingAcks[i], exceptId);
+}
+
+void ReliableRouter::flushAcks(PendingAcks &acks, PacketId exceptId)
+{
+    // Let go of the slot first, sending comes back through send()
+    PendingAcks batch = acks;
+    acks.to = 0;
+
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < batch.numIds; i++)
+        if (batch.ids[i] != exceptId)
+            batch.ids[n++] = batch.ids[i];
+
+    if (n == 1) {
+        sendAckNak(meshtastic_Routing_Error_NONE, batch.to, batch.ids[0], batch.channel, batch.hopLimit);
+    } else if (n > 1) {
+        LOG_DEBUG("Send one ACK for %u packets from 0x%x", n, batch.to);
+        routingModule->sendMultiAck(batch.to, batch.ids, n, batch.channel, batch.hopLimit);
+    }
+}
+
+int32_t ReliableRouter::flushDueAcks()
+{
+    int32_t next = INT32_MAX;
+    uint32_t now = millis();
+    for (size_t i = 0; i < ACK_COALESCE_PEERS; i++) {
+        if (!pendingAcks[i].to)
+            continue;
+        int32_t left = pendingAcks[i].dueMsec - now;
+        if (left <= 0)
+            flushAcks(pendingAcks[i]);
+        else if (left < next)
+            next = left;
+    }
+    return next;
+}
+
+void ReliableRouter::heardNodeInfo(NodeNum node, const meshtastic_Data &d)
+{
+    meshtastic_NodeInfoLite *info = nodeDB->getMeshNode(node);
+    if (!info)
+        return;
+    if (d.has_bitfield && (d.bitfield & BITFIELD_READS_MULTI_ACK_MASK))
+        info->bitfield |= NODEINFO_BITFIELD_READS_MULTI_ACK_MASK;
+    else
+        info->bitfield &= ~NODEINFO_BITFIELD_READS_MULTI_ACK_MASK;
+}
@@ -2,8 +2,39 @@
 
 #include "NextHopRouter.h"
 
+// Set to 0 to send every ACK on its own straight away
+#ifndef ACK_COALESCING
+#define ACK_COALESCING 1
+#endif
+// Longest we hold an ACK back waiting for more to send with it, it is never held longer than the acked packet took to send
+#ifndef ACK_COALESCE_MAX_MSEC
+#define ACK_COALESCE_MAX_MSEC 3000
+#endif
+#define ACK_COALESCE_PEERS 4 // Peers we can hold ACKs for at once
+// One in request_id, the others in the route of a route_reply
+#define ACK_COALESCE_MAX_IDS (1 + sizeof(meshtastic_RouteDiscovery::route) / sizeof(meshtastic_RouteDiscovery::route[0]))
+
+/**
+ * ACKs for one peer that we are holding back, so they go out together
+ */
+struct PendingAcks {
+    NodeNum to; // 0 if unused
+    ChannelIndex channel;
+    uint8_t hopLimit;
+    uint8_t numIds;
+    uint32_t dueMsec;
+    PacketId ids[ACK_COALESCE_MAX_IDS];
+};
+
 /**
  * This is a mixin that extends Router with the ability to do (one hop only) reliable message sends.
+ *
+ * A peer that sends us a burst of want_ack packets (bulk DMs, an admin session) would get one ACK transmission for each.  If
+ * its NodeInfo says it understands them (BITFIELD_READS_MULTI_ACK), we hold its ACKs back for about as long as the next of
+ * its packets takes to arrive and send them as one multi-ACK: a routing packet with the first id in request_id, like any ACK,
+ * and the others in the route of a route_reply.  Older relays only look at request_id, so they handle it like a plain ACK.
+ * The held ACKs go out early when we send the peer anything else, so they share its frame if FrameAggregation is on, and
+ * a response drops the ACK it already stands in for.
  */
 class ReliableRouter : public NextHopRouter
 {
@@ -21,6 +52,17 @@ class ReliableRouter : public NextHopRouter
      */
     virtual ErrorCode send(meshtastic_MeshPacket *p) override;
 
+    /** Do our retransmission handling, and send the ACKs we have held back long enough */
+    virtual int32_t runOnce() override
+    {
+        int32_t r = NextHopRouter::runOnce();
+        int32_t d = flushDueAcks();
+        return min(r, d);
+    }
+
+    /// Note what a NodeInfo from node said about reading multi-ACKs
+    static void heardNodeInfo(NodeNum node, const meshtastic_Data &d);
+
   protected:
     /**
      * Look for acks/naks or someone retransmitting us
@@ -31,4 +73,17 @@ class ReliableRouter : public NextHopRouter
      * We hook this method so we can see packets before FloodingRouter says they should be discarded
      */
     virtual bool shouldFilterReceived(const meshtastic_MeshPacket *p) override;
+
+  private:
+    PendingAcks pendingAcks[ACK_COALESCE_PEERS] = {};
+
+    /** ACK p, now or together with the next ones for the same peer */
+    void sendAck(const meshtastic_MeshPacket *p, uint8_t hopLimit);
+
+    /** Send whatever ACKs we hold for to, apart from the one for exceptId which someone else took care of */
+    void flushAcks(NodeNum to, PacketId exceptId = 0);
+    void flushAcks(PendingAcks &acks, PacketId exceptId = 0);
+
+    /** Send the held ACKs that are due, @return msecs until the next ones are or INT32_MAX */
+    int32_t flushDueAcks();
 };
\ No newline at end of file
@@ -1,10 +1,16 @@
 #include "Router.h"
+#include "AutoHopLimit.h"
 #include "Channels.h"
 #include "CryptoEngine.h"
+#include "LinkQuality.h"
+#include "LinkRate.h"
 #include "MeshRadio.h"
 #include "MeshService.h"
 #include "NodeDB.h"
+#include "PacketLatency.h"
+#include "PerfCounters.h"
 #include "RTC.h"
+#include "TextCompression.h"
 #include "configuration.h"
 #include "detect/LoRaRadioType.h"
 #include "main.h"
@@ -22,22 +28,42 @@
 #include "serialization/MeshPacketSerializer.h"
 #endif
 
-#define MAX_RX_FROMRADIO                                                                                                         \
-    4 // max number of packets destined to our queue, we dispatch packets quickly so it doesn't need to be big
+// Max number of packets destined to our queue.  They wait there as WirePackets, so this is mostly WirePacket slots
+#define MAX_RX_FROMRADIO (WIRE_PACKET_SMALL_SLOTS + WIRE_PACKET_LARGE_SLOTS)
+
+// Packets in that queue which are held whole rather than as WirePackets (not encrypted, or carrying a public key)
+#define MAX_RX_FROMRADIO_FULL 2
 
 // I think this is right, one packet for each of the three fifos + one packet being currently assembled for TX or RX
 // And every TX packet might have a retransmission packet or an ack alive at any moment
 #define MAX_PACKETS                                                                                                              \
-    (MAX_RX_TOPHONE + MAX_RX_FROMRADIO + 2 * MAX_TX_QUEUE +                                                                      \
+    (MAX_RX_TOPHONE + MAX_RX_FROMRADIO_FULL + 2 * MAX_TX_QUEUE +                                                                 \
      2) // max number of packets which can be in flight (either queued from reception or queued for sending)
 
-// static MemoryPool<MeshPacket> staticPool(MAX_PACKETS);
-static MemoryDynamic<meshtastic_MeshPacket> staticPool;
+// How many of those live in the preallocated pool, anything beyond that falls back to the heap (and is counted)
+#ifndef MAX_PACKETS_STATIC
+#if defined(ARCH_STM32WL)
+#define MAX_PACKETS_STATIC 8
+#else
+#define MAX_PACKETS_STATIC MAX_PACKETS
+#endif
+#endif
+
+static MemoryStatic<meshtastic_MeshPacket, MAX_PACKETS_STATIC> staticPool;
 
 Allocator<meshtastic_MeshPacket> &packetPool = staticPool;
 
 static uint8_t bytes[MAX_LORA_PAYLOAD_LEN + 1] __attribute__((__aligned__));
 
+DecryptStats decryptStats;
+
+#define CHANNEL_HINT_SLOTS 32 // Direct mapped by sender, remembers which channel last decoded for them
+
+static struct {
+    NodeNum from;
+    ChannelIndex chIndex;
+} channelHints[CHANNEL_HINT_SLOTS];
+
 /**
  * Constructor
  *
@@ -52,6 +78,7 @@ Router::Router() : concurrency::OSThread("Router"), fromRadioQueue(MAX_RX_FROMRA
     LOG_DEBUG("Size of MeshPacket %d", sizeof(MeshPacket)); */
 
     fromRadioQueue.setReader(this);
+    setPriority(concurrency::PRIORITY_RADIO);
 
     // init Lockguard for crypt operations
     assert(!cryptLock);
@@ -64,9 +91,11 @@ Router::Router() : concurrency::OSThread("Router"), fromRadioQueue(MAX_RX_FROMRA
  */
 int32_t Router::runOnce()
 {
-    meshtastic_MeshPacket *mp;
-    while ((mp = fromRadioQueue.dequeuePtr(0)) != NULL) {
+    WirePacket *w;
+    while ((w = fromRadioQueue.dequeuePtr(0)) != NULL) {
+        meshtastic_MeshPacket *mp = w->expand();
         // printPacket("handle fromRadioQ", mp);
+        packetLatency.mark(PACKET_STAGE_ROUTER_HANDLED, mp->from, mp->id);
         perhapsHandleReceived(mp);
     }
 
@@ -80,19 +109,62 @@ int32_t Router::runOnce()
  */
 void Router::enqueueReceivedMessage(meshtastic_MeshPacket *p)
 {
-    // Try enqueue until successful
-    while (!fromRadioQueue.enqueue(p, 0)) {
-        meshtastic_MeshPacket *old_p;
-        old_p = fromRadioQueue.dequeuePtr(0); // Dequeue and discard the oldest packet
-        if (old_p) {
-            printPacket("fromRadioQ full, drop oldest!", old_p);
-            packetPool.release(old_p);
-        }
-    }
+    NodeNum from = p->from;
+    PacketId id = p->id;
+    WirePacket *w = WirePacket::fromPacket(p);
+    if (!fromRadioQueue.enqueue(w, 0))
+        admitReceived(w); // Might free w
+    packetLatency.mark(PACKET_STAGE_ROUTER_QUEUED, from, id);
     // Nasty hack because our threading is primitive.  interfaces shouldn't need to know about routers FIXME
     setReceivedMessage();
 }
 
+RxAdmitClass Router::rxAdmitClass(const WirePacket *w)
+{
+    meshtastic_MeshPacket scratch;
+    const meshtastic_MeshPacket *p = w->view(scratch);
+    if (isToUs(p) || isFromUs(p))
+        return RX_ADMIT_FOR_US;
+    if (wasSeenRecently(p, false))
+        return RX_ADMIT_DUPLICATE;
+    return p->want_ack ? RX_ADMIT_RELIABLE : RX_ADMIT_FLOOD;
+}
+
+/**
+ * The queue is only MAX_RX_FROMRADIO deep, so we take everything out, choose, and put the rest back in the same order.
+ * The victim is the lowest class, within a class the one with the fewest hops left (least use to relay), then the oldest.
+ */
+void Router::admitReceived(WirePacket *w)
+{
+    static const char *const classNames[RX_ADMIT_CLASSES] = {"duplicate", "flood", "reliable", "for us"};
+
+    WirePacket *held[MAX_RX_FROMRADIO + 1];
+    uint8_t values[MAX_RX_FROMRADIO + 1];
+    size_t n = 0;
+    while (n < MAX_RX_FROMRADIO && (held[n] = fromRadioQueue.dequeuePtr(0)) != NULL)
+        n++;
+    held[n++] = w;
+
+    size_t victim = 0;
+    for (size_t i = 0; i < n; i++) {
+        values[i] = (rxAdmitClass(held[i]) << 4) | (held[i]->hop_limit & 0x0f);
+        if (values[i] < values[victim])
+            victim = i;
+    }
+
+    RxAdmitClass c = (RxAdmitClass)(values[victim] >> 4);
+    rxQueueDrops[c]++;
+    char reason[48];
+    snprintf(reason, sizeof(reason), "fromRadioQ full, drop %s", classNames[c]);
+    meshtastic_MeshPacket scratch;
+    printPacket(reason, held[victim]->view(scratch));
+    held[victim]->release();
+
+    for (size_t i = 0; i < n; i++)
+        if (i != victim)
+            fromRadioQueue.enqueue(held[i], 0);
+}
+
 /// Generate a unique packet id
 // FIXME, move this someplace better
 PacketId generatePacketId()
@@ -154,6 +226,41 @@ void Router::setReceivedMessage()
     runASAP = true;
 }
 
+void Router::addInterface(RadioInterface *_iface)
+{
+    if (!iface)
+        iface = _iface;
+#if MAX_RADIO_INTERFACES > 1
+    if (numIfaces < MAX_RADIO_INTERFACES)
+        ifaces[numIfaces++] = _iface;
+#endif
+}
+
+void Router::heardOnInterface(const meshtastic_MeshPacket *p, RadioInterface *radio)
+{
+#if MAX_RADIO_INTERFACES > 1
+    for (size_t i = 0; i < numIfaces; i++) {
+        if (ifaces[i] == radio) {
+            heardOn[p->relay_node] = i + 1;
+            return;
+        }
+    }
+#endif
+}
+
+#if MAX_RADIO_INTERFACES > 1
+RadioInterface *Router::interfaceFor(const meshtastic_MeshPacket *p) const
+{
+    // A relayer is a neighbour on the radio we heard it on, and a unicast's destination may well be one too
+    uint8_t hop = p->next_hop;
+    if (hop == NO_NEXT_HOP_PREFERENCE && !isBroadcast(p->to))
+        hop = nodeDB->getLastByteOfNodeNum(p->to);
+    if (hop == NO_NEXT_HOP_PREFERENCE || !heardOn[hop])
+        return NULL;
+    return ifaces[heardOn[hop] - 1];
+}
+#endif
+
 meshtastic_QueueStatus Router::getQueueStatus()
 {
     if (!iface) {
@@ -188,7 +295,7 @@ ErrorCode Router::sendLocal(meshtastic_MeshPacket *p, RxSource src)
 
         // don't override if a channel was requested and no need to set it when PKI is enforced
         if (!p->channel && !p->pki_encrypted && !isBroadcast(p->to)) {
-            meshtastic_NodeInfoLite const *node = nodeDB->getMeshNode(p->to);
+            const NodeHot *node = nodeDB->getHotNode(p->to);
             if (node) {
                 p->channel = node->channel;
                 LOG_DEBUG("localSend to channel %d", p->channel);
@@ -202,9 +309,33 @@ ErrorCode Router::sendLocal(meshtastic_MeshPacket *p, RxSource src)
  * Send a packet on a suitable interface.
  */
 ErrorCode Router::rawSend(meshtastic_MeshPacket *p)
+{
+    return sendOnInterfaces(p, p->which_payload_variant == meshtastic_MeshPacket_decoded_tag ? p->decoded.portnum
+                                                                                              : AIRTIME_PORT_ENCRYPTED);
+}
+
+ErrorCode Router::sendOnInterfaces(meshtastic_MeshPacket *p, uint32_t portnum)
 {
     assert(iface); // This should have been detected already in sendLocal (or we just received a packet from outside)
-    return iface->send(p);
+    RadioInterface *radio = iface;
+#if MAX_RADIO_INTERFACES > 1
+    if (numIfaces > 1) {
+        radio = interfaceFor(p);
+        if (!radio) {
+            // Floods, and unicasts we don't know the way for, go out on every radio, the first one sends p itself
+            radio = iface;
+            for (size_t i = 1; i < numIfaces; i++) {
+                meshtastic_MeshPacket *copy = packetPool.allocCopy(*p);
+                if (airTime)
+                    airTime->logTalker(getFrom(p), portnum, ifaces[i]->getPacketTime(copy));
+                ifaces[i]->send(copy);
+            }
+        }
+    }
+#endif
+    if (airTime)
+        airTime->logTalker(getFrom(p), portnum, radio->getPacketTime(p));
+    return radio->send(p);
 }
 
 /**
@@ -260,8 +391,10 @@ ErrorCode Router::send(meshtastic_MeshPacket *p)
 
     p->relay_node = nodeDB->getLastByteOfNodeNum(getNodeNum()); // set the relayer to us
     // If we are the original transmitter, set the hop limit with which we start
-    if (isFromUs(p))
+    if (isFromUs(p)) {
+        p->hop_limit = autoHopLimit.forPacket(p, Default::getConfiguredOrDefaultHopLimit(config.lora.hop_limit));
         p->hop_start = p->hop_limit;
+    }
 
     // If the packet hasn't yet been encrypted, do so now (it might already be encrypted if we are just forwarding it)
 
@@ -272,8 +405,11 @@ ErrorCode Router::send(meshtastic_MeshPacket *p)
 
     fixPriority(p); // Before encryption, fix the priority if it's unset
 
+    uint32_t portnum = AIRTIME_PORT_ENCRYPTED; // Relaying something we can't read
+
     // If the packet is not yet encrypted, do so now
     if (p->which_payload_variant == meshtastic_MeshPacket_decoded_tag) {
+        portnum = p->decoded.portnum;
         ChannelIndex chIndex = p->channel; // keep as a local because we are about to change it
         meshtastic_MeshPacket *p_decoded = packetPool.allocCopy(*p);
 
@@ -299,14 +435,18 @@ ErrorCode Router::send(meshtastic_MeshPacket *p)
     }
 #endif
 
-    assert(iface); // This should have been detected already in sendLocal (or we just received a packet from outside)
-    return iface->send(p);
+    return sendOnInterfaces(p, portnum);
 }
 
 /** Attempt to cancel a previously sent packet.  Returns true if a packet was found we could cancel */
 bool Router::cancelSending(NodeNum from, PacketId id)
 {
-    if (iface && iface->cancelSending(from, id)) {
+    bool canceled = iface && iface->cancelSending(from, id);
+#if MAX_RADIO_INTERFACES > 1
+    for (size_t i = 1; i < numIfaces; i++)
+        canceled |= ifaces[i]->cancelSending(from, id);
+#endif
+    if (canceled) {
         // We are not a relayer of this packet anymore
         removeRelayer(nodeDB->getLastByteOfNodeNum(nodeDB->getNodeNum()), id, from);
         return true;
@@ -317,6 +457,11 @@ bool Router::cancelSending(NodeNum from, PacketId id)
 /** Attempt to find a packet in the TxQueue. Returns true if the packet was found. */
 bool Router::findInTxQueue(NodeNum from, PacketId id)
 {
+#if MAX_RADIO_INTERFACES > 1
+    for (size_t i = 1; i < numIfaces; i++)
+        if (ifaces[i]->findInTxQueue(from, id))
+            return true;
+#endif
     return iface->findInTxQueue(from, id);
 }
 
@@ -329,8 +474,44 @@ void Router::sniffReceived(const meshtastic_MeshPacket *p, const meshtastic_Rout
     // FIXME, update nodedb here for any packet that passes through us
 }
 
+/**
+ * Try to decrypt and decode p with the PSK of one channel, on success p is changed to the decoded variant
+ */
+static bool tryDecryptChannel(meshtastic_MeshPacket *p, ChannelIndex chIndex, size_t rawSize)
+{
+    // Try to use this hash/channel pair
+    if (!channels.decryptForHash(chIndex, p->channel))
+        return false;
+
+    decryptStats.attempts++;
+    // we have to copy into a scratch buffer, because these bytes are a union with the decoded protobuf. Create a
+    // fresh copy for each decrypt attempt.
+    memcpy(bytes, p->encrypted.bytes, rawSize);
+    // Try to decrypt the packet if we can
+    crypto->decrypt(p->from, p->id, rawSize, bytes);
+
+    // printBytes("plaintext", bytes, p->encrypted.size);
+
+    // Take those raw bytes and convert them back into a well structured protobuf we can understand
+    meshtastic_Data decodedtmp;
+    memset(&decodedtmp, 0, sizeof(decodedtmp));
+    if (!pb_decode_from_bytes(bytes, rawSize, &meshtastic_Data_msg, &decodedtmp)) {
+        LOG_ERROR("Invalid protobufs in received mesh packet id=0x%08x (bad psk?)!", p->id);
+    } else if (decodedtmp.portnum == meshtastic_PortNum_UNKNOWN_APP) {
+        LOG_ERROR("Invalid portnum (bad psk?)!");
+    } else {
+        p->decoded = decodedtmp;
+        p->which_payload_variant = meshtastic_MeshPacket_decoded_tag; // change type to decoded
+        return true;
+    }
+    decryptStats.wasted++;
+    LOG_DEBUG("Wasted %u of %u channel decrypt attempts", decryptStats.wasted, decryptStats.attempts);
+    return false;
+}
+
 DecodeState perhapsDecode(meshtastic_MeshPacket *p)
 {
+    PERF_SCOPE(PERF_DECODE);
     concurrency::LockGuard g(cryptLock);
 
     if (config.device.role == meshtastic_Config_DeviceConfig_Role_REPEATER &&
@@ -338,7 +519,7 @@ DecodeState perhapsDecode(meshtastic_MeshPacket *p)
         return DecodeState::DECODE_FAILURE;
 
     if (config.device.rebroadcast_mode == meshtastic_Config_DeviceConfig_RebroadcastMode_KNOWN_ONLY &&
-        (nodeDB->getMeshNode(p->from) == NULL || !nodeDB->getMeshNode(p->from)->has_user)) {
+        (nodeDB->getHotNode(p->from) == NULL || !(nodeDB->getHotNode(p->from)->flags & NODE_HOT_HAS_USER))) {
         LOG_DEBUG("Node 0x%x not in nodeDB-> Rebroadcast mode KNOWN_ONLY will ignore packet", p->from);
         return DecodeState::DECODE_FAILURE;
     }
@@ -388,31 +569,26 @@ DecodeState perhapsDecode(meshtastic_MeshPacket *p)
 
     // assert(p->which_payloadVariant == MeshPacket_encrypted_tag);
     if (!decrypted) {
-        // Try to find a channel that works with this hash
-        for (chIndex = 0; chIndex < channels.getNumChannels(); chIndex++) {
-            // Try to use this hash/channel pair
-            if (channels.decryptForHash(chIndex, p->channel)) {
-                // we have to copy into a scratch buffer, because these bytes are a union with the decoded protobuf. Create a
-                // fresh copy for each decrypt attempt.
-                memcpy(bytes, p->encrypted.bytes, rawSize);
-                // Try to decrypt the packet if we can
-                crypto->decrypt(p->from, p->id, rawSize, bytes);
-
-                // printBytes("plaintext", bytes, p->encrypted.size);
-
-                // Take those raw bytes and convert them back into a well structured protobuf we can understand
-                meshtastic_Data decodedtmp;
-                memset(&decodedtmp, 0, sizeof(decodedtmp));
-                if (!pb_decode_from_bytes(bytes, rawSize, &meshtastic_Data_msg, &decodedtmp)) {
-                    LOG_ERROR("Invalid protobufs in received mesh packet id=0x%08x (bad psk?)!", p->id);
-                } else if (decodedtmp.portnum == meshtastic_PortNum_UNKNOWN_APP) {
-                    LOG_ERROR("Invalid portnum (bad psk?)!");
-                } else {
-                    p->decoded = decodedtmp;
-                    p->which_payload_variant = meshtastic_MeshPacket_decoded_tag; // change type to decoded
-                    decrypted = true;
-                    break;
-                }
+        // Only channels whose hash matches can possibly decode this
+        uint8_t candidates = channels.getCandidatesForHash(p->channel);
+
+        // Start with whichever channel worked for this sender last time
+        auto &hint = channelHints[p->from % CHANNEL_HINT_SLOTS];
+        if (hint.from == p->from && (candidates & (1 << hint.chIndex))) {
+            candidates &= ~(1 << hint.chIndex);
+            if (tryDecryptChannel(p, hint.chIndex, rawSize)) {
+                chIndex = hint.chIndex;
+                decrypted = true;
+                decryptStats.hintHits++;
+            }
+        }
+
+        for (ChannelIndex i = 0; !decrypted && candidates; i++, candidates >>= 1) {
+            if ((candidates & 1) && tryDecryptChannel(p, i, rawSize)) {
+                chIndex = i;
+                decrypted = true;
+                hint.from = p->from;
+                hint.chIndex = i;
             }
         }
     }
@@ -422,25 +598,15 @@ DecodeState perhapsDecode(meshtastic_MeshPacket *p)
         if (p->decoded.has_bitfield)
             p->decoded.want_response |= p->decoded.bitfield & BITFIELD_WANT_RESPONSE_MASK;
 
-        /* Not actually ever used.
-        // Decompress if needed. jm
+        p->decoded.bitfield &= ~BITFIELD_WAS_COMPRESSED_MASK; // That one is ours, whatever the sender put there
         if (p->decoded.portnum == meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP) {
-            // Decompress the payload
-            char compressed_in[meshtastic_Constants_DATA_PAYLOAD_LEN] = {};
-            char decompressed_out[meshtastic_Constants_DATA_PAYLOAD_LEN] = {};
-            int decompressed_len;
-
-            memcpy(compressed_in, p->decoded.payload.bytes, p->decoded.payload.size);
-
-            decompressed_len = unishox2_decompress_simple(compressed_in, p->decoded.payload.size, decompressed_out);
-
-            // LOG_DEBUG("**Decompressed length - %d ", decompressed_len);
-
-            memcpy(p->decoded.payload.bytes, decompressed_out, decompressed_len);
-
-            // Switch the port from PortNum_TEXT_MESSAGE_COMPRESSED_APP to PortNum_TEXT_MESSAGE_APP
-            p->decoded.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
-        } */
+            if (TextCompression::decompress(p->decoded))
+                p->decoded.bitfield |= BITFIELD_WAS_COMPRESSED_MASK;
+            else
+                LOG_WARN("Can't decompress text from 0x%x", p->from);
+        }
+        if (linkRate)
+            linkRate->onDecoded(p);
 
         printPacket("decoded message", p);
 #if ENABLE_JSON_LOGGING
@@ -471,44 +637,26 @@ meshtastic_Routing_Error perhapsEncode(meshtastic_MeshPacket *p)
             p->decoded.has_bitfield = true;
             p->decoded.bitfield |= (config.lora.config_ok_to_mqtt << BITFIELD_OK_TO_MQTT_SHIFT);
             p->decoded.bitfield |= (p->decoded.want_response << BITFIELD_WANT_RESPONSE_SHIFT);
+            // Costs a byte, and saves whoever already has our NodeInfo from needing it broadcast again
+            if (isBroadcast(p->to) && p->decoded.portnum != meshtastic_PortNum_NODEINFO_APP) {
+                p->decoded.bitfield &= ~BITFIELD_USER_HASH_MASK;
+                p->decoded.bitfield |= BITFIELD_HAS_USER_HASH_MASK | (NodeDB::getOwnerHash() << BITFIELD_USER_HASH_SHIFT);
+            }
+            if (linkRate)
+                linkRate->onEncode(p);
         }
 
-        size_t numbytes = pb_encode_to_bytes(bytes, sizeof(bytes), &meshtastic_Data_msg, &p->decoded);
-
-        /* Not actually used, so save the cycles
-        //  TODO: Allow modules to opt into compression.
-        if (p->decoded.portnum == meshtastic_PortNum_TEXT_MESSAGE_APP) {
-
-            char original_payload[meshtastic_Constants_DATA_PAYLOAD_LEN];
-            memcpy(original_payload, p->decoded.payload.bytes, p->decoded.payload.size);
-
-            char compressed_out[meshtastic_Constants_DATA_PAYLOAD_LEN] = {0};
-
-            int compressed_len;
-            compressed_len = unishox2_compress_simple(original_payload, p->decoded.payload.size, compressed_out);
-
-            LOG_DEBUG("Original length - %d ", p->decoded.payload.size);
-            LOG_DEBUG("Compressed length - %d ", compressed_len);
-            LOG_DEBUG("Original message - %s ", p->decoded.payload.bytes);
-
-            // If the compressed length is greater than or equal to the original size, don't use the compressed form
-            if (compressed_len >= p->decoded.payload.size) {
-
-                LOG_DEBUG("Not using compressing message");
-                // Set the uncompressed payload variant anyway. Shouldn't hurt?
-                // p->decoded.which_payloadVariant = Data_payload_tag;
-
-                // Otherwise we use the compressor
-            } else {
-                LOG_DEBUG("Use compressed message");
-                // Copy the compressed data into the meshpacket
-
-                p->decoded.payload.size = compressed_len;
-                memcpy(p->decoded.payload.bytes, compressed_out, compressed_len);
-
-                p->decoded.portnum = meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP;
-            }
-        } */
+        // Text goes out compressed if everyone it is for can read it that way
+        bool compress = TextCompression::wanted(p);
+        p->decoded.bitfield &= ~BITFIELD_WAS_COMPRESSED_MASK; // Never goes on the wire
+        meshtastic_Data compressed;
+        meshtastic_Data *data = &p->decoded;
+        if (compress) {
+            compressed = p->decoded;
+            if (TextCompression::compress(compressed))
+                data = &compressed;
+        }
+        size_t numbytes = pb_encode_to_bytes(bytes, sizeof(bytes), &meshtastic_Data_msg, data);
 
         if (numbytes + MESHTASTIC_HEADER_LENGTH > MAX_LORA_PAYLOAD_LEN)
             return meshtastic_Routing_Error_TOO_LARGE;
@@ -598,12 +746,31 @@ NodeNum Router::getNodeNum()
     return nodeDB->getNodeNum();
 }
 
+/**
+ * Decide whether a received packet needs to be decrypted at all.  Dedup and the relay decision only look at the header, so
+ * a packet we merely pass along can stay encrypted unless someone here wants to read it.
+ */
+static bool isPlaintextNeeded(const meshtastic_MeshPacket *p)
+{
+    if (isBroadcast(p->to) || isToUs(p))
+        return true; // Goes to the phone, the nodeDB and our own modules
+#if !MESHTASTIC_EXCLUDE_MQTT
+    if (moduleConfig.mqtt.enabled)
+        return true; // Uplinked packets are published decoded
+#endif
+    if (!IS_ONE_OF(config.device.rebroadcast_mode, meshtastic_Config_DeviceConfig_RebroadcastMode_ALL,
+                   meshtastic_Config_DeviceConfig_RebroadcastMode_ALL_SKIP_DECODING))
+        return true; // The other rebroadcast modes filter on the portnum or on whether we could decode it
+    return MeshModule::anySnifferNeedsPlaintext();
+}
+
 /**
  * Handle any packet that is received by an interface on this node.
  * Note: some packets may merely being passed through this node and will be forwarded elsewhere.
  */
 void Router::handleReceived(meshtastic_MeshPacket *p, RxSource src)
 {
+    PERF_SCOPE(PERF_HANDLE_RECEIVED);
     bool skipHandle = false;
     // Also, we should set the time from the ISR and it should have msec level resolution
     p->rx_time = getValidTime(RTCQualityFromNet); // store the arrival timestamp for the phone
@@ -611,7 +778,8 @@ void Router::handleReceived(meshtastic_MeshPacket *p, RxSource src)
     meshtastic_MeshPacket *p_encrypted = packetPool.allocCopy(*p);
 
     // Take those raw bytes and convert them back into a well structured protobuf we can understand
-    auto decodedState = perhapsDecode(p);
+    auto decodedState = isPlaintextNeeded(p) ? perhapsDecode(p) : DecodeState::DECODE_FAILURE;
+    packetLatency.mark(PACKET_STAGE_DECODED, p->from, p->id);
     if (decodedState == DecodeState::DECODE_FATAL) {
         // Fatal decoding error, we can't do anything with this packet
         LOG_WARN("Fatal decode error, dropping packet");
@@ -654,6 +822,14 @@ void Router::handleReceived(meshtastic_MeshPacket *p, RxSource src)
         printPacket("packet decoding failed or skipped (no PSK?)", p);
     }
 
+    if (src == RX_SRC_RADIO && airTime && iface)
+        airTime->logTalker(p->from, decodedState == DecodeState::DECODE_SUCCESS ? p->decoded.portnum : AIRTIME_PORT_ENCRYPTED,
+                           iface->getPacketTime(p_encrypted));
+
+    // Anything heard straight from its sender tells us about our link to it
+    if (src == RX_SRC_RADIO && !p->via_mqtt && p->hop_start != 0 && p->hop_start == p->hop_limit && !isFromUs(p))
+        linkQuality.heard(p->from, p->rx_snr);
+
     // call modules here
     // If this could be a spoofed packet, don't let the modules see it.
     if (!skipHandle && p->from != nodeDB->getNodeNum()) {
@@ -673,6 +849,7 @@ void Router::handleReceived(meshtastic_MeshPacket *p, RxSource src)
     } else if (p->from == nodeDB->getNodeNum() && !skipHandle) {
         MeshModule::callModules(*p, src, ROUTING_MODULE);
     }
+    packetLatency.mark(PACKET_STAGE_MODULES_DONE, p->from, p->id);
 
     packetPool.release(p_encrypted); // Release the encrypted packet
 }
@@ -697,8 +874,8 @@ void Router::perhapsHandleReceived(meshtastic_MeshPacket *p)
         return;
     }
 
-    meshtastic_NodeInfoLite const *node = nodeDB->getMeshNode(p->from);
-    if (node != NULL && node->is_ignored) {
+    const NodeHot *node = nodeDB->getHotNode(p->from);
+    if (node != NULL && (node->flags & NODE_HOT_IS_IGNORED)) {
         LOG_DEBUG("Ignore msg, 0x%x is ignored", p->from);
         packetPool.release(p);
         return;
@@ -7,8 +7,18 @@
 #include "PacketHistory.h"
 #include "PointerQueue.h"
 #include "RadioInterface.h"
+#include "WirePacket.h"
 #include "concurrency/OSThread.h"
 
+/// What a received packet is worth keeping when the queue from the radio is full, least first
+enum RxAdmitClass : uint8_t {
+    RX_ADMIT_DUPLICATE, // PacketHistory has seen it already
+    RX_ADMIT_FLOOD,     // Someone else's, nobody waits for an ack
+    RX_ADMIT_RELIABLE,  // Someone else's, with want_ack
+    RX_ADMIT_FOR_US,    // To or from us, DMs and acks included
+    RX_ADMIT_CLASSES
+};
+
 /**
  * A mesh aware router that supports multiple interfaces.
  */
@@ -16,11 +26,22 @@ class Router : protected concurrency::OSThread, protected PacketHistory
 {
   private:
     /// Packets which have just arrived from the radio, ready to be processed by this service and possibly
-    /// forwarded to the phone.
-    PointerQueue<meshtastic_MeshPacket> fromRadioQueue;
+    /// forwarded to the phone.  Kept compact until we get to them.
+    PointerQueue<WirePacket> fromRadioQueue;
 
   protected:
-    RadioInterface *iface = NULL;
+    RadioInterface *iface = NULL; // The first radio, retransmission timings go by its preset
+
+#if MAX_RADIO_INTERFACES > 1
+  private:
+    RadioInterface *ifaces[MAX_RADIO_INTERFACES] = {};
+    size_t numIfaces = 0;
+    /// For each relay_node byte, 1 + the index in ifaces of the radio we last heard that relayer on, 0 if we never did
+    uint8_t heardOn[256] = {};
+
+    /// The one radio that reaches p's next hop, NULL if we don't know of one and p has to go out on all of them
+    RadioInterface *interfaceFor(const meshtastic_MeshPacket *p) const;
+#endif
 
   public:
     /**
@@ -30,9 +51,14 @@ class Router : protected concurrency::OSThread, protected PacketHistory
     Router();
 
     /**
-     * Currently we only allow one interface, that may change in the future
+     * Add a radio.  Only meshtasticd has room for more than one (MAX_RADIO_INTERFACES): what any of them hears comes in
+     * here, so PacketHistory drops what the other one heard already, and what we send goes out on the radio its next hop
+     * was last heard on, or on all of them.
      */
-    void addInterface(RadioInterface *_iface) { iface = _iface; }
+    void addInterface(RadioInterface *_iface);
+
+    /// radio just received p, remember it as the way to p's relayer
+    void heardOnInterface(const meshtastic_MeshPacket *p, RadioInterface *radio);
 
     /**
      * do idle processing
@@ -54,6 +80,15 @@ class Router : protected concurrency::OSThread, protected PacketHistory
     /** Attempt to find a packet in the TxQueue. Returns true if the packet was found. */
     bool findInTxQueue(NodeNum from, PacketId id);
 
+    /** Received packets waiting for us, the room left before we start dropping the oldest of them, and the most there have
+     * been at once */
+    int rxQueueUsed() { return fromRadioQueue.numUsed(); }
+    int rxQueueFree() { return fromRadioQueue.numFree(); }
+    int rxQueueHighWater() { return fromRadioQueue.getHighWater(); }
+
+    /** Received packets dropped because the queue was full, by RxAdmitClass */
+    uint32_t rxQueueDrops[RX_ADMIT_CLASSES] = {};
+
     /** Allocate and return a meshpacket which defaults as send to broadcast from the current node.
      * The returned packet is guaranteed to have a unique packet ID already assigned
      */
@@ -87,6 +122,10 @@ class Router : protected concurrency::OSThread, protected PacketHistory
     virtual ErrorCode send(meshtastic_MeshPacket *p);
     virtual ErrorCode rawSend(meshtastic_MeshPacket *p);
 
+    /** A traceroute through us showed 'dest' reachable via our neighbor 'firstHop', the weakest link on the way heard at
+     * 'worstSnr' (dB * 4 as in RouteDiscovery, INT8_MIN if unknown). Routers that keep next hops can learn from that. */
+    virtual void learnRouteFromTraceroute(NodeNum dest, NodeNum firstHop, int8_t worstSnr) {}
+
     /* Statistics for the amount of duplicate received packets and the amount of times we cancel a relay because someone did it
         before us */
     uint32_t rxDupe = 0, txRelayCanceled = 0;
@@ -126,6 +165,12 @@ class Router : protected concurrency::OSThread, protected PacketHistory
      */
     void perhapsHandleReceived(meshtastic_MeshPacket *p);
 
+    /// Class of p for admission to a full fromRadioQueue, from its header alone
+    RxAdmitClass rxAdmitClass(const WirePacket *w);
+
+    /// fromRadioQueue is full: keep the most valuable of what it holds and p, drop and count the least
+    void admitReceived(WirePacket *w);
+
     /**
      * Called from perhapsHandleReceived() - allows subclass message delivery behavior.
      * Handle any packet that is received by an interface on this node.
@@ -138,10 +183,23 @@ class Router : protected concurrency::OSThread, protected PacketHistory
 
     /** Frees the provided packet, and generates a NAK indicating the specifed error while sending */
     void abortSendAndNak(meshtastic_Routing_Error err, meshtastic_MeshPacket *p);
+
+    /** Hand an encrypted packet to the radio(s) that should send it, charging its airtime to portnum.
+     *  NOTE: This method will free the provided packet (even if we return an error code) */
+    ErrorCode sendOnInterfaces(meshtastic_MeshPacket *p, uint32_t portnum);
 };
 
 enum DecodeState { DECODE_SUCCESS, DECODE_FAILURE, DECODE_FATAL };
 
+/// Statistics for channel (PSK) decryption in perhapsDecode
+struct DecryptStats {
+    uint32_t attempts = 0; // Channel decrypt+decode attempts
+    uint32_t wasted = 0;   // Attempts that failed, because the channel hash collided with one of ours
+    uint32_t hintHits = 0; // Packets decoded on the first try thanks to the channel the sender last used
+};
+
+extern DecryptStats decryptStats;
+
 /** FIXME - move this into a mesh packet class
  * Remove any encryption and decode the protobufs inside this packet (if necessary).
  *
@@ -162,4 +220,30 @@ PacketId generatePacketId();
 #define BITFIELD_WANT_RESPONSE_SHIFT 1
 #define BITFIELD_OK_TO_MQTT_SHIFT 0
 #define BITFIELD_WANT_RESPONSE_MASK (1 << BITFIELD_WANT_RESPONSE_SHIFT)
-#define BITFIELD_OK_TO_MQTT_MASK (1 << BITFIELD_OK_TO_MQTT_SHIFT)
\ No newline at end of file
+#define BITFIELD_OK_TO_MQTT_MASK (1 << BITFIELD_OK_TO_MQTT_SHIFT)
+// On a NodeInfo: the sender decompresses TEXT_MESSAGE_COMPRESSED_APP, see TextCompression
+#define BITFIELD_READS_COMPRESSED_TEXT_SHIFT 4
+#define BITFIELD_READS_COMPRESSED_TEXT_MASK (1 << BITFIELD_READS_COMPRESSED_TEXT_SHIFT)
+// On a broadcast: BITFIELD_USER_HASH_MASK holds NodeDB::getUserHash() of the sender, so nodes with an older NodeInfo can ask
+#define BITFIELD_HAS_USER_HASH_SHIFT 5
+#define BITFIELD_HAS_USER_HASH_MASK (1 << BITFIELD_HAS_USER_HASH_SHIFT)
+#define BITFIELD_USER_HASH_SHIFT 6
+#define BITFIELD_USER_HASH_MASK (0xff << BITFIELD_USER_HASH_SHIFT)
+// On a NodeInfo: the sender takes apart several packets sent in one frame, see FrameAggregation
+#define BITFIELD_READS_AGGREGATES_SHIFT 14
+#define BITFIELD_READS_AGGREGATES_MASK (1 << BITFIELD_READS_AGGREGATES_SHIFT)
+// On a NodeInfo: the sender understands one ACK for several packets, see ReliableRouter
+#define BITFIELD_READS_MULTI_ACK_SHIFT 15
+#define BITFIELD_READS_MULTI_ACK_MASK (1 << BITFIELD_READS_MULTI_ACK_SHIFT)
+// On a NodeInfo: the sender can switch spreading factor for a burst with one neighbour, see LinkRate
+#define BITFIELD_READS_LINK_RATE_SHIFT 16
+#define BITFIELD_READS_LINK_RATE_MASK (1 << BITFIELD_READS_LINK_RATE_SHIFT)
+// On a packet straight to a neighbour: the spreading factor offered or accepted for a window, 0 for none, see LinkRate
+#define BITFIELD_LINK_SF_SHIFT 17
+#define BITFIELD_LINK_SF_MASK (0xf << BITFIELD_LINK_SF_SHIFT)
+// On a NodeInfo: the sender takes Reed-Solomon parity off the frames it hears, see ForwardErrorCorrection
+#define BITFIELD_READS_FEC_SHIFT 21
+#define BITFIELD_READS_FEC_MASK (1 << BITFIELD_READS_FEC_SHIFT)
+// Never on the wire: we decompressed this text, so if we relay it it must be compressed again
+#define BITFIELD_WAS_COMPRESSED_SHIFT 31
+#define BITFIELD_WAS_COMPRESSED_MASK (1u << BITFIELD_WAS_COMPRESSED_SHIFT)
\ No newline at end of file
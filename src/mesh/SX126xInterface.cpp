@@ -1,5 +1,6 @@
 #if RADIOLIB_EXCLUDE_SX126X != 1
 #include "SX126xInterface.h"
+#include "airtime.h"
 #include "configuration.h"
 #include "error.h"
 #include "mesh/NodeDB.h"
@@ -18,6 +19,17 @@
 #define SX126X_MAX_POWER 22
 #endif
 
+// Listen in windows just long enough to catch a preamble and sleep in between (SetRxDutyCycle), rather than continuously.  Set
+// to 0 for continuous RX, at a few mA more.
+#ifndef SX126X_RX_DUTY_CYCLE
+#define SX126X_RX_DUTY_CYCLE 1
+#endif
+// Channel utilization (percent) from which we listen continuously: the radio hardly gets to sleep anyway, and every preamble
+// it wakes up for mid-way is a packet it might not lock on to in time
+#ifndef SX126X_RX_DUTY_CYCLE_MAX_UTIL
+#define SX126X_RX_DUTY_CYCLE_MAX_UTIL 25
+#endif
+
 template <typename T>
 SX126xInterface<T>::SX126xInterface(LockingArduinoHal *hal, RADIOLIB_PIN_TYPE cs, RADIOLIB_PIN_TYPE irq, RADIOLIB_PIN_TYPE rst,
                                     RADIOLIB_PIN_TYPE busy)
@@ -223,6 +235,25 @@ template <typename T> bool SX126xInterface<T>::reconfigure()
     return RADIOLIB_ERR_NONE;
 }
 
+template <typename T> bool SX126xInterface<T>::setLinkSpreadingFactor(uint8_t linkSf)
+{
+    uint8_t want = linkSf ? linkSf : presetSf;
+    if (want == sf)
+        return true;
+    if (isSending() || (isReceiving && isActivelyReceiving()))
+        return false;
+
+    setStandby();
+    int err = lora.setSpreadingFactor(want); // Also takes care of low data rate optimization
+    if (err != RADIOLIB_ERR_NONE)
+        LOG_ERROR("SX126X setSpreadingFactor %s%d", radioLibErr, err);
+    else
+        sf = want;
+    updateModemTimings();
+    startReceive();
+    return err == RADIOLIB_ERR_NONE;
+}
+
 template <typename T> void INTERRUPT_ATTR SX126xInterface<T>::disableInterrupt()
 {
     lora.clearDio1Action();
@@ -250,9 +281,16 @@ template <typename T> void SX126xInterface<T>::setStandby()
  */
 template <typename T> void SX126xInterface<T>::addReceiveMetadata(meshtastic_MeshPacket *mp)
 {
-    // LOG_DEBUG("PacketStatus %x", lora.getPacketStatus());
-    mp->rx_snr = lora.getSNR();
-    mp->rx_rssi = lround(lora.getRSSI());
+    // lora.getSNR() and lora.getRSSI() each issue their own GetPacketStatus (and getSNR() a GetPacketType on top), so read
+    // the status once and decode it the same way RadioLib does: data[1] is the SNR in 0.25 dB steps, data[2] -RSSI*2.
+    uint8_t data[3] = {0, 0, 0};
+    if (module.SPIreadStream(RADIOLIB_SX126X_CMD_GET_PACKET_STATUS, data, sizeof(data)) != RADIOLIB_ERR_NONE) {
+        mp->rx_snr = lora.getSNR();
+        mp->rx_rssi = lround(lora.getRSSI());
+        return;
+    }
+    mp->rx_snr = (int8_t)data[1] / 4.0;
+    mp->rx_rssi = lround(-1.0 * data[2] / 2.0);
 }
 
 /** We override to turn on transmitter power as needed.
@@ -273,16 +311,43 @@ template <typename T> void SX126xInterface<T>::startReceive()
 
     setStandby();
 
-    // We use a 16 bit preamble so this should save some power by letting radio sit in standby mostly.
-    int err = lora.startReceiveDutyCycleAuto(preambleLength, 8, MESHTASTIC_RADIOLIB_IRQ_RX_FLAGS);
+    bool dutyCycle = wantRxDutyCycle();
+    if (dutyCycle != rxDutyCycle) {
+        LOG_DEBUG("SX126x %s RX", dutyCycle ? "duty cycled" : "continuous");
+        rxDutyCycle = dutyCycle;
+    }
+    int err;
+    if (dutyCycle) {
+        // The sleep and listen periods follow from our preamble length and the preset's symbol time, with a window of 8
+        // symbols to detect a preamble in.  RadioLib falls back to continuous RX if the radio can't wake up fast enough.
+        err =
+            lora.startReceiveDutyCycleAuto(preambleLength, 8, MESHTASTIC_RADIOLIB_IRQ_RX_FLAGS, MESHTASTIC_RADIOLIB_IRQ_RX_MASK);
+    } else {
+        err = lora.startReceive(RADIOLIB_SX126X_RX_TIMEOUT_INF, MESHTASTIC_RADIOLIB_IRQ_RX_FLAGS, MESHTASTIC_RADIOLIB_IRQ_RX_MASK,
+                                0);
+    }
+    rxActivityIrq = RX_ACTIVITY_IRQ;
     if (err != RADIOLIB_ERR_NONE)
-        LOG_ERROR("SX126X startReceiveDutyCycleAuto %s%d", radioLibErr, err);
+        LOG_ERROR("SX126X startReceive %s%d", radioLibErr, err);
     assert(err == RADIOLIB_ERR_NONE);
 
     RadioLibInterface::startReceive();
 
     // Must be done AFTER, starting transmit, because startTransmit clears (possibly stale) interrupt pending register bits
-    enableInterrupt(isrRxLevel0);
+    enableInterrupt(rxIsr());
+#endif
+}
+
+/**
+ * Duty cycled RX saves the most on a quiet channel.  We re-evaluate every time we go back to receiving, which on a busy channel
+ * is after every packet, and if it quiets down our own next packet gets us back to duty cycling.
+ */
+template <typename T> bool SX126xInterface<T>::wantRxDutyCycle()
+{
+#if SX126X_RX_DUTY_CYCLE
+    return airTime == nullptr || airTime->channelUtilizationPercent() < SX126X_RX_DUTY_CYCLE_MAX_UTIL;
+#else
+    return false;
 #endif
 }
 
@@ -313,9 +378,13 @@ template <typename T> bool SX126xInterface<T>::isChannelActive()
 /** Could we send right now (i.e. either not actively receiving or transmitting)? */
 template <typename T> bool SX126xInterface<T>::isActivelyReceiving()
 {
+#if RX_ACTIVITY_IRQ
+    return rxActivitySeen();
+#else
     // The IRQ status will be cleared when we start our read operation. Check if we've started a header, but haven't yet
     // received and handled the interrupt for reading the packet/handling errors.
     return receiveDetected(lora.getIrqFlags(), RADIOLIB_SX126X_IRQ_HEADER_VALID, RADIOLIB_SX126X_IRQ_PREAMBLE_DETECTED);
+#endif
 }
 
 template <typename T> bool SX126xInterface<T>::sleep()
@@ -28,6 +28,8 @@ template <class T> class SX126xInterface : public RadioLibInterface
 
     bool isIRQPending() override { return lora.getIrqFlags() != 0; }
 
+    virtual bool setLinkSpreadingFactor(uint8_t linkSf) override;
+
     void setTCXOVoltage(float voltage) { tcxoVoltage = voltage; }
 
   protected:
@@ -39,6 +41,11 @@ template <class T> class SX126xInterface : public RadioLibInterface
      */
     T lora;
 
+    bool rxDutyCycle = false; // Was our last startReceive() duty cycled
+
+    /** Should we duty cycle the receiver, or is the channel busy enough that it should listen continuously */
+    bool wantRxDutyCycle();
+
     /**
      * Glue functions called from ISR land
      */
@@ -23,6 +23,9 @@ class SinglePortModule : public MeshModule
      */
     virtual bool wantPacket(const meshtastic_MeshPacket *p) override { return p->decoded.portnum == ourPortNum; }
 
+    /// If you override wantPacket() to take other ports too, return MESHMODULE_ANY_PORT here
+    virtual int getDispatchPort() const override { return ourPortNum; }
+
     /**
      * Return a mesh packet which has been preinited as a data packet with a particular port number.
      * You can then send this packet (after customizing any of the payload fields you might need) with
@@ -0,0 +1,45 @@
+#include "SlottedTx.h"
+#include "NodeDB.h"
+#include "RTC.h"
+#include "configuration.h"
+#include <Throttle.h>
+
+bool SlottedTx::isActive()
+{
+    static bool wasActive = false;
+    bool active = config.device.role == meshtastic_Config_DeviceConfig_Role_ROUTER && getRTCQuality() >= RTCQualityNTP;
+#ifndef ARCH_PORTDUINO
+    // The host's clock is kept in step by NTP, ours only when GPS or NTP set it again
+    active = active && Throttle::isWithinTimespanMs(lastSetFromPhoneNtpOrGps, SLOTTED_TX_TIME_MAX_AGE_MSEC);
+#endif
+    if (active != wasActive) {
+        if (active)
+            LOG_INFO("Relay in TX slot %u of %u", ourSlot(), SLOTTED_TX_SLOTS);
+        else
+            LOG_INFO("Time not good enough for TX slots, back to CSMA");
+        wasActive = active;
+    }
+    return active;
+}
+
+uint32_t SlottedTx::slotMsec(RadioInterface *radio)
+{
+    return radio->getPacketTime((uint32_t)MAX_LORA_PAYLOAD_LEN) + SLOTTED_TX_GUARD_MSEC;
+}
+
+uint8_t SlottedTx::ourSlot()
+{
+    return nodeDB->getNodeNum() % SLOTTED_TX_SLOTS;
+}
+
+uint32_t SlottedTx::msecUntilSlot(uint64_t nowMsec, uint32_t slotMsec, uint8_t numSlots, uint8_t slot, uint32_t txMsec,
+                                  uint32_t guardMsec)
+{
+    uint32_t frameMsec = slotMsec * numSlots;
+    uint32_t inFrame = nowMsec % frameMsec;
+    uint32_t first = slot * slotMsec + guardMsec / 2; // Earliest start in our slot
+    uint32_t last = first + (slotMsec > guardMsec + txMsec ? slotMsec - guardMsec - txMsec : 0); // Latest
+    if (inFrame >= first && inFrame <= last)
+        return 0;
+    return inFrame < first ? first - inFrame : frameMsec - inFrame + first;
+}
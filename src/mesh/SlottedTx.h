@@ -0,0 +1,50 @@
+#pragma once
+
+#include "MeshTypes.h"
+#include "RadioInterface.h"
+
+// Set to 1 to let ROUTERs with good time (GPS or NTP) relay in a slot of their own instead of after a random backoff.  Every
+// ROUTER in the backbone has to run it with the same SLOTTED_TX_SLOTS and preset, so it is off by default.
+#ifndef SLOTTED_TX
+#define SLOTTED_TX 0
+#endif
+// Slots in a frame, ROUTERs get slot NodeNum % SLOTTED_TX_SLOTS.  More slots collide less but make relays wait longer.
+#ifndef SLOTTED_TX_SLOTS
+#define SLOTTED_TX_SLOTS 4
+#endif
+// Room for clocks that disagree, split between both ends of a slot.  GPS modules report a fix up to a few hundred msec late.
+#ifndef SLOTTED_TX_GUARD_MSEC
+#define SLOTTED_TX_GUARD_MSEC 300
+#endif
+// Time that hasn't been set from GPS or NTP for this long has drifted too far to keep slots apart
+#ifndef SLOTTED_TX_TIME_MAX_AGE_MSEC
+#define SLOTTED_TX_TIME_MAX_AGE_MSEC (30 * 60 * 1000)
+#endif
+
+/**
+ * TDMA-like relaying for fixed infrastructure.
+ *
+ * Time since 1970 in msec is cut into frames of SLOTTED_TX_SLOTS slots, each as long as a full size packet plus
+ * SLOTTED_TX_GUARD_MSEC.  A ROUTER holds packets it relays until a packet of that length fits inside its own slot, so
+ * ROUTERs in different slots never talk over each other.  Everything we send ourselves still goes by the usual CSMA, as do
+ * relays whenever our time is not good enough (see isActive), which is where we are back to after a GPS outage.
+ */
+class SlottedTx
+{
+  public:
+    /// Is our role and time good enough for slots right now
+    static bool isActive();
+
+    /// The length of one slot for radio's preset, the same on every ROUTER using it
+    static uint32_t slotMsec(RadioInterface *radio);
+
+    /// Our slot
+    static uint8_t ourSlot();
+
+    /**
+     * Msec from nowMsec until a packet of txMsec airtime can start in slot, so it ends before the guard at the end of it.
+     * 0 if it can go now.
+     */
+    static uint32_t msecUntilSlot(uint64_t nowMsec, uint32_t slotMsec, uint8_t numSlots, uint8_t slot, uint32_t txMsec,
+                                  uint32_t guardMsec);
+};
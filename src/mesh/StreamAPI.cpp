@@ -4,9 +4,11 @@
 #include "Throttle.h"
 #include "configuration.h"
 
-#define START1 0x94
-#define START2 0xc3
-#define HEADER_LEN 4
+#define START1 TORADIO_FRAME_START1
+#define START2 TORADIO_FRAME_START2
+#define HEADER_LEN STREAM_HEADER_LEN
+
+static_assert(STREAM_COALESCE_BUF_SIZE >= MAX_STREAM_BUF_SIZE, "STREAM_COALESCE_BUF_SIZE must hold a whole framed packet");
 
 int32_t StreamAPI::runOncePart()
 {
@@ -34,7 +36,7 @@ int32_t StreamAPI::readStream(char *buf, uint16_t bufLen)
         bool recentRx = Throttle::isWithinTimespanMs(lastRxMsec, 2000);
         return recentRx ? 5 : 250;
     } else {
-        handleRecStream(buf, bufLen);
+        handleRecStream((const uint8_t *)buf, bufLen);
         // we had bytes available this time, so assume we might have them next time also
         lastRxMsec = millis();
         return 0;
@@ -48,61 +50,82 @@ void StreamAPI::writeStream()
 {
     if (canWrite) {
         uint32_t len;
+        bool wrote = false;
         do {
-            // Send every packet we can
+            // Send every packet we can, packing them into as few writes as possible.  During the config download that is
+            // hundreds of small packets, which otherwise cost a USB/TCP transfer each.
             len = getFromRadio(txBuf + HEADER_LEN);
-            emitTxBuffer(len);
+            if (len != 0) {
+                size_t totalLen = frameTxBuffer(len);
+                if (coalesceLen + totalLen > sizeof(coalesceBuf))
+                    writeCoalesced();
+                memcpy(coalesceBuf + coalesceLen, txBuf, totalLen);
+                coalesceLen += totalLen;
+                wrote = true;
+            }
         } while (len);
+
+        if (wrote) {
+            writeCoalesced();
+            stream->flush();
+        }
     }
 }
 
-int32_t StreamAPI::handleRecStream(char *buf, uint16_t bufLen)
+void StreamAPI::writeCoalesced()
 {
-    uint16_t index = 0;
-    while (bufLen > index) { // Currently we never want to block
-        int cInt = buf[index++];
-        if (cInt < 0)
-            break; // We ran out of characters (even though available said otherwise) - this can happen on rf52 adafruit
-                   // arduino
-
-        uint8_t c = (uint8_t)cInt;
+    if (coalesceLen != 0) {
+        stream->write(coalesceBuf, coalesceLen);
+        coalesceLen = 0;
+    }
+}
 
+void StreamAPI::handleRecStream(const uint8_t *buf, size_t len)
+{
+    const uint8_t *end = buf + len;
+    while (buf < end) {
         // Use the read pointer for a little state machine, first look for framing, then length bytes, then payload
-        size_t ptr = rxPtr;
-
-        rxPtr++;        // assume we will probably advance the rxPtr
-        rxBuf[ptr] = c; // store all bytes (including framing)
-
-        // console->printf("rxPtr %d ptr=%d c=0x%x\n", rxPtr, ptr, c);
-
-        if (ptr == 0) { // looking for START1
-            if (c != START1)
-                rxPtr = 0;     // failed to find framing
-        } else if (ptr == 1) { // looking for START2
-            if (c != START2)
-                rxPtr = 0;                             // failed to find framing
-        } else if (ptr >= HEADER_LEN - 1) {            // we have at least read our 4 byte framing
-            uint32_t len = (rxBuf[2] << 8) + rxBuf[3]; // big endian 16 bit length follows framing
-
-            // console->printf("len %d\n", len);
-
-            if (ptr == HEADER_LEN - 1) {
-                // we _just_ finished our 4 byte header, validate length now (note: a length of zero is a valid
-                // protobuf also)
-                if (len > MAX_TO_FROM_RADIO_SIZE)
-                    rxPtr = 0; // length is bogus, restart search for framing
+        if (rxPtr == 0) {
+            // Skip everything that can't start a frame in one go, that's debug text and line noise
+            buf = (const uint8_t *)memchr(buf, START1, end - buf);
+            if (!buf)
+                break;
+
+            size_t avail = end - buf;
+            if (avail >= HEADER_LEN && buf[1] == START2) {
+                size_t payloadLen = (buf[2] << 8) + buf[3];
+                if (payloadLen <= MAX_TO_FROM_RADIO_SIZE && avail >= HEADER_LEN + payloadLen) {
+                    // The whole frame is already in the caller's buffer, no need to copy it into ours
+                    handleToRadio(buf + HEADER_LEN, payloadLen);
+                    buf += HEADER_LEN + payloadLen;
+                    continue;
+                }
             }
+            rxBuf[rxPtr++] = *buf++;
+        } else if (rxPtr < HEADER_LEN) {
+            uint8_t c = *buf++;
+            rxBuf[rxPtr++] = c;
+            if (rxPtr == 2 && c != START2)
+                rxPtr = (c == START1) ? 1 : 0; // failed to find framing, but this byte might be the start of it
+            else if (rxPtr == HEADER_LEN && ((rxBuf[2] << 8) + rxBuf[3]) > MAX_TO_FROM_RADIO_SIZE)
+                rxPtr = 0; // length is bogus, restart search for framing (note: a length of zero is a valid protobuf also)
+        }
 
-            if (rxPtr != 0)                        // Is packet still considered 'good'?
-                if (ptr + 1 >= len + HEADER_LEN) { // have we received all of the payload?
-                    rxPtr = 0;                     // start over again on the next packet
-
-                    // If we didn't just fail the packet and we now have the right # of bytes, parse it
-                    handleToRadio(rxBuf + HEADER_LEN, len);
-                }
+        if (rxPtr >= HEADER_LEN) {
+            // Copy as much of the payload as we have in one go
+            size_t payloadLen = (rxBuf[2] << 8) + rxBuf[3]; // big endian 16 bit length follows framing
+            size_t want = HEADER_LEN + payloadLen - rxPtr;
+            size_t take = (size_t)(end - buf) < want ? (size_t)(end - buf) : want;
+            memcpy(rxBuf + rxPtr, buf, take);
+            rxPtr += take;
+            buf += take;
+
+            if (rxPtr == HEADER_LEN + payloadLen) {
+                rxPtr = 0; // start over again on the next packet
+                handleToRadio(rxBuf + HEADER_LEN, payloadLen);
+            }
         }
     }
-    return 0;
 }
 
 /**
@@ -115,49 +138,21 @@ int32_t StreamAPI::readStream()
         bool recentRx = Throttle::isWithinTimespanMs(lastRxMsec, 2000);
         return recentRx ? 5 : 250;
     } else {
+        uint8_t chunk[STREAM_READ_CHUNK];
+        size_t n = 0;
         while (stream->available()) { // Currently we never want to block
             int cInt = stream->read();
             if (cInt < 0)
                 break; // We ran out of characters (even though available said otherwise) - this can happen on rf52 adafruit
                        // arduino
 
-            uint8_t c = (uint8_t)cInt;
-
-            // Use the read pointer for a little state machine, first look for framing, then length bytes, then payload
-            size_t ptr = rxPtr;
-
-            rxPtr++;        // assume we will probably advance the rxPtr
-            rxBuf[ptr] = c; // store all bytes (including framing)
-
-            // console->printf("rxPtr %d ptr=%d c=0x%x\n", rxPtr, ptr, c);
-
-            if (ptr == 0) { // looking for START1
-                if (c != START1)
-                    rxPtr = 0;     // failed to find framing
-            } else if (ptr == 1) { // looking for START2
-                if (c != START2)
-                    rxPtr = 0;                             // failed to find framing
-            } else if (ptr >= HEADER_LEN - 1) {            // we have at least read our 4 byte framing
-                uint32_t len = (rxBuf[2] << 8) + rxBuf[3]; // big endian 16 bit length follows framing
-
-                // console->printf("len %d\n", len);
-
-                if (ptr == HEADER_LEN - 1) {
-                    // we _just_ finished our 4 byte header, validate length now (note: a length of zero is a valid
-                    // protobuf also)
-                    if (len > MAX_TO_FROM_RADIO_SIZE)
-                        rxPtr = 0; // length is bogus, restart search for framing
-                }
-
-                if (rxPtr != 0)                        // Is packet still considered 'good'?
-                    if (ptr + 1 >= len + HEADER_LEN) { // have we received all of the payload?
-                        rxPtr = 0;                     // start over again on the next packet
-
-                        // If we didn't just fail the packet and we now have the right # of bytes, parse it
-                        handleToRadio(rxBuf + HEADER_LEN, len);
-                    }
+            chunk[n++] = (uint8_t)cInt;
+            if (n == sizeof(chunk)) {
+                handleRecStream(chunk, n);
+                n = 0;
             }
         }
+        handleRecStream(chunk, n);
 
         // we had bytes available this time, so assume we might have them next time also
         lastRxMsec = millis();
@@ -171,17 +166,28 @@ int32_t StreamAPI::readStream()
 void StreamAPI::emitTxBuffer(size_t len)
 {
     if (len != 0) {
-        txBuf[0] = START1;
-        txBuf[1] = START2;
-        txBuf[2] = (len >> 8) & 0xff;
-        txBuf[3] = len & 0xff;
-
-        auto totalLen = len + HEADER_LEN;
+        auto totalLen = frameTxBuffer(len);
+        writeCoalesced(); // Anything we were still packing must go out first
         stream->write(txBuf, totalLen);
         stream->flush();
     }
 }
 
+size_t StreamAPI::frameTxBuffer(size_t len)
+{
+    return frame(txBuf, len);
+}
+
+size_t StreamAPI::frame(uint8_t *buf, size_t len)
+{
+    buf[0] = START1;
+    buf[1] = START2;
+    buf[2] = (len >> 8) & 0xff;
+    buf[3] = len & 0xff;
+
+    return len + HEADER_LEN;
+}
+
 void StreamAPI::emitRebooted()
 {
     // In case we send a FromRadio packet
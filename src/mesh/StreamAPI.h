@@ -6,8 +6,19 @@
 #include <cstdarg>
 
 // A To/FromRadio packet + our 32 bit header
+#define STREAM_HEADER_LEN 4
 #define MAX_STREAM_BUF_SIZE (MAX_TO_FROM_RADIO_SIZE + sizeof(uint32_t))
 
+// Framed packets are packed into writes of up to this many bytes while draining, roughly a TCP segment
+#ifndef STREAM_COALESCE_BUF_SIZE
+#define STREAM_COALESCE_BUF_SIZE 1460
+#endif
+
+// Received bytes are pulled off the Stream into a chunk this big before they go through the framing parser
+#ifndef STREAM_READ_CHUNK
+#define STREAM_READ_CHUNK 64
+#endif
+
 /**
  * A version of our 'phone' API that talks over a Stream.  So therefore well suited to use with serial links
  * or TCP connections.
@@ -42,6 +53,10 @@ class StreamAPI : public PhoneAPI
     /// time of last rx, used, to slow down our polling if we haven't heard from anyone
     uint32_t lastRxMsec = 0;
 
+    /// Framed packets waiting to go out in one write, see writeStream()
+    uint8_t coalesceBuf[STREAM_COALESCE_BUF_SIZE] = {0};
+    size_t coalesceLen = 0;
+
   public:
     StreamAPI(Stream *_stream) : stream(_stream) {}
 
@@ -52,19 +67,35 @@ class StreamAPI : public PhoneAPI
     virtual int32_t runOncePart();
     virtual int32_t runOncePart(char *buf,uint16_t bufLen);
 
+    /// Write the framing header into the first STREAM_HEADER_LEN bytes of buf, ahead of the len bytes of payload that follow
+    /// it, @return the framed length.  For the HTTP API, which sends the same framing when asked to stream.
+    static size_t frame(uint8_t *buf, size_t len);
+
   private:
     /**
      * Read any rx chars from the link and call handleToRadio
      */
     int32_t readStream();
     int32_t readStream(char *buf,uint16_t bufLen);
-    int32_t handleRecStream(char *buf,uint16_t bufLen);
 
     /**
-     * call getFromRadio() and deliver encapsulated packets to the Stream
+     * Parse len more bytes of the framed stream, calling handleToRadio for each complete packet.  Frames may be split
+     * across calls, anything between frames is skipped with memchr and whole frames are never copied byte by byte.
+     */
+    void handleRecStream(const uint8_t *buf, size_t len);
+
+    /**
+     * call getFromRadio() and deliver encapsulated packets to the Stream, coalesced into as few writes as possible with a
+     * single flush at the end
      */
     void writeStream();
 
+    /// Add the framing header to the len bytes of payload in txBuf, @return the framed length
+    size_t frameTxBuffer(size_t len);
+
+    /// Write out whatever is waiting in coalesceBuf
+    void writeCoalesced();
+
   protected:
     /**
      * Send a FromRadio.rebooted = true packet to the phone
@@ -0,0 +1,88 @@
+#include "TextCompression.h"
+#include "NodeDB.h"
+#include "Router.h"
+#include "configuration.h"
+#include "mesh/compression/unishox2.h"
+
+// A node on the channel we haven't heard from for this long no longer gets a say in whether broadcasts are compressed
+#define TEXT_COMPRESS_LISTENER_SECS (60 * 60 * 2)
+
+uint32_t TextCompression::channelMask = TEXT_COMPRESS_CHANNELS;
+
+bool TextCompression::wanted(const meshtastic_MeshPacket *p)
+{
+    if (p->which_payload_variant != meshtastic_MeshPacket_decoded_tag ||
+        p->decoded.portnum != meshtastic_PortNum_TEXT_MESSAGE_APP || p->decoded.payload.size < 2)
+        return false;
+
+    // Relaying something we decompressed, it goes on as it came
+    if (p->decoded.bitfield & BITFIELD_WAS_COMPRESSED_MASK)
+        return true;
+
+    if (!isFromUs(p) || p->channel >= 32 || !(channelMask & (1u << p->channel)))
+        return false;
+
+    if (!isBroadcast(p->to)) {
+        const meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(p->to);
+        return node && (node->bitfield & NODEINFO_BITFIELD_READS_COMPRESSED_TEXT_MASK);
+    }
+
+    // A broadcast has to be readable by everyone we know is listening on the channel
+    size_t listeners = 0;
+    for (size_t i = 0; i < nodeDB->getNumMeshNodes(); i++) {
+        const meshtastic_NodeInfoLite *node = nodeDB->getMeshNodeByIndex(i);
+        if (node->num == nodeDB->getNodeNum() || node->channel != p->channel ||
+            sinceLastSeen(node) >= TEXT_COMPRESS_LISTENER_SECS)
+            continue;
+        if (!(node->bitfield & NODEINFO_BITFIELD_READS_COMPRESSED_TEXT_MASK))
+            return false;
+        listeners++;
+    }
+    return listeners > 0;
+}
+
+bool TextCompression::compress(meshtastic_Data &d)
+{
+    char packed[meshtastic_Constants_DATA_PAYLOAD_LEN];
+    char unpacked[meshtastic_Constants_DATA_PAYLOAD_LEN];
+
+    if (d.payload.size < 2)
+        return false;
+    // Limiting the output to one byte less than we have makes unishox2 give up as soon as it can't win
+    int packedSize = unishox2_compress((const char *)d.payload.bytes, d.payload.size, packed, d.payload.size - 1, USX_PSET_DFLT);
+    if (packedSize <= 0 || packedSize >= (int)d.payload.size ||
+        unishox2_decompress(packed, packedSize, unpacked, sizeof(unpacked), USX_PSET_DFLT) != (int)d.payload.size ||
+        memcmp(unpacked, d.payload.bytes, d.payload.size) != 0)
+        return false;
+
+    memcpy(d.payload.bytes, packed, packedSize);
+    d.payload.size = packedSize;
+    d.portnum = meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP;
+    return true;
+}
+
+bool TextCompression::decompress(meshtastic_Data &d)
+{
+    char unpacked[sizeof(d.payload.bytes)];
+
+    // On overflow unishox2 returns more than it was allowed to write
+    int size = unishox2_decompress((const char *)d.payload.bytes, d.payload.size, unpacked, sizeof(unpacked), USX_PSET_DFLT);
+    if (size <= 0 || size > (int)sizeof(unpacked))
+        return false;
+
+    memcpy(d.payload.bytes, unpacked, size);
+    d.payload.size = size;
+    d.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
+    return true;
+}
+
+void TextCompression::heardNodeInfo(NodeNum node, const meshtastic_Data &d)
+{
+    meshtastic_NodeInfoLite *info = nodeDB->getMeshNode(node);
+    if (!info)
+        return;
+    if (d.has_bitfield && (d.bitfield & BITFIELD_READS_COMPRESSED_TEXT_MASK))
+        info->bitfield |= NODEINFO_BITFIELD_READS_COMPRESSED_TEXT_MASK;
+    else
+        info->bitfield &= ~NODEINFO_BITFIELD_READS_COMPRESSED_TEXT_MASK;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "MeshTypes.h"
+
+// Bitmask of the channel indexes whose text messages we send unishox2 compressed, when everyone listening can read that.
+// Off by default: nodes on older firmware show TEXT_MESSAGE_COMPRESSED_APP as an unknown port.
+#ifndef TEXT_COMPRESS_CHANNELS
+#define TEXT_COMPRESS_CHANNELS 0
+#endif
+
+/**
+ * Text messages on the wire as TEXT_MESSAGE_COMPRESSED_APP.
+ *
+ * Every node running this firmware decompresses them and says so in the Data bitfield of its NodeInfo
+ * (BITFIELD_READS_COMPRESSED_TEXT), which we remember in NodeInfoLite.bitfield.  We only compress our own text on an
+ * opted in channel, to a node that said it can read it or as a broadcast when every node we've heard on that channel lately
+ * did.  Relays compress again what they decompressed, so the packet they send is the one they got.
+ */
+class TextCompression
+{
+  public:
+    /// Channel indexes we compress on, TEXT_COMPRESS_CHANNELS unless changed at runtime
+    static uint32_t channelMask;
+
+    /// Should the text in p, which is about to be encrypted, go out compressed
+    static bool wanted(const meshtastic_MeshPacket *p);
+
+    /// Replace the text in d with its compressed form, @return false (leaving d alone) if that wouldn't make it smaller
+    static bool compress(meshtastic_Data &d);
+
+    /// Turn a TEXT_MESSAGE_COMPRESSED_APP payload back into TEXT_MESSAGE_APP, @return false (leaving d alone) if corrupt
+    static bool decompress(meshtastic_Data &d);
+
+    /// Note what a NodeInfo from node said about reading compressed text
+    static void heardNodeInfo(NodeNum node, const meshtastic_Data &d);
+};
@@ -17,6 +17,7 @@ template <class T> class TypedQueue
     static_assert(std::is_standard_layout<T>::value, "T must be standard layout");
     QueueHandle_t h;
     concurrency::OSThread *reader = NULL;
+    uint16_t highWater = 0; // Most elements there have been at once, only ever raised so a racing update just loses a sample
 
   public:
     explicit TypedQueue(int maxElements) : h(xQueueCreate(maxElements, sizeof(T))) { assert(h); }
@@ -29,6 +30,8 @@ template <class T> class TypedQueue
 
     int numUsed() { return uxQueueMessagesWaiting(h); }
 
+    int getHighWater() { return highWater; }
+
     /** euqueue a packet.  Also, maxWait used to default to portMAX_DELAY, but we now want to callers to THINK about what blocking
      * they want */
     bool enqueue(T x, TickType_t maxWait)
@@ -37,7 +40,12 @@ template <class T> class TypedQueue
             reader->setInterval(0);
             concurrency::mainDelay.interrupt();
         }
-        return xQueueSendToBack(h, &x, maxWait) == pdTRUE;
+        if (xQueueSendToBack(h, &x, maxWait) != pdTRUE)
+            return false;
+        uint16_t used = uxQueueMessagesWaiting(h);
+        if (used > highWater)
+            highWater = used;
+        return true;
     }
 
     bool enqueueFromISR(T x, BaseType_t *higherPriWoken)
@@ -46,7 +54,12 @@ template <class T> class TypedQueue
             reader->setInterval(0);
             concurrency::mainDelay.interruptFromISR(higherPriWoken);
         }
-        return xQueueSendToBackFromISR(h, &x, higherPriWoken) == pdTRUE;
+        if (xQueueSendToBackFromISR(h, &x, higherPriWoken) != pdTRUE)
+            return false;
+        uint16_t used = uxQueueMessagesWaitingFromISR(h);
+        if (used > highWater)
+            highWater = used;
+        return true;
     }
 
     bool dequeue(T *p, TickType_t maxWait = portMAX_DELAY) { return xQueueReceive(h, p, maxWait) == pdTRUE; }
@@ -64,60 +77,86 @@ template <class T> class TypedQueue
 
 #else
 
-#include <queue>
+#include <atomic>
 
 /**
- * A wrapper for freertos queues.  Note: each element object should be small
- * and POD (Plain Old Data type) as elements are memcpied by value.
+ * A fixed size ring buffer with the same API as the freertos queue wrapper, for platforms without freertos.
+ *
+ * One producer and one consumer may use it at the same time without locking (for instance an interrupt handler or the
+ * SimRadio/UDP threads on portduino feeding the main loop), and nothing is allocated after construction.
  */
 template <class T> class TypedQueue
 {
-    std::queue<T> q;
+    T *buf;
+    uint32_t size; // One more than the capacity, so a full queue can be told from an empty one
     concurrency::OSThread *reader = NULL;
-    int maxElements;
+    std::atomic<uint32_t> highWater; // Most elements there have been at once, only the producer stores it
 
-  public:
-    explicit TypedQueue(int _maxElements) : maxElements(_maxElements) {}
+    std::atomic<uint32_t> head; // Next slot to write, only stored by the producer
+    // Keep the producer's and consumer's indices on separate cache lines, so they don't bounce them between cores
+    char pad[64 - sizeof(std::atomic<uint32_t>)];
+    std::atomic<uint32_t> tail; // Next slot to read, only stored by the consumer
+
+    uint32_t next(uint32_t i) const { return i + 1 == size ? 0 : i + 1; }
 
-    int numFree()
+  public:
+    explicit TypedQueue(int maxElements) : size(maxElements + 1), highWater(0), head(0), tail(0)
     {
-        if (maxElements <= 0)
-            return 1; // Always claim 1 free, because we can grow to any size
-        return maxElements - numUsed();
+        assert(maxElements > 0);
+        buf = new T[size];
     }
 
-    bool isEmpty() { return q.empty(); }
+    ~TypedQueue() { delete[] buf; }
+
+    TypedQueue(const TypedQueue &) = delete;
+    TypedQueue &operator=(const TypedQueue &) = delete;
 
-    int numUsed() { return q.size(); }
+    int numFree() { return size - 1 - numUsed(); }
+
+    bool isEmpty() { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); }
+
+    int numUsed()
+    {
+        uint32_t h = head.load(std::memory_order_acquire), t = tail.load(std::memory_order_acquire);
+        return h >= t ? h - t : size - t + h;
+    }
+
+    int getHighWater() { return highWater.load(std::memory_order_relaxed); }
 
     bool enqueue(T x, TickType_t maxWait = portMAX_DELAY)
     {
-        if (numFree() <= 0)
-            return false;
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t n = next(h);
+        if (n == tail.load(std::memory_order_acquire))
+            return false; // Full
 
         if (reader) {
             reader->setInterval(0);
             concurrency::mainDelay.interrupt();
         }
 
-        q.push(x);
+        buf[h] = x;
+        head.store(n, std::memory_order_release);
+        uint32_t used = numUsed();
+        if (used > highWater.load(std::memory_order_relaxed))
+            highWater.store(used, std::memory_order_relaxed);
         return true;
     }
 
-    // bool enqueueFromISR(T x, BaseType_t *higherPriWoken) { return xQueueSendToBackFromISR(h, &x, higherPriWoken) == pdTRUE; }
+    bool enqueueFromISR(T x, BaseType_t *higherPriWoken) { return enqueue(x, 0); }
 
     bool dequeue(T *p, TickType_t maxWait = portMAX_DELAY)
     {
-        if (isEmpty())
-            return false;
-        else {
-            *p = q.front();
-            q.pop();
-            return true;
-        }
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire))
+            return false; // Empty
+
+        *p = buf[t];
+        tail.store(next(t), std::memory_order_release);
+        return true;
     }
 
-    // bool dequeueFromISR(T *p, BaseType_t *higherPriWoken) { return xQueueReceiveFromISR(h, p, higherPriWoken); }
+    bool dequeueFromISR(T *p, BaseType_t *higherPriWoken) { return dequeue(p, 0); }
 
     void setReader(concurrency::OSThread *t) { reader = t; }
 };
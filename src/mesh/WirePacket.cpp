@@ -0,0 +1,97 @@
+#include "WirePacket.h"
+#include "MemoryPool.h"
+#include <string.h>
+
+template <size_t N> struct WirePacketBlock {
+    WirePacket header;
+    uint8_t bytes[N]; // Right after header, where WirePacket::bytes() finds them
+};
+
+static MemoryStatic<WirePacketBlock<WIRE_PACKET_SMALL_BYTES>, WIRE_PACKET_SMALL_SLOTS> smallPool;
+static MemoryStatic<WirePacketBlock<WIRE_PACKET_LARGE_BYTES>, WIRE_PACKET_LARGE_SLOTS> largePool;
+
+WirePacket *WirePacket::fromPacket(meshtastic_MeshPacket *p)
+{
+    bool compact =
+        p->which_payload_variant == meshtastic_MeshPacket_encrypted_tag && p->public_key.size == 0 && !p->pki_encrypted;
+    size_t size = compact ? p->encrypted.size : 0;
+    bool large = size > WIRE_PACKET_SMALL_BYTES;
+
+    WirePacket *w = large ? &largePool.allocZeroed()->header : &smallPool.allocZeroed()->header;
+    w->large = large;
+    w->from = p->from;
+    w->to = p->to;
+    w->id = p->id;
+    w->channel = p->channel;
+    w->hop_limit = p->hop_limit;
+    w->want_ack = p->want_ack;
+    if (!compact) {
+        w->full = p;
+        return w;
+    }
+
+    w->rx_time = p->rx_time;
+    w->rx_snr = p->rx_snr;
+    w->rx_rssi = p->rx_rssi;
+    w->tx_after = p->tx_after;
+    w->hop_start = p->hop_start;
+    w->next_hop = p->next_hop;
+    w->relay_node = p->relay_node;
+    w->priority = p->priority;
+    w->delayed = p->delayed;
+    w->via_mqtt = p->via_mqtt;
+    w->size = size;
+    memcpy(w->bytes(), p->encrypted.bytes, size);
+    packetPool.release(p);
+    return w;
+}
+
+const meshtastic_MeshPacket *WirePacket::view(meshtastic_MeshPacket &scratch) const
+{
+    if (full)
+        return full;
+
+    memset(&scratch, 0, sizeof(scratch));
+    scratch.from = from;
+    scratch.to = to;
+    scratch.id = id;
+    scratch.channel = channel;
+    scratch.which_payload_variant = meshtastic_MeshPacket_encrypted_tag;
+    scratch.rx_time = rx_time;
+    scratch.rx_snr = rx_snr;
+    scratch.rx_rssi = rx_rssi;
+    scratch.tx_after = tx_after;
+    scratch.hop_limit = hop_limit;
+    scratch.hop_start = hop_start;
+    scratch.next_hop = next_hop;
+    scratch.relay_node = relay_node;
+    scratch.priority = (meshtastic_MeshPacket_Priority)priority;
+    scratch.delayed = (meshtastic_MeshPacket_Delayed)delayed;
+    scratch.want_ack = want_ack;
+    scratch.via_mqtt = via_mqtt;
+    return &scratch;
+}
+
+meshtastic_MeshPacket *WirePacket::expand()
+{
+    meshtastic_MeshPacket *p = full;
+    if (!p) {
+        p = packetPool.allocZeroed();
+        view(*p);
+        p->encrypted.size = size;
+        memcpy(p->encrypted.bytes, bytes(), size);
+    }
+    full = NULL;
+    release();
+    return p;
+}
+
+void WirePacket::release()
+{
+    if (full)
+        packetPool.release(full);
+    if (large)
+        largePool.release((WirePacketBlock<WIRE_PACKET_LARGE_BYTES> *)this);
+    else
+        smallPool.release((WirePacketBlock<WIRE_PACKET_SMALL_BYTES> *)this);
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "MeshTypes.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// Payload bytes a small WirePacket holds.  Most frames on a busy mesh (position, telemetry, acks, short texts) fit
+#ifndef WIRE_PACKET_SMALL_BYTES
+#define WIRE_PACKET_SMALL_BYTES 64
+#endif
+
+// Preallocated WirePackets of each size, anything beyond falls back to the heap (and is counted) like packetPool does
+#ifndef WIRE_PACKET_SMALL_SLOTS
+#define WIRE_PACKET_SMALL_SLOTS 12
+#endif
+#ifndef WIRE_PACKET_LARGE_SLOTS
+#define WIRE_PACKET_LARGE_SLOTS 4
+#endif
+
+#define WIRE_PACKET_LARGE_BYTES sizeof(meshtastic_MeshPacket_encrypted_t::bytes)
+
+/**
+ * A received packet as it came off the air: the header, the receive metadata, and the encrypted payload in a buffer sized
+ * for it, rather than a whole meshtastic_MeshPacket with room for the largest decoded payload.  Packets wait in the queue
+ * from the radio like this and are expanded back into a packetPool packet when the router gets to them, so a burst of
+ * arrivals costs a fraction of the memory.
+ *
+ * Packets with anything more than that (already decoded, or carrying a public key) are held whole, behind full.
+ */
+struct WirePacket {
+    NodeNum from;
+    NodeNum to;
+    PacketId id;
+    uint32_t rx_time;
+    float rx_snr;
+    int32_t rx_rssi;
+    uint32_t tx_after;
+    uint8_t channel;
+    uint8_t hop_limit;
+    uint8_t hop_start;
+    uint8_t next_hop;
+    uint8_t relay_node;
+    uint8_t priority;
+    uint8_t delayed;
+    bool want_ack;
+    bool via_mqtt;
+    bool large; // Which pool the buffer came from
+    uint16_t size;
+    meshtastic_MeshPacket *full; // The packet itself, if it couldn't be made compact
+
+    /// Take over p, compacting it if it is still encrypted, otherwise wrapping it
+    static WirePacket *fromPacket(meshtastic_MeshPacket *p);
+
+    /// Turn back into a packetPool packet, releasing this
+    meshtastic_MeshPacket *expand();
+
+    /// Drop this and what it holds
+    void release();
+
+    /// The header fields as a packet, for code that only reads those.  Either full, or scratch filled in with no payload
+    const meshtastic_MeshPacket *view(meshtastic_MeshPacket &scratch) const;
+
+    uint8_t *bytes() { return (uint8_t *)(this + 1); }
+    const uint8_t *bytes() const { return (const uint8_t *)(this + 1); }
+};
@@ -1,4 +1,5 @@
 #include "ServerAPI.h"
+#include "MeshService.h"
 #include "configuration.h"
 #include <Arduino.h>
 
@@ -6,11 +7,14 @@ template <typename T>
 ServerAPI<T>::ServerAPI(T &_client) : StreamAPI(&client), concurrency::OSThread("ServerAPI"), client(_client)
 {
     LOG_INFO("Incoming API connection");
+    clientQueue = &packetQueue;
+    service->addClientQueue(&packetQueue);
 }
 
 template <typename T> ServerAPI<T>::~ServerAPI()
 {
     client.stop();
+    service->removeClientQueue(&packetQueue);
 }
 
 template <typename T> void ServerAPI<T>::close()
@@ -36,7 +40,13 @@ template <class T> int32_t ServerAPI<T>::runOnce()
     }
 }
 
-template <class T, class U> APIServerPort<T, U>::APIServerPort(int port) : U(port), concurrency::OSThread("ApiServer") {}
+template <class T, class U> APIServerPort<T, U>::~APIServerPort()
+{
+    for (T *&api : openAPIs) {
+        delete api;
+        api = NULL;
+    }
+}
 
 template <class T, class U> void APIServerPort<T, U>::init()
 {
@@ -45,6 +55,19 @@ template <class T, class U> void APIServerPort<T, U>::init()
 
 template <class T, class U> int32_t APIServerPort<T, U>::runOnce()
 {
+    // Forget the connections that went away, keeping the rest in order
+    int numOpen = 0;
+    for (int i = 0; i < SERVER_API_MAX_CLIENTS; i++) {
+        T *api = openAPIs[i];
+        openAPIs[i] = NULL;
+        if (!api)
+            continue;
+        if (api->isClientConnected())
+            openAPIs[numOpen++] = api;
+        else
+            delete api;
+    }
+
 #ifdef ARCH_ESP32
 #if ESP_ARDUINO_VERSION >= ESP_ARDUINO_VERSION_VAL(3, 0, 0)
     auto client = U::accept();
@@ -57,8 +80,8 @@ template <class T, class U> int32_t APIServerPort<T, U>::runOnce()
     auto client = U::available();
 #endif
     if (client) {
-        // Close any previous connection (see FIXME in header file)
-        if (openAPI) {
+        // Close the oldest connection if there is no room for this one
+        if (numOpen == SERVER_API_MAX_CLIENTS) {
 #if RAK_4631
             // RAK13800 Ethernet requests periodically take more time
             // This backoff addresses most cases keeping max wait < 1s
@@ -70,10 +93,13 @@ template <class T, class U> int32_t APIServerPort<T, U>::runOnce()
             }
 #endif
             LOG_INFO("Force close previous TCP connection");
-            delete openAPI;
+            delete openAPIs[0];
+            for (int i = 1; i < SERVER_API_MAX_CLIENTS; i++)
+                openAPIs[i - 1] = openAPIs[i];
+            numOpen--;
         }
 
-        openAPI = new T(client);
+        openAPIs[numOpen] = new T(client);
     }
 
 #if RAK_4631
@@ -4,6 +4,15 @@
 
 #define SERVER_API_DEFAULT_PORT 4403
 
+// How many TCP API clients can be connected at once, once full the oldest one is dropped for a new one
+#ifndef SERVER_API_MAX_CLIENTS
+#if ARCH_PORTDUINO
+#define SERVER_API_MAX_CLIENTS 8
+#else
+#define SERVER_API_MAX_CLIENTS 1
+#endif
+#endif
+
 /**
  * Provides both debug printing and, if the client starts sending protobufs to us, switches to send/receive protobufs
  * (and starts dropping debug printing - FIXME, eventually those prints should be encapsulated in protobufs).
@@ -13,6 +22,9 @@ template <class T> class ServerAPI : public StreamAPI, private concurrency::OSTh
   private:
     T client;
 
+    /// Every client gets its own share of each packet for the phone, so several can be connected side by side
+    PointerQueue<meshtastic_MeshPacket> packetQueue = PointerQueue<meshtastic_MeshPacket>(MAX_RX_TOPHONE);
+
   public:
     explicit ServerAPI(T &_client);
 
@@ -21,6 +33,9 @@ template <class T> class ServerAPI : public StreamAPI, private concurrency::OSTh
     /// override close to also shutdown the TCP link
     virtual void close();
 
+    /// Is the TCP link still up?
+    bool isClientConnected() { return client.connected(); }
+
   protected:
     /// We override this method to prevent publishing EVENT_SERIAL_CONNECTED/DISCONNECTED for wifi links (we want the board to
     /// stay in the POWERED state to prevent disabling wifi)
@@ -37,19 +52,20 @@ template <class T> class ServerAPI : public StreamAPI, private concurrency::OSTh
  */
 template <class T, class U> class APIServerPort : public U, private concurrency::OSThread
 {
-    /** The currently open port
-     *
-     * FIXME: We currently only allow one open TCP connection at a time, because we depend on the loop() call in this class to
-     * delegate to the worker.  Once coroutines are implemented we can relax this restriction.
+    /** The currently open connections, oldest first.  Each one is its own thread with its own PhoneAPI state, we just
+     * accept them and clean up after the ones that went away.
      */
-    T *openAPI = NULL;
+    T *openAPIs[SERVER_API_MAX_CLIENTS] = {};
 #if defined(RAK_4631) || defined(RAK11310)
     // Track wait time for RAK13800 Ethernet requests
     int32_t waitTime = 100;
 #endif
 
   public:
-    explicit APIServerPort(int port);
+    /// Whatever U listens on, a port for the TCP servers
+    template <typename A> explicit APIServerPort(A address) : U(address), concurrency::OSThread("ApiServer") {}
+
+    ~APIServerPort();
 
     void init();
 
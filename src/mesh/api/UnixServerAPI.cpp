@@ -0,0 +1,134 @@
+#include "configuration.h"
+
+#ifdef ARCH_PORTDUINO
+#include "UnixServerAPI.h"
+#include <errno.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static UnixServerPort *unixApiPort;
+
+void initUnixApiServer(const std::string &path)
+{
+    if (!unixApiPort && !path.empty()) {
+        unixApiPort = new UnixServerPort(path);
+        unixApiPort->init();
+    }
+}
+
+size_t UnixClient::write(const uint8_t *buf, size_t size)
+{
+    size_t sent = 0;
+    while (fd >= 0 && sent < size) {
+        // A reader that lets the socket buffer fill up has stopped reading, better to drop it than to stall the mesh
+        ssize_t n = send(fd, buf + sent, size - sent, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (n > 0)
+            sent += n;
+        else if (n < 0 && errno == EINTR)
+            continue;
+        else {
+            LOG_WARN("API socket client isn't reading, drop it");
+            stop();
+        }
+    }
+    return sent;
+}
+
+int UnixClient::available()
+{
+    int n = 0;
+    if (fd < 0 || ioctl(fd, FIONREAD, &n) < 0)
+        return 0;
+    return n;
+}
+
+int UnixClient::read()
+{
+    uint8_t b;
+    return read(&b, 1) == 1 ? b : -1;
+}
+
+int UnixClient::read(uint8_t *buf, size_t size)
+{
+    if (fd < 0)
+        return -1;
+    ssize_t n = recv(fd, buf, size, MSG_DONTWAIT);
+    return n > 0 ? n : -1;
+}
+
+int UnixClient::peek()
+{
+    uint8_t b;
+    return fd >= 0 && recv(fd, &b, 1, MSG_DONTWAIT | MSG_PEEK) == 1 ? b : -1;
+}
+
+void UnixClient::stop()
+{
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+uint8_t UnixClient::connected()
+{
+    if (fd < 0)
+        return false;
+    // Anything to read, or nothing yet, is still connected.  Only an orderly close reads as 0 bytes
+    uint8_t b;
+    ssize_t n = recv(fd, &b, 1, MSG_DONTWAIT | MSG_PEEK);
+    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+        stop();
+    return fd >= 0;
+}
+
+UnixServer::~UnixServer()
+{
+    if (listenFd >= 0) {
+        ::close(listenFd);
+        unlink(path.c_str());
+    }
+}
+
+void UnixServer::begin()
+{
+    sockaddr_un addr = {};
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) {
+        LOG_ERROR("API socket path %s is too long", path.c_str());
+        return;
+    }
+    strcpy(addr.sun_path, path.c_str());
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listenFd < 0) {
+        LOG_ERROR("Can't create API socket: %s", strerror(errno));
+        return;
+    }
+    unlink(path.c_str()); // Left over from a run that didn't get to clean up
+    if (bind(listenFd, (sockaddr *)&addr, sizeof(addr)) < 0 || listen(listenFd, SERVER_API_MAX_CLIENTS) < 0) {
+        LOG_ERROR("Can't listen on API socket %s: %s", path.c_str(), strerror(errno));
+        ::close(listenFd);
+        listenFd = -1;
+        return;
+    }
+    LOG_INFO("API server listen on %s", path.c_str());
+}
+
+UnixClient UnixServer::available()
+{
+    if (listenFd < 0)
+        return UnixClient();
+    return UnixClient(accept4(listenFd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC));
+}
+
+UnixServerAPI::UnixServerAPI(UnixClient &_client) : ServerAPI(_client)
+{
+    LOG_INFO("Incoming API socket connection");
+}
+
+UnixServerPort::UnixServerPort(const std::string &path) : APIServerPort(path) {}
+#endif
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "ServerAPI.h"
+#include <Client.h>
+#include <string>
+
+/**
+ * One end of a connection on a Unix domain socket, as an Arduino Client so ServerAPI can run the stream protocol over it.
+ * Copies share the socket, which only stop() closes, the same as the TCP clients.
+ */
+class UnixClient : public Client
+{
+  public:
+    explicit UnixClient(int fd = -1) : fd(fd) {}
+
+    int connect(IPAddress ip, uint16_t port) override { return 0; }
+    int connect(const char *host, uint16_t port) override { return 0; }
+    size_t write(uint8_t b) override { return write(&b, 1); }
+    size_t write(const uint8_t *buf, size_t size) override;
+    int available() override;
+    int read() override;
+    int read(uint8_t *buf, size_t size) override;
+    int peek() override;
+    void flush() override {}
+    void stop() override;
+    uint8_t connected() override;
+    operator bool() override { return fd >= 0; }
+
+  private:
+    int fd;
+};
+
+/**
+ * Listens on a Unix domain socket, with what APIServerPort needs of a TCP server
+ */
+class UnixServer
+{
+  public:
+    explicit UnixServer(const std::string &path) : path(path) {}
+    ~UnixServer();
+
+    void begin();
+    UnixClient available();
+
+  private:
+    std::string path;
+    int listenFd = -1;
+};
+
+/**
+ * The API for programs on the same machine: no TCP loopback, and only they can reach it, as far as the socket's file mode
+ * lets them.
+ */
+class UnixServerAPI : public ServerAPI<UnixClient>
+{
+  public:
+    explicit UnixServerAPI(UnixClient &_client);
+};
+
+/**
+ * Accepts connections on the API socket and creates instances of UnixServerAPI as needed
+ */
+class UnixServerPort : public APIServerPort<UnixServerAPI, UnixServer>
+{
+  public:
+    explicit UnixServerPort(const std::string &path);
+};
+
+/// Serve the API on this Unix socket too (General: APISocket in config.yaml)
+void initUnixApiServer(const std::string &path);
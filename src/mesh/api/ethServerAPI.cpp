@@ -17,7 +17,7 @@ void initApiServer(int port)
     }
 }
 
-ethServerAPI::ethServerAPI(EthernetClient &_client) : ServerAPI(_client)
+ethServerAPI::ethServerAPI(ethBurstClient &_client) : ServerAPI(_client)
 {
     LOG_INFO("Incoming ethernet connection");
 }
@@ -2,22 +2,22 @@
 
 #include "ServerAPI.h"
 #ifndef USE_WS5500
-#include <RAK13800_W5100S.h>
+#include "mesh/eth/ethBurstClient.h"
 
 /**
  * Provides both debug printing and, if the client starts sending protobufs to us, switches to send/receive protobufs
  * (and starts dropping debug printing - FIXME, eventually those prints should be encapsulated in protobufs).
  */
-class ethServerAPI : public ServerAPI<EthernetClient>
+class ethServerAPI : public ServerAPI<ethBurstClient>
 {
   public:
-    explicit ethServerAPI(EthernetClient &_client);
+    explicit ethServerAPI(ethBurstClient &_client);
 };
 
 /**
  * Listens for incoming connections and does accepts and creates instances of EthernetServerAPI as needed
  */
-class ethServerPort : public APIServerPort<ethServerAPI, EthernetServer>
+class ethServerPort : public APIServerPort<ethServerAPI, ethBurstServer>
 {
   public:
     explicit ethServerPort(int port);
@@ -334,18 +334,52 @@ int32_t readUTF8(const char *in, int len, int l, int *utf8len)
     return ret;
 }
 
+/// Longest input that gets a match chain, which is every mesh payload. Longer input is searched the slow way.
+#define USX_CHAIN_MAX 255
+/// Marks the end of a match chain
+#define USX_CHAIN_END 0xFF
+
+/// Earlier positions in the input chained by a hash of the 3 bytes starting there. A repeat of NICE_LEN or more
+/// starts with the same 3 bytes, so matchOccurance() only has to look at the positions on one chain.
+struct usx_chain {
+    uint8_t head[256];              ///< Latest position for each hash, or USX_CHAIN_END
+    uint8_t prev[USX_CHAIN_MAX];    ///< The position before this one with the same hash, or USX_CHAIN_END
+    int added;                      ///< Positions below this are on their chains
+};
+
+/// Hash of the 3 bytes at in
+static inline uint8_t usx_chain_hash(const char *in)
+{
+    return (uint8_t)(((uint8_t)in[0] << 5) ^ ((uint8_t)in[1] << 2) ^ (uint8_t)in[2]);
+}
+
+/// Puts every position a repeat at l could start from on its chain
+static void usx_chain_add(struct usx_chain *chain, const char *in, int l)
+{
+    for (; chain->added <= l - NICE_LEN; chain->added++) {
+        uint8_t h = usx_chain_hash(in + chain->added);
+        chain->prev[chain->added] = chain->head[h];
+        chain->head[h] = chain->added;
+    }
+}
+
 /// Finds the longest matching sequence from the beginning of the string. \n
 /// If a match is found and it is longer than NICE_LEN, it is encoded as a repeating sequence to out \n
 /// This is also used for Unicode strings \n
-/// This is a crude implementation that is not optimized.  Assuming only short strings \n
-/// are encoded, this is not much of an issue.
+/// With a chain only the earlier positions sharing the first 3 bytes are tried, newest first, so the result is the same \n
+/// as trying every one of them.
 int matchOccurance(const char *in, int len, int l, char *out, int olen, int *ol, const uint8_t *state, const uint8_t usx_hcodes[],
-                   const uint8_t usx_hcode_lens[])
+                   const uint8_t usx_hcode_lens[], struct usx_chain *chain)
 {
     int j, k;
     int longest_dist = 0;
     int longest_len = 0;
-    for (j = l - NICE_LEN; j >= 0; j--) {
+    if (chain) {
+        usx_chain_add(chain, in, l);
+        j = chain->head[usx_chain_hash(in + l)];
+    } else
+        j = l - NICE_LEN;
+    for (; chain ? j != USX_CHAIN_END : j >= 0; j = chain ? chain->prev[j] : j - 1) {
         for (k = l; k < len && j + k - l < l; k++) {
             if (in[k] != in[j + k - l])
                 break;
@@ -472,6 +506,17 @@ char getNibbleType(char ch)
     return USX_NIB_NOT;
 }
 
+/// Whether ch fits template character c_t: 'f'/'F' a lower/upper case hex digit, 'r', 't' and 'o' a digit up to 7, 3 \n
+/// and 1, anything else only itself
+static inline int usx_template_char_ok(char c_t, char ch)
+{
+    if (c_t == 'f' || c_t == 'F')
+        return getNibbleType(ch) == (c_t == 'f' ? USX_NIB_HEX_LOWER : USX_NIB_HEX_UPPER) || getNibbleType(ch) == USX_NIB_NUM;
+    if (c_t == 'r' || c_t == 't' || c_t == 'o')
+        return ch >= '0' && ch <= (c_t == 'r' ? '7' : (c_t == 't' ? '3' : '1'));
+    return c_t == ch;
+}
+
 /// Starts coding of nibble sets
 int append_nibble_escape(char *out, int olen, int ol, uint8_t state, const uint8_t usx_hcodes[], const uint8_t usx_hcode_lens[])
 {
@@ -547,6 +592,14 @@ int unishox2_compress_lines(const char *in, int len, UNISHOX_API_OUT_AND_LEN(cha
     }
 #endif
 
+    struct usx_chain chain_store;
+    struct usx_chain *chain = NULL;
+    if (!prev_lines && len <= USX_CHAIN_MAX) {
+        chain = &chain_store;
+        memset(chain->head, USX_CHAIN_END, sizeof(chain->head));
+        chain->added = 0;
+    }
+
     init_coder();
     ol = 0;
     prev_uni = 0;
@@ -565,7 +618,7 @@ int unishox2_compress_lines(const char *in, int len, UNISHOX_API_OUT_AND_LEN(cha
                 }
                 l = -l;
             } else {
-                l = matchOccurance(in, len, l, out, olen, &ol, &state, usx_hcodes, usx_hcode_lens);
+                l = matchOccurance(in, len, l, out, olen, &ol, &state, usx_hcodes, usx_hcode_lens, chain);
                 if (l > 0) {
                     continue;
                 } else if (l < 0 && ol < 0) {
@@ -655,21 +708,12 @@ int unishox2_compress_lines(const char *in, int len, UNISHOX_API_OUT_AND_LEN(cha
         if (usx_templates != NULL) {
             int i;
             for (i = 0; i < 5; i++) {
-                if (usx_templates[i]) {
+                // Most positions can't even start a template, don't measure the template for those
+                if (usx_templates[i] && usx_template_char_ok(usx_templates[i][0], in[l])) {
                     int rem = (int)strlen(usx_templates[i]);
                     int j = 0;
                     for (; j < rem && l + j < len; j++) {
-                        char c_t = usx_templates[i][j];
-                        c_in = in[l + j];
-                        if (c_t == 'f' || c_t == 'F') {
-                            if (getNibbleType(c_in) != (c_t == 'f' ? USX_NIB_HEX_LOWER : USX_NIB_HEX_UPPER) &&
-                                getNibbleType(c_in) != USX_NIB_NUM) {
-                                break;
-                            }
-                        } else if (c_t == 'r' || c_t == 't' || c_t == 'o') {
-                            if (c_in < '0' || c_in > (c_t == 'r' ? '7' : (c_t == 't' ? '3' : '1')))
-                                break;
-                        } else if (c_t != c_in)
+                        if (!usx_template_char_ok(usx_templates[i][j], in[l + j]))
                             break;
                     }
                     if (((float)j / rem) > 0.66) {
@@ -702,6 +746,8 @@ int unishox2_compress_lines(const char *in, int len, UNISHOX_API_OUT_AND_LEN(cha
         if (usx_freq_seq != NULL) {
             int i;
             for (i = 0; i < 6; i++) {
+                if (usx_freq_seq[i][0] != in[l])
+                    continue;
                 int seq_len = (int)strlen(usx_freq_seq[i]);
                 if (len - seq_len >= 0 && l <= len - seq_len) {
                     if (memcmp(usx_freq_seq[i], in + l, seq_len) == 0 && usx_hcode_lens[usx_freq_codes[i] >> 5]) {
@@ -897,49 +943,39 @@ int read8bitCode(const char *in, int len, int bit_no)
     return code;
 }
 
-/// The list of veritical codes is split into 5 sections. Used by readVCodeIdx()
-#define SECTION_COUNT 5
-/// Used by readVCodeIdx() for finding the section under which the code read using read8bitCode() falls
-uint8_t usx_vsections[] = {0x7F, 0xBF, 0xDF, 0xEF, 0xFF};
-/// Used by readVCodeIdx() for finding the section vertical position offset
-uint8_t usx_vsection_pos[] = {0, 4, 8, 12, 20};
-/// Used by readVCodeIdx() for masking the code read by read8bitCode()
-uint8_t usx_vsection_mask[] = {0x7F, 0x3F, 0x1F, 0x0F, 0x0F};
-/// Used by readVCodeIdx() for shifting the code read by read8bitCode() to obtain the vpos
-uint8_t usx_vsection_shift[] = {5, 4, 3, 1, 0};
-
-/// Vertical decoder lookup table - 3 bits code len, 5 bytes vertical pos
-/// code len is one less as 8 cannot be accommodated in 3 bits
-uint8_t usx_vcode_lookup[36] = {(1 << 5) + 0,  (1 << 5) + 0,  (2 << 5) + 1,  (2 << 5) + 2,  // Section 1
-                                (3 << 5) + 3,  (3 << 5) + 4,  (3 << 5) + 5,  (3 << 5) + 6,  // Section 2
-                                (3 << 5) + 7,  (3 << 5) + 7,  (4 << 5) + 8,  (4 << 5) + 9,  // Section 3
-                                (5 << 5) + 10, (5 << 5) + 10, (5 << 5) + 11, (5 << 5) + 11, // Section 4
-                                (5 << 5) + 12, (5 << 5) + 12, (6 << 5) + 13, (6 << 5) + 14, (6 << 5) + 15, (6 << 5) + 15,
-                                (6 << 5) + 16, (6 << 5) + 16, // Section 5
-                                (6 << 5) + 17, (6 << 5) + 17, (7 << 5) + 18, (7 << 5) + 19, (7 << 5) + 20, (7 << 5) + 21,
-                                (7 << 5) + 22, (7 << 5) + 23, (7 << 5) + 24, (7 << 5) + 25, (7 << 5) + 26, (7 << 5) + 27};
+/// Vertical decoder lookup table, indexed by the next 8 bits read by read8bitCode() \n
+/// 3 bits code len, 5 bits vertical pos. Code len is one less as 8 cannot be accommodated in 3 bits \n
+/// The original split this into 5 sections to fit in 36 bytes, a lookup per code is faster and the table lives in flash.
+static const uint8_t usx_vcode_lookup[256] = {
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xCD, 0xCD, 0xCE, 0xCE,
+    0xCF, 0xCF, 0xD0, 0xD0, 0xD1, 0xD1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB,
+};
 
 /// Decodes the vertical code from the given bitstream at in \n
-/// This is designed to use less memory using a 36 uint8_t buffer \n
-/// compared to using a 256 uint8_t buffer to decode the next 8 bits read by read8bitCode() \n
-/// by splitting the list of vertical codes. \n
-/// Decoder is designed for using less memory, not speed. \n
 /// Returns the veritical code index or 99 if match could not be found. \n
 /// Also updates bit_no_p with how many ever bits used by the vertical code.
 int readVCodeIdx(const char *in, int len, int *bit_no_p)
 {
     if (*bit_no_p < len) {
-        uint8_t code = read8bitCode(in, len, *bit_no_p);
-        int i = 0;
-        do {
-            if (code <= usx_vsections[i]) {
-                uint8_t vcode = usx_vcode_lookup[usx_vsection_pos[i] + ((code & usx_vsection_mask[i]) >> usx_vsection_shift[i])];
-                (*bit_no_p) += ((vcode >> 5) + 1);
-                if (*bit_no_p > len)
-                    return 99;
-                return vcode & 0x1F;
-            }
-        } while (++i < SECTION_COUNT);
+        uint8_t vcode = usx_vcode_lookup[read8bitCode(in, len, *bit_no_p)];
+        (*bit_no_p) += ((vcode >> 5) + 1);
+        if (*bit_no_p > len)
+            return 99;
+        return vcode & 0x1F;
     }
     return 99;
 }
@@ -0,0 +1,193 @@
+#include "mesh/eth/ethBurstClient.h"
+
+#if HAS_ETHERNET && !defined(USE_WS5500)
+#include "SPILock.h"
+#include <string.h>
+
+#ifdef PIN_ETHERNET_INT
+#include <utility/w5100.h>
+
+#define ETH_W5500 55              // W5100.getChip()
+#define ETH_REG_IMR 0x0016        // Socket interrupt mask on the W5100 and W5100S
+#define ETH_REG_SIMR_W5500 0x0018 // and on the W5500
+
+// The send events are the library's to clear, it waits on them
+#define ETH_SOCKET_EVENTS (SnIR::RECV | SnIR::DISCON | SnIR::CON)
+
+// Call with the bus held
+static void setSocketInterrupt(uint8_t s, bool on)
+{
+    uint16_t reg = W5100.getChip() == ETH_W5500 ? ETH_REG_SIMR_W5500 : ETH_REG_IMR;
+    ETH_SPI_PORT.beginTransaction(SPI_ETHERNET_SETTINGS);
+    uint8_t mask = W5100.read(reg);
+    W5100.write(reg, on ? mask | (1 << s) : mask & ~(1 << s));
+    ETH_SPI_PORT.endTransaction();
+}
+#endif
+
+bool ethBurstClient::stillKnown(uint8_t what)
+{
+#ifdef PIN_ETHERNET_INT
+    // INTn stays low while any unmasked socket has an event, so high means nothing changed since we cleared ours
+    uint8_t s = getSocketNumber();
+    if (s == intSocket && (known & what) == what && digitalRead(PIN_ETHERNET_INT) == HIGH)
+        return true;
+
+    known = 0;
+    SPIGuard g(SPI_CLIENT_ETHERNET);
+    if (s != intSocket) {
+        if (intSocket < MAX_SOCK_NUM)
+            setSocketInterrupt(intSocket, false);
+        if (s < MAX_SOCK_NUM)
+            setSocketInterrupt(s, true);
+        intSocket = s;
+    }
+    if (s < MAX_SOCK_NUM) {
+        // Clear before looking, so an event that comes in while we do pulls INTn low again
+        ETH_SPI_PORT.beginTransaction(SPI_ETHERNET_SETTINGS);
+        W5100.writeSnIR(s, ETH_SOCKET_EVENTS);
+        ETH_SPI_PORT.endTransaction();
+    }
+#else
+    (void)what; // Without INTn we can't tell, so always ask
+#endif
+    return false;
+}
+
+int ethBurstClient::available()
+{
+    if (rxHead < rxLen)
+        return rxLen - rxHead;
+    if (stillKnown(KNOWN_EMPTY))
+        return 0;
+
+    SPIGuard g(SPI_CLIENT_ETHERNET);
+    int n = EthernetClient::available();
+    if (n == 0)
+        known |= KNOWN_EMPTY;
+    return n;
+}
+
+uint8_t ethBurstClient::connected()
+{
+    if (rxHead < rxLen)
+        return 1;
+    if (stillKnown(KNOWN_STATE))
+        return lastConnected;
+
+    SPIGuard g(SPI_CLIENT_ETHERNET);
+    lastConnected = EthernetClient::connected();
+    known |= KNOWN_STATE;
+    return lastConnected;
+}
+
+bool ethBurstClient::refill()
+{
+    if (!available())
+        return false;
+
+    SPIGuard g(SPI_CLIENT_ETHERNET);
+    int n = EthernetClient::read(rxBuf, sizeof(rxBuf));
+    rxHead = 0;
+    rxLen = n > 0 ? n : 0;
+    return rxLen != 0;
+}
+
+int ethBurstClient::read()
+{
+    if (rxHead == rxLen && !refill())
+        return -1;
+    return rxBuf[rxHead++];
+}
+
+int ethBurstClient::read(uint8_t *buf, size_t size)
+{
+    size_t n = rxLen - rxHead;
+    if (n > size)
+        n = size;
+    memcpy(buf, rxBuf + rxHead, n);
+    rxHead += n;
+
+    // The caller has room for a burst of its own, no need to go through ours
+    if (n < size && available()) {
+        SPIGuard g(SPI_CLIENT_ETHERNET);
+        int got = EthernetClient::read(buf + n, size - n);
+        if (got > 0)
+            n += got;
+    }
+    return n ? n : -1;
+}
+
+int ethBurstClient::peek()
+{
+    if (rxHead == rxLen && !refill())
+        return -1;
+    return rxBuf[rxHead];
+}
+
+size_t ethBurstClient::write(const uint8_t *buf, size_t size)
+{
+    size_t sent = 0;
+    while (sent < size) {
+        size_t chunk = size - sent > SPI_MAX_CHUNK_BYTES ? SPI_MAX_CHUNK_BYTES : size - sent;
+        spiYieldToRadio();
+        {
+            SPIGuard g(SPI_CLIENT_ETHERNET);
+            int room = availableForWrite();
+            if (room > 0) {
+                // Only what fits, or the library holds the bus while it waits for the peer to acknowledge
+                size_t n = EthernetClient::write(buf + sent, chunk < (size_t)room ? chunk : room);
+                if (n == 0)
+                    break;
+                sent += n;
+                continue;
+            }
+            if (!EthernetClient::connected())
+                break;
+        }
+        yield(); // Wait for room with the bus released
+    }
+    return sent;
+}
+
+void ethBurstClient::flush()
+{
+    SPIGuard g(SPI_CLIENT_ETHERNET);
+    EthernetClient::flush();
+}
+
+void ethBurstClient::stop()
+{
+    rxHead = rxLen = 0;
+    known = 0;
+#ifdef PIN_ETHERNET_INT
+    if (intSocket < MAX_SOCK_NUM) {
+        SPIGuard g(SPI_CLIENT_ETHERNET);
+        setSocketInterrupt(intSocket, false); // The socket may be a UDP one next, whose events nobody clears
+        intSocket = MAX_SOCK_NUM;
+    }
+#endif
+    // Not holding the bus, this waits up to a second for the peer to close
+    EthernetClient::stop();
+}
+
+void ethBurstServer::begin()
+{
+    SPIGuard g(SPI_CLIENT_ETHERNET);
+    EthernetServer::begin();
+}
+
+ethBurstClient ethBurstServer::available()
+{
+    SPIGuard g(SPI_CLIENT_ETHERNET);
+    return ethBurstClient(EthernetServer::available());
+}
+
+#ifdef ARCH_RP2040
+ethBurstClient ethBurstServer::accept()
+{
+    SPIGuard g(SPI_CLIENT_ETHERNET);
+    return ethBurstClient(EthernetServer::accept());
+}
+#endif
+#endif
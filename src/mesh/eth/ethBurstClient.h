@@ -0,0 +1,70 @@
+#pragma once
+
+#include "configuration.h"
+
+#if HAS_ETHERNET && !defined(USE_WS5500)
+#include <RAK13800_W5100S.h>
+
+// Received TCP data is pulled off the chip this many bytes at a time, rather than one byte per socket read as Stream users ask
+#ifndef ETH_RX_BURST_BYTES
+#define ETH_RX_BURST_BYTES 256
+#endif
+
+// Define PIN_ETHERNET_INT in the variant if the chip's INTn is wired: a quiet socket then costs a pin read instead of SPI polls
+
+/**
+ * An EthernetClient for the TCP streams (the API and MQTT) that moves data in bursts and shares the SPI bus.
+ *
+ * Reads fill a buffer of ETH_RX_BURST_BYTES in one socket read.  Writes go out in chunks of at most SPI_MAX_CHUNK_BYTES,
+ * and never more than the socket has room for, so spiLock is held while bytes move but not while we wait on the peer to
+ * acknowledge.  The radio can take the bus between chunks.
+ */
+class ethBurstClient : public EthernetClient
+{
+  public:
+    ethBurstClient() {}
+    explicit ethBurstClient(const EthernetClient &c) : EthernetClient(c) {}
+
+    using Print::write;
+    size_t write(uint8_t b) override { return write(&b, 1); }
+    size_t write(const uint8_t *buf, size_t size) override;
+    int available() override;
+    int read() override;
+    int read(uint8_t *buf, size_t size) override;
+    int peek() override;
+    void flush() override;
+    void stop() override;
+    uint8_t connected() override;
+
+  private:
+    uint8_t rxBuf[ETH_RX_BURST_BYTES];
+    uint16_t rxHead = 0, rxLen = 0;
+
+    /// Read the next burst into rxBuf, @return false if the socket has nothing
+    bool refill();
+
+    // What we last read of the socket, and whether it still holds (with INTn, until the chip raises an event on any socket)
+    enum : uint8_t { KNOWN_EMPTY = 1, KNOWN_STATE = 2 };
+    uint8_t known = 0;
+    uint8_t lastConnected = 0;
+    uint8_t intSocket = MAX_SOCK_NUM; // The socket we unmasked the interrupt of
+
+    /// Can what's known stand without asking the chip?  If not, forget it and clear our socket's events before looking again
+    bool stillKnown(uint8_t what);
+};
+
+/**
+ * An EthernetServer that hands out ethBurstClients
+ */
+class ethBurstServer : public EthernetServer
+{
+  public:
+    explicit ethBurstServer(uint16_t port) : EthernetServer(port) {}
+
+    void begin();
+    ethBurstClient available();
+#ifdef ARCH_RP2040
+    ethBurstClient accept();
+#endif
+};
+#endif
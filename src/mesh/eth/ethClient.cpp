@@ -119,6 +119,10 @@ bool initEthernet()
         digitalWrite(PIN_ETHERNET_RESET, HIGH); // Reset Time.
 #endif
 
+#ifdef PIN_ETHERNET_INT
+        pinMode(PIN_ETHERNET_INT, INPUT_PULLUP); // See ethBurstClient, which unmasks the interrupts of its own sockets
+#endif
+
 #ifdef RAK11310 // Initialize the SPI port
         ETH_SPI_PORT.setSCK(PIN_SPI0_SCK);
         ETH_SPI_PORT.setTX(PIN_SPI0_MOSI);
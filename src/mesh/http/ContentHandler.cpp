@@ -1,4 +1,5 @@
 #if !MESHTASTIC_EXCLUDE_WEBSERVER
+#include "FrameCapture.h"
 #include "NodeDB.h"
 #include "PowerFSM.h"
 #include "RadioLibInterface.h"
@@ -11,6 +12,7 @@
 #endif
 #include "Led.h"
 #include "SPILock.h"
+#include "StreamAPI.h"
 #include "power.h"
 #include "serialization/JSON.h"
 #include <FSCommon.h>
@@ -53,6 +55,10 @@ HTTPClient httpClient;
 
 #define DEST_FS_USES_LITTLEFS
 
+#ifndef HTTP_STATIC_CHUNK_BYTES
+#define HTTP_STATIC_CHUNK_BYTES 512 // How much of a static file we read from the flash at a time while sending it
+#endif
+
 // We need to specify some content-type mapping, so the resources get delivered with the
 // right content type and are displayed correctly in the browser
 char contentTypes[][2][32] = {{".txt", "text/plain"},     {".html", "text/html"},
@@ -95,6 +101,7 @@ void registerHandlers(HTTPServer *insecureServer, HTTPSServer *secureServer)
     ResourceNode *nodeJsonBlinkLED = new ResourceNode("/json/blink", "POST", &handleBlinkLED);
     ResourceNode *nodeJsonReport = new ResourceNode("/json/report", "GET", &handleReport);
     ResourceNode *nodeJsonNodes = new ResourceNode("/json/nodes", "GET", &handleNodes);
+    ResourceNode *nodeCapture = new ResourceNode("/capture.pcapng", "GET", &handleCapture);
     ResourceNode *nodeJsonFsBrowseStatic = new ResourceNode("/json/fs/browse/static", "GET", &handleFsBrowseStatic);
     ResourceNode *nodeJsonDelete = new ResourceNode("/json/fs/delete/static", "DELETE", &handleFsDeleteStatic);
 
@@ -115,6 +122,7 @@ void registerHandlers(HTTPServer *insecureServer, HTTPSServer *secureServer)
     secureServer->registerNode(nodeJsonDelete);
     secureServer->registerNode(nodeJsonReport);
     secureServer->registerNode(nodeJsonNodes);
+    secureServer->registerNode(nodeCapture);
     //    secureServer->registerNode(nodeUpdateFs);
     //    secureServer->registerNode(nodeDeleteFs);
     secureServer->registerNode(nodeAdmin);
@@ -137,6 +145,7 @@ void registerHandlers(HTTPServer *insecureServer, HTTPSServer *secureServer)
     insecureServer->registerNode(nodeJsonFsBrowseStatic);
     insecureServer->registerNode(nodeJsonDelete);
     insecureServer->registerNode(nodeJsonReport);
+    insecureServer->registerNode(nodeCapture);
     //    insecureServer->registerNode(nodeUpdateFs);
     //    insecureServer->registerNode(nodeDeleteFs);
     insecureServer->registerNode(nodeAdmin);
@@ -178,6 +187,21 @@ void handleAPIv1FromRadio(HTTPRequest *req, HTTPResponse *res)
     uint8_t txBuf[MAX_STREAM_BUF_SIZE];
     uint32_t len = 1;
 
+    // With stream=true send everything we have as StreamAPI frames, so the client can split one response into packets.  This
+    // server runs in the main loop and can't wait for more to arrive, clients long-poll against the portduino server instead.
+    std::string valueStream;
+    if (params->getQueryParameter("stream", valueStream) && valueStream == "true") {
+        res->setHeader("Content-Type", "application/octet-stream");
+        size_t total = 0;
+        while ((len = webAPI.getFromRadio(txBuf + STREAM_HEADER_LEN)) != 0) {
+            size_t framedLen = StreamAPI::frame(txBuf, len);
+            res->write(txBuf, framedLen);
+            total += framedLen;
+        }
+        LOG_DEBUG("webAPI handleAPIv1FromRadio, streamed %u bytes", total);
+        return;
+    }
+
     if (params->getQueryParameter("all", valueAll)) {
 
         // If all is true, return all the buffers we have available
@@ -225,8 +249,11 @@ void handleAPIv1ToRadio(HTTPRequest *req, HTTPResponse *res)
         return;
     }
 
-    byte buffer[MAX_TO_FROM_RADIO_SIZE];
-    size_t s = req->readBytes(buffer, MAX_TO_FROM_RADIO_SIZE);
+    // May be a batch of several ToRadio, which can take more than one read and is too big for the stack
+    static byte buffer[MAX_TO_RADIO_BATCH_SIZE];
+    size_t s = 0;
+    while (s < sizeof(buffer) && !req->requestComplete())
+        s += req->readBytes(buffer + s, sizeof(buffer) - s);
 
     LOG_DEBUG("Received %d bytes from PUT request", s);
     webAPI.handleToRadio(buffer, s);
@@ -258,6 +285,7 @@ void htmlDeleteDir(const char *dirname)
             file.close();
             LOG_DEBUG("    %s", fileName.c_str());
             FSCom.remove(fileName);
+            fileManifestChanged();
         }
         file = root.openNextFile();
     }
@@ -357,6 +385,7 @@ void handleFsDeleteStatic(HTTPRequest *req, HTTPResponse *res)
         std::string pathDelete = "/" + paramValDelete;
         concurrency::LockGuard g(spiLock);
         if (FSCom.remove(pathDelete.c_str())) {
+            fileManifestChanged();
 
             LOG_INFO("%s", pathDelete.c_str());
             JSONObject jsonObjOuter;
@@ -399,10 +428,15 @@ void handleStatic(HTTPRequest *req, HTTPResponse *res)
             filename = "/static/index.html";
             filenameGzip = "/static/index.html.gz";
         }
+        // Our assets are mostly shipped precompressed, so take the .gz whenever the client can use it
+        bool acceptsGzip = req->getHeader("Accept-Encoding").find("gzip") != std::string::npos;
 
-        concurrency::LockGuard g(spiLock);
+        spiLock->lock();
 
-        if (FSCom.exists(filename.c_str())) {
+        if (acceptsGzip && FSCom.exists(filenameGzip.c_str())) {
+            file = FSCom.open(filenameGzip.c_str());
+            res->setHeader("Content-Encoding", "gzip");
+        } else if (FSCom.exists(filename.c_str())) {
             file = FSCom.open(filename.c_str());
             if (!file.available()) {
                 LOG_WARN("File not available - %s", filename.c_str());
@@ -419,6 +453,7 @@ void handleStatic(HTTPRequest *req, HTTPResponse *res)
             file = FSCom.open(filenameGzip.c_str());
             res->setHeader("Content-Type", "text/html");
             if (!file.available()) {
+                spiLock->unlock();
 
                 LOG_WARN("File not available - %s", filenameGzip.c_str());
                 res->println("Web server is running.<br><br>The content you are looking for can't be found. Please see: <a "
@@ -431,6 +466,21 @@ void handleStatic(HTTPRequest *req, HTTPResponse *res)
             }
         }
 
+        // Files only change when someone uploads new ones, so the size and write time make a good enough ETag
+        char etag[32];
+        snprintf(etag, sizeof(etag), "\"%x-%lx\"", (unsigned)file.size(), (unsigned long)file.getLastWrite());
+        res->setHeader("ETag", etag);
+        res->setHeader("Cache-Control", "no-cache"); // Browsers may keep it, but must ask us with If-None-Match first
+        res->setHeader("Vary", "Accept-Encoding");
+        if (req->getHeader("If-None-Match") == etag) {
+            file.close();
+            spiLock->unlock();
+            res->setStatusCode(304);
+            res->setStatusText("Not Modified");
+            res->setHeader("Content-Length", "0");
+            return;
+        }
+
         res->setHeader("Content-Length", httpsserver::intToString(file.size()));
 
         // Content-Type is guessed using the definition of the contentTypes-table defined above
@@ -449,16 +499,20 @@ void handleStatic(HTTPRequest *req, HTTPResponse *res)
             res->setHeader("Content-Type", "application/octet-stream");
         }
 
-        // Read the file and write it to the HTTP response body
-        size_t length = 0;
-        do {
-            char buffer[256];
-            length = file.read((uint8_t *)buffer, 256);
-            std::string bufferString(buffer, length);
-            res->write((uint8_t *)bufferString.c_str(), bufferString.size());
-        } while (length > 0);
+        // Send the file a chunk at a time, only holding the SPI bus while we read from the flash and never while we wait
+        // for the network
+        uint8_t buffer[HTTP_STATIC_CHUNK_BYTES];
+        while (true) {
+            size_t length = file.read(buffer, sizeof(buffer));
+            spiLock->unlock();
+            if (length == 0 || res->write(buffer, length) != length)
+                break;
+            spiLock->lock();
+        }
 
+        spiLock->lock();
         file.close();
+        spiLock->unlock();
 
         return;
     } else {
@@ -548,6 +602,7 @@ void handleFormUpload(HTTPRequest *req, HTTPResponse *res)
         concurrency::LockGuard g(spiLock);
         // Create a new file to stream the data into
         File file = FSCom.open(pathname.c_str(), FILE_O_WRITE);
+        fileManifestChanged();
         size_t fileLength = 0;
         didwrite = true;
 
@@ -714,7 +769,10 @@ void handleNodes(HTTPRequest *req, HTTPResponse *res)
         res->println("<pre>");
     }
 
-    JSONArray nodesArray;
+    // With a full NodeDB the whole document would need tens of KB of heap, so we send it a node at a time.  The keys come out
+    // in the same (sorted) order JSONObject would have put them in.
+    res->print("{\"data\":{\"nodes\":[");
+    bool first = true;
 
     uint32_t readIndex = 0;
     const meshtastic_NodeInfoLite *tempNodeInfo = nodeDB->readNextMeshNode(readIndex);
@@ -748,23 +806,27 @@ void handleNodes(HTTPRequest *req, HTTPResponse *res)
             node["mac_address"] = new JSONValue(macStr);
             node["hw_model"] = new JSONValue(tempNodeInfo->user.hw_model);
 
-            nodesArray.push_back(new JSONValue(node));
+            JSONValue *value = new JSONValue(node);
+            if (!first)
+                res->print(",");
+            res->print(value->Stringify().c_str());
+            delete value;
+            first = false;
         }
         tempNodeInfo = nodeDB->readNextMeshNode(readIndex);
     }
 
-    // collect data to inner data object
-    JSONObject jsonObjInner;
-    jsonObjInner["nodes"] = new JSONValue(nodesArray);
+    res->print("]},\"status\":\"ok\"}");
+}
 
-    // create json output structure
-    JSONObject jsonObjOuter;
-    jsonObjOuter["data"] = new JSONValue(jsonObjInner);
-    jsonObjOuter["status"] = new JSONValue("ok");
-    // serialize and write it to the stream
-    JSONValue *value = new JSONValue(jsonObjOuter);
-    res->print(value->Stringify().c_str());
-    delete value;
+void handleCapture(HTTPRequest *req, HTTPResponse *res)
+{
+    std::vector<uint8_t> pcapng;
+    frameCapture.writePcapng(pcapng);
+    res->setHeader("Content-Type", "application/x-pcapng");
+    res->setHeader("Content-Disposition", "attachment; filename=\"meshtastic.pcapng\"");
+    res->setHeader("Access-Control-Allow-Origin", "*");
+    res->write(pcapng.data(), pcapng.size());
 }
 
 /*
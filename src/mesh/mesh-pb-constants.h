@@ -30,16 +30,28 @@ static_assert(sizeof(meshtastic_NodeInfoLite) <= 200, "NodeInfoLite size increas
 #define MAX_NUM_NODES 80
 #elif defined(CONFIG_IDF_TARGET_ESP32S3)
 #include "Esp.h"
+// With PSRAM for the NodeInfoLite entries only their NodeHot copies, last_heard and flag bits (about 13 bytes a node) and
+// the index take internal RAM, so the cap is set by flash for nodes.proto instead
+#ifndef PSRAM_MAX_NUM_NODES
+#define PSRAM_MAX_NUM_NODES 2000
+#endif
 static inline int get_max_num_nodes()
 {
+    static int maxNodes; // Neither flash nor PSRAM grow at runtime, and this is asked a lot
+    if (maxNodes)
+        return maxNodes;
+
     uint32_t flash_size = ESP.getFlashChipSize() / (1024 * 1024); // Convert Bytes to MB
-    if (flash_size >= 15) {
-        return 250;
+    if (flash_size >= 7 && ESP.getPsramSize() >= 2 * 1024 * 1024) {
+        maxNodes = PSRAM_MAX_NUM_NODES;
+    } else if (flash_size >= 15) {
+        maxNodes = 250;
     } else if (flash_size >= 7) {
-        return 200;
+        maxNodes = 200;
     } else {
-        return 100;
+        maxNodes = 100;
     }
+    return maxNodes;
 }
 #define MAX_NUM_NODES get_max_num_nodes()
 #else
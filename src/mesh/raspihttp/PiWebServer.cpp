@@ -37,10 +37,14 @@ mail:   marchammermann@googlemail.com
 #ifdef PORTDUINO_LINUX_HARDWARE
 #if __has_include(<ulfius.h>)
 #include "PiWebServer.h"
+#include "FrameCapture.h"
 #include "NodeDB.h"
+#include "PerfCounters.h"
 #include "PhoneAPI.h"
 #include "PowerFSM.h"
 #include "RadioLibInterface.h"
+#include "StreamAPI.h"
+#include "Throttle.h"
 #include "airtime.h"
 #include "graphics/Screen.h"
 #include "main.h"
@@ -52,14 +56,17 @@ mail:   marchammermann@googlemail.com
 #include <openssl/rsa.h>
 #include <openssl/x509.h>
 #include <orcania.h>
+#include <fcntl.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <ulfius.h>
 #include <yder.h>
 
 #include <cstring>
 #include <string>
 
-#include "PortduinoFS.h"
 #include "platform/portduino/PortduinoGlue.h"
 
 #define DEFAULT_REALM "default_realm"
@@ -103,26 +110,99 @@ const char *get_filename_ext(const char *path)
     return dot;
 }
 
+/// A static file mapped into memory, for the length of its response
+struct MappedFile {
+    void *data;
+    size_t length;
+};
+
 /**
  * Streaming callback function to ease sending large files
+ * Straight from the mapping, rather than through stdio's buffer a few hundred bytes at a time
  */
 static ssize_t callback_static_file_stream(void *cls, uint64_t pos, char *buf, size_t max)
 {
-    (void)(pos);
-    if (cls != NULL) {
-        return fread(buf, 1, max, (FILE *)cls);
-    } else {
+    MappedFile *file = (MappedFile *)cls;
+    if (file == NULL || pos >= file->length)
         return U_STREAM_END;
-    }
+    size_t n = file->length - pos < max ? file->length - pos : max;
+    memcpy(buf, (const char *)file->data + pos, n);
+    return n;
 }
 
 /**
- * Cleanup FILE* structure when streaming is complete
+ * Unmap the file when streaming is complete
  */
 static void callback_static_file_stream_free(void *cls)
 {
-    if (cls != NULL) {
-        fclose((FILE *)cls);
+    MappedFile *file = (MappedFile *)cls;
+    if (file != NULL) {
+        munmap(file->data, file->length);
+        delete file;
+    }
+}
+
+static void respond_not_found(struct _u_response *response)
+{
+    if (configWeb.redirect_on_404 == NULL) {
+        ulfius_set_string_body_response(response, 404, "File not found");
+    } else {
+        ulfius_add_header_to_response(response, "Location", configWeb.redirect_on_404);
+        response->status = 302;
+    }
+}
+
+/**
+ * Send a static file, which the caller has opened
+ * Browsers revalidate with the ETag each time, and unchanged files are answered with a bodiless 304
+ */
+static void respond_with_file(const struct _u_request *request, struct _u_response *response, int fd,
+                              const char *file_requested)
+{
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        respond_not_found(response);
+        return;
+    }
+
+    const char *content_type = u_map_get_case(&configWeb.mime_types, get_filename_ext(file_requested));
+    if (content_type == NULL) {
+        content_type = u_map_get(&configWeb.mime_types, "*");
+        LOG_DEBUG("Static File Server - Unknown mime type for extension %s ", get_filename_ext(file_requested));
+    }
+    u_map_put(response->map_header, "Content-Type", content_type);
+    u_map_copy_into(response->map_header, &configWeb.map_header);
+
+    char etag[48];
+    snprintf(etag, sizeof(etag), "\"%llx-%llx\"", (unsigned long long)st.st_mtime, (unsigned long long)st.st_size);
+    char lastModified[32];
+    struct tm modified;
+    strftime(lastModified, sizeof(lastModified), "%a, %d %b %Y %H:%M:%S GMT", gmtime_r(&st.st_mtime, &modified));
+    u_map_put(response->map_header, "ETag", etag);
+    u_map_put(response->map_header, "Last-Modified", lastModified);
+    u_map_put(response->map_header, "Cache-Control", "no-cache"); // Keep, but check with us before using
+
+    const char *ifNoneMatch = u_map_get_case(request->map_header, "If-None-Match");
+    if (ifNoneMatch && strcmp(ifNoneMatch, etag) == 0) {
+        response->status = 304;
+        return;
+    }
+
+    if (st.st_size == 0) {
+        ulfius_set_binary_body_response(response, 200, "", 0);
+        return;
+    }
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        LOG_DEBUG("callback_static_file - Can't map %s", file_requested);
+        ulfius_set_string_body_response(response, 500, "Can't read file");
+        return;
+    }
+    MappedFile *file = new MappedFile{data, (size_t)st.st_size};
+    if (ulfius_set_stream_response(response, 200, callback_static_file_stream, callback_static_file_stream_free, file->length,
+                                   STATIC_FILE_CHUNK, file) != U_OK) {
+        LOG_DEBUG("callback_static_file - Error ulfius_set_stream_response");
+        callback_static_file_stream_free(file);
     }
 }
 
@@ -131,10 +211,7 @@ static void callback_static_file_stream_free(void *cls)
  */
 int callback_static_file(const struct _u_request *request, struct _u_response *response, void *user_data)
 {
-    size_t length;
-    FILE *f;
     char *file_requested, *file_path, *url_dup_save, *real_path = NULL;
-    const char *content_type;
 
     /*
      * Comment this if statement if you don't access static files url from root dir, like /app
@@ -168,42 +245,14 @@ int callback_static_file(const struct _u_request *request, struct _u_response *r
 
         file_path = msprintf("%s/%s", configWeb.files_path, file_requested);
         real_path = realpath(file_path, NULL);
-        if (0 == o_strncmp(configWeb.files_path, real_path, o_strlen(configWeb.files_path))) {
-            if (access(file_path, F_OK) != -1) {
-                f = fopen(file_path, "rb");
-                if (f) {
-                    fseek(f, 0, SEEK_END);
-                    length = ftell(f);
-                    fseek(f, 0, SEEK_SET);
-
-                    content_type = u_map_get_case(&configWeb.mime_types, get_filename_ext(file_requested));
-                    if (content_type == NULL) {
-                        content_type = u_map_get(&configWeb.mime_types, "*");
-                        LOG_DEBUG("Static File Server - Unknown mime type for extension %s ", get_filename_ext(file_requested));
-                    }
-                    u_map_put(response->map_header, "Content-Type", content_type);
-                    u_map_copy_into(response->map_header, &configWeb.map_header);
-
-                    if (ulfius_set_stream_response(response, 200, callback_static_file_stream, callback_static_file_stream_free,
-                                                   length, STATIC_FILE_CHUNK, f) != U_OK) {
-                        LOG_DEBUG("callback_static_file - Error ulfius_set_stream_response");
-                    }
-                }
-            } else {
-                if (configWeb.redirect_on_404 == NULL) {
-                    ulfius_set_string_body_response(response, 404, "File not found");
-                } else {
-                    ulfius_add_header_to_response(response, "Location", configWeb.redirect_on_404);
-                    response->status = 302;
-                }
-            }
+        int fd = -1;
+        if (real_path != NULL && 0 == o_strncmp(configWeb.files_path, real_path, o_strlen(configWeb.files_path)))
+            fd = open(real_path, O_RDONLY | O_CLOEXEC);
+        if (fd >= 0) {
+            respond_with_file(request, response, fd, file_requested);
+            close(fd); // A mapping outlives its descriptor
         } else {
-            if (configWeb.redirect_on_404 == NULL) {
-                ulfius_set_string_body_response(response, 404, "File not found");
-            } else {
-                ulfius_add_header_to_response(response, "Location", configWeb.redirect_on_404);
-                response->status = 302;
-            }
+            respond_not_found(response);
         }
 
         o_free(file_path);
@@ -216,6 +265,84 @@ int callback_static_file(const struct _u_request *request, struct _u_response *r
     }
 }
 
+bool HttpAPI::queueToRadio(const uint8_t *buf, size_t len)
+{
+    {
+        std::lock_guard<std::mutex> guard(queueMutex);
+        if (toRadioQueue.size() >= HTTP_API_QUEUE_LEN)
+            return false;
+        toRadioQueue.emplace_back(buf, buf + len);
+    }
+    wake();
+    return true;
+}
+
+size_t HttpAPI::takeFromRadio(uint8_t *buf, bool wait)
+{
+    std::unique_lock<std::mutex> lock(queueMutex);
+    if (fromRadioQueue.empty() && wait) {
+        lock.unlock();
+        hasChecked = false;
+        for (int tries = 0; !hasChecked && tries < 100; tries++) {
+            wake();
+            usleep(20 * 1000);
+        }
+        lock.lock();
+    }
+    if (fromRadioQueue.empty())
+        return 0;
+
+    std::vector<uint8_t> &front = fromRadioQueue.front();
+    size_t len = front.size();
+    memcpy(buf, front.data(), len);
+    fromRadioQueue.pop_front();
+    lock.unlock();
+    wake(); // Refill while this one goes out
+    return len;
+}
+
+/// Have runOnce() run as soon as the main loop can, rather than at its next poll
+void HttpAPI::wake()
+{
+    setIntervalFromNow(0);
+    concurrency::mainDelay.interrupt();
+}
+
+void HttpAPI::onNowHasData(uint32_t fromRadioNum)
+{
+    PhoneAPI::onNowHasData(fromRadioNum);
+    setIntervalFromNow(0); // Fetch it before the web client asks
+}
+
+int32_t HttpAPI::runOnce()
+{
+    std::deque<std::vector<uint8_t>> toRadio;
+    {
+        std::lock_guard<std::mutex> guard(queueMutex);
+        toRadio.swap(toRadioQueue);
+    }
+    for (std::vector<uint8_t> &packet : toRadio)
+        handleToRadio(packet.data(), packet.size());
+
+    // Keep FromRadio packets ready, so web requests are answered without waiting for a pass of the main loop
+    uint8_t buf[MAX_TO_FROM_RADIO_SIZE];
+    while (true) {
+        {
+            std::lock_guard<std::mutex> guard(queueMutex);
+            if (fromRadioQueue.size() >= HTTP_API_QUEUE_LEN)
+                break;
+        }
+        size_t len = getFromRadio(buf);
+        if (!len)
+            break;
+        std::lock_guard<std::mutex> guard(queueMutex);
+        fromRadioQueue.emplace_back(buf, buf + len);
+    }
+    hasChecked = true;
+
+    return 100;
+}
+
 static void handleWebResponse() {}
 
 /*
@@ -238,21 +365,69 @@ int handleAPIv1ToRadio(const struct _u_request *req, struct _u_response *res, vo
         return U_CALLBACK_COMPLETE;
     }
 
-    byte buffer[MAX_TO_FROM_RADIO_SIZE];
     size_t s = req->binary_body_length;
-
-    memcpy(buffer, req->binary_body, MAX_TO_FROM_RADIO_SIZE);
-
-    // FIXME* Problem with portdunio loosing mountpoint maybe because of running in a real sep. thread
-
-    portduinoVFS->mountpoint(configWeb.rootPath);
+    if (s > MAX_TO_RADIO_BATCH_SIZE) {
+        ulfius_set_string_body_response(res, 413, "ToRadio too large");
+        return U_CALLBACK_COMPLETE;
+    }
 
     LOG_DEBUG("Received %d bytes from PUT request", s);
-    static_cast<HttpAPI *>(user_data)->handleToRadio(buffer, s);
+    if (!static_cast<HttpAPI *>(user_data)->queueToRadio((const uint8_t *)req->binary_body, s)) {
+        // The main loop hasn't caught up with earlier packets, the client can try again shortly
+        ulfius_add_header_to_response(res, "Retry-After", "1");
+        ulfius_set_string_body_response(res, 503, "Busy");
+    }
     LOG_DEBUG("end web->radio  ");
     return U_CALLBACK_COMPLETE;
 }
 
+/// One open fromradio?stream=true response, holding the frame that didn't fit in the last chunk
+struct FromRadioStream {
+    HttpAPI *api;
+    uint32_t started;
+    uint8_t frame[MAX_STREAM_BUF_SIZE];
+    size_t len = 0, sent = 0;
+};
+
+/**
+ * Streaming callback for fromradio: waits for packets and sends every one available as StreamAPI frames, so a burst goes
+ * out in one chunk.  Each connection runs in its own ulfius thread, so waiting here doesn't hold up anything else.
+ */
+static ssize_t callback_fromradio_stream(void *cls, uint64_t pos, char *buf, size_t max)
+{
+    (void)(pos);
+    FromRadioStream *s = (FromRadioStream *)cls;
+    size_t used = 0;
+    while (used < max) {
+        if (s->sent == s->len) {
+            size_t len = s->api->takeFromRadio(s->frame + STREAM_HEADER_LEN, false);
+            if (len) {
+                s->len = StreamAPI::frame(s->frame, len);
+                s->sent = 0;
+            } else if (used) {
+                break; // Send what we have rather than wait for more
+            } else if (!Throttle::isWithinTimespanMs(s->started, FROMRADIO_STREAM_MSEC)) {
+                return U_STREAM_END;
+            } else {
+                usleep(FROMRADIO_STREAM_POLL_MSEC * 1000);
+                continue;
+            }
+        }
+        size_t n = s->len - s->sent;
+        if (n > max - used)
+            n = max - used;
+        memcpy(buf + used, s->frame + s->sent, n);
+        s->sent += n;
+        used += n;
+    }
+    return used;
+}
+
+static void callback_fromradio_stream_free(void *cls)
+{
+    delete (FromRadioStream *)cls;
+}
+
 /*
  * Adapt the radioapi to the Webservice handleAPIv1FromRadio
  * Trigger : WebGui(POLL)->handleAPIv1FromRadio->phoneapi->Meshtastic(Radio) events
@@ -275,12 +450,29 @@ int handleAPIv1FromRadio(const struct _u_request *req, struct _u_response *res,
         return U_CALLBACK_COMPLETE;
     }
 
+    // With stream=true keep the response open and push StreamAPI frames as packets arrive, instead of the client polling
+    // for one packet per request.  It ends after FROMRADIO_STREAM_MSEC so proxies and clients see it finish.
+    const char *valueStream = u_map_get(req->map_url, "stream");
+    if (valueStream && strcmp(valueStream, "true") == 0) {
+        FromRadioStream *s = new FromRadioStream();
+        s->api = static_cast<HttpAPI *>(user_data);
+        s->started = millis();
+        ulfius_add_header_to_response(res, "Content-Type", "application/octet-stream");
+        ulfius_add_header_to_response(res, "Cache-Control", "no-cache");
+        if (ulfius_set_stream_response(res, 200, callback_fromradio_stream, callback_fromradio_stream_free,
+                                       U_STREAM_SIZE_UNKNOWN, MAX_STREAM_BUF_SIZE, s) != U_OK) {
+            LOG_DEBUG("handleAPIv1FromRadio - Error ulfius_set_stream_response");
+            delete s;
+        }
+        return U_CALLBACK_COMPLETE;
+    }
+
     uint8_t txBuf[MAX_STREAM_BUF_SIZE];
     uint32_t len = 1;
 
     if (valueAll == "true") {
         while (len) {
-            len = static_cast<HttpAPI *>(user_data)->getFromRadio(txBuf);
+            len = static_cast<HttpAPI *>(user_data)->takeFromRadio(txBuf, true);
             ulfius_set_response_properties(res, U_OPT_STATUS, 200, U_OPT_BINARY_BODY, txBuf, len);
             const char *tmpa = (const char *)txBuf;
             ulfius_set_string_body_response(res, 200, tmpa);
@@ -290,7 +482,7 @@ int handleAPIv1FromRadio(const struct _u_request *req, struct _u_response *res,
         }
         // Otherwise, just return one protobuf
     } else {
-        len = static_cast<HttpAPI *>(user_data)->getFromRadio(txBuf);
+        len = static_cast<HttpAPI *>(user_data)->takeFromRadio(txBuf, true);
         const char *tmpa = (const char *)txBuf;
         ulfius_set_binary_body_response(res, 200, tmpa, len);
         // LOG_DEBUG("\n----webAPI response:");
@@ -302,6 +494,35 @@ int handleAPIv1FromRadio(const struct _u_request *req, struct _u_response *res,
     return U_CALLBACK_COMPLETE;
 }
 
+/*
+ * Code region timings and hardware counters, in the text format Prometheus scrapes
+ */
+int handleMetrics(const struct _u_request *req, struct _u_response *res, void *user_data)
+{
+    if (!perfCountersEnabled()) {
+        ulfius_set_string_body_response(res, 404, "Perf counters are off, enable them with Logging: PerfCounters: true\n");
+        return U_CALLBACK_COMPLETE;
+    }
+    ulfius_add_header_to_response(res, "Content-Type", "text/plain; version=0.0.4");
+    ulfius_add_header_to_response(res, "Cache-Control", "no-cache");
+    ulfius_set_string_body_response(res, 200, perfCountersPrometheus().c_str());
+    return U_CALLBACK_COMPLETE;
+}
+
+/*
+ * The last LoRa frames sent and received, for Wireshark
+ */
+int handleCapture(const struct _u_request *req, struct _u_response *res, void *user_data)
+{
+    std::vector<uint8_t> pcapng;
+    frameCapture.writePcapng(pcapng);
+    ulfius_add_header_to_response(res, "Content-Type", "application/x-pcapng");
+    ulfius_add_header_to_response(res, "Content-Disposition", "attachment; filename=\"meshtastic.pcapng\"");
+    ulfius_add_header_to_response(res, "Cache-Control", "no-cache");
+    ulfius_set_binary_body_response(res, 200, (const char *)pcapng.data(), pcapng.size());
+    return U_CALLBACK_COMPLETE;
+}
+
 /*
 OpenSSL RSA Key Gen
 */
@@ -494,7 +715,6 @@ PiWebServerThread::PiWebServerThread()
 
         configWeb.files_path = (char *)webrootpath.c_str();
         configWeb.url_prefix = "";
-        configWeb.rootPath = strdup(portduinoVFS->mountpoint());
 
         u_map_put(instanceWeb.default_headers, "Access-Control-Allow-Origin", "*");
         // Maximum body size sent by the client is 1 Kb
@@ -503,6 +723,8 @@ PiWebServerThread::PiWebServerThread()
         ulfius_add_endpoint_by_val(&instanceWeb, "OPTIONS", PREFIX, "/api/v1/fromradio/*", 1, &handleAPIv1FromRadio, &webAPI);
         ulfius_add_endpoint_by_val(&instanceWeb, "PUT", PREFIX, "/api/v1/toradio/*", 1, &handleAPIv1ToRadio, &webAPI);
         ulfius_add_endpoint_by_val(&instanceWeb, "OPTIONS", PREFIX, "/api/v1/toradio/*", 1, &handleAPIv1ToRadio, &webAPI);
+        ulfius_add_endpoint_by_val(&instanceWeb, "GET", PREFIX, "/metrics", 1, &handleMetrics, NULL);
+        ulfius_add_endpoint_by_val(&instanceWeb, "GET", PREFIX, "/capture.pcapng", 1, &handleCapture, NULL);
 
         // Add callback function to all endpoints for the Web Server
         ulfius_add_endpoint_by_val(&instanceWeb, "GET", NULL, "/*", 2, &callback_static_file, &configWeb);
@@ -528,7 +750,6 @@ PiWebServerThread::~PiWebServerThread()
 
     ulfius_stop_framework(&instanceWeb);
     ulfius_clean_instance(&instanceWeb);
-    free(configWeb.rootPath);
     free(key_pem);
     free(cert_pem);
     LOG_INFO("End framework");
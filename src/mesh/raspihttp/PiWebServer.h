@@ -2,12 +2,26 @@
 #ifdef PORTDUINO_LINUX_HARDWARE
 #if __has_include(<ulfius.h>)
 #include "PhoneAPI.h"
+#include "concurrency/OSThread.h"
 #include "ulfius-cfg.h"
 #include "ulfius.h"
 #include <Arduino.h>
+#include <atomic>
+#include <deque>
 #include <functional>
+#include <mutex>
+#include <vector>
 
-#define STATIC_FILE_CHUNK 256
+#define STATIC_FILE_CHUNK 16384 // One TLS record
+#ifndef HTTP_API_QUEUE_LEN
+#define HTTP_API_QUEUE_LEN 8 // ToRadio / FromRadio packets waiting to cross between the web threads and the main loop
+#endif
+#ifndef FROMRADIO_STREAM_MSEC
+#define FROMRADIO_STREAM_MSEC (25 * 1000) // How long a fromradio?stream=true response stays open before the client reconnects
+#endif
+#ifndef FROMRADIO_STREAM_POLL_MSEC
+#define FROMRADIO_STREAM_POLL_MSEC 20 // How often an open stream checks for new FromRadio packets
+#endif
 
 void initWebServer();
 void createSSLCert();
@@ -20,19 +34,38 @@ struct _file_config {
     struct _u_map mime_types;
     struct _u_map map_header;
     char *redirect_on_404;
-    char *rootPath;
 };
 
-class HttpAPI : public PhoneAPI
+/**
+ * The PhoneAPI for web clients.  Requests are served from ulfius' own threads, but PhoneAPI (and everything it calls) only
+ * runs on the main loop: ToRadio packets are queued for runOnce to handle, and runOnce keeps a queue of FromRadio packets
+ * ready for the web threads to take.
+ */
+class HttpAPI : public PhoneAPI, public concurrency::OSThread
 {
 
   public:
-    // Nothing here yet
+    HttpAPI() : concurrency::OSThread("HttpAPI") {}
+
+    /// From a web thread: hand a ToRadio packet to the main loop. False if too many are already waiting
+    bool queueToRadio(const uint8_t *buf, size_t len);
+
+    /// From a web thread: take the next FromRadio packet, 0 if there is none.  With wait, if none is ready yet, let the
+    /// main loop have one pass to find one
+    size_t takeFromRadio(uint8_t *buf, bool wait);
 
   private:
-    // Nothing here yet
+    std::mutex queueMutex;
+    std::deque<std::vector<uint8_t>> toRadioQueue;
+    std::deque<std::vector<uint8_t>> fromRadioQueue;
+    std::atomic<bool> hasChecked{false}; // runOnce has looked for FromRadio packets since a web thread asked
+
+    void wake();
 
   protected:
+    virtual int32_t runOnce() override;
+    virtual void onNowHasData(uint32_t fromRadioNum) override;
+
     /// Check the current underlying physical link to see if the client is currently connected
     virtual bool checkIsConnected() override { return true; } // FIXME, be smarter about this
 };
@@ -11,6 +11,7 @@
 #endif
 
 #include <AsyncUDP.h>
+#include <pb_decode.h>
 
 #if HAS_ETHERNET && defined(USE_WS5500)
 #include <ETHClass2.h>
@@ -18,6 +19,9 @@
 #endif // HAS_ETHERNET
 
 #define UDP_MULTICAST_DEFAUL_PORT 4403 // Default port for UDP multicast is same as TCP api server
+#ifndef UDP_MULTICAST_DEDUP_SIZE
+#define UDP_MULTICAST_DEDUP_SIZE 16 // Recent packets remembered so copies from other bridges never take a pool slot
+#endif
 
 class UdpMulticastHandler final
 {
@@ -49,18 +53,31 @@ class UdpMulticastHandler final
         // FIXME(PORTDUINO): arduino lacks IPAddress::toString()
         LOG_DEBUG("UDP broadcast from: %s, len=%u", packet.remoteIP().toString().c_str(), packetLength);
 #endif
-        meshtastic_MeshPacket mp;
-        mp.transport_mechanism = meshtastic_MeshPacket_TransportMechanism_TRANSPORT_MULTICAST_UDP;
+        // Every bridge on the LAN repeats what it hears, so most datagrams are copies of one we already took.  Drop those on
+        // the two header fields before they cost a pool slot and a full decode.
+        uint32_t from, id;
+        if (!peekFromAndId(packet.data(), packetLength, from, id) || wasSeen(from, id))
+            return;
+        if (!router)
+            return;
+
+        // Decode straight into the pool rather than copying out of a stack packet
+        UniquePacketPoolPacket p = packetPool.allocUniqueZeroed();
+        if (!p) {
+            LOG_WARN("Packet pool empty, drop UDP packet (id=%u)", id);
+            return;
+        }
         LOG_DEBUG("Decoding MeshPacket from UDP len=%u", packetLength);
-        bool isPacketDecoded = pb_decode_from_bytes(packet.data(), packetLength, &meshtastic_MeshPacket_msg, &mp);
-        if (isPacketDecoded && router && mp.which_payload_variant == meshtastic_MeshPacket_encrypted_tag) {
-            mp.pki_encrypted = false;
-            mp.public_key.size = 0;
-            memset(mp.public_key.bytes, 0, sizeof(mp.public_key.bytes));
-            UniquePacketPoolPacket p = packetPool.allocUniqueCopy(mp);
+        if (pb_decode_from_bytes(packet.data(), packetLength, &meshtastic_MeshPacket_msg, p.get()) &&
+            p->which_payload_variant == meshtastic_MeshPacket_encrypted_tag) {
+            p->transport_mechanism = meshtastic_MeshPacket_TransportMechanism_TRANSPORT_MULTICAST_UDP;
+            p->pki_encrypted = false;
+            p->public_key.size = 0;
+            memset(p->public_key.bytes, 0, sizeof(p->public_key.bytes));
             // Unset received SNR/RSSI
             p->rx_snr = 0;
             p->rx_rssi = 0;
+            remember(from, id);
             router->enqueueReceivedMessage(p.release());
         }
     }
@@ -92,5 +109,45 @@ class UdpMulticastHandler final
   private:
     IPAddress udpIpAddress;
     AsyncUDP udp;
+
+    struct SeenPacket {
+        uint32_t from, id;
+    };
+    SeenPacket seen[UDP_MULTICAST_DEDUP_SIZE] = {};
+    uint8_t seenNext = 0;
+
+    /// Read just the sender and id of an encoded MeshPacket, skipping over the rest of it
+    static bool peekFromAndId(const uint8_t *buf, size_t len, uint32_t &from, uint32_t &id)
+    {
+        pb_istream_t stream = pb_istream_from_buffer(buf, len);
+        pb_wire_type_t wireType;
+        uint32_t tag;
+        bool eof = false;
+        from = id = 0;
+        while (pb_decode_tag(&stream, &wireType, &tag, &eof)) {
+            if ((tag == meshtastic_MeshPacket_from_tag || tag == meshtastic_MeshPacket_id_tag) && wireType == PB_WT_32BIT) {
+                if (!pb_decode_fixed32(&stream, tag == meshtastic_MeshPacket_from_tag ? &from : &id))
+                    return false;
+            } else if (!pb_skip_field(&stream, wireType)) {
+                return false;
+            }
+        }
+        return eof && id != 0;
+    }
+
+    /// Have we handed this packet to the router from UDP recently?  Only used from the UDP receive callback.
+    bool wasSeen(uint32_t from, uint32_t id) const
+    {
+        for (size_t i = 0; i < UDP_MULTICAST_DEDUP_SIZE; i++)
+            if (seen[i].id == id && seen[i].from == from)
+                return true;
+        return false;
+    }
+
+    void remember(uint32_t from, uint32_t id)
+    {
+        seen[seenNext] = {from, id};
+        seenNext = (seenNext + 1) % UDP_MULTICAST_DEDUP_SIZE;
+    }
 };
 #endif // HAS_UDP_MULTICAST
\ No newline at end of file
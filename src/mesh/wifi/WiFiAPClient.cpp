@@ -21,6 +21,7 @@
 #include "mesh/http/WebServer.h"
 #endif
 #include <ESPmDNS.h>
+#include <ErriezCRC32.h>
 #include <esp_wifi.h>
 static void WiFiEvent(WiFiEvent_t event);
 #elif defined(ARCH_RP2040)
@@ -62,6 +63,111 @@ Syslog syslog(syslogClient);
 
 Periodic *wifiReconnect;
 
+#ifdef ARCH_ESP32
+// How long after DHCP gave us an address a fast reconnect configures it directly instead of asking again.  The Arduino API
+// doesn't tell us the real lease time, so this stays well short of any lease a DHCP server hands out.
+#ifndef WIFI_FAST_CONNECT_LEASE_SECS
+#define WIFI_FAST_CONNECT_LEASE_SECS (30 * 60)
+#endif
+
+// How long a fast reconnect gets before we forget the cached access point and scan for it the normal way
+#ifndef WIFI_FAST_CONNECT_TIMEOUT_MSEC
+#define WIFI_FAST_CONNECT_TIMEOUT_MSEC 3000
+#endif
+
+#define WIFI_FAST_CONNECT_MAGIC 0x3fa57c01
+
+/// The access point and address of the last good connection, in RTC memory so they survive deep sleep and soft resets
+struct WiFiFastConnect {
+    uint32_t magic;
+    uint32_t network; // Which SSID and PSK this was for, see fastConnectNetwork()
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint32_t ip, gateway, subnet, dns;
+    uint32_t leaseFrom, leaseUntil; // getTime() span we may reuse ip in, both 0 if it wasn't from DHCP
+    uint32_t crc;
+};
+static RTC_NOINIT_ATTR WiFiFastConnect fastConnect;
+
+static bool fastConnecting = false;    // Joined the cached access point directly, reconnectWiFi() checks if that worked
+static bool usingCachedLease = false; // Configured the cached DHCP address ourselves, DHCP is off until they part
+
+static uint32_t fastConnectNetwork()
+{
+    return crc32Buffer(config.network.wifi_ssid, strlen(config.network.wifi_ssid)) ^
+           (crc32Buffer(config.network.wifi_psk, strlen(config.network.wifi_psk)) * 31);
+}
+
+static bool fastConnectValid()
+{
+    return fastConnect.magic == WIFI_FAST_CONNECT_MAGIC && fastConnect.network == fastConnectNetwork() &&
+           fastConnect.crc == crc32Buffer(&fastConnect, offsetof(WiFiFastConnect, crc));
+}
+
+static bool cachedLeaseValid()
+{
+    uint32_t now = getTime();
+    return fastConnect.leaseUntil && now >= fastConnect.leaseFrom && now < fastConnect.leaseUntil;
+}
+
+static void forgetFastConnect()
+{
+    fastConnect.magic = 0;
+}
+
+/// Go back to asking DHCP for our address, once the one we configured ourselves may no longer be ours
+static void stopUsingCachedLease()
+{
+    if (!usingCachedLease)
+        return;
+    usingCachedLease = false;
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+}
+
+/// Note down the access point and address we just got, for the next fast reconnect
+static void rememberConnection()
+{
+    bool keepLease = usingCachedLease && fastConnectValid();
+    uint32_t leaseFrom = keepLease ? fastConnect.leaseFrom : 0, leaseUntil = keepLease ? fastConnect.leaseUntil : 0;
+    if (!keepLease && config.network.address_mode != meshtastic_Config_NetworkConfig_AddressMode_STATIC) {
+        leaseFrom = getTime();
+        leaseUntil = leaseFrom + WIFI_FAST_CONNECT_LEASE_SECS;
+    }
+
+    fastConnect.magic = WIFI_FAST_CONNECT_MAGIC;
+    fastConnect.network = fastConnectNetwork();
+    memcpy(fastConnect.bssid, WiFi.BSSID(), sizeof(fastConnect.bssid));
+    fastConnect.channel = WiFi.channel();
+    fastConnect.ip = WiFi.localIP();
+    fastConnect.gateway = WiFi.gatewayIP();
+    fastConnect.subnet = WiFi.subnetMask();
+    fastConnect.dns = WiFi.dnsIP();
+    fastConnect.leaseFrom = leaseFrom;
+    fastConnect.leaseUntil = leaseUntil;
+    fastConnect.crc = crc32Buffer(&fastConnect, offsetof(WiFiFastConnect, crc));
+}
+
+/// Join the access point of our last connection directly, without scanning, and reuse its DHCP address while we may
+/// @return false if there is nothing cached to try
+static bool beginFastConnect(const char *wifiName, const char *wifiPsw)
+{
+    if (!fastConnectValid())
+        return false;
+
+    if (config.network.address_mode != meshtastic_Config_NetworkConfig_AddressMode_STATIC && cachedLeaseValid()) {
+        WiFi.config(fastConnect.ip, fastConnect.gateway, fastConnect.subnet, fastConnect.dns);
+        usingCachedLease = true;
+    } else {
+        stopUsingCachedLease();
+    }
+    LOG_INFO("Fast reconnect to WiFi access point %s on channel %u%s", wifiName, fastConnect.channel,
+             usingCachedLease ? " with our last address" : "");
+    WiFi.begin(wifiName, wifiPsw, fastConnect.channel, fastConnect.bssid);
+    fastConnecting = true;
+    return true;
+}
+#endif
+
 #ifdef USE_WS5500
 // Startup Ethernet
 bool initEthernet()
@@ -165,6 +271,9 @@ static int32_t reconnectWiFi()
         // Make sure we clear old connection credentials
 #ifdef ARCH_ESP32
         WiFi.disconnect(false, true);
+        if (beginFastConnect(wifiName, wifiPsw))
+            return WIFI_FAST_CONNECT_TIMEOUT_MSEC;
+        stopUsingCachedLease();
 #elif defined(ARCH_RP2040)
         WiFi.disconnect(false);
 #endif
@@ -177,6 +286,19 @@ static int32_t reconnectWiFi()
         return 5000; // Schedule next check soon
     }
 
+#ifdef ARCH_ESP32
+    if (fastConnecting) {
+        fastConnecting = false;
+        isReconnecting = false;
+        if (!WiFi.isConnected()) {
+            LOG_INFO("Fast reconnect failed, scan for the access point instead");
+            forgetFastConnect();
+            needReconnect = true;
+            return 100;
+        }
+    }
+#endif
+
     // Check if we are ready to proceed with the WiFi connection after the 5s wait
     if (wifiReconnectPending) {
         if (millis() - wifiReconnectStartMillis >= 5000) {
@@ -222,6 +344,16 @@ static int32_t reconnectWiFi()
     } else {
 #ifdef ARCH_RP2040
         onNetworkConnected(); // will only do anything once
+#endif
+#ifdef ARCH_ESP32
+        if (usingCachedLease) {
+            if (!cachedLeaseValid()) {
+                LOG_INFO("Stop reusing our last DHCP address, ask for a lease again");
+                stopUsingCachedLease();
+            } else if (fastConnect.leaseUntil - getTime() < 300) {
+                return (fastConnect.leaseUntil - getTime()) * 1000 + 1000;
+            }
+        }
 #endif
         return 300000; // every 5 minutes
     }
@@ -374,6 +506,7 @@ static void WiFiEvent(WiFiEvent_t event)
         break;
     case ARDUINO_EVENT_WIFI_STA_GOT_IP:
         LOG_INFO("Obtained IP address: %s", WiFi.localIP().toString().c_str());
+        rememberConnection();
         onNetworkConnected();
         break;
     case ARDUINO_EVENT_WIFI_STA_GOT_IP6:
@@ -295,6 +295,8 @@ bool AdminModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshta
         disableBluetooth();
         LOG_INFO("Commit transaction for edited settings");
         hasOpenEditTransaction = false;
+        pendingSaveWhat = 0;
+        pendingReboot = false;
         saveChanges(SEGMENT_CONFIG | SEGMENT_MODULECONFIG | SEGMENT_DEVICESTATE | SEGMENT_CHANNELS | SEGMENT_NODEDATABASE);
         break;
     }
@@ -325,8 +327,7 @@ bool AdminModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshta
         LOG_INFO("Client received set_favorite_node command");
         meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(r->set_favorite_node);
         if (node != NULL) {
-            node->is_favorite = true;
-            saveChanges(SEGMENT_NODEDATABASE, false);
+            nodeDB->set_favorite(true, node->num);
             if (screen)
                 screen->setFrames(graphics::Screen::FOCUS_PRESERVE); // <-- Rebuild screens
         }
@@ -336,8 +337,7 @@ bool AdminModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshta
         LOG_INFO("Client received remove_favorite_node command");
         meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(r->remove_favorite_node);
         if (node != NULL) {
-            node->is_favorite = false;
-            saveChanges(SEGMENT_NODEDATABASE, false);
+            nodeDB->set_favorite(false, node->num);
             if (screen)
                 screen->setFrames(graphics::Screen::FOCUS_PRESERVE); // <-- Rebuild screens
         }
@@ -352,7 +352,8 @@ bool AdminModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshta
             node->has_position = false;
             node->user.public_key.size = 0;
             node->user.public_key.bytes[0] = 0;
-            saveChanges(SEGMENT_NODEDATABASE, false);
+            nodeDB->markNodeChanged(node->num);
+            nodeDB->saveNodeToDisk(*node);
         }
         break;
     }
@@ -361,7 +362,8 @@ bool AdminModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshta
         meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(r->remove_ignored_node);
         if (node != NULL) {
             node->is_ignored = false;
-            saveChanges(SEGMENT_NODEDATABASE, false);
+            nodeDB->markNodeChanged(node->num);
+            nodeDB->saveNodeToDisk(*node);
         }
         break;
     }
@@ -410,6 +412,7 @@ bool AdminModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshta
 #ifdef FSCom
         spiLock->lock();
         if (FSCom.remove(r->delete_file_request)) {
+            fileManifestChanged();
             LOG_DEBUG("Successfully deleted file");
         } else {
             LOG_DEBUG("Failed to delete file");
@@ -446,6 +449,7 @@ bool AdminModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshta
         if (r->remove_backup_preferences == meshtastic_AdminMessage_BackupLocation_FLASH) {
             spiLock->lock();
             FSCom.remove(backupFileName);
+            fileManifestChanged();
             spiLock->unlock();
         } else if (r->remove_backup_preferences == meshtastic_AdminMessage_BackupLocation_SD) {
             // TODO: After more mainline SD card support
@@ -511,6 +515,197 @@ bool AdminModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshta
     return handled;
 }
 
+ProcessMessage AdminModule::handleReceived(const meshtastic_MeshPacket &mp)
+{
+    if (mp.which_payload_variant == meshtastic_MeshPacket_decoded_tag && mp.decoded.portnum == meshtastic_PortNum_ADMIN_APP &&
+        mp.decoded.payload.size > 0 && mp.decoded.payload.bytes[0] == ADMIN_BULK_MARKER) {
+        handleBulk(mp);
+        return ProcessMessage::STOP;
+    }
+    return ProtobufModule::handleReceived(mp);
+}
+
+// The settings a bulk payload may change, kept to put them back if any message in it is refused
+struct AdminSnapshot {
+    meshtastic_LocalConfig config;
+    meshtastic_LocalModuleConfig moduleConfig;
+    meshtastic_ChannelFile channelFile;
+    meshtastic_User owner;
+};
+
+static const uint8_t *readBulkLength(const uint8_t *p, const uint8_t *end, uint32_t *len)
+{
+    *len = 0;
+    for (int shift = 0; p < end && shift < 32; shift += 7) {
+        uint8_t b = *p++;
+        *len |= (uint32_t)(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            return p;
+    }
+    return NULL;
+}
+
+static bool isErrorReply(const meshtastic_MeshPacket *p)
+{
+    if (p->decoded.portnum != meshtastic_PortNum_ROUTING_APP)
+        return false;
+    meshtastic_Routing routing = meshtastic_Routing_init_zero;
+    return pb_decode_from_bytes(p->decoded.payload.bytes, p->decoded.payload.size, &meshtastic_Routing_msg, &routing) &&
+           routing.which_variant == meshtastic_Routing_error_reason_tag && routing.error_reason != meshtastic_Routing_Error_NONE;
+}
+
+/**
+ * @brief Gets, and the setters that only change settings we can put back
+ */
+bool AdminModule::isBulkable(const meshtastic_AdminMessage *r)
+{
+    switch (r->which_payload_variant) {
+    case meshtastic_AdminMessage_set_owner_tag:
+    case meshtastic_AdminMessage_set_config_tag:
+    case meshtastic_AdminMessage_set_module_config_tag:
+    case meshtastic_AdminMessage_set_channel_tag:
+    case meshtastic_AdminMessage_set_ham_mode_tag:
+        return true;
+    default:
+        return messageIsRequest(r);
+    }
+}
+
+/**
+ * @brief Add the payload of a get response to the bulk response, sending that on first if it has no room left
+ */
+void AdminModule::addBulkResponse(const meshtastic_MeshPacket &req, meshtastic_MeshPacket **response,
+                                  const meshtastic_MeshPacket *reply)
+{
+    const size_t capacity = sizeof(reply->decoded.payload.bytes);
+    const auto &add = reply->decoded.payload;
+    size_t entrySize = (add.size < 0x80 ? 1 : 2) + add.size;
+
+    if (*response && (*response)->decoded.payload.size + entrySize > capacity) {
+        setReplyTo(*response, req);
+        (*response)->pki_encrypted = req.pki_encrypted;
+        service->sendToMesh(*response);
+        *response = NULL;
+    }
+    if (1 + entrySize > capacity) {
+        // Too big to share a payload, it goes on its own as it would have without bulk
+        meshtastic_MeshPacket *alone = packetPool.allocCopy(*reply);
+        setReplyTo(alone, req);
+        alone->pki_encrypted = req.pki_encrypted;
+        service->sendToMesh(alone);
+        return;
+    }
+    if (!*response) {
+        *response = allocDataPacket();
+        (*response)->decoded.payload.bytes[0] = ADMIN_BULK_MARKER;
+        (*response)->decoded.payload.size = 1;
+    }
+    auto &out = (*response)->decoded.payload;
+    if (add.size < 0x80) {
+        out.bytes[out.size++] = add.size;
+    } else {
+        out.bytes[out.size++] = (add.size & 0x7f) | 0x80;
+        out.bytes[out.size++] = add.size >> 7;
+    }
+    memcpy(out.bytes + out.size, add.bytes, add.size);
+    out.size += add.size;
+}
+
+/**
+ * @brief Handle a bulk payload, see ADMIN_BULK_MARKER. Its setters are applied all or none, as one transaction that is
+ *     saved once at the end, and its gets are answered in bulk payloads laid out the same way. A session key only needs to
+ *     be in the first message.
+ */
+void AdminModule::handleBulk(const meshtastic_MeshPacket &mp)
+{
+    meshtastic_AdminMessage *r = new (std::nothrow) meshtastic_AdminMessage;
+    AdminSnapshot *before = new (std::nothrow) AdminSnapshot{config, moduleConfig, channelFile, owner};
+    if (!r || !before) {
+        LOG_ERROR("No memory for a bulk admin payload");
+        delete r;
+        delete before;
+        myReply = allocErrorResponse(meshtastic_Routing_Error_TOO_LARGE, &mp);
+        return;
+    }
+
+    bool wasOpen = hasOpenEditTransaction;
+    int saveWhatBefore = pendingSaveWhat;
+    bool rebootBefore = pendingReboot;
+    hasOpenEditTransaction = true;
+
+    const uint8_t *p = mp.decoded.payload.bytes + 1, *end = mp.decoded.payload.bytes + mp.decoded.payload.size;
+    meshtastic_AdminMessage_session_passkey_t passkey = {0, {0}};
+    meshtastic_MeshPacket *response = NULL, *failure = NULL;
+    unsigned count = 0;
+    while (p < end) {
+        uint32_t len;
+        p = readBulkLength(p, end, &len);
+        memset(r, 0, sizeof(*r));
+        if (!p || len > (uint32_t)(end - p) || !pb_decode_from_bytes(p, len, &meshtastic_AdminMessage_msg, r) ||
+            !isBulkable(r)) {
+            LOG_WARN("Refuse bulk admin payload, message %u is malformed or can't be undone", count);
+            failure = allocErrorResponse(meshtastic_Routing_Error_BAD_REQUEST, &mp);
+            break;
+        }
+        p += len;
+        if (count++ == 0)
+            passkey = r->session_passkey;
+        else if (r->session_passkey.size == 0)
+            r->session_passkey = passkey;
+
+        handleReceivedProtobuf(mp, r);
+        meshtastic_MeshPacket *reply = myReply;
+        myReply = NULL;
+        if (reply && isErrorReply(reply)) {
+            LOG_WARN("Refuse bulk admin payload, message %u failed", count - 1);
+            failure = reply;
+            break;
+        }
+        if (reply) {
+            if (reply->decoded.portnum == meshtastic_PortNum_ADMIN_APP)
+                addBulkResponse(mp, &response, reply);
+            packetPool.release(reply);
+        }
+    }
+    if (!failure && count == 0)
+        failure = allocErrorResponse(meshtastic_Routing_Error_BAD_REQUEST, &mp);
+
+    if (failure) {
+        config = before->config;
+        moduleConfig = before->moduleConfig;
+        channelFile = before->channelFile;
+        owner = before->owner;
+        channels.onConfigChanged();
+        pendingSaveWhat = saveWhatBefore;
+        pendingReboot = rebootBefore;
+        hasOpenEditTransaction = wasOpen;
+        if (response)
+            packetPool.release(response);
+        myReply = failure;
+    } else {
+        hasOpenEditTransaction = wasOpen;
+        if (!wasOpen && pendingSaveWhat) {
+            LOG_INFO("Commit bulk admin payload of %u messages", count);
+            int saveWhat = pendingSaveWhat;
+            bool shouldReboot = pendingReboot;
+            pendingSaveWhat = 0;
+            pendingReboot = false;
+            if (shouldReboot)
+                disableBluetooth();
+            saveChanges(saveWhat, shouldReboot);
+        }
+        if (response)
+            myReply = response;
+        else if (mp.decoded.want_response)
+            myReply = allocErrorResponse(meshtastic_Routing_Error_NONE, &mp);
+    }
+    if (mp.pki_encrypted && myReply)
+        myReply->pki_encrypted = true;
+
+    delete r;
+    delete before;
+}
+
 void AdminModule::handleGetModuleConfigResponse(const meshtastic_MeshPacket &mp, meshtastic_AdminMessage *r)
 {
     // Skip if it's disabled or no pins are exposed
@@ -706,17 +901,12 @@ void AdminModule::handleSetConfig(const meshtastic_Config &c)
     case meshtastic_Config_lora_tag:
         LOG_INFO("Set config: LoRa");
         config.has_lora = true;
-        // If no lora radio parameters change, don't need to reboot
-        if (config.lora.use_preset == c.payload_variant.lora.use_preset && config.lora.region == c.payload_variant.lora.region &&
-            config.lora.modem_preset == c.payload_variant.lora.modem_preset &&
-            config.lora.bandwidth == c.payload_variant.lora.bandwidth &&
-            config.lora.spread_factor == c.payload_variant.lora.spread_factor &&
-            config.lora.coding_rate == c.payload_variant.lora.coding_rate &&
-            config.lora.tx_power == c.payload_variant.lora.tx_power &&
-            config.lora.frequency_offset == c.payload_variant.lora.frequency_offset &&
-            config.lora.override_frequency == c.payload_variant.lora.override_frequency &&
-            config.lora.channel_num == c.payload_variant.lora.channel_num &&
-            config.lora.sx126x_rx_boosted_gain == c.payload_variant.lora.sx126x_rx_boosted_gain) {
+        // The radio retunes in place when configChanged fires, see RadioInterface::reloadConfig, so only what the chip takes
+        // at init needs a reboot: the RX gain mode, and moving between the sub-GHz and 2.4GHz bands, which main() checks the
+        // chip can do
+        if (config.lora.sx126x_rx_boosted_gain == c.payload_variant.lora.sx126x_rx_boosted_gain &&
+            (config.lora.region == meshtastic_Config_LoRaConfig_RegionCode_LORA_24) ==
+                (c.payload_variant.lora.region == meshtastic_Config_LoRaConfig_RegionCode_LORA_24)) {
             requiresReboot = false;
         }
 
@@ -819,12 +1009,8 @@ void AdminModule::handleSetConfig(const meshtastic_Config &c)
 
 bool AdminModule::handleSetModuleConfig(const meshtastic_ModuleConfig &c)
 {
-    // If we are in an open transaction or configuring MQTT or Serial (which have validation), defer disabling Bluetooth
-    // Otherwise, disable Bluetooth to prevent the phone from interfering with the config
-    if (!hasOpenEditTransaction &&
-        !IS_ONE_OF(c.which_payload_variant, meshtastic_ModuleConfig_mqtt_tag, meshtastic_ModuleConfig_serial_tag)) {
-        disableBluetooth();
-    }
+    // Modules read most of their config at boot, those that don't say so below
+    bool requiresReboot = true;
 
     switch (c.which_payload_variant) {
     case meshtastic_ModuleConfig_mqtt_tag:
@@ -873,7 +1059,19 @@ bool AdminModule::handleSetModuleConfig(const meshtastic_ModuleConfig &c)
     case meshtastic_ModuleConfig_telemetry_tag:
         LOG_INFO("Set module config: Telemetry");
         moduleConfig.has_telemetry = true;
+        // The telemetry modules read their intervals each time round, only turning one on or off needs a reboot
+        if (moduleConfig.telemetry.environment_measurement_enabled ==
+                c.payload_variant.telemetry.environment_measurement_enabled &&
+            moduleConfig.telemetry.environment_screen_enabled == c.payload_variant.telemetry.environment_screen_enabled &&
+            moduleConfig.telemetry.air_quality_enabled == c.payload_variant.telemetry.air_quality_enabled &&
+            moduleConfig.telemetry.power_measurement_enabled == c.payload_variant.telemetry.power_measurement_enabled &&
+            moduleConfig.telemetry.power_screen_enabled == c.payload_variant.telemetry.power_screen_enabled &&
+            moduleConfig.telemetry.health_measurement_enabled == c.payload_variant.telemetry.health_measurement_enabled &&
+            moduleConfig.telemetry.health_screen_enabled == c.payload_variant.telemetry.health_screen_enabled) {
+            requiresReboot = false;
+        }
         moduleConfig.telemetry = c.payload_variant.telemetry;
+        nodeDB->coerceTelemetryIntervals();
         break;
     case meshtastic_ModuleConfig_canned_message_tag:
         LOG_INFO("Set module config: Canned Message");
@@ -898,6 +1096,7 @@ bool AdminModule::handleSetModuleConfig(const meshtastic_ModuleConfig &c)
             moduleConfig.neighbor_info.update_interval = default_neighbor_info_broadcast_secs;
         }
         moduleConfig.neighbor_info = c.payload_variant.neighbor_info;
+        requiresReboot = false; // NeighborInfoModule starts and stops itself on configChanged
         break;
     case meshtastic_ModuleConfig_detection_sensor_tag:
         LOG_INFO("Set module config: Detection Sensor");
@@ -915,7 +1114,13 @@ bool AdminModule::handleSetModuleConfig(const meshtastic_ModuleConfig &c)
         moduleConfig.paxcounter = c.payload_variant.paxcounter;
         break;
     }
-    saveChanges(SEGMENT_MODULECONFIG);
+    // If we are in an open transaction or configured MQTT or Serial (which disable it once validated), defer disabling Bluetooth
+    // Otherwise, disable Bluetooth to prevent the phone from interfering with the config until we reboot
+    if (requiresReboot && !hasOpenEditTransaction &&
+        !IS_ONE_OF(c.which_payload_variant, meshtastic_ModuleConfig_mqtt_tag, meshtastic_ModuleConfig_serial_tag)) {
+        disableBluetooth();
+    }
+    saveChanges(SEGMENT_MODULECONFIG, requiresReboot);
     return true;
 }
 
@@ -1260,9 +1465,11 @@ void AdminModule::saveChanges(int saveWhat, bool shouldReboot)
 {
     if (!hasOpenEditTransaction) {
         LOG_INFO("Save changes to disk");
-        service->reloadConfig(saveWhat); // Calls saveToDisk among other things
+        service->reloadConfig(saveWhat); // Calls saveToDiskSoon among other things
     } else {
         LOG_INFO("Delay save of changes to disk until the open transaction is committed");
+        pendingSaveWhat |= saveWhat;
+        pendingReboot |= shouldReboot;
     }
     if (shouldReboot && !hasOpenEditTransaction) {
         reboot(DEFAULT_REBOOT_SECONDS);
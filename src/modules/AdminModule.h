@@ -15,6 +15,13 @@ struct AdminModule_ObserverData {
     AdminMessageHandleResult *result;
 };
 
+/**
+ * First byte of an ADMIN_APP payload that holds several AdminMessages, each led by its length as a varint, rather than one.
+ * No AdminMessage can start with it, as protobuf field 0 does not exist, so firmware that doesn't know bulk payloads
+ * rejects them instead of misreading them.
+ */
+#define ADMIN_BULK_MARKER 0x00
+
 /**
  * Admin module for admin messages
  */
@@ -33,8 +40,17 @@ class AdminModule : public ProtobufModule<meshtastic_AdminMessage>, public Obser
     */
     virtual bool handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshtastic_AdminMessage *p) override;
 
+    /// Bulk payloads can't be decoded as one AdminMessage, so they are taken before ProtobufModule tries
+    virtual ProcessMessage handleReceived(const meshtastic_MeshPacket &mp) override;
+
   private:
     bool hasOpenEditTransaction = false;
+    int pendingSaveWhat = 0;    // Segments changed while the edit transaction is open
+    bool pendingReboot = false; // Whether any of those changes needs a reboot
+
+    void handleBulk(const meshtastic_MeshPacket &mp);
+    bool isBulkable(const meshtastic_AdminMessage *r);
+    void addBulkResponse(const meshtastic_MeshPacket &req, meshtastic_MeshPacket **response, const meshtastic_MeshPacket *reply);
 
     uint8_t session_passkey[8] = {0};
     uint session_time = 0;
@@ -17,12 +17,142 @@ AtakPluginModule::AtakPluginModule()
 }
 
 /*
-Encompasses the full construction and sending packet to mesh
-Will be used for broadcast.
+Sends the PLIs coalescePli() held back, once their EUD's interval is up
 */
 int32_t AtakPluginModule::runOnce()
 {
-    return default_broadcast_interval_secs;
+    uint32_t now = millis();
+    int32_t next = INT32_MAX;
+    for (EudPli &eud : eudPlis) {
+        if (!eud.pending)
+            continue;
+        uint32_t waited = now - eud.lastSentMs;
+        if (waited >= ATAK_PLI_INTERVAL_SECS * 1000UL) {
+            LOG_DEBUG("Send the newest PLI held back for 0x%x", eud.callsignHash);
+            meshtastic_MeshPacket *p = eud.pending;
+            eud.pending = NULL;
+            markSent(eud, eud.pendingPli, eud.pendingGroup);
+            service->handleToRadio(*p);
+            packetPool.release(p);
+        } else if ((int32_t)(ATAK_PLI_INTERVAL_SECS * 1000UL - waited) < next) {
+            next = ATAK_PLI_INTERVAL_SECS * 1000UL - waited;
+        }
+    }
+    return next;
+}
+
+static uint32_t hashCallsign(const meshtastic_TAKPacket &t)
+{
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (const char *c = t.has_contact ? t.contact.callsign : ""; *c; c++)
+        hash = (hash ^ (uint8_t)*c) * 16777619u;
+    return hash;
+}
+
+static uint32_t distance(int32_t a, int32_t b)
+{
+    return a > b ? (uint32_t)a - (uint32_t)b : (uint32_t)b - (uint32_t)a;
+}
+
+static bool hasMoved(const meshtastic_PLI &a, const meshtastic_PLI &b)
+{
+    return distance(a.latitude_i, b.latitude_i) > ATAK_PLI_STILL_I || distance(a.longitude_i, b.longitude_i) > ATAK_PLI_STILL_I ||
+           distance(a.altitude, b.altitude) > 5 || a.speed != b.speed;
+}
+
+void AtakPluginModule::markSent(EudPli &eud, const meshtastic_PLI &pli, const meshtastic_Group &group)
+{
+    eud.sent = true;
+    eud.lastSentMs = millis();
+    eud.lastSent = pli;
+    eud.lastGroup = group;
+}
+
+bool AtakPluginModule::coalescePli(const meshtastic_MeshPacket &mp)
+{
+    if (ATAK_PLI_INTERVAL_SECS == 0 || mp.which_payload_variant != meshtastic_MeshPacket_decoded_tag)
+        return false;
+    meshtastic_TAKPacket t = meshtastic_TAKPacket_init_zero;
+    if (!pb_decode_from_bytes(mp.decoded.payload.bytes, mp.decoded.payload.size, &meshtastic_TAKPacket_msg, &t) ||
+        t.which_payload_variant != meshtastic_TAKPacket_pli_tag)
+        return false;
+
+    // The EUD's slot, or the one quiet for longest
+    uint32_t hash = hashCallsign(t), now = millis();
+    EudPli *eud = &eudPlis[0];
+    for (EudPli &e : eudPlis) {
+        if (e.sent && e.callsignHash == hash) {
+            eud = &e;
+            break;
+        }
+        if (!e.sent || (eud->sent && now - e.lastSentMs > now - eud->lastSentMs))
+            eud = &e;
+    }
+    if (eud->callsignHash != hash || !eud->sent) {
+        if (eud->pending)
+            packetPool.release(eud->pending);
+        *eud = {};
+        eud->callsignHash = hash;
+    }
+
+    const meshtastic_PLI &pli = t.payload_variant.pli;
+    bool moved = !eud->sent || hasMoved(pli, eud->lastSent) || t.group.role != eud->lastGroup.role ||
+                 t.group.team != eud->lastGroup.team;
+    uint32_t sinceSent = now - eud->lastSentMs;
+
+    if (!moved && sinceSent < ATAK_PLI_REFRESH_SECS * 1000UL) {
+        LOG_DEBUG("Drop PLI for 0x%x, it hasn't moved", hash);
+        if (eud->pending) { // It came back to where we last said it was
+            packetPool.release(eud->pending);
+            eud->pending = NULL;
+        }
+        return true;
+    }
+    if (eud->sent && sinceSent < ATAK_PLI_INTERVAL_SECS * 1000UL) {
+        LOG_DEBUG("Hold back PLI for 0x%x, the newest goes out in %us", hash,
+                  (unsigned)((ATAK_PLI_INTERVAL_SECS * 1000UL - sinceSent) / 1000));
+        if (eud->pending)
+            packetPool.release(eud->pending);
+        else
+            setIntervalFromNow(ATAK_PLI_INTERVAL_SECS * 1000UL - sinceSent);
+        eud->pending = packetPool.allocCopy(mp);
+        eud->pendingPli = pli;
+        eud->pendingGroup = t.group;
+        if (eud->pending)
+            return true;
+    }
+
+    if (eud->pending) {
+        packetPool.release(eud->pending);
+        eud->pending = NULL;
+    }
+    markSent(*eud, pli, t.group);
+    return false;
+}
+
+int AtakPluginModule::packCallsign(const char *in, char *out, size_t outSize, bool compress)
+{
+    CallsignEntry *cache = callsigns[compress ? 0 : 1];
+    size_t inLen = strlen(in);
+    if (inLen < ATAK_CALLSIGN_CACHE_LEN) {
+        for (uint8_t i = 0; i < ATAK_CALLSIGN_CACHE; i++) {
+            if (cache[i].outLen && strcmp(cache[i].in, in) == 0) {
+                memcpy(out, cache[i].out, cache[i].outLen);
+                out[cache[i].outLen] = '\0';
+                return cache[i].outLen;
+            }
+        }
+    }
+
+    int len = compress ? unishox2_compress_lines(in, inLen, out, outSize - 1, USX_PSET_DFLT, NULL)
+                       : unishox2_decompress_lines(in, inLen, out, outSize - 1, USX_PSET_DFLT, NULL);
+    if (len > 0 && inLen < ATAK_CALLSIGN_CACHE_LEN && len < ATAK_CALLSIGN_CACHE_LEN) {
+        CallsignEntry &e = cache[nextCallsign[compress ? 0 : 1]++ % ATAK_CALLSIGN_CACHE];
+        strcpy(e.in, in);
+        memcpy(e.out, out, len);
+        e.outLen = len;
+    }
+    return len;
 }
 
 bool AtakPluginModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshtastic_TAKPacket *r)
@@ -70,16 +200,15 @@ void AtakPluginModule::alterReceivedProtobuf(meshtastic_MeshPacket &mp, meshtast
         auto compressed = cloneTAKPacketData(t);
         compressed.is_compressed = true;
         if (t->has_contact) {
-            auto length = unishox2_compress_lines(t->contact.callsign, strlen(t->contact.callsign), compressed.contact.callsign,
-                                                  sizeof(compressed.contact.callsign) - 1, USX_PSET_DFLT, NULL);
+            auto length =
+                packCallsign(t->contact.callsign, compressed.contact.callsign, sizeof(compressed.contact.callsign), true);
             if (length < 0) {
                 LOG_WARN("Compress overflow contact.callsign. Revert to uncompressed packet");
                 return;
             }
             LOG_DEBUG("Compressed callsign: %d bytes", length);
-            length = unishox2_compress_lines(t->contact.device_callsign, strlen(t->contact.device_callsign),
-                                             compressed.contact.device_callsign, sizeof(compressed.contact.device_callsign) - 1,
-                                             USX_PSET_DFLT, NULL);
+            length = packCallsign(t->contact.device_callsign, compressed.contact.device_callsign,
+                                  sizeof(compressed.contact.device_callsign), true);
             if (length < 0) {
                 LOG_WARN("Compress overflow contact.device_callsign. Revert to uncompressed packet");
                 return;
@@ -135,17 +264,15 @@ void AtakPluginModule::alterReceivedProtobuf(meshtastic_MeshPacket &mp, meshtast
         uncompressed.is_compressed = false;
         if (t->has_contact) {
             auto length =
-                unishox2_decompress_lines(t->contact.callsign, strlen(t->contact.callsign), uncompressed.contact.callsign,
-                                          sizeof(uncompressed.contact.callsign) - 1, USX_PSET_DFLT, NULL);
+                packCallsign(t->contact.callsign, uncompressed.contact.callsign, sizeof(uncompressed.contact.callsign), false);
             if (length < 0) {
                 LOG_WARN("Decompress overflow contact.callsign. Bailing out");
                 return;
             }
             LOG_DEBUG("Decompressed callsign: %d bytes", length);
 
-            length = unishox2_decompress_lines(t->contact.device_callsign, strlen(t->contact.device_callsign),
-                                               uncompressed.contact.device_callsign,
-                                               sizeof(uncompressed.contact.device_callsign) - 1, USX_PSET_DFLT, NULL);
+            length = packCallsign(t->contact.device_callsign, uncompressed.contact.device_callsign,
+                                  sizeof(uncompressed.contact.device_callsign), false);
             if (length < 0) {
                 LOG_WARN("Decompress overflow contact.device_callsign. Bailing out");
                 return;
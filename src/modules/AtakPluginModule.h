@@ -2,6 +2,26 @@
 #include "ProtobufModule.h"
 #include "meshtastic/atak.pb.h"
 
+// PLIs the phone sends for the same EUD go out at most this often, the newest one in each interval.  0 sends them all
+#ifndef ATAK_PLI_INTERVAL_SECS
+#define ATAK_PLI_INTERVAL_SECS 30
+#endif
+
+// A PLI that hasn't moved since the last one sent for its EUD is only sent again after this long
+#ifndef ATAK_PLI_REFRESH_SECS
+#define ATAK_PLI_REFRESH_SECS (10 * 60)
+#endif
+
+// Closer than this to the last position sent, in 1e-7 degrees (about 10 m), hasn't moved
+#define ATAK_PLI_STILL_I 100
+
+// EUDs behind this node whose PLIs are coalesced, more than that and the longest quiet one is forgotten
+#define ATAK_PLI_EUDS 4
+
+// Compressed and decompressed callsigns remembered, only those shorter than ATAK_CALLSIGN_CACHE_LEN
+#define ATAK_CALLSIGN_CACHE 8
+#define ATAK_CALLSIGN_CACHE_LEN 32
+
 /**
  * Waypoint message handling for meshtastic
  */
@@ -13,6 +33,13 @@ class AtakPluginModule : public ProtobufModule<meshtastic_TAKPacket>, private co
      */
     AtakPluginModule();
 
+    /**
+     * A TAK packet from the phone, before it goes to the mesh.  PLIs are held back so that only the newest one per EUD
+     * goes out each ATAK_PLI_INTERVAL_SECS, and those that haven't moved are dropped until ATAK_PLI_REFRESH_SECS.
+     * @return true if we took care of the packet, false to send it as usual
+     */
+    bool coalescePli(const meshtastic_MeshPacket &mp);
+
   protected:
     virtual bool handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshtastic_TAKPacket *t) override;
     virtual void alterReceivedProtobuf(meshtastic_MeshPacket &mp, meshtastic_TAKPacket *t) override;
@@ -20,7 +47,30 @@ class AtakPluginModule : public ProtobufModule<meshtastic_TAKPacket>, private co
     int32_t runOnce() override;
 
   private:
+    struct EudPli {
+        uint32_t callsignHash;
+        bool sent;
+        uint32_t lastSentMs;
+        meshtastic_PLI lastSent;
+        meshtastic_Group lastGroup;
+        meshtastic_MeshPacket *pending; // The newest PLI that had to wait, from packetPool
+        meshtastic_PLI pendingPli;
+        meshtastic_Group pendingGroup;
+    };
+    EudPli eudPlis[ATAK_PLI_EUDS] = {};
+
+    struct CallsignEntry {
+        char in[ATAK_CALLSIGN_CACHE_LEN];
+        char out[ATAK_CALLSIGN_CACHE_LEN];
+        uint8_t outLen;
+    };
+    // [0] compressed for the mesh, [1] decompressed for the phone
+    CallsignEntry callsigns[2][ATAK_CALLSIGN_CACHE] = {};
+    uint8_t nextCallsign[2] = {};
+
     meshtastic_TAKPacket cloneTAKPacketData(meshtastic_TAKPacket *t);
+    int packCallsign(const char *in, char *out, size_t outSize, bool compress);
+    void markSent(EudPli &eud, const meshtastic_PLI &pli, const meshtastic_Group &group);
 };
 
 extern AtakPluginModule *atakPluginModule;
\ No newline at end of file
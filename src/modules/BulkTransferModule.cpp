@@ -0,0 +1,371 @@
+#include "BulkTransferModule.h"
+#include "MeshService.h"
+#include "NodeDB.h"
+#include "RadioLibInterface.h"
+#include "Router.h"
+#include "airtime.h"
+#include "configuration.h"
+#include <algorithm>
+#include <stdlib.h>
+
+BulkTransferModule *bulkTransferModule;
+
+static_assert(BULK_FIRST_HEADER_LEN + BULK_FRAGMENT_LEN <= meshtastic_Constants_DATA_PAYLOAD_LEN,
+              "A fragment must fit in one packet");
+
+BulkTransferModule::BulkTransferModule()
+    : SinglePortModule("bulk", BULK_TRANSFER_PORTNUM), concurrency::OSThread("BulkTransfer", BULK_POLL_MSEC)
+{
+    disable(); // Until there is a transfer
+}
+
+uint16_t BulkTransferModule::send(NodeNum to, meshtastic_PortNum port, uint32_t total, BulkSource source, BulkDone done,
+                                  ChannelIndex channel)
+{
+    if (!total || total > BULK_MAX_TOTAL || isBroadcast(to) || !source)
+        return 0;
+    for (Outgoing &o : outgoing) {
+        if (o.active)
+            continue;
+        o.active = true;
+        o.to = to;
+        do
+            o.id = random(1, UINT16_MAX + 1);
+        while (std::any_of(outgoing, outgoing + BULK_TX_SLOTS, [&](const Outgoing &other) {
+            return &other != &o && other.active && other.id == o.id;
+        }));
+        o.port = port;
+        o.channel = channel;
+        o.total = total;
+        o.source = source;
+        o.done = done;
+        o.window.start(BulkTransfer::fragmentCount(total));
+        o.lastActivity = millis();
+        o.timeouts = 0;
+        LOG_INFO("Bulk transfer 0x%04x: send %u bytes to 0x%x on port %u", o.id, total, to, port);
+        setIntervalFromNow(0);
+        return o.id;
+    }
+    return 0;
+}
+
+bool BulkTransferModule::cancel(uint16_t id)
+{
+    for (Outgoing &o : outgoing) {
+        if (o.active && o.id == id) {
+            sendCancel(o.to, o.id, o.channel);
+            finish(o, false);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool BulkTransferModule::setSink(meshtastic_PortNum port, BulkTransferSink *sink)
+{
+    for (auto &s : sinks) {
+        if (s.sink && s.port == port) {
+            s.sink = sink;
+            return true;
+        }
+    }
+    if (!sink)
+        return true;
+    for (auto &s : sinks) {
+        if (!s.sink) {
+            s.port = port;
+            s.sink = sink;
+            return true;
+        }
+    }
+    return false;
+}
+
+BulkTransferSink *BulkTransferModule::findSink(uint16_t port) const
+{
+    for (const auto &s : sinks)
+        if (s.sink && s.port == port)
+            return s.sink;
+    return NULL;
+}
+
+BulkTransferModule::Incoming *BulkTransferModule::findIncoming(NodeNum from, uint16_t id)
+{
+    for (Incoming &in : incoming)
+        if (in.state != Incoming::FREE && in.from == from && in.id == id)
+            return &in;
+    return NULL;
+}
+
+ProcessMessage BulkTransferModule::handleReceived(const meshtastic_MeshPacket &mp)
+{
+    if (isBroadcast(mp.to))
+        return ProcessMessage::STOP; // Transfers are always to one node
+
+    BulkTransfer::Message m;
+    if (!BulkTransfer::decode(mp.decoded.payload.bytes, mp.decoded.payload.size, m)) {
+        LOG_WARN("Bulk transfer: malformed message from 0x%x", getFrom(&mp));
+        return ProcessMessage::STOP;
+    }
+    switch (m.type) {
+    case BulkTransfer::DATA:
+        handleData(mp, m);
+        break;
+    case BulkTransfer::ACK:
+        handleAck(getFrom(&mp), m);
+        break;
+    case BulkTransfer::CANCEL:
+        for (Outgoing &o : outgoing)
+            if (o.active && o.to == getFrom(&mp) && o.id == m.id)
+                finish(o, false);
+        if (Incoming *in = findIncoming(getFrom(&mp), m.id))
+            end(*in, false);
+        break;
+    }
+    return ProcessMessage::STOP;
+}
+
+void BulkTransferModule::handleData(const meshtastic_MeshPacket &mp, const BulkTransfer::Message &m)
+{
+    NodeNum from = getFrom(&mp);
+    Incoming *in = findIncoming(from, m.id);
+    if (!in) {
+        if (m.seq >= BULK_WINDOW) {
+            // Not the start of anything we know of, we must have given up on it or rebooted since
+            sendCancel(from, m.id, mp.channel);
+            return;
+        }
+        for (Incoming &slot : incoming) {
+            if (slot.state == Incoming::FREE) {
+                in = &slot;
+                break;
+            }
+        }
+        if (!in)
+            return; // No room now, the sender tries again when it hears nothing back
+        in->buffer = (uint8_t *)malloc(BULK_WINDOW * BULK_FRAGMENT_LEN);
+        if (!in->buffer) {
+            sendCancel(from, m.id, mp.channel);
+            return;
+        }
+        in->state = Incoming::RECEIVING;
+        in->from = from;
+        in->id = m.id;
+        in->channel = mp.channel;
+        in->total = in->count = in->delivered = 0;
+        in->sink = NULL;
+        in->window.start(in->buffer);
+        in->sinceAck = 0;
+        setIntervalFromNow(BULK_POLL_MSEC); // For the idle timeout
+    }
+    in->lastHeard = millis();
+
+    if (in->state == Incoming::FINISHED) {
+        sendAck(*in); // Our last one must have been lost
+        return;
+    }
+
+    if (m.seq == 0 && !in->sink) {
+        BulkTransferSink *sink = findSink(m.port);
+        if (!m.total || m.total > BULK_MAX_TOTAL || !sink || !sink->onBulkStart(from, m.id, m.total)) {
+            LOG_INFO("Bulk transfer 0x%04x: refuse %u bytes from 0x%x for port %u", m.id, m.total, from, m.port);
+            sendCancel(from, m.id, mp.channel);
+            end(*in, false);
+            return;
+        }
+        LOG_INFO("Bulk transfer 0x%04x: receive %u bytes from 0x%x for port %u", m.id, m.total, from, m.port);
+        in->sink = sink;
+        in->total = m.total;
+        in->count = BulkTransfer::fragmentCount(m.total);
+    }
+
+    if (in->count && m.seq >= in->count)
+        return; // Past the end
+
+    BulkReceiveWindow::Result result = in->window.put(m.seq, m.data, m.len);
+    bool ack =
+        result != BulkReceiveWindow::NEW || ++in->sinceAck >= (BULK_WINDOW + 1) / 2 || (uint32_t)m.seq + 1 == in->count;
+
+    // Hand on what is now in order, but nothing until the first fragment said who it is for
+    const uint8_t *data;
+    size_t len;
+    while (in->sink && in->window.peek(data, len)) {
+        len = std::min<size_t>(len, in->total - in->delivered);
+        in->sink->onBulkData(from, in->id, in->delivered, data, len);
+        in->delivered += len;
+        in->window.pop();
+    }
+    if (in->count && in->window.next >= in->count) {
+        LOG_INFO("Bulk transfer 0x%04x: got all %u bytes from 0x%x", in->id, in->total, from);
+        in->sink->onBulkEnd(from, in->id, true);
+        free(in->buffer);
+        in->buffer = NULL;
+        in->state = Incoming::FINISHED;
+        ack = true;
+    }
+    if (ack)
+        sendAck(*in);
+}
+
+void BulkTransferModule::handleAck(NodeNum from, const BulkTransfer::Message &m)
+{
+    for (Outgoing &o : outgoing) {
+        if (!o.active || o.to != from || o.id != m.id)
+            continue;
+        if (o.window.onAck(m.seq, m.bitmap))
+            o.timeouts = 0;
+        o.lastActivity = millis();
+        if (o.window.done()) {
+            LOG_INFO("Bulk transfer 0x%04x: 0x%x has all %u bytes", o.id, o.to, o.total);
+            finish(o, true);
+        } else {
+            setIntervalFromNow(0);
+        }
+    }
+}
+
+bool BulkTransferModule::sendFragment(Outgoing &o, uint32_t seq)
+{
+    uint8_t chunk[BULK_FRAGMENT_LEN];
+    uint32_t offset = seq * BULK_FRAGMENT_LEN;
+    size_t len = std::min<uint32_t>(BULK_FRAGMENT_LEN, o.total - offset);
+    if (o.source(offset, chunk, len) != len) {
+        LOG_WARN("Bulk transfer 0x%04x: source failed at %u", o.id, offset);
+        return false;
+    }
+
+    meshtastic_MeshPacket *p = allocDataPacket();
+    p->to = o.to;
+    p->channel = o.channel;
+    p->priority = meshtastic_MeshPacket_Priority_BACKGROUND;
+    p->decoded.payload.size = BulkTransfer::encodeData(p->decoded.payload.bytes, o.id, seq, o.port, o.total, chunk, len);
+    transmit(p);
+    return true;
+}
+
+void BulkTransferModule::sendAck(Incoming &in)
+{
+    meshtastic_MeshPacket *p = allocDataPacket();
+    p->to = in.from;
+    p->channel = in.channel;
+    p->priority = meshtastic_MeshPacket_Priority_ACK;
+    p->decoded.payload.size = BulkTransfer::encodeAck(p->decoded.payload.bytes, in.id, in.window.next, in.window.bitmap());
+    transmit(p);
+    in.sinceAck = 0;
+}
+
+void BulkTransferModule::sendCancel(NodeNum to, uint16_t id, ChannelIndex channel)
+{
+    meshtastic_MeshPacket *p = allocDataPacket();
+    p->to = to;
+    p->channel = channel;
+    p->decoded.payload.size = BulkTransfer::encodeCancel(p->decoded.payload.bytes, id);
+    transmit(p);
+}
+
+void BulkTransferModule::transmit(meshtastic_MeshPacket *p)
+{
+    service->sendToMesh(p);
+}
+
+void BulkTransferModule::finish(Outgoing &o, bool ok)
+{
+    o.active = false;
+    o.source = nullptr;
+    BulkDone done = o.done;
+    o.done = nullptr;
+    if (done)
+        done(ok);
+}
+
+void BulkTransferModule::end(Incoming &in, bool ok)
+{
+    if (in.state == Incoming::RECEIVING && in.sink)
+        in.sink->onBulkEnd(in.from, in.id, ok);
+    free(in.buffer);
+    in.buffer = NULL;
+    in.state = Incoming::FREE;
+}
+
+uint32_t BulkTransferModule::fragmentMsec()
+{
+    // Header, transfer header, fragment and the Data protobuf around them
+    const uint32_t frameLen = sizeof(PacketHeader) + BULK_FIRST_HEADER_LEN + BULK_FRAGMENT_LEN + 16;
+    return RadioLibInterface::instance ? RadioLibInterface::instance->getPacketTime(frameLen) : 1000;
+}
+
+uint32_t BulkTransferModule::ackTimeoutMsec(const Outgoing &o)
+{
+    // A window out and an ACK back, over every hop, and the relays' contention windows on the way
+    const meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(o.to);
+    uint32_t hops = node && node->has_hops_away ? node->hops_away + 1 : HOP_RELIABLE;
+    return 2 * (BULK_WINDOW + 1) * fragmentMsec() * hops + BULK_MAX_GAP_MSEC / 4;
+}
+
+int32_t BulkTransferModule::runOnce()
+{
+    uint32_t now = millis();
+    bool busy = false;
+
+    for (Incoming &in : incoming) {
+        if (in.state == Incoming::RECEIVING && now - in.lastHeard >= BULK_RX_IDLE_MSEC) {
+            LOG_WARN("Bulk transfer 0x%04x: nothing more from 0x%x, give up", in.id, in.from);
+            end(in, false);
+        } else if (in.state == Incoming::FINISHED && now - in.lastHeard >= BULK_RX_LINGER_MSEC) {
+            end(in, true);
+        }
+        busy = busy || in.state != Incoming::FREE;
+    }
+
+    bool ready = false;
+    for (Outgoing &o : outgoing) {
+        if (!o.active)
+            continue;
+        busy = true;
+        if (!o.window.ready() && now - o.lastActivity >= ackTimeoutMsec(o)) {
+            if (++o.timeouts > BULK_MAX_TIMEOUTS) {
+                LOG_WARN("Bulk transfer 0x%04x: 0x%x stopped answering", o.id, o.to);
+                finish(o, false);
+                continue;
+            }
+            LOG_DEBUG("Bulk transfer 0x%04x: no ACK, send the window again", o.id);
+            o.window.onTimeout();
+            o.lastActivity = now;
+        }
+        ready = ready || o.window.ready();
+    }
+    if (!busy)
+        return disable();
+    if (!ready)
+        return BULK_POLL_MSEC;
+
+    // Back off while the channel is busy or the TX queue is filling up, like a Store & Forward replay
+    uint32_t frameMsec = fragmentMsec();
+    uint32_t budgetWait = airTime ? airTime->getTxBudgetWaitMsec(meshtastic_MeshPacket_Priority_BACKGROUND, frameMsec) : 0;
+    if ((airTime && (!airTime->isTxAllowedChannelUtil(true) || !airTime->isTxAllowedAirUtil())) ||
+        (router && router->getQueueStatus().free < BULK_MIN_TX_FREE) || budgetWait) {
+        gap = std::min<uint32_t>(std::max<uint32_t>({gap, BULK_MIN_GAP_MSEC, budgetWait}) * 2, BULK_MAX_GAP_MSEC);
+        return gap;
+    }
+
+    // Transfers take turns, one fragment at a time
+    for (uint8_t i = 0; i < BULK_TX_SLOTS; i++) {
+        Outgoing &o = outgoing[(nextOutgoing + i) % BULK_TX_SLOTS];
+        if (!o.active || !o.window.ready())
+            continue;
+        nextOutgoing = (nextOutgoing + i + 1) % BULK_TX_SLOTS;
+        bool fresh = !o.window.resend;
+        if (!sendFragment(o, o.window.take())) {
+            sendCancel(o.to, o.id, o.channel);
+            finish(o, false);
+        } else if (fresh) {
+            o.lastActivity = now; // Only new fragments restart the clock, so a lossy link still times out
+        }
+        break;
+    }
+
+    // Our own fragment's airtime apart when the channel is idle, stretching to four times that at the polite limit
+    float load = airTime ? std::min(airTime->channelUtilizationPercent() / airTime->getPoliteChannelUtilPercent(), 1.0f) : 0;
+    gap = std::max<uint32_t>(BULK_MIN_GAP_MSEC, frameMsec + (uint32_t)(3 * frameMsec * load));
+    return gap;
+}
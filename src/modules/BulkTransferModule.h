@@ -0,0 +1,155 @@
+#pragma once
+
+#include "SinglePortModule.h"
+#include "concurrency/OSThread.h"
+#include "mesh/BulkTransfer.h"
+#include <functional>
+
+// In the private range until the protobufs have a number for it
+#define BULK_TRANSFER_PORTNUM ((meshtastic_PortNum)320)
+
+#ifndef BULK_TX_SLOTS
+#define BULK_TX_SLOTS 2 // Transfers we send at once
+#endif
+// Transfers we receive at once, each takes BULK_WINDOW * BULK_FRAGMENT_LEN bytes of heap while it lasts
+#ifndef BULK_RX_SLOTS
+#define BULK_RX_SLOTS 2
+#endif
+#define BULK_MAX_SINKS 4
+#ifndef BULK_MAX_TIMEOUTS
+#define BULK_MAX_TIMEOUTS 5 // Times in a row we send the window again without hearing back before a transfer fails
+#endif
+#ifndef BULK_RX_IDLE_MSEC
+#define BULK_RX_IDLE_MSEC (10 * 60 * 1000) // A transfer we hear nothing more of for this long has failed
+#endif
+#ifndef BULK_RX_LINGER_MSEC
+#define BULK_RX_LINGER_MSEC (2 * 60 * 1000) // How long we answer for a finished transfer, in case our last ACK was lost
+#endif
+#ifndef BULK_MIN_TX_FREE
+#define BULK_MIN_TX_FREE 4 // TX queue slots a transfer leaves for everybody else's traffic
+#endif
+#ifndef BULK_MAX_GAP_MSEC
+#define BULK_MAX_GAP_MSEC 60000 // Longest we back off while the channel or TX queue is busy
+#endif
+#define BULK_MIN_GAP_MSEC 250
+#define BULK_POLL_MSEC 1000 // While we only wait for ACKs and timeouts
+#define BULK_MAX_TOTAL ((uint32_t)UINT16_MAX * BULK_FRAGMENT_LEN)
+
+/// Reads len bytes at offset of an object being sent into buf, @return how many it read.  The same range may be read again.
+typedef std::function<size_t(uint32_t offset, uint8_t *buf, size_t len)> BulkSource;
+/// A transfer we sent is over, ok if the receiver has all of it
+typedef std::function<void(bool ok)> BulkDone;
+
+/// What an application implements to receive objects on its port, see BulkTransferModule::setSink
+class BulkTransferSink
+{
+  public:
+    virtual ~BulkTransferSink() {}
+
+    /// from wants to send us total bytes, @return false to refuse them
+    virtual bool onBulkStart(NodeNum from, uint16_t id, uint32_t total) = 0;
+
+    /// The next len bytes of the object, in order
+    virtual void onBulkData(NodeNum from, uint16_t id, uint32_t offset, const uint8_t *data, size_t len) = 0;
+
+    /// The transfer is over, ok if we got all of it
+    virtual void onBulkEnd(NodeNum from, uint16_t id, bool ok) = 0;
+};
+
+/**
+ * Objects larger than one packet (InkHUD assets, images, long messages, config backups) sent to one node, in fragments.
+ *
+ * The sender keeps up to BULK_WINDOW fragments unacknowledged.  The receiver ACKs every half window, on the last fragment and
+ * on any fragment it already had, with the next one it wants and a bitmap of those it has after that, so only what was lost
+ * is sent again (selective repeat).  If the sender hears nothing back for about a window's airtime over the hops it
+ * retransmits what is unacknowledged, up to BULK_MAX_TIMEOUTS times.
+ *
+ * Fragments go out one at a time, paced like a Store & Forward replay: further apart as the channel gets busier, and not at
+ * all while AirTime or the TX queue says no.  Sources are read a fragment at a time and sinks get the object in order as it
+ * arrives, so neither end holds a whole object.  Receive windows come from a pool of BULK_RX_SLOTS, taken when a transfer
+ * starts and given back when it ends.
+ */
+class BulkTransferModule : public SinglePortModule, private concurrency::OSThread
+{
+  public:
+    BulkTransferModule();
+
+    /**
+     * Send total bytes read from source to the application on port at to.
+     * @return the transfer's id, 0 if we are already sending as many as we can or it is too big
+     */
+    uint16_t send(NodeNum to, meshtastic_PortNum port, uint32_t total, BulkSource source, BulkDone done = nullptr,
+                  ChannelIndex channel = 0);
+
+    /// Give up on a transfer we are sending, done is called with false
+    bool cancel(uint16_t id);
+
+    /// Objects sent to port go to sink, NULL to stop taking them
+    bool setSink(meshtastic_PortNum port, BulkTransferSink *sink);
+
+  protected:
+    virtual ProcessMessage handleReceived(const meshtastic_MeshPacket &mp) override;
+    virtual int32_t runOnce() override;
+
+    /// Hand a packet of ours to the mesh
+    virtual void transmit(meshtastic_MeshPacket *p);
+
+  private:
+    struct Outgoing {
+        bool active;
+        NodeNum to;
+        uint16_t id;
+        meshtastic_PortNum port;
+        ChannelIndex channel;
+        uint32_t total;
+        BulkSource source;
+        BulkDone done;
+        BulkSendWindow window;
+        uint32_t lastActivity;
+        uint8_t timeouts;
+    };
+
+    struct Incoming {
+        enum State { FREE, RECEIVING, FINISHED } state;
+        NodeNum from;
+        uint16_t id;
+        ChannelIndex channel;
+        uint32_t total;
+        uint32_t count; // 0 until the first fragment tells us
+        uint32_t delivered;
+        BulkTransferSink *sink;
+        uint8_t *buffer;
+        BulkReceiveWindow window;
+        uint8_t sinceAck;
+        uint32_t lastHeard;
+    };
+
+    Outgoing outgoing[BULK_TX_SLOTS] = {};
+    Incoming incoming[BULK_RX_SLOTS] = {};
+    struct {
+        meshtastic_PortNum port;
+        BulkTransferSink *sink;
+    } sinks[BULK_MAX_SINKS] = {};
+    uint8_t nextOutgoing = 0;
+    uint32_t gap = BULK_MIN_GAP_MSEC;
+
+    void handleData(const meshtastic_MeshPacket &mp, const BulkTransfer::Message &m);
+    void handleAck(NodeNum from, const BulkTransfer::Message &m);
+
+    bool sendFragment(Outgoing &o, uint32_t seq);
+    void sendAck(Incoming &in);
+    void sendCancel(NodeNum to, uint16_t id, ChannelIndex channel);
+    void finish(Outgoing &o, bool ok);
+    void end(Incoming &in, bool ok);
+
+    BulkTransferSink *findSink(uint16_t port) const;
+    Incoming *findIncoming(NodeNum from, uint16_t id);
+
+    /// Airtime of one full fragment on the air
+    static uint32_t fragmentMsec();
+
+    /// How long o can go without hearing back before we send its window again
+    static uint32_t ackTimeoutMsec(const Outgoing &o);
+};
+
+extern BulkTransferModule *bulkTransferModule;
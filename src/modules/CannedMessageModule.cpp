@@ -175,14 +175,161 @@ int CannedMessageModule::splitConfiguredMessages()
     // Add [Exit] as the last entry
     tempMessages[tempCount++] = "[Exit]";
 
-    // Copy to the member array
+    // Copy to the member array, and tokenize each once rather than on every redraw
+    messageLayouts.clear();
+    messageLayouts.resize(tempCount);
     for (int k = 0; k < tempCount; ++k) {
         this->messages[k] = (char *)tempMessages[k];
+        MessageLayout &layout = messageLayouts[k];
+        tokenizeEmotes(this->messages[k], layout.tokens);
+        layout.maxEmoteHeight = 0;
+        for (const auto &token : layout.tokens)
+            if (token.emote && token.emote->height > layout.maxEmoteHeight)
+                layout.maxEmoteHeight = token.emote->height;
     }
     this->messagesCount = tempCount;
 
     return this->messagesCount;
 }
+
+/**
+ * @brief Split msg into runs of text and the emotes between them, preferring the longest emote label at each position
+ */
+void CannedMessageModule::tokenizeEmotes(const char *msg, std::vector<EmoteToken> &tokens)
+{
+    tokens.clear();
+    int pos = 0;
+    int msgLen = strlen(msg);
+    while (pos < msgLen) {
+        const graphics::Emote *foundEmote = nullptr;
+        int foundLen = 0;
+        for (int j = 0; j < graphics::numEmotes; j++) {
+            const char *label = graphics::emotes[j].label;
+            int labelLen = strlen(label);
+            if (labelLen == 0)
+                continue;
+            if (strncmp(msg + pos, label, labelLen) == 0) {
+                if (!foundEmote || labelLen > foundLen) {
+                    foundEmote = &graphics::emotes[j];
+                    foundLen = labelLen;
+                }
+            }
+        }
+        if (foundEmote) {
+            tokens.push_back({foundEmote, String(foundEmote->label), foundEmote->width + 2});
+            pos += foundLen;
+        } else {
+            // Find next emote
+            int nextEmote = msgLen;
+            for (int j = 0; j < graphics::numEmotes; j++) {
+                const char *label = graphics::emotes[j].label;
+                if (!label || !*label)
+                    continue;
+                const char *found = strstr(msg + pos, label);
+                if (found && (found - msg) < nextEmote) {
+                    nextEmote = found - msg;
+                }
+            }
+            int textLen = (nextEmote > pos) ? (nextEmote - pos) : (msgLen - pos);
+            if (textLen > 0) {
+                tokens.push_back({nullptr, String(msg + pos).substring(0, textLen), -1});
+                pos += textLen;
+            } else {
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Wrap the free text and cursor into freetextLines for the display's width. Only the lines from the first byte
+ *     that changed since the last call are wrapped again, so typing costs a line or two rather than the whole text.
+ */
+void CannedMessageModule::layoutFreetext(OLEDDisplay *display)
+{
+    String text = drawWithCursor(this->freetext, this->cursor);
+    int maxWidth = display->getWidth();
+    if (maxWidth != freetextLayoutWidth) {
+        freetextLines.clear();
+        freetextLayoutText = "";
+        freetextLayoutWidth = maxWidth;
+    } else if (text == freetextLayoutText) {
+        return;
+    }
+
+    unsigned int same = 0;
+    while (same < text.length() && same < freetextLayoutText.length() && text[same] == freetextLayoutText[same])
+        same++;
+    // Keep the lines before the change, but not the one just before the word it is in: that word may fit on it now.
+    // Every line that starts part way through a word too long for a line goes back to where the word starts.
+    size_t keep = 0;
+    while (keep + 1 < freetextLines.size() && freetextLines[keep].end <= same)
+        keep++;
+    while (keep > 0 && !freetextLines[keep].wordStart)
+        keep--;
+    if (keep > 0)
+        keep--;
+    while (keep > 0 && !freetextLines[keep].wordStart)
+        keep--;
+    unsigned int offset = keep < freetextLines.size() ? freetextLines[keep].start : 0;
+    freetextLines.resize(keep);
+
+    std::vector<EmoteToken> tokens;
+    tokenizeEmotes(text.c_str() + offset, tokens);
+
+    // ===== Advanced word-wrapping (emotes + text, split by word, wrap by char if needed) =====
+    FreetextLine line = {(uint16_t)offset, (uint16_t)offset, true, {}};
+    int lineWidth = 0;
+    auto breakLine = [&](unsigned int at, bool wordStart) {
+        line.end = at;
+        freetextLines.push_back(line);
+        line = {(uint16_t)at, (uint16_t)at, wordStart, {}};
+        lineWidth = 0;
+    };
+    for (auto &token : tokens) {
+        if (token.emote) {
+            if (lineWidth + token.width > maxWidth && !line.tokens.empty())
+                breakLine(offset, true);
+            line.tokens.push_back(token);
+            lineWidth += token.width;
+        } else {
+            // Text: split by words and wrap inside word if needed
+            const String &tokenText = token.text;
+            int pos = 0;
+            while (pos < static_cast<int>(tokenText.length())) {
+                // Find next space (or end)
+                int spacePos = tokenText.indexOf(' ', pos);
+                int endPos = (spacePos == -1) ? tokenText.length() : spacePos + 1; // Include space
+                String word = tokenText.substring(pos, endPos);
+                int wordWidth = display->getStringWidth(word);
+
+                if (lineWidth + wordWidth > maxWidth && lineWidth > 0)
+                    breakLine(offset + pos, true);
+                // If word itself too big, split by character
+                if (wordWidth > maxWidth) {
+                    for (uint16_t charPos = 0; charPos < word.length(); charPos++) {
+                        String oneChar = word.substring(charPos, charPos + 1);
+                        int charWidth = display->getStringWidth(oneChar);
+                        if (lineWidth + charWidth > maxWidth && lineWidth > 0)
+                            breakLine(offset + pos + charPos, false);
+                        line.tokens.push_back({nullptr, oneChar, charWidth});
+                        lineWidth += charWidth;
+                    }
+                } else {
+                    line.tokens.push_back({nullptr, word, wordWidth});
+                    lineWidth += wordWidth;
+                }
+                pos = endPos;
+            }
+        }
+        offset += token.text.length();
+    }
+    if (!line.tokens.empty()) {
+        line.end = offset;
+        freetextLines.push_back(line);
+    }
+    freetextLayoutText = text;
+}
 void CannedMessageModule::drawHeader(OLEDDisplay *display, int16_t x, int16_t y, char *buffer)
 {
     if (graphics::isHighResolution) {
@@ -220,50 +367,65 @@ void CannedMessageModule::resetSearch()
     lastUpdateMillis = millis();
     requestFocus();
 }
+// Whether name contains lowerQuery, ignoring case, without copying name to lower case it
+static bool nameMatches(const char *name, const char *lowerQuery)
+{
+    if (!*lowerQuery)
+        return true;
+    for (; *name; name++) {
+        const char *n = name, *q = lowerQuery;
+        while (*n && *q && tolower((unsigned char)*n) == *q) {
+            n++;
+            q++;
+        }
+        if (!*q)
+            return true;
+    }
+    return false;
+}
+
 void CannedMessageModule::updateDestinationSelectionList()
 {
     static size_t lastNumMeshNodes = 0;
-    static String lastSearchQuery = "";
 
     size_t numMeshNodes = nodeDB->getNumMeshNodes();
     bool nodesChanged = (numMeshNodes != lastNumMeshNodes);
     lastNumMeshNodes = numMeshNodes;
 
     // Early exit if nothing changed
-    if (searchQuery == lastSearchQuery && !nodesChanged)
+    if (searchQuery == filteredQuery && !nodesChanged)
         return;
-    lastSearchQuery = searchQuery;
+    // Typing on only narrows the nodes down, those that didn't match before won't now. NodeInfoLite stays put when the
+    // NodeDB is re-sorted, so the entries are still the same nodes while their number hasn't changed.
+    bool narrowing = !nodesChanged && searchQuery.startsWith(filteredQuery);
+    filteredQuery = searchQuery;
     needsUpdate = false;
 
-    this->filteredNodes.clear();
-    this->activeChannelIndices.clear();
-
-    NodeNum myNodeNum = nodeDB->getNodeNum();
     String lowerSearchQuery = searchQuery;
     lowerSearchQuery.toLowerCase();
 
-    // Preallocate space to reduce reallocation
-    this->filteredNodes.reserve(numMeshNodes);
-
-    for (size_t i = 0; i < numMeshNodes; ++i) {
-        meshtastic_NodeInfoLite *node = nodeDB->getMeshNodeByIndex(i);
-        if (!node || node->num == myNodeNum)
-            continue;
-
-        const String &nodeName = node->user.long_name;
+    if (narrowing) {
+        this->filteredNodes.erase(std::remove_if(this->filteredNodes.begin(), this->filteredNodes.end(),
+                                                 [&](const NodeEntry &e) {
+                                                     return !nameMatches(e.node->user.long_name, lowerSearchQuery.c_str());
+                                                 }),
+                                  this->filteredNodes.end());
+    } else {
+        this->filteredNodes.clear();
+        NodeNum myNodeNum = nodeDB->getNodeNum();
 
-        if (searchQuery.length() == 0) {
-            this->filteredNodes.push_back({node, sinceLastSeen(node)});
-        } else {
-            // Avoid unnecessary lowercase conversion if already matched
-            String lowerNodeName = nodeName;
-            lowerNodeName.toLowerCase();
+        // Preallocate space to reduce reallocation
+        this->filteredNodes.reserve(numMeshNodes);
 
-            if (lowerNodeName.indexOf(lowerSearchQuery) != -1) {
+        for (size_t i = 0; i < numMeshNodes; ++i) {
+            meshtastic_NodeInfoLite *node = nodeDB->getMeshNodeByIndex(i);
+            if (!node || node->num == myNodeNum)
+                continue;
+            if (nameMatches(node->user.long_name, lowerSearchQuery.c_str()))
                 this->filteredNodes.push_back({node, sinceLastSeen(node)});
-            }
         }
     }
+    this->activeChannelIndices.clear();
 
     // Populate active channels
     std::vector<String> seenChannels;
@@ -1696,140 +1858,22 @@ void CannedMessageModule::drawFrame(OLEDDisplay *display, OLEDDisplayUiState *st
         display->setColor(WHITE);
         {
             int inputY = 0 + y + FONT_HEIGHT_SMALL;
-            String msgWithCursor = this->drawWithCursor(this->freetext, this->cursor);
-
-            // Tokenize input into (isEmote, token) pairs
-            std::vector<std::pair<bool, String>> tokens;
-            const char *msg = msgWithCursor.c_str();
-            int msgLen = strlen(msg);
-            int pos = 0;
-            while (pos < msgLen) {
-                const graphics::Emote *foundEmote = nullptr;
-                int foundLen = 0;
-                for (int j = 0; j < graphics::numEmotes; j++) {
-                    const char *label = graphics::emotes[j].label;
-                    int labelLen = strlen(label);
-                    if (labelLen == 0)
-                        continue;
-                    if (strncmp(msg + pos, label, labelLen) == 0) {
-                        if (!foundEmote || labelLen > foundLen) {
-                            foundEmote = &graphics::emotes[j];
-                            foundLen = labelLen;
-                        }
-                    }
-                }
-                if (foundEmote) {
-                    tokens.emplace_back(true, String(foundEmote->label));
-                    pos += foundLen;
-                } else {
-                    // Find next emote
-                    int nextEmote = msgLen;
-                    for (int j = 0; j < graphics::numEmotes; j++) {
-                        const char *label = graphics::emotes[j].label;
-                        if (!label || !*label)
-                            continue;
-                        const char *found = strstr(msg + pos, label);
-                        if (found && (found - msg) < nextEmote) {
-                            nextEmote = found - msg;
-                        }
-                    }
-                    int textLen = (nextEmote > pos) ? (nextEmote - pos) : (msgLen - pos);
-                    if (textLen > 0) {
-                        tokens.emplace_back(false, String(msg + pos).substring(0, textLen));
-                        pos += textLen;
-                    } else {
-                        break;
-                    }
-                }
-            }
-
-            // ===== Advanced word-wrapping (emotes + text, split by word, wrap by char if needed) =====
-            std::vector<std::vector<std::pair<bool, String>>> lines;
-            std::vector<std::pair<bool, String>> currentLine;
-            int lineWidth = 0;
-            int maxWidth = display->getWidth();
-            for (auto &token : tokens) {
-                if (token.first) {
-                    // Emote
-                    int tokenWidth = 0;
-                    for (int j = 0; j < graphics::numEmotes; j++) {
-                        if (token.second == graphics::emotes[j].label) {
-                            tokenWidth = graphics::emotes[j].width + 2;
-                            break;
-                        }
-                    }
-                    if (lineWidth + tokenWidth > maxWidth && !currentLine.empty()) {
-                        lines.push_back(currentLine);
-                        currentLine.clear();
-                        lineWidth = 0;
-                    }
-                    currentLine.push_back(token);
-                    lineWidth += tokenWidth;
-                } else {
-                    // Text: split by words and wrap inside word if needed
-                    String text = token.second;
-                    pos = 0;
-                    while (pos < static_cast<int>(text.length())) {
-                        // Find next space (or end)
-                        int spacePos = text.indexOf(' ', pos);
-                        int endPos = (spacePos == -1) ? text.length() : spacePos + 1; // Include space
-                        String word = text.substring(pos, endPos);
-                        int wordWidth = display->getStringWidth(word);
-
-                        if (lineWidth + wordWidth > maxWidth && lineWidth > 0) {
-                            lines.push_back(currentLine);
-                            currentLine.clear();
-                            lineWidth = 0;
-                        }
-                        // If word itself too big, split by character
-                        if (wordWidth > maxWidth) {
-                            uint16_t charPos = 0;
-                            while (charPos < word.length()) {
-                                String oneChar = word.substring(charPos, charPos + 1);
-                                int charWidth = display->getStringWidth(oneChar);
-                                if (lineWidth + charWidth > maxWidth && lineWidth > 0) {
-                                    lines.push_back(currentLine);
-                                    currentLine.clear();
-                                    lineWidth = 0;
-                                }
-                                currentLine.push_back({false, oneChar});
-                                lineWidth += charWidth;
-                                charPos++;
-                            }
-                        } else {
-                            currentLine.push_back({false, word});
-                            lineWidth += wordWidth;
-                        }
-                        pos = endPos;
-                    }
-                }
-            }
-            if (!currentLine.empty())
-                lines.push_back(currentLine);
+            layoutFreetext(display);
 
             // Draw lines with emotes
             int rowHeight = FONT_HEIGHT_SMALL;
             int yLine = inputY;
-            for (auto &line : lines) {
+            for (const auto &line : freetextLines) {
                 int nextX = x;
-                for (const auto &token : line) {
-                    if (token.first) {
-                        const graphics::Emote *emote = nullptr;
-                        for (int j = 0; j < graphics::numEmotes; j++) {
-                            if (token.second == graphics::emotes[j].label) {
-                                emote = &graphics::emotes[j];
-                                break;
-                            }
-                        }
-                        if (emote) {
-                            int emoteYOffset = (rowHeight - emote->height) / 2;
-                            display->drawXbm(nextX, yLine + emoteYOffset, emote->width, emote->height, emote->bitmap);
-                            nextX += emote->width + 2;
-                        }
+                for (const auto &token : line.tokens) {
+                    if (token.emote) {
+                        int emoteYOffset = (rowHeight - token.emote->height) / 2;
+                        display->drawXbm(nextX, yLine + emoteYOffset, token.emote->width, token.emote->height,
+                                         token.emote->bitmap);
                     } else {
-                        display->drawString(nextX, yLine, token.second);
-                        nextX += display->getStringWidth(token.second);
+                        display->drawString(nextX, yLine, token.text);
                     }
+                    nextX += token.width;
                 }
                 yLine += rowHeight;
             }
@@ -1864,78 +1908,17 @@ void CannedMessageModule::drawFrame(OLEDDisplay *display, OLEDDisplayUiState *st
         int countRows = std::min(messagesCount, _visibleRows);
 
         // --- Build per-row max height based on all emotes in line ---
-        for (int i = 0; i < countRows; i++) {
-            const char *msg = getMessageByIndex(topMsg + i);
-            int maxEmoteHeight = 0;
-            for (int j = 0; j < graphics::numEmotes; j++) {
-                const char *label = graphics::emotes[j].label;
-                if (!label || !*label)
-                    continue;
-                const char *search = msg;
-                while ((search = strstr(search, label))) {
-                    if (graphics::emotes[j].height > maxEmoteHeight)
-                        maxEmoteHeight = graphics::emotes[j].height;
-                    search += strlen(label); // Advance past this emote
-                }
-            }
-            rowHeights.push_back(std::max(baseRowSpacing, maxEmoteHeight + 2));
-        }
+        for (int i = 0; i < countRows; i++)
+            rowHeights.push_back(std::max(baseRowSpacing, messageLayouts[topMsg + i].maxEmoteHeight + 2));
 
         // --- Draw all message rows with multi-emote support ---
         int yCursor = listYOffset;
         for (int vis = 0; vis < countRows; vis++) {
             int msgIdx = topMsg + vis;
             int lineY = yCursor;
-            const char *msg = getMessageByIndex(msgIdx);
             int rowHeight = rowHeights[vis];
             bool _highlight = (msgIdx == currentMessageIndex);
-
-            // --- Multi-emote tokenization ---
-            std::vector<std::pair<bool, String>> tokens; // (isEmote, token)
-            int pos = 0;
-            int msgLen = strlen(msg);
-            while (pos < msgLen) {
-                const graphics::Emote *foundEmote = nullptr;
-                int foundLen = 0;
-
-                // Look for any emote label at this pos (prefer longest match)
-                for (int j = 0; j < graphics::numEmotes; j++) {
-                    const char *label = graphics::emotes[j].label;
-                    int labelLen = strlen(label);
-                    if (labelLen == 0)
-                        continue;
-                    if (strncmp(msg + pos, label, labelLen) == 0) {
-                        if (!foundEmote || labelLen > foundLen) {
-                            foundEmote = &graphics::emotes[j];
-                            foundLen = labelLen;
-                        }
-                    }
-                }
-                if (foundEmote) {
-                    tokens.emplace_back(true, String(foundEmote->label));
-                    pos += foundLen;
-                } else {
-                    // Find next emote
-                    int nextEmote = msgLen;
-                    for (int j = 0; j < graphics::numEmotes; j++) {
-                        const char *label = graphics::emotes[j].label;
-                        if (label[0] == 0)
-                            continue;
-                        const char *found = strstr(msg + pos, label);
-                        if (found && (found - msg) < nextEmote) {
-                            nextEmote = found - msg;
-                        }
-                    }
-                    int textLen = (nextEmote > pos) ? (nextEmote - pos) : (msgLen - pos);
-                    if (textLen > 0) {
-                        tokens.emplace_back(false, String(msg + pos).substring(0, textLen));
-                        pos += textLen;
-                    } else {
-                        break;
-                    }
-                }
-            }
-            // --- End multi-emote tokenization ---
+            std::vector<EmoteToken> &tokens = messageLayouts[msgIdx].tokens;
 
             // Vertically center based on rowHeight
             int textYOffset = (rowHeight - FONT_HEIGHT_SMALL) / 2;
@@ -1954,26 +1937,17 @@ void CannedMessageModule::drawFrame(OLEDDisplay *display, OLEDDisplayUiState *st
 #endif
 
             // Draw all tokens left to right
-            for (const auto &token : tokens) {
-                if (token.first) {
-                    // Emote
-                    const graphics::Emote *emote = nullptr;
-                    for (int j = 0; j < graphics::numEmotes; j++) {
-                        if (token.second == graphics::emotes[j].label) {
-                            emote = &graphics::emotes[j];
-                            break;
-                        }
-                    }
-                    if (emote) {
-                        int emoteYOffset = (rowHeight - emote->height) / 2;
-                        display->drawXbm(nextX, lineY + emoteYOffset, emote->width, emote->height, emote->bitmap);
-                        nextX += emote->width + 2;
-                    }
+            for (auto &token : tokens) {
+                if (token.emote) {
+                    int emoteYOffset = (rowHeight - token.emote->height) / 2;
+                    display->drawXbm(nextX, lineY + emoteYOffset, token.emote->width, token.emote->height, token.emote->bitmap);
                 } else {
-                    // Text
-                    display->drawString(nextX, lineY + textYOffset, token.second);
-                    nextX += display->getStringWidth(token.second);
+                    // Text, measured the first time it is drawn
+                    display->drawString(nextX, lineY + textYOffset, token.text);
+                    if (token.width < 0)
+                        token.width = display->getStringWidth(token.text);
                 }
+                nextX += token.width;
             }
 #ifndef USE_EINK
             if (_highlight)
@@ -3,6 +3,11 @@
 #include "ProtobufModule.h"
 #include "input/InputBroker.h"
 
+namespace graphics
+{
+struct Emote;
+}
+
 // ============================
 //        Enums & Defines
 // ============================
@@ -49,6 +54,26 @@ struct NodeEntry {
     uint32_t lastHeard;
 };
 
+// A run of text, or a single emote, as it is drawn
+struct EmoteToken {
+    const graphics::Emote *emote; // NULL for text
+    String text;
+    int width; // -1 until measured
+};
+
+// A canned message split into tokens once, when the messages are configured
+struct MessageLayout {
+    std::vector<EmoteToken> tokens;
+    int maxEmoteHeight;
+};
+
+// A wrapped line of the free text being typed
+struct FreetextLine {
+    uint16_t start, end; // Bytes of the laid out text on this line
+    bool wordStart;      // Starts at a word, rather than part way through one too long for a line
+    std::vector<EmoteToken> tokens;
+};
+
 // ============================
 //      Main Class
 // ============================
@@ -103,6 +128,8 @@ class CannedMessageModule : public SinglePortModule, public Observable<const UIF
             lastRxSnr = p->rx_snr;
         return (p->decoded.portnum == meshtastic_PortNum_ROUTING_APP) ? waitingForAck : false;
     }
+    // Still asked about every port, wantPacket() keeps the last RSSI and SNR of whatever we hear
+    virtual int getDispatchPort() const override { return MESHMODULE_ANY_PORT; }
 
   protected:
     // === Thread Entry Point ===
@@ -112,6 +139,8 @@ class CannedMessageModule : public SinglePortModule, public Observable<const UIF
     void sendText(NodeNum dest, ChannelIndex channel, const char *message, bool wantReplies);
     void drawHeader(OLEDDisplay *display, int16_t x, int16_t y, char *buffer);
     int splitConfiguredMessages();
+    static void tokenizeEmotes(const char *msg, std::vector<EmoteToken> &tokens);
+    void layoutFreetext(OLEDDisplay *display);
     int getNextIndex();
     int getPrevIndex();
 
@@ -152,12 +181,17 @@ class CannedMessageModule : public SinglePortModule, public Observable<const UIF
     bool needsUpdate = true;
     unsigned long lastUpdateMillis = 0;
     String searchQuery;
+    String filteredQuery; // What filteredNodes were last filtered for
     String freetext;
+    String freetextLayoutText; // freetext with the cursor, as freetextLines were laid out
+    int freetextLayoutWidth = 0;
+    std::vector<FreetextLine> freetextLines;
     String temporaryMessage;
 
     // === Message Storage ===
     char messageStore[CANNED_MESSAGE_MODULE_MESSAGES_SIZE + 1];
-    char *messages[CANNED_MESSAGE_MODULE_MESSAGE_MAX_COUNT];
+    char *messages[CANNED_MESSAGE_MODULE_MESSAGE_MAX_COUNT + 3]; // The configured ones and the entries we add around them
+    std::vector<MessageLayout> messageLayouts;                   // Of each of messages
     int messagesCount = 0;
     int currentMessageIndex = -1;
 
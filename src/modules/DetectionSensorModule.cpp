@@ -80,10 +80,69 @@ int32_t DetectionSensorModule::runOnce()
             return disable();
         }
         LOG_INFO("Detection Sensor Module: init");
+#if DETECTION_SENSOR_USE_INTERRUPT
+        wasDetected = hasDetectionEvent();
+        attachInterrupt(digitalPinToInterrupt(moduleConfig.detection_sensor.monitor_pin), onEdge, CHANGE);
+#endif
 
         return setStartDelay();
     }
 
+#if DETECTION_SENSOR_USE_INTERRUPT
+    DetectionSensorTriggerHandler handler = handlers[moduleConfig.detection_sensor.detection_trigger_type];
+    bool levelTriggered = handler == detection_trigger_logic_level;
+    uint32_t minimumMs = Default::getConfiguredOrDefaultMs(moduleConfig.detection_sensor.minimum_broadcast_secs);
+
+    if (!Throttle::isWithinTimespanMs(lastSentToMesh, minimumMs)) {
+        // Oldest edge first, so a pulse that was over before we got here still counts
+        DetectionSensorTriggerVerdict verdict = DetectionSensorVerdictNoop;
+        bool state = wasDetected;
+        uint32_t atMsec = 0;
+        while (edgesOut != edgesIn) {
+            const Edge &edge = edges[edgesOut % DETECTION_SENSOR_MAX_EDGES];
+            bool detected = isDetected(edge.level);
+            DetectionSensorTriggerVerdict v = handler(wasDetected, detected);
+            wasDetected = detected;
+            if (v != DetectionSensorVerdictNoop && verdict != DetectionSensorVerdictDetected) {
+                verdict = v;
+                state = detected;
+                atMsec = edge.atMsec;
+            }
+            edgesOut++;
+        }
+        // A logic level trigger goes off for as long as the level lasts, not only on the edge
+        if (verdict == DetectionSensorVerdictNoop && levelTriggered && wasDetected) {
+            verdict = DetectionSensorVerdictDetected;
+            atMsec = millis();
+        }
+        switch (verdict) {
+        case DetectionSensorVerdictDetected:
+            LOG_DEBUG("Detection Sensor Module: edge %u ms ago", (unsigned)(millis() - atMsec));
+            sendDetectionMessage();
+            break;
+        case DetectionSensorVerdictSendState:
+            LOG_DEBUG("Detection Sensor Module: edge %u ms ago", (unsigned)(millis() - atMsec));
+            sendCurrentStateMessage(state);
+            break;
+        case DetectionSensorVerdictNoop:
+            break;
+        }
+    }
+    if (moduleConfig.detection_sensor.state_broadcast_secs > 0 && untilHeartbeat() == 0)
+        sendCurrentStateMessage(hasDetectionEvent());
+
+    // Sleep until there is something to do: a broadcast held back by minimum_broadcast_secs, or the heartbeat
+    int32_t wait = untilHeartbeat();
+    if (edgesOut != edgesIn || (levelTriggered && wasDetected)) {
+        int32_t held = (int32_t)(minimumMs - (millis() - lastSentToMesh));
+        if (held < GPIO_POLLING_INTERVAL)
+            held = GPIO_POLLING_INTERVAL;
+        if (held < wait)
+            wait = held;
+    }
+    return wait;
+#else
+
     // LOG_DEBUG("Detection Sensor Module: Current pin state: %i", digitalRead(moduleConfig.detection_sensor.monitor_pin));
 
     if (!Throttle::isWithinTimespanMs(lastSentToMesh,
@@ -114,6 +173,42 @@ int32_t DetectionSensorModule::runOnce()
         return DELAYED_INTERVAL;
     }
     return GPIO_POLLING_INTERVAL;
+#endif
+}
+
+IRAM_ATTR void DetectionSensorModule::onEdge()
+{
+    DetectionSensorModule *self = detectionSensorModule;
+    uint32_t now = micros();
+    if (now - self->lastEdgeUsec < DETECTION_SENSOR_DEBOUNCE_US)
+        return;
+    self->lastEdgeUsec = now;
+
+    Edge edge = {millis(), (bool)digitalRead(moduleConfig.detection_sensor.monitor_pin)};
+    if (self->isDetected(edge.level))
+        self->pulses++;
+    uint8_t in = self->edgesIn;
+    if ((uint8_t)(in - self->edgesOut) < DETECTION_SENSOR_MAX_EDGES) {
+        self->edges[in % DETECTION_SENSOR_MAX_EDGES] = edge;
+        self->edgesIn = in + 1;
+    } else {
+        self->edges[(uint8_t)(in - 1) % DETECTION_SENSOR_MAX_EDGES] = edge; // Full, the newest level is the one that matters
+    }
+
+    self->setInterval(0);
+    runASAP = true;
+    BaseType_t higherPriWoken = 0;
+    concurrency::mainDelay.interruptFromISR(&higherPriWoken);
+}
+
+int32_t DetectionSensorModule::untilHeartbeat() const
+{
+    if (moduleConfig.detection_sensor.state_broadcast_secs == 0)
+        return INT32_MAX;
+    uint32_t intervalMs = Default::getConfiguredOrDefaultMs(moduleConfig.detection_sensor.state_broadcast_secs,
+                                                            default_telemetry_broadcast_interval_secs);
+    uint32_t sinceMs = millis() - lastSentToMesh;
+    return sinceMs >= intervalMs ? 0 : intervalMs - sinceMs;
 }
 
 void DetectionSensorModule::sendDetectionMessage()
@@ -141,8 +236,12 @@ void DetectionSensorModule::sendDetectionMessage()
 
 void DetectionSensorModule::sendCurrentStateMessage(bool state)
 {
-    char *message = new char[40];
+    char *message = new char[64];
+#if DETECTION_SENSOR_PULSE_COUNT
+    sprintf(message, "%s state: %i count: %u", moduleConfig.detection_sensor.name, state, (unsigned)pulses);
+#else
     sprintf(message, "%s state: %i", moduleConfig.detection_sensor.name, state);
+#endif
     meshtastic_MeshPacket *p = allocDataPacket();
     p->want_ack = false;
     p->decoded.payload.size = strlen(message);
@@ -160,5 +259,10 @@ bool DetectionSensorModule::hasDetectionEvent()
 {
     bool currentState = digitalRead(moduleConfig.detection_sensor.monitor_pin);
     // LOG_DEBUG("Detection Sensor Module: Current state: %i", currentState);
-    return (moduleConfig.detection_sensor.detection_trigger_type & 1) ? currentState : !currentState;
+    return isDetected(currentState);
+}
+
+bool DetectionSensorModule::isDetected(bool level) const
+{
+    return (moduleConfig.detection_sensor.detection_trigger_type & 1) ? level : !level;
 }
\ No newline at end of file
@@ -1,6 +1,27 @@
 #pragma once
 #include "SinglePortModule.h"
 
+// Set to 0 to poll monitor_pin every GPIO_POLLING_INTERVAL instead of waking on its edges
+#ifndef DETECTION_SENSOR_USE_INTERRUPT
+#define DETECTION_SENSOR_USE_INTERRUPT 1
+#endif
+// Edges closer than this to the last one are contact bounce (reed switches bounce for a few ms)
+#ifndef DETECTION_SENSOR_DEBOUNCE_US
+#define DETECTION_SENSOR_DEBOUNCE_US 5000
+#endif
+// Set to 1 to add the number of detections since boot to the state heartbeat, for reed switches and flow meters
+#ifndef DETECTION_SENSOR_PULSE_COUNT
+#define DETECTION_SENSOR_PULSE_COUNT 0
+#endif
+#define DETECTION_SENSOR_MAX_EDGES 16 // Edges we hold until the thread gets to them, a power of two
+
+/**
+ * Tells the mesh when a PIR, radar, reed switch or the like on monitor_pin goes off.
+ *
+ * With DETECTION_SENSOR_USE_INTERRUPT the pin's edges are timestamped in an interrupt, debounced and queued, and the thread
+ * only runs when there is an edge to look at or a broadcast is due.  A pulse shorter than the old poll interval is no longer
+ * missed, and an idle sensor costs no wakeups.
+ */
 class DetectionSensorModule : public SinglePortModule, private concurrency::OSThread
 {
   public:
@@ -12,12 +33,31 @@ class DetectionSensorModule : public SinglePortModule, private concurrency::OSTh
     virtual int32_t runOnce() override;
 
   private:
+    struct Edge {
+        uint32_t atMsec;
+        bool level;
+    };
+
     bool firstTime = true;
     uint32_t lastSentToMesh = 0;
     bool wasDetected = false;
+
+    // Written by onEdge(), read by the thread
+    Edge edges[DETECTION_SENSOR_MAX_EDGES];
+    volatile uint8_t edgesIn = 0;
+    uint8_t edgesOut = 0;
+    volatile uint32_t lastEdgeUsec = 0;
+    volatile uint32_t pulses = 0; // Edges into the detected state since boot
+
     void sendDetectionMessage();
     void sendCurrentStateMessage(bool state);
     bool hasDetectionEvent();
+    bool isDetected(bool level) const;
+
+    /// msec until the next state heartbeat is due
+    int32_t untilHeartbeat() const;
+
+    static void onEdge();
 };
 
 extern DetectionSensorModule *detectionSensorModule;
\ No newline at end of file
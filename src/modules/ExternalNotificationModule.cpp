@@ -50,6 +50,46 @@ uint8_t colorState = 1;
 uint8_t brightnessIndex = 0;
 uint8_t brightnessValues[] = {0, 10, 20, 30, 50, 90, 160, 170}; // blue gets multiplied by 1.5
 bool ascending = true;
+int32_t shownColor = -1; // What the LEDs were last set to, packed like the NeoPixel color, -1 if we don't know
+
+/**
+ * Set the LEDs to red, green, blue and white, unless that is what they already show.  Every NeoPixel frame or I2C write
+ * we skip is time the radio's interrupt handling doesn't wait behind, and a nag sets the same color from several places.
+ */
+static void showColor()
+{
+    int32_t color = ((uint32_t)white << 24 | (uint32_t)red << 16 | (uint32_t)green << 8 | blue) & INT32_MAX;
+    if (color == shownColor)
+        return;
+    shownColor = color;
+
+#ifdef HAS_NCP5623
+    if (rgb_found.type == ScanI2C::NCP5623) {
+        rgb.setColor(red, green, blue);
+    }
+#endif
+#ifdef HAS_LP5562
+    if (rgb_found.type == ScanI2C::LP5562) {
+        rgbw.setColor(red, green, blue, white);
+    }
+#endif
+#ifdef RGBLED_CA
+    analogWrite(RGBLED_RED, 255 - red); // CA type needs reverse logic
+    analogWrite(RGBLED_GREEN, 255 - green);
+    analogWrite(RGBLED_BLUE, 255 - blue);
+#elif defined(RGBLED_RED)
+    analogWrite(RGBLED_RED, red);
+    analogWrite(RGBLED_GREEN, green);
+    analogWrite(RGBLED_BLUE, blue);
+#endif
+#ifdef HAS_NEOPIXEL
+    pixels.fill(pixels.Color(red, green, blue), 0, NEOPIXEL_COUNT);
+    pixels.show();
+#endif
+#ifdef UNPHONE
+    unphone.rgb(red, green, blue);
+#endif
+}
 #endif
 
 #ifndef PIN_BUZZER
@@ -140,32 +180,7 @@ int32_t ExternalNotificationModule::runOnce()
             green = (colorState & 2) ? brightnessValues[brightnessIndex] : 0;        // Green enabled on colorState = 2,3,6,7
             blue = (colorState & 1) ? (brightnessValues[brightnessIndex] * 1.5) : 0; // Blue enabled on colorState = 1,3,5,7
             white = (colorState & 12) ? brightnessValues[brightnessIndex] : 0;
-#ifdef HAS_NCP5623
-            if (rgb_found.type == ScanI2C::NCP5623) {
-                rgb.setColor(red, green, blue);
-            }
-#endif
-#ifdef HAS_LP5562
-            if (rgb_found.type == ScanI2C::LP5562) {
-                rgbw.setColor(red, green, blue, white);
-            }
-#endif
-#ifdef RGBLED_CA
-            analogWrite(RGBLED_RED, 255 - red); // CA type needs reverse logic
-            analogWrite(RGBLED_GREEN, 255 - green);
-            analogWrite(RGBLED_BLUE, 255 - blue);
-#elif defined(RGBLED_RED)
-            analogWrite(RGBLED_RED, red);
-            analogWrite(RGBLED_GREEN, green);
-            analogWrite(RGBLED_BLUE, blue);
-#endif
-#ifdef HAS_NEOPIXEL
-            pixels.fill(pixels.Color(red, green, blue), 0, NEOPIXEL_COUNT);
-            pixels.show();
-#endif
-#ifdef UNPHONE
-            unphone.rgb(red, green, blue);
-#endif
+            showColor();
             if (ascending) { // fade in
                 brightnessIndex++;
                 if (brightnessIndex == (sizeof(brightnessValues) - 1)) {
@@ -265,34 +280,10 @@ void ExternalNotificationModule::setExternalState(uint8_t index, bool on)
         green = 0;
         blue = 0;
         white = 0;
+    } else {
+        shownColor = -1; // Ambient lighting may have been at the LEDs since we last did
     }
-#endif
-
-#ifdef HAS_NCP5623
-    if (rgb_found.type == ScanI2C::NCP5623) {
-        rgb.setColor(red, green, blue);
-    }
-#endif
-#ifdef HAS_LP5562
-    if (rgb_found.type == ScanI2C::LP5562) {
-        rgbw.setColor(red, green, blue, white);
-    }
-#endif
-#ifdef RGBLED_CA
-    analogWrite(RGBLED_RED, 255 - red); // CA type needs reverse logic
-    analogWrite(RGBLED_GREEN, 255 - green);
-    analogWrite(RGBLED_BLUE, 255 - blue);
-#elif defined(RGBLED_RED)
-    analogWrite(RGBLED_RED, red);
-    analogWrite(RGBLED_GREEN, green);
-    analogWrite(RGBLED_BLUE, blue);
-#endif
-#ifdef HAS_NEOPIXEL
-    pixels.fill(pixels.Color(red, green, blue), 0, NEOPIXEL_COUNT);
-    pixels.show();
-#endif
-#ifdef UNPHONE
-    unphone.rgb(red, green, blue);
+    showColor();
 #endif
 #ifdef T_WATCH_S3
     if (on) {
@@ -317,6 +308,7 @@ bool ExternalNotificationModule::nagging()
 void ExternalNotificationModule::stopNow()
 {
     rtttl::stop();
+    stopTones();
 #ifdef HAS_I2S
     if (audioThread->isPlaying())
         audioThread->stop();
@@ -495,6 +487,7 @@ ProcessMessage ExternalNotificationModule::handleReceived(const meshtastic_MeshP
                         } else
 #endif
                             if (moduleConfig.external_notification.use_pwm) {
+                            stopTones(); // The ringtone gets the buzzer to itself
                             rtttl::begin(config.device.buzzer_gpio, rtttlConfig.ringtone);
                         }
                     }
@@ -540,6 +533,7 @@ ProcessMessage ExternalNotificationModule::handleReceived(const meshtastic_MeshP
                     } else
 #endif
                         if (moduleConfig.external_notification.use_pwm) {
+                        stopTones(); // The ringtone gets the buzzer to itself
                         rtttl::begin(config.device.buzzer_gpio, rtttlConfig.ringtone);
                     }
                 }
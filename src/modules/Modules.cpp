@@ -1,4 +1,5 @@
 #include "configuration.h"
+#include "Modules.h"
 #if !MESHTASTIC_EXCLUDE_INPUTBROKER
 #include "buzz/BuzzerFeedbackThread.h"
 #include "input/ExpressLRSFiveWay.h"
@@ -23,6 +24,9 @@
 #if !MESHTASTIC_EXCLUDE_ATAK
 #include "modules/AtakPluginModule.h"
 #endif
+#if !MESHTASTIC_EXCLUDE_BULK_TRANSFER
+#include "modules/BulkTransferModule.h"
+#endif
 #if !MESHTASTIC_EXCLUDE_CANNEDMESSAGES
 #include "modules/CannedMessageModule.h"
 #endif
@@ -56,9 +60,6 @@
 #include "input/LinuxInputImpl.h"
 #include "input/SeesawRotary.h"
 #include "modules/Telemetry/HostMetrics.h"
-#if !MESHTASTIC_EXCLUDE_STOREFORWARD
-#include "modules/StoreForwardModule.h"
-#endif
 #endif
 #if HAS_TELEMETRY
 #include "modules/Telemetry/DeviceTelemetry.h"
@@ -84,11 +85,11 @@
 #if !MESHTASTIC_EXCLUDE_PAXCOUNTER
 #include "modules/esp32/PaxcounterModule.h"
 #endif
+#endif
+#if defined(ARCH_ESP32) || defined(ARCH_NRF52) || defined(ARCH_RP2040) || defined(ARCH_PORTDUINO)
 #if !MESHTASTIC_EXCLUDE_STOREFORWARD
 #include "modules/StoreForwardModule.h"
 #endif
-#endif
-#if defined(ARCH_ESP32) || defined(ARCH_NRF52) || defined(ARCH_RP2040) || defined(ARCH_PORTDUINO)
 #if !MESHTASTIC_EXCLUDE_EXTERNALNOTIFICATION
 #include "modules/ExternalNotificationModule.h"
 #endif
@@ -105,7 +106,8 @@
 #endif
 
 /**
- * Create module instances here.  If you are adding a new module, you must 'new' it here (or somewhere else)
+ * Create module instances here.  If you are adding a new module, you must make it here with makeModule (or 'new' it
+ * somewhere else)
  */
 void setupModules()
 {
@@ -113,57 +115,60 @@ void setupModules()
 #if (HAS_BUTTON || ARCH_PORTDUINO) && !MESHTASTIC_EXCLUDE_INPUTBROKER
         if (config.display.displaymode != meshtastic_Config_DisplayConfig_DisplayMode_COLOR) {
             inputBroker = new InputBroker();
-            systemCommandsModule = new SystemCommandsModule();
+            systemCommandsModule = makeModule<SystemCommandsModule>();
             buzzerFeedbackThread = new BuzzerFeedbackThread();
         }
 #endif
 #if !MESHTASTIC_EXCLUDE_ADMIN
-        adminModule = new AdminModule();
+        adminModule = makeModule<AdminModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_NODEINFO
-        nodeInfoModule = new NodeInfoModule();
+        nodeInfoModule = makeModule<NodeInfoModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_GPS
-        positionModule = new PositionModule();
+        positionModule = makeModule<PositionModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_WAYPOINT
-        waypointModule = new WaypointModule();
+        waypointModule = makeModule<WaypointModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_TEXTMESSAGE
-        textMessageModule = new TextMessageModule();
+        textMessageModule = makeModule<TextMessageModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_TRACEROUTE
-        traceRouteModule = new TraceRouteModule();
+        traceRouteModule = makeModule<TraceRouteModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_NEIGHBORINFO
-        neighborInfoModule = new NeighborInfoModule();
+        neighborInfoModule = makeModule<NeighborInfoModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_DETECTIONSENSOR
-        detectionSensorModule = new DetectionSensorModule();
+        detectionSensorModule = makeModule<DetectionSensorModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_ATAK
-        atakPluginModule = new AtakPluginModule();
+        atakPluginModule = makeModule<AtakPluginModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_PKI
-        keyVerificationModule = new KeyVerificationModule();
+        keyVerificationModule = makeModule<KeyVerificationModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_DROPZONE
-        dropzoneModule = new DropzoneModule();
+        dropzoneModule = makeModule<DropzoneModule>();
+#endif
+#if !MESHTASTIC_EXCLUDE_BULK_TRANSFER
+        bulkTransferModule = makeModule<BulkTransferModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_GENERIC_THREAD_MODULE
-        new GenericThreadModule();
+        makeModule<GenericThreadModule>();
 #endif
         // Note: if the rest of meshtastic doesn't need to explicitly use your module, you do not need to assign the instance
         // to a global variable.
 
 #if !MESHTASTIC_EXCLUDE_REMOTEHARDWARE
-        new RemoteHardwareModule();
+        makeModule<RemoteHardwareModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_POWERSTRESS
-        new PowerStressModule();
+        makeModule<PowerStressModule>();
 #endif
         // Example: Put your module here
-        // new ReplyModule();
+        // makeModule<ReplyModule>();
 #if (HAS_BUTTON || ARCH_PORTDUINO) && !MESHTASTIC_EXCLUDE_INPUTBROKER
         if (config.display.displaymode != meshtastic_Config_DisplayConfig_DisplayMode_COLOR) {
             rotaryEncoderInterruptImpl1 = new RotaryEncoderInterruptImpl1();
@@ -219,75 +224,73 @@ void setupModules()
 #endif
 #if HAS_SCREEN && !MESHTASTIC_EXCLUDE_CANNEDMESSAGES
         if (config.display.displaymode != meshtastic_Config_DisplayConfig_DisplayMode_COLOR) {
-            cannedMessageModule = new CannedMessageModule();
+            cannedMessageModule = makeModule<CannedMessageModule>();
         }
 #endif
 #if ARCH_PORTDUINO
-        new HostMetricsModule();
+        makeModule<HostMetricsModule>();
 #endif
 #if HAS_TELEMETRY
-        new DeviceTelemetryModule();
+        makeModule<DeviceTelemetryModule>();
 #endif
 // TODO: How to improve this?
 #if HAS_SENSOR && !MESHTASTIC_EXCLUDE_ENVIRONMENTAL_SENSOR
-        new EnvironmentTelemetryModule();
+        makeModule<EnvironmentTelemetryModule>();
 #if __has_include("Adafruit_PM25AQI.h")
         if (nodeTelemetrySensorsMap[meshtastic_TelemetrySensorType_PMSA003I].first > 0) {
-            new AirQualityTelemetryModule();
+            makeModule<AirQualityTelemetryModule>();
         }
 #endif
 #if !MESHTASTIC_EXCLUDE_HEALTH_TELEMETRY
         if (nodeTelemetrySensorsMap[meshtastic_TelemetrySensorType_MAX30102].first > 0 ||
             nodeTelemetrySensorsMap[meshtastic_TelemetrySensorType_MLX90614].first > 0) {
-            new HealthTelemetryModule();
+            makeModule<HealthTelemetryModule>();
         }
 #endif
 #endif
 #if HAS_TELEMETRY && !MESHTASTIC_EXCLUDE_POWER_TELEMETRY && !MESHTASTIC_EXCLUDE_ENVIRONMENTAL_SENSOR
-        new PowerTelemetryModule();
+        makeModule<PowerTelemetryModule>();
 #endif
 #if (defined(ARCH_ESP32) || defined(ARCH_NRF52) || defined(ARCH_RP2040)) && !defined(CONFIG_IDF_TARGET_ESP32S2) &&               \
     !defined(CONFIG_IDF_TARGET_ESP32C3)
 #if !MESHTASTIC_EXCLUDE_SERIAL
         if (config.display.displaymode != meshtastic_Config_DisplayConfig_DisplayMode_COLOR) {
-            new SerialModule();
+            makeModule<SerialModule>();
         }
 #endif
 #endif
 #ifdef ARCH_ESP32
         // Only run on an esp32 based device.
 #if defined(USE_SX1280) && !MESHTASTIC_EXCLUDE_AUDIO
-        audioModule = new AudioModule();
+        audioModule = makeModule<AudioModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_PAXCOUNTER
-        paxcounterModule = new PaxcounterModule();
+        paxcounterModule = makeModule<PaxcounterModule>();
 #endif
 #endif
-#if defined(ARCH_ESP32) || defined(ARCH_PORTDUINO)
+#if defined(ARCH_ESP32) || defined(ARCH_NRF52) || defined(ARCH_RP2040) || defined(ARCH_PORTDUINO)
 #if !MESHTASTIC_EXCLUDE_STOREFORWARD
-        storeForwardModule = new StoreForwardModule();
-#endif
+        storeForwardModule = makeModule<StoreForwardModule>();
 #endif
-#if defined(ARCH_ESP32) || defined(ARCH_NRF52) || defined(ARCH_RP2040) || defined(ARCH_PORTDUINO)
 #if !MESHTASTIC_EXCLUDE_EXTERNALNOTIFICATION
-        externalNotificationModule = new ExternalNotificationModule();
+        externalNotificationModule = makeModule<ExternalNotificationModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_RANGETEST && !MESHTASTIC_EXCLUDE_GPS
-        new RangeTestModule();
+        makeModule<RangeTestModule>();
 #endif
 #endif
     } else {
 #if !MESHTASTIC_EXCLUDE_ADMIN
-        adminModule = new AdminModule();
+        adminModule = makeModule<AdminModule>();
 #endif
 #if HAS_TELEMETRY
-        new DeviceTelemetryModule();
+        makeModule<DeviceTelemetryModule>();
 #endif
 #if !MESHTASTIC_EXCLUDE_TRACEROUTE
-        traceRouteModule = new TraceRouteModule();
+        traceRouteModule = makeModule<TraceRouteModule>();
 #endif
     }
     // NOTE! This module must be added LAST because it likes to check for replies from other modules and avoid sending extra
     // acks
-    routingModule = new RoutingModule();
+    routingModule = makeModule<RoutingModule>();
 }
@@ -1,6 +1,40 @@
 #pragma once
 
+#include "configuration.h"
+#include <new>
+#include <stdint.h>
+#include <utility>
+
+// Modules live in static storage instead of on the heap, so the linker map shows what they cost and the heap doesn't start out
+// fragmented by a dozen long lived objects.  The storage is there even for modules the config never creates, a repeater
+// say, so it's only the default where RAM is tight and builds include few modules anyway.
+#ifndef MODULES_STATIC
+#if defined(ARCH_STM32WL) || defined(ARCH_NRF52)
+#define MODULES_STATIC 1
+#else
+#define MODULES_STATIC 0
+#endif
+#endif
+
+/**
+ * Make the one instance of module T.  With MODULES_STATIC it goes in storage reserved at link time for T, otherwise (or should
+ * T ever be made twice) on the heap.  Either way the module lives until reboot and must never be deleted.
+ */
+template <typename T, typename... Args> T *makeModule(Args &&...args)
+{
+#if MODULES_STATIC
+    alignas(T) static uint8_t storage[sizeof(T)];
+    static bool made = false;
+    if (!made) {
+        made = true;
+        return new (storage) T(std::forward<Args>(args)...);
+    }
+#endif
+    return new T(std::forward<Args>(args)...);
+}
+
 /**
- * Create module instances here.  If you are adding a new module, you must 'new' it here (or somewhere else)
+ * Create module instances here.  If you are adding a new module, you must make it here with makeModule (or 'new' it somewhere
+ * else)
  */
-void setupModules();
\ No newline at end of file
+void setupModules();
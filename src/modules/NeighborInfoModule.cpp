@@ -4,6 +4,7 @@
 #include "NodeDB.h"
 #include "RTC.h"
 #include <Throttle.h>
+#include <algorithm>
 
 NeighborInfoModule *neighborInfoModule;
 
@@ -28,10 +29,10 @@ NOTE: for debugging only
 */
 void NeighborInfoModule::printNodeDBNeighbors()
 {
-    LOG_DEBUG("Our NodeDB contains %d neighbors", neighbors.size());
-    for (size_t i = 0; i < neighbors.size(); i++) {
-        LOG_DEBUG("Node %d: node_id=0x%x, snr=%.2f", i, neighbors[i].node_id, neighbors[i].snr);
-    }
+    LOG_DEBUG("Our NodeDB contains %d neighbors", linkQuality.size());
+    linkQuality.forEach([](const LinkStats &link) {
+        LOG_DEBUG("Node 0x%x: snr=%.2f, heard %u ms ago", link.node, link.snr, millis() - link.lastHeard);
+    });
 }
 
 /* Send our initial owner announcement 35 seconds after we start (to give network time to setup) */
@@ -41,6 +42,7 @@ NeighborInfoModule::NeighborInfoModule()
 {
     ourPortNum = meshtastic_PortNum_NEIGHBORINFO_APP;
     nodeStatusObserver.observe(&nodeStatus->onNewStatus);
+    configChangedObserver.observe(&service->configChanged);
 
     if (moduleConfig.neighbor_info.enabled) {
         isPromiscuous = true; // Update neighbors from all packets
@@ -67,15 +69,27 @@ uint32_t NeighborInfoModule::collectNeighborInfo(meshtastic_NeighborInfo *neighb
 
     cleanUpNeighbors();
 
-    for (auto nbr : neighbors) {
-        if ((neighborInfo->neighbors_count < MAX_NUM_NEIGHBORS) && (nbr.node_id != my_node_id)) {
-            neighborInfo->neighbors[neighborInfo->neighbors_count].node_id = nbr.node_id;
-            neighborInfo->neighbors[neighborInfo->neighbors_count].snr = nbr.snr;
+    // We may know of more neighbors than fit in the packet, then report the best links
+    linkQuality.forEach([&](const LinkStats &link) {
+        if (link.node == my_node_id)
+            return;
+        meshtastic_Neighbor *slot = NULL;
+        if (neighborInfo->neighbors_count < MAX_NUM_NEIGHBORS) {
+            slot = &neighborInfo->neighbors[neighborInfo->neighbors_count++];
+        } else {
+            meshtastic_Neighbor *weakest = std::min_element(
+                neighborInfo->neighbors, neighborInfo->neighbors + MAX_NUM_NEIGHBORS,
+                [](const meshtastic_Neighbor &a, const meshtastic_Neighbor &b) { return a.snr < b.snr; });
+            if (weakest->snr < link.snr)
+                slot = weakest;
+        }
+        if (slot) {
             // Note: we don't set the last_rx_time and node_broadcast_intervals_secs here, because we don't want to send this over
             // the mesh
-            neighborInfo->neighbors_count++;
+            slot->node_id = link.node;
+            slot->snr = link.snr;
         }
-    }
+    });
     printNodeDBNeighbors();
     return neighborInfo->neighbors_count;
 }
@@ -85,19 +99,10 @@ uint32_t NeighborInfoModule::collectNeighborInfo(meshtastic_NeighborInfo *neighb
 */
 void NeighborInfoModule::cleanUpNeighbors()
 {
-    uint32_t now = getTime();
-    NodeNum my_node_id = nodeDB->getNodeNum();
-    for (auto it = neighbors.rbegin(); it != neighbors.rend();) {
-        // We will remove a neighbor if we haven't heard from them in twice the broadcast interval
-        // cannot use isWithinTimespanMs() as it->last_rx_time is seconds since 1970
-        if ((now - it->last_rx_time > it->node_broadcast_interval_secs * 2) && (it->node_id != my_node_id)) {
-            LOG_DEBUG("Remove neighbor with node ID 0x%x", it->node_id);
-            it = std::vector<meshtastic_Neighbor>::reverse_iterator(
-                neighbors.erase(std::next(it).base())); // Erase the element and update the iterator
-        } else {
-            ++it;
-        }
-    }
+    // We will remove a neighbor if we haven't heard from them in twice the broadcast interval, assume the same broadcast
+    // interval as ours if they never told us theirs
+    linkQuality.expire(
+        Default::getConfiguredOrDefault(moduleConfig.neighbor_info.update_interval, default_neighbor_info_broadcast_secs));
 }
 
 /* Send neighbor info to the mesh */
@@ -132,18 +137,39 @@ int32_t NeighborInfoModule::runOnce()
     return Default::getConfiguredOrDefaultMs(moduleConfig.neighbor_info.update_interval, default_neighbor_info_broadcast_secs);
 }
 
+int NeighborInfoModule::handleConfigChanged(void *unused)
+{
+    if (moduleConfig.neighbor_info.enabled == isPromiscuous)
+        return 0;
+
+    isPromiscuous = moduleConfig.neighbor_info.enabled;
+    if (isPromiscuous) {
+        LOG_INFO("NeighborInfoModule enabled");
+        enabled = true;
+        setIntervalFromNow(Default::getConfiguredOrDefaultMs(moduleConfig.neighbor_info.update_interval,
+                                                             default_telemetry_broadcast_interval_secs));
+    } else {
+        LOG_INFO("NeighborInfoModule disabled");
+        disable();
+    }
+    return 0;
+}
+
 /*
 Collect a received neighbor info packet from another node
 Pass it to an upper client; do not persist this data on the mesh
 */
 bool NeighborInfoModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshtastic_NeighborInfo *np)
 {
+    // Every other packet heard straight from its sender is already noted in linkQuality by the Router
     if (np) {
         printNeighborInfo("RECEIVED", np);
         updateNeighbors(mp, np);
-    } else if (mp.hop_start != 0 && mp.hop_start == mp.hop_limit) {
-        // If the hopLimit is the same as hopStart, then it is a neighbor
-        getOrCreateNeighbor(mp.from, mp.from, 0, mp.rx_snr); // Set the broadcast interval to 0, as we don't know it
+        // Its neighbours are at most one relay further away than it is
+        if (mp.hop_start != 0 && mp.hop_limit <= mp.hop_start && !mp.via_mqtt && !isFromUs(&mp)) {
+            for (pb_size_t i = 0; i < np->neighbors_count; i++)
+                nodeDB->noteHopsAway(np->neighbors[i].node_id, mp.hop_start - mp.hop_limit + 1);
+        }
     }
     // Allow others to handle this packet
     return false;
@@ -163,56 +189,22 @@ void NeighborInfoModule::alterReceivedProtobuf(meshtastic_MeshPacket &p, meshtas
 
 void NeighborInfoModule::resetNeighbors()
 {
-    neighbors.clear();
+    linkQuality.clear();
 }
 
 void NeighborInfoModule::updateNeighbors(const meshtastic_MeshPacket &mp, const meshtastic_NeighborInfo *np)
 {
     // The last sent ID will be 0 if the packet is from the phone, which we don't count as
     // an edge. So we assume that if it's zero, then this packet is from our node.
-    if (mp.which_payload_variant == meshtastic_MeshPacket_decoded_tag && mp.from) {
-        getOrCreateNeighbor(mp.from, np->last_sent_by_id, np->node_broadcast_interval_secs, mp.rx_snr);
-    }
-}
-
-meshtastic_Neighbor *NeighborInfoModule::getOrCreateNeighbor(NodeNum originalSender, NodeNum n,
-                                                             uint32_t node_broadcast_interval_secs, float snr)
-{
-    // our node and the phone are the same node (not neighbors)
-    if (n == 0) {
-        n = nodeDB->getNodeNum();
-    }
-    // look for one in the existing list
-    for (size_t i = 0; i < neighbors.size(); i++) {
-        if (neighbors[i].node_id == n) {
-            // if found, update it
-            neighbors[i].snr = snr;
-            neighbors[i].last_rx_time = getTime();
-            // Only if this is the original sender, the broadcast interval corresponds to it
-            if (originalSender == n && node_broadcast_interval_secs != 0)
-                neighbors[i].node_broadcast_interval_secs = node_broadcast_interval_secs;
-            return &neighbors[i];
-        }
-    }
-    // otherwise, allocate one and assign data to it
-
-    meshtastic_Neighbor new_nbr = meshtastic_Neighbor_init_zero;
-    new_nbr.node_id = n;
-    new_nbr.snr = snr;
-    new_nbr.last_rx_time = getTime();
+    NodeNum relayer = np->last_sent_by_id;
+    if (mp.which_payload_variant != meshtastic_MeshPacket_decoded_tag || !mp.from || !relayer || isFromUs(&mp) ||
+        relayer == nodeDB->getNodeNum())
+        return;
+
+    // last_sent_by_id is whoever we heard this copy from.  If that is the original sender the Router has counted it already.
+    bool direct = relayer == mp.from && mp.hop_start != 0 && mp.hop_start == mp.hop_limit;
+    LinkStats *link = direct ? linkQuality.find(relayer) : linkQuality.heard(relayer, mp.rx_snr);
     // Only if this is the original sender, the broadcast interval corresponds to it
-    if (originalSender == n && node_broadcast_interval_secs != 0)
-        new_nbr.node_broadcast_interval_secs = node_broadcast_interval_secs;
-    else // Assume the same broadcast interval as us for the neighbor if we don't know it
-        new_nbr.node_broadcast_interval_secs = moduleConfig.neighbor_info.update_interval;
-
-    if (neighbors.size() < MAX_NUM_NEIGHBORS) {
-        neighbors.push_back(new_nbr);
-    } else {
-        // If we have too many neighbors, replace the oldest one
-        LOG_WARN("Neighbor DB is full, replace oldest neighbor");
-        neighbors.erase(neighbors.begin());
-        neighbors.push_back(new_nbr);
-    }
-    return &neighbors.back();
+    if (link && relayer == mp.from && np->node_broadcast_interval_secs != 0)
+        link->broadcastIntervalSecs = np->node_broadcast_interval_secs;
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "ProtobufModule.h"
+#include "mesh/LinkQuality.h"
 #define MAX_NUM_NEIGHBORS 10 // also defined in NeighborInfo protobuf options
 
 /*
@@ -9,8 +10,8 @@ class NeighborInfoModule : public ProtobufModule<meshtastic_NeighborInfo>, priva
 {
     CallbackObserver<NeighborInfoModule, const meshtastic::Status *> nodeStatusObserver =
         CallbackObserver<NeighborInfoModule, const meshtastic::Status *>(this, &NeighborInfoModule::handleStatusUpdate);
-
-    std::vector<meshtastic_Neighbor> neighbors;
+    CallbackObserver<NeighborInfoModule, void *> configChangedObserver =
+        CallbackObserver<NeighborInfoModule, void *>(this, &NeighborInfoModule::handleConfigChanged);
 
   public:
     /*
@@ -21,6 +22,9 @@ class NeighborInfoModule : public ProtobufModule<meshtastic_NeighborInfo>, priva
     /* Reset neighbor info after clearing nodeDB*/
     void resetNeighbors();
 
+    /* How many 0-hop neighbors we currently know of, they are kept in the shared linkQuality table */
+    size_t getNumNeighbors() const { return linkQuality.size(); }
+
   protected:
     /*
      * Called to handle a particular incoming message
@@ -42,9 +46,6 @@ class NeighborInfoModule : public ProtobufModule<meshtastic_NeighborInfo>, priva
     /* Allocate a new NeighborInfo packet */
     meshtastic_NeighborInfo *allocateNeighborInfoPacket();
 
-    // Find a neighbor in our DB, create an empty neighbor if missing
-    meshtastic_Neighbor *getOrCreateNeighbor(NodeNum originalSender, NodeNum n, uint32_t node_broadcast_interval_secs, float snr);
-
     /*
      * Send info on our node's neighbors into the mesh
      */
@@ -59,9 +60,13 @@ class NeighborInfoModule : public ProtobufModule<meshtastic_NeighborInfo>, priva
     /* Does our periodic broadcast */
     int32_t runOnce() override;
 
+    /* Start or stop when neighbor_info.enabled changes, so that doesn't take a reboot */
+    int handleConfigChanged(void *unused);
+
     /* Override wantPacket to say we want to see all packets when enabled, not just those for our port number.
       Exception is when the packet came via MQTT */
     virtual bool wantPacket(const meshtastic_MeshPacket *p) override { return enabled && !p->via_mqtt; }
+    virtual int getDispatchPort() const override { return MESHMODULE_ANY_PORT; }
 
     /* These are for debugging only */
     void printNeighborInfo(const char *header, const meshtastic_NeighborInfo *np);
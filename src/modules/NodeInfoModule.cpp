@@ -1,9 +1,14 @@
 #include "NodeInfoModule.h"
 #include "Default.h"
+#include "ForwardErrorCorrection.h"
+#include "FrameAggregation.h"
+#include "LinkRate.h"
 #include "MeshService.h"
 #include "NodeDB.h"
 #include "RTC.h"
+#include "ReliableRouter.h"
 #include "Router.h"
+#include "TextCompression.h"
 #include "configuration.h"
 #include "main.h"
 #include <Throttle.h>
@@ -27,6 +32,11 @@ bool NodeInfoModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, mes
     snprintf(p.id, sizeof(p.id), "!%08x", getFrom(&mp));
 
     bool hasChanged = nodeDB->updateUser(getFrom(&mp), p, mp.channel);
+    TextCompression::heardNodeInfo(getFrom(&mp), mp.decoded);
+    FrameAggregation::heardNodeInfo(getFrom(&mp), mp.decoded);
+    ReliableRouter::heardNodeInfo(getFrom(&mp), mp.decoded);
+    LinkRate::heardNodeInfo(getFrom(&mp), mp.decoded);
+    ForwardErrorCorrection::heardNodeInfo(getFrom(&mp), mp.decoded);
 
     bool wasBroadcast = isBroadcast(mp.to);
 
@@ -66,6 +76,43 @@ void NodeInfoModule::sendOurNodeInfo(NodeNum dest, bool wantReplies, uint8_t cha
     }
 }
 
+void NodeInfoModule::checkUserHash(const meshtastic_MeshPacket &mp)
+{
+    const meshtastic_Data &d = mp.decoded;
+    if (mp.which_payload_variant != meshtastic_MeshPacket_decoded_tag || !d.has_bitfield ||
+        !(d.bitfield & BITFIELD_HAS_USER_HASH_MASK) || isFromUs(&mp))
+        return;
+    meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(mp.from);
+    if (!node || !node->has_user)
+        return; // Unknown nodes are asked anyway
+    uint8_t hash = (d.bitfield & BITFIELD_USER_HASH_MASK) >> BITFIELD_USER_HASH_SHIFT;
+    if (hash == NodeDB::getUserHash(node->user))
+        return;
+
+    uint32_t now = millis();
+    HashRequest *slot = NULL;
+    for (HashRequest &r : hashRequests) {
+        if (r.node == mp.from) {
+            if (now - r.at < NODEINFO_HASH_REQUEST_MSEC)
+                return;
+            slot = &r;
+            break;
+        }
+        if (!slot || (slot->node && (!r.node || now - r.at > now - slot->at)))
+            slot = &r;
+    }
+    if (!airTime->isTxAllowedChannelUtil(true))
+        return;
+
+    LOG_INFO("NodeInfo of 0x%x changed (hash %02x, ours %02x), ask for it", mp.from, hash, NodeDB::getUserHash(node->user));
+    PacketId before = prevPacketId;
+    sendOurNodeInfo(mp.from, true, mp.channel, true);
+    if (prevPacketId != before) {
+        slot->node = mp.from;
+        slot->at = now;
+    }
+}
+
 meshtastic_MeshPacket *NodeInfoModule::allocReply()
 {
     if (!airTime->isTxAllowedChannelUtil(false)) {
@@ -99,7 +146,15 @@ meshtastic_MeshPacket *NodeInfoModule::allocReply()
 
         LOG_INFO("Send owner %s/%s/%s", u.id, u.long_name, u.short_name);
         lastSentToMesh = millis();
-        return allocDataProtobuf(u);
+        meshtastic_MeshPacket *p = allocDataProtobuf(u);
+        // Let everyone know they can send us compressed text, several packets in one frame, one ACK for several packets and
+        // frames with parity
+        p->decoded.has_bitfield = true;
+        p->decoded.bitfield |= BITFIELD_READS_COMPRESSED_TEXT_MASK | BITFIELD_READS_AGGREGATES_MASK |
+                               BITFIELD_READS_MULTI_ACK_MASK | BITFIELD_READS_FEC_MASK;
+        if (linkRate)
+            p->decoded.bitfield |= BITFIELD_READS_LINK_RATE_MASK;
+        return p;
     }
 }
 
@@ -122,5 +177,16 @@ int32_t NodeInfoModule::runOnce()
         LOG_INFO("Send our nodeinfo to mesh (wantReplies=%d)", requestReplies);
         sendOurNodeInfo(NODENUM_BROADCAST, requestReplies); // Send our info (don't request replies)
     }
-    return Default::getConfiguredOrDefaultMs(config.device.node_info_broadcast_secs, default_node_info_broadcast_secs);
+
+    // Back off while nothing changed, a change is broadcast when it is made and starts over from the configured interval
+    uint8_t hash = NodeDB::getOwnerHash();
+    if (requestReplies || hash != lastBroadcastHash)
+        broadcastBackoff = 1;
+    else if (broadcastBackoff < NODEINFO_BROADCAST_BACKOFF_MAX)
+        broadcastBackoff *= 2;
+    lastBroadcastHash = hash;
+
+    uint32_t interval =
+        Default::getConfiguredOrDefaultMs(config.device.node_info_broadcast_secs, default_node_info_broadcast_secs);
+    return interval > INT32_MAX / broadcastBackoff ? INT32_MAX : interval * broadcastBackoff;
 }
\ No newline at end of file
@@ -1,6 +1,18 @@
 #pragma once
 #include "ProtobufModule.h"
 
+// Each NodeInfo broadcast with nothing changed since the last waits twice as long, up to this times the configured interval.
+// Nodes that have it see from the user hash on our other broadcasts if it is still current, see BITFIELD_USER_HASH_MASK.
+#ifndef NODEINFO_BROADCAST_BACKOFF_MAX
+#define NODEINFO_BROADCAST_BACKOFF_MAX 4
+#endif
+
+// How long we wait before asking the same node for its changed NodeInfo again
+#ifndef NODEINFO_HASH_REQUEST_MSEC
+#define NODEINFO_HASH_REQUEST_MSEC (30 * 60 * 1000)
+#endif
+#define NODEINFO_HASH_REQUEST_SLOTS 4
+
 /**
  * NodeInfo module for sending/receiving NodeInfos into the mesh
  */
@@ -23,6 +35,9 @@ class NodeInfoModule : public ProtobufModule<meshtastic_User>, private concurren
     void sendOurNodeInfo(NodeNum dest = NODENUM_BROADCAST, bool wantReplies = false, uint8_t channel = 0,
                          bool _shorterTimeout = false);
 
+    /// Ask the sender of mp for its NodeInfo if the user hash on it says ours is out of date
+    void checkUserHash(const meshtastic_MeshPacket &mp);
+
   protected:
     /** Called to handle a particular incoming message
 
@@ -40,6 +55,13 @@ class NodeInfoModule : public ProtobufModule<meshtastic_User>, private concurren
   private:
     uint32_t lastSentToMesh = 0; // Last time we sent our NodeInfo to the mesh
     bool shorterTimeout = false;
+
+    uint8_t broadcastBackoff = 1;  // Times the configured interval until our next periodic broadcast
+    uint8_t lastBroadcastHash = 0;   // NodeDB::getOwnerHash() when we last did one
+    struct HashRequest {
+        NodeNum node;
+        uint32_t at;
+    } hashRequests[NODEINFO_HASH_REQUEST_SLOTS] = {};
 };
 
 extern NodeInfoModule *nodeInfoModule;
@@ -0,0 +1,78 @@
+#include "PaxEstimator.h"
+#include <math.h>
+#include <string.h>
+
+#define PAX_ESTIMATOR_BUCKET_MS (PAX_ESTIMATOR_BUCKET_MINUTES * 60 * 1000UL)
+
+// A well mixed 64 bit hash, the sketch relies on every bit of it being as likely set as not
+static uint64_t hashAddr(const uint8_t *addr, size_t len)
+{
+    uint64_t h = 14695981039346656037ULL; // FNV-1a, then the splitmix64 finalizer
+    for (size_t i = 0; i < len; i++)
+        h = (h ^ addr[i]) * 1099511628211ULL;
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+    return h ^ (h >> 31);
+}
+
+void PaxEstimator::advance(uint32_t nowMs)
+{
+    uint32_t now = nowMs / PAX_ESTIMATOR_BUCKET_MS;
+    if (now == epoch)
+        return;
+    // Buckets nothing was seen in since are started empty, at most all of them
+    uint32_t stale = now - epoch < PAX_ESTIMATOR_BUCKETS ? now - epoch : PAX_ESTIMATOR_BUCKETS;
+    for (uint32_t i = 1; i <= stale; i++)
+        memset(registers[(now - stale + i) % PAX_ESTIMATOR_BUCKETS], 0, PAX_ESTIMATOR_REGISTERS);
+    epoch = now;
+}
+
+void PaxEstimator::add(const uint8_t *addr, size_t len, uint32_t nowMs)
+{
+    advance(nowMs);
+    fed = true;
+
+    uint64_t h = hashAddr(addr, len);
+    uint32_t index = h >> (64 - PAX_ESTIMATOR_BITS);
+    uint64_t rest = h << PAX_ESTIMATOR_BITS;
+    // Position of the first set bit after the index bits, a run of n zeros is about as rare as 2^n devices
+    uint8_t rank = rest ? __builtin_clzll(rest) + 1 : 64 - PAX_ESTIMATOR_BITS + 1;
+
+    uint8_t &reg = registers[epoch % PAX_ESTIMATOR_BUCKETS][index];
+    if (rank > reg)
+        reg = rank;
+}
+
+uint32_t PaxEstimator::estimate(uint32_t windowMinutes, uint32_t nowMs)
+{
+    advance(nowMs);
+
+    uint32_t buckets = (windowMinutes + PAX_ESTIMATOR_BUCKET_MINUTES - 1) / PAX_ESTIMATOR_BUCKET_MINUTES;
+    if (buckets < 1)
+        buckets = 1;
+    if (buckets > PAX_ESTIMATOR_BUCKETS)
+        buckets = PAX_ESTIMATOR_BUCKETS;
+    if (buckets > epoch + 1) // Not up that long yet
+        buckets = epoch + 1;
+
+    double sum = 0;
+    uint32_t zeros = 0;
+    for (uint32_t r = 0; r < PAX_ESTIMATOR_REGISTERS; r++) {
+        uint8_t merged = 0;
+        for (uint32_t b = 0; b < buckets; b++) {
+            uint8_t v = registers[(epoch - b) % PAX_ESTIMATOR_BUCKETS][r];
+            if (v > merged)
+                merged = v;
+        }
+        sum += ldexp(1.0, -merged);
+        if (!merged)
+            zeros++;
+    }
+
+    const double m = PAX_ESTIMATOR_REGISTERS;
+    double e = 0.7213 / (1 + 1.079 / m) * m * m / sum;
+    // Few devices leave registers empty, counting those is the more accurate estimate then
+    if (e <= 2.5 * m && zeros)
+        e = m * log(m / zeros);
+    return (uint32_t)(e + 0.5);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Estimates how many distinct devices were seen in the last few minutes, in memory that does not grow with the crowd.
+ *
+ * Each device address is counted in a HyperLogLog sketch for the PAX_ESTIMATOR_BUCKET_MINUTES it was seen in, and the
+ * sketches of the last PAX_ESTIMATOR_BUCKETS such buckets are kept. The count for a window merges the sketches it covers,
+ * so a device seen every minute of it still counts once. With 2^PAX_ESTIMATOR_BITS registers the estimate is within
+ * 1.04 / sqrt(registers) of the true count most of the time, about 9% at the default.
+ */
+
+// log2 of the registers per sketch, each register is a byte
+#ifndef PAX_ESTIMATOR_BITS
+#define PAX_ESTIMATOR_BITS 7
+#endif
+
+#ifndef PAX_ESTIMATOR_BUCKET_MINUTES
+#define PAX_ESTIMATOR_BUCKET_MINUTES 5
+#endif
+
+// Sketches kept, the longest window that can be asked for is this many buckets
+#ifndef PAX_ESTIMATOR_BUCKETS
+#define PAX_ESTIMATOR_BUCKETS 12
+#endif
+
+#define PAX_ESTIMATOR_REGISTERS (1 << PAX_ESTIMATOR_BITS)
+
+class PaxEstimator
+{
+  public:
+    /// A device with this address was seen
+    void add(const uint8_t *addr, size_t len, uint32_t nowMs);
+
+    /// Distinct devices seen in the last windowMinutes, rounded up to whole buckets and including the current one
+    uint32_t estimate(uint32_t windowMinutes, uint32_t nowMs);
+
+    /// Whether anything was ever added, or the count has to come from elsewhere
+    bool isFed() const { return fed; }
+
+  private:
+    uint8_t registers[PAX_ESTIMATOR_BUCKETS][PAX_ESTIMATOR_REGISTERS] = {};
+    uint32_t epoch = 0; // Buckets since boot, the current one is registers[epoch % PAX_ESTIMATOR_BUCKETS]
+    bool fed = false;
+
+    void advance(uint32_t nowMs);
+};
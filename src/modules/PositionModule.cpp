@@ -419,9 +419,7 @@ int32_t PositionModule::runOnce()
     if (lastGpsSend == 0 || msSinceLastSend >= intervalMs) {
         if (nodeDB->hasValidPosition(node)) {
             lastGpsSend = now;
-
-            lastGpsLatitude = node->position.latitude_i;
-            lastGpsLongitude = node->position.longitude_i;
+            setLastSentPosition(node->position);
 
             sendOurPosition();
             if (config.device.role == meshtastic_Config_DeviceConfig_Role_LOST_AND_FOUND) {
@@ -448,8 +446,7 @@ int32_t PositionModule::runOnce()
                           msSinceLastSend, minimumTimeThreshold);
 
                 // Set the current coords as our last ones, after we've compared distance with current and decided to send
-                lastGpsLatitude = node->position.latitude_i;
-                lastGpsLongitude = node->position.longitude_i;
+                setLastSentPosition(node->position);
             }
         }
     }
@@ -472,15 +469,42 @@ void PositionModule::sendLostAndFoundText()
     delete[] message;
 }
 
+void PositionModule::setLastSentPosition(const meshtastic_PositionLite &position)
+{
+    lastGpsLatitude = position.latitude_i;
+    lastGpsLongitude = position.longitude_i;
+
+    // Only predict our track if the packets we send carry it, otherwise receivers can't follow the prediction
+    uint32_t velocityFlags =
+        meshtastic_Config_PositionConfig_PositionFlags_HEADING | meshtastic_Config_PositionConfig_PositionFlags_SPEED;
+    if ((config.position.position_flags & velocityFlags) == velocityFlags) {
+        lastGpsSpeed = localPosition.ground_speed;
+        lastGpsTrack = localPosition.ground_track;
+    } else {
+        lastGpsSpeed = 0;
+        lastGpsTrack = 0;
+    }
+}
+
 struct SmartPosition PositionModule::getDistanceTraveledSinceLastSend(meshtastic_PositionLite currentPosition)
 {
     // The minimum distance to travel before we are able to send a new position packet.
     const uint32_t distanceTravelThreshold =
         Default::getConfiguredOrDefault(config.position.broadcast_smart_minimum_distance, 100);
 
+    // Dead reckon from the position and velocity we last sent, so moving steadily in a straight line doesn't count as
+    // travel: anyone who heard us can work out where we are now.  Over these distances the earth is flat enough.
+    double predictedLat = lastGpsLatitude * 1e-7, predictedLon = lastGpsLongitude * 1e-7;
+    if (lastGpsSpeed) {
+        double range = GeoCoord::rangeMetersToRadians(lastGpsSpeed / 3.6 * ((millis() - lastGpsSend) / 1000.0));
+        double track = GeoCoord::toRadians(lastGpsTrack * 1e-5);
+        predictedLat += GeoCoord::toDegrees(range * cos(track));
+        predictedLon += GeoCoord::toDegrees(range * sin(track) / cos(GeoCoord::toRadians(predictedLat)));
+    }
+
     // Determine the distance in meters between two points on the globe
-    float distanceTraveledSinceLastSend = GeoCoord::latLongToMeter(
-        lastGpsLatitude * 1e-7, lastGpsLongitude * 1e-7, currentPosition.latitude_i * 1e-7, currentPosition.longitude_i * 1e-7);
+    float distanceTraveledSinceLastSend = GeoCoord::latLongToMeter(predictedLat, predictedLon, currentPosition.latitude_i * 1e-7,
+                                                                   currentPosition.longitude_i * 1e-7);
 
     return SmartPosition{.distanceTraveled = abs(distanceTraveledSinceLastSend),
                          .distanceThreshold = distanceTravelThreshold,
@@ -505,8 +529,7 @@ void PositionModule::handleNewPosition()
                       minimumTimeThreshold);
 
             // Set the current coords as our last ones, after we've compared distance with current and decided to send
-            lastGpsLatitude = node->position.latitude_i;
-            lastGpsLongitude = node->position.longitude_i;
+            setLastSentPosition(node->position);
         }
     }
 }
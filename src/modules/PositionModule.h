@@ -21,6 +21,10 @@ class PositionModule : public ProtobufModule<meshtastic_Position>, private concu
     int32_t lastGpsLatitude = 0;
     int32_t lastGpsLongitude = 0;
 
+    // The velocity we sent along with it, which receivers can dead reckon from (0 if we didn't send one)
+    uint32_t lastGpsSpeed = 0; // km/h
+    uint32_t lastGpsTrack = 0; // degrees * 1e-5
+
     /// We force a rebroadcast if the radio settings change
     uint32_t currentGeneration = 0;
 
@@ -57,6 +61,7 @@ class PositionModule : public ProtobufModule<meshtastic_Position>, private concu
   private:
     meshtastic_MeshPacket *allocPositionPacket();
     struct SmartPosition getDistanceTraveledSinceLastSend(meshtastic_PositionLite currentPosition);
+    void setLastSentPosition(const meshtastic_PositionLite &position);
     meshtastic_MeshPacket *allocAtakPli();
     void trySetRtc(meshtastic_Position p, bool isLocal, bool forceUpdate = false);
     uint32_t precision;
@@ -4,9 +4,12 @@
 #include "NodeDB.h"
 #include "PowerMon.h"
 #include "RTC.h"
+#include "RadioLibInterface.h"
 #include "Router.h"
 #include "configuration.h"
+#include "gps/GPS.h"
 #include "main.h"
+#include "power.h"
 #include "sleep.h"
 #include "target_specific.h"
 #include <Throttle.h>
@@ -62,12 +65,22 @@ int32_t PowerStressModule::runOnce()
 
     auto &p = currentMessage;
 
+    if (benchmarkStep >= 0)
+        return runBenchmark();
+    if (!isRunningCommand && p.cmd == POWERSTRESS_OPCODE_BENCHMARK) {
+        startBenchmark(p.num_seconds);
+        p.cmd = meshtastic_PowerStressMessage_Opcode_UNSET;
+        p.num_seconds = 0;
+        return runBenchmark();
+    }
+
     if (isRunningCommand) {
         // Done with the previous command - our sleep must have finished
         p.cmd = meshtastic_PowerStressMessage_Opcode_UNSET;
         p.num_seconds = 0;
         isRunningCommand = false;
         LOG_INFO("S:PS:%u", p.cmd);
+        powerMon->mark(p.cmd); // And in the binary trace, so analyzer captures line up with both
     } else {
         if (p.cmd != meshtastic_PowerStressMessage_Opcode_UNSET) {
             sleep_msec = (int32_t)(p.num_seconds * 1000);
@@ -75,6 +88,7 @@ int32_t PowerStressModule::runOnce()
             LOG_INFO(
                 "S:PS:%u",
                 p.cmd); // Emit a structured log saying we are starting a powerstress state (to make it easier to parse later)
+            powerMon->mark(p.cmd);
 
             switch (p.cmd) {
             case meshtastic_PowerStressMessage_Opcode_LED_ON:
@@ -131,4 +145,209 @@ int32_t PowerStressModule::runOnce()
         }
     }
     return sleep_msec;
-}
\ No newline at end of file
+}
+
+// The supply current and voltage, from whichever INA sensor we found
+static bool readSupply(int16_t &currentMa, uint16_t &voltageMv)
+{
+#if HAS_TELEMETRY && !MESHTASTIC_EXCLUDE_ENVIRONMENTAL_SENSOR
+    if (ina219Sensor.hasSensor()) {
+        currentMa = ina219Sensor.getCurrentMa();
+        voltageMv = ina219Sensor.getBusVoltageMv();
+        return true;
+    }
+    if (ina226Sensor.hasSensor()) {
+        currentMa = ina226Sensor.getCurrentMa();
+        voltageMv = ina226Sensor.getBusVoltageMv();
+        return true;
+    }
+    if (ina3221Sensor.hasSensor()) {
+        currentMa = ina3221Sensor.getCurrentMa();
+        voltageMv = ina3221Sensor.getBusVoltageMv();
+        return true;
+    }
+#endif
+    return false;
+}
+
+static const char *benchmarkStepName(meshtastic_PowerStressMessage_Opcode op)
+{
+    switch (op) {
+    case meshtastic_PowerStressMessage_Opcode_LORA_RX:
+        return "rx_idle";
+    case meshtastic_PowerStressMessage_Opcode_LORA_TX:
+        return "tx";
+    case meshtastic_PowerStressMessage_Opcode_CPU_IDLE:
+        return "light_sleep";
+    case meshtastic_PowerStressMessage_Opcode_GPS_ON:
+        return "gps";
+    case meshtastic_PowerStressMessage_Opcode_SCREEN_ON:
+        return "screen";
+    default:
+        return "?";
+    }
+}
+
+static const int8_t benchmarkTxPowers[] = POWERSTRESS_BENCHMARK_TX_POWERS;
+
+// The benchmark sequence: RX idle, TX at each power, light sleep, GPS on, screen on. False past the end
+bool PowerStressModule::getBenchmarkStep(int index, BenchmarkStep &step)
+{
+    const int numTx = sizeof(benchmarkTxPowers) / sizeof(benchmarkTxPowers[0]);
+    step.txPower = 0;
+    if (index == 0)
+        step.op = meshtastic_PowerStressMessage_Opcode_LORA_RX;
+    else if (index <= numTx) {
+        step.op = meshtastic_PowerStressMessage_Opcode_LORA_TX;
+        step.txPower = benchmarkTxPowers[index - 1];
+    } else if (index == numTx + 1)
+        step.op = meshtastic_PowerStressMessage_Opcode_CPU_IDLE;
+    else if (index == numTx + 2)
+        step.op = meshtastic_PowerStressMessage_Opcode_GPS_ON;
+    else if (index == numTx + 3)
+        step.op = meshtastic_PowerStressMessage_Opcode_SCREEN_ON;
+    else
+        return false;
+    return true;
+}
+
+void PowerStressModule::startBenchmark(uint32_t stepSecs)
+{
+    benchmarkStepMs = (stepSecs ? stepSecs : POWERSTRESS_BENCHMARK_STEP_SECS) * 1000;
+    savedTxPower = config.lora.tx_power;
+    lastTxPower = INT8_MIN;
+    benchmarkStep = 0;
+    stepStarted = 0;
+    powerMon->force_enabled = true;
+    if (screen)
+        screen->setOn(false); // Only the screen step has it on
+    LOG_INFO("PowerStress benchmark, %us per step", benchmarkStepMs / 1000);
+}
+
+// Step through the sequence, sampling the supply throughout each step and reporting it at the end
+int32_t PowerStressModule::runBenchmark()
+{
+    BenchmarkStep step;
+    if (!getBenchmarkStep(benchmarkStep, step)) {
+        benchmarkStep = -1;
+        powerMon->mark(POWERSTRESS_OPCODE_BENCHMARK);
+        LOG_INFO("PowerStress benchmark done");
+        return 10;
+    }
+
+    if (!stepStarted) {
+        stepStarted = millis();
+        samples = 0;
+        sumCurrentMa = 0;
+        sumVoltageMv = 0;
+        LOG_INFO("S:PS:%u", step.op);
+        powerMon->mark(step.op | ((uint8_t)step.txPower << 8)); // TX power too, so steps can be told apart
+        if (!beginBenchmarkStep(step)) {
+            benchmarkStep++;
+            stepStarted = 0;
+            return 0;
+        }
+    }
+
+    int16_t currentMa;
+    uint16_t voltageMv;
+    if (readSupply(currentMa, voltageMv)) {
+        samples++;
+        sumCurrentMa += currentMa;
+        sumVoltageMv += voltageMv;
+    }
+
+    if (!Throttle::isWithinTimespanMs(stepStarted, benchmarkStepMs)) {
+        endBenchmarkStep(step);
+        benchmarkStep++;
+        stepStarted = 0;
+        return 0;
+    }
+
+    // Keep the transmitter as busy as the channel access rules let it be
+    if (step.op == meshtastic_PowerStressMessage_Opcode_LORA_TX && RadioLibInterface::instance &&
+        RadioLibInterface::instance->canSleep()) {
+        meshtastic_MeshPacket *p = allocDataPacket();
+        p->to = NODENUM_BROADCAST;
+        p->hop_limit = 0;
+        p->priority = meshtastic_MeshPacket_Priority_BACKGROUND;
+        p->decoded.portnum = meshtastic_PortNum_PRIVATE_APP; // Nobody else acts on it
+        p->decoded.payload.size = sizeof(p->decoded.payload.bytes) - 16;
+        memset(p->decoded.payload.bytes, 0, p->decoded.payload.size);
+        service->sendToMesh(p);
+    }
+
+    return POWERSTRESS_BENCHMARK_SAMPLE_MS;
+}
+
+bool PowerStressModule::beginBenchmarkStep(const BenchmarkStep &step)
+{
+    switch (step.op) {
+    case meshtastic_PowerStressMessage_Opcode_LORA_TX:
+        if (!RadioLibInterface::instance)
+            return false;
+        config.lora.tx_power = step.txPower;
+        RadioLibInterface::instance->reconfigure(); // Clamps tx_power to what the region allows
+        if (config.lora.tx_power == lastTxPower) {
+            config.lora.tx_power = savedTxPower;
+            RadioLibInterface::instance->reconfigure();
+            return false;
+        }
+        lastTxPower = config.lora.tx_power;
+        return true;
+    case meshtastic_PowerStressMessage_Opcode_CPU_IDLE:
+#ifdef ARCH_ESP32
+        doLightSleep(benchmarkStepMs);
+#endif
+        return true; // Elsewhere the CPU already sleeps between interrupts
+#if !MESHTASTIC_EXCLUDE_GPS
+    case meshtastic_PowerStressMessage_Opcode_GPS_ON:
+        if (!gps)
+            return false;
+        gps->setPowerState(GPS_ACTIVE);
+        return true;
+#endif
+    case meshtastic_PowerStressMessage_Opcode_SCREEN_ON:
+        if (!screen)
+            return false;
+        screen->setOn(true);
+        return true;
+    default:
+        return true;
+    }
+}
+
+// Undo the step, and report it as "S:PB:name,dBm,ms,samples,mA,mV,uAh,mJ"
+// Without a supply sensor only the timing is reported; the analyzer's capture lines up with the trace markers instead
+void PowerStressModule::endBenchmarkStep(const BenchmarkStep &step)
+{
+    switch (step.op) {
+    case meshtastic_PowerStressMessage_Opcode_LORA_TX:
+        config.lora.tx_power = savedTxPower;
+        RadioLibInterface::instance->reconfigure();
+        break;
+#if !MESHTASTIC_EXCLUDE_GPS
+    case meshtastic_PowerStressMessage_Opcode_GPS_ON:
+        gps->setPowerState(config.position.gps_mode == meshtastic_Config_PositionConfig_GpsMode_ENABLED ? GPS_IDLE : GPS_OFF);
+        break;
+#endif
+    case meshtastic_PowerStressMessage_Opcode_SCREEN_ON:
+        screen->setOn(false);
+        break;
+    default:
+        break;
+    }
+
+    uint32_t ms = millis() - stepStarted;
+    int txPower = step.op == meshtastic_PowerStressMessage_Opcode_LORA_TX ? lastTxPower : 0;
+    if (!samples) {
+        LOG_INFO("S:PB:%s,%d,%u,0", benchmarkStepName(step.op), txPower, ms);
+        return;
+    }
+    int32_t currentMa = sumCurrentMa / (int32_t)samples;
+    uint32_t voltageMv = sumVoltageMv / samples;
+    int32_t chargeUah = (int64_t)currentMa * ms / 3600;
+    int32_t energyMj = (int64_t)currentMa * voltageMv * ms / 1000000;
+    LOG_INFO("S:PB:%s,%d,%u,%u,%d,%u,%d,%d", benchmarkStepName(step.op), txPower, ms, samples, currentMa, voltageMv, chargeUah,
+             energyMj);
+}
@@ -3,6 +3,16 @@
 #include "concurrency/OSThread.h"
 #include "mesh/generated/meshtastic/powermon.pb.h"
 
+// Run the whole benchmark sequence, num_seconds for each step (POWERSTRESS_BENCHMARK_STEP_SECS if 0).  Not in the protobuf
+// enum yet, send it as a raw cmd value
+#define POWERSTRESS_OPCODE_BENCHMARK 240
+#ifndef POWERSTRESS_BENCHMARK_STEP_SECS
+#define POWERSTRESS_BENCHMARK_STEP_SECS 30
+#endif
+#define POWERSTRESS_BENCHMARK_SAMPLE_MS 250 // How often the supply current is sampled during a step
+// dBm of each TX step, any above what the region and hardware allow are skipped
+#define POWERSTRESS_BENCHMARK_TX_POWERS {2, 10, 14, 17, 20, 22, 27, 30}
+
 /**
  * A module that provides easy low-level remote access to device hardware.
  */
@@ -11,6 +21,27 @@ class PowerStressModule : public ProtobufModule<meshtastic_PowerStressMessage>,
     meshtastic_PowerStressMessage currentMessage = meshtastic_PowerStressMessage_init_default;
     bool isRunningCommand = false;
 
+    // One step of the benchmark sequence: the state it holds the device in
+    struct BenchmarkStep {
+        meshtastic_PowerStressMessage_Opcode op;
+        int8_t txPower; // For LORA_TX
+    };
+
+    int benchmarkStep = -1; // -1 if the benchmark isn't running
+    uint32_t benchmarkStepMs = 0;
+    uint32_t stepStarted = 0;
+    int8_t savedTxPower = 0;
+    int8_t lastTxPower = 0; // The last TX step we actually ran, to skip levels the radio clamped to the same thing
+    uint32_t samples = 0;
+    int64_t sumCurrentMa = 0;
+    uint64_t sumVoltageMv = 0;
+
+    static bool getBenchmarkStep(int index, BenchmarkStep &step);
+    void startBenchmark(uint32_t stepSecs);
+    int32_t runBenchmark();
+    bool beginBenchmarkStep(const BenchmarkStep &step); // False to skip the step
+    void endBenchmarkStep(const BenchmarkStep &step);
+
   public:
     /** Constructor
      * name is for debugging output
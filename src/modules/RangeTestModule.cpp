@@ -206,47 +206,7 @@ bool RangeTestModuleRadio::appendFile(const meshtastic_MeshPacket &mp)
         LOG_DEBUG("gpsStatus->getDOP()          %d", gpsStatus->getDOP());
         LOG_DEBUG("-----------------------------------------");
     */
-    concurrency::LockGuard g(spiLock);
-    if (!FSBegin()) {
-        LOG_DEBUG("An Error has occurred while mounting the filesystem");
-        return 0;
-    }
-
-    if (FSCom.totalBytes() - FSCom.usedBytes() < 51200) {
-        LOG_DEBUG("Filesystem doesn't have enough free space. Aborting write");
-        return 0;
-    }
-
-    FSCom.mkdir("/static");
-
-    // If the file doesn't exist, write the header.
-    if (!FSCom.exists("/static/rangetest.csv")) {
-        //--------- Write to file
-        File fileToWrite = FSCom.open("/static/rangetest.csv", FILE_WRITE);
-
-        if (!fileToWrite) {
-            LOG_ERROR("There was an error opening the file for writing");
-            return 0;
-        }
-
-        // Print the CSV header
-        if (fileToWrite.println(
-                "time,from,sender name,sender lat,sender long,rx lat,rx long,rx elevation,rx snr,distance,hop limit,payload")) {
-            LOG_INFO("File was written");
-        } else {
-            LOG_ERROR("File write failed");
-        }
-        fileToWrite.flush();
-        fileToWrite.close();
-    }
-
-    //--------- Append content to file
-    File fileToAppend = FSCom.open("/static/rangetest.csv", FILE_APPEND);
-
-    if (!fileToAppend) {
-        LOG_ERROR("There was an error opening the file for appending");
-        return 0;
-    }
+    BufferedFileWriter &fileToAppend = csvFile;
 
     struct timeval tv;
     if (!gettimeofday(&tv, NULL)) {
@@ -293,8 +253,6 @@ bool RangeTestModuleRadio::appendFile(const meshtastic_MeshPacket &mp)
 
     // TODO: If quotes are found in the payload, it has to be escaped.
     fileToAppend.printf("\"%s\"\n", p.payload.bytes);
-    fileToAppend.flush();
-    fileToAppend.close();
 #endif
 
     return 1;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BufferedFileWriter.h"
 #include "SinglePortModule.h"
 #include "concurrency/OSThread.h"
 #include "configuration.h"
@@ -28,10 +29,20 @@ class RangeTestModuleRadio : public SinglePortModule
 {
     uint32_t lastRxID = 0;
 
+#ifdef ARCH_ESP32
+    // Rows are collected in RAM and written a buffer full at a time
+    BufferedFileWriter csvFile = BufferedFileWriter(
+        "/static/rangetest.csv",
+        "time,from,sender name,sender lat,sender long,rx lat,rx long,rx elevation,rx snr,distance,hop limit,payload");
+#endif
+
   public:
     RangeTestModuleRadio() : SinglePortModule("RangeTestModuleRadio", meshtastic_PortNum_RANGE_TEST_APP)
     {
         loopbackOk = true; // Allow locally generated messages to loop back to the client
+#ifdef ARCH_ESP32
+        csvFile.setMinFreeBytes(51200);
+#endif
     }
 
     /**
@@ -1,6 +1,7 @@
 #include "RoutingModule.h"
 #include "Default.h"
 #include "MeshService.h"
+#include "NextHopRouter.h"
 #include "NodeDB.h"
 #include "Router.h"
 #include "configuration.h"
@@ -34,7 +35,10 @@ bool RoutingModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, mesh
     // Note: we are careful not to send back packets that started with the phone back to the phone
     if ((isBroadcast(mp.to) || isToUs(&mp)) && (mp.from != 0)) {
         printPacket("Delivering rx packet", &mp);
-        service->handleFromRadio(&mp);
+        if (NextHopRouter::isMultiAck(&mp, r))
+            deliverMultiAck(mp, *r);
+        else
+            service->handleFromRadio(&mp);
     }
 
     return false; // Let others look at this message also if they want
@@ -56,6 +60,38 @@ void RoutingModule::sendAckNak(meshtastic_Routing_Error err, NodeNum to, PacketI
     router->sendLocal(p); // we sometimes send directly to the local node
 }
 
+void RoutingModule::sendMultiAck(NodeNum to, const PacketId *ids, size_t numIds, ChannelIndex chIndex, uint8_t hopLimit)
+{
+    meshtastic_Routing c = meshtastic_Routing_init_default;
+    c.which_variant = meshtastic_Routing_route_reply_tag;
+    for (size_t i = 1; i < numIds && c.route_reply.route_count < sizeof(c.route_reply.route) / sizeof(c.route_reply.route[0]);
+         i++)
+        c.route_reply.route[c.route_reply.route_count++] = ids[i];
+
+    auto p = allocAckNak(meshtastic_Routing_Error_NONE, to, ids[0], chIndex, hopLimit);
+    p->decoded.payload.size =
+        pb_encode_to_bytes(p->decoded.payload.bytes, sizeof(p->decoded.payload.bytes), &meshtastic_Routing_msg, &c);
+
+    router->sendLocal(p);
+}
+
+// Phone apps only know ACKs that carry an error_reason, and one request_id each
+void RoutingModule::deliverMultiAck(const meshtastic_MeshPacket &mp, const meshtastic_Routing &r)
+{
+    meshtastic_Routing ack = meshtastic_Routing_init_default;
+    ack.which_variant = meshtastic_Routing_error_reason_tag;
+    ack.error_reason = meshtastic_Routing_Error_NONE;
+
+    for (pb_size_t i = 0; i <= r.route_reply.route_count; i++) {
+        meshtastic_MeshPacket *p = packetPool.allocCopy(mp);
+        p->decoded.request_id = i ? r.route_reply.route[i - 1] : mp.decoded.request_id;
+        p->decoded.payload.size =
+            pb_encode_to_bytes(p->decoded.payload.bytes, sizeof(p->decoded.payload.bytes), &meshtastic_Routing_msg, &ack);
+        service->handleFromRadio(p);
+        packetPool.release(p);
+    }
+}
+
 uint8_t RoutingModule::getHopLimitForResponse(uint8_t hopStart, uint8_t hopLimit)
 {
     if (hopStart != 0) {
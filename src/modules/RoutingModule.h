@@ -18,6 +18,9 @@ class RoutingModule : public ProtobufModule<meshtastic_Routing>
     virtual void sendAckNak(meshtastic_Routing_Error err, NodeNum to, PacketId idFrom, ChannelIndex chIndex,
                             uint8_t hopLimit = 0);
 
+    /** Send one ACK for all numIds packets in ids, which to has to understand (see ReliableRouter) */
+    void sendMultiAck(NodeNum to, const PacketId *ids, size_t numIds, ChannelIndex chIndex, uint8_t hopLimit);
+
     // Given the hopStart and hopLimit upon reception of a request, return the hop limit to use for the response
     uint8_t getHopLimitForResponse(uint8_t hopStart, uint8_t hopLimit);
 
@@ -36,6 +39,11 @@ class RoutingModule : public ProtobufModule<meshtastic_Routing>
 
     /// Override wantPacket to say we want to see all packets, not just those for our port number
     virtual bool wantPacket(const meshtastic_MeshPacket *p) override { return true; }
+    virtual int getDispatchPort() const override { return MESHMODULE_ANY_PORT; }
+
+  private:
+    /** Hand the phone a plain ACK for every packet a multi-ACK acks */
+    void deliverMultiAck(const meshtastic_MeshPacket &mp, const meshtastic_Routing &r);
 };
 
 extern RoutingModule *routingModule;
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "SerialBridge.h"
+
+// Further behind than this is a sender that rebooted and started counting again, not a late duplicate
+#define SERIAL_BRIDGE_RESTART_DISTANCE 256
+
+void SerialBridgeReassembler::receive(NodeNum from, const uint8_t *payload, size_t len, uint32_t nowMs)
+{
+    if (len < SERIAL_BRIDGE_HEADER_LEN || len > SERIAL_BRIDGE_HEADER_LEN + sizeof(held[0].bytes))
+        return;
+    uint16_t seq = payload[0] | (payload[1] << 8);
+    payload += SERIAL_BRIDGE_HEADER_LEN;
+    len -= SERIAL_BRIDGE_HEADER_LEN;
+
+    if (!synced || from != source) {
+        // Whatever another sender left waiting goes out first, it won't be completed now
+        while (numHeld)
+            skipGap();
+        source = from;
+        expected = seq;
+        synced = true;
+    }
+
+    int16_t ahead = (int16_t)(seq - expected);
+    if (ahead < 0 && ahead > -SERIAL_BRIDGE_RESTART_DISTANCE) {
+        duplicates++; // Retransmitted after we had it, or relayed to us twice
+        return;
+    }
+    if (ahead < 0 || ahead >= SERIAL_BRIDGE_REORDER) {
+        // Too far ahead to hold back, whatever is missing before it is not coming in time
+        LOG_WARN("Serial bridge: expected seq %u from 0x%x, got %u", expected, from, seq);
+        while (numHeld)
+            skipGap();
+        ahead = (int16_t)(seq - expected);
+        if (ahead > 0)
+            lost += ahead;
+        expected = seq;
+        ahead = 0;
+    }
+
+    if (ahead == 0) {
+        write(payload, len);
+        expected++;
+        drain();
+    } else {
+        Held &h = held[seq % SERIAL_BRIDGE_REORDER];
+        if (h.used) {
+            duplicates++;
+            return;
+        }
+        if (!numHeld)
+            heldSinceMs = nowMs;
+        h.used = true;
+        h.seq = seq;
+        h.len = len;
+        memcpy(h.bytes, payload, len);
+        numHeld++;
+    }
+}
+
+void SerialBridgeReassembler::tick(uint32_t nowMs)
+{
+    while (numHeld && nowMs - heldSinceMs >= SERIAL_BRIDGE_GAP_MS) {
+        LOG_WARN("Serial bridge: gave up waiting for seq %u from 0x%x", expected, source);
+        skipGap();
+        heldSinceMs = nowMs; // The next gap, if any, gets its own time to fill
+    }
+}
+
+// Write out the held payloads that now follow on from what was written
+void SerialBridgeReassembler::drain()
+{
+    for (;;) {
+        Held &h = held[expected % SERIAL_BRIDGE_REORDER];
+        if (!h.used || h.seq != expected)
+            return;
+        write(h.bytes, h.len);
+        h.used = false;
+        numHeld--;
+        expected++;
+    }
+}
+
+// Count the payloads missing before the oldest held one as lost and carry on from it
+void SerialBridgeReassembler::skipGap()
+{
+    uint16_t nearest = SERIAL_BRIDGE_REORDER;
+    for (uint8_t i = 0; i < SERIAL_BRIDGE_REORDER; i++) {
+        uint16_t ahead = held[i].seq - expected;
+        if (held[i].used && ahead < nearest)
+            nearest = ahead;
+    }
+    if (nearest == SERIAL_BRIDGE_REORDER)
+        return;
+    lost += nearest;
+    expected += nearest;
+    drain();
+}
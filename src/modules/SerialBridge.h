@@ -0,0 +1,69 @@
+#pragma once
+
+#include "MeshTypes.h"
+#include "configuration.h"
+#include <functional>
+
+/**
+ * Framing for the serial module's bridge mode (SERIAL_BRIDGE): a sensor gateway streams whatever arrives on its UART into
+ * payloads filled to the brim, each led by a 16-bit sequence number, and the far side writes them out to its own UART in
+ * order.  Packets that overtake each other on the mesh are held back until the ones before them arrive, and a packet that
+ * never does is given up on, so one loss costs one payload of the stream rather than stalling it.
+ */
+
+// Sequence number, little endian, in front of every bridged payload
+#define SERIAL_BRIDGE_HEADER_LEN 2
+
+// Payloads that may arrive ahead of a missing one and still be written out in order
+#ifndef SERIAL_BRIDGE_REORDER
+#define SERIAL_BRIDGE_REORDER 4
+#endif
+
+// How long payloads are held back waiting for a missing one, before it is counted as lost
+#ifndef SERIAL_BRIDGE_GAP_MS
+#define SERIAL_BRIDGE_GAP_MS (15 * 1000)
+#endif
+
+class SerialBridgeReassembler
+{
+  public:
+    typedef std::function<void(const uint8_t *bytes, size_t len)> Writer;
+
+    explicit SerialBridgeReassembler(Writer write) : write(write) {}
+
+    /// Put the header for seq in front of a payload
+    static void writeHeader(uint8_t *payload, uint16_t seq)
+    {
+        payload[0] = seq & 0xff;
+        payload[1] = seq >> 8;
+    }
+
+    /// A bridged payload arrived from the mesh, writes out whatever is now in order
+    void receive(NodeNum from, const uint8_t *payload, size_t len, uint32_t nowMs);
+
+    /// Give up on a missing payload once the ones after it have waited SERIAL_BRIDGE_GAP_MS
+    void tick(uint32_t nowMs);
+
+    uint32_t getLost() const { return lost; }
+    uint32_t getDuplicates() const { return duplicates; }
+
+  private:
+    struct Held {
+        bool used;
+        uint16_t seq;
+        uint8_t len;
+        uint8_t bytes[meshtastic_Constants_DATA_PAYLOAD_LEN - SERIAL_BRIDGE_HEADER_LEN];
+    };
+
+    Writer write;
+    NodeNum source = 0;
+    bool synced = false;
+    uint16_t expected = 0;
+    uint8_t numHeld = 0;
+    uint32_t heldSinceMs = 0;
+    uint32_t lost = 0, duplicates = 0;
+    Held held[SERIAL_BRIDGE_REORDER] = {};
+
+    void drain();
+    void skipGap();
+};
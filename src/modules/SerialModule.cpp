@@ -5,6 +5,7 @@
 #include "NodeDB.h"
 #include "RTC.h"
 #include "Router.h"
+#include "WaypointModule.h"
 #include "configuration.h"
 #include <Arduino.h>
 #include <Throttle.h>
@@ -54,6 +55,8 @@
 
 #define RX_BUFFER 256
 #define TIMEOUT 250
+// With the UART waking us when bytes arrive, only look at the port this often otherwise
+#define SERIAL_EVENT_INTERVAL 1000
 #define BAUD 38400
 #define ACK 1
 
@@ -99,6 +102,12 @@ bool SerialModule::isValidConfig(const meshtastic_ModuleConfig_SerialConfig &con
     return true;
 }
 
+bool SerialModule::isBridging()
+{
+    return SERIAL_BRIDGE && IS_ONE_OF(moduleConfig.serial.mode, meshtastic_ModuleConfig_SerialConfig_Serial_Mode_DEFAULT,
+                                      meshtastic_ModuleConfig_SerialConfig_Serial_Mode_SIMPLE);
+}
+
 SerialModuleRadio::SerialModuleRadio() : MeshModule("SerialModuleRadio")
 {
     switch (moduleConfig.serial.mode) {
@@ -113,6 +122,8 @@ SerialModuleRadio::SerialModuleRadio() : MeshModule("SerialModuleRadio")
         ourPortNum = meshtastic_PortNum_SERIAL_APP;
         // restrict to the serial channel for rx
         boundChannel = Channels::serialChannel;
+        if (SerialModule::isBridging())
+            bridge = new SerialBridgeReassembler([](const uint8_t *bytes, size_t len) { serialPrint->write(bytes, len); });
         break;
     }
 }
@@ -169,6 +180,13 @@ int32_t SerialModule::runOnce()
             if (moduleConfig.serial.rxd && moduleConfig.serial.txd) {
                 Serial1.setRxBufferSize(RX_BUFFER);
                 Serial1.begin(baud, SERIAL_8N1, moduleConfig.serial.rxd, moduleConfig.serial.txd);
+                Serial1.onReceive(
+                    []() {
+                        if (serialModule)
+                            serialModule->onSerialData();
+                    },
+                    false);
+                serialEvents = true;
             } else {
                 Serial.begin(baud);
                 Serial.setTimeout(moduleConfig.serial.timeout > 0 ? moduleConfig.serial.timeout : TIMEOUT);
@@ -179,6 +197,13 @@ int32_t SerialModule::runOnce()
             if (moduleConfig.serial.rxd && moduleConfig.serial.txd) {
                 Serial2.setRxBufferSize(RX_BUFFER);
                 Serial2.begin(baud, SERIAL_8N1, moduleConfig.serial.rxd, moduleConfig.serial.txd);
+                Serial2.onReceive(
+                    []() {
+                        if (serialModule)
+                            serialModule->onSerialData();
+                    },
+                    false);
+                serialEvents = true;
             } else {
                 Serial.begin(baud);
                 Serial.setTimeout(moduleConfig.serial.timeout > 0 ? moduleConfig.serial.timeout : TIMEOUT);
@@ -237,6 +262,18 @@ int32_t SerialModule::runOnce()
                         }
                         tempNodeInfo = nodeDB->readNextMeshNode(readIndex);
                     }
+#if !MESHTASTIC_EXCLUDE_WAYPOINT
+                    // And the waypoints shared on the mesh, under their own names
+                    if (waypointModule) {
+                        waypointModule->store.purge(getTime());
+                        waypointModule->store.forEach([this](const WaypointStore::Entry &e) {
+                            if (e.waypoint.has_latitude_i && e.waypoint.has_longitude_i) {
+                                printWPL(outbuf, sizeof(outbuf), e.waypoint, true);
+                                serialPrint->printf("%s", outbuf);
+                            }
+                        });
+                    }
+#endif
                 }
             }
 
@@ -256,15 +293,7 @@ int32_t SerialModule::runOnce()
             }
 #endif
             else {
-#if defined(CONFIG_IDF_TARGET_ESP32C6)
-                while (Serial1.available()) {
-                    serialPayloadSize = Serial1.readBytes(serialBytes, meshtastic_Constants_DATA_PAYLOAD_LEN);
-#else
-                while (Serial2.available()) {
-                    serialPayloadSize = Serial2.readBytes(serialBytes, meshtastic_Constants_DATA_PAYLOAD_LEN);
-#endif
-                    serialModuleRadio->sendPayload();
-                }
+                return readRawSerial();
             }
 #endif
         }
@@ -274,6 +303,60 @@ int32_t SerialModule::runOnce()
     }
 }
 
+#if !defined(TTGO_T_ECHO) && !defined(T_ECHO_LITE) && !defined(CANARYONE) && !defined(MESHLINK) &&                               \
+    !defined(ELECROW_ThinkNode_M1) && !defined(ELECROW_ThinkNode_M5)
+/**
+ * Collects what arrives on the port into serialBytes without waiting for more, and sends it on once it fills a payload or
+ * the line has been quiet for the configured timeout.  Stream::readBytes() used to do the waiting, with the main loop blocked.
+ *
+ * @return When to run again
+ */
+int32_t SerialModule::readRawSerial()
+{
+#if defined(CONFIG_IDF_TARGET_ESP32C6)
+    Stream &port = Serial1;
+#else
+    Stream &port = Serial2;
+#endif
+    const size_t start = isBridging() ? SERIAL_BRIDGE_HEADER_LEN : 0;
+    const uint32_t idleMs = moduleConfig.serial.timeout > 0 ? moduleConfig.serial.timeout : TIMEOUT;
+    if (serialPayloadSize < start)
+        serialPayloadSize = start;
+
+    int avail;
+    while ((avail = port.available()) > 0 && serialPayloadSize < meshtastic_Constants_DATA_PAYLOAD_LEN) {
+        size_t room = meshtastic_Constants_DATA_PAYLOAD_LEN - serialPayloadSize;
+        serialPayloadSize += port.readBytes(serialBytes + serialPayloadSize, (size_t)avail < room ? avail : room);
+        lastByteMs = millis();
+    }
+
+    serialModuleRadio->tickBridge();
+    if (serialPayloadSize > start &&
+        (serialPayloadSize == meshtastic_Constants_DATA_PAYLOAD_LEN || !Throttle::isWithinTimespanMs(lastByteMs, idleMs))) {
+        serialModuleRadio->sendPayload();
+        serialPayloadSize = start;
+        if (port.available())
+            return 0; // The rest of the burst
+    }
+
+    if (!serialEvents)
+        return 10;
+    if (serialPayloadSize > start) {
+        uint32_t quietMs = millis() - lastByteMs;
+        return quietMs < idleMs ? idleMs - quietMs : 0;
+    }
+    return SERIAL_EVENT_INTERVAL;
+}
+#endif
+
+#ifdef ARCH_ESP32
+void SerialModule::onSerialData()
+{
+    setInterval(0);
+    concurrency::mainDelay.interrupt();
+}
+#endif
+
 /**
  * Sends telemetry packet over the mesh network.
  *
@@ -330,6 +413,8 @@ void SerialModuleRadio::sendPayload(NodeNum dest, bool wantReplies)
 
     p->want_ack = ACK;
 
+    if (SerialModule::isBridging())
+        SerialBridgeReassembler::writeHeader((uint8_t *)serialBytes, bridgeSeq++);
     p->decoded.payload.size = serialPayloadSize; // You must specify how many bytes are in the reply
     memcpy(p->decoded.payload.bytes, serialBytes, p->decoded.payload.size);
 
@@ -375,7 +460,10 @@ ProcessMessage SerialModuleRadio::handleReceived(const meshtastic_MeshPacket &mp
 
             if (moduleConfig.serial.mode == meshtastic_ModuleConfig_SerialConfig_Serial_Mode_DEFAULT ||
                 moduleConfig.serial.mode == meshtastic_ModuleConfig_SerialConfig_Serial_Mode_SIMPLE) {
-                serialPrint->write(p.payload.bytes, p.payload.size);
+                if (bridge)
+                    bridge->receive(getFrom(&mp), p.payload.bytes, p.payload.size, millis());
+                else
+                    serialPrint->write(p.payload.bytes, p.payload.size);
             } else if (moduleConfig.serial.mode == meshtastic_ModuleConfig_SerialConfig_Serial_Mode_TEXTMSG) {
                 meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(getFrom(&mp));
                 const char *sender = (node && node->has_user) ? node->user.short_name : "???";
@@ -2,12 +2,19 @@
 
 #include "MeshModule.h"
 #include "Router.h"
+#include "SerialBridge.h"
 #include "SinglePortModule.h"
 #include "concurrency/OSThread.h"
 #include "configuration.h"
 #include <Arduino.h>
 #include <functional>
 
+// In the DEFAULT and SIMPLE modes, frame each payload with a sequence number that the far side puts back in order, see
+// SerialBridge.h.  Both ends of the bridge must be built with it
+#ifndef SERIAL_BRIDGE
+#define SERIAL_BRIDGE 0
+#endif
+
 #if (defined(ARCH_ESP32) || defined(ARCH_NRF52) || defined(ARCH_RP2040)) && !defined(CONFIG_IDF_TARGET_ESP32S2) &&               \
     !defined(CONFIG_IDF_TARGET_ESP32C3)
 
@@ -22,6 +29,14 @@ class SerialModule : public StreamAPI, private concurrency::OSThread
 
     static bool isValidConfig(const meshtastic_ModuleConfig_SerialConfig &config);
 
+    /// Is the raw serial stream being bridged, rather than sent one read at a time
+    static bool isBridging();
+
+#ifdef ARCH_ESP32
+    /// From the UART's event task, when bytes arrived or the line went idle after a burst
+    void onSerialData();
+#endif
+
   protected:
     virtual int32_t runOnce() override;
 
@@ -32,6 +47,10 @@ class SerialModule : public StreamAPI, private concurrency::OSThread
     uint32_t getBaudRate();
     void sendTelemetry(meshtastic_Telemetry m);
     void processWXSerial();
+    int32_t readRawSerial();
+
+    uint32_t lastByteMs = 0;
+    bool serialEvents = false; // The UART wakes us when bytes arrive, see onSerialData()
 };
 
 extern SerialModule *serialModule;
@@ -44,6 +63,8 @@ class SerialModuleRadio : public MeshModule
 {
     uint32_t lastRxID = 0;
     char outbuf[90] = "";
+    uint16_t bridgeSeq = 0;
+    SerialBridgeReassembler *bridge = NULL;
 
   public:
     SerialModuleRadio();
@@ -53,6 +74,13 @@ class SerialModuleRadio : public MeshModule
      */
     void sendPayload(NodeNum dest = NODENUM_BROADCAST, bool wantReplies = false);
 
+    /// Give up on bridged payloads that are not coming
+    void tickBridge()
+    {
+        if (bridge)
+            bridge->tick(millis());
+    }
+
   protected:
     virtual meshtastic_MeshPacket *allocReply() override;
 
@@ -66,6 +94,7 @@ class SerialModuleRadio : public MeshModule
     meshtastic_PortNum ourPortNum;
 
     virtual bool wantPacket(const meshtastic_MeshPacket *p) override { return p->decoded.portnum == ourPortNum; }
+    virtual int getDispatchPort() const override { return ourPortNum; }
 
     meshtastic_MeshPacket *allocDataPacket()
     {
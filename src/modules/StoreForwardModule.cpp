@@ -13,36 +13,41 @@
  * @date [Insert Date]
  */
 #include "StoreForwardModule.h"
+#include "FSCommon.h"
 #include "MeshService.h"
 #include "NodeDB.h"
 #include "RTC.h"
 #include "Router.h"
+#include "SPILock.h"
 #include "Throttle.h"
 #include "airtime.h"
 #include "configuration.h"
 #include "memGet.h"
 #include "mesh-pb-constants.h"
+#include "mesh/compression/unishox2.h"
 #include "mesh/generated/meshtastic/storeforward.pb.h"
 #include "modules/ModuleDev.h"
 #include <Arduino.h>
+#include <algorithm>
 #include <iterator>
 #include <map>
 
 StoreForwardModule *storeForwardModule;
 
+#define NO_RECORD UINT32_MAX // End of a history chain
+
+static_assert(meshtastic_Constants_DATA_PAYLOAD_LEN <= UINT8_MAX, "PacketHistoryStruct keeps payload sizes in a uint8_t");
+#if SF_SPILL_TO_FS
+static_assert(SF_SPILL_SEGMENT_BYTES >= meshtastic_Constants_DATA_PAYLOAD_LEN, "A payload must fit in one segment");
+#endif
+
 int32_t StoreForwardModule::runOnce()
 {
-#if defined(ARCH_ESP32) || defined(ARCH_PORTDUINO)
+#if SF_HAS_STORE
     if (moduleConfig.store_forward.enabled && is_server) {
         // Send out the message queue.
-        if (this->busy) {
-            // Only send packets if the channel is less than 25% utilized and until historyReturnMax
-            if (airTime->isTxAllowedChannelUtil(true) && this->requestCount < this->historyReturnMax) {
-                if (!storeForwardModule->sendPayload(this->busyTo, this->last_time)) {
-                    this->requestCount = 0;
-                    this->busy = false;
-                }
-            }
+        if (this->numReplays) {
+            return runReplays();
         } else if (this->heartbeat && (!Throttle::isWithinTimespanMs(lastHeartbeat, heartbeatInterval * 1000)) &&
                    airTime->isTxAllowedChannelUtil(true)) {
             lastHeartbeat = millis();
@@ -76,20 +81,123 @@ void StoreForwardModule::populatePSRAM()
     /* Use a maximum of 3/4 the available PSRAM unless otherwise specified.
         Note: This needs to be done after every thing that would use PSRAM
     */
-    uint32_t numberOfPackets =
-        (this->records ? this->records : (((memGet.getFreePsram() / 4) * 3) / sizeof(PacketHistoryStruct)));
+    const uint32_t bytesPerRecord = sizeof(PacketHistoryStruct) + sizeof(*this->nextSameTo) + SF_PAYLOAD_BYTES_PER_RECORD;
+    uint32_t numberOfPackets = (this->records ? this->records : (((memGet.getFreePsram() / 4) * 3) / bytesPerRecord));
     this->records = numberOfPackets;
+    this->payloadArenaSize = std::max<uint32_t>(numberOfPackets * SF_PAYLOAD_BYTES_PER_RECORD, meshtastic_Constants_DATA_PAYLOAD_LEN);
+    this->payloadCapacity = this->payloadArenaSize;
 #if defined(ARCH_ESP32)
     this->packetHistory = static_cast<PacketHistoryStruct *>(ps_calloc(numberOfPackets, sizeof(PacketHistoryStruct)));
+    this->nextSameTo = static_cast<uint32_t *>(ps_calloc(numberOfPackets, sizeof(*this->nextSameTo)));
+    this->payloadArena = static_cast<uint8_t *>(ps_calloc(this->payloadArenaSize, 1));
 #elif defined(ARCH_PORTDUINO)
     this->packetHistory = static_cast<PacketHistoryStruct *>(calloc(numberOfPackets, sizeof(PacketHistoryStruct)));
+    this->nextSameTo = static_cast<uint32_t *>(calloc(numberOfPackets, sizeof(*this->nextSameTo)));
+    this->payloadArena = static_cast<uint8_t *>(calloc(this->payloadArenaSize, 1));
 
 #endif
 
     LOG_DEBUG("After PSRAM init: heap %d/%d PSRAM %d/%d", memGet.getFreeHeap(), memGet.getHeapSize(), memGet.getFreePsram(),
               memGet.getPsramSize());
-    LOG_DEBUG("numberOfPackets for packetHistory - %u", numberOfPackets);
+    LOG_DEBUG("numberOfPackets for packetHistory - %u, payload arena %u bytes", numberOfPackets, this->payloadArenaSize);
+}
+
+int32_t StoreForwardModule::runReplays()
+{
+    // Back off while the channel is busy or the TX queue is filling up, so a long replay can't monopolize the mesh
+    if (!airTime->isTxAllowedChannelUtil(true) || !airTime->isTxAllowedAirUtil() ||
+        router->getQueueStatus().free < SF_REPLAY_MIN_TX_FREE) {
+        this->replayInterval =
+            std::min<uint32_t>(std::max<uint32_t>(this->replayInterval, SF_REPLAY_MIN_MSEC) * 2, SF_REPLAY_MAX_MSEC);
+        LOG_DEBUG("S&F - Channel busy, next replay in %u ms", this->replayInterval);
+        return this->replayInterval;
+    }
+
+    // Clients take turns, so one long backlog doesn't hold up everybody else's
+    this->nextReplay %= this->numReplays;
+    Replay &replay = this->replays[this->nextReplay];
+    if (replay.sent < this->historyReturnMax && sendPayload(replay.to, replay.last_time)) {
+        replay.sent++;
+        this->nextReplay++;
+    } else {
+        stopReplay(replay.to); // Leaves nextReplay on the following client
+    }
+
+    // Pace by channel utilization: SF_REPLAY_MIN_MSEC apart when idle, stretching to packetTimeMax at the polite limit
+    float load = std::min(airTime->channelUtilizationPercent() / airTime->getPoliteChannelUtilPercent(), 1.0f);
+    this->replayInterval = SF_REPLAY_MIN_MSEC + (uint32_t)((this->packetTimeMax - SF_REPLAY_MIN_MSEC) * load);
+    return this->replayInterval;
+}
+
+bool StoreForwardModule::stopReplay(NodeNum to)
+{
+    for (uint8_t i = 0; i < this->numReplays; i++) {
+        if (this->replays[i].to != to)
+            continue;
+        std::copy(this->replays + i + 1, this->replays + this->numReplays, this->replays + i);
+        this->numReplays--;
+        if (i < this->nextReplay)
+            this->nextReplay--;
+        return true;
+    }
+    return false;
+}
+
+bool StoreForwardModule::isBusyFor(NodeNum to) const
+{
+    if (this->numReplays < SF_MAX_REPLAYS)
+        return false;
+    for (uint8_t i = 0; i < this->numReplays; i++)
+        if (this->replays[i].to == to)
+            return false; // A new request from a client just restarts its replay
+    return true;
+}
+
+#if SF_SPILL_TO_FS
+/**
+ * Without PSRAM the records (our index) and the newest payloads stay in RAM, while the payload log is appended to segment
+ * files. A segment file is only rewritten once every record in it has been evicted.
+ */
+bool StoreForwardModule::populateSpill()
+{
+    uint32_t numberOfPackets = this->records ? this->records : SF_SPILL_RECORDS;
+    this->packetHistory = static_cast<PacketHistoryStruct *>(calloc(numberOfPackets, sizeof(PacketHistoryStruct)));
+    this->nextSameTo = static_cast<uint32_t *>(calloc(numberOfPackets, sizeof(*this->nextSameTo)));
+    this->payloadArena = static_cast<uint8_t *>(calloc(SF_SPILL_HOT_BYTES, 1));
+    if (!this->packetHistory || !this->nextSameTo || !this->payloadArena) {
+        LOG_ERROR("S&F: can't allocate %u records", numberOfPackets);
+        free(this->packetHistory);
+        free(this->nextSameTo);
+        free(this->payloadArena);
+        this->packetHistory = 0;
+        this->nextSameTo = 0;
+        this->payloadArena = 0;
+        return false;
+    }
+    this->records = numberOfPackets;
+    this->payloadArenaSize = SF_SPILL_HOT_BYTES;
+    this->payloadCapacity = SF_SPILL_SEGMENTS * SF_SPILL_SEGMENT_BYTES;
+    this->spillToFS = true;
+
+    // The index only lives in RAM, so whatever an earlier boot left behind is of no use
+    concurrency::LockGuard g(spiLock);
+    FSCom.mkdir("/sf");
+    for (uint32_t i = 0; i <= SF_SPILL_SEGMENTS; i++) {
+        char path[16];
+        spillFileName(path, sizeof(path), i);
+        if (FSCom.exists(path))
+            FSCom.remove(path);
+    }
+    fileManifestChanged();
+    LOG_INFO("S&F: spill %u records with up to %u bytes of payload to the filesystem", numberOfPackets, this->payloadCapacity);
+    return true;
+}
+
+void StoreForwardModule::spillFileName(char *path, size_t size, uint32_t segment) const
+{
+    snprintf(path, size, "/sf/%u", (unsigned)(segment % (SF_SPILL_SEGMENTS + 1)));
 }
+#endif
 
 /**
  * Sends messages from the message history to the specified recipient.
@@ -99,15 +207,15 @@ void StoreForwardModule::populatePSRAM()
  */
 void StoreForwardModule::historySend(uint32_t secAgo, uint32_t to)
 {
-    this->last_time = getTime() < secAgo ? 0 : getTime() - secAgo;
+    uint32_t last_time = getTime() < secAgo ? 0 : getTime() - secAgo;
     uint32_t queueSize = getNumAvailablePackets(to, last_time);
     if (queueSize > this->historyReturnMax)
         queueSize = this->historyReturnMax;
 
-    if (queueSize) {
+    stopReplay(to);
+    if (queueSize && this->numReplays < SF_MAX_REPLAYS) {
         LOG_INFO("S&F - Send %u message(s)", queueSize);
-        this->busy = true; // runOnce() will pickup the next steps once busy = true.
-        this->busyTo = to;
+        this->replays[this->numReplays++] = Replay{to, last_time, 0}; // runOnce() takes it from here
     } else {
         LOG_INFO("S&F - No history");
     }
@@ -134,18 +242,49 @@ uint32_t StoreForwardModule::getNumAvailablePackets(NodeNum dest, uint32_t last_
     if (lastRequest.find(dest) == lastRequest.end()) {
         lastRequest.emplace(dest, 0);
     }
-    for (uint32_t i = lastRequest[dest]; i < this->packetHistoryTotalCount; i++) {
-        if (this->packetHistory[i].time && (this->packetHistory[i].time > last_time)) {
-            // Client is only interested in packets not from itself and only in broadcast packets or packets towards it.
-            if (this->packetHistory[i].from != dest &&
-                (this->packetHistory[i].to == NODENUM_BROADCAST || this->packetHistory[i].to == dest)) {
-                count++;
-            }
-        }
-    }
+    for (uint32_t i = nextHistoryFor(dest, lastRequest[dest], last_time); i != NO_RECORD;
+         i = nextHistoryFor(dest, i + 1, last_time))
+        count++;
     return count;
 }
 
+uint32_t StoreForwardModule::seekHistory(NodeNum to, uint32_t &hint, uint32_t seq)
+{
+    uint32_t i = hint;
+    if (i == NO_RECORD || i > seq || i < getOldestSeq()) {
+        auto chain = historyByTo.find(to);
+        if (chain == historyByTo.end())
+            return NO_RECORD;
+        i = chain->second.first;
+    }
+    while (i != NO_RECORD && i < seq) {
+        hint = i;
+        i = this->nextSameTo[i % this->records];
+    }
+    return i;
+}
+
+uint32_t StoreForwardModule::nextHistoryFor(NodeNum dest, uint32_t seq, uint32_t last_time)
+{
+    // Client is only interested in packets not from itself and only in broadcast packets or packets towards it.
+    HistoryCursor &cursor = historyCursors[dest];
+    uint32_t direct = seekHistory(dest, cursor.direct, seq);
+    uint32_t broadcast = (dest == NODENUM_BROADCAST) ? NO_RECORD : seekHistory(NODENUM_BROADCAST, cursor.broadcast, seq);
+
+    // Merge the two chains in history order
+    while (direct != NO_RECORD || broadcast != NO_RECORD) {
+        uint32_t i = std::min(direct, broadcast);
+        const PacketHistoryStruct &record = this->packetHistory[i % this->records];
+        if (record.time && record.time > last_time && record.from != dest)
+            return i;
+        if (i == direct)
+            direct = this->nextSameTo[i % this->records];
+        else
+            broadcast = this->nextSameTo[i % this->records];
+    }
+    return NO_RECORD;
+}
+
 /**
  * Allocates a mesh packet for sending to the phone.
  *
@@ -155,24 +294,21 @@ meshtastic_MeshPacket *StoreForwardModule::getForPhone()
 {
     if (moduleConfig.store_forward.enabled && is_server) {
         NodeNum to = nodeDB->getNodeNum();
-        if (!this->busy) {
+        if (!this->sendingToPhone) {
             // Get number of packets we're going to send in this loop
             uint32_t histSize = getNumAvailablePackets(to, 0); // No time limit
             if (histSize) {
-                this->busy = true;
-                this->busyTo = to;
+                this->sendingToPhone = true;
             } else {
                 return nullptr;
             }
         }
 
         // We're busy with sending to us until no payload is available anymore
-        if (this->busy && this->busyTo == to) {
-            meshtastic_MeshPacket *p = preparePayload(to, 0, true); // No time limit
-            if (!p)                                                 // No more messages to send
-                this->busy = false;
-            return p;
-        }
+        meshtastic_MeshPacket *p = preparePayload(to, 0, true); // No time limit
+        if (!p)                                                 // No more messages to send
+            this->sendingToPhone = false;
+        return p;
     }
     return nullptr;
 }
@@ -186,27 +322,169 @@ void StoreForwardModule::historyAdd(const meshtastic_MeshPacket &mp)
 {
     const auto &p = mp.decoded;
 
-    if (this->packetHistoryTotalCount == this->records) {
-        LOG_WARN("S&F - PSRAM Full. Starting overwrite");
-        this->packetHistoryTotalCount = 0;
-        for (auto &i : lastRequest) {
-            i.second = 0; // Clear the last request index for each client device
+    // Most text compresses well, but only keep the compressed form if it is smaller and decompresses back exactly
+    const uint8_t *payload = p.payload.bytes;
+    uint8_t storedSize = p.payload.size;
+    bool compressed = false;
+#if SF_COMPRESS_TEXT
+    char packed[meshtastic_Constants_DATA_PAYLOAD_LEN];
+    char unpacked[meshtastic_Constants_DATA_PAYLOAD_LEN];
+    int packedSize = p.payload.size > 1 ? unishox2_compress((const char *)p.payload.bytes, p.payload.size, packed,
+                                                            p.payload.size - 1, USX_PSET_DFLT)
+                                        : 0;
+    if (packedSize > 0 && packedSize < (int)p.payload.size &&
+        unishox2_decompress(packed, packedSize, unpacked, sizeof(unpacked), USX_PSET_DFLT) == (int)p.payload.size &&
+        memcmp(unpacked, p.payload.bytes, p.payload.size) == 0) {
+        payload = (const uint8_t *)packed;
+        storedSize = packedSize;
+        compressed = true;
+    }
+#endif
+
+    const uint32_t seq = this->packetHistoryNextSeq;
+    const uint32_t slot = seq % this->records;
+    if (seq - this->packetHistoryOldestSeq >= this->records)
+        evictOldest();
+    const uint32_t pos = reservePayload(storedSize);
+    if (!writePayload(pos, payload, storedSize))
+        return;
+
+    // Link the new record onto the chain for its recipient
+    this->nextSameTo[slot] = NO_RECORD;
+    auto chain = historyByTo.find(mp.to);
+    if (chain == historyByTo.end()) {
+        historyByTo.emplace(mp.to, HistoryChain{seq, seq});
+    } else {
+        this->nextSameTo[chain->second.last % this->records] = seq;
+        chain->second.last = seq;
+    }
+
+    PacketHistoryStruct &record = this->packetHistory[slot];
+    record.time = getTime();
+    record.to = mp.to;
+    record.channel = mp.channel;
+    record.from = getFrom(&mp);
+    record.id = mp.id;
+    record.reply_id = p.reply_id;
+    record.emoji = (bool)p.emoji;
+    record.compressed = compressed;
+    record.payload_pos = pos;
+    record.payload_size = p.payload.size;
+    record.stored_size = storedSize;
+    record.rx_rssi = mp.rx_rssi;
+    record.rx_snr = mp.rx_snr;
+
+    this->packetHistoryNextSeq++;
+}
+
+void StoreForwardModule::evictOldest()
+{
+    if (this->packetHistoryOldestSeq == 0)
+        LOG_WARN("S&F - History full. Starting overwrite");
+
+    // The oldest record is always the first one on its chain
+    const uint32_t slot = this->packetHistoryOldestSeq % this->records;
+    auto chain = historyByTo.find(this->packetHistory[slot].to);
+    if (chain != historyByTo.end()) {
+        if (this->nextSameTo[slot] == NO_RECORD)
+            historyByTo.erase(chain);
+        else
+            chain->second.first = this->nextSameTo[slot];
+    }
+    this->packetHistoryOldestSeq++;
+}
+
+uint32_t StoreForwardModule::reservePayload(uint8_t size)
+{
+    uint32_t pos = this->payloadArenaHead;
+#if SF_SPILL_TO_FS
+    const uint32_t offset = pos % SF_SPILL_SEGMENT_BYTES;
+    if (this->spillToFS && offset + size > SF_SPILL_SEGMENT_BYTES)
+        pos += SF_SPILL_SEGMENT_BYTES - offset; // Payloads never straddle two segment files
+#endif
+
+    // Everything from the oldest payload up to the end of this one has to fit
+    while (getNumStored() &&
+           pos + size - this->packetHistory[this->packetHistoryOldestSeq % this->records].payload_pos > this->payloadCapacity)
+        evictOldest();
+
+    this->payloadArenaHead = pos + size;
+    return pos;
+}
+
+bool StoreForwardModule::writePayload(uint32_t pos, const uint8_t *data, uint8_t size)
+{
+    // The arena wraps around, so a payload may be split across its end
+    const uint32_t offset = pos % this->payloadArenaSize;
+    const uint32_t first = std::min<uint32_t>(size, this->payloadArenaSize - offset);
+    memcpy(this->payloadArena + offset, data, first);
+    memcpy(this->payloadArena, data + first, size - first);
+
+#if SF_SPILL_TO_FS
+    if (this->spillToFS) {
+        const uint32_t segment = pos / SF_SPILL_SEGMENT_BYTES;
+        char path[16];
+        spillFileName(path, sizeof(path), segment);
+
+        concurrency::LockGuard g(spiLock);
+        if (segment != this->spillSegment && FSCom.exists(path))
+            FSCom.remove(path); // Everything in the segment that used this file before has been evicted
+        this->spillSegment = segment;
+        auto f = FSCom.open(path, FILE_O_APPEND);
+        bool okay = f && f.size() == pos % SF_SPILL_SEGMENT_BYTES && f.write(data, size) == size;
+        if (f)
+            f.close();
+        fileManifestChanged();
+        if (!okay) {
+            // Carry on in a fresh segment, rather than leave later payloads at the wrong offsets
+            LOG_ERROR("S&F - Can't write %s", path);
+            this->payloadArenaHead = (segment + 1) * SF_SPILL_SEGMENT_BYTES;
+            return false;
+        }
+    }
+#endif
+    return true;
+}
+
+pb_size_t StoreForwardModule::readPayload(const PacketHistoryStruct &record, uint8_t *out) const
+{
+    uint8_t packed[meshtastic_Constants_DATA_PAYLOAD_LEN];
+    uint8_t *stored = record.compressed ? packed : out;
+
+    if (this->payloadArenaHead - record.payload_pos <= this->payloadArenaSize) {
+        const uint32_t offset = record.payload_pos % this->payloadArenaSize;
+        const uint32_t first = std::min<uint32_t>(record.stored_size, this->payloadArenaSize - offset);
+        memcpy(stored, this->payloadArena + offset, first);
+        memcpy(stored + first, this->payloadArena, record.stored_size - first);
+    } else {
+#if SF_SPILL_TO_FS
+        char path[16];
+        spillFileName(path, sizeof(path), record.payload_pos / SF_SPILL_SEGMENT_BYTES);
+
+        concurrency::LockGuard g(spiLock);
+        auto f = FSCom.open(path, FILE_O_READ);
+        bool okay = f && f.seek(record.payload_pos % SF_SPILL_SEGMENT_BYTES) &&
+                    f.read(stored, record.stored_size) == record.stored_size;
+        if (f)
+            f.close();
+        if (!okay) {
+            LOG_ERROR("S&F - Can't read %s", path);
+            return 0;
         }
+#else
+        return 0; // Can't happen, the arena holds the whole log
+#endif
     }
 
-    this->packetHistory[this->packetHistoryTotalCount].time = getTime();
-    this->packetHistory[this->packetHistoryTotalCount].to = mp.to;
-    this->packetHistory[this->packetHistoryTotalCount].channel = mp.channel;
-    this->packetHistory[this->packetHistoryTotalCount].from = getFrom(&mp);
-    this->packetHistory[this->packetHistoryTotalCount].id = mp.id;
-    this->packetHistory[this->packetHistoryTotalCount].reply_id = p.reply_id;
-    this->packetHistory[this->packetHistoryTotalCount].emoji = (bool)p.emoji;
-    this->packetHistory[this->packetHistoryTotalCount].payload_size = p.payload.size;
-    this->packetHistory[this->packetHistoryTotalCount].rx_rssi = mp.rx_rssi;
-    this->packetHistory[this->packetHistoryTotalCount].rx_snr = mp.rx_snr;
-    memcpy(this->packetHistory[this->packetHistoryTotalCount].payload, p.payload.bytes, meshtastic_Constants_DATA_PAYLOAD_LEN);
-
-    this->packetHistoryTotalCount++;
+#if SF_COMPRESS_TEXT
+    if (record.compressed) {
+        // Checked to decompress to exactly payload_size bytes when it was stored
+        unishox2_decompress((const char *)packed, record.stored_size, (char *)out, meshtastic_Constants_DATA_PAYLOAD_LEN,
+                            USX_PSET_DFLT);
+        return record.payload_size;
+    }
+#endif
+    return record.stored_size;
 }
 
 /**
@@ -222,7 +500,6 @@ bool StoreForwardModule::sendPayload(NodeNum dest, uint32_t last_time)
     if (p) {
         LOG_INFO("Send S&F Payload");
         service->sendToMesh(p);
-        this->requestCount++;
         return true;
     }
     return false;
@@ -237,56 +514,49 @@ bool StoreForwardModule::sendPayload(NodeNum dest, uint32_t last_time)
  */
 meshtastic_MeshPacket *StoreForwardModule::preparePayload(NodeNum dest, uint32_t last_time, bool local)
 {
-    for (uint32_t i = lastRequest[dest]; i < this->packetHistoryTotalCount; i++) {
-        if (this->packetHistory[i].time && (this->packetHistory[i].time > last_time)) {
-            /*  Copy the messages that were received by the server in the last msAgo
-                to the packetHistoryTXQueue structure.
-                Client not interested in packets from itself and only in broadcast packets or packets towards it. */
-            if (this->packetHistory[i].from != dest &&
-                (this->packetHistory[i].to == NODENUM_BROADCAST || this->packetHistory[i].to == dest)) {
-
-                meshtastic_MeshPacket *p = allocDataPacket();
-
-                p->to = local ? this->packetHistory[i].to : dest; // PhoneAPI can handle original `to`
-                p->from = this->packetHistory[i].from;
-                p->id = this->packetHistory[i].id;
-                p->channel = this->packetHistory[i].channel;
-                p->decoded.reply_id = this->packetHistory[i].reply_id;
-                p->rx_time = this->packetHistory[i].time;
-                p->decoded.emoji = (uint32_t)this->packetHistory[i].emoji;
-                p->rx_rssi = this->packetHistory[i].rx_rssi;
-                p->rx_snr = this->packetHistory[i].rx_snr;
-
-                // Let's assume that if the server received the S&F request that the client is in range.
-                //   TODO: Make this configurable.
-                p->want_ack = false;
-
-                if (local) { // PhoneAPI gets normal TEXT_MESSAGE_APP
-                    p->decoded.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
-                    memcpy(p->decoded.payload.bytes, this->packetHistory[i].payload, this->packetHistory[i].payload_size);
-                    p->decoded.payload.size = this->packetHistory[i].payload_size;
-                } else {
-                    meshtastic_StoreAndForward sf = meshtastic_StoreAndForward_init_zero;
-                    sf.which_variant = meshtastic_StoreAndForward_text_tag;
-                    sf.variant.text.size = this->packetHistory[i].payload_size;
-                    memcpy(sf.variant.text.bytes, this->packetHistory[i].payload, this->packetHistory[i].payload_size);
-                    if (this->packetHistory[i].to == NODENUM_BROADCAST) {
-                        sf.rr = meshtastic_StoreAndForward_RequestResponse_ROUTER_TEXT_BROADCAST;
-                    } else {
-                        sf.rr = meshtastic_StoreAndForward_RequestResponse_ROUTER_TEXT_DIRECT;
-                    }
-
-                    p->decoded.payload.size = pb_encode_to_bytes(p->decoded.payload.bytes, sizeof(p->decoded.payload.bytes),
-                                                                 &meshtastic_StoreAndForward_msg, &sf);
-                }
+    uint32_t i = nextHistoryFor(dest, lastRequest[dest], last_time);
+    if (i == NO_RECORD)
+        return nullptr;
+    const PacketHistoryStruct &record = this->packetHistory[i % this->records];
+
+    /*  Copy the messages that were received by the server in the last msAgo
+        to the packetHistoryTXQueue structure. */
+    meshtastic_MeshPacket *p = allocDataPacket();
+
+    p->to = local ? record.to : dest; // PhoneAPI can handle original `to`
+    p->from = record.from;
+    p->id = record.id;
+    p->channel = record.channel;
+    p->decoded.reply_id = record.reply_id;
+    p->rx_time = record.time;
+    p->decoded.emoji = (uint32_t)record.emoji;
+    p->rx_rssi = record.rx_rssi;
+    p->rx_snr = record.rx_snr;
 
-                lastRequest[dest] = i + 1; // Update the last request index for the client device
+    // Let's assume that if the server received the S&F request that the client is in range.
+    //   TODO: Make this configurable.
+    p->want_ack = false;
 
-                return p;
-            }
+    if (local) { // PhoneAPI gets normal TEXT_MESSAGE_APP
+        p->decoded.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
+        p->decoded.payload.size = readPayload(record, p->decoded.payload.bytes);
+    } else {
+        meshtastic_StoreAndForward sf = meshtastic_StoreAndForward_init_zero;
+        sf.which_variant = meshtastic_StoreAndForward_text_tag;
+        sf.variant.text.size = readPayload(record, sf.variant.text.bytes);
+        if (record.to == NODENUM_BROADCAST) {
+            sf.rr = meshtastic_StoreAndForward_RequestResponse_ROUTER_TEXT_BROADCAST;
+        } else {
+            sf.rr = meshtastic_StoreAndForward_RequestResponse_ROUTER_TEXT_DIRECT;
         }
+
+        p->decoded.payload.size = pb_encode_to_bytes(p->decoded.payload.bytes, sizeof(p->decoded.payload.bytes),
+                                                     &meshtastic_StoreAndForward_msg, &sf);
     }
-    return nullptr;
+
+    lastRequest[dest] = i + 1; // Update the last request sequence number for the client device
+
+    return p;
 }
 
 /**
@@ -340,7 +610,7 @@ void StoreForwardModule::sendErrorTextMessage(NodeNum dest, bool want_response)
     pr->decoded.want_response = false;
     pr->decoded.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
     const char *str;
-    if (this->busy) {
+    if (isBusyFor(dest)) {
         str = "S&F - Busy. Try again shortly.";
     } else {
         str = "S&F not permitted on the public channel.";
@@ -366,7 +636,7 @@ void StoreForwardModule::statsSend(uint32_t to)
     sf.rr = meshtastic_StoreAndForward_RequestResponse_ROUTER_STATS;
     sf.which_variant = meshtastic_StoreAndForward_stats_tag;
     sf.variant.stats.messages_total = this->records;
-    sf.variant.stats.messages_saved = this->packetHistoryTotalCount;
+    sf.variant.stats.messages_saved = getNumStored();
     sf.variant.stats.messages_max = this->records;
     sf.variant.stats.up_time = millis() / 1000;
     sf.variant.stats.requests = this->requests;
@@ -387,7 +657,7 @@ void StoreForwardModule::statsSend(uint32_t to)
  */
 ProcessMessage StoreForwardModule::handleReceived(const meshtastic_MeshPacket &mp)
 {
-#if defined(ARCH_ESP32) || defined(ARCH_PORTDUINO)
+#if SF_HAS_STORE
     if (moduleConfig.store_forward.enabled) {
 
         if ((mp.decoded.portnum == meshtastic_PortNum_TEXT_MESSAGE_APP) && is_server) {
@@ -396,14 +666,14 @@ ProcessMessage StoreForwardModule::handleReceived(const meshtastic_MeshPacket &m
                 LOG_DEBUG("Legacy Request to send");
 
                 // Send the last 60 minutes of messages.
-                if (this->busy || channels.isDefaultChannel(mp.channel)) {
+                if (isBusyFor(getFrom(&mp)) || channels.isDefaultChannel(mp.channel)) {
                     sendErrorTextMessage(getFrom(&mp), mp.decoded.want_response);
                 } else {
                     storeForwardModule->historySend(historyReturnWindow * 60, getFrom(&mp));
                 }
             } else {
                 storeForwardModule->historyAdd(mp);
-                LOG_INFO("S&F stored. Message history contains %u records now", this->packetHistoryTotalCount);
+                LOG_INFO("S&F stored. Message history contains %u records now", getNumStored());
             }
         } else if (!isFromUs(&mp) && mp.decoded.portnum == meshtastic_PortNum_STORE_FORWARD_APP) {
             auto &p = mp.decoded;
@@ -448,11 +718,8 @@ bool StoreForwardModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp,
     case meshtastic_StoreAndForward_RequestResponse_CLIENT_ABORT:
         if (is_server) {
             // stop sending stuff, the client wants to abort or has another error
-            if ((this->busy) && (this->busyTo == getFrom(&mp))) {
+            if (stopReplay(getFrom(&mp)))
                 LOG_ERROR("Client in ERROR or ABORT requested");
-                this->requestCount = 0;
-                this->busy = false;
-            }
         }
         break;
 
@@ -461,7 +728,7 @@ bool StoreForwardModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp,
             requests_history++;
             LOG_INFO("Client Request to send HISTORY");
             // Send the last 60 minutes of messages.
-            if (this->busy || channels.isDefaultChannel(mp.channel)) {
+            if (isBusyFor(getFrom(&mp)) || channels.isDefaultChannel(mp.channel)) {
                 sendErrorTextMessage(getFrom(&mp), mp.decoded.want_response);
             } else {
                 if ((p->which_variant == meshtastic_StoreAndForward_history_tag) && (p->variant.history.window > 0)) {
@@ -490,7 +757,7 @@ bool StoreForwardModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp,
     case meshtastic_StoreAndForward_RequestResponse_CLIENT_STATS:
         if (is_server) {
             LOG_INFO("Client Request to send STATS");
-            if (this->busy) {
+            if (isBusyFor(getFrom(&mp))) {
                 storeForwardModule->sendMessage(getFrom(&mp), meshtastic_StoreAndForward_RequestResponse_ROUTER_BUSY);
                 LOG_INFO("S&F - Busy. Try again shortly");
             } else {
@@ -504,7 +771,7 @@ bool StoreForwardModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp,
         if (is_client) {
             LOG_DEBUG("StoreAndForward_RequestResponse_ROUTER_BUSY");
             // retry in messages_saved * packetTimeMax ms
-            retry_delay = millis() + getNumAvailablePackets(this->busyTo, this->last_time) * packetTimeMax *
+            retry_delay = millis() + getNumAvailablePackets(getFrom(&mp), 0) * packetTimeMax *
                                          (meshtastic_StoreAndForward_RequestResponse_ROUTER_ERROR ? 2 : 1);
         }
         break;
@@ -565,8 +832,9 @@ StoreForwardModule::StoreForwardModule()
     : concurrency::OSThread("StoreForward"),
       ProtobufModule("StoreForward", meshtastic_PortNum_STORE_FORWARD_APP, &meshtastic_StoreAndForward_msg)
 {
+    setPriority(concurrency::PRIORITY_BACKGROUND);
 
-#if defined(ARCH_ESP32) || defined(ARCH_PORTDUINO)
+#if SF_HAS_STORE
 
     isPromiscuous = true; // Brown chicken brown cow
 
@@ -584,36 +852,35 @@ StoreForwardModule::StoreForwardModule()
         // Router
         if ((config.device.role == meshtastic_Config_DeviceConfig_Role_ROUTER || moduleConfig.store_forward.is_server)) {
             LOG_INFO("Init Store & Forward Module in Server mode");
-            if (memGet.getPsramSize() > 0) {
-                if (memGet.getFreePsram() >= 1024 * 1024) {
-
-                    // Do the startup here
-
-                    // Maximum number of records to return.
-                    if (moduleConfig.store_forward.history_return_max)
-                        this->historyReturnMax = moduleConfig.store_forward.history_return_max;
 
-                    // Maximum time window for records to return (in minutes)
-                    if (moduleConfig.store_forward.history_return_window)
-                        this->historyReturnWindow = moduleConfig.store_forward.history_return_window;
-
-                    // Maximum number of records to store in memory
-                    if (moduleConfig.store_forward.records)
-                        this->records = moduleConfig.store_forward.records;
-
-                    // send heartbeat advertising?
-                    if (moduleConfig.store_forward.heartbeat)
-                        this->heartbeat = moduleConfig.store_forward.heartbeat;
-                    else
-                        this->heartbeat = false;
-
-                    // Popupate PSRAM with our data structures.
-                    this->populatePSRAM();
-                    is_server = true;
-                } else {
-                    LOG_INFO(".");
-                    LOG_INFO("S&F: not enough PSRAM free, Disable");
-                }
+            // Maximum number of records to return.
+            if (moduleConfig.store_forward.history_return_max)
+                this->historyReturnMax = moduleConfig.store_forward.history_return_max;
+
+            // Maximum time window for records to return (in minutes)
+            if (moduleConfig.store_forward.history_return_window)
+                this->historyReturnWindow = moduleConfig.store_forward.history_return_window;
+
+            // Maximum number of records to store in memory
+            if (moduleConfig.store_forward.records)
+                this->records = moduleConfig.store_forward.records;
+
+            // send heartbeat advertising?
+            if (moduleConfig.store_forward.heartbeat)
+                this->heartbeat = moduleConfig.store_forward.heartbeat;
+            else
+                this->heartbeat = false;
+
+            if (memGet.getPsramSize() > 0 && memGet.getFreePsram() >= 1024 * 1024) {
+                // Popupate PSRAM with our data structures.
+                this->populatePSRAM();
+                is_server = true;
+#if SF_SPILL_TO_FS
+            } else if (this->populateSpill()) {
+                is_server = true;
+#endif
+            } else if (memGet.getPsramSize() > 0) {
+                LOG_INFO("S&F: not enough PSRAM free, Disable");
             } else {
                 LOG_INFO("S&F: device doesn't have PSRAM, Disable");
             }
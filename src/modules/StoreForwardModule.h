@@ -9,39 +9,131 @@
 #include <functional>
 #include <unordered_map>
 
+#ifndef SF_PAYLOAD_BYTES_PER_RECORD
+// Payload arena budgeted per record: most stored text messages are short, so records are packed instead of each reserving
+// a full meshtastic_Constants_DATA_PAYLOAD_LEN
+#define SF_PAYLOAD_BYTES_PER_RECORD 48
+#endif
+
+#ifndef SF_COMPRESS_TEXT
+#define SF_COMPRESS_TEXT 1 // Store text payloads unishox2 compressed when that makes them smaller
+#endif
+
+#ifndef SF_SPILL_TO_FS
+// Servers without (enough) PSRAM keep the records in RAM and their payloads in segment files on the filesystem
+#if defined(ARCH_ESP32) || defined(ARCH_NRF52) || defined(ARCH_RP2040) || defined(ARCH_PORTDUINO)
+#define SF_SPILL_TO_FS 1
+#else
+#define SF_SPILL_TO_FS 0
+#endif
+#endif
+
+#ifndef SF_SPILL_RECORDS
+#define SF_SPILL_RECORDS 300 // Default number of records when spilling, 40 bytes of RAM each
+#endif
+#ifndef SF_SPILL_SEGMENT_BYTES
+#define SF_SPILL_SEGMENT_BYTES 4096
+#endif
+#ifndef SF_SPILL_SEGMENTS
+#define SF_SPILL_SEGMENTS 8 // Segments of history, one more file is kept for the segment being written
+#endif
+#ifndef SF_SPILL_HOT_BYTES
+#define SF_SPILL_HOT_BYTES 2048 // The newest payloads are also kept in RAM, so most replays never touch the filesystem
+#endif
+
+#ifndef SF_MAX_REPLAYS
+#define SF_MAX_REPLAYS 4 // History replays that may run at once, they take turns sending
+#endif
+#ifndef SF_REPLAY_MIN_MSEC
+#define SF_REPLAY_MIN_MSEC 1000 // Gap between replayed packets on an idle channel
+#endif
+#ifndef SF_REPLAY_MAX_MSEC
+#define SF_REPLAY_MAX_MSEC 60000 // Longest we back off while the channel or TX queue is busy
+#endif
+#ifndef SF_REPLAY_MIN_TX_FREE
+#define SF_REPLAY_MIN_TX_FREE 4 // TX queue slots a replay leaves for everybody else's traffic
+#endif
+
+#if defined(ARCH_ESP32) || defined(ARCH_PORTDUINO) || SF_SPILL_TO_FS
+#define SF_HAS_STORE 1
+#else
+#define SF_HAS_STORE 0
+#endif
+
+/// Fixed size part of a stored message, ordered so there is no padding; the payload itself lives in the payload arena
 struct PacketHistoryStruct {
     uint32_t time;
     uint32_t to;
     uint32_t from;
     uint32_t id;
-    uint8_t channel;
     uint32_t reply_id;
-    bool emoji;
-    uint8_t payload[meshtastic_Constants_DATA_PAYLOAD_LEN];
-    pb_size_t payload_size;
     int32_t rx_rssi;
     float rx_snr;
+    uint32_t payload_pos; // Position in the payload log, the arena holds the newest payloadArenaSize bytes of it
+    uint8_t payload_size; // Size after decompression
+    uint8_t stored_size;  // Bytes in the arena
+    uint8_t channel;
+    uint8_t emoji : 1;
+    uint8_t compressed : 1;
 };
 
 class StoreForwardModule : private concurrency::OSThread, public ProtobufModule<meshtastic_StoreAndForward>
 {
-    bool busy = 0;
-    uint32_t busyTo = 0;
+    // History requests being answered, a replay ends once its client's backlog or historyReturnMax runs out
+    struct Replay {
+        NodeNum to;
+        uint32_t last_time;
+        uint32_t sent;
+    };
+    Replay replays[SF_MAX_REPLAYS];
+    uint8_t numReplays = 0;
+    uint8_t nextReplay = 0;      // Whose turn it is
+    uint32_t replayInterval = 0; // Current gap between replayed packets
+    bool sendingToPhone = false;
     char routerMessage[meshtastic_Constants_DATA_PAYLOAD_LEN] = {0};
 
     PacketHistoryStruct *packetHistory = 0;
-    uint32_t packetHistoryTotalCount = 0;
-    uint32_t last_time = 0;
-    uint32_t requestCount = 0;
+    uint32_t packetHistoryNextSeq = 0;   // Records are numbered as they come in and live in slot seq % records
+    uint32_t packetHistoryOldestSeq = 0; // Records are evicted in order, when we run out of slots or payload arena
+
+    /* Payloads are appended to a log, which is only ever addressed by position.  In PSRAM the arena is the whole log, when
+       spilling to the filesystem the log lives in segment files and the arena (wrapping around) caches its newest bytes. */
+    uint8_t *payloadArena = 0;
+    uint32_t payloadArenaSize = 0;
+    uint32_t payloadCapacity = 0;  // How much of the log we keep
+    uint32_t payloadArenaHead = 0; // Where the next payload goes
+    bool spillToFS = false;
+    uint32_t spillSegment = UINT32_MAX; // The segment being appended to
 
-    uint32_t packetTimeMax = 5000; // Interval between sending history packets as a server.
+    uint32_t packetTimeMax = 5000; // Interval between sending history packets as a server, on a channel at the polite limit
 
     bool is_client = false;
     bool is_server = false;
 
-    // Unordered_map stores the last request for each nodeNum (`to` field)
+    // Unordered_map stores the sequence number each nodeNum (`to` field) wants next
     std::unordered_map<NodeNum, uint32_t> lastRequest;
 
+    /// The sequence number of the oldest record we still have
+    uint32_t getOldestSeq() const { return packetHistoryOldestSeq; }
+    uint32_t getNumStored() const { return packetHistoryNextSeq - getOldestSeq(); }
+
+    /* Index over packetHistory, so a client's backlog can be found without looking at everybody else's messages: every `to`
+       has a chain of the sequence numbers of its records, linked through nextSameTo.  Broadcasts are just the chain for
+       NODENUM_BROADCAST. */
+    struct HistoryChain {
+        uint32_t first;
+        uint32_t last;
+    };
+    std::unordered_map<NodeNum, HistoryChain> historyByTo;
+    uint32_t *nextSameTo = 0; // Parallel to packetHistory, by slot
+
+    // Where each client got to on its direct and the broadcast chain, so walking its backlog doesn't restart every time
+    struct HistoryCursor {
+        uint32_t direct = UINT32_MAX;
+        uint32_t broadcast = UINT32_MAX;
+    };
+    std::unordered_map<NodeNum, HistoryCursor> historyCursors;
+
   public:
     StoreForwardModule();
 
@@ -82,10 +174,42 @@ class StoreForwardModule : private concurrency::OSThread, public ProtobufModule<
             return false;
         }
     }
+    virtual int getDispatchPort() const override { return MESHMODULE_ANY_PORT; }
 
   private:
     void populatePSRAM();
 
+    /// Send the next replayed packet if the channel and TX queue allow, @return how long until we should try again
+    int32_t runReplays();
+    bool stopReplay(NodeNum to);
+    /// Can't take on a history request from to right now
+    bool isBusyFor(NodeNum to) const;
+
+    /// Drop the oldest record, releasing its slot and its payload bytes
+    void evictOldest();
+
+    /// Make room for a payload of size bytes, @return its arena position
+    uint32_t reservePayload(uint8_t size);
+
+#if SF_SPILL_TO_FS
+    /// Set up a store that spills payloads to the filesystem, @return false if we couldn't
+    bool populateSpill();
+    void spillFileName(char *path, size_t size, uint32_t segment) const;
+#endif
+
+    /// Append a payload to the log at pos (from reservePayload), @return false if it couldn't be written
+    bool writePayload(uint32_t pos, const uint8_t *data, uint8_t size);
+
+    /// Copy a record's payload into out (which has room for meshtastic_Constants_DATA_PAYLOAD_LEN), @return its size
+    pb_size_t readPayload(const PacketHistoryStruct &record, uint8_t *out) const;
+
+    /// @return the first record on the chain for `to` at or after seq, starting the walk from hint and moving hint along
+    uint32_t seekHistory(NodeNum to, uint32_t &hint, uint32_t seq);
+
+    /// @return the sequence number of the first record from seq on that dest wants (not its own, broadcast or to it, newer
+    /// than last_time)
+    uint32_t nextHistoryFor(NodeNum dest, uint32_t seq, uint32_t last_time);
+
     // S&F Defaults
     uint32_t historyReturnMax = 25;     // Return maximum of 25 records by default.
     uint32_t historyReturnWindow = 240; // Return history of last 4 hours by default.
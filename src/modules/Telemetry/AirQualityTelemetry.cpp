@@ -91,6 +91,12 @@ int32_t AirQualityTelemetryModule::runOnce()
             // sensor is already warmed up; grab telemetry and send it
             LOG_DEBUG("runOnce(): state = active");
 
+            if (aggregate.wantSample()) {
+                meshtastic_Telemetry m = meshtastic_Telemetry_init_zero;
+                if (getAirQualityTelemetry(&m))
+                    aggregate.add(&m.variant.air_quality_metrics);
+            }
+
             if (((lastSentToMesh == 0) ||
                  !Throttle::isWithinTimespanMs(lastSentToMesh, Default::getConfiguredOrDefaultMsScaled(
                                                                    moduleConfig.telemetry.air_quality_interval,
@@ -207,6 +213,10 @@ bool AirQualityTelemetryModule::sendTelemetry(NodeNum dest, bool phoneOnly)
 {
     meshtastic_Telemetry m = meshtastic_Telemetry_init_zero;
     if (getAirQualityTelemetry(&m)) {
+        if (!phoneOnly && aggregate.size()) {
+            aggregate.add(&m.variant.air_quality_metrics);
+            LOG_DEBUG("Report the aggregate of %u samples", aggregate.takeInto(&m.variant.air_quality_metrics));
+        }
         meshtastic_MeshPacket *p = allocDataProtobuf(m);
         p->to = dest;
         p->decoded.want_response = false;
@@ -7,6 +7,7 @@
 #include "Adafruit_PM25AQI.h"
 #include "NodeDB.h"
 #include "ProtobufModule.h"
+#include "TelemetryAggregator.h"
 
 class AirQualityTelemetryModule : private concurrency::OSThread, public ProtobufModule<meshtastic_Telemetry>
 {
@@ -19,6 +20,7 @@ class AirQualityTelemetryModule : private concurrency::OSThread, public Protobuf
         : concurrency::OSThread("AirQualityTelemetry"),
           ProtobufModule("AirQualityTelemetry", meshtastic_PortNum_TELEMETRY_APP, &meshtastic_Telemetry_msg)
     {
+        setPriority(concurrency::PRIORITY_BACKGROUND);
         lastMeasurementPacket = nullptr;
         setIntervalFromNow(10 * 1000);
         aqi = Adafruit_PM25AQI();
@@ -62,6 +64,7 @@ class AirQualityTelemetryModule : private concurrency::OSThread, public Protobuf
     meshtastic_MeshPacket *lastMeasurementPacket;
     uint32_t sendToPhoneIntervalMs = SECONDS_IN_MINUTE * 1000; // Send to phone every minute
     uint32_t lastSentToMesh = 0;
+    TelemetryAggregator aggregate = TelemetryAggregator(meshtastic_AirQualityMetrics_fields);
 };
 
 #endif
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Default.h"
 #include "MeshService.h"
 #include "NodeDB.h"
+#include "PacketLatency.h"
 #include "PowerFSM.h"
 #include "RTC.h"
 #include "RadioLibInterface.h"
@@ -13,6 +14,9 @@
 #include <OLEDDisplay.h>
 #include <OLEDDisplayUi.h>
 #include <meshUtils.h>
+#ifdef ARCH_NRF52
+#include "platform/nrf52/alloc.h"
+#endif
 
 #define MAGIC_USB_BATTERY_LEVEL 101
 
@@ -151,6 +155,40 @@ meshtastic_Telemetry DeviceTelemetryModule::getLocalStatsTelemetry()
     LOG_INFO("num_packets_tx=%i, num_packets_rx=%i, num_packets_rx_bad=%i", telemetry.variant.local_stats.num_packets_tx,
              telemetry.variant.local_stats.num_packets_rx, telemetry.variant.local_stats.num_packets_rx_bad);
 
+    if (RadioLibInterface::instance) {
+        RadioLibInterface *radio = RadioLibInterface::instance;
+        LOG_INFO("contention cw_floor=%u, neighbors=%u, cad_busy=%u/%u (%.2f), rx_bad_rate=%.2f", radio->getCWFloor(),
+                 radio->getContentionNeighbors(), radio->txCadBusy, radio->txCadBusy + radio->txCadClear, radio->getCadBusyRate(),
+                 radio->getRxBadRate());
+    }
+    packetLatency.logHistograms();
+
+    AllocatorStats poolStats;
+    if (packetPool.getStats(poolStats))
+        LOG_INFO("packet_pool in_use=%u, high_water=%u, capacity=%u, alloc_failures=%u", poolStats.inUse, poolStats.highWater,
+                 poolStats.capacity, poolStats.allocFailures);
+
+    // LocalStats only has room for the current heap, so the high water marks for sizing nodes and queues go to the log
+    LOG_INFO("heap free=%u, min_free=%u, max_alloc=%u, alloc_failures=%u", memGet.getFreeHeap(), memGet.getMinFreeHeap(),
+             memGet.getMaxAllocHeap(), memGet.getAllocFailures());
+#if defined(ARCH_NRF52) && NRF52_SLAB_ALLOC
+    size_t blockSize;
+    for (uint8_t i = 0; nrf52GetSlabStats(i, blockSize, poolStats); i++)
+        LOG_INFO("slab %u in_use=%u, high_water=%u, capacity=%u, to_heap=%u", (unsigned)blockSize, poolStats.inUse,
+                 poolStats.highWater, poolStats.capacity, poolStats.allocFailures);
+#endif
+    size_t txHighWater = RadioLibInterface::instance ? RadioLibInterface::instance->getTxQueueHighWater() : 0;
+#ifdef ARCH_PORTDUINO
+    if (SimRadio::instance)
+        txHighWater = SimRadio::instance->getTxQueueHighWater();
+#endif
+    LOG_INFO("queue high_water to_phone=%d/%d, from_radio=%d, tx=%u/%d", service->getToPhoneHighWater(), MAX_RX_TOPHONE,
+             router ? router->rxQueueHighWater() : 0, (unsigned)txHighWater, MAX_TX_QUEUE);
+    if (router)
+        LOG_INFO("from_radio drops duplicate=%u, flood=%u, reliable=%u, for_us=%u", router->rxQueueDrops[RX_ADMIT_DUPLICATE],
+                 router->rxQueueDrops[RX_ADMIT_FLOOD], router->rxQueueDrops[RX_ADMIT_RELIABLE],
+                 router->rxQueueDrops[RX_ADMIT_FOR_US]);
+
     return telemetry;
 }
 
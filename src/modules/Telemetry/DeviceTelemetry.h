@@ -15,6 +15,7 @@ class DeviceTelemetryModule : private concurrency::OSThread, public ProtobufModu
         : concurrency::OSThread("DeviceTelemetry"),
           ProtobufModule("DeviceTelemetry", meshtastic_PortNum_TELEMETRY_APP, &meshtastic_Telemetry_msg)
     {
+        setPriority(concurrency::PRIORITY_BACKGROUND);
         uptimeWrapCount = 0;
         uptimeLastMs = millis();
         nodeStatusObserver.observe(&nodeStatus->onNewStatus);
@@ -204,6 +204,22 @@ IndicatorSensor indicatorSensor;
 #include "graphics/ScreenFonts.h"
 #include <Throttle.h>
 
+/**
+ * Start a measurement on every sensor with a slow conversion
+ * @return msec until the slowest of them can be read without waiting
+ */
+static uint32_t startConversions()
+{
+    uint32_t msec = 0;
+#if !MESHTASTIC_EXCLUDE_ENVIRONMENTAL_SENSOR_EXTERNAL && !defined(T1000X_SENSOR_EN)
+    TelemetrySensor *slowSensors[] = {&nau7802Sensor, &rcwl9620Sensor, &rak12035Sensor};
+    for (TelemetrySensor *sensor : slowSensors)
+        if (sensor->hasSensor())
+            msec = max(msec, sensor->startConversion());
+#endif
+    return msec;
+}
+
 int32_t EnvironmentTelemetryModule::runOnce()
 {
     if (sleepOnNextExecution == true) {
@@ -325,20 +341,39 @@ int32_t EnvironmentTelemetryModule::runOnce()
 #endif
         }
 
-        if (((lastSentToMesh == 0) ||
-             !Throttle::isWithinTimespanMs(lastSentToMesh, Default::getConfiguredOrDefaultMsScaled(
-                                                               moduleConfig.telemetry.environment_update_interval,
-                                                               default_telemetry_broadcast_interval_secs, numOnlineNodes))) &&
-            airTime->isTxAllowedChannelUtil(config.device.role != meshtastic_Config_DeviceConfig_Role_SENSOR) &&
-            airTime->isTxAllowedAirUtil()) {
-            sendTelemetry();
-            lastSentToMesh = millis();
-        } else if (((lastSentToPhone == 0) || !Throttle::isWithinTimespanMs(lastSentToPhone, sendToPhoneIntervalMs)) &&
-                   (service->isToPhoneQueueEmpty())) {
-            // Just send to phone when it's not our time to send to mesh yet
-            // Only send while queue is empty (phone assumed connected)
-            sendTelemetry(NODENUM_BROADCAST, true);
-            lastSentToPhone = millis();
+        uint32_t sendToMeshIntervalMs = Default::getConfiguredOrDefaultMsScaled(
+            moduleConfig.telemetry.environment_update_interval, default_telemetry_broadcast_interval_secs, numOnlineNodes);
+        bool toMesh = ((lastSentToMesh == 0) || !Throttle::isWithinTimespanMs(lastSentToMesh, sendToMeshIntervalMs)) &&
+                      airTime->isTxAllowedChannelUtil(config.device.role != meshtastic_Config_DeviceConfig_Role_SENSOR) &&
+                      airTime->isTxAllowedAirUtil();
+        // Just send to phone when it's not our time to send to mesh yet
+        // Only send while queue is empty (phone assumed connected)
+        bool toPhone = !toMesh &&
+                       ((lastSentToPhone == 0) || !Throttle::isWithinTimespanMs(lastSentToPhone, sendToPhoneIntervalMs)) &&
+                       service->isToPhoneQueueEmpty();
+
+        if (toMesh || toPhone || aggregate.wantSample()) {
+            // Let the slow sensors convert while other threads run, rather than each blocking in getMetrics() in turn
+            if (!conversionStarted) {
+                conversionStarted = millis() | 1;
+                conversionMsec = startConversions();
+            }
+            uint32_t elapsed = millis() - conversionStarted;
+            if (elapsed < conversionMsec)
+                return min(result, conversionMsec - elapsed);
+            conversionStarted = 0;
+
+            if (toMesh) {
+                sendTelemetry();
+                lastSentToMesh = millis();
+            } else if (toPhone) {
+                sendTelemetry(NODENUM_BROADCAST, true);
+                lastSentToPhone = millis();
+            } else {
+                meshtastic_Telemetry m = meshtastic_Telemetry_init_zero;
+                if (getEnvironmentTelemetry(&m))
+                    aggregate.add(&m.variant.environment_metrics);
+            }
         }
     }
     return min(sendToPhoneIntervalMs, result);
@@ -728,6 +763,13 @@ bool EnvironmentTelemetryModule::sendTelemetry(NodeNum dest, bool phoneOnly)
 #else
     if (getEnvironmentTelemetry(&m)) {
 #endif
+        if (phoneOnly) {
+            if (aggregate.wantSample())
+                aggregate.add(&m.variant.environment_metrics);
+        } else if (aggregate.size()) {
+            aggregate.add(&m.variant.environment_metrics);
+            LOG_DEBUG("Report the aggregate of %u samples", aggregate.takeInto(&m.variant.environment_metrics));
+        }
         LOG_INFO("Send: barometric_pressure=%f, current=%f, gas_resistance=%f, relative_humidity=%f, temperature=%f",
                  m.variant.environment_metrics.barometric_pressure, m.variant.environment_metrics.current,
                  m.variant.environment_metrics.gas_resistance, m.variant.environment_metrics.relative_humidity,
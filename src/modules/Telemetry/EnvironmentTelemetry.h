@@ -11,6 +11,7 @@
 #include "../mesh/generated/meshtastic/telemetry.pb.h"
 #include "NodeDB.h"
 #include "ProtobufModule.h"
+#include "TelemetryAggregator.h"
 #include <OLEDDisplay.h>
 #include <OLEDDisplayUi.h>
 
@@ -25,6 +26,7 @@ class EnvironmentTelemetryModule : private concurrency::OSThread, public Protobu
         : concurrency::OSThread("EnvironmentTelemetry"),
           ProtobufModule("EnvironmentTelemetry", meshtastic_PortNum_TELEMETRY_APP, &meshtastic_Telemetry_msg)
     {
+        setPriority(concurrency::PRIORITY_BACKGROUND);
         lastMeasurementPacket = nullptr;
         nodeStatusObserver.observe(&nodeStatus->onNewStatus);
         setIntervalFromNow(10 * 1000);
@@ -63,6 +65,15 @@ class EnvironmentTelemetryModule : private concurrency::OSThread, public Protobu
     uint32_t lastSentToMesh = 0;
     uint32_t lastSentToPhone = 0;
     uint32_t sensor_read_error_count = 0;
+    uint32_t conversionStarted = 0; // millis() (made odd so it is never 0) of the conversions we are waiting for
+    uint32_t conversionMsec = 0;
+    // Wind direction and rain gauges don't average, so they report what the sensor said last
+    TelemetryAggregator aggregate =
+        TelemetryAggregator(meshtastic_EnvironmentMetrics_fields, TELEMETRY_TAG(meshtastic_EnvironmentMetrics_wind_gust_tag),
+                            TELEMETRY_TAG(meshtastic_EnvironmentMetrics_wind_lull_tag),
+                            TELEMETRY_TAG(meshtastic_EnvironmentMetrics_wind_direction_tag) |
+                                TELEMETRY_TAG(meshtastic_EnvironmentMetrics_rainfall_1h_tag) |
+                                TELEMETRY_TAG(meshtastic_EnvironmentMetrics_rainfall_24h_tag));
 };
 
 #endif
\ No newline at end of file
@@ -19,6 +19,7 @@ class HealthTelemetryModule : private concurrency::OSThread, public ProtobufModu
         : concurrency::OSThread("HealthTelemetry"),
           ProtobufModule("HealthTelemetry", meshtastic_PortNum_TELEMETRY_APP, &meshtastic_Telemetry_msg)
     {
+        setPriority(concurrency::PRIORITY_BACKGROUND);
         lastMeasurementPacket = nullptr;
         nodeStatusObserver.observe(&nodeStatus->onNewStatus);
         setIntervalFromNow(10 * 1000);
@@ -2,8 +2,54 @@
 #include "../mesh/generated/meshtastic/telemetry.pb.h"
 #include "MeshService.h"
 #if ARCH_PORTDUINO
+#include "PerfCounters.h"
 #include "PortduinoGlue.h"
+#include <errno.h>
+#include <fcntl.h>
 #include <filesystem>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char **environ;
+
+#define HOST_METRICS_COMMAND_POLL_MS 250
+
+/**
+ * A file in /proc, held open and read again from the start each time.  Cheaper than opening it for every report, and
+ * the reads go into a fixed buffer rather than a stream.
+ */
+class ProcFile
+{
+  public:
+    explicit ProcFile(const char *path) : path(path) {}
+
+    // The start of the file, NUL terminated, or nullptr if it can't be read
+    const char *read()
+    {
+        if (fd < 0)
+            fd = open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return nullptr;
+        ssize_t n = pread(fd, buf, sizeof(buf) - 1, 0);
+        if (n <= 0)
+            return nullptr;
+        buf[n] = '\0';
+        return buf;
+    }
+
+  private:
+    const char *path;
+    int fd = -1;
+    char buf[512]; // MemAvailable is the third line of meminfo, everything else we read is a single line
+};
+
+static ProcFile procUptime("/proc/uptime");
+static ProcFile procMeminfo("/proc/meminfo");
+static ProcFile procLoadavg("/proc/loadavg");
+static ProcFile procSelfStat("/proc/self/stat");
+static ProcFile procSelfStatm("/proc/self/statm");
 #endif
 
 int32_t HostMetricsModule::runOnce()
@@ -11,10 +57,17 @@ int32_t HostMetricsModule::runOnce()
 #if ARCH_PORTDUINO
     if (settingsMap[hostMetrics_interval] == 0) {
         return disable();
-    } else {
-        sendMetrics();
-        return 60 * 1000 * settingsMap[hostMetrics_interval];
     }
+
+    // Get a fresh user string if we can, but wait for it alongside everything else rather than blocking here
+    if (userCommandPid < 0 && !userCommandStarted && startUserCommand())
+        return HOST_METRICS_COMMAND_POLL_MS;
+    if (pollUserCommand())
+        return HOST_METRICS_COMMAND_POLL_MS;
+
+    sendMetrics();
+    userCommandStarted = 0;
+    return 60 * 1000 * settingsMap[hostMetrics_interval];
 #else
     return disable();
 #endif
@@ -71,54 +124,130 @@ meshtastic_MeshPacket *HostMetricsModule::allocReply()
 #if ARCH_PORTDUINO
 meshtastic_Telemetry HostMetricsModule::getHostMetrics()
 {
-    std::string file_line;
     meshtastic_Telemetry t = meshtastic_Telemetry_init_zero;
     t.which_variant = meshtastic_Telemetry_host_metrics_tag;
     t.variant.host_metrics = meshtastic_HostMetrics_init_zero;
 
-    if (access("/proc/uptime", R_OK) == 0) {
-        std::ifstream proc_uptime("/proc/uptime");
-        if (proc_uptime.is_open()) {
-            std::getline(proc_uptime, file_line, ' ');
-            proc_uptime.close();
-            t.variant.host_metrics.uptime_seconds = stoul(file_line);
-        }
+    const char *text = procUptime.read();
+    if (text)
+        t.variant.host_metrics.uptime_seconds = strtoul(text, NULL, 10);
+
+    std::error_code ec;
+    std::filesystem::space_info root = std::filesystem::space("/", ec);
+    if (!ec)
+        t.variant.host_metrics.diskfree1_bytes = root.available;
+
+    text = procMeminfo.read();
+    const char *available = text ? strstr(text, "MemAvailable:") : nullptr;
+    if (available)
+        t.variant.host_metrics.freemem_bytes = strtoull(available + strlen("MemAvailable:"), NULL, 10) * 1024;
+
+    text = procLoadavg.read();
+    if (text) {
+        char *end;
+        t.variant.host_metrics.load1 = strtof(text, &end) * 100;
+        t.variant.host_metrics.load5 = strtof(end, &end) * 100;
+        t.variant.host_metrics.load15 = strtof(end, &end) * 100;
     }
 
-    std::filesystem::space_info root = std::filesystem::space("/");
-    t.variant.host_metrics.diskfree1_bytes = root.available;
-
-    if (access("/proc/meminfo", R_OK) == 0) {
-        std::ifstream proc_meminfo("/proc/meminfo");
-        if (proc_meminfo.is_open()) {
-            do {
-                std::getline(proc_meminfo, file_line);
-            } while (file_line.find("MemAvailable") == std::string::npos);
-            proc_meminfo.close();
-            t.variant.host_metrics.freemem_bytes = stoull(file_line.substr(file_line.find_first_of("0123456789"))) * 1024;
-        }
+    if (userCommandResult.length() > 1) {
+        strncpy(t.variant.host_metrics.user_string, userCommandResult.c_str(), sizeof(t.variant.host_metrics.user_string));
+        t.variant.host_metrics.user_string[sizeof(t.variant.host_metrics.user_string) - 1] = '\0';
+        t.variant.host_metrics.has_user_string = true;
     }
-    if (access("/proc/loadavg", R_OK) == 0) {
-        std::ifstream proc_loadavg("/proc/loadavg");
-        if (proc_loadavg.is_open()) {
-            std::getline(proc_loadavg, file_line, ' ');
-            t.variant.host_metrics.load1 = stof(file_line) * 100;
-            std::getline(proc_loadavg, file_line, ' ');
-            t.variant.host_metrics.load5 = stof(file_line) * 100;
-            std::getline(proc_loadavg, file_line, ' ');
-            t.variant.host_metrics.load15 = stof(file_line) * 100;
-            proc_loadavg.close();
-        }
+    return t;
+}
+
+// Run the UserStringCommand through the shell, with its output on a pipe we can poll. False if there's nothing to wait for
+bool HostMetricsModule::startUserCommand()
+{
+    if (settingsStrings[hostMetrics_user_command] == "")
+        return false;
+
+    int fds[2];
+    if (pipe2(fds, O_CLOEXEC) < 0) {
+        LOG_ERROR("HostMetrics can't create a pipe: %s", strerror(errno));
+        return false;
     }
-    if (settingsStrings[hostMetrics_user_command] != "") {
-        std::string userCommandResult = exec(settingsStrings[hostMetrics_user_command].c_str());
-        if (userCommandResult.length() > 1) {
-            strncpy(t.variant.host_metrics.user_string, userCommandResult.c_str(), sizeof(t.variant.host_metrics.user_string));
-            t.variant.host_metrics.user_string[sizeof(t.variant.host_metrics.user_string) - 1] = '\0';
-            t.variant.host_metrics.has_user_string = true;
-        }
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+    const char *argv[] = {"sh", "-c", settingsStrings[hostMetrics_user_command].c_str(), NULL};
+    int err = posix_spawn(&userCommandPid, "/bin/sh", &actions, NULL, (char *const *)argv, environ);
+    posix_spawn_file_actions_destroy(&actions);
+    close(fds[1]);
+    if (err) {
+        LOG_ERROR("HostMetrics can't run UserStringCommand: %s", strerror(err));
+        userCommandPid = -1;
+        close(fds[0]);
+        return false;
     }
-    return t;
+
+    fcntl(fds[0], F_SETFL, O_NONBLOCK);
+    userCommandFd = fds[0];
+    userCommandStarted = millis();
+    userCommandOutput.clear();
+    return true;
+}
+
+// Collect what the UserStringCommand has written. Once it finishes, or runs out of time, its output becomes the result
+bool HostMetricsModule::pollUserCommand()
+{
+    if (userCommandPid < 0)
+        return false;
+
+    char buf[256];
+    ssize_t n;
+    while ((n = read(userCommandFd, buf, sizeof(buf))) > 0) {
+        // Only as much as fits in user_string is ever sent
+        size_t room = sizeof(meshtastic_HostMetrics::user_string) - userCommandOutput.size();
+        userCommandOutput.append(buf, (size_t)n < room ? n : room);
+    }
+    bool done = n == 0 || (errno != EAGAIN && errno != EINTR);
+    if (!done && millis() - userCommandStarted < HOST_METRICS_COMMAND_TIMEOUT_MS)
+        return true;
+
+    if (done)
+        userCommandResult = userCommandOutput;
+    else {
+        LOG_WARN("HostMetrics UserStringCommand took over %ums, killed it", HOST_METRICS_COMMAND_TIMEOUT_MS);
+        kill(userCommandPid, SIGKILL);
+    }
+    close(userCommandFd);
+    waitpid(userCommandPid, NULL, 0);
+    userCommandFd = -1;
+    userCommandPid = -1;
+    return false;
+}
+
+// meshtasticd's own share of the CPU since the last report, and its resident memory
+void HostMetricsModule::logOwnUsage()
+{
+    const char *stat = procSelfStat.read();
+    const char *statm = procSelfStatm.read();
+    if (!stat || !statm)
+        return;
+
+    // utime and stime are the 12th and 13th fields after the command name, which may itself contain spaces
+    const char *fields = strrchr(stat, ')');
+    if (!fields)
+        return;
+    unsigned long utime = 0, stime = 0;
+    if (sscanf(fields + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu", &utime, &stime) != 2)
+        return;
+    unsigned long residentPages = 0;
+    sscanf(statm, "%*u %lu", &residentPages);
+
+    unsigned long long ticks = (unsigned long long)utime + stime;
+    uint32_t now = millis();
+    if (lastCpuMs) {
+        float seconds = (now - lastCpuMs) / 1000.0f;
+        float cpu = seconds > 0 ? 100.0f * (ticks - lastCpuTicks) / sysconf(_SC_CLK_TCK) / seconds : 0;
+        LOG_INFO("meshtasticd: cpu=%.1f%%, rss=%lukB", cpu, residentPages * (sysconf(_SC_PAGESIZE) / 1024));
+    } else
+        LOG_INFO("meshtasticd: rss=%lukB", residentPages * (sysconf(_SC_PAGESIZE) / 1024));
+    lastCpuTicks = ticks;
+    lastCpuMs = now;
 }
 
 bool HostMetricsModule::sendMetrics()
@@ -130,6 +259,10 @@ bool HostMetricsModule::sendMetrics()
              static_cast<float>(telemetry.variant.host_metrics.load5) / 100,
              static_cast<float>(telemetry.variant.host_metrics.load15) / 100);
     // telemetry.variant.host_metrics.has_user_string ? telemetry.variant.host_metrics.user_string : "");
+    // The mesh only gets the HostMetrics fields, where the CPU went stays in our own log
+    logOwnUsage();
+    if (perfCountersEnabled())
+        perfCountersLog();
 
     meshtastic_MeshPacket *p = allocDataProtobuf(telemetry);
     p->to = NODENUM_BROADCAST;
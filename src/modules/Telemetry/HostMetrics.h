@@ -1,6 +1,13 @@
 #pragma once
 #include "../mesh/generated/meshtastic/telemetry.pb.h"
 #include "ProtobufModule.h"
+#include <string>
+#include <sys/types.h>
+
+// How long the UserStringCommand may run before it is killed, and the last result it gave is sent instead
+#ifndef HOST_METRICS_COMMAND_TIMEOUT_MS
+#define HOST_METRICS_COMMAND_TIMEOUT_MS (10 * 1000)
+#endif
 
 class HostMetricsModule : private concurrency::OSThread, public ProtobufModule<meshtastic_Telemetry>
 {
@@ -12,6 +19,7 @@ class HostMetricsModule : private concurrency::OSThread, public ProtobufModule<m
         : concurrency::OSThread("HostMetrics"),
           ProtobufModule("HostMetrics", meshtastic_PortNum_TELEMETRY_APP, &meshtastic_Telemetry_msg)
     {
+        setPriority(concurrency::PRIORITY_BACKGROUND);
         uptimeWrapCount = 0;
         uptimeLastMs = millis();
         nodeStatusObserver.observe(&nodeStatus->onNewStatus);
@@ -34,6 +42,19 @@ class HostMetricsModule : private concurrency::OSThread, public ProtobufModule<m
   private:
     meshtastic_Telemetry getHostMetrics();
 
+    // The UserStringCommand runs alongside us, polled from runOnce, so a slow script can't stall the mesh
+    bool startUserCommand();
+    bool pollUserCommand(); // True while still running
+    void logOwnUsage();     // CPU and memory of this process, since the last report
+
+    pid_t userCommandPid = -1;
+    int userCommandFd = -1;
+    uint32_t userCommandStarted = 0;
+    std::string userCommandOutput; // So far, from the running command
+    std::string userCommandResult; // From the last run that finished
+    unsigned long long lastCpuTicks = 0;
+    uint32_t lastCpuMs = 0;
+
     uint32_t lastSentToMesh = 0;
     uint32_t uptimeWrapCount;
     uint32_t uptimeLastMs;
@@ -87,6 +87,12 @@ int32_t PowerTelemetryModule::runOnce()
         if (!moduleConfig.telemetry.power_measurement_enabled)
             return disable();
 
+        if (aggregate.wantSample()) {
+            meshtastic_Telemetry m = meshtastic_Telemetry_init_zero;
+            if (getPowerTelemetry(&m))
+                aggregate.add(&m.variant.power_metrics);
+        }
+
         if (((lastSentToMesh == 0) || !Throttle::isWithinTimespanMs(lastSentToMesh, sendToMeshIntervalMs)) &&
             airTime->isTxAllowedAirUtil()) {
             sendTelemetry();
@@ -245,6 +251,10 @@ bool PowerTelemetryModule::sendTelemetry(NodeNum dest, bool phoneOnly)
     m.which_variant = meshtastic_Telemetry_power_metrics_tag;
     m.time = getTime();
     if (getPowerTelemetry(&m)) {
+        if (!phoneOnly && aggregate.size()) {
+            aggregate.add(&m.variant.power_metrics);
+            LOG_DEBUG("Report the aggregate of %u samples", aggregate.takeInto(&m.variant.power_metrics));
+        }
         LOG_INFO("Send: ch1_voltage=%f, ch1_current=%f, ch2_voltage=%f, ch2_current=%f, "
                  "ch3_voltage=%f, ch3_current=%f",
                  m.variant.power_metrics.ch1_voltage, m.variant.power_metrics.ch1_current, m.variant.power_metrics.ch2_voltage,
@@ -7,6 +7,7 @@
 #include "../mesh/generated/meshtastic/telemetry.pb.h"
 #include "NodeDB.h"
 #include "ProtobufModule.h"
+#include "TelemetryAggregator.h"
 #include <OLEDDisplay.h>
 #include <OLEDDisplayUi.h>
 
@@ -20,6 +21,7 @@ class PowerTelemetryModule : private concurrency::OSThread, public ProtobufModul
         : concurrency::OSThread("PowerTelemetry"),
           ProtobufModule("PowerTelemetry", meshtastic_PortNum_TELEMETRY_APP, &meshtastic_Telemetry_msg)
     {
+        setPriority(concurrency::PRIORITY_BACKGROUND);
         lastMeasurementPacket = nullptr;
         nodeStatusObserver.observe(&nodeStatus->onNewStatus);
         setIntervalFromNow(10 * 1000);
@@ -53,6 +55,7 @@ class PowerTelemetryModule : private concurrency::OSThread, public ProtobufModul
     uint32_t sendToPhoneIntervalMs = SECONDS_IN_MINUTE * 1000; // Send to phone every minute
     uint32_t lastSentToMesh = 0;
     uint32_t lastSentToPhone = 0;
+    TelemetryAggregator aggregate = TelemetryAggregator(meshtastic_PowerMetrics_fields);
     uint32_t sensor_read_error_count = 0;
 };
 
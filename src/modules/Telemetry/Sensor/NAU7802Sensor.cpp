@@ -12,6 +12,8 @@
 #include <pb_decode.h>
 #include <pb_encode.h>
 
+#define NAU7802_POWER_UP_MS 100 // Usually has a sample ready by then
+
 meshtastic_Nau7802Config nau7802config = meshtastic_Nau7802Config_init_zero;
 
 NAU7802Sensor::NAU7802Sensor() : TelemetrySensor(meshtastic_TelemetrySensorType_NAU7802, "NAU7802") {}
@@ -34,10 +36,18 @@ int32_t NAU7802Sensor::runOnce()
 
 void NAU7802Sensor::setup() {}
 
+uint32_t NAU7802Sensor::startConversion()
+{
+    nau7802.powerUp();
+    beginConversion();
+    return NAU7802_POWER_UP_MS;
+}
+
 bool NAU7802Sensor::getMetrics(meshtastic_Telemetry *measurement)
 {
     LOG_DEBUG("NAU7802 getMetrics");
-    nau7802.powerUp();
+    if (!awaitConversion(NAU7802_POWER_UP_MS))
+        nau7802.powerUp();
     // Wait for the sensor to become ready for one second max
     uint32_t start = millis();
     while (!nau7802.available()) {
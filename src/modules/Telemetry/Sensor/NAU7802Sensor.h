@@ -22,6 +22,7 @@ class NAU7802Sensor : public TelemetrySensor
     NAU7802Sensor();
     virtual int32_t runOnce() override;
     virtual bool getMetrics(meshtastic_Telemetry *measurement) override;
+    virtual uint32_t startConversion() override;
     void tare();
     void calibrate(float weight);
     AdminMessageHandleResult handleAdminMessage(const meshtastic_MeshPacket &mp, meshtastic_AdminMessage *request,
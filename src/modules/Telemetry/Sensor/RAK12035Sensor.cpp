@@ -75,6 +75,13 @@ void RAK12035Sensor::setup()
     LOG_INFO("Wet calibration value is %d", hundred_val);
 }
 
+uint32_t RAK12035Sensor::startConversion()
+{
+    sensor.sensor_on();
+    beginConversion();
+    return 200;
+}
+
 bool RAK12035Sensor::getMetrics(meshtastic_Telemetry *measurement)
 {
     // TODO:: read and send metrics for up to 2 additional soil monitors if present.
@@ -89,8 +96,10 @@ bool RAK12035Sensor::getMetrics(meshtastic_Telemetry *measurement)
     uint16_t temp = 0;
     bool success = false;
 
-    sensor.sensor_on();
-    delay(200);
+    if (!awaitConversion(200)) {
+        sensor.sensor_on();
+        delay(200);
+    }
     success = sensor.get_sensor_moisture(&moisture);
     delay(200);
     success &= sensor.get_sensor_temperature(&temp);
@@ -24,5 +24,6 @@ class RAK12035Sensor : public TelemetrySensor
     RAK12035Sensor();
     virtual int32_t runOnce() override;
     virtual bool getMetrics(meshtastic_Telemetry *measurement) override;
+    virtual uint32_t startConversion() override;
 };
 #endif
@@ -6,6 +6,8 @@
 #include "RCWL9620Sensor.h"
 #include "TelemetrySensor.h"
 
+#define RCWL9620_MEASURE_MS 100 // Time for the echo to come back and be worked out
+
 RCWL9620Sensor::RCWL9620Sensor() : TelemetrySensor(meshtastic_TelemetrySensorType_RCWL9620, "RCWL9620") {}
 
 int32_t RCWL9620Sensor::runOnce()
@@ -21,6 +23,13 @@ int32_t RCWL9620Sensor::runOnce()
 
 void RCWL9620Sensor::setup() {}
 
+uint32_t RCWL9620Sensor::startConversion()
+{
+    startMeasure();
+    beginConversion();
+    return RCWL9620_MEASURE_MS;
+}
+
 bool RCWL9620Sensor::getMetrics(meshtastic_Telemetry *measurement)
 {
     measurement->variant.environment_metrics.has_distance = true;
@@ -39,18 +48,25 @@ void RCWL9620Sensor::begin(TwoWire *wire, uint8_t addr, uint8_t sda, uint8_t scl
     _wire->begin();
 }
 
-float RCWL9620Sensor::getDistance()
+void RCWL9620Sensor::startMeasure()
 {
-    uint32_t data = 0;
-    uint8_t b1 = 0, b2 = 0, b3 = 0;
-
     LOG_DEBUG("[RCWL9620] Start measure command");
 
     _wire->beginTransmission(_addr);
     _wire->write(0x01); // À tester aussi sans cette ligne si besoin
     uint8_t result = _wire->endTransmission();
     LOG_DEBUG("[RCWL9620] endTransmission result = %d", result);
-    delay(100); // délai pour laisser le capteur répondre
+}
+
+float RCWL9620Sensor::getDistance()
+{
+    uint32_t data = 0;
+    uint8_t b1 = 0, b2 = 0, b3 = 0;
+
+    if (!awaitConversion(RCWL9620_MEASURE_MS)) {
+        startMeasure();
+        delay(RCWL9620_MEASURE_MS); // délai pour laisser le capteur répondre
+    }
 
     LOG_DEBUG("[RCWL9620] Read i2c data:");
     _wire->requestFrom(_addr, (uint8_t)3);
@@ -18,12 +18,14 @@ class RCWL9620Sensor : public TelemetrySensor
   protected:
     virtual void setup() override;
     void begin(TwoWire *wire = &Wire, uint8_t addr = 0x57, uint8_t sda = -1, uint8_t scl = -1, uint32_t speed = 200000UL);
+    void startMeasure();
     float getDistance();
 
   public:
     RCWL9620Sensor();
     virtual int32_t runOnce() override;
     virtual bool getMetrics(meshtastic_Telemetry *measurement) override;
+    virtual uint32_t startConversion() override;
 };
 
 #endif
\ No newline at end of file
@@ -44,6 +44,23 @@ class TelemetrySensor
     }
     virtual void setup() = 0;
 
+    uint32_t conversionStarted = 0; // millis() of a startConversion() getMetrics() hasn't read yet, 0 if there is none
+
+    /// Mark a conversion started by startConversion()
+    void beginConversion() { conversionStarted = millis() | 1; }
+
+    /// Wait out whatever is left of a conversion taking msec, @return false if startConversion() wasn't called first
+    bool awaitConversion(uint32_t msec)
+    {
+        if (!conversionStarted)
+            return false;
+        uint32_t elapsed = millis() - conversionStarted;
+        if (elapsed < msec)
+            delay(msec - elapsed);
+        conversionStarted = 0;
+        return true;
+    }
+
   public:
     virtual AdminMessageHandleResult handleAdminMessage(const meshtastic_MeshPacket &mp, meshtastic_AdminMessage *request,
                                                         meshtastic_AdminMessage *response)
@@ -58,6 +75,12 @@ class TelemetrySensor
     virtual bool isRunning() { return status > 0; }
 
     virtual bool getMetrics(meshtastic_Telemetry *measurement) = 0;
+
+    /**
+     * Kick off a measurement so the next getMetrics() finds it ready instead of blocking while the sensor converts
+     * @return msec the conversion takes, 0 for sensors that read instantly (getMetrics() works either way)
+     */
+    virtual uint32_t startConversion() { return 0; }
 };
 
 #endif
\ No newline at end of file
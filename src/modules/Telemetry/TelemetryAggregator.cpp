@@ -0,0 +1,90 @@
+#include "TelemetryAggregator.h"
+#include "NodeDB.h"
+#include <Throttle.h>
+#include <math.h>
+#include <pb_common.h>
+
+TelemetryAggregator::TelemetryAggregator(const pb_msgdesc_t *fields, uint32_t maxTags, uint32_t minTags, uint32_t latestTags)
+    : fields(fields), maxTags(maxTags), minTags(minTags), latestTags(latestTags)
+{
+    reset();
+}
+
+bool TelemetryAggregator::wantSample() const
+{
+    if (!TELEMETRY_SAMPLE_INTERVAL_MS ||
+        (config.device.role == meshtastic_Config_DeviceConfig_Role_SENSOR && config.power.is_power_saving))
+        return false;
+    return lastSample == 0 || !Throttle::isWithinTimespanMs(lastSample, TELEMETRY_SAMPLE_INTERVAL_MS);
+}
+
+/// Only the flat optional scalars that appear in telemetry can be aggregated
+static bool isAggregatable(const pb_field_iter_t &iter)
+{
+    return PB_HTYPE(iter.type) == PB_HTYPE_OPTIONAL && iter.pSize && iter.index < TELEMETRY_AGGREGATE_MAX_FIELDS &&
+           iter.data_size == 4 && (PB_LTYPE(iter.type) == PB_LTYPE_FIXED32 || PB_LTYPE(iter.type) == PB_LTYPE_UVARINT);
+}
+
+static float readField(const pb_field_iter_t &iter)
+{
+    if (PB_LTYPE(iter.type) == PB_LTYPE_FIXED32)
+        return *(const float *)iter.pData;
+    return *(const uint32_t *)iter.pData;
+}
+
+void TelemetryAggregator::add(const void *metrics)
+{
+    pb_field_iter_t iter;
+    if (!pb_field_iter_begin_const(&iter, fields, metrics))
+        return;
+    do {
+        if (!isAggregatable(iter) || !*(const bool *)iter.pSize)
+            continue;
+        float v = readField(iter);
+        float &agg = value[iter.index];
+        uint32_t tag = TELEMETRY_TAG(iter.tag);
+        if (!count[iter.index] || (latestTags & tag))
+            agg = v;
+        else if (maxTags & tag)
+            agg = fmaxf(agg, v);
+        else if (minTags & tag)
+            agg = fminf(agg, v);
+        else
+            agg += v;
+        count[iter.index]++;
+    } while (pb_field_iter_next(&iter));
+
+    samples++;
+    lastSample = millis();
+}
+
+uint16_t TelemetryAggregator::takeInto(void *metrics)
+{
+    uint16_t folded = samples;
+    pb_field_iter_t iter;
+    if (samples && pb_field_iter_begin(&iter, fields, metrics)) {
+        do {
+            if (!isAggregatable(iter) || !count[iter.index])
+                continue;
+            float v = value[iter.index];
+            if (!((maxTags | minTags | latestTags) & TELEMETRY_TAG(iter.tag)))
+                v /= count[iter.index];
+            if (PB_LTYPE(iter.type) == PB_LTYPE_FIXED32)
+                *(float *)iter.pData = v;
+            else
+                *(uint32_t *)iter.pData = lroundf(v);
+            *(bool *)iter.pSize = true;
+        } while (pb_field_iter_next(&iter));
+    }
+    reset();
+    return folded;
+}
+
+void TelemetryAggregator::reset()
+{
+    for (size_t i = 0; i < TELEMETRY_AGGREGATE_MAX_FIELDS; i++) {
+        value[i] = 0;
+        count[i] = 0;
+    }
+    samples = 0;
+}
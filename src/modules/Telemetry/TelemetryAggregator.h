@@ -0,0 +1,48 @@
+#pragma once
+
+#include <pb.h>
+#include <stdint.h>
+
+#ifndef TELEMETRY_SAMPLE_INTERVAL_MS
+#define TELEMETRY_SAMPLE_INTERVAL_MS (60 * 1000) // How often to sample sensors between reports, 0 reports single readings
+#endif
+
+#define TELEMETRY_AGGREGATE_MAX_FIELDS 25 // Most fields in any of the *Metrics messages
+#define TELEMETRY_TAG(tag) (1UL << (tag))
+
+/**
+ * Folds the sensor samples taken between two telemetry reports into the one report we send, so the sensors can be read
+ * more often without spending any more airtime.
+ *
+ * Works on any of the flat *Metrics messages by walking its nanopb descriptor: every optional float or uint32 field that
+ * was present in at least one sample is reported as the mean of its samples, except for the fields picked in the
+ * constructor masks (by tag) which report the highest, lowest or most recent sample instead.
+ */
+class TelemetryAggregator
+{
+  public:
+    TelemetryAggregator(const pb_msgdesc_t *fields, uint32_t maxTags = 0, uint32_t minTags = 0, uint32_t latestTags = 0);
+
+    /// Is it time to take another sample (never while we deep sleep between reports)?
+    bool wantSample() const;
+
+    /// Fold in one decoded metrics struct of our message type
+    void add(const void *metrics);
+
+    /// Overwrite the fields of metrics we have samples for with their aggregate, then start a new window
+    /// @return the number of samples that were folded in
+    uint16_t takeInto(void *metrics);
+
+    uint16_t size() const { return samples; }
+
+  private:
+    const pb_msgdesc_t *fields;
+    uint32_t maxTags, minTags, latestTags;
+
+    float value[TELEMETRY_AGGREGATE_MAX_FIELDS]; // Sum, extreme or latest sample, depending on the field
+    uint16_t count[TELEMETRY_AGGREGATE_MAX_FIELDS];
+    uint16_t samples = 0;
+    uint32_t lastSample = 0;
+
+    void reset();
+};
@@ -1,5 +1,6 @@
 #include "TraceRouteModule.h"
 #include "MeshService.h"
+#include "RTC.h"
 #include "graphics/Screen.h"
 #include "graphics/ScreenFonts.h"
 #include "graphics/SharedUIDisplay.h"
@@ -31,6 +32,8 @@ void TraceRouteModule::alterReceivedProtobuf(meshtastic_MeshPacket &p, meshtasti
     else
         printRoute(r, p.to, p.from, false);
 
+    learnRoute(p, r);
+
     // Set updated route to the payload of the to be flooded packet
     p.decoded.payload.size =
         pb_encode_to_bytes(p.decoded.payload.bytes, sizeof(p.decoded.payload.bytes), &meshtastic_RouteDiscovery_msg, r);
@@ -271,6 +274,158 @@ void TraceRouteModule::printRoute(meshtastic_RouteDiscovery *r, uint32_t origin,
 #endif
 }
 
+void TraceRouteModule::learnRoute(const meshtastic_MeshPacket &p, const meshtastic_RouteDiscovery *r)
+{
+    if (p.from == 0 || isBroadcast(p.to))
+        return;
+    if (!p.decoded.request_id) {
+        // A request only went as far as us yet, unless it is for us
+        learnLeg(p.from, r->route, r->route_count, r->snr_towards, r->snr_towards_count, p.to, isToUs(&p));
+    } else {
+        // A response carries the whole way there, which we are on if we relayed the request, and the way back up to us
+        learnLeg(p.to, r->route, r->route_count, r->snr_towards, r->snr_towards_count, p.from, true);
+        learnLeg(p.from, r->route_back, r->route_back_count, r->snr_back, r->snr_back_count, p.to, isToUs(&p));
+    }
+}
+
+void TraceRouteModule::learnLeg(NodeNum from, const uint32_t *route, pb_size_t routeCount, const int8_t *snr,
+                                pb_size_t snrCount, NodeNum to, bool reachedTo)
+{
+    NodeNum seq[ROUTE_SIZE + 2];
+    uint8_t len = 0;
+    seq[len++] = from;
+    for (pb_size_t i = 0; i < routeCount && i < ROUTE_SIZE; i++)
+        seq[len++] = route[i];
+    if (reachedTo)
+        seq[len++] = to;
+    auto snrOf = [&](uint8_t link) -> int8_t { return link < snrCount ? snr[link] : INT8_MIN; };
+
+    uint8_t us = 0;
+    while (us < len && seq[us] != nodeDB->getNodeNum())
+        us++;
+    if (us == len)
+        return; // Not through us, none of it starts here
+    uint32_t now = millis();
+
+    // Everything before us reached us through seq[us - 1], so we assume that is the way back to it
+    int8_t worst = INT8_MAX;
+    for (int i = (int)us - 1; i >= 0; i--) {
+        if (snrOf(i) != INT8_MIN && snrOf(i) < worst)
+            worst = snrOf(i);
+        if (router && seq[us - 1] != NODENUM_BROADCAST && seq[i] != NODENUM_BROADCAST)
+            router->learnRouteFromTraceroute(seq[i], seq[us - 1], worst == INT8_MAX ? INT8_MIN : worst);
+    }
+    // Everything after us was reached through seq[us + 1]
+    worst = INT8_MAX;
+    for (uint8_t i = us + 1; i < len; i++) {
+        if (snrOf(i - 1) != INT8_MIN && snrOf(i - 1) < worst)
+            worst = snrOf(i - 1);
+        if (router && seq[us + 1] != NODENUM_BROADCAST && seq[i] != NODENUM_BROADCAST)
+            router->learnRouteFromTraceroute(seq[i], seq[us + 1], worst == INT8_MAX ? INT8_MIN : worst);
+    }
+
+    // The ends keep the whole way between them and us
+    TracedPath *path;
+    if (us > 0 && (path = findPath(seq[0], true))) {
+        TracedLeg &leg = path->back;
+        leg.valid = true;
+        leg.lastUpdate = now;
+        leg.hopCount = us - 1;
+        for (uint8_t i = 0; i < leg.hopCount; i++)
+            leg.hops[i] = seq[i + 1];
+        for (uint8_t i = 0; i <= leg.hopCount; i++)
+            leg.snr[i] = snrOf(i);
+    }
+    if (reachedTo && us < len - 1 && (path = findPath(seq[len - 1], true))) {
+        TracedLeg &leg = path->towards;
+        leg.valid = true;
+        leg.lastUpdate = now;
+        leg.hopCount = len - us - 2;
+        for (uint8_t i = 0; i < leg.hopCount; i++)
+            leg.hops[i] = seq[us + 1 + i];
+        for (uint8_t i = 0; i <= leg.hopCount; i++)
+            leg.snr[i] = snrOf(us + i);
+    }
+}
+
+TracedPath *TraceRouteModule::findPath(NodeNum dest, bool create)
+{
+    if (dest == 0 || isBroadcast(dest))
+        return NULL;
+
+    uint32_t now = millis();
+    auto age = [now](const TracedPath &path) {
+        uint32_t towards = path.towards.valid ? now - path.towards.lastUpdate : UINT32_MAX;
+        uint32_t back = path.back.valid ? now - path.back.lastUpdate : UINT32_MAX;
+        return towards < back ? towards : back;
+    };
+    TracedPath *oldest = NULL;
+    for (TracedPath &path : paths) {
+        if (path.dest == dest)
+            return &path;
+        if (!oldest || (oldest->dest && (!path.dest || age(path) > age(*oldest))))
+            oldest = &path;
+    }
+    if (!create)
+        return NULL;
+
+    memset(oldest, 0, sizeof(*oldest));
+    oldest->dest = dest;
+    return oldest;
+}
+
+int TraceRouteModule::hopsTowards(NodeNum dest, uint32_t maxAgeMsec)
+{
+    const TracedPath *path = findPath(dest, false);
+    if (!path || !path->towards.valid || millis() - path->towards.lastUpdate > maxAgeMsec)
+        return -1;
+    return path->towards.hopCount;
+}
+
+bool TraceRouteModule::replyFromCache(const meshtastic_MeshPacket &req)
+{
+#if TRACEROUTE_CACHE_REPLY_SECS
+    if (req.which_payload_variant != meshtastic_MeshPacket_decoded_tag || req.decoded.portnum != ourPortNum ||
+        req.decoded.request_id || isBroadcast(req.to) || req.to == nodeDB->getNodeNum())
+        return false;
+
+    TracedPath *path = findPath(req.to, false);
+    uint32_t now = millis();
+    if (!path || !path->towards.valid || !path->back.valid ||
+        now - path->towards.lastUpdate > TRACEROUTE_CACHE_REPLY_SECS * 1000UL ||
+        now - path->back.lastUpdate > TRACEROUTE_CACHE_REPLY_SECS * 1000UL)
+        return false;
+
+    meshtastic_RouteDiscovery r = meshtastic_RouteDiscovery_init_zero;
+    r.route_count = path->towards.hopCount;
+    memcpy(r.route, path->towards.hops, r.route_count * sizeof(r.route[0]));
+    r.snr_towards_count = path->towards.hopCount < ROUTE_SIZE ? path->towards.hopCount + 1 : ROUTE_SIZE;
+    memcpy(r.snr_towards, path->towards.snr, r.snr_towards_count);
+    r.route_back_count = path->back.hopCount;
+    memcpy(r.route_back, path->back.hops, r.route_back_count * sizeof(r.route_back[0]));
+    r.snr_back_count = path->back.hopCount < ROUTE_SIZE ? path->back.hopCount + 1 : ROUTE_SIZE;
+    memcpy(r.snr_back, path->back.snr, r.snr_back_count);
+
+    LOG_INFO("Answer traceroute to 0x%x from the path traced %us ago", req.to,
+             (now - (path->towards.lastUpdate < path->back.lastUpdate ? path->towards.lastUpdate : path->back.lastUpdate)) /
+                 1000);
+    meshtastic_MeshPacket *p = allocDataProtobuf(r);
+    p->from = req.to;
+    p->to = nodeDB->getNodeNum();
+    p->channel = req.channel;
+    p->decoded.request_id = req.id;
+    p->hop_start = config.lora.hop_limit > path->back.hopCount ? config.lora.hop_limit : path->back.hopCount;
+    p->hop_limit = p->hop_start - path->back.hopCount;
+    p->rx_time = getValidTime(RTCQualityFromNet);
+    if (path->back.snr[path->back.hopCount] != INT8_MIN)
+        p->rx_snr = path->back.snr[path->back.hopCount] / 4.0f;
+    service->sendToPhone(p);
+    return true;
+#else
+    return false;
+#endif
+}
+
 meshtastic_MeshPacket *TraceRouteModule::allocReply()
 {
     assert(currentRequest);
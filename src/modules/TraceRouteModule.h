@@ -10,6 +10,33 @@
 
 #define ROUTE_SIZE sizeof(((meshtastic_RouteDiscovery *)0)->route) / sizeof(((meshtastic_RouteDiscovery *)0)->route[0])
 
+// Nodes at the far end of traceroutes through us whose paths we remember
+#ifndef TRACEROUTE_PATH_CACHE_SIZE
+#define TRACEROUTE_PATH_CACHE_SIZE 8
+#endif
+
+// A traceroute from the phone is answered from the cache if both ways were traced this recently, 0 never does
+#ifndef TRACEROUTE_CACHE_REPLY_SECS
+#define TRACEROUTE_CACHE_REPLY_SECS 60
+#endif
+
+/**
+ * The relays one way between us and a node, in the order a RouteDiscovery lists them: from the sending end, with snr[i]
+ * heard by the node after hops[i - 1] and snr[hopCount] by the receiving end. In dB * 4, INT8_MIN if unknown.
+ */
+struct TracedLeg {
+    bool valid;
+    uint32_t lastUpdate;
+    uint8_t hopCount;
+    NodeNum hops[ROUTE_SIZE];
+    int8_t snr[ROUTE_SIZE + 1];
+};
+
+struct TracedPath {
+    NodeNum dest; // 0 if unused
+    TracedLeg towards, back;
+};
+
 /**
  * A module that traces the route to a certain destination node
  */
@@ -32,6 +59,15 @@ class TraceRouteModule : public ProtobufModule<meshtastic_RouteDiscovery>,
 
     const char *getNodeName(NodeNum node);
 
+    /**
+     * Answer a traceroute the phone is sending from the paths traced through us recently
+     * @return true if the phone got its answer and the request needn't go out
+     */
+    bool replyFromCache(const meshtastic_MeshPacket &req);
+
+    /// Relays between us and dest on the way there, from a traceroute through us at most maxAgeMsec ago, -1 if none
+    int hopsTowards(NodeNum dest, uint32_t maxAgeMsec);
+
     virtual bool wantUIFrame() override { return shouldDraw(); }
     virtual Observable<const UIFrameEvent *> *getUIFrameObservable() override { return this; }
 
@@ -58,6 +94,19 @@ class TraceRouteModule : public ProtobufModule<meshtastic_RouteDiscovery>,
        Set dest to the ID of its destination, or NODENUM_BROADCAST if it has not yet arrived there. */
     void printRoute(meshtastic_RouteDiscovery *r, uint32_t origin, uint32_t dest, bool isTowardsDestination);
 
+    /// Seed next hops from both ways of a RouteDiscovery that came through us, and remember the paths to its ends
+    void learnRoute(const meshtastic_MeshPacket &p, const meshtastic_RouteDiscovery *r);
+
+    /* Learn from one way of a traced route: from, then the relays in route, then to if it got there.
+       snr[i] is what the node after route[i - 1] heard, as in RouteDiscovery. */
+    void learnLeg(NodeNum from, const uint32_t *route, pb_size_t routeCount, const int8_t *snr, pb_size_t snrCount,
+                  NodeNum to, bool reachedTo);
+
+    /** @return the cached paths of dest, optionally claiming the least recently traced entry if there is none */
+    TracedPath *findPath(NodeNum dest, bool create);
+
+    TracedPath paths[TRACEROUTE_PATH_CACHE_SIZE] = {};
+
     TraceRouteRunState runState = TRACEROUTE_STATE_IDLE;
     unsigned long lastTraceRouteTime = 0;
     unsigned long resultShowTime = 0;
@@ -2,10 +2,10 @@
 #include "NodeDB.h"
 #include "PowerFSM.h"
 #include "configuration.h"
+#include "gps/RTC.h"
 #include "graphics/draw/CompassRenderer.h"
 
 #if HAS_SCREEN
-#include "gps/RTC.h"
 #include "graphics/Screen.h"
 #include "graphics/TimeFormatters.h"
 #include "graphics/draw/NodeListRenderer.h"
@@ -14,16 +14,40 @@
 
 WaypointModule *waypointModule;
 
+WaypointModule::WaypointModule() : SinglePortModule("waypoint", meshtastic_PortNum_WAYPOINT_APP)
+{
+    store.load();
+
+    // Carry on showing the waypoint we showed before rebooting
+    meshtastic_Waypoint wp;
+    memset(&wp, 0, sizeof(wp));
+    if (devicestate.has_rx_waypoint && pb_decode_from_bytes(devicestate.rx_waypoint.decoded.payload.bytes,
+                                                            devicestate.rx_waypoint.decoded.payload.size,
+                                                            &meshtastic_Waypoint_msg, &wp))
+        latestId = wp.id;
+}
+
 ProcessMessage WaypointModule::handleReceived(const meshtastic_MeshPacket &mp)
 {
 #if defined(DEBUG_PORT) && !defined(DEBUG_MUTE)
     auto &p = mp.decoded;
     LOG_INFO("Received waypoint msg from=0x%0x, id=0x%x, msg=%.*s", mp.from, mp.id, p.payload.size, p.payload.bytes);
 #endif
+    meshtastic_Waypoint wp;
+    memset(&wp, 0, sizeof(wp));
+    if (!pb_decode_from_bytes(mp.decoded.payload.bytes, mp.decoded.payload.size, &meshtastic_Waypoint_msg, &wp)) {
+        LOG_ERROR("Failed to decode waypoint");
+        return ProcessMessage::CONTINUE;
+    }
+    store.purge(getTime());
+    if (!store.update(wp, getFrom(&mp), getTime()))
+        return ProcessMessage::CONTINUE;
+
     // We only store/display messages destined for us.
     // Keep a copy of the most recent text message.
     devicestate.rx_waypoint = mp;
     devicestate.has_rx_waypoint = true;
+    latestId = wp.id;
 
     powerFSM.trigger(EVENT_RECEIVED_MSG);
 
@@ -58,25 +82,9 @@ bool WaypointModule::shouldDraw()
     if (!devicestate.has_rx_waypoint)
         return false;
 
-    // Decode the message, to find the expiration time (is waypoint still valid)
-    // This handles "deletion" as well as expiration
-    meshtastic_Waypoint wp;
-    memset(&wp, 0, sizeof(wp));
-    if (pb_decode_from_bytes(devicestate.rx_waypoint.decoded.payload.bytes, devicestate.rx_waypoint.decoded.payload.size,
-                             &meshtastic_Waypoint_msg, &wp)) {
-        // Valid waypoint
-        if (wp.expire > getTime())
-            return devicestate.has_rx_waypoint = true;
-
-        // Expired, or deleted
-        else
-            return devicestate.has_rx_waypoint = false;
-    }
-
-    // If decoding failed
-    LOG_ERROR("Failed to decode waypoint");
-    devicestate.has_rx_waypoint = false;
-    return false;
+    // The store has already dropped it if it expired or was deleted
+    store.purge(getTime());
+    return devicestate.has_rx_waypoint = store.find(latestId) != nullptr;
 #else
     return false;
 #endif
@@ -96,16 +104,16 @@ void WaypointModule::drawFrame(OLEDDisplay *display, OLEDDisplayUiState *state,
     if (config.display.displaymode != meshtastic_Config_DisplayConfig_DisplayMode_INVERTED)
         display->fillRect(0 + x, 0 + y, x + display->getWidth(), y + FONT_HEIGHT_SMALL);
 
-    // Decode the waypoint
+    // Look up the waypoint, no need to decode it again
     const meshtastic_MeshPacket &mp = devicestate.rx_waypoint;
-    meshtastic_Waypoint wp;
-    memset(&wp, 0, sizeof(wp));
-    if (!pb_decode_from_bytes(mp.decoded.payload.bytes, mp.decoded.payload.size, &meshtastic_Waypoint_msg, &wp)) {
+    const WaypointStore::Entry *entry = store.find(latestId);
+    if (!entry) {
         // This *should* be caught by shouldDrawWaypoint, but we'll short-circuit here just in case
-        display->drawStringMaxWidth(0 + x, 0 + y, x + display->getWidth(), "Couldn't decode waypoint");
+        display->drawStringMaxWidth(0 + x, 0 + y, x + display->getWidth(), "Waypoint expired");
         devicestate.has_rx_waypoint = false;
         return;
     }
+    const meshtastic_Waypoint &wp = entry->waypoint;
 
     // Get timestamp info. Will pass as a field to drawColumns
     static char lastStr[20];
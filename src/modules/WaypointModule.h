@@ -1,6 +1,7 @@
 #pragma once
 #include "Observer.h"
 #include "SinglePortModule.h"
+#include "WaypointStore.h"
 
 /**
  * Waypoint message handling for meshtastic
@@ -11,7 +12,11 @@ class WaypointModule : public SinglePortModule, public Observable<const UIFrameE
     /** Constructor
      * name is for debugging output
      */
-    WaypointModule() : SinglePortModule("waypoint", meshtastic_PortNum_WAYPOINT_APP) {}
+    WaypointModule();
+
+    /// Every waypoint we've heard of that hasn't expired or been deleted
+    WaypointStore store;
+
 #if HAS_SCREEN
     bool shouldDraw();
 #endif
@@ -28,6 +33,9 @@ class WaypointModule : public SinglePortModule, public Observable<const UIFrameE
     virtual void drawFrame(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y) override;
 #endif
     virtual ProcessMessage handleReceived(const meshtastic_MeshPacket &mp) override;
+
+  private:
+    uint32_t latestId = 0; // Of the waypoint in devicestate.rx_waypoint, which the screen shows
 };
 
 extern WaypointModule *waypointModule;
\ No newline at end of file
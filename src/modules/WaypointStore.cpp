@@ -0,0 +1,329 @@
+#include "WaypointStore.h"
+#include "FSCommon.h"
+#include "SPILock.h"
+#include "SafeFile.h"
+#include "configuration.h"
+#include "gps/GeoCoord.h"
+#include <ErriezCRC32.h>
+#include <algorithm>
+#include <math.h>
+#include <pb_decode.h>
+#include <pb_encode.h>
+
+// Meters per unit of latitude_i, rounded down a little from GeoCoord's earth radius, so it never overstates a distance
+#define WAYPOINT_METERS_PER_LATITUDE_I 0.0111f
+
+// Journal records are [type][length][from][rxTime][Waypoint protobuf][crc32 of everything before it]
+#define WAYPOINT_RECORD_HEADER (2 + sizeof(NodeNum) + sizeof(uint32_t))
+#define WAYPOINT_RECORD_MAX (WAYPOINT_RECORD_HEADER + meshtastic_Waypoint_size + sizeof(uint32_t))
+
+static bool hasPosition(const meshtastic_Waypoint &wp)
+{
+    return wp.has_latitude_i && wp.has_longitude_i;
+}
+
+bool WaypointStore::update(const meshtastic_Waypoint &wp, NodeNum from, uint32_t now)
+{
+    auto it = byId.find(wp.id);
+    if (it != byId.end() && it->second.waypoint.locked_to && it->second.waypoint.locked_to != from) {
+        LOG_WARN("Waypoint 0x%x is locked to 0x%x, ignore change from 0x%x", wp.id, it->second.waypoint.locked_to, from);
+        return false;
+    }
+
+    // An expiry of 0 never expires. Anything else in the past is a deletion
+    if (wp.expire && wp.expire <= now) {
+        if (it != byId.end()) {
+            erase(it);
+            appendJournal(WAYPOINT_JOURNAL_REMOVE, wp);
+        }
+        return true;
+    }
+
+    if (it != byId.end())
+        erase(it);
+    else if (byId.size() >= WAYPOINT_STORE_MAX)
+        evictOne();
+
+    insert({wp, from, now});
+    appendJournal(WAYPOINT_JOURNAL_UPDATE, wp);
+    return true;
+}
+
+bool WaypointStore::remove(uint32_t id)
+{
+    auto it = byId.find(id);
+    if (it == byId.end())
+        return false;
+    meshtastic_Waypoint wp = it->second.waypoint;
+    erase(it);
+    appendJournal(WAYPOINT_JOURNAL_REMOVE, wp);
+    return true;
+}
+
+const WaypointStore::Entry *WaypointStore::find(uint32_t id) const
+{
+    auto it = byId.find(id);
+    return it == byId.end() ? nullptr : &it->second;
+}
+
+const WaypointStore::Entry *WaypointStore::nearest(int32_t latitude_i, int32_t longitude_i, float *meters) const
+{
+    GeoOrigin origin(latitude_i, longitude_i);
+    const Entry *best = nullptr;
+    float bestMeters = 0;
+
+    // Walk outwards both ways from our latitude. Nothing further north or south than the best so far can beat it
+    auto start = std::lower_bound(byLatitude.begin(), byLatitude.end(), std::make_pair(latitude_i, (uint32_t)0));
+    auto up = start, down = start;
+    while (up != byLatitude.end() || down != byLatitude.begin()) {
+        float upGap = up != byLatitude.end() ? (up->first - (float)latitude_i) * WAYPOINT_METERS_PER_LATITUDE_I : INFINITY;
+        float downGap = down != byLatitude.begin() ? ((float)latitude_i - (down - 1)->first) * WAYPOINT_METERS_PER_LATITUDE_I
+                                                   : INFINITY;
+        if (best && upGap > bestMeters && downGap > bestMeters)
+            break;
+
+        uint32_t id = upGap <= downGap ? (up++)->second : (--down)->second;
+        const Entry &e = byId.at(id);
+        float d = origin.distanceTo(e.waypoint.latitude_i, e.waypoint.longitude_i);
+        if (!best || d < bestMeters) {
+            best = &e;
+            bestMeters = d;
+        }
+    }
+
+    if (best && meters)
+        *meters = bestMeters;
+    return best;
+}
+
+size_t WaypointStore::purge(uint32_t now)
+{
+    size_t purged = 0;
+    while (!expiries.empty() && expiries.front().first <= now) {
+        std::pair<uint32_t, uint32_t> due = expiries.front();
+        std::pop_heap(expiries.begin(), expiries.end(), std::greater<std::pair<uint32_t, uint32_t>>());
+        expiries.pop_back();
+
+        // Only if this is still when it expires, not a time it has been replaced since
+        auto it = byId.find(due.second);
+        if (it != byId.end() && it->second.waypoint.expire == due.first) {
+            LOG_DEBUG("Waypoint 0x%x expired", due.second);
+            erase(it);
+            purged++;
+        }
+    }
+    // Expired waypoints aren't journaled one by one, they drop out of the journal when load() or the next compaction sees them
+    return purged;
+}
+
+void WaypointStore::forEach(const std::function<void(const Entry &)> &f) const
+{
+    for (auto &kv : byId)
+        f(kv.second);
+}
+
+void WaypointStore::clear()
+{
+    byId.clear();
+    expiries.clear();
+    byLatitude.clear();
+    compactJournal();
+}
+
+void WaypointStore::insert(const Entry &e)
+{
+    const meshtastic_Waypoint &wp = e.waypoint;
+    byId[wp.id] = e;
+    if (wp.expire) {
+        expiries.emplace_back(wp.expire, wp.id);
+        std::push_heap(expiries.begin(), expiries.end(), std::greater<std::pair<uint32_t, uint32_t>>());
+        if (expiries.size() > 2 * byId.size() + 8)
+            rebuildExpiries();
+    }
+    if (hasPosition(wp)) {
+        auto at = std::make_pair(wp.latitude_i, wp.id);
+        byLatitude.insert(std::lower_bound(byLatitude.begin(), byLatitude.end(), at), at);
+    }
+}
+
+void WaypointStore::erase(std::map<uint32_t, Entry>::iterator it)
+{
+    const meshtastic_Waypoint &wp = it->second.waypoint;
+    if (hasPosition(wp)) {
+        auto at = std::lower_bound(byLatitude.begin(), byLatitude.end(), std::make_pair(wp.latitude_i, wp.id));
+        if (at != byLatitude.end() && at->second == wp.id)
+            byLatitude.erase(at);
+    }
+    byId.erase(it);
+}
+
+void WaypointStore::rebuildExpiries()
+{
+    expiries.clear();
+    for (auto &kv : byId)
+        if (kv.second.waypoint.expire)
+            expiries.emplace_back(kv.second.waypoint.expire, kv.first);
+    std::make_heap(expiries.begin(), expiries.end(), std::greater<std::pair<uint32_t, uint32_t>>());
+}
+
+void WaypointStore::evictOne()
+{
+    while (!expiries.empty()) {
+        std::pair<uint32_t, uint32_t> first = expiries.front();
+        std::pop_heap(expiries.begin(), expiries.end(), std::greater<std::pair<uint32_t, uint32_t>>());
+        expiries.pop_back();
+        auto it = byId.find(first.second);
+        if (it != byId.end() && it->second.waypoint.expire == first.first) {
+            LOG_INFO("Waypoint store full, drop 0x%x which expires soonest", first.second);
+            remove(first.second);
+            return;
+        }
+    }
+
+    // None of them expire, drop the one we heard longest ago
+    auto oldest = byId.begin();
+    for (auto it = byId.begin(); it != byId.end(); ++it)
+        if (it->second.rxTime < oldest->second.rxTime)
+            oldest = it;
+    if (oldest != byId.end()) {
+        LOG_INFO("Waypoint store full, drop 0x%x which we heard longest ago", oldest->first);
+        remove(oldest->first);
+    }
+}
+
+void WaypointStore::appendJournal(uint8_t type, const meshtastic_Waypoint &wp)
+{
+#ifdef FSCom
+    if (!journalFile)
+        return;
+    if (journalRecords >= 2 * byId.size() + 16) {
+        compactJournal(); // Already holds this change
+        return;
+    }
+
+    NodeNum from = 0;
+    uint32_t rxTime = 0;
+    auto it = byId.find(wp.id);
+    if (it != byId.end()) {
+        from = it->second.from;
+        rxTime = it->second.rxTime;
+    }
+
+    uint8_t record[WAYPOINT_RECORD_MAX];
+    pb_ostream_t stream = pb_ostream_from_buffer(record + WAYPOINT_RECORD_HEADER, meshtastic_Waypoint_size);
+    if (!pb_encode(&stream, &meshtastic_Waypoint_msg, &wp)) {
+        LOG_ERROR("Error: can't encode waypoint journal record %s", PB_GET_ERROR(&stream));
+        return;
+    }
+    record[0] = type;
+    record[1] = stream.bytes_written;
+    memcpy(record + 2, &from, sizeof(from));
+    memcpy(record + 2 + sizeof(from), &rxTime, sizeof(rxTime));
+    size_t len = WAYPOINT_RECORD_HEADER + stream.bytes_written;
+    uint32_t crc = crc32Buffer(record, len);
+    memcpy(record + len, &crc, sizeof(crc));
+    len += sizeof(crc);
+
+    concurrency::LockGuard g(spiLock);
+    FSCom.mkdir("/prefs");
+    auto f = FSCom.open(journalFile, FILE_O_APPEND);
+    if (!f) {
+        LOG_ERROR("Could not open %s", journalFile);
+        return;
+    }
+    if (f.write(record, len) != len)
+        LOG_ERROR("Can't write %s", journalFile);
+    f.close();
+    fileManifestChanged();
+    journalRecords++;
+#endif
+}
+
+/// Rewrite the journal with one record for each waypoint we have
+void WaypointStore::compactJournal()
+{
+#ifdef FSCom
+    if (!journalFile)
+        return;
+    spiLock->lock();
+    FSCom.mkdir("/prefs");
+    spiLock->unlock();
+
+    auto f = SafeFile(journalFile, true);
+    spiLock->lock();
+    for (auto &kv : byId) {
+        const Entry &e = kv.second;
+        uint8_t record[WAYPOINT_RECORD_MAX];
+        pb_ostream_t stream = pb_ostream_from_buffer(record + WAYPOINT_RECORD_HEADER, meshtastic_Waypoint_size);
+        if (!pb_encode(&stream, &meshtastic_Waypoint_msg, &e.waypoint))
+            continue;
+        record[0] = WAYPOINT_JOURNAL_UPDATE;
+        record[1] = stream.bytes_written;
+        memcpy(record + 2, &e.from, sizeof(e.from));
+        memcpy(record + 2 + sizeof(e.from), &e.rxTime, sizeof(e.rxTime));
+        size_t len = WAYPOINT_RECORD_HEADER + stream.bytes_written;
+        uint32_t crc = crc32Buffer(record, len);
+        memcpy(record + len, &crc, sizeof(crc));
+        f.write(record, len + sizeof(crc));
+    }
+    spiLock->unlock(); // SafeFile::close takes it for itself
+
+    if (f.close()) {
+        LOG_DEBUG("Compacted %s to %u waypoints", journalFile, byId.size());
+        journalRecords = byId.size();
+    } else {
+        LOG_ERROR("Can't write %s", journalFile);
+    }
+#endif
+}
+
+/**
+ * Replay stops at the first record that doesn't check out, which is what a write torn by a reset looks like.
+ * Nothing is purged here: the clock may not be set yet this early in boot.
+ */
+void WaypointStore::load()
+{
+    byId.clear();
+    expiries.clear();
+    byLatitude.clear();
+    journalRecords = 0;
+#ifdef FSCom
+    if (!journalFile)
+        return;
+    concurrency::LockGuard g(spiLock);
+    if (!FSCom.exists(journalFile))
+        return;
+    auto f = FSCom.open(journalFile, FILE_O_READ);
+    if (!f)
+        return;
+
+    uint8_t record[WAYPOINT_RECORD_MAX];
+    while (f.read(record, WAYPOINT_RECORD_HEADER) == WAYPOINT_RECORD_HEADER) {
+        size_t len = record[1];
+        if (len > meshtastic_Waypoint_size ||
+            f.read(record + WAYPOINT_RECORD_HEADER, len + sizeof(uint32_t)) != len + sizeof(uint32_t))
+            break;
+        uint32_t crc;
+        memcpy(&crc, record + WAYPOINT_RECORD_HEADER + len, sizeof(crc));
+        if (crc != crc32Buffer(record, WAYPOINT_RECORD_HEADER + len))
+            break;
+
+        Entry e;
+        memset(&e, 0, sizeof(e));
+        pb_istream_t stream = pb_istream_from_buffer(record + WAYPOINT_RECORD_HEADER, len);
+        if (!pb_decode(&stream, &meshtastic_Waypoint_msg, &e.waypoint))
+            break;
+        memcpy(&e.from, record + 2, sizeof(e.from));
+        memcpy(&e.rxTime, record + 2 + sizeof(e.from), sizeof(e.rxTime));
+
+        auto it = byId.find(e.waypoint.id);
+        if (it != byId.end())
+            erase(it);
+        if (record[0] != WAYPOINT_JOURNAL_REMOVE && byId.size() < WAYPOINT_STORE_MAX)
+            insert(e);
+        journalRecords++;
+    }
+    f.close();
+    LOG_INFO("Loaded %u waypoints from %u journal records", byId.size(), journalRecords);
+#endif
+}
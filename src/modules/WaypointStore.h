@@ -0,0 +1,100 @@
+#pragma once
+
+#include "MeshTypes.h"
+#include "mesh/generated/meshtastic/mesh.pb.h"
+#include <functional>
+#include <map>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+// How many waypoints we keep. Each costs a little under 200 bytes of heap, only once received
+#ifndef WAYPOINT_STORE_MAX
+#if defined(ARCH_PORTDUINO)
+#define WAYPOINT_STORE_MAX 1000
+#elif defined(ARCH_ESP32)
+#define WAYPOINT_STORE_MAX 200
+#else
+#define WAYPOINT_STORE_MAX 32
+#endif
+#endif
+
+// Record types in the waypoint journal
+#define WAYPOINT_JOURNAL_UPDATE 1
+#define WAYPOINT_JOURNAL_REMOVE 2
+
+#define WAYPOINT_JOURNAL_FILE "/prefs/waypoints.journal"
+
+/**
+ * Every waypoint we have heard of that hasn't expired or been deleted, up to WAYPOINT_STORE_MAX of them.
+ *
+ * Waypoints are kept by id. Beside them are a min-heap of expiry times, so purging the expired ones only ever looks at those
+ * which are due, and a list sorted by latitude, so finding the nearest waypoint only measures those within a band of
+ * latitudes that narrows as closer ones turn up.
+ *
+ * Changes go to the end of a journal file one record at a time. Once it holds mostly superseded records, it is rewritten with
+ * just the waypoints we still have.
+ */
+class WaypointStore
+{
+  public:
+    struct Entry {
+        meshtastic_Waypoint waypoint;
+        NodeNum from;    // Who last sent it
+        uint32_t rxTime; // When we last heard it, seconds since 1970
+    };
+
+    /// journalFile of nullptr keeps the store in RAM only
+    explicit WaypointStore(const char *journalFile = WAYPOINT_JOURNAL_FILE) : journalFile(journalFile) {}
+
+    /// Add or replace a waypoint, or delete it if it has already expired (which is how the apps delete one).
+    /// Waypoints locked to a node only take changes from that node.
+    /// @return false if the change was refused
+    bool update(const meshtastic_Waypoint &wp, NodeNum from, uint32_t now);
+
+    bool remove(uint32_t id);
+
+    /// The waypoint with this id, or nullptr
+    const Entry *find(uint32_t id) const;
+
+    /// The waypoint with a position nearest to this one, or nullptr if none have one
+    /// @param meters if not nullptr, how far away it is
+    const Entry *nearest(int32_t latitude_i, int32_t longitude_i, float *meters = nullptr) const;
+
+    /// Drop every waypoint which expired at or before now
+    /// @return how many were dropped
+    size_t purge(uint32_t now);
+
+    /// Call f for every waypoint, in order of id
+    void forEach(const std::function<void(const Entry &)> &f) const;
+
+    size_t size() const { return byId.size(); }
+    void clear();
+
+    /// Read back the journal, replaying each record
+    void load();
+
+  private:
+    const char *journalFile;
+    std::map<uint32_t, Entry> byId;
+
+    /// (expiry, id), with the soonest expiry at the front. Replaced and removed waypoints leave their old pairs in here, which
+    /// are skipped when they reach the front, and cleared out whenever they outnumber the live ones
+    std::vector<std::pair<uint32_t, uint32_t>> expiries;
+
+    /// (latitude_i, id) of every waypoint with a position, sorted
+    std::vector<std::pair<int32_t, uint32_t>> byLatitude;
+
+    /// Records in the journal, so we know when most are stale
+    size_t journalRecords = 0;
+
+    void insert(const Entry &e);
+    void erase(std::map<uint32_t, Entry>::iterator it);
+    void rebuildExpiries();
+
+    /// Make room for one more, by dropping the waypoint that expires soonest, or failing that the one heard longest ago
+    void evictOne();
+
+    void appendJournal(uint8_t type, const meshtastic_Waypoint &wp);
+    void compactJournal();
+};
@@ -5,6 +5,7 @@
 #include "MeshService.h"
 #include "NodeDB.h"
 #include "RTC.h"
+#include "RadioLibInterface.h"
 #include "Router.h"
 
 /*
@@ -22,6 +23,12 @@
         3) Set audio.bitrate to the desired codec2 rate (CODEC2_3200, CODEC2_2400, CODEC2_1600, CODEC2_1400, CODEC2_1300,
    CODEC2_1200, CODEC2_700, CODEC2_700B)
 
+    PIPELINE
+        The capture task reads whole codec2 frames from the I2S DMA buffers while PTT is held and queues them for the codec2
+        task, which encodes them into packets and queues those for the main thread to send. None of them waits on the
+        next, so a busy radio or main loop only fills the queues instead of losing speech. Received packets are queued for
+        the codec2 task the same way.
+
     KNOWN PROBLEMS
         * Half Duplex
         * Will not work on NRF and the Linux device targets (yet?).
@@ -30,17 +37,36 @@
 ButterworthFilter hp_filter(240, 8000, ButterworthFilter::ButterworthFilter::Highpass, 1);
 
 TaskHandle_t codec2HandlerTask;
+TaskHandle_t captureTask;
 AudioModule *audioModule;
 
-#ifdef ARCH_ESP32
-// ESP32 doesn't use that flag
-#define YIELD_FROM_ISR(x) portYIELD_FROM_ISR()
-#else
-#define YIELD_FROM_ISR(x) portYIELD_FROM_ISR(x)
-#endif
+// Around the codec2 frames and our header: the packet header and what the Data protobuf adds
+#define AUDIO_PACKET_OVERHEAD (sizeof(PacketHeader) + 5)
 
 #include "graphics/ScreenFonts.h"
 
+static void decode_packet(const AudioPacket &packet)
+{
+    size_t bytesOut = 0;
+    if (memcmp(packet.bytes, &audioModule->tx_header, sizeof(audioModule->tx_header)) == 0) {
+        for (int i = 4; i < packet.size; i += audioModule->encode_codec_size) {
+            codec2_decode(audioModule->codec2, audioModule->output_buffer, packet.bytes + i);
+            i2s_write(I2S_PORT, &audioModule->output_buffer, audioModule->adc_buffer_size, &bytesOut, pdMS_TO_TICKS(500));
+        }
+    } else {
+        // if the buffer header does not match our own codec, make a temp decoding setup.
+        CODEC2 *tmp_codec2 = codec2_create(packet.bytes[3]);
+        codec2_set_lpc_post_filter(tmp_codec2, 1, 0, 0.8, 0.2);
+        int tmp_encode_codec_size = (codec2_bits_per_frame(tmp_codec2) + 7) / 8;
+        int tmp_adc_buffer_size = codec2_samples_per_frame(tmp_codec2);
+        for (int i = 4; i < packet.size; i += tmp_encode_codec_size) {
+            codec2_decode(tmp_codec2, audioModule->output_buffer, packet.bytes + i);
+            i2s_write(I2S_PORT, &audioModule->output_buffer, tmp_adc_buffer_size, &bytesOut, pdMS_TO_TICKS(500));
+        }
+        codec2_destroy(tmp_codec2);
+    }
+}
+
 void run_codec2(void *parameter)
 {
     // 4 bytes of header in each frame hex c0 de c2 plus the bitrate
@@ -49,44 +75,64 @@ void run_codec2(void *parameter)
     LOG_INFO("Start codec2 task");
 
     while (true) {
-        uint32_t tcount = ulTaskNotifyTake(pdFALSE, pdMS_TO_TICKS(10000));
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10000));
 
-        if (tcount != 0) {
-            if (audioModule->radio_state == RadioState::tx) {
-                for (int i = 0; i < audioModule->adc_buffer_size; i++)
-                    audioModule->speech[i] = (int16_t)hp_filter.Update((float)audioModule->speech[i]);
+        // Everything captured while PTT was held gets encoded, even if it was released since
+        for (AudioFrame *frame; (frame = audioModule->captureQueue.front()) != NULL; audioModule->captureQueue.pop()) {
+            for (int i = 0; i < audioModule->adc_buffer_size; i++)
+                frame->samples[i] = (int16_t)hp_filter.Update((float)frame->samples[i]);
 
-                codec2_encode(audioModule->codec2, audioModule->tx_encode_frame + audioModule->tx_encode_frame_index,
-                              audioModule->speech);
-                audioModule->tx_encode_frame_index += audioModule->encode_codec_size;
+            codec2_encode(audioModule->codec2, audioModule->tx_encode_frame + audioModule->tx_encode_frame_index,
+                          frame->samples);
+            audioModule->tx_encode_frame_index += audioModule->encode_codec_size;
 
-                if (audioModule->tx_encode_frame_index == (audioModule->encode_frame_size + sizeof(audioModule->tx_header))) {
-                    LOG_INFO("Send %d codec2 bytes", audioModule->encode_frame_size);
-                    audioModule->sendPayload();
-                    audioModule->tx_encode_frame_index = sizeof(audioModule->tx_header);
-                }
-            }
-            if (audioModule->radio_state == RadioState::rx) {
-                size_t bytesOut = 0;
-                if (memcmp(audioModule->rx_encode_frame, &audioModule->tx_header, sizeof(audioModule->tx_header)) == 0) {
-                    for (int i = 4; i < audioModule->rx_encode_frame_index; i += audioModule->encode_codec_size) {
-                        codec2_decode(audioModule->codec2, audioModule->output_buffer, audioModule->rx_encode_frame + i);
-                        i2s_write(I2S_PORT, &audioModule->output_buffer, audioModule->adc_buffer_size, &bytesOut,
-                                  pdMS_TO_TICKS(500));
-                    }
-                } else {
-                    // if the buffer header does not match our own codec, make a temp decoding setup.
-                    CODEC2 *tmp_codec2 = codec2_create(audioModule->rx_encode_frame[3]);
-                    codec2_set_lpc_post_filter(tmp_codec2, 1, 0, 0.8, 0.2);
-                    int tmp_encode_codec_size = (codec2_bits_per_frame(tmp_codec2) + 7) / 8;
-                    int tmp_adc_buffer_size = codec2_samples_per_frame(tmp_codec2);
-                    for (int i = 4; i < audioModule->rx_encode_frame_index; i += tmp_encode_codec_size) {
-                        codec2_decode(tmp_codec2, audioModule->output_buffer, audioModule->rx_encode_frame + i);
-                        i2s_write(I2S_PORT, &audioModule->output_buffer, tmp_adc_buffer_size, &bytesOut, pdMS_TO_TICKS(500));
-                    }
-                    codec2_destroy(tmp_codec2);
-                }
-            }
+            if (audioModule->tx_encode_frame_index ==
+                (audioModule->packet_frame_num * audioModule->encode_codec_size + sizeof(audioModule->tx_header)))
+                audioModule->queuePayload();
+        }
+        if (audioModule->radio_state != RadioState::tx && audioModule->tx_encode_frame_index > sizeof(audioModule->tx_header)) {
+            LOG_INFO("Send %d codec2 bytes (incomplete)", audioModule->tx_encode_frame_index);
+            audioModule->queuePayload();
+        }
+
+        for (AudioPacket *packet; (packet = audioModule->rxQueue.front()) != NULL; audioModule->rxQueue.pop())
+            decode_packet(*packet);
+    }
+}
+
+void run_capture(void *parameter)
+{
+    static AudioFrame discard; // Where speech goes that the codec2 task has no room for
+    size_t frameBytes = audioModule->adc_buffer_size * sizeof(int16_t);
+
+    LOG_INFO("Start I2S capture task");
+
+    while (true) {
+        if (audioModule->radio_state != RadioState::tx) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // runOnce wakes us when PTT is pressed
+
+            // Don't send what the DMA buffers picked up before PTT was pressed
+            size_t bytesIn = 0;
+            do {
+                i2s_read(I2S_PORT, discard.samples, frameBytes, &bytesIn, 0);
+            } while (bytesIn > 0);
+            continue;
+        }
+
+        AudioFrame *frame = audioModule->captureQueue.back();
+        if (!frame) {
+            audioModule->captureOverruns++;
+            frame = &discard;
+        }
+        size_t got = 0;
+        while (got < frameBytes && audioModule->radio_state == RadioState::tx) {
+            size_t bytesIn = 0;
+            i2s_read(I2S_PORT, (uint8_t *)frame->samples + got, frameBytes - got, &bytesIn, pdMS_TO_TICKS(100));
+            got += bytesIn;
+        }
+        if (got == frameBytes && frame != &discard) {
+            audioModule->captureQueue.push();
+            xTaskNotifyGive(codec2HandlerTask);
         }
     }
 }
@@ -109,6 +155,7 @@ AudioModule::AudioModule() : SinglePortModule("Audio", meshtastic_PortNum_AUDIO_
         encode_codec_size = (codec2_bits_per_frame(codec2) + 7) / 8;
         encode_frame_num = (meshtastic_Constants_DATA_PAYLOAD_LEN - sizeof(tx_header)) / encode_codec_size;
         encode_frame_size = encode_frame_num * encode_codec_size; // max 233 bytes + 4 header bytes
+        packet_frame_num = encode_frame_num;
         adc_buffer_size = codec2_samples_per_frame(codec2);
         LOG_INFO("Use %d frames of %d bytes for a total payload length of %d bytes", encode_frame_num, encode_codec_size,
                  encode_frame_size);
@@ -182,6 +229,8 @@ int32_t AudioModule::runOnce()
             }
 
             radio_state = RadioState::rx;
+            sizePackets();
+            xTaskCreate(&run_capture, "i2s_capture", 4096, NULL, 6, &captureTask);
 
             // Configure PTT input
             LOG_INFO("Init PTT on Pin %u", moduleConfig.audio.ptt_pin ? moduleConfig.audio.ptt_pin : PTT_PIN);
@@ -195,44 +244,26 @@ int32_t AudioModule::runOnce()
                 if (radio_state == RadioState::rx) {
                     LOG_INFO("PTT pressed, switching to TX");
                     radio_state = RadioState::tx;
+                    xTaskNotifyGive(captureTask);
                     e.action = UIFrameEvent::Action::REGENERATE_FRAMESET; // We want to change the list of frames shown on-screen
                     this->notifyObservers(&e);
                 }
             } else {
                 if (radio_state == RadioState::tx) {
                     LOG_INFO("PTT released, switching to RX");
-                    if (tx_encode_frame_index > sizeof(tx_header)) {
-                        // Send the incomplete frame
-                        LOG_INFO("Send %d codec2 bytes (incomplete)", tx_encode_frame_index);
-                        sendPayload();
-                    }
-                    tx_encode_frame_index = sizeof(tx_header);
+                    if (captureOverruns || txOverruns || rxOverruns)
+                        LOG_WARN("Audio dropped %u captured frames, %u sent and %u received packets", captureOverruns,
+                                 txOverruns, rxOverruns);
+                    captureOverruns = txOverruns = rxOverruns = 0;
                     radio_state = RadioState::rx;
+                    xTaskNotifyGive(codec2HandlerTask); // To encode and send what is left
                     e.action = UIFrameEvent::Action::REGENERATE_FRAMESET; // We want to change the list of frames shown on-screen
                     this->notifyObservers(&e);
                 }
             }
-            if (radio_state == RadioState::tx) {
-                // Get I2S data from the microphone and place in data buffer
-                size_t bytesIn = 0;
-                res = i2s_read(I2S_PORT, adc_buffer + adc_buffer_index, adc_buffer_size - adc_buffer_index, &bytesIn,
-                               pdMS_TO_TICKS(40)); // wait 40ms for audio to arrive.
-
-                if (res == ESP_OK) {
-                    adc_buffer_index += bytesIn;
-                    if (adc_buffer_index == adc_buffer_size) {
-                        adc_buffer_index = 0;
-                        memcpy((void *)speech, (void *)adc_buffer, 2 * adc_buffer_size);
-                        // Notify run_codec2 task that the buffer is ready.
-                        radio_state = RadioState::tx;
-                        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-                        vTaskNotifyGiveFromISR(codec2HandlerTask, &xHigherPriorityTaskWoken);
-                        if (xHigherPriorityTaskWoken == pdTRUE)
-                            YIELD_FROM_ISR(xHigherPriorityTaskWoken);
-                    }
-                }
-            }
         }
+        for (AudioPacket *packet; (packet = txQueue.front()) != NULL; txQueue.pop())
+            sendPayload(*packet);
         return 100;
     } else {
         return disable();
@@ -253,7 +284,39 @@ bool AudioModule::shouldDraw()
     return (radio_state == RadioState::tx);
 }
 
-void AudioModule::sendPayload(NodeNum dest, bool wantReplies)
+void AudioModule::sizePackets()
+{
+    if (!RadioLibInterface::instance)
+        return;
+    uint32_t frameMs = adc_buffer_size / 8; // 8 kHz samples
+    for (int n = 1; n <= encode_frame_num; n++) {
+        uint32_t airtime =
+            RadioLibInterface::instance->getPacketTime(sizeof(tx_header) + n * encode_codec_size + AUDIO_PACKET_OVERHEAD);
+        if (airtime * 100 <= n * frameMs * AUDIO_AIRTIME_PERCENT) {
+            packet_frame_num = n;
+            LOG_INFO("Send %d codec2 frames per packet, %ums of speech in %ums of airtime", n, n * frameMs, airtime);
+            return;
+        }
+    }
+    LOG_WARN("Codec2 mode needs more than %d%% of the airtime on this preset, speech will lag", AUDIO_AIRTIME_PERCENT);
+}
+
+void AudioModule::queuePayload()
+{
+    AudioPacket *packet = txQueue.back();
+    if (packet) {
+        packet->size = tx_encode_frame_index;
+        memcpy(packet->bytes, tx_encode_frame, tx_encode_frame_index);
+        txQueue.push();
+        setInterval(0);
+        concurrency::mainDelay.interrupt();
+    } else {
+        txOverruns++;
+    }
+    tx_encode_frame_index = sizeof(tx_header);
+}
+
+void AudioModule::sendPayload(const AudioPacket &packet, NodeNum dest, bool wantReplies)
 {
     meshtastic_MeshPacket *p = allocReply();
     p->to = dest;
@@ -262,8 +325,9 @@ void AudioModule::sendPayload(NodeNum dest, bool wantReplies)
     p->want_ack = false;                              // Audio is shoot&forget. No need to wait for ACKs.
     p->priority = meshtastic_MeshPacket_Priority_MAX; // Audio is important, because realtime
 
-    p->decoded.payload.size = tx_encode_frame_index;
-    memcpy(p->decoded.payload.bytes, tx_encode_frame, p->decoded.payload.size);
+    LOG_INFO("Send %d codec2 bytes", (int)(packet.size - sizeof(tx_header)));
+    p->decoded.payload.size = packet.size;
+    memcpy(p->decoded.payload.bytes, packet.bytes, packet.size);
 
     service->sendToMesh(p);
 }
@@ -272,15 +336,17 @@ ProcessMessage AudioModule::handleReceived(const meshtastic_MeshPacket &mp)
 {
     if ((moduleConfig.audio.codec2_enabled) && (myRegion->audioPermitted)) {
         auto &p = mp.decoded;
-        if (!isFromUs(&mp)) {
-            memcpy(rx_encode_frame, p.payload.bytes, p.payload.size);
-            radio_state = RadioState::rx;
-            rx_encode_frame_index = p.payload.size;
+        AudioPacket *packet = rxQueue.back();
+        if (isFromUs(&mp) || p.payload.size < sizeof(c2_header)) {
+            // Nothing for us to play
+        } else if (!packet) {
+            rxOverruns++;
+        } else {
+            packet->size = p.payload.size;
+            memcpy(packet->bytes, p.payload.bytes, p.payload.size);
+            rxQueue.push();
             // Notify run_codec2 task that the buffer is ready.
-            BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-            vTaskNotifyGiveFromISR(codec2HandlerTask, &xHigherPriorityTaskWoken);
-            if (xHigherPriorityTaskWoken == pdTRUE)
-                YIELD_FROM_ISR(xHigherPriorityTaskWoken);
+            xTaskNotifyGive(codec2HandlerTask);
         }
     }
 
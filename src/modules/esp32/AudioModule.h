@@ -9,6 +9,7 @@
 #include <ButterworthFilter.h>
 #include <OLEDDisplay.h>
 #include <OLEDDisplayUi.h>
+#include <atomic>
 #include <codec2.h>
 #include <driver/i2s.h>
 #include <functional>
@@ -30,23 +31,70 @@ struct c2_header {
 #define AUDIO_MODULE_RX_BUFFER 128
 #define AUDIO_MODULE_MODE meshtastic_ModuleConfig_AudioConfig_Audio_Baud_CODEC2_700
 
+// Frames of speech the capture task may get ahead of the codec2 encoder
+#ifndef AUDIO_CAPTURE_FRAMES
+#define AUDIO_CAPTURE_FRAMES 4
+#endif
+
+// Encoded packets the codec2 task may get ahead of the mesh, and received ones ahead of the decoder
+#ifndef AUDIO_PACKET_QUEUE
+#define AUDIO_PACKET_QUEUE 3
+#endif
+
+// Share of the airtime the voice stream may take. Packets carry the fewest codec2 frames that keep within it, for latency
+#ifndef AUDIO_AIRTIME_PERCENT
+#define AUDIO_AIRTIME_PERCENT 50
+#endif
+
+/**
+ * A queue between exactly one producer task and one consumer task, that neither of them ever blocks on.
+ * The producer fills the slot back() gives it and hands it over with push(), the consumer reads front() and frees it with pop().
+ */
+template <class T, uint8_t N> class AudioQueue
+{
+  public:
+    T *back() { return next(head.load(std::memory_order_relaxed)) == tail.load(std::memory_order_acquire) ? NULL : &slots[head]; }
+    void push() { head.store(next(head.load(std::memory_order_relaxed)), std::memory_order_release); }
+
+    T *front() { return tail.load(std::memory_order_relaxed) == head.load(std::memory_order_acquire) ? NULL : &slots[tail]; }
+    void pop() { tail.store(next(tail.load(std::memory_order_relaxed)), std::memory_order_release); }
+
+  private:
+    // One slot always stays empty, so that full and empty can be told apart
+    static uint8_t next(uint8_t i) { return i == N ? 0 : i + 1; }
+
+    T slots[N + 1];
+    std::atomic<uint8_t> head{0}, tail{0};
+};
+
+struct AudioFrame {
+    int16_t samples[ADC_BUFFER_SIZE_MAX];
+};
+
+struct AudioPacket {
+    uint8_t size;
+    uint8_t bytes[meshtastic_Constants_DATA_PAYLOAD_LEN];
+};
+
 class AudioModule : public SinglePortModule, public Observable<const UIFrameEvent *>, private concurrency::OSThread
 {
   public:
-    unsigned char rx_encode_frame[meshtastic_Constants_DATA_PAYLOAD_LEN] = {};
     unsigned char tx_encode_frame[meshtastic_Constants_DATA_PAYLOAD_LEN] = {};
     c2_header tx_header = {};
-    int16_t speech[ADC_BUFFER_SIZE_MAX] = {};
     int16_t output_buffer[ADC_BUFFER_SIZE_MAX] = {};
-    uint16_t adc_buffer[ADC_BUFFER_SIZE_MAX] = {};
     int adc_buffer_size = 0;
-    uint16_t adc_buffer_index = 0;
     int tx_encode_frame_index = sizeof(c2_header); // leave room for header
-    int rx_encode_frame_index = 0;
     int encode_codec_size = 0;
     int encode_frame_size = 0;
+    int packet_frame_num = 0; // Frames that fill a packet, at most encode_frame_num and fewer on a fast preset
     volatile RadioState radio_state = RadioState::rx;
 
+    // Capture task -> codec2 task -> mesh, and mesh -> codec2 task
+    AudioQueue<AudioFrame, AUDIO_CAPTURE_FRAMES> captureQueue;
+    AudioQueue<AudioPacket, AUDIO_PACKET_QUEUE> txQueue;
+    AudioQueue<AudioPacket, AUDIO_PACKET_QUEUE> rxQueue;
+    volatile uint32_t captureOverruns = 0, txOverruns = 0, rxOverruns = 0;
+
     struct CODEC2 *codec2 = NULL;
     // int16_t sample;
 
@@ -55,9 +103,14 @@ class AudioModule : public SinglePortModule, public Observable<const UIFrameEven
     bool shouldDraw();
 
     /**
-     * Send our payload into the mesh
+     * Send an encoded packet into the mesh
      */
-    void sendPayload(NodeNum dest = NODENUM_BROADCAST, bool wantReplies = false);
+    void sendPayload(const AudioPacket &packet, NodeNum dest = NODENUM_BROADCAST, bool wantReplies = false);
+
+    /**
+     * Hand what the codec2 task has encoded so far to the main thread to send, called from the codec2 task
+     */
+    void queuePayload();
 
   protected:
     int encode_frame_num = 0;
@@ -65,6 +118,9 @@ class AudioModule : public SinglePortModule, public Observable<const UIFrameEven
 
     virtual int32_t runOnce() override;
 
+    /// Pick packet_frame_num for the airtime of the LoRa preset
+    void sizePackets();
+
     virtual meshtastic_MeshPacket *allocReply() override;
 
     virtual bool wantUIFrame() override { return this->shouldDraw(); }
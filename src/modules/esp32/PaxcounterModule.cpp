@@ -3,6 +3,7 @@
 #include "Default.h"
 #include "MeshService.h"
 #include "PaxcounterModule.h"
+#include "concurrency/LockGuard.h"
 #include "graphics/ScreenFonts.h"
 #include "graphics/SharedUIDisplay.h"
 #include "graphics/images.h"
@@ -30,6 +31,25 @@ PaxcounterModule::PaxcounterModule()
 {
 }
 
+void PaxcounterModule::deviceSeen(const uint8_t *mac, bool ble)
+{
+    concurrency::LockGuard guard(&devicesLock);
+    (ble ? bleDevices : wifiDevices).add(mac, 6, millis());
+}
+
+void PaxcounterModule::getCounts(uint32_t windowMinutes, uint32_t *wifi, uint32_t *ble)
+{
+    concurrency::LockGuard guard(&devicesLock);
+    if (!wifiDevices.isFed() && !bleDevices.isFed()) {
+        *wifi = count_from_libpax.wifi_count;
+        *ble = count_from_libpax.ble_count;
+        return;
+    }
+    uint32_t now = millis();
+    *wifi = wifiDevices.estimate(windowMinutes, now);
+    *ble = bleDevices.estimate(windowMinutes, now);
+}
+
 /**
  * Send the Pax information to the mesh if we got new data from libpax.
  * This is called periodically from our runOnce() method and will actually send the data to the mesh
@@ -42,15 +62,7 @@ bool PaxcounterModule::sendInfo(NodeNum dest)
     if (paxcounterModule->reportedDataSent)
         return false;
 
-    LOG_INFO("PaxcounterModule: send pax info wifi=%d; ble=%d; uptime=%lu", count_from_libpax.wifi_count,
-             count_from_libpax.ble_count, millis() / 1000);
-
-    meshtastic_Paxcount pl = meshtastic_Paxcount_init_default;
-    pl.wifi = count_from_libpax.wifi_count;
-    pl.ble = count_from_libpax.ble_count;
-    pl.uptime = millis() / 1000;
-
-    meshtastic_MeshPacket *p = allocDataProtobuf(pl);
+    meshtastic_MeshPacket *p = allocReply();
     p->to = dest;
     p->decoded.want_response = false;
     p->priority = meshtastic_MeshPacket_Priority_BACKGROUND;
@@ -70,9 +82,9 @@ bool PaxcounterModule::handleReceivedProtobuf(const meshtastic_MeshPacket &mp, m
 meshtastic_MeshPacket *PaxcounterModule::allocReply()
 {
     meshtastic_Paxcount pl = meshtastic_Paxcount_init_default;
-    pl.wifi = count_from_libpax.wifi_count;
-    pl.ble = count_from_libpax.ble_count;
+    getCounts(PAXCOUNTER_REPORT_MINUTES, &pl.wifi, &pl.ble);
     pl.uptime = millis() / 1000;
+    LOG_INFO("PaxcounterModule: pax info wifi=%u; ble=%u; uptime=%u", pl.wifi, pl.ble, pl.uptime);
     return allocDataProtobuf(pl);
 }
 
@@ -138,10 +150,36 @@ void PaxcounterModule::drawFrame(OLEDDisplay *display, OLEDDisplayUiState *state
 
     display->setTextAlignment(TEXT_ALIGN_CENTER);
     display->setFont(FONT_SMALL);
-    display->drawStringf(display->getWidth() / 2 + x, graphics::getTextPositions(display)[line++], buffer,
-                         "WiFi: %d\nBLE: %d\nUptime: %ds", count_from_libpax.wifi_count, count_from_libpax.ble_count,
-                         millis() / 1000);
+    if (wifiDevices.isFed() || bleDevices.isFed()) {
+        uint32_t wifi[3], ble[3];
+        getCounts(5, &wifi[0], &ble[0]);
+        getCounts(15, &wifi[1], &ble[1]);
+        getCounts(60, &wifi[2], &ble[2]);
+        display->drawStringf(display->getWidth() / 2 + x, graphics::getTextPositions(display)[line++], buffer,
+                             "5m/15m/1h\nWiFi: %u/%u/%u\nBLE: %u/%u/%u", wifi[0], wifi[1], wifi[2], ble[0], ble[1], ble[2]);
+    } else {
+        display->drawStringf(display->getWidth() / 2 + x, graphics::getTextPositions(display)[line++], buffer,
+                             "WiFi: %d\nBLE: %d\nUptime: %ds", count_from_libpax.wifi_count, count_from_libpax.ble_count,
+                             millis() / 1000);
+    }
 }
 #endif // HAS_SCREEN
 
-#endif
\ No newline at end of file
+#endif
+
+#if defined(ARCH_ESP32)
+/*
+ * libpax hands every address it sniffs to its mac_add(), which -Wl,--wrap=mac_add (see bin/platformio-custom.py) routes through
+ * here first. sniff_type is 0 for WiFi and BLE otherwise. Weak, so that targets without libpax still link.
+ */
+extern "C" int __real_mac_add(uint8_t *paddr, uint8_t sniff_type) __attribute__((weak));
+
+extern "C" int __wrap_mac_add(uint8_t *paddr, uint8_t sniff_type)
+{
+#if !MESHTASTIC_EXCLUDE_PAXCOUNTER
+    if (paxcounterModule)
+        paxcounterModule->deviceSeen(paddr, sniff_type != 0);
+#endif
+    return __real_mac_add ? __real_mac_add(paddr, sniff_type) : 0;
+}
+#endif
@@ -5,11 +5,21 @@
 #if defined(ARCH_ESP32)
 #include "../mesh/generated/meshtastic/paxcount.pb.h"
 #include "NodeDB.h"
+#include "concurrency/Lock.h"
+#include "modules/PaxEstimator.h"
 #include <libpax_api.h>
 
+// Distinct devices of the last this many minutes go in the wifi and ble counts sent to the mesh
+#ifndef PAXCOUNTER_REPORT_MINUTES
+#define PAXCOUNTER_REPORT_MINUTES 15
+#endif
+
 /**
  * Wrapper module for the estimate passenger (PAX) count library (https://github.com/dbinfrago/libpax) which
  * implements the core functionality of the ESP32 Paxcounter project (https://github.com/cyberman54/ESP32-Paxcounter)
+ *
+ * Every address libpax sniffs is also counted in a PaxEstimator per radio, so that the counts are of distinct devices over
+ * a sliding window, however many of them there are.
  */
 class PaxcounterModule : private concurrency::OSThread, public ProtobufModule<meshtastic_Paxcount>
 {
@@ -21,8 +31,16 @@ class PaxcounterModule : private concurrency::OSThread, public ProtobufModule<me
   public:
     PaxcounterModule();
 
+    /// libpax sniffed this address, called from the WiFi and BLE tasks
+    void deviceSeen(const uint8_t *mac, bool ble);
+
   protected:
     struct count_payload_t count_from_libpax = {0, 0, 0};
+    PaxEstimator wifiDevices, bleDevices;
+    concurrency::Lock devicesLock;
+
+    /// Distinct devices of the last windowMinutes, or libpax's counts if no address came our way
+    void getCounts(uint32_t windowMinutes, uint32_t *wifi, uint32_t *ble);
     virtual int32_t runOnce() override;
     bool sendInfo(NodeNum dest = NODENUM_BROADCAST);
     virtual bool handleReceivedProtobuf(const meshtastic_MeshPacket &mp, meshtastic_Paxcount *p) override;
@@ -7,6 +7,7 @@
 #if !defined(ARCH_STM32WL) && !MESHTASTIC_EXCLUDE_I2C
 
 #include "../concurrency/OSThread.h"
+#include "../gps/GPSUpdateScheduling.h"
 #ifdef HAS_BMA423
 #include "BMA423Sensor.h"
 #endif
@@ -124,6 +125,9 @@ class AccelerometerThread : public concurrency::OSThread
         isInitialised = sensor->init();
         if (!isInitialised) {
             clean();
+        } else if (device.type != ScanI2C::DeviceType::BMM150) {
+            // Anything but the bare magnetometer reports motion, so the GPS can skip fixes while we stay put
+            GPSUpdateScheduling::informMotionSensor();
         }
         LOG_DEBUG("AccelerometerThread::init %s", isInitialised ? "ok" : "failed");
     }
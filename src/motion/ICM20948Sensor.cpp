@@ -14,6 +14,7 @@ volatile static bool ICM20948_IRQ = false;
 void ICM20948SetInterrupt()
 {
     ICM20948_IRQ = true;
+    ICM20948Sensor::wakeFromISR();
 }
 
 ICM20948Sensor::ICM20948Sensor(ScanI2C::FoundDevice foundDevice) : MotionSensor::MotionSensor(foundDevice) {}
@@ -39,7 +40,7 @@ int32_t ICM20948Sensor::runOnce()
         sensor->clearInterrupts();
         wakeScreen();
     }
-    return MOTION_SENSOR_CHECK_INTERVAL_MS;
+    return MOTION_SENSOR_IRQ_INTERVAL_MS;
 }
 
 #else
@@ -101,33 +102,7 @@ int32_t ICM20948Sensor::runOnce()
     ma.axis.y = magY;
     ma.axis.z = magZ;
 
-    // If we're set to one of the inverted positions
-    if (config.display.compass_orientation > meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_270) {
-        ma = FusionAxesSwap(ma, FusionAxesAlignmentNXNYPZ);
-        ga = FusionAxesSwap(ga, FusionAxesAlignmentNXNYPZ);
-    }
-
-    float heading = FusionCompassCalculateHeading(FusionConventionNed, ga, ma);
-
-    switch (config.display.compass_orientation) {
-    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_0_INVERTED:
-    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_0:
-        break;
-    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_90:
-    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_90_INVERTED:
-        heading += 90;
-        break;
-    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_180:
-    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_180_INVERTED:
-        heading += 180;
-        break;
-    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_270:
-    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_270_INVERTED:
-        heading += 270;
-        break;
-    }
-    if (screen)
-        screen->setHeading(heading);
+    publishHeading(ga, ma);
 #endif
 
     // Wake on motion using polling  - this is not as efficient as using hardware interrupt pin (see above)
@@ -20,8 +20,10 @@ bool LIS3DHSensor::init()
 
 int32_t LIS3DHSensor::runOnce()
 {
-    if (sensor.getClick() > 0) {
-        uint8_t click = sensor.getClick();
+    // Reading CLICK_SRC clears the latched click, so read it only once per check
+    uint8_t click = sensor.getClick();
+    if (click > 0) {
+        moved();
         if (!config.device.double_tap_as_button_press && config.display.wake_on_tap_or_motion) {
             wakeScreen();
         }
@@ -1,5 +1,7 @@
 #include "MotionSensor.h"
 #include "graphics/draw/CompassRenderer.h"
+#include "gps/GPSUpdateScheduling.h"
+#include "main.h"
 
 #if !defined(ARCH_STM32WL) && !MESHTASTIC_EXCLUDE_I2C
 
@@ -64,9 +66,77 @@ void MotionSensor::drawFrameCalibration(OLEDDisplay *display, OLEDDisplayUiState
 }
 #endif
 
+void MotionSensor::publishHeading(FusionVector accel, FusionVector mag)
+{
+    // If we're set to one of the inverted positions
+    if (config.display.compass_orientation > meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_270) {
+        mag = FusionAxesSwap(mag, FusionAxesAlignmentNXNYPZ);
+        accel = FusionAxesSwap(accel, FusionAxesAlignmentNXNYPZ);
+    }
+    publishHeading(FusionCompassCalculateHeading(FusionConventionNed, accel, mag));
+}
+
+void MotionSensor::publishHeading(float degrees)
+{
+#if !defined(MESHTASTIC_EXCLUDE_SCREEN) && HAS_SCREEN
+    switch (config.display.compass_orientation) {
+    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_0_INVERTED:
+    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_0:
+        break;
+    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_90:
+    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_90_INVERTED:
+        degrees += 90;
+        break;
+    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_180:
+    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_180_INVERTED:
+        degrees += 180;
+        break;
+    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_270:
+    case meshtastic_Config_DisplayConfig_CompassOrientation_DEGREES_270_INVERTED:
+        degrees += 270;
+        break;
+    }
+
+    // Weigh the new sample by how long it has been since the last one, so the filter doesn't depend on how often the
+    // driver runs, and start over after a long enough gap that the old heading means nothing
+    uint32_t now = millis();
+    float dt = now - lastHeadingMsec;
+    float weight = 1;
+    if (lastHeadingMsec && dt < 10 * MOTION_SENSOR_HEADING_SMOOTHING_MS)
+        weight = dt / (MOTION_SENSOR_HEADING_SMOOTHING_MS + dt);
+    lastHeadingMsec = now ? now : 1;
+
+    float rad = degrees * DEG_TO_RAD;
+    headingNorth += weight * (cosf(rad) - headingNorth);
+    headingEast += weight * (sinf(rad) - headingEast);
+
+    float smoothed = atan2f(headingEast, headingNorth) * RAD_TO_DEG;
+    if (smoothed < 0)
+        smoothed += 360;
+    if (screen)
+        screen->setHeading(lroundf(smoothed));
+#endif
+}
+
+IRAM_ATTR void MotionSensor::wakeFromISR()
+{
+    if (accelerometerThread) {
+        accelerometerThread->setInterval(0);
+        runASAP = true;
+        BaseType_t higherPriWoken = 0;
+        concurrency::mainDelay.interruptFromISR(&higherPriWoken);
+    }
+}
+
+void MotionSensor::moved()
+{
+    GPSUpdateScheduling::informMoved();
+}
+
 #if !MESHTASTIC_EXCLUDE_POWER_FSM
 void MotionSensor::wakeScreen()
 {
+    moved();
     if (powerFSM.getState() == &stateDARK) {
         LOG_DEBUG("Motion wakeScreen detected");
         powerFSM.trigger(EVENT_INPUT);
@@ -81,7 +151,10 @@ void MotionSensor::buttonPress()
 
 #else
 
-void MotionSensor::wakeScreen() {}
+void MotionSensor::wakeScreen()
+{
+    moved();
+}
 
 void MotionSensor::buttonPress() {}
 
@@ -4,6 +4,12 @@
 
 #define MOTION_SENSOR_CHECK_INTERVAL_MS 100
 #define MOTION_SENSOR_CLICK_THRESHOLD 40
+#ifndef MOTION_SENSOR_IRQ_INTERVAL_MS
+#define MOTION_SENSOR_IRQ_INTERVAL_MS (60 * 1000) // How often sensors on an interrupt pin are looked at without an interrupt
+#endif
+#ifndef MOTION_SENSOR_HEADING_SMOOTHING_MS
+#define MOTION_SENSOR_HEADING_SMOOTHING_MS 300 // Time constant of the low pass filter on the compass heading, 0 for none
+#endif
 
 #include "../configuration.h"
 
@@ -14,6 +20,7 @@
 #include "../graphics/Screen.h"
 #include "../graphics/ScreenFonts.h"
 #include "../power.h"
+#include "Fusion/Fusion.h"
 #include "Wire.h"
 
 // Base class for motion processing
@@ -42,13 +49,28 @@ class MotionSensor
 
     virtual void calibrate(uint16_t forSeconds){};
 
+    // Call from the interrupt handler of a sensor on an interrupt pin, so runOnce() gets the event straight away and
+    // doesn't need to check for one every MOTION_SENSOR_CHECK_INTERVAL_MS
+    static void wakeFromISR();
+
   protected:
-    // Turn on the screen when a tap or motion is detected
+    // Tell the GPS the board moved, so it doesn't skip its next fix
+    static void moved();
+
+    // Turn on the screen when a tap or motion is detected, which is also a move
     virtual void wakeScreen();
 
     // Register a button press when a double-tap is detected
     virtual void buttonPress();
 
+    // Work out the compass heading from one accelerometer and magnetometer sample, with the axes of a sensor mounted
+    // the default way up, then publish it like publishHeading(float)
+    void publishHeading(FusionVector accel, FusionVector mag);
+
+    // Turn a heading in degrees from the sensor's point of view into one for the way the board is mounted, smooth it and
+    // hand it to the screen.  The screen only redraws compass needles once this moves by a whole degree.
+    void publishHeading(float degrees);
+
 #if !defined(MESHTASTIC_EXCLUDE_SCREEN) && HAS_SCREEN
     // draw an OLED frame (currently only used by the RAK4631 BMX160 sensor)
     static void drawFrameCalibration(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y);
@@ -59,6 +81,11 @@ class MotionSensor
     // Do calibration if true
     bool doCalibration = false;
     uint32_t endCalibrationAt = 0;
+
+  private:
+    // Smoothed heading as a unit vector, averaging angles directly would go wrong where they wrap round at north
+    float headingNorth = 0, headingEast = 0;
+    uint32_t lastHeadingMsec = 0;
 };
 
 namespace MotionSensorI2C
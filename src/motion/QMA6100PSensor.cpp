@@ -9,6 +9,7 @@ volatile static bool QMA6100P_IRQ = false;
 void QMA6100PSetInterrupt()
 {
     QMA6100P_IRQ = true;
+    QMA6100PSensor::wakeFromISR();
 }
 
 QMA6100PSensor::QMA6100PSensor(ScanI2C::FoundDevice foundDevice) : MotionSensor::MotionSensor(foundDevice) {}
@@ -33,7 +34,7 @@ int32_t QMA6100PSensor::runOnce()
         QMA6100P_IRQ = false;
         wakeScreen();
     }
-    return MOTION_SENSOR_CHECK_INTERVAL_MS;
+    return MOTION_SENSOR_IRQ_INTERVAL_MS;
 }
 
 #else
@@ -15,7 +15,12 @@ bool STK8XXXSensor::init()
         sensor.STK8xxx_Anymotion_init();
         pinMode(STK8XXX_INT, INPUT_PULLUP);
         attachInterrupt(
-            digitalPinToInterrupt(STK8XXX_INT), [] { STK_IRQ = true; }, RISING);
+            digitalPinToInterrupt(STK8XXX_INT),
+            [] {
+                STK_IRQ = true;
+                wakeFromISR();
+            },
+            RISING);
 
         LOG_DEBUG("STK8XXX init ok");
         return true;
@@ -28,11 +33,12 @@ int32_t STK8XXXSensor::runOnce()
 {
     if (STK_IRQ) {
         STK_IRQ = false;
+        moved();
         if (config.display.wake_on_tap_or_motion) {
             wakeScreen();
         }
     }
-    return MOTION_SENSOR_CHECK_INTERVAL_MS;
+    return MOTION_SENSOR_IRQ_INTERVAL_MS;
 }
 
 #endif
@@ -1,10 +1,12 @@
 #include "MQTT.h"
 #include "MeshService.h"
 #include "NodeDB.h"
+#include "PerfCounters.h"
 #include "PowerFSM.h"
 #include "ServiceEnvelope.h"
 #include "configuration.h"
 #include "main.h"
+#include "memGet.h"
 #include "mesh/Channels.h"
 #include "mesh/Router.h"
 #include "mesh/generated/meshtastic/mqtt.pb.h"
@@ -25,7 +27,7 @@
 #endif // HAS_ETHERNET
 #include "Default.h"
 #if !defined(ARCH_NRF52) || NRF52_USE_JSON
-#include "serialization/JSON.h"
+#include "serialization/JSONReader.h"
 #include "serialization/MeshPacketSerializer.h"
 #endif
 #include <Throttle.h>
@@ -34,6 +36,8 @@
 
 #include <IPAddress.h>
 #if defined(ARCH_PORTDUINO)
+#include "platform/portduino/MqttBroker.h"
+#include "platform/portduino/PortduinoGlue.h"
 #include <netinet/in.h>
 #elif !defined(ntohl)
 #include <machine/endian.h>
@@ -43,6 +47,17 @@
 
 MQTT *mqtt;
 
+// MQTT keepalive we ask the broker for.  PubSubClient notices a dead connection once a ping goes unanswered for this long, so
+// shorter finds a half-open TCP connection after an uplink hiccup sooner, at the cost of a ping every so often when idle.
+#ifndef MQTT_KEEPALIVE_SECS
+#define MQTT_KEEPALIVE_SECS 30
+#endif
+
+// A TLS handshake briefly needs tens of KB of heap, don't start one that would leave less than this free
+#ifndef MQTT_TLS_MIN_FREE_HEAP
+#define MQTT_TLS_MIN_FREE_HEAP (48 * 1024)
+#endif
+
 namespace
 {
 constexpr int reconnectMax = 5;
@@ -52,20 +67,23 @@ static uint8_t bytes[meshtastic_MqttClientProxyMessage_size + 30]; // 12 for cha
 
 static bool isMqttServerAddressPrivate = false;
 
-inline void onReceiveProto(char *topic, byte *payload, size_t length)
+inline void onReceiveProto(char *topic, const byte *payload, size_t length)
 {
     const DecodedServiceEnvelope e(payload, length);
     if (!e.validDecode || e.channel_id == NULL || e.gateway_id == NULL || e.packet == NULL) {
         LOG_ERROR("Invalid MQTT service envelope, topic %s, len %u!", topic, length);
         return;
     }
-    const meshtastic_Channel &ch = channels.getByName(e.channel_id);
+    // Resolve the channel once, from the table Channels precomputes for us
+    const bool isPKI = strcmp(e.channel_id, "PKI") == 0;
+    const int8_t foundIndex = isPKI ? -1 : channels.getIndexByGlobalId(e.channel_id);
+    const ChannelIndex chIndex = foundIndex >= 0 ? foundIndex : channels.getPrimaryIndex();
     if (strcmp(e.gateway_id, owner.id) == 0) {
         // Generate an implicit ACK towards ourselves (handled and processed only locally!) for this message.
         // We do this because packets are not rebroadcasted back into MQTT anymore and we assume that at least one node
         // receives it when we get our own packet back. Then we'll stop our retransmissions.
         if (isFromUs(e.packet))
-            routingModule->sendAckNak(meshtastic_Routing_Error_NONE, getFrom(e.packet), e.packet->id, ch.index);
+            routingModule->sendAckNak(meshtastic_Routing_Error_NONE, getFrom(e.packet), e.packet->id, chIndex);
         else
             LOG_INFO("Ignore downlink message we originally sent");
         return;
@@ -76,15 +94,16 @@ inline void onReceiveProto(char *topic, byte *payload, size_t length)
     }
 
     // Find channel by channel_id and check downlink_enabled
-    if (!(strcmp(e.channel_id, "PKI") == 0 ||
-          (strcmp(e.channel_id, channels.getGlobalId(ch.index)) == 0 && ch.settings.downlink_enabled))) {
+    if (!(isPKI || (foundIndex >= 0 && channels.isDownlinkEnabled(foundIndex))))
         return;
-    }
     LOG_INFO("Received MQTT topic %s, len=%u", topic, length);
     if (e.packet->hop_limit > HOP_MAX || e.packet->hop_start > HOP_MAX) {
         LOG_INFO("Invalid hop_limit(%u) or hop_start(%u)", e.packet->hop_limit, e.packet->hop_start);
         return;
     }
+    // Weed out replays and floods while it's still cheap, before we allocate anything
+    if (!mqtt->admitDownlink(getFrom(e.packet), e.packet->id, isPKI ? MAX_NUM_CHANNELS : chIndex))
+        return;
 
     UniquePacketPoolPacket p = packetPool.allocUniqueZeroed();
     p->from = e.packet->from;
@@ -108,11 +127,11 @@ inline void onReceiveProto(char *topic, byte *payload, size_t length)
             LOG_INFO("Ignore decoded admin packet");
             return;
         }
-        p->channel = ch.index;
+        p->channel = chIndex;
     }
 
     // PKI messages get accepted even if we can't decrypt
-    if (router && p->which_payload_variant == meshtastic_MeshPacket_encrypted_tag && strcmp(e.channel_id, "PKI") == 0) {
+    if (router && p->which_payload_variant == meshtastic_MeshPacket_encrypted_tag && isPKI) {
         const meshtastic_NodeInfoLite *tx = nodeDB->getMeshNode(getFrom(p.get()));
         const meshtastic_NodeInfoLite *rx = nodeDB->getMeshNode(p->to);
         // Only accept PKI messages to us, or if we have both the sender and receiver in our nodeDB, as then it's
@@ -125,83 +144,89 @@ inline void onReceiveProto(char *topic, byte *payload, size_t length)
 }
 
 #if !defined(ARCH_NRF52) || NRF52_USE_JSON
+/// Look up a numeric member of a downlinked JSON object
+static bool getJsonNumber(const JSONToken &object, const char *key, double &out)
+{
+    JSONToken t;
+    return JSONReader::find(object, key, t) && JSONReader::asNumber(t, out);
+}
+
 // returns true if this is a valid JSON envelope which we accept on downlink
-inline bool isValidJsonEnvelope(JSONObject &json)
+inline bool isValidJsonEnvelope(const JSONToken &json)
 {
+    JSONToken t;
+    double from;
     // if "sender" is provided, avoid processing packets we uplinked
-    return (json.find("sender") != json.end() ? (json["sender"]->AsString().compare(owner.id) != 0) : true) &&
-           (json.find("hopLimit") != json.end() ? json["hopLimit"]->IsNumber() : true) && // hop limit should be a number
-           (json.find("from") != json.end()) && json["from"]->IsNumber() &&
-           (json["from"]->AsNumber() == nodeDB->getNodeNum()) &&            // only accept message if the "from" is us
-           (json.find("type") != json.end()) && json["type"]->IsString() && // should specify a type
-           (json.find("payload") != json.end());                            // should have a payload
+    return json.type == JSON_OBJECT && (JSONReader::find(json, "sender", t) ? !JSONReader::equals(t, owner.id) : true) &&
+           (JSONReader::find(json, "hopLimit", t) ? t.type == JSON_NUMBER : true) && // hop limit should be a number
+           getJsonNumber(json, "from", from) && (from == nodeDB->getNodeNum()) &&  // only accept message if the "from" is us
+           JSONReader::find(json, "type", t) && t.type == JSON_STRING &&          // should specify a type
+           JSONReader::find(json, "payload", t);                                  // should have a payload
+}
+
+/// Fill in the optional channel, to and hopLimit of a downlinked JSON envelope
+static void setJsonDownlinkHeader(const JSONToken &json, meshtastic_MeshPacket *p)
+{
+    double v;
+    if (getJsonNumber(json, "channel", v) && v >= 0 && v < channels.getNumChannels())
+        p->channel = v;
+    if (getJsonNumber(json, "to", v))
+        p->to = v;
+    if (getJsonNumber(json, "hopLimit", v))
+        p->hop_limit = v;
 }
 
 inline void onReceiveJson(byte *payload, size_t length)
 {
-    char payloadStr[length + 1];
-    memcpy(payloadStr, payload, length);
-    payloadStr[length] = 0; // null terminated string
-    std::unique_ptr<JSONValue> json_value(JSON::Parse(payloadStr));
-    if (json_value == nullptr) {
+    // Read the JSON in place, a hostile payload can't make us allocate anything
+    JSONToken json;
+    if (!JSONReader::parse((const char *)payload, length, json)) {
         LOG_ERROR("JSON received payload on MQTT but not a valid JSON");
         return;
     }
 
-    JSONObject json;
-    json = json_value->AsObject();
-
     if (!isValidJsonEnvelope(json)) {
         LOG_ERROR("JSON received payload on MQTT but not a valid envelope");
         return;
     }
 
     // this is a valid envelope
-    if (json["type"]->AsString().compare("sendtext") == 0 && json["payload"]->IsString()) {
-        std::string jsonPayloadStr = json["payload"]->AsString();
-        LOG_INFO("JSON payload %s, length %u", jsonPayloadStr.c_str(), jsonPayloadStr.length());
+    JSONToken type, jsonPayload;
+    JSONReader::find(json, "type", type);
+    JSONReader::find(json, "payload", jsonPayload);
+    if (JSONReader::equals(type, "sendtext") && jsonPayload.type == JSON_STRING) {
+        char text[sizeof(meshtastic_Data_payload_t::bytes) + 1];
+        size_t textLen;
+        if (!JSONReader::asString(jsonPayload, text, sizeof(text), textLen)) {
+            LOG_WARN("Received MQTT json payload too long, drop");
+            return;
+        }
+        LOG_INFO("JSON payload %s, length %u", text, textLen);
 
         // construct protobuf data packet using TEXT_MESSAGE, send it to the mesh
         meshtastic_MeshPacket *p = router->allocForSending();
         p->decoded.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
-        if (json.find("channel") != json.end() && json["channel"]->IsNumber() &&
-            (json["channel"]->AsNumber() < channels.getNumChannels()))
-            p->channel = json["channel"]->AsNumber();
-        if (json.find("to") != json.end() && json["to"]->IsNumber())
-            p->to = json["to"]->AsNumber();
-        if (json.find("hopLimit") != json.end() && json["hopLimit"]->IsNumber())
-            p->hop_limit = json["hopLimit"]->AsNumber();
-        if (jsonPayloadStr.length() <= sizeof(p->decoded.payload.bytes)) {
-            memcpy(p->decoded.payload.bytes, jsonPayloadStr.c_str(), jsonPayloadStr.length());
-            p->decoded.payload.size = jsonPayloadStr.length();
-            service->sendToMesh(p, RX_SRC_LOCAL);
-        } else {
-            LOG_WARN("Received MQTT json payload too long, drop");
-        }
-    } else if (json["type"]->AsString().compare("sendposition") == 0 && json["payload"]->IsObject()) {
+        setJsonDownlinkHeader(json, p);
+        memcpy(p->decoded.payload.bytes, text, textLen);
+        p->decoded.payload.size = textLen;
+        service->sendToMesh(p, RX_SRC_LOCAL);
+    } else if (JSONReader::equals(type, "sendposition") && jsonPayload.type == JSON_OBJECT) {
         // invent the "sendposition" type for a valid envelope
-        JSONObject posit;
-        posit = json["payload"]->AsObject(); // get nested JSON Position
         meshtastic_Position pos = meshtastic_Position_init_default;
-        if (posit.find("latitude_i") != posit.end() && posit["latitude_i"]->IsNumber())
-            pos.latitude_i = posit["latitude_i"]->AsNumber();
-        if (posit.find("longitude_i") != posit.end() && posit["longitude_i"]->IsNumber())
-            pos.longitude_i = posit["longitude_i"]->AsNumber();
-        if (posit.find("altitude") != posit.end() && posit["altitude"]->IsNumber())
-            pos.altitude = posit["altitude"]->AsNumber();
-        if (posit.find("time") != posit.end() && posit["time"]->IsNumber())
-            pos.time = posit["time"]->AsNumber();
+        double v;
+        if (getJsonNumber(jsonPayload, "latitude_i", v))
+            pos.latitude_i = v;
+        if (getJsonNumber(jsonPayload, "longitude_i", v))
+            pos.longitude_i = v;
+        if (getJsonNumber(jsonPayload, "altitude", v))
+            pos.altitude = v;
+        if (getJsonNumber(jsonPayload, "time", v))
+            pos.time = v;
 
         // construct protobuf data packet using POSITION, send it to the mesh
         meshtastic_MeshPacket *p = router->allocForSending();
         p->decoded.portnum = meshtastic_PortNum_POSITION_APP;
-        if (json.find("channel") != json.end() && json["channel"]->IsNumber() &&
-            (json["channel"]->AsNumber() < channels.getNumChannels()))
-            p->channel = json["channel"]->AsNumber();
-        if (json.find("to") != json.end() && json["to"]->IsNumber())
-            p->to = json["to"]->AsNumber();
-        if (json.find("hopLimit") != json.end() && json["hopLimit"]->IsNumber())
-            p->hop_limit = json["hopLimit"]->AsNumber();
+        setJsonDownlinkHeader(json, p);
         p->decoded.payload.size =
             pb_encode_to_bytes(p->decoded.payload.bytes, sizeof(p->decoded.payload.bytes), &meshtastic_Position_msg,
                                &pos); // make the Data protobuf from position
@@ -291,6 +316,7 @@ struct PubSubConfig {
 bool connectPubSub(const PubSubConfig &config, PubSubClient &pubSub, Client &client)
 {
     pubSub.setBufferSize(1024, 1024);
+    pubSub.setKeepAlive(MQTT_KEEPALIVE_SECS);
     pubSub.setClient(client);
     pubSub.setServer(config.serverAddr.c_str(), config.serverPort);
 
@@ -333,12 +359,52 @@ bool wantsLink()
 }
 } // namespace
 
+bool MQTT::admitDownlink(NodeNum from, PacketId id, uint8_t topicIndex)
+{
+    static_assert(MQTT_DOWNLINK_DEDUP_SIZE <= 256, "nextRecentDownlink is a uint8_t");
+    for (const DownlinkId &seen : recentDownlinks) {
+        if (seen.id == id && seen.from == from) {
+            numDownlinkDuplicates++;
+            LOG_DEBUG("Ignore MQTT downlink 0x%08x from 0x%08x, already seen via another gateway", id, from);
+            return false;
+        }
+    }
+
+    DownlinkBucket &bucket = downlinkBuckets[std::min<uint8_t>(topicIndex, MAX_NUM_CHANNELS)];
+    uint32_t now = millis();
+    uint32_t earned = (now - bucket.lastRefill) / MQTT_DOWNLINK_REFILL_MSEC;
+    if (earned) {
+        bucket.tokens = std::min<uint32_t>(MQTT_DOWNLINK_BURST, bucket.tokens + earned);
+        bucket.lastRefill = (bucket.tokens == MQTT_DOWNLINK_BURST) ? now : bucket.lastRefill + earned * MQTT_DOWNLINK_REFILL_MSEC;
+    }
+    if (bucket.tokens == 0) {
+        numDownlinkThrottled++;
+        LOG_DEBUG("Ignore MQTT downlink 0x%08x from 0x%08x, topic is over its rate", id, from);
+        return false;
+    }
+    bucket.tokens--;
+
+    recentDownlinks[nextRecentDownlink] = {from, id};
+    nextRecentDownlink = (nextRecentDownlink + 1) % MQTT_DOWNLINK_DEDUP_SIZE;
+    return true;
+}
+
 void MQTT::mqttCallback(char *topic, byte *payload, unsigned int length)
 {
     mqtt->onReceive(topic, payload, length);
 }
 
-void MQTT::onClientProxyReceive(meshtastic_MqttClientProxyMessage msg)
+void MQTT::localBrokerCallback(char *topic, byte *payload, unsigned int length)
+{
+    const std::string *topics[] = {&mqtt->cryptTopic, &mqtt->jsonTopic, &mqtt->batchTopic};
+    for (const std::string *t : topics)
+        if (strncmp(topic, t->c_str(), t->length()) == 0) {
+            mqtt->onReceive(topic, payload, length);
+            return;
+        }
+}
+
+void MQTT::onClientProxyReceive(meshtastic_MqttClientProxyMessage &msg)
 {
     onReceive(msg.topic, msg.payload_variant.data.bytes, msg.payload_variant.data.size);
 }
@@ -359,9 +425,11 @@ void MQTT::onReceive(char *topic, byte *payload, size_t length)
         // if another "/" was added, parse string up to that character
         channelName = strtok(channelName, "/") ? strtok(channelName, "/") : channelName;
         // We allow downlink JSON packets only on a channel named "mqtt"
-        const meshtastic_Channel &sendChannel = channels.getByName(channelName);
-        if (!(strncasecmp(channels.getGlobalId(sendChannel.index), Channels::mqttChannel, strlen(Channels::mqttChannel)) == 0 &&
-              sendChannel.settings.downlink_enabled)) {
+        int8_t sendIndex = channels.getIndexByGlobalId(channelName);
+        if (sendIndex < 0)
+            sendIndex = channels.getPrimaryIndex();
+        if (!(strncasecmp(channels.getGlobalId(sendIndex), Channels::mqttChannel, strlen(Channels::mqttChannel)) == 0 &&
+              channels.isDownlinkEnabled(sendIndex))) {
             LOG_WARN("JSON downlink received on channel not called 'mqtt' or without downlink enabled");
             return;
         }
@@ -370,6 +438,14 @@ void MQTT::onReceive(char *topic, byte *payload, size_t length)
         return;
     }
 
+    // a batch from a gateway saving on backhaul, each envelope in it is handled as if it had come on its own
+    if (strncmp(topic, batchTopic.c_str(), batchTopic.length()) == 0) {
+        if (!forEachBatchedEnvelope(payload, length,
+                                    [topic](const uint8_t *envelope, size_t envLength) { onReceiveProto(topic, envelope, envLength); }))
+            LOG_WARN("Malformed MQTT envelope batch, topic %s, len %u", topic, length);
+        return;
+    }
+
     onReceiveProto(topic, payload, length);
 }
 
@@ -381,9 +457,9 @@ void mqttInit()
 #if HAS_NETWORKING
 MQTT::MQTT() : MQTT(std::unique_ptr<MQTTClient>(new MQTTClient())) {}
 MQTT::MQTT(std::unique_ptr<MQTTClient> _mqttClient)
-    : concurrency::OSThread("mqtt"), mqttQueue(MAX_MQTT_QUEUE), mqttClient(std::move(_mqttClient)), pubSub(*mqttClient)
+    : concurrency::OSThread("mqtt"), mqttQueue(getMaxQueueSize()), mqttClient(std::move(_mqttClient)), pubSub(*mqttClient)
 #else
-MQTT::MQTT() : concurrency::OSThread("mqtt"), mqttQueue(MAX_MQTT_QUEUE)
+MQTT::MQTT() : concurrency::OSThread("mqtt"), mqttQueue(getMaxQueueSize())
 #endif
 {
     if (moduleConfig.mqtt.enabled) {
@@ -396,11 +472,13 @@ MQTT::MQTT() : concurrency::OSThread("mqtt"), mqttQueue(MAX_MQTT_QUEUE)
             cryptTopic = moduleConfig.mqtt.root + cryptTopic;
             jsonTopic = moduleConfig.mqtt.root + jsonTopic;
             mapTopic = moduleConfig.mqtt.root + mapTopic;
+            batchTopic = moduleConfig.mqtt.root + batchTopic;
             isConfiguredForDefaultRootTopic = isDefaultRootTopic(moduleConfig.mqtt.root);
         } else {
             cryptTopic = "msh" + cryptTopic;
             jsonTopic = "msh" + jsonTopic;
             mapTopic = "msh" + mapTopic;
+            batchTopic = "msh" + batchTopic;
             isConfiguredForDefaultRootTopic = true;
         }
 
@@ -420,6 +498,15 @@ MQTT::MQTT() : concurrency::OSThread("mqtt"), mqttQueue(MAX_MQTT_QUEUE)
         if (!moduleConfig.mqtt.proxy_to_client_enabled)
             pubSub.setCallback(mqttCallback);
 #endif
+#ifdef ARCH_PORTDUINO
+        // Local clients' publishes come in just like the server's, for the topics we would have subscribed to there
+        if (settingsMap[mqttBrokerPort] > 0 && !mqttBroker)
+            mqttBroker =
+                new MqttBroker(settingsStrings[mqttBrokerAddress].c_str(), settingsMap[mqttBrokerPort], localBrokerCallback);
+        localOnly = mqttBroker && mqttBroker->isListening() && settingsMap[mqttLocalOnly];
+        if (localOnly)
+            LOG_INFO("MQTT local broker only, don't connect to %s", moduleConfig.mqtt.address);
+#endif
 
         if (moduleConfig.mqtt.proxy_to_client_enabled) {
             LOG_INFO("MQTT configured to use client proxy");
@@ -444,6 +531,26 @@ bool MQTT::isConnectedDirectly()
 }
 
 bool MQTT::publish(const char *topic, const char *payload, bool retained)
+{
+    publishLocal(topic, (const uint8_t *)payload, strlen(payload));
+    return publishUpstream(topic, payload, retained);
+}
+
+bool MQTT::publish(const char *topic, const uint8_t *payload, size_t length, bool retained)
+{
+    publishLocal(topic, payload, length);
+    return publishUpstream(topic, payload, length, retained);
+}
+
+void MQTT::publishLocal(const char *topic, const uint8_t *payload, size_t length)
+{
+#ifdef ARCH_PORTDUINO
+    if (mqttBroker)
+        mqttBroker->publish(topic, payload, length);
+#endif
+}
+
+bool MQTT::publishUpstream(const char *topic, const char *payload, bool retained)
 {
     if (moduleConfig.mqtt.proxy_to_client_enabled) {
         meshtastic_MqttClientProxyMessage *msg = mqttClientProxyMessagePool.allocZeroed();
@@ -462,7 +569,7 @@ bool MQTT::publish(const char *topic, const char *payload, bool retained)
     return false;
 }
 
-bool MQTT::publish(const char *topic, const uint8_t *payload, size_t length, bool retained)
+bool MQTT::publishUpstream(const char *topic, const uint8_t *payload, size_t length, bool retained)
 {
     if (moduleConfig.mqtt.proxy_to_client_enabled) {
         meshtastic_MqttClientProxyMessage *msg = mqttClientProxyMessagePool.allocZeroed();
@@ -499,7 +606,15 @@ void MQTT::reconnect()
         MQTTClient *clientConnection = mqttClient.get();
 #if MQTT_SUPPORTS_TLS
         if (moduleConfig.mqtt.tls_enabled) {
+            if (memGet.getFreeHeap() < MQTT_TLS_MIN_FREE_HEAP) {
+                // Not the server's fault, so this doesn't count towards reconnecting WiFi either
+                LOG_WARN("Only %u bytes of heap free, put off the MQTT TLS handshake", memGet.getFreeHeap());
+                return;
+            }
             mqttClientTLS.setInsecure();
+#ifdef ARCH_RP2040
+            mqttClientTLS.setSession(&mqttTLSSession); // Resume the last session with the broker rather than a full handshake
+#endif
             LOG_INFO("Use TLS-encrypted session");
             clientConnection = &mqttClientTLS;
         } else {
@@ -541,8 +656,12 @@ void MQTT::sendSubscriptions()
             std::string topic = cryptTopic + channels.getGlobalId(i) + "/+";
             LOG_INFO("Subscribe to %s", topic.c_str());
             pubSub.subscribe(topic.c_str(), 1); // FIXME, is QOS 1 right?
-#if !defined(ARCH_NRF52) ||                                                                                                      \
-    defined(NRF52_USE_JSON) // JSON is not supported on nRF52, see issue #2804 ### Fixed by using ArduinoJSON ###
+#if MQTT_UPLINK_BATCH_MSEC
+            std::string topicBatch = batchTopic + channels.getGlobalId(i) + "/+";
+            LOG_INFO("Subscribe to %s", topicBatch.c_str());
+            pubSub.subscribe(topicBatch.c_str(), 1);
+#endif
+#if !defined(ARCH_NRF52) || NRF52_USE_JSON // nRF52 leaves JSON out to save flash, unless asked for
             if (moduleConfig.mqtt.json_enabled == true) {
                 std::string topicDecoded = jsonTopic + channels.getGlobalId(i) + "/+";
                 LOG_INFO("Subscribe to %s", topicDecoded.c_str());
@@ -565,9 +684,13 @@ int32_t MQTT::runOnce()
 {
     if (!moduleConfig.mqtt.enabled || !(moduleConfig.mqtt.map_reporting_enabled || channels.anyMqttEnabled()))
         return disable();
-    bool wantConnection = wantsLink();
+    bool wantConnection = wantsLink() && !localOnly;
 
     perhapsReportToMap();
+#if MQTT_UPLINK_BATCH_MSEC
+    if (!uplinkBatch.empty() && millis() - uplinkBatchStart >= MQTT_UPLINK_BATCH_MSEC)
+        flushUplinkBatch();
+#endif
 
     // If connected poll rapidly, otherwise only occasionally check for a wifi connection change and ability to contact server
     if (moduleConfig.mqtt.proxy_to_client_enabled) {
@@ -575,9 +698,14 @@ int32_t MQTT::runOnce()
         return 200;
     }
 #if HAS_NETWORKING
-    else if (!pubSub.loop()) {
-        if (!wantConnection)
-            return 5000; // If we don't want connection now, check again in 5 secs
+    else if (pubSub.connected() && !isConnectedToNetwork()) {
+        // The broker can't reach us now, don't wait out the keepalive on a TCP connection that's as good as dead
+        LOG_INFO("Network down, drop MQTT connection");
+        pubSub.disconnect();
+        return 1000;
+    } else if (!pubSub.loop()) {
+        if (!wantConnection) // Check again in 5 secs, or every second while waiting for the network to come back
+            return isConnectedToNetwork() ? 5000 : 1000;
         else {
             reconnect();
             // If we succeeded, empty the queue one by one and start reading rapidly, else try again in 30 seconds (TCP
@@ -593,6 +721,8 @@ int32_t MQTT::runOnce()
         if (!wantConnection) {
             LOG_INFO("MQTT link not needed, drop");
             pubSub.disconnect();
+        } else {
+            publishQueuedMessages(); // Keep working through whatever backlog the last batch didn't get to
         }
 
         powerFSM.trigger(EVENT_CONTACT_FROM_PHONE); // Suppress entering light sleep (because that would turn off bluetooth)
@@ -663,51 +793,53 @@ void MQTT::publishNodeInfo()
 {
     // TODO: NodeInfo broadcast over MQTT only (NODENUM_BROADCAST_NO_LORA)
 }
-void MQTT::publishQueuedMessages()
+int MQTT::getMaxQueueSize()
 {
-    if (mqttQueue.isEmpty())
-        return;
-
-    LOG_DEBUG("Publish enqueued MQTT message");
-    const std::unique_ptr<QueueEntry> entry(mqttQueue.dequeuePtr(0));
-    LOG_INFO("publish %s, %u bytes from queue", entry->topic.c_str(), entry->envBytes.size());
-    publish(entry->topic.c_str(), entry->envBytes.data(), entry->envBytes.size(), false);
-
-#if !defined(ARCH_NRF52) ||                                                                                                      \
-    defined(NRF52_USE_JSON) // JSON is not supported on nRF52, see issue #2804 ### Fixed by using ArduinoJson ###
-    if (!moduleConfig.mqtt.json_enabled)
-        return;
-
-    // handle json topic
-    const DecodedServiceEnvelope env(entry->envBytes.data(), entry->envBytes.size());
-    if (!env.validDecode || env.packet == NULL || env.channel_id == NULL)
-        return;
+    return memGet.getPsramSize() > 0 ? MAX_MQTT_QUEUE_PSRAM : MAX_MQTT_QUEUE;
+}
 
-    auto jsonString = MeshPacketSerializer::JsonSerialize(env.packet);
-    if (jsonString.length() == 0)
+void MQTT::publishQueuedMessages()
+{
+    if (!unsentEntry && mqttQueue.isEmpty())
         return;
 
-    std::string topicJson;
-    if (env.packet->pki_encrypted) {
-        topicJson = jsonTopic + "PKI/" + owner.id;
-    } else {
-        topicJson = jsonTopic + env.channel_id + "/" + owner.id;
+    // QoS0 publishes don't wait for the server, so we can keep writing until the socket pushes back or we used our budget
+    uint32_t start = millis();
+    size_t bytes = 0;
+    uint32_t published = 0;
+    while (bytes < MQTT_PUBLISH_BATCH_BYTES && millis() - start < MQTT_PUBLISH_BATCH_MSEC) {
+        std::unique_ptr<QueueEntry> entry(unsentEntry ? unsentEntry.release() : mqttQueue.dequeuePtr(0));
+        if (!entry)
+            break;
+
+        LOG_DEBUG("publish %s, %u bytes from queue", entry->topic.c_str(), entry->envBytes.size());
+        // Local subscribers had it when it was queued
+        if (!publishUpstream(entry->topic.c_str(), entry->envBytes.data(), entry->envBytes.size(), false)) {
+            unsentEntry = std::move(entry); // Try again once the link is back
+            break;
+        }
+        bytes += entry->envBytes.size();
+        published++;
+        numQueuePublished++;
+
+        // The JSON was serialized when the message was queued, so there is nothing to decode again here
+        if (!entry->json.empty()) {
+            LOG_INFO("JSON publish message to %s, %u bytes: %s", entry->jsonTopic.c_str(), entry->json.length(),
+                     entry->json.c_str());
+            publishUpstream(entry->jsonTopic.c_str(), entry->json.c_str(), false);
+            bytes += entry->json.length();
+        }
     }
-    LOG_INFO("JSON publish message to %s, %u bytes: %s", topicJson.c_str(), jsonString.length(), jsonString.c_str());
-    publish(topicJson.c_str(), jsonString.c_str(), false);
-#endif // ARCH_NRF52 NRF52_USE_JSON
+    LOG_INFO("Published %u queued MQTT messages (%u bytes), %u left, %u dropped so far", published, bytes,
+             mqttQueue.numUsed() + (unsentEntry ? 1 : 0), numQueueDropped);
 }
 
 void MQTT::onSend(const meshtastic_MeshPacket &mp_encrypted, const meshtastic_MeshPacket &mp_decoded, ChannelIndex chIndex)
 {
+    PERF_SCOPE(PERF_MQTT_SEND);
     if (mp_encrypted.via_mqtt)
         return; // Don't send messages that came from MQTT back into MQTT
-    bool uplinkEnabled = false;
-    for (int i = 0; i <= 7; i++) {
-        if (channels.getByIndex(i).settings.uplink_enabled)
-            uplinkEnabled = true;
-    }
-    if (!uplinkEnabled)
+    if (!channels.anyUplinkEnabled())
         return; // no channels have an uplink enabled
     auto &ch = channels.getByIndex(chIndex);
 
@@ -732,7 +864,7 @@ void MQTT::onSend(const meshtastic_MeshPacket &mp_encrypted, const meshtastic_Me
     // Either encrypted packet (we couldn't decrypt) is marked as pki_encrypted, or we could decode the PKI encrypted packet
     bool isPKIEncrypted = mp_encrypted.pki_encrypted || mp_decoded.pki_encrypted;
     // If it was to a channel, check uplink enabled, else must be pki_encrypted
-    if (!(ch.settings.uplink_enabled || isPKIEncrypted))
+    if (!(channels.isUplinkEnabled(chIndex) || isPKIEncrypted))
         return;
     const char *channelId = isPKIEncrypted ? "PKI" : channels.getGlobalId(chIndex);
 
@@ -752,35 +884,52 @@ void MQTT::onSend(const meshtastic_MeshPacket &mp_encrypted, const meshtastic_Me
     const meshtastic_ServiceEnvelope env = {
         .packet = const_cast<meshtastic_MeshPacket *>(p), .channel_id = const_cast<char *>(channelId), .gateway_id = owner.id};
     size_t numBytes = pb_encode_to_bytes(bytes, sizeof(bytes), &meshtastic_ServiceEnvelope_msg, &env);
-    std::string topic = cryptTopic + channelId + "/" + owner.id;
+    char topic[MQTT_MAX_TOPIC_LEN];
+    snprintf(topic, sizeof(topic), "%s%s/%s", cryptTopic.c_str(), channelId, owner.id);
+
+    // Serialize to JSON here while we have the decoded packet at hand, rather than decoding the envelope again later
+    std::string jsonString;
+    char topicJson[MQTT_MAX_TOPIC_LEN] = "";
+#if !defined(ARCH_NRF52) || NRF52_USE_JSON // nRF52 leaves JSON out to save flash, unless asked for
+    if (moduleConfig.mqtt.json_enabled) {
+        jsonString = MeshPacketSerializer::JsonSerialize(&mp_decoded);
+        snprintf(topicJson, sizeof(topicJson), "%s%s/%s", jsonTopic.c_str(), channelId, owner.id);
+    }
+#endif // ARCH_NRF52 NRF52_USE_JSON
+
+    // Local subscribers get every envelope on its own and straight away, whatever the upstream link is doing
+    publishLocal(topic, bytes, numBytes);
+    if (jsonString.length() != 0)
+        publishLocal(topicJson, (const uint8_t *)jsonString.c_str(), jsonString.length());
+    if (localOnly)
+        return;
 
     if (moduleConfig.mqtt.proxy_to_client_enabled || this->isConnectedDirectly()) {
-        LOG_DEBUG("MQTT Publish %s, %u bytes", topic.c_str(), numBytes);
-        publish(topic.c_str(), bytes, numBytes, false);
+#if MQTT_UPLINK_BATCH_MSEC
+        addToUplinkBatch(channelId, bytes, numBytes);
+#else
+        LOG_DEBUG("MQTT Publish %s, %u bytes", topic, numBytes);
+        publishUpstream(topic, bytes, numBytes, false);
+#endif
 
-#if !defined(ARCH_NRF52) ||                                                                                                      \
-    defined(NRF52_USE_JSON) // JSON is not supported on nRF52, see issue #2804 ### Fixed by using ArduinoJson ###
-        if (!moduleConfig.mqtt.json_enabled)
-            return;
-        // handle json topic
-        auto jsonString = MeshPacketSerializer::JsonSerialize(&mp_decoded);
         if (jsonString.length() == 0)
             return;
-        std::string topicJson = jsonTopic + channelId + "/" + owner.id;
-        LOG_INFO("JSON publish message to %s, %u bytes: %s", topicJson.c_str(), jsonString.length(), jsonString.c_str());
-        publish(topicJson.c_str(), jsonString.c_str(), false);
-#endif // ARCH_NRF52 NRF52_USE_JSON
+        LOG_INFO("JSON publish message to %s, %u bytes: %s", topicJson, jsonString.length(), jsonString.c_str());
+        publishUpstream(topicJson, jsonString.c_str(), false);
     } else {
         LOG_INFO("MQTT not connected, queue packet");
         QueueEntry *entry;
         if (mqttQueue.numFree() == 0) {
             LOG_WARN("MQTT queue is full, discard oldest");
             entry = mqttQueue.dequeuePtr(0);
+            numQueueDropped++;
         } else {
             entry = new QueueEntry;
         }
-        entry->topic = std::move(topic);
+        entry->topic = topic;
         entry->envBytes.assign(bytes, numBytes);
+        entry->json = std::move(jsonString);
+        entry->jsonTopic = entry->json.empty() ? "" : topicJson;
         if (mqttQueue.enqueue(entry, 0) == false) {
             LOG_CRIT("Failed to add a message to mqttQueue!");
             abort();
@@ -788,6 +937,34 @@ void MQTT::onSend(const meshtastic_MeshPacket &mp_encrypted, const meshtastic_Me
     }
 }
 
+void MQTT::addToUplinkBatch(const char *channelId, const uint8_t *envelope, size_t length)
+{
+    // The client proxy carries a batch in a single MqttClientProxyMessage
+    const size_t limit = moduleConfig.mqtt.proxy_to_client_enabled
+                             ? std::min<size_t>(MQTT_UPLINK_BATCH_BYTES, sizeof(meshtastic_MqttClientProxyMessage_data_t::bytes))
+                             : MQTT_UPLINK_BATCH_BYTES;
+    char topic[MQTT_MAX_TOPIC_LEN];
+    snprintf(topic, sizeof(topic), "%s%s/%s", batchTopic.c_str(), channelId, owner.id);
+
+    if (!uplinkBatch.empty() && (uplinkBatchTopic != topic || uplinkBatch.size() + length + 3 > limit))
+        flushUplinkBatch();
+    if (uplinkBatch.empty()) {
+        uplinkBatchTopic = topic;
+        uplinkBatchStart = millis();
+    }
+    appendBatchedEnvelope(uplinkBatch, envelope, length);
+}
+
+void MQTT::flushUplinkBatch()
+{
+    if (uplinkBatch.empty())
+        return;
+    LOG_DEBUG("MQTT Publish batch %s, %u bytes", uplinkBatchTopic.c_str(), uplinkBatch.size());
+    if (!publishUpstream(uplinkBatchTopic.c_str(), uplinkBatch.data(), uplinkBatch.size(), false))
+        LOG_WARN("MQTT batch publish failed, %u bytes lost", uplinkBatch.size());
+    uplinkBatch.clear();
+}
+
 void MQTT::perhapsReportToMap()
 {
     if (!moduleConfig.mqtt.map_reporting_enabled || !moduleConfig.mqtt.map_report_settings.should_report_location ||
@@ -811,15 +988,9 @@ void MQTT::perhapsReportToMap()
         return;
     }
 
-    // Allocate MeshPacket and fill it
-    meshtastic_MeshPacket *mp = packetPool.allocZeroed();
-    mp->which_payload_variant = meshtastic_MeshPacket_decoded_tag;
-    mp->from = nodeDB->getNodeNum();
-    mp->to = NODENUM_BROADCAST;
-    mp->decoded.portnum = meshtastic_PortNum_MAP_REPORT_APP;
-
-    // Fill MapReport message
-    meshtastic_MapReport mapReport = meshtastic_MapReport_init_default;
+    // Fill MapReport message. Zeroed first, padding included, so it can be compared with the last one
+    meshtastic_MapReport mapReport;
+    memset(&mapReport, 0, sizeof(mapReport));
     memcpy(mapReport.long_name, owner.long_name, sizeof(owner.long_name));
     memcpy(mapReport.short_name, owner.short_name, sizeof(owner.short_name));
     mapReport.role = config.device.role;
@@ -841,22 +1012,36 @@ void MQTT::perhapsReportToMap()
 
     mapReport.num_online_local_nodes = nodeDB->getNumOnlineMeshNodes(true);
 
-    // Encode MapReport message into the MeshPacket
-    mp->decoded.payload.size =
-        pb_encode_to_bytes(mp->decoded.payload.bytes, sizeof(mp->decoded.payload.bytes), &meshtastic_MapReport_msg, &mapReport);
-
-    // Encode the MeshPacket into a binary ServiceEnvelope and publish
-    const meshtastic_ServiceEnvelope se = {
-        .packet = mp,
-        .channel_id = (char *)channels.getGlobalId(channels.getPrimaryIndex()), // Use primary channel as the channel_id
-        .gateway_id = owner.id};
-    size_t numBytes = pb_encode_to_bytes(bytes, sizeof(bytes), &meshtastic_ServiceEnvelope_msg, &se);
+    // Only encode again if something changed. Moving within the reported precision doesn't count
+    const char *channelId = channels.getGlobalId(channels.getPrimaryIndex()); // Use primary channel as the channel_id
+    if (mapReportEnvelope.empty() || memcmp(&mapReport, &lastMapReport, sizeof(mapReport)) != 0 ||
+        lastMapReportChannelId != channelId || lastMapReportGatewayId != owner.id) {
+        // Allocate MeshPacket and fill it
+        meshtastic_MeshPacket *mp = packetPool.allocZeroed();
+        mp->which_payload_variant = meshtastic_MeshPacket_decoded_tag;
+        mp->from = nodeDB->getNodeNum();
+        mp->to = NODENUM_BROADCAST;
+        mp->decoded.portnum = meshtastic_PortNum_MAP_REPORT_APP;
+
+        // Encode MapReport message into the MeshPacket
+        mp->decoded.payload.size = pb_encode_to_bytes(mp->decoded.payload.bytes, sizeof(mp->decoded.payload.bytes),
+                                                      &meshtastic_MapReport_msg, &mapReport);
+
+        // Encode the MeshPacket into a binary ServiceEnvelope
+        const meshtastic_ServiceEnvelope se = {.packet = mp, .channel_id = (char *)channelId, .gateway_id = owner.id};
+        size_t numBytes = pb_encode_to_bytes(bytes, sizeof(bytes), &meshtastic_ServiceEnvelope_msg, &se);
+
+        // Release the allocated memory for MeshPacket
+        packetPool.release(mp);
+
+        mapReportEnvelope.assign(bytes, numBytes);
+        memcpy(&lastMapReport, &mapReport, sizeof(mapReport));
+        lastMapReportChannelId = channelId;
+        lastMapReportGatewayId = owner.id;
+    }
 
     LOG_INFO("MQTT Publish map report to %s", mapTopic.c_str());
-    publish(mapTopic.c_str(), bytes, numBytes, false);
-
-    // Release the allocated memory for MeshPacket
-    packetPool.release(mp);
+    publish(mapTopic.c_str(), mapReportEnvelope.data(), mapReportEnvelope.size(), false);
 
     // Update the last report time
     last_report_to_map = millis();
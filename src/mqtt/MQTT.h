@@ -16,7 +16,7 @@
 #endif
 #endif
 #if HAS_ETHERNET && !defined(USE_WS5500)
-#include <EthernetClient.h>
+#include "mesh/eth/ethBurstClient.h"
 #endif
 
 #if HAS_NETWORKING
@@ -25,6 +25,41 @@
 #endif
 
 #define MAX_MQTT_QUEUE 16
+// With PSRAM there is room to ride out a much longer outage
+#ifndef MAX_MQTT_QUEUE_PSRAM
+#define MAX_MQTT_QUEUE_PSRAM 256
+#endif
+
+// How much of the backlog one publishQueuedMessages() pass may send, so catching up doesn't starve the rest of the firmware
+#ifndef MQTT_PUBLISH_BATCH_BYTES
+#define MQTT_PUBLISH_BATCH_BYTES 8192
+#endif
+#ifndef MQTT_PUBLISH_BATCH_MSEC
+#define MQTT_PUBLISH_BATCH_MSEC 50
+#endif
+
+// Downlinks get admitted before they take a packet pool slot: the same packet usually arrives from many gateways at once,
+// and a busy broker shouldn't be able to fill our receive queue
+#ifndef MQTT_DOWNLINK_DEDUP_SIZE
+#define MQTT_DOWNLINK_DEDUP_SIZE 64 // Recently admitted (from, id) pairs
+#endif
+#ifndef MQTT_DOWNLINK_BURST
+#define MQTT_DOWNLINK_BURST 20 // Packets a topic may deliver back to back
+#endif
+#ifndef MQTT_DOWNLINK_REFILL_MSEC
+#define MQTT_DOWNLINK_REFILL_MSEC 500 // After that one more every this long, 120 a minute per topic
+#endif
+
+// For metered backhaul: collect uplinked envelopes for up to this long and publish them together on root/2/eb/CHANNELID/NODEID
+// (see appendBatchedEnvelope()), instead of one publish per packet.  0 publishes every packet on its own as usual.
+#ifndef MQTT_UPLINK_BATCH_MSEC
+#define MQTT_UPLINK_BATCH_MSEC 0
+#endif
+#ifndef MQTT_UPLINK_BATCH_BYTES
+#define MQTT_UPLINK_BATCH_BYTES 768 // Leaves room for the topic in the 1024 byte PubSubClient buffer
+#endif
+
+#define MQTT_MAX_TOPIC_LEN 128 // root + "/2/json/" + channel id + "/" + node id, with room to spare
 
 /**
  * Our wrapper/singleton for sending/receiving MQTT "udp" packets.  This object isolates the MQTT protocol implementation from
@@ -48,11 +83,13 @@ class MQTT : private concurrency::OSThread
 
     bool isConnectedDirectly();
 
+    /// Publish to the configured server, and to local subscribers of meshtasticd's broker
     bool publish(const char *topic, const char *payload, bool retained);
 
     bool publish(const char *topic, const uint8_t *payload, size_t length, const bool retained);
 
-    void onClientProxyReceive(meshtastic_MqttClientProxyMessage msg);
+    /// An MQTT message the phone received for us.  Parsed in place, which cuts up the topic, so it isn't copied per envelope
+    void onClientProxyReceive(meshtastic_MqttClientProxyMessage &msg);
 
     bool isEnabled() { return this->enabled; };
 
@@ -64,16 +101,56 @@ class MQTT : private concurrency::OSThread
     /// Validate the meshtastic_ModuleConfig_MQTTConfig.
     static bool isValidConfig(const meshtastic_ModuleConfig_MQTTConfig &config) { return isValidConfig(config, nullptr); }
 
+    /// Messages published from the queue, and messages dropped because the queue was full
+    uint32_t getNumQueuePublished() const { return numQueuePublished; }
+    uint32_t getNumQueueDropped() const { return numQueueDropped; }
+
+    /**
+     * Should a downlinked packet go on to the router?  Drops repeats of a recently admitted (from, id) and packets from a topic
+     * that is over its rate.
+     * @param topicIndex the channel the packet came in on, MAX_NUM_CHANNELS for PKI
+     */
+    bool admitDownlink(NodeNum from, PacketId id, uint8_t topicIndex);
+
+    /// Downlinks dropped as duplicates, and because their topic was flooding us
+    uint32_t getNumDownlinkDuplicates() const { return numDownlinkDuplicates; }
+    uint32_t getNumDownlinkThrottled() const { return numDownlinkThrottled; }
+
   protected:
     struct QueueEntry {
         std::string topic;
         std::basic_string<uint8_t> envBytes; // binary/pb_encode_to_bytes ServiceEnvelope
+        std::string jsonTopic, json;         // Serialized while we still had the decoded packet, empty unless json_enabled
     };
     PointerQueue<QueueEntry> mqttQueue;
+    std::unique_ptr<QueueEntry> unsentEntry; // Dequeued, but the server didn't take it, so it goes first next time
+
+    uint32_t numQueuePublished = 0;
+    uint32_t numQueueDropped = 0;
+
+    struct DownlinkId {
+        NodeNum from;
+        PacketId id;
+    };
+    DownlinkId recentDownlinks[MQTT_DOWNLINK_DEDUP_SIZE] = {};
+    uint8_t nextRecentDownlink = 0;
+
+    struct DownlinkBucket {
+        uint8_t tokens = MQTT_DOWNLINK_BURST;
+        uint32_t lastRefill = 0;
+    };
+    DownlinkBucket downlinkBuckets[MAX_NUM_CHANNELS + 1]; // One per channel topic, plus PKI
+
+    uint32_t numDownlinkDuplicates = 0;
+    uint32_t numDownlinkThrottled = 0;
+
+    /// @return how many messages mqttQueue should hold on this device
+    static int getMaxQueueSize();
 
     int reconnectCount = 0;
     bool isConfiguredForDefaultServer = true;
     bool isConfiguredForDefaultRootTopic = true;
+    bool localOnly = false; // Only meshtasticd's own broker, no connection to the configured server
 
     virtual int32_t runOnce() override;
 
@@ -87,7 +164,7 @@ class MQTT : private concurrency::OSThread
 #define MQTT_SUPPORTS_TLS 1
 #endif
 #elif HAS_ETHERNET
-    using MQTTClient = EthernetClient;
+    using MQTTClient = ethBurstClient;
 #else
     using MQTTClient = void;
 #endif
@@ -96,6 +173,9 @@ class MQTT : private concurrency::OSThread
     std::unique_ptr<MQTTClient> mqttClient;
 #if MQTT_SUPPORTS_TLS
     MQTTClientTLS mqttClientTLS;
+#ifdef ARCH_RP2040
+    BearSSL::Session mqttTLSSession; // What BearSSL needs to resume our TLS session with the broker after a reconnect
+#endif
 #endif
     PubSubClient pubSub;
     explicit MQTT(std::unique_ptr<MQTTClient> mqttClient);
@@ -104,6 +184,18 @@ class MQTT : private concurrency::OSThread
     std::string cryptTopic = "/2/e/";   // msh/2/e/CHANNELID/NODEID
     std::string jsonTopic = "/2/json/"; // msh/2/json/CHANNELID/NODEID
     std::string mapTopic = "/2/map/";   // For protobuf-encoded MapReport messages
+    std::string batchTopic = "/2/eb/";  // msh/2/eb/CHANNELID/NODEID, several envelopes per message
+
+    // The uplink batch being collected, only used if MQTT_UPLINK_BATCH_MSEC is set
+    std::string uplinkBatchTopic;
+    std::basic_string<uint8_t> uplinkBatch;
+    uint32_t uplinkBatchStart = 0;
+
+    /// Add an encoded envelope to the uplink batch for channelId, publishing the batch first if it can't take it
+    void addToUplinkBatch(const char *channelId, const uint8_t *envelope, size_t length);
+
+    /// Publish whatever the uplink batch holds
+    void flushUplinkBatch();
 
     // For map reporting (only applies when enabled)
     const uint32_t default_map_position_precision = 14; // defaults to max. offset of ~1459m
@@ -111,6 +203,12 @@ class MQTT : private concurrency::OSThread
     uint32_t map_position_precision = default_map_position_precision;
     uint32_t map_publish_interval_msecs = default_map_publish_interval_secs * 1000;
 
+    // The last map report, and the envelope it was encoded into, which we publish again as long as nothing in it changes
+    meshtastic_MapReport lastMapReport = meshtastic_MapReport_init_default;
+    std::string lastMapReportChannelId;
+    std::string lastMapReportGatewayId;
+    std::basic_string<uint8_t> mapReportEnvelope;
+
     /** Attempt to connect to server if necessary
      */
     void reconnect();
@@ -122,13 +220,24 @@ class MQTT : private concurrency::OSThread
     /// Callback for direct mqtt subscription messages
     static void mqttCallback(char *topic, byte *payload, unsigned int length);
 
+    /// Callback for publishes from clients of meshtasticd's own broker, only the topics we subscribe to upstream go further
+    static void localBrokerCallback(char *topic, byte *payload, unsigned int length);
+
     static bool isValidConfig(const meshtastic_ModuleConfig_MQTTConfig &config, MQTTClient *client);
 
     /// Called when a new publish arrives from the MQTT server
     void onReceive(char *topic, byte *payload, size_t length);
 
+    /// Publish as much of the queue as the server takes, within MQTT_PUBLISH_BATCH_BYTES/MSEC
     void publishQueuedMessages();
 
+    /// Hand the message to meshtasticd's own broker, if it has one (see MqttBroker)
+    void publishLocal(const char *topic, const uint8_t *payload, size_t length);
+
+    /// Publish to the configured server only, directly or through the client proxy
+    bool publishUpstream(const char *topic, const char *payload, bool retained);
+    bool publishUpstream(const char *topic, const uint8_t *payload, size_t length, bool retained);
+
     void publishNodeInfo();
 
     // Check if we should report unencrypted information about our node for consumption by a map
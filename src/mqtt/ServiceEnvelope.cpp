@@ -20,4 +20,39 @@ DecodedServiceEnvelope::~DecodedServiceEnvelope()
 {
     if (validDecode)
         pb_release(&meshtastic_ServiceEnvelope_msg, this);
-}
\ No newline at end of file
+}
+
+void appendBatchedEnvelope(std::basic_string<uint8_t> &batch, const uint8_t *envelope, size_t length)
+{
+    size_t v = length;
+    do {
+        uint8_t b = v & 0x7f;
+        v >>= 7;
+        batch.push_back(v ? (b | 0x80) : b);
+    } while (v);
+    batch.append(envelope, length);
+}
+
+bool forEachBatchedEnvelope(const uint8_t *batch, size_t length,
+                            const std::function<void(const uint8_t *envelope, size_t length)> &onEnvelope)
+{
+    size_t pos = 0;
+    while (pos < length) {
+        // An envelope is far smaller than 2^21, so three varint bytes is plenty
+        uint32_t envLength = 0;
+        uint8_t shift = 0, b;
+        do {
+            if (pos >= length || shift > 14)
+                return false;
+            b = batch[pos++];
+            envLength |= (uint32_t)(b & 0x7f) << shift;
+            shift += 7;
+        } while (b & 0x80);
+
+        if (envLength == 0 || envLength > length - pos)
+            return false;
+        onEnvelope(batch + pos, envLength);
+        pos += envLength;
+    }
+    return true;
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "mesh/generated/meshtastic/mqtt.pb.h"
+#include <functional>
+#include <string>
 
 // meshtastic_ServiceEnvelope that automatically releases dynamically allocated memory when it goes out of scope.
 struct DecodedServiceEnvelope : public meshtastic_ServiceEnvelope {
@@ -10,4 +12,19 @@ struct DecodedServiceEnvelope : public meshtastic_ServiceEnvelope {
     ~DecodedServiceEnvelope();
     // Clients must check that this is true before using.
     const bool validDecode;
-};
\ No newline at end of file
+};
+
+/*
+ * A batch, as published on the root/2/eb/CHANNELID/NODEID topics, is a plain concatenation of encoded ServiceEnvelopes, each
+ * prefixed with its length as a protobuf varint (the same framing protobuf uses for delimited streams).
+ */
+
+/// Append one encoded ServiceEnvelope to a batch
+void appendBatchedEnvelope(std::basic_string<uint8_t> &batch, const uint8_t *envelope, size_t length);
+
+/**
+ * Hand each encoded ServiceEnvelope in a batch to onEnvelope, in order.
+ * @return false if the batch is malformed, the envelopes in front of the damage have been handed over by then
+ */
+bool forEachBatchedEnvelope(const uint8_t *batch, size_t length,
+                            const std::function<void(const uint8_t *envelope, size_t length)> &onEnvelope);
@@ -11,6 +11,10 @@
 #include <NimBLEDevice.h>
 #include <mutex>
 
+#ifndef BLE_PREFERRED_MTU
+#define BLE_PREFERRED_MTU 517 // Big enough that any FromRadio fits in one read response, without long read round trips
+#endif
+
 NimBLECharacteristic *fromNumCharacteristic;
 NimBLECharacteristic *BatteryCharacteristic;
 NimBLECharacteristic *logRadioCharacteristic;
@@ -25,12 +29,19 @@ class BluetoothPhoneAPI : public PhoneAPI, public concurrency::OSThread
     std::vector<NimBLEAttValue> nimble_queue;
     std::mutex nimble_mutex;
     uint8_t queue_size = 0;
-    bool has_fromRadio = false;
-    uint8_t fromRadioBytes[meshtastic_FromRadio_size] = {0};
+    bool has_fromRadio = false; // fromRadioBytes holds the next message for the phone, fetched before it asked
+    uint8_t fromRadioBytes[MAX_TO_FROM_RADIO_SIZE] = {0}; // Room for a batch, see getFromRadioBatch()
     size_t numBytes = 0;
     bool hasChecked = false;
     bool phoneWants = false;
 
+    /// Have runOnce() prefetch the next message as soon as it can, rather than at its next 100ms poll
+    void wake()
+    {
+        setIntervalFromNow(0);
+        concurrency::mainDelay.interrupt();
+    }
+
   protected:
     virtual int32_t runOnce() override
     {
@@ -42,10 +53,14 @@ class BluetoothPhoneAPI : public PhoneAPI, public concurrency::OSThread
             LOG_DEBUG("Queue_size %u", queue_size);
             queue_size = 0;
         }
-        if (hasChecked == false && phoneWants == true) {
-            numBytes = getFromRadio(fromRadioBytes);
-            hasChecked = true;
+        // Keep the next message ready, so each read from the phone is answered straight away instead of waiting a pass of
+        // the main loop.  During the initial download that wait used to be most of the time per message.
+        if (!has_fromRadio && checkIsConnected()) {
+            numBytes = getFromRadioBatch(fromRadioBytes, sizeof(fromRadioBytes));
+            has_fromRadio = numBytes != 0;
         }
+        if (phoneWants)
+            hasChecked = true;
 
         return 100;
     }
@@ -63,6 +78,7 @@ class BluetoothPhoneAPI : public PhoneAPI, public concurrency::OSThread
 
         fromNumCharacteristic->setValue(val, sizeof(val));
         fromNumCharacteristic->notify();
+        setIntervalFromNow(0); // Prefetch it before the phone asks
     }
 
     /// Check the current underlying physical link to see if the client is currently connected
@@ -99,28 +115,44 @@ class NimbleBluetoothFromRadioCallback : public NimBLECharacteristicCallbacks
 {
     virtual void onRead(NimBLECharacteristic *pCharacteristic)
     {
-        int tries = 0;
-        bluetoothPhoneAPI->phoneWants = true;
-        while (!bluetoothPhoneAPI->hasChecked && tries < 100) {
-            bluetoothPhoneAPI->setIntervalFromNow(0);
-            delay(20);
-            tries++;
+        if (!bluetoothPhoneAPI->has_fromRadio) {
+            // Nothing prefetched, give the main loop one pass to find something (or confirm there's nothing)
+            int tries = 0;
+            bluetoothPhoneAPI->hasChecked = false;
+            bluetoothPhoneAPI->phoneWants = true;
+            while (!bluetoothPhoneAPI->hasChecked && tries < 100) {
+                bluetoothPhoneAPI->wake();
+                delay(20);
+                tries++;
+            }
         }
         std::lock_guard<std::mutex> guard(bluetoothPhoneAPI->nimble_mutex);
-        std::string fromRadioByteString(bluetoothPhoneAPI->fromRadioBytes,
-                                        bluetoothPhoneAPI->fromRadioBytes + bluetoothPhoneAPI->numBytes);
-        pCharacteristic->setValue(fromRadioByteString);
+        pCharacteristic->setValue(bluetoothPhoneAPI->fromRadioBytes, bluetoothPhoneAPI->numBytes);
 
-        if (bluetoothPhoneAPI->numBytes != 0) // if we did send something, queue it up right away to reload
-            bluetoothPhoneAPI->setIntervalFromNow(0);
+        bool sent = bluetoothPhoneAPI->numBytes != 0;
         bluetoothPhoneAPI->numBytes = 0;
+        bluetoothPhoneAPI->has_fromRadio = false;
         bluetoothPhoneAPI->hasChecked = false;
         bluetoothPhoneAPI->phoneWants = false;
+        if (sent) // if we did send something, fetch the next one while this one is on the air
+            bluetoothPhoneAPI->wake();
     }
 };
 
 class NimbleBluetoothServerCallback : public NimBLEServerCallbacks
 {
+    virtual void onConnect(NimBLEServer *pServer, ble_gap_conn_desc *desc)
+    {
+        // All of these are requests, the phone and our controller settle on what they both support
+        pServer->setDataLen(desc->conn_handle, 251); // Longest link layer packet, so an MTU sized read isn't split up
+        pServer->updateConnParams(desc->conn_handle, BLE_CONN_INTERVAL_MIN, BLE_CONN_INTERVAL_MAX, 0,
+                                  BLE_CONN_SUPERVISION_TIMEOUT);
+#ifndef CONFIG_IDF_TARGET_ESP32 // The original ESP32 only has the 1M PHY
+        ble_gap_set_prefered_le_phy(desc->conn_handle, BLE_GAP_LE_PHY_2M_MASK, BLE_GAP_LE_PHY_2M_MASK,
+                                    BLE_GAP_LE_PHY_CODED_ANY);
+#endif
+    }
+
     virtual uint32_t onPassKeyRequest()
     {
         uint32_t passkey = config.bluetooth.fixed_pin;
@@ -196,6 +228,7 @@ class NimbleBluetoothServerCallback : public NimBLEServerCallbacks
             bluetoothPhoneAPI->hasChecked = false;
             bluetoothPhoneAPI->phoneWants = false;
             bluetoothPhoneAPI->numBytes = 0;
+            bluetoothPhoneAPI->has_fromRadio = false;
             bluetoothPhoneAPI->queue_size = 0;
         }
     }
@@ -263,6 +296,7 @@ void NimbleBluetooth::setup()
 
     NimBLEDevice::init(getDeviceName());
     NimBLEDevice::setPower(ESP_PWR_LVL_P9);
+    NimBLEDevice::setMTU(BLE_PREFERRED_MTU);
 
     if (config.bluetooth.mode != meshtastic_Config_BluetoothConfig_PairingMode_NO_PIN) {
         NimBLEDevice::setSecurityAuth(BLE_SM_PAIR_AUTHREQ_BOND | BLE_SM_PAIR_AUTHREQ_MITM | BLE_SM_PAIR_AUTHREQ_SC);
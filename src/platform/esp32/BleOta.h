@@ -4,6 +4,10 @@
 #include <Arduino.h>
 #include <functional>
 
+/**
+ * Hand-off to the Meshtastic-OTA app in the other app partition.  That app, not this firmware, receives the image over BLE
+ * and writes it, so how images are transferred (compression, resuming) is up to it; we only find it and boot into it.
+ */
 class BleOta
 {
   public:
@@ -4,6 +4,10 @@
 #include "mesh-pb-constants.h"
 #include <Arduino.h>
 
+/**
+ * Hand-off to the OTA-WiFi app in the OTA_1 partition, which receives and writes the image itself.  We save the WiFi
+ * settings it needs before booting into it and take them back on the first boot after an update.
+ */
 namespace WiFiOTA
 {
 void initialize();
@@ -25,7 +25,7 @@ static BLEDfuSecure bledfusecure;                                             //
 // This scratch buffer is used for various bluetooth reads/writes - but it is safe because only one bt operation can be in
 // process at once
 // static uint8_t trBytes[_max(_max(_max(_max(ToRadio_size, RadioConfig_size), User_size), MyNodeInfo_size), FromRadio_size)];
-static uint8_t fromRadioBytes[meshtastic_FromRadio_size];
+static uint8_t fromRadioBytes[MAX_TO_FROM_RADIO_SIZE]; // Room for a batch, see getFromRadioBatch()
 static uint8_t toRadioBytes[meshtastic_ToRadio_size];
 
 static uint16_t connectionHandle;
@@ -58,6 +58,13 @@ void onConnect(uint16_t conn_handle)
     connection->getPeerName(central_name, sizeof(central_name));
     LOG_INFO("BLE Connected to %s", central_name);
 
+    // Ask for the 2M PHY, the longest packets and a short interval, so the NodeDB download runs at what the link allows.
+    // These are all requests, the phone settles on what it supports.
+    connection->requestPHY(BLE_GAP_PHY_2MBPS);
+    connection->requestDataLengthUpdate();
+    connection->requestMtuExchange(Bluefruit.getMaxMtu(BLE_GAP_ROLE_PERIPH));
+    connection->requestConnectionParameter(BLE_CONN_INTERVAL_MIN, 0, BLE_CONN_SUPERVISION_TIMEOUT);
+
     // Notify UI (or any other interested firmware components)
     bluetoothStatus->updateStatus(new meshtastic::BluetoothStatus(meshtastic::BluetoothStatus::ConnectionState::CONNECTED));
 }
@@ -134,7 +141,7 @@ void onFromRadioAuthorize(uint16_t conn_hdl, BLECharacteristic *chr, ble_gatts_e
 {
     if (request->offset == 0) {
         // If the read is long, we will get multiple authorize invocations - we only populate data on the first
-        size_t numBytes = bluetoothPhoneAPI->getFromRadio(fromRadioBytes);
+        size_t numBytes = bluetoothPhoneAPI->getFromRadioBatch(fromRadioBytes, sizeof(fromRadioBytes));
         // Someone is going to read our value as soon as this callback returns.  So fill it with the next message in the queue
         // or make empty if the queue is empty
         fromRadio.write(fromRadioBytes, numBytes);
@@ -4,16 +4,30 @@
 #include <Adafruit_nRFCrypto.h>
 class NRF52CryptoEngine : public CryptoEngine
 {
+    // Expanded AES256 round keys (AES128 is done by the CC310 and needs no schedule from us)
+    AES_ctx ctx256[MAX_CACHED_KEYS];
+
   public:
     NRF52CryptoEngine() {}
 
     ~NRF52CryptoEngine() {}
 
-    virtual void encryptAESCtr(CryptoKey _key, uint8_t *_nonce, size_t numBytes, uint8_t *bytes) override
+    virtual void clearKeyCache() override
+    {
+        CryptoEngine::clearKeyCache();
+        memset(ctx256, 0, sizeof(ctx256));
+    }
+
+    /// AES128 on the CC310, AES256 (which the CC310 doesn't do) with tiny-aes
+    virtual bool platformAESCtr(CryptoKey _key, uint8_t *_nonce, size_t numBytes, uint8_t *bytes) override
     {
         if (_key.length > 16) {
-            AES_ctx ctx;
-            AES_init_ctx_iv(&ctx, _key.bytes, _nonce);
+            bool isNew;
+            uint8_t slot = getCachedKeySlot(_key, isNew);
+            AES_ctx &ctx = ctx256[slot];
+            if (isNew)
+                AES_init_ctx(&ctx, _key.bytes);
+            AES_ctx_set_iv(&ctx, _nonce);
             AES_CTR_xcrypt_buffer(&ctx, bytes, numBytes);
         } else if (_key.length > 0) {
             nRFCrypto.begin();
@@ -26,6 +40,7 @@ class NRF52CryptoEngine : public CryptoEngine
             nRFCrypto.end();
             memcpy(bytes, encBuf, numBytes);
         }
+        return true;
     }
 };
 
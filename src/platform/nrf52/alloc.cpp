@@ -1,32 +1,148 @@
+#include "alloc.h"
 #include "configuration.h"
+#include "mesh/MemoryPool.h"
 #include "rtos.h"
 #include <assert.h>
 #include <stdlib.h>
 
+#if NRF52_SLAB_ALLOC
+static constexpr uint16_t slabSizes[] = NRF52_SLAB_SIZES;
+static constexpr uint16_t slabBlocks[] = NRF52_SLAB_BLOCKS;
+static_assert(sizeof(slabSizes) / sizeof(slabSizes[0]) == NRF52_SLAB_CLASSES, "One size per slab class");
+static_assert(sizeof(slabBlocks) / sizeof(slabBlocks[0]) == NRF52_SLAB_CLASSES, "One block count per slab class");
+
+static constexpr size_t storageBytes(size_t i = 0)
+{
+    return i == NRF52_SLAB_CLASSES ? 0 : slabSizes[i] * slabBlocks[i] + storageBytes(i + 1);
+}
+static constexpr bool sizesAscendAligned(size_t i = 0)
+{
+    return i == NRF52_SLAB_CLASSES ||
+           (slabSizes[i] % 8 == 0 && (i == 0 || slabSizes[i] > slabSizes[i - 1]) && sizesAscendAligned(i + 1));
+}
+static_assert(sizesAscendAligned(), "Slab sizes must go up in multiples of 8");
+
+struct SlabClass {
+    uint8_t *start, *end; // Its blocks, end is one past the last
+    void *freeList;       // The first free block, each starts with a pointer to the next
+    AllocatorStats stats;
+};
+
+alignas(8) static uint8_t slabStorage[storageBytes()];
+static SlabClass slabs[NRF52_SLAB_CLASSES];
+static bool slabsReady;
+
+// operator new can run before main(), from static constructors, so the free lists are threaded on first use
+static void initSlabs()
+{
+    uint8_t *p = slabStorage;
+    for (size_t i = 0; i < NRF52_SLAB_CLASSES; i++) {
+        SlabClass &s = slabs[i];
+        s.start = p;
+        s.freeList = NULL;
+        for (size_t b = slabBlocks[i]; b-- > 0;) {
+            void **block = (void **)(p + b * slabSizes[i]);
+            *block = s.freeList;
+            s.freeList = block;
+        }
+        p += slabSizes[i] * slabBlocks[i];
+        s.end = p;
+        s.stats.capacity = slabBlocks[i];
+    }
+    slabsReady = true;
+}
+
+static void *slabAlloc(size_t size)
+{
+    void *p = NULL;
+    vTaskSuspendAll(); // As rtos_malloc guards the heap
+    if (!slabsReady)
+        initSlabs();
+    for (size_t i = 0; i < NRF52_SLAB_CLASSES; i++) {
+        if (size > slabSizes[i])
+            continue;
+        SlabClass &s = slabs[i];
+        if (s.freeList) {
+            p = s.freeList;
+            s.freeList = *(void **)p;
+            if (++s.stats.inUse > s.stats.highWater)
+                s.stats.highWater = s.stats.inUse;
+        } else {
+            s.stats.allocFailures++; // Falls through to the heap, the next size up would waste more than it saves
+        }
+        break;
+    }
+    xTaskResumeAll();
+    return p ? p : rtos_malloc(size);
+}
+
+static void slabFree(void *ptr)
+{
+    if (ptr < (void *)slabStorage || ptr >= (void *)(slabStorage + sizeof(slabStorage))) {
+        rtos_free(ptr);
+        return;
+    }
+    vTaskSuspendAll();
+    for (size_t i = 0; i < NRF52_SLAB_CLASSES; i++) {
+        SlabClass &s = slabs[i];
+        if (ptr < (void *)s.end) {
+            *(void **)ptr = s.freeList;
+            s.freeList = ptr;
+            s.stats.inUse--;
+            break;
+        }
+    }
+    xTaskResumeAll();
+}
+
+bool nrf52GetSlabStats(uint8_t i, size_t &blockSize, AllocatorStats &stats)
+{
+    if (i >= NRF52_SLAB_CLASSES)
+        return false;
+    vTaskSuspendAll();
+    if (!slabsReady)
+        initSlabs();
+    blockSize = slabSizes[i];
+    stats = slabs[i].stats;
+    xTaskResumeAll();
+    return true;
+}
+#else
+#define slabAlloc rtos_malloc
+#define slabFree rtos_free
+
+bool nrf52GetSlabStats(uint8_t i, size_t &blockSize, AllocatorStats &stats)
+{
+    return false;
+}
+#endif
+
 /**
  * Custom new/delete to panic if out out memory
  */
 
 void *operator new(size_t size)
 {
-    auto p = rtos_malloc(size);
+    auto p = slabAlloc(size);
     assert(p);
     return p;
 }
 
 void *operator new[](size_t size)
 {
-    auto p = rtos_malloc(size);
+    auto p = slabAlloc(size);
     assert(p);
     return p;
 }
 
 void operator delete(void *ptr)
 {
-    rtos_free(ptr);
+    if (ptr)
+        slabFree(ptr);
 }
 
 void operator delete[](void *ptr)
 {
-    rtos_free(ptr);
-}
\ No newline at end of file
+    if (ptr)
+        slabFree(ptr);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct AllocatorStats;
+
+// Small allocations are served from fixed pools of a few sizes before the general heap, so the many short lived strings,
+// vectors and JSON nodes can't fragment it over months of uptime. 0 sends everything to rtos_malloc.
+#ifndef NRF52_SLAB_ALLOC
+#define NRF52_SLAB_ALLOC 1
+#endif
+
+// Block size of each slab class, smallest first, and how many blocks each one has
+#ifndef NRF52_SLAB_SIZES
+#define NRF52_SLAB_SIZES {16, 32, 64, 128, 256}
+#endif
+#ifndef NRF52_SLAB_BLOCKS
+#define NRF52_SLAB_BLOCKS {64, 64, 32, 16, 8}
+#endif
+#define NRF52_SLAB_CLASSES 5
+
+/// The block size of slab class i and how its pool is doing, allocFailures counting the ones that went to the heap instead
+/// @return false if there is no class i
+bool nrf52GetSlabStats(uint8_t i, size_t &blockSize, AllocatorStats &stats);
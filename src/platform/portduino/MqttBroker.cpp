@@ -0,0 +1,388 @@
+#include "MqttBroker.h"
+#include "configuration.h"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+MqttBroker *mqttBroker;
+
+// MQTT control packet types, the high nibble of the first byte
+enum {
+    MQTT_CONNECT = 1,
+    MQTT_CONNACK,
+    MQTT_PUBLISH,
+    MQTT_PUBACK,
+    MQTT_PUBREC,
+    MQTT_PUBREL,
+    MQTT_PUBCOMP,
+    MQTT_SUBSCRIBE,
+    MQTT_SUBACK,
+    MQTT_UNSUBSCRIBE,
+    MQTT_UNSUBACK,
+    MQTT_PINGREQ,
+    MQTT_PINGRESP,
+    MQTT_DISCONNECT
+};
+
+#define MQTT_CONNECT_TIMEOUT_MSEC 10000 // For a client to send its CONNECT
+
+/// Append an MQTT remaining length, 1 to 4 bytes of 7 bits each
+static size_t encodeLength(uint8_t *out, size_t len)
+{
+    size_t n = 0;
+    do {
+        uint8_t b = len & 0x7f;
+        len >>= 7;
+        out[n++] = len ? (b | 0x80) : b;
+    } while (len);
+    return n;
+}
+
+/// Read a length prefixed string at body[pos], false if it runs past len
+static bool readString(const uint8_t *body, size_t len, size_t &pos, std::string &out)
+{
+    if (pos + 2 > len)
+        return false;
+    size_t n = (body[pos] << 8) | body[pos + 1];
+    if (pos + 2 + n > len)
+        return false;
+    out.assign((const char *)body + pos + 2, n);
+    pos += 2 + n;
+    return true;
+}
+
+MqttBroker::MqttBroker(const char *address, int port, PublishCallback onPublish)
+    : concurrency::OSThread("MqttBroker"), onPublish(onPublish)
+{
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, address, &addr.sin_addr) != 1) {
+        LOG_ERROR("MQTT broker address %s is not an IPv4 address", address);
+        return;
+    }
+
+    listenFd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    int one = 1;
+    if (listenFd < 0 || setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) != 0 ||
+        bind(listenFd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(listenFd, MQTT_BROKER_MAX_CLIENTS) != 0) {
+        LOG_ERROR("MQTT broker can't listen on %s:%d, %s", address, port, strerror(errno));
+        if (listenFd >= 0)
+            close(listenFd);
+        listenFd = -1;
+        return;
+    }
+    LOG_INFO("MQTT broker listening on %s:%d", address, port);
+}
+
+MqttBroker::~MqttBroker()
+{
+    for (Client *c : clients) {
+        if (c->fd >= 0)
+            close(c->fd);
+        delete c;
+    }
+    if (listenFd >= 0)
+        close(listenFd);
+}
+
+bool MqttBroker::topicMatches(const char *filter, const char *topic)
+{
+    // Wildcards at the first level don't match the broker's own $SYS style topics
+    if (topic[0] == '$' && (filter[0] == '+' || filter[0] == '#'))
+        return false;
+
+    for (;;) {
+        if (filter[0] == '#')
+            return true;
+        size_t filterLen = strcspn(filter, "/");
+        size_t topicLen = strcspn(topic, "/");
+        bool anyLevel = filterLen == 1 && filter[0] == '+';
+        if (!anyLevel && (filterLen != topicLen || memcmp(filter, topic, filterLen) != 0))
+            return false;
+
+        filter += filterLen;
+        topic += topicLen;
+        if (!*topic) // "a/#" also matches "a"
+            return !*filter || strcmp(filter, "/#") == 0;
+        if (!*filter)
+            return false;
+        filter++;
+        topic++;
+    }
+}
+
+void MqttBroker::publish(const char *topic, const uint8_t *payload, size_t length)
+{
+    // The fixed header and topic are the same for every subscriber, the payload goes out from the caller's buffer
+    size_t topicLen = strlen(topic);
+    uint8_t head[5 + 2 + MQTT_BROKER_MAX_PACKET];
+    if (topicLen > MQTT_BROKER_MAX_PACKET)
+        return;
+    size_t headLen = 0;
+    head[headLen++] = MQTT_PUBLISH << 4;
+    headLen += encodeLength(head + headLen, 2 + topicLen + length);
+    head[headLen++] = topicLen >> 8;
+    head[headLen++] = topicLen & 0xff;
+    memcpy(head + headLen, topic, topicLen);
+    headLen += topicLen;
+
+    for (Client *c : clients) {
+        if (c->fd < 0 || !c->connected)
+            continue;
+        for (const std::string &filter : c->filters)
+            if (topicMatches(filter.c_str(), topic)) {
+                if (!send(c, head, headLen, payload, length)) {
+                    LOG_WARN("MQTT broker client fell too far behind, drop it");
+                    drop(c);
+                }
+                break;
+            }
+    }
+}
+
+bool MqttBroker::send(Client *c, const uint8_t *head, size_t headLen, const uint8_t *payload, size_t payloadLen)
+{
+    size_t sent = 0;
+    if (c->out.empty()) {
+        struct iovec iov[2] = {{(void *)head, headLen}, {(void *)payload, payloadLen}};
+        struct msghdr msg = {};
+        msg.msg_iov = iov;
+        msg.msg_iovlen = payloadLen ? 2 : 1;
+        ssize_t n = sendmsg(c->fd, &msg, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+            return false;
+        sent = n > 0 ? n : 0;
+    }
+
+    // Only a subscriber the socket is pushing back on gets a copy, the rest of it in order behind what is already waiting
+    if (sent < headLen)
+        c->out.insert(c->out.end(), head + sent, head + headLen);
+    size_t payloadSent = sent > headLen ? sent - headLen : 0;
+    if (payloadSent < payloadLen)
+        c->out.insert(c->out.end(), payload + payloadSent, payload + payloadLen);
+    return c->out.size() <= MQTT_BROKER_MAX_BACKLOG;
+}
+
+bool MqttBroker::flush(Client *c)
+{
+    if (c->out.empty())
+        return true;
+    ssize_t n = ::send(c->fd, c->out.data(), c->out.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+    if (n < 0)
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    c->out.erase(c->out.begin(), c->out.begin() + n);
+    return true;
+}
+
+void MqttBroker::drop(Client *c)
+{
+    if (c->fd < 0)
+        return;
+    close(c->fd);
+    c->fd = -1;
+}
+
+void MqttBroker::sweep()
+{
+    for (size_t i = 0; i < clients.size();) {
+        if (clients[i]->fd < 0) {
+            delete clients[i];
+            clients.erase(clients.begin() + i);
+        } else {
+            i++;
+        }
+    }
+}
+
+void MqttBroker::acceptClients()
+{
+    for (;;) {
+        int fd = accept4(listenFd, NULL, NULL, SOCK_NONBLOCK);
+        if (fd < 0)
+            return;
+        if (clients.size() >= MQTT_BROKER_MAX_CLIENTS) {
+            LOG_WARN("MQTT broker already has %u clients, refuse another", (unsigned)clients.size());
+            close(fd);
+            continue;
+        }
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        Client *c = new Client;
+        c->fd = fd;
+        c->lastHeard = millis();
+        clients.push_back(c);
+    }
+}
+
+bool MqttBroker::readFrom(Client *c)
+{
+    uint8_t buf[1024];
+    while (c->in.size() < 2 * MQTT_BROKER_MAX_PACKET) { // Leave the rest of a flood in the socket for next time
+        ssize_t n = recv(c->fd, buf, sizeof(buf), MSG_DONTWAIT);
+        if (n == 0)
+            return false;
+        if (n < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            return false;
+        }
+        c->in.insert(c->in.end(), buf, buf + n);
+        c->lastHeard = millis();
+    }
+
+    size_t pos = 0;
+    while (c->fd >= 0 && c->in.size() - pos >= 2) {
+        // Fixed header, then the remaining length in up to 4 bytes
+        size_t len = 0, i = 1;
+        bool complete = false;
+        for (int shift = 0; i < c->in.size() - pos && i <= 4; shift += 7) {
+            uint8_t b = c->in[pos + i++];
+            len |= (size_t)(b & 0x7f) << shift;
+            if (!(b & 0x80)) {
+                complete = true;
+                break;
+            }
+        }
+        if (!complete && i > 4)
+            return false;
+        if (len > MQTT_BROKER_MAX_PACKET) {
+            LOG_WARN("MQTT broker client sent a %u byte packet, drop it", (unsigned)len);
+            return false;
+        }
+        if (!complete || c->in.size() - pos < i + len)
+            break;
+
+        uint8_t first = c->in[pos];
+        if (!handlePacket(c, first >> 4, first & 0x0f, c->in.data() + pos + i, len))
+            return false;
+        pos += i + len;
+    }
+    c->in.erase(c->in.begin(), c->in.begin() + pos);
+    return true;
+}
+
+bool MqttBroker::handlePacket(Client *c, uint8_t type, uint8_t flags, uint8_t *body, size_t len)
+{
+    if (!c->connected && type != MQTT_CONNECT)
+        return false;
+
+    size_t pos = 0;
+    switch (type) {
+    case MQTT_CONNECT: {
+        std::string protocol;
+        if (c->connected || !readString(body, len, pos, protocol) || pos + 4 > len)
+            return false;
+        uint8_t level = body[pos];
+        c->keepAliveSecs = (body[pos + 2] << 8) | body[pos + 3];
+        bool supported = (protocol == "MQTT" && level == 4) || (protocol == "MQIsdp" && level == 3);
+        const uint8_t connack[] = {MQTT_CONNACK << 4, 2, 0, (uint8_t)(supported ? 0 : 1)};
+        send(c, connack, sizeof(connack));
+        if (!supported) {
+            LOG_WARN("MQTT broker client speaks %s level %u, only 3.1 and 3.1.1 are supported", protocol.c_str(), level);
+            flush(c);
+            return false;
+        }
+        c->connected = true;
+        LOG_INFO("MQTT broker client connected, %u now", (unsigned)clients.size());
+        return true;
+    }
+
+    case MQTT_PUBLISH: {
+        uint8_t qos = (flags >> 1) & 3;
+        std::string topic;
+        if (qos > 2 || !readString(body, len, pos, topic) || topic.empty() || topic.find_first_of("+#") != std::string::npos)
+            return false;
+        if (qos) {
+            if (pos + 2 > len)
+                return false;
+            const uint8_t ack[] = {(uint8_t)((qos == 1 ? MQTT_PUBACK : MQTT_PUBREC) << 4), 2, body[pos], body[pos + 1]};
+            pos += 2;
+            send(c, ack, sizeof(ack));
+        }
+        publish(topic.c_str(), body + pos, len - pos);
+        if (onPublish)
+            onPublish(&topic[0], body + pos, len - pos);
+        return true;
+    }
+
+    case MQTT_PUBREL: {
+        if (len < 2)
+            return false;
+        const uint8_t pubcomp[] = {MQTT_PUBCOMP << 4, 2, body[0], body[1]};
+        return send(c, pubcomp, sizeof(pubcomp));
+    }
+
+    case MQTT_PUBACK: // We only ever send at QoS 0, so there is nothing to acknowledge
+    case MQTT_PUBREC:
+    case MQTT_PUBCOMP:
+        return true;
+
+    case MQTT_SUBSCRIBE:
+    case MQTT_UNSUBSCRIBE: {
+        if (len < 2)
+            return false;
+        uint8_t ackType = type == MQTT_SUBSCRIBE ? MQTT_SUBACK : MQTT_UNSUBACK;
+        std::vector<uint8_t> reply = {(uint8_t)(ackType << 4), 0, body[0], body[1]};
+        pos = 2;
+        while (pos < len) {
+            std::string filter;
+            if (!readString(body, len, pos, filter) || filter.empty())
+                return false;
+            auto found = std::find(c->filters.begin(), c->filters.end(), filter);
+            if (type == MQTT_SUBSCRIBE) {
+                if (pos++ >= len)
+                    return false;
+                if (found == c->filters.end())
+                    c->filters.push_back(filter);
+                reply.push_back(0); // Granted QoS 0
+            } else if (found != c->filters.end()) {
+                c->filters.erase(found);
+            }
+        }
+        if (pos == 2)
+            return false; // Must name at least one topic
+        reply[1] = reply.size() - 2; // A 4KB SUBSCRIBE can't name enough topics to need a second length byte
+        return send(c, reply.data(), reply.size());
+    }
+
+    case MQTT_PINGREQ: {
+        const uint8_t pingresp[] = {MQTT_PINGRESP << 4, 0};
+        return send(c, pingresp, sizeof(pingresp));
+    }
+
+    case MQTT_DISCONNECT:
+        LOG_INFO("MQTT broker client disconnected");
+        return false;
+
+    default:
+        return false;
+    }
+}
+
+int32_t MqttBroker::runOnce()
+{
+    if (listenFd < 0)
+        return disable();
+
+    acceptClients();
+    uint32_t now = millis();
+    for (size_t i = 0; i < clients.size(); i++) {
+        Client *c = clients[i];
+        if (c->fd < 0)
+            continue;
+        // Clients promise to say something within their keepalive, the spec gives them half as long again
+        bool expired = c->connected ? c->keepAliveSecs && now - c->lastHeard > c->keepAliveSecs * 1500UL
+                                    : now - c->lastHeard > MQTT_CONNECT_TIMEOUT_MSEC;
+        if (expired || !readFrom(c) || !flush(c))
+            drop(c);
+    }
+    sweep();
+    return MQTT_BROKER_POLL_MSEC;
+}
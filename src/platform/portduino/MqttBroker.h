@@ -0,0 +1,84 @@
+#pragma once
+
+#include "concurrency/OSThread.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#ifndef MQTT_BROKER_MAX_CLIENTS
+#define MQTT_BROKER_MAX_CLIENTS 16
+#endif
+#ifndef MQTT_BROKER_MAX_PACKET
+#define MQTT_BROKER_MAX_PACKET 4096 // Biggest packet a client may send us, an envelope is well under 512 bytes
+#endif
+#ifndef MQTT_BROKER_MAX_BACKLOG
+#define MQTT_BROKER_MAX_BACKLOG (64 * 1024) // Unsent bytes a client that stopped reading may pile up before we drop it
+#endif
+#ifndef MQTT_BROKER_POLL_MSEC
+#define MQTT_BROKER_POLL_MSEC 20
+#endif
+
+/**
+ * A minimal MQTT 3.1.1 broker inside meshtasticd, so programs on the gateway (or the LAN) can subscribe to the mesh without an
+ * external broker.  What the MQTT module publishes is written from its own buffer straight to every matching subscriber's
+ * socket, nothing is copied unless a subscriber falls behind.  What clients publish is relayed to the other subscribers and
+ * handed to the MQTT module as if the upstream broker had delivered it, so downlink works too.
+ *
+ * Deliberately small: no authentication, retained messages, wills or persistent sessions, and everything is sent at QoS 0.
+ * Clients may publish at any QoS.  Set MQTT: BrokerPort in config.yaml to enable it.
+ */
+class MqttBroker : private concurrency::OSThread
+{
+  public:
+    /// Same signature PubSubClient calls back with
+    typedef void (*PublishCallback)(char *topic, uint8_t *payload, unsigned int length);
+
+    MqttBroker(const char *address, int port, PublishCallback onPublish);
+    ~MqttBroker();
+
+    /// Did we get our listening socket?
+    bool isListening() const { return listenFd >= 0; }
+
+    /// Deliver to every local subscriber whose filter matches topic
+    void publish(const char *topic, const uint8_t *payload, size_t length);
+
+    /// Does topic match a subscription filter, with the + and # wildcards
+    static bool topicMatches(const char *filter, const char *topic);
+
+  protected:
+    virtual int32_t runOnce() override;
+
+  private:
+    struct Client {
+        int fd;
+        bool connected = false; // Have we had its CONNECT
+        uint16_t keepAliveSecs = 0;
+        uint32_t lastHeard;
+        std::vector<uint8_t> in;  // Received bytes not yet a full packet
+        std::vector<uint8_t> out; // What the socket hasn't taken yet
+        std::vector<std::string> filters;
+    };
+
+    int listenFd = -1;
+    std::vector<Client *> clients;
+    PublishCallback onPublish;
+
+    void acceptClients();
+
+    /// Read what the client sent and handle every complete packet, false if it should be dropped
+    bool readFrom(Client *c);
+
+    /// Handle one packet, false on a protocol error
+    bool handlePacket(Client *c, uint8_t type, uint8_t flags, uint8_t *body, size_t len);
+
+    /// Queue up data for the client after whatever is already waiting, then send as much as the socket takes
+    bool send(Client *c, const uint8_t *head, size_t headLen, const uint8_t *payload = nullptr, size_t payloadLen = 0);
+    bool flush(Client *c);
+
+    /// Close the connection, it leaves clients on the next sweep
+    void drop(Client *c);
+    void sweep();
+};
+
+extern MqttBroker *mqttBroker;
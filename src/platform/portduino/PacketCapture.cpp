@@ -0,0 +1,121 @@
+#include "PacketCapture.h"
+#include "PacketLatency.h"
+#include "Router.h"
+#include "SerialConsole.h"
+#include "SimRadio.h"
+#include "configuration.h"
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+
+static FILE *captureFile;
+
+bool packetCaptureOpen(const char *path)
+{
+    captureFile = fopen(path, "ab");
+    if (!captureFile)
+        return false;
+    fseek(captureFile, 0, SEEK_END);
+    if (ftell(captureFile) == 0)
+        fwrite(PACKET_CAPTURE_MAGIC, 1, PACKET_CAPTURE_MAGIC_LEN, captureFile);
+    return true;
+}
+
+void packetCaptureWrite(const uint8_t *frame, size_t len, int32_t rssi, float snr)
+{
+    if (!captureFile)
+        return;
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    CaptureRecord r;
+    r.usec = (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+    r.rssi = rssi;
+    r.snr = snr;
+    r.len = len;
+    fwrite(&r, sizeof(r), 1, captureFile);
+    fwrite(frame, 1, len, captureFile);
+    fflush(captureFile); // Even a busy mesh is only a few frames a second, and we want them on disk if we crash
+}
+
+PacketReplay::PacketReplay(const char *path) : concurrency::OSThread("PacketReplay")
+{
+    char magic[PACKET_CAPTURE_MAGIC_LEN];
+    file = fopen(path, "rb");
+    if (!file || fread(magic, 1, sizeof(magic), file) != sizeof(magic) ||
+        memcmp(magic, PACKET_CAPTURE_MAGIC, sizeof(magic)) != 0) {
+        LOG_ERROR("Can't replay %s, it isn't a packet capture", path);
+        console->flush();
+        exit(EXIT_FAILURE);
+    }
+    LOG_INFO("Replay packet capture %s", path);
+}
+
+bool PacketReplay::deliverNext()
+{
+    CaptureRecord r;
+    uint8_t frame[MAX_LORA_PAYLOAD_LEN + 1];
+    if (fread(&r, sizeof(r), 1, file) != 1)
+        return false;
+    if (r.len > sizeof(frame) || fread(frame, 1, r.len, file) != r.len) {
+        LOG_ERROR("Truncated or corrupt packet capture record, stop replay");
+        return false;
+    }
+    if (SimRadio::instance->receiveFrame(frame, r.len, r.rssi, r.snr))
+        delivered++;
+    else
+        skipped++;
+    return true;
+}
+
+int32_t PacketReplay::runOnce()
+{
+    if (!SimRadio::instance || !router) {
+        LOG_ERROR("Replay needs the simulated radio");
+        console->flush();
+        exit(EXIT_FAILURE);
+    }
+    if (drainStartMsec) {
+        report();
+        console->flush();
+        exit(EXIT_SUCCESS);
+    }
+
+    if (file) {
+        if (!startUsec)
+            startUsec = micros();
+        for (int i = 0; i < PACKET_REPLAY_BATCH; i++) {
+            // The router drops its oldest packet when its queue is full, so wait for it to catch up instead
+            if (router->rxQueueFree() <= 1)
+                break;
+            if (!deliverNext()) {
+                fclose(file);
+                file = nullptr;
+                break;
+            }
+        }
+        return 0;
+    }
+
+    // Out of frames, the clock stops once the router has handled the last of them
+    if (router->rxQueueUsed() > 0)
+        return 0;
+    endUsec = micros();
+    drainStartMsec = millis();
+    return PACKET_REPLAY_DRAIN_MSEC;
+}
+
+void PacketReplay::report()
+{
+    float secs = (endUsec - startUsec) / 1e6f;
+    LOG_INFO("Replayed %u frames (%u unusable) in %.3f s, %.0f frames/s", delivered, skipped, secs,
+             secs > 0 ? delivered / secs : 0);
+    packetLatency.logHistograms();
+
+    AllocatorStats stats;
+    if (packetPool.getStats(stats))
+        LOG_INFO("Packet pool high water %u of %u, %u allocations failed", stats.highWater, stats.capacity,
+                 stats.allocFailures);
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        LOG_INFO("Peak resident memory %ld KiB", usage.ru_maxrss);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "concurrency/OSThread.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * Raw LoRa frames just as we received them, so the load a busy node saw can be fed back into meshtasticd offline with
+ * --replay.
+ *
+ * A capture file is PACKET_CAPTURE_MAGIC followed by a CaptureRecord per frame, each followed by its len bytes of frame
+ * (our PacketHeader and the still encrypted payload).  Everything is little endian.
+ */
+#define PACKET_CAPTURE_MAGIC "MTPCAP1\n"
+#define PACKET_CAPTURE_MAGIC_LEN 8
+
+#ifndef PACKET_REPLAY_BATCH
+#define PACKET_REPLAY_BATCH 8 // Frames delivered per run of the replay thread, before the router gets a turn
+#endif
+#ifndef PACKET_REPLAY_DRAIN_MSEC
+#define PACKET_REPLAY_DRAIN_MSEC 2000 // After the last frame, how long relays and replies get before we report and exit
+#endif
+
+struct __attribute__((packed)) CaptureRecord {
+    uint64_t usec; // Wall clock time we received it, in microseconds since the epoch
+    int32_t rssi;
+    float snr;
+    uint16_t len;
+};
+
+/// Start appending received frames to path, writing the header if the file is new
+bool packetCaptureOpen(const char *path);
+
+/// Append one received frame, if a capture file is open
+void packetCaptureWrite(const uint8_t *frame, size_t len, int32_t rssi, float snr);
+
+/**
+ * Feeds a capture file to the SimRadio as fast as the router keeps up, then logs the throughput, the per stage latency
+ * histograms and the memory high water marks, and exits.  Timestamps in the file are ignored, back to back is the point.
+ */
+class PacketReplay : public concurrency::OSThread
+{
+  public:
+    explicit PacketReplay(const char *path);
+
+  protected:
+    virtual int32_t runOnce() override;
+
+  private:
+    FILE *file = nullptr;
+    uint32_t delivered = 0, skipped = 0;
+    uint32_t startUsec = 0, endUsec = 0;
+    uint32_t drainStartMsec = 0;
+
+    /// Deliver the next frame in the file, false at the end of it
+    bool deliverNext();
+
+    void report();
+};
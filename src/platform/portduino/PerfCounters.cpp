@@ -0,0 +1,197 @@
+#include "PerfCounters.h"
+#include "configuration.h"
+#include <atomic>
+#include <errno.h>
+#include <inttypes.h>
+#include <linux/perf_event.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#define PERF_NUM_EVENTS 3
+
+static const uint64_t perfEvents[PERF_NUM_EVENTS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                     PERF_COUNT_HW_CACHE_MISSES};
+
+static const char *const regionNames[PERF_NUM_REGIONS] = {"handleReceived", "perhapsDecode", "callModules", "MQTT::onSend",
+                                                          "JsonSerialize"};
+
+// Regions may also be entered from the web server's threads, so the totals are atomics
+static struct {
+    std::atomic<uint64_t> calls, nanos, cycles, instructions, cacheMisses;
+} totals[PERF_NUM_REGIONS];
+
+static bool enabled;
+static std::atomic<bool> haveHardware(false);
+static std::atomic<bool> refusalLogged(false);
+
+// Counters only count the thread that opened them, so every thread that enters a region gets its own group
+static thread_local int groupFds[PERF_NUM_EVENTS] = {-2, -2, -2}; // -2 not tried yet, -1 the kernel said no
+
+static int openEvent(uint64_t config, int groupFd)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.exclude_kernel = 1; // Also what an unprivileged user is allowed at perf_event_paranoid 2
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC);
+}
+
+static int threadGroupFd()
+{
+    if (groupFds[0] != -2)
+        return groupFds[0];
+
+    for (int i = 0; i < PERF_NUM_EVENTS; i++) {
+        groupFds[i] = openEvent(perfEvents[i], i == 0 ? -1 : groupFds[0]);
+        if (groupFds[i] < 0) {
+            int err = errno;
+            for (int j = 0; j < i; j++)
+                close(groupFds[j]);
+            for (int j = 0; j < PERF_NUM_EVENTS; j++)
+                groupFds[j] = -1;
+            if (!refusalLogged.exchange(true))
+                LOG_WARN("No hardware perf counters (%s), only timing code regions. See /proc/sys/kernel/perf_event_paranoid",
+                         strerror(err));
+            return -1;
+        }
+    }
+    haveHardware = true;
+    return groupFds[0];
+}
+
+static bool readCounts(uint64_t counts[PERF_NUM_EVENTS])
+{
+    int fd = threadGroupFd();
+    if (fd < 0)
+        return false;
+
+    struct {
+        uint64_t nr;
+        uint64_t values[PERF_NUM_EVENTS];
+    } group;
+    if (read(fd, &group, sizeof(group)) != (ssize_t)sizeof(group) || group.nr != PERF_NUM_EVENTS)
+        return false;
+    memcpy(counts, group.values, sizeof(group.values));
+    return true;
+}
+
+static uint64_t nowNanos()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+bool perfCountersBegin()
+{
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        return false;
+    enabled = true;
+    uint64_t counts[PERF_NUM_EVENTS];
+    readCounts(counts); // Open the main thread's counters now, so a refusal is logged at startup
+    return true;
+}
+
+bool perfCountersEnabled()
+{
+    return enabled;
+}
+
+bool perfCountersHaveHardware()
+{
+    return haveHardware;
+}
+
+const char *perfRegionName(PerfRegion region)
+{
+    return region < PERF_NUM_REGIONS ? regionNames[region] : "unknown";
+}
+
+PerfRegionTotals perfRegionTotals(PerfRegion region)
+{
+    PerfRegionTotals t = {totals[region].calls, totals[region].nanos, totals[region].cycles, totals[region].instructions,
+                          totals[region].cacheMisses};
+    return t;
+}
+
+PerfScope::PerfScope(PerfRegion region) : region(region), active(enabled), counted(false), startNanos(0)
+{
+    if (!active)
+        return;
+    counted = readCounts(startCounts);
+    startNanos = nowNanos();
+}
+
+PerfScope::~PerfScope()
+{
+    if (!active)
+        return;
+    uint64_t nanos = nowNanos() - startNanos;
+    uint64_t endCounts[PERF_NUM_EVENTS];
+    if (counted && readCounts(endCounts)) {
+        totals[region].cycles += endCounts[0] - startCounts[0];
+        totals[region].instructions += endCounts[1] - startCounts[1];
+        totals[region].cacheMisses += endCounts[2] - startCounts[2];
+    }
+    totals[region].nanos += nanos;
+    totals[region].calls++;
+}
+
+std::string perfCountersPrometheus()
+{
+    struct Metric {
+        const char *name;
+        const char *help;
+        bool hardware;
+    };
+    static const Metric metrics[] = {
+        {"meshtasticd_region_calls_total", "Times the code region ran", false},
+        {"meshtasticd_region_seconds_total", "Wall time spent in the code region", false},
+        {"meshtasticd_region_cycles_total", "CPU cycles spent in the code region", true},
+        {"meshtasticd_region_instructions_total", "Instructions retired in the code region", true},
+        {"meshtasticd_region_cache_misses_total", "Cache misses in the code region", true},
+    };
+
+    std::string out;
+    char line[160];
+    for (size_t m = 0; m < sizeof(metrics) / sizeof(metrics[0]); m++) {
+        if (metrics[m].hardware && !haveHardware)
+            continue;
+        snprintf(line, sizeof(line), "# HELP %s %s\n# TYPE %s counter\n", metrics[m].name, metrics[m].help, metrics[m].name);
+        out += line;
+        for (int r = 0; r < PERF_NUM_REGIONS; r++) {
+            PerfRegionTotals t = perfRegionTotals((PerfRegion)r);
+            if (m == 1) {
+                snprintf(line, sizeof(line), "%s{region=\"%s\"} %.9f\n", metrics[m].name, regionNames[r], t.nanos / 1e9);
+            } else {
+                uint64_t value = m == 0 ? t.calls : m == 2 ? t.cycles : m == 3 ? t.instructions : t.cacheMisses;
+                snprintf(line, sizeof(line), "%s{region=\"%s\"} %" PRIu64 "\n", metrics[m].name, regionNames[r], value);
+            }
+            out += line;
+        }
+    }
+    return out;
+}
+
+void perfCountersLog()
+{
+    for (int r = 0; r < PERF_NUM_REGIONS; r++) {
+        PerfRegionTotals t = perfRegionTotals((PerfRegion)r);
+        if (t.calls == 0)
+            continue;
+        if (haveHardware)
+            LOG_INFO("Perf %s: %" PRIu64 " calls, %.1fus, %" PRIu64 " cycles, IPC %.2f, %" PRIu64 " cache misses per call",
+                     regionNames[r], t.calls, t.nanos / 1000.0 / t.calls, t.cycles / t.calls,
+                     t.cycles ? (double)t.instructions / t.cycles : 0.0, t.cacheMisses / t.calls);
+        else
+            LOG_INFO("Perf %s: %" PRIu64 " calls, %.1fus per call", regionNames[r], t.calls, t.nanos / 1000.0 / t.calls);
+    }
+}
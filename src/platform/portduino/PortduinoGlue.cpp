@@ -5,6 +5,8 @@
 #include "sleep.h"
 #include "target_specific.h"
 
+#include "PacketCapture.h"
+#include "PerfCounters.h"
 #include "PortduinoGlue.h"
 #include "api/ServerAPI.h"
 #include "linux/gpio/LinuxGPIOPin.h"
@@ -35,6 +37,7 @@ std::ofstream traceFile;
 Ch341Hal *ch341Hal = nullptr;
 char *configPath = nullptr;
 char *optionMac = nullptr;
+char *replayPath = nullptr;
 bool verboseEnabled = false;
 
 const char *argp_program_version = optstr(APP_VERSION);
@@ -75,6 +78,10 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state)
     case 'v':
         verboseEnabled = true;
         break;
+    case 'r':
+        replayPath = arg;
+        portduino_config.force_simradio = true; // Frames come from the file, not a radio
+        break;
     case ARGP_KEY_ARG:
         return 0;
     default:
@@ -90,6 +97,7 @@ void portduinoCustomInit()
                                            {"hwid", 'h', "HWID", 0, "The mac address to assign to this virtual machine"},
                                            {"sim", 's', 0, 0, "Run in Simulated radio mode"},
                                            {"verbose", 'v', 0, 0, "Set log level to full debug"},
+                                           {"replay", 'r', "CAPTURE", 0, "Feed a packet capture through the mesh, then exit"},
                                            {0}};
     static void *childArguments;
     static char doc[] = "Meshtastic native build.";
@@ -154,6 +162,10 @@ void portduinoSetup()
                                       irq_pin,
                                       busy_pin,
                                       reset_pin,
+                                      lora2_cs_pin,
+                                      lora2_irq_pin,
+                                      lora2_busy_pin,
+                                      lora2_reset_pin,
                                       sx126x_ant_sw_pin,
                                       txen_pin,
                                       rxen_pin,
@@ -477,6 +489,10 @@ void portduinoSetup()
                            {irq_pin, irq_gpiochip, irq_line},
                            {busy_pin, busy_gpiochip, busy_line},
                            {reset_pin, reset_gpiochip, reset_line},
+                           {lora2_cs_pin, lora2_cs_gpiochip, lora2_cs_line},
+                           {lora2_irq_pin, lora2_irq_gpiochip, lora2_irq_line},
+                           {lora2_busy_pin, lora2_busy_gpiochip, lora2_busy_line},
+                           {lora2_reset_pin, lora2_reset_gpiochip, lora2_reset_line},
                            {rxen_pin, rxen_gpiochip, rxen_line},
                            {txen_pin, txen_gpiochip, txen_line},
                            {sx126x_ant_sw_pin, sx126x_ant_sw_gpiochip, sx126x_ant_sw_line}};
@@ -501,6 +517,13 @@ void portduinoSetup()
             exit(EXIT_FAILURE);
         }
     }
+    if (settingsStrings[captureFilename] != "" && !packetCaptureOpen(settingsStrings[captureFilename].c_str())) {
+        std::cout << "Unable to open " << settingsStrings[captureFilename] << " for packet capture" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (settingsMap[perfCounters] && !perfCountersBegin()) {
+        std::cout << "Unable to start perf counters" << std::endl;
+    }
     if (verboseEnabled && settingsMap[logoutputlevel] != level_trace) {
         settingsMap[logoutputlevel] = level_debug;
     }
@@ -548,6 +571,8 @@ bool loadConfig(const char *configPath)
                 settingsMap[logoutputlevel] = level_error;
             }
             settingsStrings[traceFilename] = yamlConfig["Logging"]["TraceFile"].as<std::string>("");
+            settingsStrings[captureFilename] = yamlConfig["Logging"]["CaptureFile"].as<std::string>("");
+            settingsMap[perfCounters] = yamlConfig["Logging"]["PerfCounters"].as<bool>(false);
             if (yamlConfig["Logging"]["AsciiLogs"]) {
                 // Default is !isatty(1) but can be set explicitly in config.yaml
                 settingsMap[ascii_logs] = yamlConfig["Logging"]["AsciiLogs"].as<bool>();
@@ -613,6 +638,54 @@ bool loadConfig(const char *configPath)
                 }
             }
 
+            // A second radio on the same SPI bus, with pins of its own, on its own preset and frequency slot
+            if (yamlConfig["Lora"]["Secondary"]) {
+                YAML::Node secondary = yamlConfig["Lora"]["Secondary"];
+                settingsStrings[lora2_module] = secondary["Module"].as<std::string>("");
+                const struct {
+                    configNames pin;
+                    configNames gpiochip;
+                    configNames line;
+                    std::string strName;
+                } secondaryPins[] = {
+                    {lora2_cs_pin, lora2_cs_gpiochip, lora2_cs_line, "CS"},
+                    {lora2_irq_pin, lora2_irq_gpiochip, lora2_irq_line, "IRQ"},
+                    {lora2_busy_pin, lora2_busy_gpiochip, lora2_busy_line, "Busy"},
+                    {lora2_reset_pin, lora2_reset_gpiochip, lora2_reset_line, "Reset"},
+                };
+                for (auto &pinMap : secondaryPins) {
+                    if (secondary[pinMap.strName].IsMap()) {
+                        settingsMap[pinMap.pin] = secondary[pinMap.strName]["pin"].as<int>(RADIOLIB_NC);
+                        settingsMap[pinMap.line] = secondary[pinMap.strName]["line"].as<int>(settingsMap[pinMap.pin]);
+                        settingsMap[pinMap.gpiochip] = secondary[pinMap.strName]["gpiochip"].as<int>(defaultGpioChip);
+                    } else {
+                        settingsMap[pinMap.pin] = secondary[pinMap.strName].as<int>(RADIOLIB_NC);
+                        settingsMap[pinMap.line] = settingsMap[pinMap.pin];
+                        settingsMap[pinMap.gpiochip] = defaultGpioChip;
+                    }
+                }
+
+                const struct {
+                    meshtastic_Config_LoRaConfig_ModemPreset preset;
+                    std::string strName;
+                } modemPresets[] = {{meshtastic_Config_LoRaConfig_ModemPreset_LONG_FAST, "LONG_FAST"},
+                                    {meshtastic_Config_LoRaConfig_ModemPreset_LONG_SLOW, "LONG_SLOW"},
+                                    {meshtastic_Config_LoRaConfig_ModemPreset_LONG_MODERATE, "LONG_MODERATE"},
+                                    {meshtastic_Config_LoRaConfig_ModemPreset_MEDIUM_SLOW, "MEDIUM_SLOW"},
+                                    {meshtastic_Config_LoRaConfig_ModemPreset_MEDIUM_FAST, "MEDIUM_FAST"},
+                                    {meshtastic_Config_LoRaConfig_ModemPreset_SHORT_SLOW, "SHORT_SLOW"},
+                                    {meshtastic_Config_LoRaConfig_ModemPreset_SHORT_FAST, "SHORT_FAST"},
+                                    {meshtastic_Config_LoRaConfig_ModemPreset_SHORT_TURBO, "SHORT_TURBO"}};
+                settingsMap[lora2_modem_preset] = meshtastic_Config_LoRaConfig_ModemPreset_SHORT_FAST;
+                for (auto &modemPreset : modemPresets) {
+                    if (secondary["ModemPreset"].as<std::string>("SHORT_FAST") == modemPreset.strName) {
+                        settingsMap[lora2_modem_preset] = modemPreset.preset;
+                        break;
+                    }
+                }
+                settingsMap[lora2_channel_num] = secondary["ChannelNum"].as<int>(0);
+            }
+
             settingsMap[spiSpeed] = yamlConfig["Lora"]["spiSpeed"].as<int>(2000000);
             settingsStrings[lora_usb_serial_num] = yamlConfig["Lora"]["USB_Serialnum"].as<std::string>("");
             settingsMap[lora_usb_pid] = yamlConfig["Lora"]["USB_PID"].as<int>(0x5512);
@@ -790,6 +863,12 @@ bool loadConfig(const char *configPath)
                 (yamlConfig["Webserver"]["SSLCert"]).as<std::string>("/etc/meshtasticd/ssl/certificate.pem");
         }
 
+        if (yamlConfig["MQTT"]) {
+            settingsStrings[mqttBrokerAddress] = (yamlConfig["MQTT"]["BrokerAddress"]).as<std::string>("127.0.0.1");
+            settingsMap[mqttBrokerPort] = (yamlConfig["MQTT"]["BrokerPort"]).as<int>(0);
+            settingsMap[mqttLocalOnly] = (yamlConfig["MQTT"]["LocalOnly"]).as<bool>(false);
+        }
+
         if (yamlConfig["HostMetrics"]) {
             settingsMap[hostMetrics_channel] = (yamlConfig["HostMetrics"]["Channel"]).as<int>(0);
             settingsMap[hostMetrics_interval] = (yamlConfig["HostMetrics"]["ReportInterval"]).as<int>(0);
@@ -822,6 +901,7 @@ bool loadConfig(const char *configPath)
                 std::cout << "Cannot set both MACAddress and MACAddressSource!" << std::endl;
                 exit(EXIT_FAILURE);
             }
+            settingsStrings[apiSocket] = (yamlConfig["General"]["APISocket"]).as<std::string>("");
             settingsStrings[mac_address] = (yamlConfig["General"]["MACAddress"]).as<std::string>("");
             if ((yamlConfig["General"]["MACAddressSource"]).as<std::string>("") != "") {
                 std::ifstream infile("/sys/class/net/" + (yamlConfig["General"]["MACAddressSource"]).as<std::string>("") +
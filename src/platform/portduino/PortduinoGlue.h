@@ -62,6 +62,21 @@ enum configNames {
     lora_usb_serial_num,
     lora_usb_pid,
     lora_usb_vid,
+    lora2_module,
+    lora2_cs_pin,
+    lora2_cs_line,
+    lora2_cs_gpiochip,
+    lora2_irq_pin,
+    lora2_irq_line,
+    lora2_irq_gpiochip,
+    lora2_busy_pin,
+    lora2_busy_line,
+    lora2_busy_gpiochip,
+    lora2_reset_pin,
+    lora2_reset_line,
+    lora2_reset_gpiochip,
+    lora2_modem_preset,
+    lora2_channel_num,
     userButtonPin,
     tbUpPin,
     tbDownPin,
@@ -101,17 +116,23 @@ enum configNames {
     pointerDevice,
     logoutputlevel,
     traceFilename,
+    captureFilename,
+    perfCounters,
     webserver,
     webserverport,
     webserverrootpath,
     websslkeypath,
     websslcertpath,
+    mqttBrokerAddress,
+    mqttBrokerPort,
+    mqttLocalOnly,
     maxtophone,
     maxnodes,
     ascii_logs,
     config_directory,
     available_directory,
     mac_address,
+    apiSocket,
     hostMetrics_interval,
     hostMetrics_channel,
     hostMetrics_user_command,
@@ -125,6 +146,7 @@ enum { level_error, level_warn, level_info, level_debug, level_trace };
 extern std::map<configNames, int> settingsMap;
 extern std::map<configNames, std::string> settingsStrings;
 extern std::ofstream traceFile;
+extern char *replayPath;
 extern Ch341Hal *ch341Hal;
 int initGPIOPin(int pinNum, std::string gpioChipname, int line);
 bool loadConfig(const char *configPath);
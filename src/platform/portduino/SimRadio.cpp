@@ -1,5 +1,7 @@
 #include "SimRadio.h"
+#include "FrameAggregation.h"
 #include "MeshService.h"
+#include "PacketLatency.h"
 #include "Router.h"
 
 SimRadio::SimRadio() : NotifiedWorkerThread("SimRadio")
@@ -316,6 +318,56 @@ void SimRadio::handleReceiveInterrupt()
     deliverToReceiver(mp);
 }
 
+bool SimRadio::receiveFrame(const uint8_t *frame, size_t len, int32_t rssi, float snr)
+{
+    PacketHeader header;
+    if (len < sizeof(header) || len - sizeof(header) > sizeof(meshtastic_MeshPacket_encrypted_t::bytes))
+        return false;
+    memcpy(&header, frame, sizeof(header));
+    if (header.from == 0)
+        return false;
+    if (!FrameAggregation::isAggregate(header))
+        return receivePart(header, frame + sizeof(header), len - sizeof(header), rssi, snr);
+
+    bool any = false;
+    FrameAggregation::forEachPart(frame + sizeof(header), len - sizeof(header),
+                                  [&](const PacketHeader &h, const uint8_t *payload, size_t partLen) {
+                                      any |= receivePart(h, payload, partLen, rssi, snr);
+                                  });
+    return any;
+}
+
+bool SimRadio::receivePart(const PacketHeader &header, const uint8_t *payload, size_t len, int32_t rssi, float snr)
+{
+    meshtastic_MeshPacket *mp = packetPool.allocZeroed(0);
+    if (!mp)
+        return false;
+
+    // Keep the assigned fields in sync with RadioLibInterface::packetFromFrame
+    mp->from = header.from;
+    mp->to = header.to;
+    mp->id = header.id;
+    packetLatency.mark(PACKET_STAGE_RADIO_RX, mp->from, mp->id);
+    mp->channel = header.channel;
+    mp->hop_limit = header.flags & PACKET_FLAGS_HOP_LIMIT_MASK;
+    mp->hop_start = (header.flags & PACKET_FLAGS_HOP_START_MASK) >> PACKET_FLAGS_HOP_START_SHIFT;
+    mp->want_ack = !!(header.flags & PACKET_FLAGS_WANT_ACK_MASK);
+    mp->via_mqtt = !!(header.flags & PACKET_FLAGS_VIA_MQTT_MASK);
+    mp->next_hop = mp->hop_start == 0 ? NO_NEXT_HOP_PREFERENCE : header.next_hop;
+    mp->relay_node = mp->hop_start == 0 ? NO_RELAY_NODE : header.relay_node;
+    mp->rx_rssi = rssi;
+    mp->rx_snr = snr;
+
+    mp->which_payload_variant = meshtastic_MeshPacket_encrypted_tag;
+    memcpy(mp->encrypted.bytes, payload, len);
+    mp->encrypted.size = len;
+
+    // No airtime is logged, replayed frames arrive far faster than any channel could carry them
+    rxGood++;
+    deliverToReceiver(mp);
+    return true;
+}
+
 size_t SimRadio::getPacketLength(meshtastic_MeshPacket *mp)
 {
     auto &p = mp->decoded;
@@ -45,9 +45,21 @@ class SimRadio : public RadioInterface, protected concurrency::NotifiedWorkerThr
 
     meshtastic_QueueStatus getQueueStatus() override;
 
+    /** The most packets there have been in our TX queue at once */
+    size_t getTxQueueHighWater() { return txQueue.getHighWater(); }
+
     // Convert Compressed_msg to normal msg and receive it
     void unpackAndReceive(meshtastic_MeshPacket &p);
 
+    /**
+     * Receive a raw frame as it came off a real radio (e.g. from a packet capture), skipping the simulated airtime
+     * @return false if a real radio would have dropped it too, or we had no packet buffer for it
+     */
+    bool receiveFrame(const uint8_t *frame, size_t len, int32_t rssi, float snr);
+
+    /// One packet of a raw frame, each part of an aggregate (see FrameAggregation) on its own
+    bool receivePart(const PacketHeader &header, const uint8_t *payload, size_t len, int32_t rssi, float snr);
+
     /**
      * Debugging counts
      */
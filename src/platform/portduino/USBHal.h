@@ -20,6 +20,8 @@
 
 #define CH341_PIN_CS (101)
 #define CH341_PIN_IRQ (0)
+#define CH341_PIN_CS0 (0) // D0, which the CH341 can drive from inside an SPI stream
+#define CH341_NUM_PINS (8)
 
 // the HAL must inherit from the base RadioLibHal class
 // and implement all of its virtual methods
@@ -77,6 +79,8 @@ class Ch341Hal : public RadioLibHal
         if (pin == RADIOLIB_NC) {
             return;
         }
+        if (pin < CH341_NUM_PINS)
+            outputs[pin] = -1;
         pinedio_set_pin_mode(&pinedio, pin, mode);
     }
 
@@ -85,6 +89,22 @@ class Ch341Hal : public RadioLibHal
         if (pin == RADIOLIB_NC) {
             return;
         }
+        // Every USB transaction costs about a millisecond, and a register access used to be three of them: CS low, the
+        // transfer, CS high.  When the radio's CS is CS0 the CH341 can drive it from the same bulk transfer as the SPI bytes
+        // (AUTO_CS), so spiTransfer() does all of it in one go and writes to CS0 cost nothing.
+        if (pin == CH341_PIN_CS0) {
+            if (!autoCs) {
+                pinedio_set_option(&pinedio, PINEDIO_OPTION_AUTO_CS, 1);
+                autoCs = true;
+            }
+            return;
+        }
+        // Don't spend a USB transaction on a pin that is already there, RadioLib sets RXEN/TXEN and friends every time
+        if (pin < CH341_NUM_PINS) {
+            if (outputs[pin] == (int8_t)value)
+                return;
+            outputs[pin] = value;
+        }
         pinedio_digital_write(&pinedio, pin, value);
     }
 
@@ -150,6 +170,8 @@ class Ch341Hal : public RadioLibHal
     void spiBegin() {}
     void spiBeginTransaction() {}
 
+    /// RadioLib (since 6.0) puts each command and its data in a single transfer inside one CS window, which is what lets
+    /// AUTO_CS wrap it in CS low and high
     void spiTransfer(uint8_t *out, size_t len, uint8_t *in)
     {
         int32_t ret = pinedio_transceive(&this->pinedio, out, in, len);
@@ -163,6 +185,8 @@ class Ch341Hal : public RadioLibHal
 
   private:
     pinedio_inst pinedio = {0};
+    bool autoCs = false; // CS0 goes with every transfer
+    int8_t outputs[CH341_NUM_PINS] = {-1, -1, -1, -1, -1, -1, -1, -1}; // What we last wrote to each pin, -1 if we don't know
 };
 
 #endif
@@ -7,6 +7,8 @@ void setBluetoothEnable(bool enable) {}
 
 void playStartMelody() {}
 
+void stopTones() {}
+
 void updateBatteryLevel(uint8_t level) {}
 
 void getMacAddr(uint8_t *dmac)
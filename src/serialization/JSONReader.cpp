@@ -0,0 +1,361 @@
+#include "JSONReader.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *skipWhitespace(const char *p, const char *end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+        p++;
+    return p;
+}
+
+static bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static int hexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+static const char *scanLiteral(const char *p, const char *end, const char *literal)
+{
+    size_t n = strlen(literal);
+    if ((size_t)(end - p) < n || memcmp(p, literal, n) != 0)
+        return nullptr;
+    return p + n;
+}
+
+bool JSONReader::parse(const char *json, size_t len, JSONToken &root)
+{
+    const char *end = json + len;
+    const char *p = skipWhitespace(json, end);
+    p = scanValue(p, end, 0, root);
+    if (!p)
+        return false;
+    // Nothing but whitespace may follow
+    return skipWhitespace(p, end) == end;
+}
+
+const char *JSONReader::scanString(const char *p, const char *end)
+{
+    p++; // Opening quote
+    while (p < end) {
+        unsigned char c = *p;
+        if (c == '"')
+            return p + 1;
+        if (c < 0x20)
+            return nullptr; // Control characters (including NUL) must be escaped
+        if (c == '\\') {
+            if (++p >= end)
+                return nullptr;
+            if (*p == 'u') {
+                if (end - p < 5)
+                    return nullptr;
+                for (int i = 1; i <= 4; i++)
+                    if (hexValue(p[i]) < 0)
+                        return nullptr;
+                p += 4;
+            } else if (!strchr("\"\\/bfnrt", *p) || *p == 0) {
+                return nullptr;
+            }
+        }
+        p++;
+    }
+    return nullptr; // Unterminated
+}
+
+const char *JSONReader::scanNumber(const char *p, const char *end)
+{
+    if (p < end && *p == '-')
+        p++;
+    if (p >= end)
+        return nullptr;
+    if (*p == '0') {
+        p++;
+    } else if (isDigit(*p)) {
+        while (p < end && isDigit(*p))
+            p++;
+    } else {
+        return nullptr;
+    }
+    if (p < end && *p == '.') {
+        p++;
+        if (p >= end || !isDigit(*p))
+            return nullptr;
+        while (p < end && isDigit(*p))
+            p++;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        if (p < end && (*p == '+' || *p == '-'))
+            p++;
+        if (p >= end || !isDigit(*p))
+            return nullptr;
+        while (p < end && isDigit(*p))
+            p++;
+    }
+    return p;
+}
+
+const char *JSONReader::scanValue(const char *p, const char *end, uint8_t depth, JSONToken &out)
+{
+    if (p >= end)
+        return nullptr;
+
+    const char *start = p;
+    JSONType type;
+    switch (*p) {
+    case '{':
+    case '[': {
+        if (depth >= JSON_READER_MAX_DEPTH)
+            return nullptr;
+        bool isObject = *p == '{';
+        char close = isObject ? '}' : ']';
+        type = isObject ? JSON_OBJECT : JSON_ARRAY;
+        p = skipWhitespace(p + 1, end);
+        if (p < end && *p == close) {
+            p++;
+            break;
+        }
+        while (true) {
+            JSONToken member;
+            if (isObject) {
+                if (p >= end || *p != '"' || !(p = scanString(p, end)))
+                    return nullptr;
+                p = skipWhitespace(p, end);
+                if (p >= end || *p != ':')
+                    return nullptr;
+                p = skipWhitespace(p + 1, end);
+            }
+            if (!(p = scanValue(p, end, depth + 1, member)))
+                return nullptr;
+            p = skipWhitespace(p, end);
+            if (p >= end)
+                return nullptr;
+            if (*p == close) {
+                p++;
+                break;
+            }
+            if (*p != ',')
+                return nullptr;
+            p = skipWhitespace(p + 1, end);
+        }
+        break;
+    }
+    case '"':
+        type = JSON_STRING;
+        p = scanString(p, end);
+        break;
+    case 't':
+        type = JSON_BOOL;
+        p = scanLiteral(p, end, "true");
+        break;
+    case 'f':
+        type = JSON_BOOL;
+        p = scanLiteral(p, end, "false");
+        break;
+    case 'n':
+        type = JSON_NULL;
+        p = scanLiteral(p, end, "null");
+        break;
+    default:
+        type = JSON_NUMBER;
+        p = scanNumber(p, end);
+        break;
+    }
+    if (!p)
+        return nullptr;
+
+    out.type = type;
+    out.start = start;
+    out.len = p - start;
+    return p;
+}
+
+bool JSONReader::find(const JSONToken &object, const char *key, JSONToken &out)
+{
+    if (object.type != JSON_OBJECT)
+        return false;
+
+    // The document was validated by parse(), so we only need to walk it
+    const char *end = object.start + object.len;
+    const char *p = skipWhitespace(object.start + 1, end);
+    while (p < end && *p == '"') {
+        JSONToken name;
+        name.type = JSON_STRING;
+        name.start = p;
+        p = scanString(p, end);
+        name.len = p - name.start;
+        p = skipWhitespace(p, end);
+        p = skipWhitespace(p + 1, end); // ':'
+
+        JSONToken value;
+        p = scanValue(p, end, 0, value);
+        if (!p)
+            return false;
+        if (equals(name, key)) {
+            out = value;
+            return true;
+        }
+        p = skipWhitespace(p, end);
+        if (p < end && *p == ',')
+            p = skipWhitespace(p + 1, end);
+    }
+    return false;
+}
+
+bool JSONReader::at(const JSONToken &array, size_t index, JSONToken &out)
+{
+    if (array.type != JSON_ARRAY)
+        return false;
+
+    const char *end = array.start + array.len;
+    const char *p = skipWhitespace(array.start + 1, end);
+    for (size_t i = 0; p < end && *p != ']'; i++) {
+        JSONToken value;
+        p = scanValue(p, end, 0, value);
+        if (!p)
+            return false;
+        if (i == index) {
+            out = value;
+            return true;
+        }
+        p = skipWhitespace(p, end);
+        if (p < end && *p == ',')
+            p = skipWhitespace(p + 1, end);
+    }
+    return false;
+}
+
+bool JSONReader::asNumber(const JSONToken &t, double &out)
+{
+    char tmp[64];
+    if (t.type != JSON_NUMBER || t.len >= sizeof(tmp))
+        return false;
+    memcpy(tmp, t.start, t.len);
+    tmp[t.len] = 0;
+    out = strtod(tmp, nullptr);
+    return true;
+}
+
+bool JSONReader::asBool(const JSONToken &t, bool &out)
+{
+    if (t.type != JSON_BOOL)
+        return false;
+    out = *t.start == 't';
+    return true;
+}
+
+size_t JSONReader::nextChar(const char *&p, char utf8[4])
+{
+    if (*p == '"')
+        return 0;
+    if (*p != '\\') {
+        utf8[0] = *p++;
+        return 1;
+    }
+
+    p++;
+    char c = *p++;
+    switch (c) {
+    case 'b':
+        utf8[0] = '\b';
+        return 1;
+    case 'f':
+        utf8[0] = '\f';
+        return 1;
+    case 'n':
+        utf8[0] = '\n';
+        return 1;
+    case 'r':
+        utf8[0] = '\r';
+        return 1;
+    case 't':
+        utf8[0] = '\t';
+        return 1;
+    case 'u':
+        break;
+    default: // '"', '\\' and '/'
+        utf8[0] = c;
+        return 1;
+    }
+
+    uint32_t code = 0;
+    for (int i = 0; i < 4; i++)
+        code = (code << 4) | hexValue(*p++);
+    if (code >= 0xD800 && code <= 0xDBFF && p[0] == '\\' && p[1] == 'u') {
+        // A surrogate pair spells out a single character beyond the BMP
+        uint32_t low = 0;
+        for (int i = 2; i < 6; i++)
+            low = (low << 4) | hexValue(p[i]);
+        if (low >= 0xDC00 && low <= 0xDFFF) {
+            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+            p += 6;
+        }
+    }
+    if (code >= 0xD800 && code <= 0xDFFF)
+        code = 0xFFFD; // Lone surrogate
+
+    if (code < 0x80) {
+        utf8[0] = code;
+        return 1;
+    } else if (code < 0x800) {
+        utf8[0] = 0xC0 | (code >> 6);
+        utf8[1] = 0x80 | (code & 0x3F);
+        return 2;
+    } else if (code < 0x10000) {
+        utf8[0] = 0xE0 | (code >> 12);
+        utf8[1] = 0x80 | ((code >> 6) & 0x3F);
+        utf8[2] = 0x80 | (code & 0x3F);
+        return 3;
+    }
+    utf8[0] = 0xF0 | (code >> 18);
+    utf8[1] = 0x80 | ((code >> 12) & 0x3F);
+    utf8[2] = 0x80 | ((code >> 6) & 0x3F);
+    utf8[3] = 0x80 | (code & 0x3F);
+    return 4;
+}
+
+bool JSONReader::asString(const JSONToken &t, char *buf, size_t size, size_t &outLen)
+{
+    if (t.type != JSON_STRING || size == 0)
+        return false;
+
+    const char *p = t.start + 1;
+    size_t len = 0;
+    char utf8[4];
+    size_t n;
+    while ((n = nextChar(p, utf8)) != 0) {
+        if (len + n >= size) // Keep room for the terminator
+            return false;
+        memcpy(buf + len, utf8, n);
+        len += n;
+    }
+    buf[len] = 0;
+    outLen = len;
+    return true;
+}
+
+bool JSONReader::equals(const JSONToken &t, const char *s)
+{
+    if (t.type != JSON_STRING)
+        return false;
+
+    const char *p = t.start + 1;
+    char utf8[4];
+    size_t n;
+    while ((n = nextChar(p, utf8)) != 0) {
+        for (size_t i = 0; i < n; i++, s++)
+            if (*s == 0 || *s != utf8[i])
+                return false;
+    }
+    return *s == 0;
+}
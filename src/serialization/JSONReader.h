@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define JSON_READER_MAX_DEPTH 16
+
+enum JSONType { JSON_INVALID = 0, JSON_NULL, JSON_BOOL, JSON_NUMBER, JSON_STRING, JSON_ARRAY, JSON_OBJECT };
+
+/**
+ * A value inside a JSON document, pointing into the original text (strings still have their quotes and escapes)
+ */
+struct JSONToken {
+    JSONType type = JSON_INVALID;
+    const char *start = nullptr;
+    size_t len = 0;
+};
+
+/**
+ * Reads JSON in place, without building a tree of JSONValues or copying anything to the heap.
+ *
+ * parse() checks the whole document once (with a bounded nesting depth, so hostile input can't run us out of stack) and
+ * hands back the root token.  Members and elements are then looked up by scanning the text of their parent, which is cheap
+ * for the handful of fields we care about in a downlinked message.
+ *
+ *     JSONToken root, type;
+ *     if (JSONReader::parse(payload, length, root) && JSONReader::find(root, "type", type) &&
+ *         JSONReader::equals(type, "sendtext"))
+ *         ...
+ */
+class JSONReader
+{
+  public:
+    /// Check json is exactly one well formed value (surrounding whitespace allowed), @return false if it isn't
+    static bool parse(const char *json, size_t len, JSONToken &root);
+    static bool isValid(const char *json, size_t len)
+    {
+        JSONToken root;
+        return parse(json, len, root);
+    }
+
+    /// Find the first member called key in an object token from a parsed document
+    static bool find(const JSONToken &object, const char *key, JSONToken &out);
+
+    /// Get the nth element of an array token from a parsed document
+    static bool at(const JSONToken &array, size_t index, JSONToken &out);
+
+    static bool asNumber(const JSONToken &t, double &out);
+    static bool asBool(const JSONToken &t, bool &out);
+
+    /// Unescape a string token into buf and null terminate it, @return false if it isn't a string or doesn't fit
+    static bool asString(const JSONToken &t, char *buf, size_t size, size_t &outLen);
+
+    /// Does the string token hold exactly s (after unescaping)?
+    static bool equals(const JSONToken &t, const char *s);
+
+  private:
+    /// Scan one value starting at p, @return the character after it or nullptr if it is malformed
+    static const char *scanValue(const char *p, const char *end, uint8_t depth, JSONToken &out);
+    static const char *scanString(const char *p, const char *end);
+    static const char *scanNumber(const char *p, const char *end);
+
+    /// Decode the next character of a string body into UTF-8, @return bytes written to utf8 or 0 at the closing quote
+    static size_t nextChar(const char *&p, char utf8[4]);
+};
@@ -0,0 +1,198 @@
+#include "JSONWriter.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+JSONWriter::JSONWriter(char *_buf, size_t _size) : buf(_buf), size(_size)
+{
+    if (size == 0)
+        overflow = true;
+}
+
+void JSONWriter::put(char c)
+{
+    put(&c, 1);
+}
+
+void JSONWriter::put(const char *s, size_t n)
+{
+    if (overflow)
+        return;
+    if (len + n >= size) { // Always keep room for the terminator
+        overflow = true;
+        return;
+    }
+    memcpy(buf + len, s, n);
+    len += n;
+}
+
+void JSONWriter::printf(const char *format, ...)
+{
+    char tmp[32];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(tmp, sizeof(tmp), format, args);
+    va_end(args);
+    if (n < 0 || (size_t)n >= sizeof(tmp))
+        overflow = true;
+    else
+        put(tmp, n);
+}
+
+void JSONWriter::separate()
+{
+    if (afterKey) {
+        afterKey = false; // The key already took care of it
+        return;
+    }
+    if (depth == 0)
+        return;
+    if (hasMembers & (1UL << depth))
+        put(',');
+    hasMembers |= 1UL << depth;
+}
+
+void JSONWriter::begin(char c)
+{
+    separate();
+    if (depth + 1 >= JSON_WRITER_MAX_DEPTH) {
+        overflow = true;
+        return;
+    }
+    put(c);
+    depth++;
+    hasMembers &= ~(1UL << depth);
+}
+
+void JSONWriter::end(char c)
+{
+    if (depth == 0) {
+        overflow = true; // Unbalanced
+        return;
+    }
+    put(c);
+    depth--;
+}
+
+void JSONWriter::beginObject()
+{
+    begin('{');
+}
+
+void JSONWriter::endObject()
+{
+    end('}');
+}
+
+void JSONWriter::beginArray()
+{
+    begin('[');
+}
+
+void JSONWriter::endArray()
+{
+    end(']');
+}
+
+void JSONWriter::key(const char *name)
+{
+    separate();
+    putString(name, strlen(name));
+    put(':');
+    afterKey = true;
+}
+
+void JSONWriter::value(const char *s)
+{
+    value(s, strlen(s));
+}
+
+void JSONWriter::value(const char *s, size_t n)
+{
+    separate();
+    putString(s, n);
+}
+
+void JSONWriter::value(bool b)
+{
+    separate();
+    if (b)
+        put("true", 4);
+    else
+        put("false", 5);
+}
+
+void JSONWriter::value(long i)
+{
+    separate();
+    printf("%ld", i);
+}
+
+void JSONWriter::value(unsigned long u)
+{
+    separate();
+    printf("%lu", u);
+}
+
+void JSONWriter::value(double d)
+{
+    separate();
+    if (isinf(d) || isnan(d))
+        put("null", 4);
+    else
+        printf("%.15g", d); // What JSONValue gets from a stringstream with precision 15
+}
+
+void JSONWriter::valueNull()
+{
+    separate();
+    put("null", 4);
+}
+
+void JSONWriter::rawValue(const char *json, size_t n)
+{
+    separate();
+    put(json, n);
+}
+
+/// Same escaping rules as JSONValue::StringifyString()
+void JSONWriter::putString(const char *s, size_t n)
+{
+    put('"');
+    for (size_t i = 0; i < n && !overflow; i++) {
+        char chr = s[i];
+        if (chr == '"' || chr == '\\' || chr == '/') {
+            put('\\');
+            put(chr);
+        } else if (chr == '\b') {
+            put("\\b", 2);
+        } else if (chr == '\f') {
+            put("\\f", 2);
+        } else if (chr == '\n') {
+            put("\\n", 2);
+        } else if (chr == '\r') {
+            put("\\r", 2);
+        } else if (chr == '\t') {
+            put("\\t", 2);
+        } else if ((chr >= 0 && chr < 0x20) || chr == 0x7F) {
+            printf("\\u%04x", chr);
+        } else {
+            put(chr); // Multibyte UTF-8 sequences pass through as they are
+        }
+    }
+    put('"');
+}
+
+size_t JSONWriter::finish()
+{
+    if (depth != 0)
+        overflow = true;
+    if (overflow) {
+        if (size)
+            buf[0] = 0;
+        return 0;
+    }
+    buf[len] = 0;
+    return len;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define JSON_WRITER_MAX_DEPTH 16
+
+/**
+ * Writes JSON straight into a caller provided buffer, without building a tree of JSONValues first.
+ *
+ * Values are written in the order they are added, commas are taken care of.  If the buffer runs out (or the nesting gets too
+ * deep) the writer stops and overflowed() turns true, the output is then incomplete and should not be used.  Numbers and
+ * strings are formatted the same way JSONValue::Stringify() does it.
+ *
+ *     JSONWriter w(buf, sizeof(buf));
+ *     w.beginObject();
+ *     w.field("id", 1234u);
+ *     w.key("neighbors");
+ *     w.beginArray();
+ *     ...
+ *     w.endArray();
+ *     w.endObject();
+ *     size_t len = w.finish(); // 0 on overflow
+ */
+class JSONWriter
+{
+  public:
+    JSONWriter(char *buf, size_t size);
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+
+    /// Start a member of the current object, follow with a value or a begin*()
+    void key(const char *name);
+
+    void value(const char *s);
+    void value(const char *s, size_t len);
+    void value(bool b);
+    void value(int i) { value((long)i); }
+    void value(unsigned int u) { value((unsigned long)u); }
+    void value(long i);
+    void value(unsigned long u);
+    void value(double d);
+    void value(float f) { value((double)f); }
+    void valueNull();
+
+    /// Copy already serialized JSON (e.g. a payload that turned out to be JSON) in as a value, the caller vouches for it
+    void rawValue(const char *json, size_t len);
+
+    template <typename T> void field(const char *name, T v)
+    {
+        key(name);
+        value(v);
+    }
+
+    bool overflowed() const { return overflow; }
+
+    /// Null terminate the output, @return its length or 0 if it didn't fit
+    size_t finish();
+
+  private:
+    char *buf;
+    size_t size; // Includes room for the terminator
+    size_t len = 0;
+    bool overflow = false;
+
+    uint8_t depth = 0;
+    uint32_t hasMembers = 0; // bit n is set once the container at depth n has something in it
+    bool afterKey = false;
+
+    void put(char c);
+    void put(const char *s, size_t n);
+    void printf(const char *format, ...);
+    void separate(); // Comma before every container member but the first
+    void begin(char c);
+    void end(char c);
+    void putString(const char *s, size_t n);
+};
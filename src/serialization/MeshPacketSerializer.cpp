@@ -1,7 +1,8 @@
-#ifndef NRF52_USE_JSON
 #include "MeshPacketSerializer.h"
-#include "JSON.h"
+#include "JSONReader.h"
+#include "JSONWriter.h"
 #include "NodeDB.h"
+#include "PerfCounters.h"
 #include "mesh/generated/meshtastic/mqtt.pb.h"
 #include "mesh/generated/meshtastic/telemetry.pb.h"
 #include "modules/RoutingModule.h"
@@ -15,284 +16,276 @@
 
 static const char *errStr = "Error decoding proto for %s message!";
 
-std::string MeshPacketSerializer::JsonSerialize(const meshtastic_MeshPacket *mp, bool shouldLog)
+/// Write the payload of a text-like packet, embedding it as is if it happens to be JSON itself
+static void writeTextPayload(JSONWriter &w, const meshtastic_MeshPacket *mp, bool checkJson, bool shouldLog)
 {
-    // the created jsonObj is immutable after creation, so
-    // we need to do the heavy lifting before assembling it.
-    std::string msgType;
-    JSONObject jsonObj;
+    char payloadStr[(mp->decoded.payload.size) + 1];
+    memcpy(payloadStr, mp->decoded.payload.bytes, mp->decoded.payload.size);
+    payloadStr[mp->decoded.payload.size] = 0; // null terminated string
+
+    w.key("payload");
+    if (checkJson) {
+        // check if this is a JSON payload, without building it up in memory
+        if (JSONReader::isValid(payloadStr, mp->decoded.payload.size)) {
+            if (shouldLog)
+                LOG_INFO("text message payload is of type json");
+
+            // if it is, then we can just embed it as is
+            w.rawValue(payloadStr, mp->decoded.payload.size);
+            return;
+        }
+        // if it isn't, then we need to create a json object with the string as the value
+        if (shouldLog)
+            LOG_INFO("text message payload is of type plaintext");
+    }
+    w.beginObject();
+    w.field("text", (const char *)payloadStr);
+    w.endObject();
+}
+
+static void writeTelemetryPayload(JSONWriter &w, const meshtastic_Telemetry *decoded)
+{
+    w.key("payload");
+    w.beginObject();
+    if (decoded->which_variant == meshtastic_Telemetry_device_metrics_tag) {
+        const meshtastic_DeviceMetrics &m = decoded->variant.device_metrics;
+        // If battery is present, encode the battery level value
+        // TODO - Add a condition to send a code for a non-present value
+        if (m.has_battery_level)
+            w.field("battery_level", (int)m.battery_level);
+        w.field("voltage", m.voltage);
+        w.field("channel_utilization", m.channel_utilization);
+        w.field("air_util_tx", m.air_util_tx);
+        w.field("uptime_seconds", (unsigned int)m.uptime_seconds);
+    } else if (decoded->which_variant == meshtastic_Telemetry_environment_metrics_tag) {
+        const meshtastic_EnvironmentMetrics &m = decoded->variant.environment_metrics;
+        // Avoid sending 0s for sensors that could be 0
+        if (m.has_temperature)
+            w.field("temperature", m.temperature);
+        if (m.has_relative_humidity)
+            w.field("relative_humidity", m.relative_humidity);
+        if (m.has_barometric_pressure)
+            w.field("barometric_pressure", m.barometric_pressure);
+        if (m.has_gas_resistance)
+            w.field("gas_resistance", m.gas_resistance);
+        if (m.has_voltage)
+            w.field("voltage", m.voltage);
+        if (m.has_current)
+            w.field("current", m.current);
+        if (m.has_lux)
+            w.field("lux", m.lux);
+        if (m.has_white_lux)
+            w.field("white_lux", m.white_lux);
+        if (m.has_iaq)
+            w.field("iaq", (unsigned int)m.iaq);
+        if (m.has_distance)
+            w.field("distance", m.distance);
+        if (m.has_wind_speed)
+            w.field("wind_speed", m.wind_speed);
+        if (m.has_wind_direction)
+            w.field("wind_direction", (unsigned int)m.wind_direction);
+        if (m.has_wind_gust)
+            w.field("wind_gust", m.wind_gust);
+        if (m.has_wind_lull)
+            w.field("wind_lull", m.wind_lull);
+        if (m.has_radiation)
+            w.field("radiation", m.radiation);
+        if (m.has_ir_lux)
+            w.field("ir_lux", m.ir_lux);
+        if (m.has_uv_lux)
+            w.field("uv_lux", m.uv_lux);
+        if (m.has_weight)
+            w.field("weight", m.weight);
+        if (m.has_rainfall_1h)
+            w.field("rainfall_1h", m.rainfall_1h);
+        if (m.has_rainfall_24h)
+            w.field("rainfall_24h", m.rainfall_24h);
+        if (m.has_soil_moisture)
+            w.field("soil_moisture", (unsigned int)m.soil_moisture);
+        if (m.has_soil_temperature)
+            w.field("soil_temperature", m.soil_temperature);
+    } else if (decoded->which_variant == meshtastic_Telemetry_air_quality_metrics_tag) {
+        const meshtastic_AirQualityMetrics &m = decoded->variant.air_quality_metrics;
+        if (m.has_pm10_standard)
+            w.field("pm10", (unsigned int)m.pm10_standard);
+        if (m.has_pm25_standard)
+            w.field("pm25", (unsigned int)m.pm25_standard);
+        if (m.has_pm100_standard)
+            w.field("pm100", (unsigned int)m.pm100_standard);
+        if (m.has_pm10_environmental)
+            w.field("pm10_e", (unsigned int)m.pm10_environmental);
+        if (m.has_pm25_environmental)
+            w.field("pm25_e", (unsigned int)m.pm25_environmental);
+        if (m.has_pm100_environmental)
+            w.field("pm100_e", (unsigned int)m.pm100_environmental);
+    } else if (decoded->which_variant == meshtastic_Telemetry_power_metrics_tag) {
+        const meshtastic_PowerMetrics &m = decoded->variant.power_metrics;
+        if (m.has_ch1_voltage)
+            w.field("voltage_ch1", m.ch1_voltage);
+        if (m.has_ch1_current)
+            w.field("current_ch1", m.ch1_current);
+        if (m.has_ch2_voltage)
+            w.field("voltage_ch2", m.ch2_voltage);
+        if (m.has_ch2_current)
+            w.field("current_ch2", m.ch2_current);
+        if (m.has_ch3_voltage)
+            w.field("voltage_ch3", m.ch3_voltage);
+        if (m.has_ch3_current)
+            w.field("current_ch3", m.ch3_current);
+    }
+    w.endObject();
+}
+
+/// Append the long name of num (or "Unknown") to the array being written
+static void writeRouteName(JSONWriter &w, NodeNum num)
+{
+    char long_name[40] = "Unknown";
+    meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(num);
+    bool name_known = node ? node->has_user : false;
+    if (name_known)
+        memcpy(long_name, node->user.long_name, sizeof(long_name));
+    long_name[sizeof(long_name) - 1] = 0;
+    w.value((const char *)long_name);
+}
+
+/// Fields every packet gets, after whatever its payload produced
+static void writePacketMetadata(JSONWriter &w, const meshtastic_MeshPacket *mp)
+{
+    if (mp->rx_rssi != 0)
+        w.field("rssi", (int)mp->rx_rssi);
+    if (mp->rx_snr != 0)
+        w.field("snr", (float)mp->rx_snr);
+    if (mp->hop_start != 0 && mp->hop_limit <= mp->hop_start) {
+        w.field("hops_away", (unsigned int)(mp->hop_start - mp->hop_limit));
+        w.field("hop_start", (unsigned int)(mp->hop_start));
+    }
+}
+
+size_t MeshPacketSerializer::JsonSerialize(const meshtastic_MeshPacket *mp, char *buf, size_t bufLen, bool shouldLog)
+{
+    PERF_SCOPE(PERF_JSON_SERIALIZE);
+    JSONWriter w(buf, bufLen);
+    const char *msgType = "";
+    w.beginObject();
 
     if (mp->which_payload_variant == meshtastic_MeshPacket_decoded_tag) {
-        JSONObject msgPayload;
         switch (mp->decoded.portnum) {
         case meshtastic_PortNum_TEXT_MESSAGE_APP: {
             msgType = "text";
-            // convert bytes to string
             if (shouldLog)
                 LOG_DEBUG("got text message of size %u", mp->decoded.payload.size);
-
-            char payloadStr[(mp->decoded.payload.size) + 1];
-            memcpy(payloadStr, mp->decoded.payload.bytes, mp->decoded.payload.size);
-            payloadStr[mp->decoded.payload.size] = 0; // null terminated string
-            // check if this is a JSON payload
-            JSONValue *json_value = JSON::Parse(payloadStr);
-            if (json_value != NULL) {
-                if (shouldLog)
-                    LOG_INFO("text message payload is of type json");
-
-                // if it is, then we can just use the json object
-                jsonObj["payload"] = json_value;
-            } else {
-                // if it isn't, then we need to create a json object
-                // with the string as the value
-                if (shouldLog)
-                    LOG_INFO("text message payload is of type plaintext");
-
-                msgPayload["text"] = new JSONValue(payloadStr);
-                jsonObj["payload"] = new JSONValue(msgPayload);
-            }
+            writeTextPayload(w, mp, true, shouldLog);
             break;
         }
         case meshtastic_PortNum_TELEMETRY_APP: {
             msgType = "telemetry";
             meshtastic_Telemetry scratch;
-            meshtastic_Telemetry *decoded = NULL;
             memset(&scratch, 0, sizeof(scratch));
             if (pb_decode_from_bytes(mp->decoded.payload.bytes, mp->decoded.payload.size, &meshtastic_Telemetry_msg, &scratch)) {
-                decoded = &scratch;
-                if (decoded->which_variant == meshtastic_Telemetry_device_metrics_tag) {
-                    // If battery is present, encode the battery level value
-                    // TODO - Add a condition to send a code for a non-present value
-                    if (decoded->variant.device_metrics.has_battery_level) {
-                        msgPayload["battery_level"] = new JSONValue((int)decoded->variant.device_metrics.battery_level);
-                    }
-                    msgPayload["voltage"] = new JSONValue(decoded->variant.device_metrics.voltage);
-                    msgPayload["channel_utilization"] = new JSONValue(decoded->variant.device_metrics.channel_utilization);
-                    msgPayload["air_util_tx"] = new JSONValue(decoded->variant.device_metrics.air_util_tx);
-                    msgPayload["uptime_seconds"] = new JSONValue((unsigned int)decoded->variant.device_metrics.uptime_seconds);
-                } else if (decoded->which_variant == meshtastic_Telemetry_environment_metrics_tag) {
-                    // Avoid sending 0s for sensors that could be 0
-                    if (decoded->variant.environment_metrics.has_temperature) {
-                        msgPayload["temperature"] = new JSONValue(decoded->variant.environment_metrics.temperature);
-                    }
-                    if (decoded->variant.environment_metrics.has_relative_humidity) {
-                        msgPayload["relative_humidity"] = new JSONValue(decoded->variant.environment_metrics.relative_humidity);
-                    }
-                    if (decoded->variant.environment_metrics.has_barometric_pressure) {
-                        msgPayload["barometric_pressure"] =
-                            new JSONValue(decoded->variant.environment_metrics.barometric_pressure);
-                    }
-                    if (decoded->variant.environment_metrics.has_gas_resistance) {
-                        msgPayload["gas_resistance"] = new JSONValue(decoded->variant.environment_metrics.gas_resistance);
-                    }
-                    if (decoded->variant.environment_metrics.has_voltage) {
-                        msgPayload["voltage"] = new JSONValue(decoded->variant.environment_metrics.voltage);
-                    }
-                    if (decoded->variant.environment_metrics.has_current) {
-                        msgPayload["current"] = new JSONValue(decoded->variant.environment_metrics.current);
-                    }
-                    if (decoded->variant.environment_metrics.has_lux) {
-                        msgPayload["lux"] = new JSONValue(decoded->variant.environment_metrics.lux);
-                    }
-                    if (decoded->variant.environment_metrics.has_white_lux) {
-                        msgPayload["white_lux"] = new JSONValue(decoded->variant.environment_metrics.white_lux);
-                    }
-                    if (decoded->variant.environment_metrics.has_iaq) {
-                        msgPayload["iaq"] = new JSONValue((uint)decoded->variant.environment_metrics.iaq);
-                    }
-                    if (decoded->variant.environment_metrics.has_distance) {
-                        msgPayload["distance"] = new JSONValue(decoded->variant.environment_metrics.distance);
-                    }
-                    if (decoded->variant.environment_metrics.has_wind_speed) {
-                        msgPayload["wind_speed"] = new JSONValue(decoded->variant.environment_metrics.wind_speed);
-                    }
-                    if (decoded->variant.environment_metrics.has_wind_direction) {
-                        msgPayload["wind_direction"] = new JSONValue((uint)decoded->variant.environment_metrics.wind_direction);
-                    }
-                    if (decoded->variant.environment_metrics.has_wind_gust) {
-                        msgPayload["wind_gust"] = new JSONValue(decoded->variant.environment_metrics.wind_gust);
-                    }
-                    if (decoded->variant.environment_metrics.has_wind_lull) {
-                        msgPayload["wind_lull"] = new JSONValue(decoded->variant.environment_metrics.wind_lull);
-                    }
-                    if (decoded->variant.environment_metrics.has_radiation) {
-                        msgPayload["radiation"] = new JSONValue(decoded->variant.environment_metrics.radiation);
-                    }
-                    if (decoded->variant.environment_metrics.has_ir_lux) {
-                        msgPayload["ir_lux"] = new JSONValue(decoded->variant.environment_metrics.ir_lux);
-                    }
-                    if (decoded->variant.environment_metrics.has_uv_lux) {
-                        msgPayload["uv_lux"] = new JSONValue(decoded->variant.environment_metrics.uv_lux);
-                    }
-                    if (decoded->variant.environment_metrics.has_weight) {
-                        msgPayload["weight"] = new JSONValue(decoded->variant.environment_metrics.weight);
-                    }
-                    if (decoded->variant.environment_metrics.has_rainfall_1h) {
-                        msgPayload["rainfall_1h"] = new JSONValue(decoded->variant.environment_metrics.rainfall_1h);
-                    }
-                    if (decoded->variant.environment_metrics.has_rainfall_24h) {
-                        msgPayload["rainfall_24h"] = new JSONValue(decoded->variant.environment_metrics.rainfall_24h);
-                    }
-                    if (decoded->variant.environment_metrics.has_soil_moisture) {
-                        msgPayload["soil_moisture"] = new JSONValue((uint)decoded->variant.environment_metrics.soil_moisture);
-                    }
-                    if (decoded->variant.environment_metrics.has_soil_temperature) {
-                        msgPayload["soil_temperature"] = new JSONValue(decoded->variant.environment_metrics.soil_temperature);
-                    }
-                } else if (decoded->which_variant == meshtastic_Telemetry_air_quality_metrics_tag) {
-                    if (decoded->variant.air_quality_metrics.has_pm10_standard) {
-                        msgPayload["pm10"] = new JSONValue((unsigned int)decoded->variant.air_quality_metrics.pm10_standard);
-                    }
-                    if (decoded->variant.air_quality_metrics.has_pm25_standard) {
-                        msgPayload["pm25"] = new JSONValue((unsigned int)decoded->variant.air_quality_metrics.pm25_standard);
-                    }
-                    if (decoded->variant.air_quality_metrics.has_pm100_standard) {
-                        msgPayload["pm100"] = new JSONValue((unsigned int)decoded->variant.air_quality_metrics.pm100_standard);
-                    }
-                    if (decoded->variant.air_quality_metrics.has_pm10_environmental) {
-                        msgPayload["pm10_e"] =
-                            new JSONValue((unsigned int)decoded->variant.air_quality_metrics.pm10_environmental);
-                    }
-                    if (decoded->variant.air_quality_metrics.has_pm25_environmental) {
-                        msgPayload["pm25_e"] =
-                            new JSONValue((unsigned int)decoded->variant.air_quality_metrics.pm25_environmental);
-                    }
-                    if (decoded->variant.air_quality_metrics.has_pm100_environmental) {
-                        msgPayload["pm100_e"] =
-                            new JSONValue((unsigned int)decoded->variant.air_quality_metrics.pm100_environmental);
-                    }
-                } else if (decoded->which_variant == meshtastic_Telemetry_power_metrics_tag) {
-                    if (decoded->variant.power_metrics.has_ch1_voltage) {
-                        msgPayload["voltage_ch1"] = new JSONValue(decoded->variant.power_metrics.ch1_voltage);
-                    }
-                    if (decoded->variant.power_metrics.has_ch1_current) {
-                        msgPayload["current_ch1"] = new JSONValue(decoded->variant.power_metrics.ch1_current);
-                    }
-                    if (decoded->variant.power_metrics.has_ch2_voltage) {
-                        msgPayload["voltage_ch2"] = new JSONValue(decoded->variant.power_metrics.ch2_voltage);
-                    }
-                    if (decoded->variant.power_metrics.has_ch2_current) {
-                        msgPayload["current_ch2"] = new JSONValue(decoded->variant.power_metrics.ch2_current);
-                    }
-                    if (decoded->variant.power_metrics.has_ch3_voltage) {
-                        msgPayload["voltage_ch3"] = new JSONValue(decoded->variant.power_metrics.ch3_voltage);
-                    }
-                    if (decoded->variant.power_metrics.has_ch3_current) {
-                        msgPayload["current_ch3"] = new JSONValue(decoded->variant.power_metrics.ch3_current);
-                    }
-                }
-                jsonObj["payload"] = new JSONValue(msgPayload);
+                writeTelemetryPayload(w, &scratch);
             } else if (shouldLog) {
-                LOG_ERROR(errStr, msgType.c_str());
+                LOG_ERROR(errStr, msgType);
             }
             break;
         }
         case meshtastic_PortNum_NODEINFO_APP: {
             msgType = "nodeinfo";
             meshtastic_User scratch;
-            meshtastic_User *decoded = NULL;
             memset(&scratch, 0, sizeof(scratch));
             if (pb_decode_from_bytes(mp->decoded.payload.bytes, mp->decoded.payload.size, &meshtastic_User_msg, &scratch)) {
-                decoded = &scratch;
-                msgPayload["id"] = new JSONValue(decoded->id);
-                msgPayload["longname"] = new JSONValue(decoded->long_name);
-                msgPayload["shortname"] = new JSONValue(decoded->short_name);
-                msgPayload["hardware"] = new JSONValue(decoded->hw_model);
-                msgPayload["role"] = new JSONValue((int)decoded->role);
-                jsonObj["payload"] = new JSONValue(msgPayload);
+                w.key("payload");
+                w.beginObject();
+                w.field("id", (const char *)scratch.id);
+                w.field("longname", (const char *)scratch.long_name);
+                w.field("shortname", (const char *)scratch.short_name);
+                w.field("hardware", (int)scratch.hw_model);
+                w.field("role", (int)scratch.role);
+                w.endObject();
             } else if (shouldLog) {
-                LOG_ERROR(errStr, msgType.c_str());
+                LOG_ERROR(errStr, msgType);
             }
             break;
         }
         case meshtastic_PortNum_POSITION_APP: {
             msgType = "position";
             meshtastic_Position scratch;
-            meshtastic_Position *decoded = NULL;
             memset(&scratch, 0, sizeof(scratch));
             if (pb_decode_from_bytes(mp->decoded.payload.bytes, mp->decoded.payload.size, &meshtastic_Position_msg, &scratch)) {
-                decoded = &scratch;
-                if ((int)decoded->time) {
-                    msgPayload["time"] = new JSONValue((unsigned int)decoded->time);
-                }
-                if ((int)decoded->timestamp) {
-                    msgPayload["timestamp"] = new JSONValue((unsigned int)decoded->timestamp);
-                }
-                msgPayload["latitude_i"] = new JSONValue((int)decoded->latitude_i);
-                msgPayload["longitude_i"] = new JSONValue((int)decoded->longitude_i);
-                if ((int)decoded->altitude) {
-                    msgPayload["altitude"] = new JSONValue((int)decoded->altitude);
-                }
-                if ((int)decoded->ground_speed) {
-                    msgPayload["ground_speed"] = new JSONValue((unsigned int)decoded->ground_speed);
-                }
-                if (int(decoded->ground_track)) {
-                    msgPayload["ground_track"] = new JSONValue((unsigned int)decoded->ground_track);
-                }
-                if (int(decoded->sats_in_view)) {
-                    msgPayload["sats_in_view"] = new JSONValue((unsigned int)decoded->sats_in_view);
-                }
-                if ((int)decoded->PDOP) {
-                    msgPayload["PDOP"] = new JSONValue((int)decoded->PDOP);
-                }
-                if ((int)decoded->HDOP) {
-                    msgPayload["HDOP"] = new JSONValue((int)decoded->HDOP);
-                }
-                if ((int)decoded->VDOP) {
-                    msgPayload["VDOP"] = new JSONValue((int)decoded->VDOP);
-                }
-                if ((int)decoded->precision_bits) {
-                    msgPayload["precision_bits"] = new JSONValue((int)decoded->precision_bits);
-                }
-                jsonObj["payload"] = new JSONValue(msgPayload);
+                const meshtastic_Position *decoded = &scratch;
+                w.key("payload");
+                w.beginObject();
+                if ((int)decoded->time)
+                    w.field("time", (unsigned int)decoded->time);
+                if ((int)decoded->timestamp)
+                    w.field("timestamp", (unsigned int)decoded->timestamp);
+                w.field("latitude_i", (int)decoded->latitude_i);
+                w.field("longitude_i", (int)decoded->longitude_i);
+                if ((int)decoded->altitude)
+                    w.field("altitude", (int)decoded->altitude);
+                if ((int)decoded->ground_speed)
+                    w.field("ground_speed", (unsigned int)decoded->ground_speed);
+                if (int(decoded->ground_track))
+                    w.field("ground_track", (unsigned int)decoded->ground_track);
+                if (int(decoded->sats_in_view))
+                    w.field("sats_in_view", (unsigned int)decoded->sats_in_view);
+                if ((int)decoded->PDOP)
+                    w.field("PDOP", (int)decoded->PDOP);
+                if ((int)decoded->HDOP)
+                    w.field("HDOP", (int)decoded->HDOP);
+                if ((int)decoded->VDOP)
+                    w.field("VDOP", (int)decoded->VDOP);
+                if ((int)decoded->precision_bits)
+                    w.field("precision_bits", (int)decoded->precision_bits);
+                w.endObject();
             } else if (shouldLog) {
-                LOG_ERROR(errStr, msgType.c_str());
+                LOG_ERROR(errStr, msgType);
             }
             break;
         }
         case meshtastic_PortNum_WAYPOINT_APP: {
             msgType = "waypoint";
             meshtastic_Waypoint scratch;
-            meshtastic_Waypoint *decoded = NULL;
             memset(&scratch, 0, sizeof(scratch));
             if (pb_decode_from_bytes(mp->decoded.payload.bytes, mp->decoded.payload.size, &meshtastic_Waypoint_msg, &scratch)) {
-                decoded = &scratch;
-                msgPayload["id"] = new JSONValue((unsigned int)decoded->id);
-                msgPayload["name"] = new JSONValue(decoded->name);
-                msgPayload["description"] = new JSONValue(decoded->description);
-                msgPayload["expire"] = new JSONValue((unsigned int)decoded->expire);
-                msgPayload["locked_to"] = new JSONValue((unsigned int)decoded->locked_to);
-                msgPayload["latitude_i"] = new JSONValue((int)decoded->latitude_i);
-                msgPayload["longitude_i"] = new JSONValue((int)decoded->longitude_i);
-                jsonObj["payload"] = new JSONValue(msgPayload);
+                w.key("payload");
+                w.beginObject();
+                w.field("id", (unsigned int)scratch.id);
+                w.field("name", (const char *)scratch.name);
+                w.field("description", (const char *)scratch.description);
+                w.field("expire", (unsigned int)scratch.expire);
+                w.field("locked_to", (unsigned int)scratch.locked_to);
+                w.field("latitude_i", (int)scratch.latitude_i);
+                w.field("longitude_i", (int)scratch.longitude_i);
+                w.endObject();
             } else if (shouldLog) {
-                LOG_ERROR(errStr, msgType.c_str());
+                LOG_ERROR(errStr, msgType);
             }
             break;
         }
         case meshtastic_PortNum_NEIGHBORINFO_APP: {
             msgType = "neighborinfo";
             meshtastic_NeighborInfo scratch;
-            meshtastic_NeighborInfo *decoded = NULL;
             memset(&scratch, 0, sizeof(scratch));
             if (pb_decode_from_bytes(mp->decoded.payload.bytes, mp->decoded.payload.size, &meshtastic_NeighborInfo_msg,
                                      &scratch)) {
-                decoded = &scratch;
-                msgPayload["node_id"] = new JSONValue((unsigned int)decoded->node_id);
-                msgPayload["node_broadcast_interval_secs"] = new JSONValue((unsigned int)decoded->node_broadcast_interval_secs);
-                msgPayload["last_sent_by_id"] = new JSONValue((unsigned int)decoded->last_sent_by_id);
-                msgPayload["neighbors_count"] = new JSONValue(decoded->neighbors_count);
-                JSONArray neighbors;
-                for (uint8_t i = 0; i < decoded->neighbors_count; i++) {
-                    JSONObject neighborObj;
-                    neighborObj["node_id"] = new JSONValue((unsigned int)decoded->neighbors[i].node_id);
-                    neighborObj["snr"] = new JSONValue((int)decoded->neighbors[i].snr);
-                    neighbors.push_back(new JSONValue(neighborObj));
+                w.key("payload");
+                w.beginObject();
+                w.field("node_id", (unsigned int)scratch.node_id);
+                w.field("node_broadcast_interval_secs", (unsigned int)scratch.node_broadcast_interval_secs);
+                w.field("last_sent_by_id", (unsigned int)scratch.last_sent_by_id);
+                w.field("neighbors_count", (int)scratch.neighbors_count);
+                w.key("neighbors");
+                w.beginArray();
+                for (uint8_t i = 0; i < scratch.neighbors_count; i++) {
+                    w.beginObject();
+                    w.field("node_id", (unsigned int)scratch.neighbors[i].node_id);
+                    w.field("snr", (int)scratch.neighbors[i].snr);
+                    w.endObject();
                 }
-                msgPayload["neighbors"] = new JSONValue(neighbors);
-                jsonObj["payload"] = new JSONValue(msgPayload);
+                w.endArray();
+                w.endObject();
             } else if (shouldLog) {
-                LOG_ERROR(errStr, msgType.c_str());
+                LOG_ERROR(errStr, msgType);
             }
             break;
         }
@@ -300,99 +293,93 @@ std::string MeshPacketSerializer::JsonSerialize(const meshtastic_MeshPacket *mp,
             if (mp->decoded.request_id) { // Only report the traceroute response
                 msgType = "traceroute";
                 meshtastic_RouteDiscovery scratch;
-                meshtastic_RouteDiscovery *decoded = NULL;
                 memset(&scratch, 0, sizeof(scratch));
                 if (pb_decode_from_bytes(mp->decoded.payload.bytes, mp->decoded.payload.size, &meshtastic_RouteDiscovery_msg,
                                          &scratch)) {
-                    decoded = &scratch;
-                    JSONArray route;      // Route this message took
-                    JSONArray routeBack;  // Route this message took back
-                    JSONArray snrTowards; // Snr for forward route
-                    JSONArray snrBack;    // Snr for reverse route
+                    const meshtastic_RouteDiscovery *decoded = &scratch;
+                    w.key("payload");
+                    w.beginObject();
 
-                    // Lambda function for adding a long name to the route
-                    auto addToRoute = [](JSONArray *route, NodeNum num) {
-                        char long_name[40] = "Unknown";
-                        meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(num);
-                        bool name_known = node ? node->has_user : false;
-                        if (name_known)
-                            memcpy(long_name, node->user.long_name, sizeof(long_name));
-                        route->push_back(new JSONValue(long_name));
-                    };
-                    addToRoute(&route, mp->to); // Started at the original transmitter (destination of response)
-                    for (uint8_t i = 0; i < decoded->route_count; i++) {
-                        addToRoute(&route, decoded->route[i]);
-                    }
-                    addToRoute(&route, mp->from); // Ended at the original destination (source of response)
+                    // Route this message took
+                    w.key("route");
+                    w.beginArray();
+                    writeRouteName(w, mp->to); // Started at the original transmitter (destination of response)
+                    for (uint8_t i = 0; i < decoded->route_count; i++)
+                        writeRouteName(w, decoded->route[i]);
+                    writeRouteName(w, mp->from); // Ended at the original destination (source of response)
+                    w.endArray();
 
-                    addToRoute(&routeBack, mp->from); // Started at the original destination (source of response)
-                    for (uint8_t i = 0; i < decoded->route_back_count; i++) {
-                        addToRoute(&routeBack, decoded->route_back[i]);
-                    }
-                    addToRoute(&routeBack, mp->to); // Ended at the original transmitter (destination of response)
+                    // Route this message took back
+                    w.key("route_back");
+                    w.beginArray();
+                    writeRouteName(w, mp->from); // Started at the original destination (source of response)
+                    for (uint8_t i = 0; i < decoded->route_back_count; i++)
+                        writeRouteName(w, decoded->route_back[i]);
+                    writeRouteName(w, mp->to); // Ended at the original transmitter (destination of response)
+                    w.endArray();
 
-                    for (uint8_t i = 0; i < decoded->snr_back_count; i++) {
-                        snrBack.push_back(new JSONValue((float)decoded->snr_back[i] / 4));
-                    }
+                    // Snr for reverse route
+                    w.key("snr_back");
+                    w.beginArray();
+                    for (uint8_t i = 0; i < decoded->snr_back_count; i++)
+                        w.value((float)decoded->snr_back[i] / 4);
+                    w.endArray();
 
-                    for (uint8_t i = 0; i < decoded->snr_towards_count; i++) {
-                        snrTowards.push_back(new JSONValue((float)decoded->snr_towards[i] / 4));
-                    }
+                    // Snr for forward route
+                    w.key("snr_towards");
+                    w.beginArray();
+                    for (uint8_t i = 0; i < decoded->snr_towards_count; i++)
+                        w.value((float)decoded->snr_towards[i] / 4);
+                    w.endArray();
 
-                    msgPayload["route"] = new JSONValue(route);
-                    msgPayload["route_back"] = new JSONValue(routeBack);
-                    msgPayload["snr_back"] = new JSONValue(snrBack);
-                    msgPayload["snr_towards"] = new JSONValue(snrTowards);
-                    jsonObj["payload"] = new JSONValue(msgPayload);
+                    w.endObject();
                 } else if (shouldLog) {
-                    LOG_ERROR(errStr, msgType.c_str());
+                    LOG_ERROR(errStr, msgType);
                 }
             }
             break;
         }
         case meshtastic_PortNum_DETECTION_SENSOR_APP: {
             msgType = "detection";
-            char payloadStr[(mp->decoded.payload.size) + 1];
-            memcpy(payloadStr, mp->decoded.payload.bytes, mp->decoded.payload.size);
-            payloadStr[mp->decoded.payload.size] = 0; // null terminated string
-            msgPayload["text"] = new JSONValue(payloadStr);
-            jsonObj["payload"] = new JSONValue(msgPayload);
+            writeTextPayload(w, mp, false, shouldLog);
             break;
         }
 #ifdef ARCH_ESP32
         case meshtastic_PortNum_PAXCOUNTER_APP: {
             msgType = "paxcounter";
             meshtastic_Paxcount scratch;
-            meshtastic_Paxcount *decoded = NULL;
             memset(&scratch, 0, sizeof(scratch));
             if (pb_decode_from_bytes(mp->decoded.payload.bytes, mp->decoded.payload.size, &meshtastic_Paxcount_msg, &scratch)) {
-                decoded = &scratch;
-                msgPayload["wifi_count"] = new JSONValue((unsigned int)decoded->wifi);
-                msgPayload["ble_count"] = new JSONValue((unsigned int)decoded->ble);
-                msgPayload["uptime"] = new JSONValue((unsigned int)decoded->uptime);
-                jsonObj["payload"] = new JSONValue(msgPayload);
+                w.key("payload");
+                w.beginObject();
+                w.field("wifi_count", (unsigned int)scratch.wifi);
+                w.field("ble_count", (unsigned int)scratch.ble);
+                w.field("uptime", (unsigned int)scratch.uptime);
+                w.endObject();
             } else if (shouldLog) {
-                LOG_ERROR(errStr, msgType.c_str());
+                LOG_ERROR(errStr, msgType);
             }
             break;
         }
 #endif
         case meshtastic_PortNum_REMOTE_HARDWARE_APP: {
             meshtastic_HardwareMessage scratch;
-            meshtastic_HardwareMessage *decoded = NULL;
             memset(&scratch, 0, sizeof(scratch));
             if (pb_decode_from_bytes(mp->decoded.payload.bytes, mp->decoded.payload.size, &meshtastic_HardwareMessage_msg,
                                      &scratch)) {
-                decoded = &scratch;
-                if (decoded->type == meshtastic_HardwareMessage_Type_GPIOS_CHANGED) {
+                if (scratch.type == meshtastic_HardwareMessage_Type_GPIOS_CHANGED) {
                     msgType = "gpios_changed";
-                    msgPayload["gpio_value"] = new JSONValue((unsigned int)decoded->gpio_value);
-                    jsonObj["payload"] = new JSONValue(msgPayload);
-                } else if (decoded->type == meshtastic_HardwareMessage_Type_READ_GPIOS_REPLY) {
+                    w.key("payload");
+                    w.beginObject();
+                    w.field("gpio_value", (unsigned int)scratch.gpio_value);
+                    w.endObject();
+                } else if (scratch.type == meshtastic_HardwareMessage_Type_READ_GPIOS_REPLY) {
                     msgType = "gpios_read_reply";
-                    msgPayload["gpio_value"] = new JSONValue((unsigned int)decoded->gpio_value);
-                    msgPayload["gpio_mask"] = new JSONValue((unsigned int)decoded->gpio_mask);
-                    jsonObj["payload"] = new JSONValue(msgPayload);
+                    w.key("payload");
+                    w.beginObject();
+                    w.field("gpio_value", (unsigned int)scratch.gpio_value);
+                    w.field("gpio_mask", (unsigned int)scratch.gpio_mask);
+                    w.endObject();
                 }
             } else if (shouldLog) {
                 LOG_ERROR(errStr, "RemoteHardware");
@@ -407,62 +394,67 @@ std::string MeshPacketSerializer::JsonSerialize(const meshtastic_MeshPacket *mp,
         LOG_WARN("Couldn't convert encrypted payload of MeshPacket to JSON");
     }
 
-    jsonObj["id"] = new JSONValue((unsigned int)mp->id);
-    jsonObj["timestamp"] = new JSONValue((unsigned int)mp->rx_time);
-    jsonObj["to"] = new JSONValue((unsigned int)mp->to);
-    jsonObj["from"] = new JSONValue((unsigned int)mp->from);
-    jsonObj["channel"] = new JSONValue((unsigned int)mp->channel);
-    jsonObj["type"] = new JSONValue(msgType.c_str());
-    jsonObj["sender"] = new JSONValue(owner.id);
-    if (mp->rx_rssi != 0)
-        jsonObj["rssi"] = new JSONValue((int)mp->rx_rssi);
-    if (mp->rx_snr != 0)
-        jsonObj["snr"] = new JSONValue((float)mp->rx_snr);
-    if (mp->hop_start != 0 && mp->hop_limit <= mp->hop_start) {
-        jsonObj["hops_away"] = new JSONValue((unsigned int)(mp->hop_start - mp->hop_limit));
-        jsonObj["hop_start"] = new JSONValue((unsigned int)(mp->hop_start));
-    }
-
-    // serialize and write it to the stream
-    JSONValue *value = new JSONValue(jsonObj);
-    std::string jsonStr = value->Stringify();
-
-    if (shouldLog)
-        LOG_INFO("serialized json message: %s", jsonStr.c_str());
+    w.field("id", (unsigned int)mp->id);
+    w.field("timestamp", (unsigned int)mp->rx_time);
+    w.field("to", (unsigned int)mp->to);
+    w.field("from", (unsigned int)mp->from);
+    w.field("channel", (unsigned int)mp->channel);
+    w.field("type", msgType);
+    w.field("sender", (const char *)owner.id);
+    writePacketMetadata(w, mp);
+    w.endObject();
 
-    delete value;
-    return jsonStr;
+    size_t len = w.finish();
+    if (shouldLog && len)
+        LOG_INFO("serialized json message: %s", buf);
+    return len;
 }
 
-std::string MeshPacketSerializer::JsonSerializeEncrypted(const meshtastic_MeshPacket *mp)
+size_t MeshPacketSerializer::JsonSerializeEncrypted(const meshtastic_MeshPacket *mp, char *buf, size_t bufLen)
 {
-    JSONObject jsonObj;
+    JSONWriter w(buf, bufLen);
+    w.beginObject();
+    w.field("id", (unsigned int)mp->id);
+    w.field("time_ms", (double)millis());
+    w.field("timestamp", (unsigned int)mp->rx_time);
+    w.field("to", (unsigned int)mp->to);
+    w.field("from", (unsigned int)mp->from);
+    w.field("channel", (unsigned int)mp->channel);
+    w.field("want_ack", mp->want_ack);
+    writePacketMetadata(w, mp);
+    w.field("size", (unsigned int)mp->encrypted.size);
 
-    jsonObj["id"] = new JSONValue((unsigned int)mp->id);
-    jsonObj["time_ms"] = new JSONValue((double)millis());
-    jsonObj["timestamp"] = new JSONValue((unsigned int)mp->rx_time);
-    jsonObj["to"] = new JSONValue((unsigned int)mp->to);
-    jsonObj["from"] = new JSONValue((unsigned int)mp->from);
-    jsonObj["channel"] = new JSONValue((unsigned int)mp->channel);
-    jsonObj["want_ack"] = new JSONValue(mp->want_ack);
+    w.key("bytes");
+    char hex[2 * sizeof(mp->encrypted.bytes) + 1];
+    for (size_t i = 0; i < mp->encrypted.size; i++) {
+        hex[2 * i] = hexChars[(mp->encrypted.bytes[i] & 0xF0) >> 4];
+        hex[2 * i + 1] = hexChars[mp->encrypted.bytes[i] & 0x0F];
+    }
+    w.value(hex, 2 * mp->encrypted.size);
+    w.endObject();
 
-    if (mp->rx_rssi != 0)
-        jsonObj["rssi"] = new JSONValue((int)mp->rx_rssi);
-    if (mp->rx_snr != 0)
-        jsonObj["snr"] = new JSONValue((float)mp->rx_snr);
-    if (mp->hop_start != 0 && mp->hop_limit <= mp->hop_start) {
-        jsonObj["hops_away"] = new JSONValue((unsigned int)(mp->hop_start - mp->hop_limit));
-        jsonObj["hop_start"] = new JSONValue((unsigned int)(mp->hop_start));
+    return w.finish();
+}
+
+template <typename F> static std::string serializeToString(F serialize)
+{
+    // One allocation per packet, only a huge payload needs the second try
+    std::string out(MESHPACKET_JSON_MAX_SIZE, '\0');
+    size_t len = serialize(&out[0], out.size());
+    if (len == 0) {
+        out.assign(4 * MESHPACKET_JSON_MAX_SIZE, '\0');
+        len = serialize(&out[0], out.size());
     }
-    jsonObj["size"] = new JSONValue((unsigned int)mp->encrypted.size);
-    auto encryptedStr = bytesToHex(mp->encrypted.bytes, mp->encrypted.size);
-    jsonObj["bytes"] = new JSONValue(encryptedStr.c_str());
+    out.resize(len);
+    return out;
+}
 
-    // serialize and write it to the stream
-    JSONValue *value = new JSONValue(jsonObj);
-    std::string jsonStr = value->Stringify();
+std::string MeshPacketSerializer::JsonSerialize(const meshtastic_MeshPacket *mp, bool shouldLog)
+{
+    return serializeToString([&](char *buf, size_t len) { return JsonSerialize(mp, buf, len, shouldLog); });
+}
 
-    delete value;
-    return jsonStr;
+std::string MeshPacketSerializer::JsonSerializeEncrypted(const meshtastic_MeshPacket *mp)
+{
+    return serializeToString([&](char *buf, size_t len) { return JsonSerializeEncrypted(mp, buf, len); });
 }
-#endif
\ No newline at end of file
@@ -1,6 +1,11 @@
 #include <meshtastic/mesh.pb.h>
 #include <string>
 
+// Room for the JSON of any packet short of a payload that needs heavy escaping, those get a second, bigger try
+#ifndef MESHPACKET_JSON_MAX_SIZE
+#define MESHPACKET_JSON_MAX_SIZE 2048
+#endif
+
 static const char hexChars[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
 
 class MeshPacketSerializer
@@ -9,6 +14,10 @@ class MeshPacketSerializer
     static std::string JsonSerialize(const meshtastic_MeshPacket *mp, bool shouldLog = true);
     static std::string JsonSerializeEncrypted(const meshtastic_MeshPacket *mp);
 
+    /// Serialize into buf without any heap allocation, @return the length or 0 if it didn't fit
+    static size_t JsonSerialize(const meshtastic_MeshPacket *mp, char *buf, size_t bufLen, bool shouldLog = true);
+    static size_t JsonSerializeEncrypted(const meshtastic_MeshPacket *mp, char *buf, size_t bufLen);
+
   private:
     static std::string bytesToHex(const uint8_t *bytes, int len)
     {
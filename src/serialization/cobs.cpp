@@ -1,7 +1,7 @@
 #include "cobs.h"
 #include <stdlib.h>
 
-#ifdef SENSECAP_INDICATOR
+#if defined(SENSECAP_INDICATOR) || defined(PIO_UNIT_TESTING)
 
 cobs_encode_result cobs_encode(uint8_t *dst_buf_ptr, size_t dst_buf_len, const uint8_t *src_ptr, size_t src_len)
 {
@@ -463,12 +463,38 @@ esp_sleep_wakeup_cause_t doLightSleep(uint64_t sleepMsec) // FIXME, use a more r
     } else
 #endif
     {
-        LOG_INFO("Exit light sleep cause: %d", cause);
+        LOG_DEBUG("Exit light sleep cause: %d", cause);
     }
 
     return cause;
 }
 
+/**
+ * Tickless idle for power saving routers: rather than waiting out the main loop's delay awake, light sleep until the next
+ * thread deadline, waking early for a LoRa interrupt.  Sleeps are capped at IDLE_SLEEP_MAX_MSEC so the loop still checks
+ * in regularly, and only taken when nothing that light sleep would break (bluetooth, wifi, USB) is in use.
+ * @return false if we didn't sleep, so the caller should wait as usual
+ */
+bool doIdleSleep(uint32_t msec)
+{
+#if defined(SENSECAP_INDICATOR)
+    return false; // Can't wake on LoRa, see doLightSleep()
+#endif
+    if (msec < IDLE_SLEEP_MIN_MSEC || !config.power.is_power_saving || !shouldLoraWake(msec) || config.bluetooth.enabled)
+        return false;
+    if (powerStatus->getHasUSB())
+        return false; // No need to save power, and the USB serial port would stop
+#if HAS_WIFI
+    if (isWifiAvailable())
+        return false;
+#endif
+    if (!doPreflightSleep())
+        return false; // The radio is busy sending or receiving
+
+    doLightSleep(std::min<uint32_t>(msec, IDLE_SLEEP_MAX_MSEC));
+    return true;
+}
+
 // not legal on the stock android ESP build
 
 /**
@@ -526,18 +552,18 @@ void enableLoraInterrupt()
     gpio_pullup_en((gpio_num_t)LORA_CS);
 #endif
 
-    LOG_INFO("setup LORA_DIO1 (GPIO%02d) with wakeup by gpio interrupt", LORA_DIO1);
+    LOG_DEBUG("setup LORA_DIO1 (GPIO%02d) with wakeup by gpio interrupt", LORA_DIO1);
     gpio_wakeup_enable((gpio_num_t)LORA_DIO1, GPIO_INTR_HIGH_LEVEL);
 
 #elif defined(LORA_DIO1) && (LORA_DIO1 != RADIOLIB_NC)
     if (radioType != RF95_RADIO) {
-        LOG_INFO("setup LORA_DIO1 (GPIO%02d) with wakeup by gpio interrupt", LORA_DIO1);
+        LOG_DEBUG("setup LORA_DIO1 (GPIO%02d) with wakeup by gpio interrupt", LORA_DIO1);
         gpio_wakeup_enable((gpio_num_t)LORA_DIO1, GPIO_INTR_HIGH_LEVEL); // SX126x/SX128x interrupt, active high
     }
 #endif
 #if defined(RF95_IRQ) && (RF95_IRQ != RADIOLIB_NC)
     if (radioType == RF95_RADIO) {
-        LOG_INFO("setup RF95_IRQ (GPIO%02d) with wakeup by gpio interrupt", RF95_IRQ);
+        LOG_DEBUG("setup RF95_IRQ (GPIO%02d) with wakeup by gpio interrupt", RF95_IRQ);
         gpio_wakeup_enable((gpio_num_t)RF95_IRQ, GPIO_INTR_HIGH_LEVEL); // RF95 interrupt, active high
     }
 #endif
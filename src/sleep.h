@@ -10,6 +10,14 @@ void doDeepSleep(uint32_t msecToWake, bool skipPreflight, bool skipSaveNodeDb),
 #include "esp_sleep.h"
 esp_sleep_wakeup_cause_t doLightSleep(uint64_t msecToWake);
 
+#ifndef IDLE_SLEEP_MIN_MSEC
+#define IDLE_SLEEP_MIN_MSEC 200 // Idle periods shorter than this aren't worth the light sleep entry and exit
+#endif
+#ifndef IDLE_SLEEP_MAX_MSEC
+#define IDLE_SLEEP_MAX_MSEC (5 * 1000)
+#endif
+bool doIdleSleep(uint32_t msec);
+
 extern esp_sleep_source_t wakeCause;
 #endif
 
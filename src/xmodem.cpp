@@ -50,6 +50,7 @@
 
 #include "xmodem.h"
 #include "SPILock.h"
+#include <new>
 
 #ifdef FSCom
 
@@ -94,16 +95,26 @@ int XModemAdapter::check(const pb_byte_t *buf, int sz, unsigned short tcrc)
     return crc16_ccitt(buf, sz) == tcrc;
 }
 
-void XModemAdapter::sendControl(meshtastic_XModem_Control c)
+void XModemAdapter::sendControl(meshtastic_XModem_Control c, uint16_t seq, uint16_t crc16)
 {
     xmodemStore = meshtastic_XModem_init_zero;
     xmodemStore.control = c;
+    xmodemStore.seq = seq;
+    xmodemStore.crc16 = crc16;
     LOG_DEBUG("XModem: Notify Send control %d", c);
     packetReady.notifyObservers(packetno);
 }
 
 meshtastic_XModem XModemAdapter::getForPhone()
 {
+    // In a window the next block is only read now, so at most one of them is ever in RAM
+    if (xmodemStore.control == meshtastic_XModem_Control_NUL && sendQueueLen > 0 && isTransmitting) {
+        uint16_t seq = sendQueue[sendQueueHead];
+        sendQueueHead = (sendQueueHead + 1) % (XMODEM_MAX_WINDOW * 2);
+        sendQueueLen--;
+        readBlock(seq);
+        LOG_DEBUG("XModem: Window send packet %d, %d Bytes", seq, xmodemStore.buffer.size);
+    }
     return xmodemStore;
 }
 
@@ -112,6 +123,86 @@ void XModemAdapter::resetForPhone()
     xmodemStore = meshtastic_XModem_init_zero;
 }
 
+uint8_t XModemAdapter::requestedWindow(const meshtastic_XModem &p)
+{
+    if ((p.crc16 & 0xff00) != XMODEM_WINDOW_MAGIC)
+        return 1;
+    uint8_t w = p.crc16 & 0xff;
+    return w < 1 ? 1 : w > XMODEM_MAX_WINDOW ? XMODEM_MAX_WINDOW : w;
+}
+
+void XModemAdapter::readBlock(uint16_t seq)
+{
+    xmodemStore = meshtastic_XModem_init_zero;
+    xmodemStore.control = meshtastic_XModem_Control_SOH;
+    xmodemStore.seq = seq;
+    spiLock->lock();
+    file.seek((seq - 1) * sizeof(meshtastic_XModem_buffer_t::bytes));
+    xmodemStore.buffer.size = file.read(xmodemStore.buffer.bytes, sizeof(meshtastic_XModem_buffer_t::bytes));
+    spiLock->unlock();
+    xmodemStore.crc16 = crc16_ccitt(xmodemStore.buffer.bytes, xmodemStore.buffer.size);
+}
+
+void XModemAdapter::queueBlock(uint16_t seq)
+{
+    for (uint8_t i = 0; i < sendQueueLen; i++)
+        if (sendQueue[(sendQueueHead + i) % (XMODEM_MAX_WINDOW * 2)] == seq)
+            return;
+    if (sendQueueLen == XMODEM_MAX_WINDOW * 2)
+        return; // Can't happen, there are never more than window new blocks and window retransmits queued
+    sendQueue[(sendQueueHead + sendQueueLen) % (XMODEM_MAX_WINDOW * 2)] = seq;
+    sendQueueLen++;
+    packetReady.notifyObservers(seq);
+}
+
+// Queue new blocks until window of them are out without an ACK
+void XModemAdapter::fillWindow()
+{
+    while (nextToQueue <= lastBlock && nextToQueue < packetno + window)
+        queueBlock(nextToQueue++);
+}
+
+void XModemAdapter::receiveInWindow(const meshtastic_XModem &p)
+{
+    if (!check(p.buffer.bytes, p.buffer.size, p.crc16)) {
+        sendControl(meshtastic_XModem_Control_NAK, packetno);
+        return;
+    }
+
+    if (p.seq == packetno) {
+        spiLock->lock();
+        file.write(p.buffer.bytes, p.buffer.size);
+        packetno++;
+        // It may have been the one the blocks after it were waiting for
+        for (uint8_t slot = packetno % window; earlySeq[slot] == packetno; slot = packetno % window) {
+            file.write(early[slot], earlySize[slot]);
+            earlySeq[slot] = 0;
+            packetno++;
+        }
+        spiLock->unlock();
+        sendControl(meshtastic_XModem_Control_ACK, packetno - 1);
+    } else if (p.seq > packetno && p.seq < packetno + window) {
+        // One before it got lost, keep this one and ask for only that one again
+        uint8_t slot = p.seq % window;
+        memcpy(early[slot], p.buffer.bytes, p.buffer.size);
+        earlySize[slot] = p.buffer.size;
+        earlySeq[slot] = p.seq;
+        sendControl(meshtastic_XModem_Control_NAK, packetno);
+    } else if (p.seq < packetno) {
+        sendControl(meshtastic_XModem_Control_ACK, packetno - 1); // Retransmitted before our ACK got there
+    } else {
+        sendControl(meshtastic_XModem_Control_NAK, packetno);
+    }
+}
+
+void XModemAdapter::endWindow()
+{
+    delete[] early;
+    early = NULL;
+    window = 1;
+    sendQueueLen = 0;
+}
+
 void XModemAdapter::handlePacket(meshtastic_XModem xmodemPacket)
 {
     switch (xmodemPacket.control) {
@@ -119,14 +210,25 @@ void XModemAdapter::handlePacket(meshtastic_XModem xmodemPacket)
     case meshtastic_XModem_Control_STX:
         if ((xmodemPacket.seq == 0) && !isReceiving && !isTransmitting) {
             // NULL packet has the destination filename
-            memcpy(filename, &xmodemPacket.buffer.bytes, xmodemPacket.buffer.size);
+            // Terminated, a shorter name must not end with what is left of the one before it
+            size_t nameLen = xmodemPacket.buffer.size < sizeof(filename) ? xmodemPacket.buffer.size : sizeof(filename) - 1;
+            memcpy(filename, &xmodemPacket.buffer.bytes, nameLen);
+            filename[nameLen] = '\0';
 
             if (xmodemPacket.control == meshtastic_XModem_Control_SOH) { // Receive this file and put to Flash
                 spiLock->lock();
                 file = FSCom.open(filename, FILE_O_WRITE);
+                fileManifestChanged();
                 spiLock->unlock();
                 if (file) {
-                    sendControl(meshtastic_XModem_Control_ACK);
+                    window = requestedWindow(xmodemPacket);
+                    if (window > 1) {
+                        early = new (std::nothrow) pb_byte_t[window][sizeof(meshtastic_XModem_buffer_t::bytes)];
+                        if (!early)
+                            window = 1; // Short of RAM, the client falls back to one block at a time
+                        memset(earlySeq, 0, sizeof(earlySeq));
+                    }
+                    sendControl(meshtastic_XModem_Control_ACK, 0, window > 1 ? XMODEM_WINDOW_MAGIC | window : 0);
                     isReceiving = true;
                     packetno = 1;
                     break;
@@ -142,6 +244,16 @@ void XModemAdapter::handlePacket(meshtastic_XModem xmodemPacket)
                 if (file) {
                     packetno = 1;
                     isTransmitting = true;
+                    window = requestedWindow(xmodemPacket);
+                    if (window > 1) {
+                        spiLock->lock();
+                        lastBlock = file.size() / sizeof(meshtastic_XModem_buffer_t::bytes) + 1;
+                        spiLock->unlock();
+                        nextToQueue = 1;
+                        sendQueueLen = 0;
+                        fillWindow();
+                        break;
+                    }
                     xmodemStore = meshtastic_XModem_init_zero;
                     xmodemStore.control = meshtastic_XModem_Control_SOH;
                     xmodemStore.seq = packetno;
@@ -162,7 +274,10 @@ void XModemAdapter::handlePacket(meshtastic_XModem xmodemPacket)
                 break;
             }
         } else {
-            if (isReceiving) {
+            if (isReceiving && window > 1) {
+                receiveInWindow(xmodemPacket);
+                break;
+            } else if (isReceiving) {
                 // normal file data packet
                 if ((xmodemPacket.seq == packetno) &&
                     check(xmodemPacket.buffer.bytes, xmodemPacket.buffer.size, xmodemPacket.crc16)) {
@@ -191,8 +306,11 @@ void XModemAdapter::handlePacket(meshtastic_XModem xmodemPacket)
         spiLock->lock();
         file.flush();
         file.close();
+        if (isReceiving)
+            fileManifestChanged(); // It has grown since it was opened
         spiLock->unlock();
         isReceiving = false;
+        endWindow();
         break;
     case meshtastic_XModem_Control_CAN:
         // Cancel transmission and remove file
@@ -201,13 +319,34 @@ void XModemAdapter::handlePacket(meshtastic_XModem xmodemPacket)
         file.flush();
         file.close();
 
-        FSCom.remove(filename);
+        if (!isTransmitting) { // A cancelled download leaves the file alone
+            FSCom.remove(filename);
+            fileManifestChanged();
+        }
         spiLock->unlock();
         isReceiving = false;
+        isTransmitting = false;
+        endWindow();
         break;
     case meshtastic_XModem_Control_ACK:
         // Acknowledge Send the next packet
-        if (isTransmitting) {
+        if (isTransmitting && window > 1) {
+            if (xmodemPacket.seq < packetno || xmodemPacket.seq >= nextToQueue)
+                break; // Stale, a later ACK already covered it
+            retrans = MAXRETRANS;
+            packetno = xmodemPacket.seq + 1;
+            if (packetno > lastBlock) {
+                sendControl(meshtastic_XModem_Control_EOT);
+                spiLock->lock();
+                file.close();
+                spiLock->unlock();
+                LOG_INFO("XModem: Finished send file %s", filename);
+                isTransmitting = false;
+                endWindow();
+                break;
+            }
+            fillWindow();
+        } else if (isTransmitting) {
             if (isEOT) {
                 sendControl(meshtastic_XModem_Control_EOT);
                 spiLock->lock();
@@ -240,6 +379,14 @@ void XModemAdapter::handlePacket(meshtastic_XModem xmodemPacket)
         break;
     case meshtastic_XModem_Control_NAK:
         // Negative acknowledge. Send the same buffer again
+        if (isTransmitting && window > 1) {
+            if (xmodemPacket.seq < packetno || xmodemPacket.seq >= nextToQueue)
+                break; // Stale, a later ACK or NAK already covered it
+            if (xmodemPacket.seq > packetno) {
+                retrans = MAXRETRANS; // Everything before it arrived
+                packetno = xmodemPacket.seq;
+            }
+        }
         if (isTransmitting) {
             if (--retrans <= 0) {
                 sendControl(meshtastic_XModem_Control_CAN);
@@ -248,6 +395,13 @@ void XModemAdapter::handlePacket(meshtastic_XModem xmodemPacket)
                 spiLock->unlock();
                 LOG_INFO("XModem: Retransmit timeout, cancel file %s", filename);
                 isTransmitting = false;
+                endWindow();
+                break;
+            }
+            if (window > 1) {
+                // Only the block asked for goes again, the ones after it were received and are waiting for it
+                queueBlock(xmodemPacket.seq);
+                fillWindow();
                 break;
             }
             xmodemStore = meshtastic_XModem_init_zero;
@@ -38,6 +38,18 @@
 
 #define MAXRETRANS 25
 
+// Blocks a client may have outstanding without an ACK, when it asks for a window.  Receiving in a window sets aside a block
+// of RAM for each, to hold blocks that arrive ahead of a lost one
+#ifndef XMODEM_MAX_WINDOW
+#define XMODEM_MAX_WINDOW 8
+#endif
+
+// A client asks for a window by putting this, ORed with the number of blocks it wants outstanding, in the crc16 of the seq 0
+// packet that names the file.  We ACK an upload request with the window we granted the same way, older firmware ACKs with 0
+// and the client then falls back to one block at a time.  In a window every ACK and NAK carries a seq: an ACK says all blocks
+// up to seq arrived, a NAK asks for block seq again and says all blocks before it arrived.
+#define XMODEM_WINDOW_MAGIC 0x5700
+
 #ifdef FSCom
 
 class XModemAdapter
@@ -59,8 +71,22 @@ class XModemAdapter
 
     int retrans = MAXRETRANS;
 
+    // Receiving: the seq we need next. Transmitting: the oldest block not ACKed yet
     uint16_t packetno = 0;
 
+    uint8_t window = 1; // 1 is classic stop-and-wait
+
+    // Transmitting in a window: blocks are read from the file only when the phone API takes them
+    uint16_t lastBlock = 0;   // The short (maybe empty) one that ends the file
+    uint16_t nextToQueue = 0; // The first block never sent
+    uint16_t sendQueue[XMODEM_MAX_WINDOW * 2];
+    uint8_t sendQueueHead = 0, sendQueueLen = 0;
+
+    // Receiving in a window: blocks that arrived ahead of packetno, held in slot seq % window until it arrives
+    pb_byte_t (*early)[sizeof(meshtastic_XModem_buffer_t::bytes)] = NULL;
+    uint8_t earlySize[XMODEM_MAX_WINDOW];
+    uint16_t earlySeq[XMODEM_MAX_WINDOW];
+
 #if defined(ARCH_NRF52) || defined(ARCH_STM32WL)
     File file = File(FSCom);
 #else
@@ -73,7 +99,15 @@ class XModemAdapter
     meshtastic_XModem xmodemStore = meshtastic_XModem_init_zero;
     unsigned short crc16_ccitt(const pb_byte_t *buffer, int length);
     int check(const pb_byte_t *buf, int sz, unsigned short tcrc);
-    void sendControl(meshtastic_XModem_Control c);
+    void sendControl(meshtastic_XModem_Control c, uint16_t seq = 0, uint16_t crc16 = 0);
+
+  private:
+    static uint8_t requestedWindow(const meshtastic_XModem &p);
+    void readBlock(uint16_t seq);
+    void queueBlock(uint16_t seq);
+    void fillWindow();
+    void receiveInWindow(const meshtastic_XModem &p);
+    void endWindow();
 };
 
 extern XModemAdapter xModem;
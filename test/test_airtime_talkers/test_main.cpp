@@ -0,0 +1,121 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "airtime.h"
+
+namespace
+{
+
+uint32_t nextRandom(uint32_t &state)
+{
+    state = state * 1664525 + 1013904223;
+    return state >> 8;
+}
+
+const AirtimeTalkers::Entry *find(const AirtimeTalkers::Entry *entries, uint8_t n, uint32_t key)
+{
+    for (uint8_t i = 0; i < n; i++)
+        if (entries[i].key == key)
+            return &entries[i];
+    return NULL;
+}
+
+} // namespace
+
+void test_exactWhileRoomLeft()
+{
+    AirtimeTalkers talkers;
+    for (uint32_t key = 1; key <= AIRTIME_TOP_TALKERS; key++)
+        for (uint32_t i = 0; i < key; i++)
+            talkers.add(key, 100);
+
+    AirtimeTalkers::Entry sorted[AIRTIME_TOP_TALKERS];
+    TEST_ASSERT_EQUAL_UINT8(AIRTIME_TOP_TALKERS, talkers.getSorted(sorted));
+    for (uint8_t i = 0; i < AIRTIME_TOP_TALKERS; i++) {
+        TEST_ASSERT_EQUAL_UINT32(AIRTIME_TOP_TALKERS - i, sorted[i].key);
+        TEST_ASSERT_EQUAL_UINT32((AIRTIME_TOP_TALKERS - i) * 100, sorted[i].ms);
+        TEST_ASSERT_EQUAL_UINT32(0, sorted[i].errorMs);
+    }
+}
+
+// One chatty node among many quiet ones that between them overflow the list, it must stay and its airtime be right
+void test_heavyHitterKept()
+{
+    const uint32_t chatty = 0xdead;
+    AirtimeTalkers talkers;
+    uint32_t state = 3, chattyMs = 0;
+    for (int i = 0; i < 5000; i++) {
+        uint32_t ms = 50 + nextRandom(state) % 400;
+        if (i % 3 == 0) {
+            talkers.add(chatty, ms);
+            chattyMs += ms;
+        } else {
+            talkers.add(0x1000 + nextRandom(state) % 200, ms);
+        }
+    }
+
+    AirtimeTalkers::Entry sorted[AIRTIME_TOP_TALKERS];
+    uint8_t n = talkers.getSorted(sorted);
+    TEST_ASSERT_EQUAL_UINT8(AIRTIME_TOP_TALKERS, n);
+    TEST_ASSERT_EQUAL_UINT32(chatty, sorted[0].key);
+    // Never underestimated, and the overestimate is bounded by what was inherited
+    TEST_ASSERT_TRUE(sorted[0].ms >= chattyMs);
+    TEST_ASSERT_TRUE(sorted[0].ms - sorted[0].errorMs <= chattyMs);
+    for (uint8_t i = 1; i < n; i++)
+        TEST_ASSERT_TRUE(sorted[i - 1].ms >= sorted[i].ms);
+}
+
+void test_decay()
+{
+    AirtimeTalkers talkers;
+    talkers.add(1, 1000);
+    talkers.add(2, 1);
+    talkers.decay();
+
+    AirtimeTalkers::Entry sorted[AIRTIME_TOP_TALKERS];
+    uint8_t n = talkers.getSorted(sorted);
+    TEST_ASSERT_EQUAL_UINT8(1, n); // 2 decayed away
+    TEST_ASSERT_EQUAL_UINT32(500, sorted[0].ms);
+    TEST_ASSERT_EQUAL_UINT32(500, talkers.getTotalMs());
+    TEST_ASSERT_NULL(find(sorted, n, 2));
+
+    // A node that went quiet is overtaken by one that is busy now
+    for (int i = 0; i < 3; i++) {
+        talkers.add(3, 200);
+        talkers.decay();
+    }
+    n = talkers.getSorted(sorted);
+    TEST_ASSERT_EQUAL_UINT32(3, sorted[0].key);
+    TEST_ASSERT_NOT_NULL(find(sorted, n, 1));
+}
+
+void test_portNames()
+{
+    char buf[12];
+    TEST_ASSERT_EQUAL_STRING("Telemetry", AirTime::getPortName(meshtastic_PortNum_TELEMETRY_APP, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("Encrypted", AirTime::getPortName(AIRTIME_PORT_ENCRYPTED, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("Port 300", AirTime::getPortName(300, buf, sizeof(buf)));
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+    UNITY_BEGIN();
+    RUN_TEST(test_exactWhileRoomLeft);
+    RUN_TEST(test_heavyHitterKept);
+    RUN_TEST(test_decay);
+    RUN_TEST(test_portNames);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
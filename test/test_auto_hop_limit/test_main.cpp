@@ -0,0 +1,147 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "gps/RTC.h"
+#include "mesh/AutoHopLimit.h"
+#include "mesh/CryptoEngine.h"
+#include "mesh/NodeDB.h"
+
+#define CONFIGURED 5
+
+namespace
+{
+
+const NodeNum base = 0x10000;
+
+// A node heard agoSecs ago, hops relays away (or with no count if hops is negative)
+void addNode(NodeNum n, int hops, uint32_t agoSecs = 60, bool viaMqtt = false)
+{
+    meshtastic_User user = meshtastic_User_init_zero;
+    nodeDB->updateUser(n, user);
+    meshtastic_NodeInfoLite *lite = nodeDB->getMeshNode(n);
+    TEST_ASSERT_NOT_NULL(lite);
+    lite->last_heard = getTime() - agoSecs;
+    lite->has_hops_away = hops >= 0;
+    lite->hops_away = hops >= 0 ? hops : 0;
+    lite->via_mqtt = viaMqtt;
+}
+
+meshtastic_MeshPacket packetTo(NodeNum to, uint8_t hopLimit = CONFIGURED)
+{
+    meshtastic_MeshPacket p = meshtastic_MeshPacket_init_zero;
+    p.from = nodeDB->getNodeNum();
+    p.to = to;
+    p.hop_limit = hopLimit;
+    p.which_payload_variant = meshtastic_MeshPacket_decoded_tag;
+    p.decoded.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
+    return p;
+}
+
+uint8_t hopLimitTo(NodeNum to, uint8_t hopLimit = CONFIGURED)
+{
+    AutoHopLimit a; // A new one each time, so the broadcast radius isn't reused from an earlier test
+    meshtastic_MeshPacket p = packetTo(to, hopLimit);
+    return a.forPacket(&p, CONFIGURED);
+}
+
+} // namespace
+
+void setUp()
+{
+    nodeDB->resetNodes();
+}
+
+void tearDown() {}
+
+// A unicast gets the relays it needs plus the margin, and the configured limit when we don't know enough
+void test_unicast()
+{
+    addNode(base + 1, 0);
+    addNode(base + 2, 2);
+    addNode(base + 3, 4);
+    addNode(base + 4, -1);
+    addNode(base + 5, 0, AUTO_HOP_FRESH_SECS + 60);
+    addNode(base + 6, 0, 60, true);
+
+    TEST_ASSERT_EQUAL(AUTO_HOP_MARGIN, hopLimitTo(base + 1));
+    TEST_ASSERT_EQUAL(2 + AUTO_HOP_MARGIN, hopLimitTo(base + 2));
+    TEST_ASSERT_EQUAL(CONFIGURED, hopLimitTo(base + 3)); // Never more than configured
+    TEST_ASSERT_EQUAL(CONFIGURED, hopLimitTo(base + 4)); // No count
+    TEST_ASSERT_EQUAL(CONFIGURED, hopLimitTo(base + 5)); // Stale
+    TEST_ASSERT_EQUAL(CONFIGURED, hopLimitTo(base + 6)); // Through MQTT
+    TEST_ASSERT_EQUAL(CONFIGURED, hopLimitTo(base + 99)); // Unknown
+}
+
+// A limit somebody chose, and traceroutes, are left alone
+void test_leftAlone()
+{
+    addNode(base + 1, 0);
+    TEST_ASSERT_EQUAL(7, hopLimitTo(base + 1, 7));
+    TEST_ASSERT_EQUAL(0, hopLimitTo(base + 1, 0));
+
+    AutoHopLimit a;
+    meshtastic_MeshPacket p = packetTo(base + 1);
+    p.decoded.portnum = meshtastic_PortNum_TRACEROUTE_APP;
+    TEST_ASSERT_EQUAL(CONFIGURED, a.forPacket(&p, CONFIGURED));
+}
+
+// A broadcast reaches as far as the furthest node we heard lately, once we heard enough of them
+void test_broadcastRadius()
+{
+    addNode(base + 1, 0);
+    addNode(base + 2, 2);
+    TEST_ASSERT_EQUAL(CONFIGURED, hopLimitTo(NODENUM_BROADCAST));
+
+    addNode(base + 3, 1);
+    addNode(base + 4, 4, AUTO_HOP_FRESH_SECS + 60); // Stale, doesn't widen it
+    addNode(base + 5, 4, 60, true);                 // Nor does MQTT
+    TEST_ASSERT_EQUAL(2, hopLimitTo(NODENUM_BROADCAST));
+
+    // Only neighbours still lets one relay pass it on
+    nodeDB->resetNodes();
+    for (NodeNum n = base + 1; n <= base + 3; n++)
+        addNode(n, 0);
+    TEST_ASSERT_EQUAL(1, hopLimitTo(NODENUM_BROADCAST));
+}
+
+// NeighborInfo only ever brings a hop count down
+void test_noteHopsAway()
+{
+    addNode(base + 1, -1);
+    addNode(base + 2, 3);
+    addNode(base + 3, 1);
+    nodeDB->noteHopsAway(base + 1, 2);
+    nodeDB->noteHopsAway(base + 2, 2);
+    nodeDB->noteHopsAway(base + 3, 2);
+    TEST_ASSERT_EQUAL(2, nodeDB->getMeshNode(base + 1)->hops_away);
+    TEST_ASSERT_TRUE(nodeDB->getMeshNode(base + 1)->has_hops_away);
+    TEST_ASSERT_EQUAL(2, nodeDB->getMeshNode(base + 2)->hops_away);
+    TEST_ASSERT_EQUAL(1, nodeDB->getMeshNode(base + 3)->hops_away);
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+    if (!cryptLock)
+        cryptLock = new concurrency::Lock(); // Normally made by the Router
+    nodeDB = new NodeDB();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_unicast);
+    RUN_TEST(test_leftAlone);
+    RUN_TEST(test_broadcastRadius);
+    RUN_TEST(test_noteHopsAway);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
@@ -0,0 +1,392 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "PortduinoGlue.h"
+#include "mesh/Channels.h"
+#include "mesh/CryptoEngine.h"
+#include "mesh/MeshPacketQueue.h"
+#include "mesh/NodeDB.h"
+#include "mesh/PacketHistory.h"
+#include "mesh/Router.h"
+#include "mesh/SinglePortModule.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+// How many times each benchmark goes over its table, enough for tens of milliseconds per result on a desktop
+#define HISTORY_ROUNDS 1000
+#define NODEDB_LOOKUPS 200000
+#define QUEUE_ROUNDS 500
+#define DECODE_ROUNDS 500
+#define PKI_ROUNDS 200
+#define DISPATCH_ROUNDS 2000
+
+namespace
+{
+
+uint64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Every result is one line of "BENCH " followed by a JSON object, so scripts can pick them out of the test output and
+// compare them with an earlier run
+void report(const char *name, uint32_t size, uint32_t ops, uint64_t ns)
+{
+    printf("BENCH {\"name\":\"%s\",\"size\":%u,\"ops\":%u,\"ns_per_op\":%.1f}\n", name, size, ops, (double)ns / ops);
+}
+
+// Deterministic, so every run measures the same tables
+uint32_t nextRandom(uint32_t &state)
+{
+    state = state * 1664525 + 1013904223;
+    return state;
+}
+
+meshtastic_MeshPacket makePacket(NodeNum from, PacketId id)
+{
+    meshtastic_MeshPacket p = meshtastic_MeshPacket_init_zero;
+    p.from = from;
+    p.to = NODENUM_BROADCAST;
+    p.id = id;
+    p.hop_limit = p.hop_start = 3;
+    p.which_payload_variant = meshtastic_MeshPacket_decoded_tag;
+    p.decoded.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
+    p.decoded.payload.size =
+        snprintf((char *)p.decoded.payload.bytes, sizeof(p.decoded.payload.bytes), "Benchmark packet number %u", id);
+    return p;
+}
+
+// Leave just our own node plus size - 1 others in the NodeDB
+void fillNodeDB(uint32_t size, NodeNum base)
+{
+    nodeDB->resetNodes();
+    for (uint32_t i = 1; i < size; i++) {
+        meshtastic_User user = meshtastic_User_init_zero;
+        snprintf(user.long_name, sizeof(user.long_name), "Bench %u", i);
+        nodeDB->updateUser(base + i, user);
+    }
+}
+
+// Give all count channels a different PSK but the same hash, so every one of them is a candidate for every packet
+void setupChannels(uint8_t count)
+{
+    uint32_t seed = 1;
+    for (uint8_t i = 0; i < count; i++) {
+        meshtastic_Channel &ch = channelFile.channels[i];
+        ch = meshtastic_Channel_init_zero;
+        ch.index = i;
+        ch.has_settings = true;
+        ch.role = i == 0 ? meshtastic_Channel_Role_PRIMARY : meshtastic_Channel_Role_SECONDARY;
+        strcpy(ch.settings.name, "bench");
+        ch.settings.psk.size = 16;
+        uint8_t x = 0;
+        for (int b = 0; b < 15; b++) {
+            ch.settings.psk.bytes[b] = nextRandom(seed) >> 24;
+            x ^= ch.settings.psk.bytes[b];
+        }
+        ch.settings.psk.bytes[15] = x ^ 0x5a;
+    }
+    channelFile.channels_count = count;
+    channels.onConfigChanged();
+}
+
+// Counts what it is handed, on one port or (with MESHMODULE_ANY_PORT) on all of them
+class CountingModule : public SinglePortModule
+{
+  public:
+    uint32_t handled = 0;
+    CountingModule(int port)
+        : SinglePortModule("bench", port == MESHMODULE_ANY_PORT ? meshtastic_PortNum_UNKNOWN_APP : (meshtastic_PortNum)port),
+          anyPort(port == MESHMODULE_ANY_PORT)
+    {
+    }
+
+  protected:
+    bool anyPort;
+    virtual bool wantPacket(const meshtastic_MeshPacket *p) override { return anyPort || SinglePortModule::wantPacket(p); }
+    virtual int getDispatchPort() const override { return anyPort ? MESHMODULE_ANY_PORT : ourPortNum; }
+    virtual ProcessMessage handleReceived(const meshtastic_MeshPacket &mp) override
+    {
+        handled++;
+        return ProcessMessage::CONTINUE;
+    }
+};
+
+} // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_packetHistory(void)
+{
+    const uint32_t sizes[] = {32, 96, 200};
+    for (uint32_t size : sizes) {
+        PacketHistory history(size);
+        TEST_ASSERT_TRUE(history.initOk());
+
+        // Half full, about what a busy mesh keeps in it
+        std::vector<meshtastic_MeshPacket> seen, unseen;
+        for (uint32_t i = 0; i < size / 2; i++) {
+            seen.push_back(makePacket(0x1000 + i % 97, i + 1));
+            unseen.push_back(makePacket(0x1000 + i % 97, size + i + 1));
+        }
+        for (auto &p : seen)
+            history.wasSeenRecently(&p);
+
+        uint32_t hits = 0;
+        uint64_t start = nowNs();
+        for (uint32_t r = 0; r < HISTORY_ROUNDS; r++)
+            for (auto &p : seen)
+                hits += history.wasSeenRecently(&p);
+        report("history_seen", size, HISTORY_ROUNDS * seen.size(), nowNs() - start);
+        TEST_ASSERT_TRUE(hits > 0);
+
+        hits = 0;
+        start = nowNs();
+        for (uint32_t r = 0; r < HISTORY_ROUNDS; r++)
+            for (auto &p : unseen)
+                hits += history.wasSeenRecently(&p, false);
+        report("history_unseen", size, HISTORY_ROUNDS * unseen.size(), nowNs() - start);
+        TEST_ASSERT_EQUAL_UINT32(0, hits);
+    }
+}
+
+void test_nodeDBLookup(void)
+{
+    const uint32_t sizes[] = {10, MAX_NUM_NODES / 2, MAX_NUM_NODES};
+    for (uint32_t size : sizes) {
+        const NodeNum base = 0x20000;
+        fillNodeDB(size, base);
+        TEST_ASSERT_EQUAL_UINT32(size, nodeDB->getNumMeshNodes());
+
+        uint32_t seed = size;
+        std::vector<NodeNum> present, absent;
+        for (uint32_t i = 0; i < 1024; i++) {
+            present.push_back(base + 1 + nextRandom(seed) % (size - 1));
+            absent.push_back(0x7000000 + nextRandom(seed) % 0x100000);
+        }
+
+        uint32_t found = 0;
+        uint64_t start = nowNs();
+        for (uint32_t i = 0; i < NODEDB_LOOKUPS; i++)
+            found += nodeDB->getMeshNode(present[i % present.size()]) != NULL;
+        report("nodedb_hit", size, NODEDB_LOOKUPS, nowNs() - start);
+        TEST_ASSERT_EQUAL_UINT32(NODEDB_LOOKUPS, found);
+
+        found = 0;
+        start = nowNs();
+        for (uint32_t i = 0; i < NODEDB_LOOKUPS; i++)
+            found += nodeDB->getMeshNode(absent[i % absent.size()]) != NULL;
+        report("nodedb_miss", size, NODEDB_LOOKUPS, nowNs() - start);
+        TEST_ASSERT_EQUAL_UINT32(0, found);
+    }
+}
+
+void test_packetQueue(void)
+{
+    static const meshtastic_MeshPacket_Priority priorities[] = {
+        meshtastic_MeshPacket_Priority_BACKGROUND, meshtastic_MeshPacket_Priority_DEFAULT,
+        meshtastic_MeshPacket_Priority_RELIABLE, meshtastic_MeshPacket_Priority_HIGH};
+    const uint32_t sizes[] = {16, 64, 256};
+    for (uint32_t size : sizes) {
+        MeshPacketQueue queue(size);
+        std::vector<meshtastic_MeshPacket> packets;
+        std::vector<uint32_t> order;
+        uint32_t seed = size;
+        for (uint32_t i = 0; i < size; i++) {
+            packets.push_back(makePacket(0x3000 + i % 13, i + 1));
+            packets.back().priority = priorities[i % 4];
+            order.push_back(i);
+        }
+        for (uint32_t i = size - 1; i > 0; i--)
+            std::swap(order[i], order[nextRandom(seed) % (i + 1)]);
+
+        uint64_t enqueueNs = 0, dequeueNs = 0, removeNs = 0;
+        uint32_t enqueued = 0, dequeued = 0, removed = 0;
+        for (uint32_t r = 0; r < QUEUE_ROUNDS; r++) {
+            // Never more than fit, a full queue would hand its victims back to the packet pool
+            uint64_t start = nowNs();
+            for (auto &p : packets)
+                enqueued += queue.enqueue(&p, 100);
+            enqueueNs += nowNs() - start;
+
+            start = nowNs();
+            while (queue.dequeue())
+                dequeued++;
+            dequeueNs += nowNs() - start;
+
+            for (auto &p : packets)
+                queue.enqueue(&p, 100);
+            start = nowNs();
+            for (uint32_t i : order)
+                removed += queue.remove(packets[i].from, packets[i].id) != NULL;
+            removeNs += nowNs() - start;
+        }
+        report("queue_enqueue", size, QUEUE_ROUNDS * size, enqueueNs);
+        report("queue_dequeue", size, QUEUE_ROUNDS * size, dequeueNs);
+        report("queue_remove", size, QUEUE_ROUNDS * size, removeNs);
+        TEST_ASSERT_EQUAL_UINT32(QUEUE_ROUNDS * size, enqueued);
+        TEST_ASSERT_EQUAL_UINT32(QUEUE_ROUNDS * size, dequeued);
+        TEST_ASSERT_EQUAL_UINT32(QUEUE_ROUNDS * size, removed);
+        TEST_ASSERT_TRUE(queue.empty());
+    }
+}
+
+void test_perhapsDecode(void)
+{
+    const uint8_t counts[] = {1, 4, MAX_NUM_CHANNELS};
+    for (uint8_t count : counts) {
+        setupChannels(count);
+
+        // Sent on the last channel, so a decode without a hint has to try all of them.  The senders are 1024 apart so they
+        // share a slot in the channel hint table and keep evicting each other's hint.
+        std::vector<meshtastic_MeshPacket> encoded;
+        for (uint32_t s = 0; s < 4; s++) {
+            meshtastic_MeshPacket p = makePacket((s + 1) << 10, 100 + s);
+            p.channel = count - 1;
+            TEST_ASSERT_EQUAL(meshtastic_Routing_Error_NONE, perhapsEncode(&p));
+            encoded.push_back(p);
+        }
+
+        uint32_t decoded = 0;
+        uint64_t start = nowNs();
+        for (uint32_t r = 0; r < DECODE_ROUNDS; r++) {
+            for (auto &e : encoded) {
+                meshtastic_MeshPacket p = e;
+                decoded += perhapsDecode(&p) == DECODE_SUCCESS && p.channel == count - 1;
+            }
+        }
+        report("decode_unhinted", count, DECODE_ROUNDS * encoded.size(), nowNs() - start);
+        TEST_ASSERT_EQUAL_UINT32(DECODE_ROUNDS * encoded.size(), decoded);
+
+        decoded = 0;
+        start = nowNs();
+        for (uint32_t r = 0; r < DECODE_ROUNDS; r++) {
+            meshtastic_MeshPacket p = encoded[0];
+            decoded += perhapsDecode(&p) == DECODE_SUCCESS;
+        }
+        report("decode_hinted", count, DECODE_ROUNDS, nowNs() - start);
+        TEST_ASSERT_EQUAL_UINT32(DECODE_ROUNDS, decoded);
+    }
+}
+
+void test_perhapsEncode(void)
+{
+    setupChannels(1);
+    nodeDB->resetNodes();
+
+    // One more peer than the shared key cache holds, so going round all of them misses the cache every time
+    const uint32_t peers = MAX_CACHED_SHARED_KEYS + 1;
+    const NodeNum base = 0x40000;
+    for (uint32_t i = 0; i < peers; i++) {
+        meshtastic_User user = meshtastic_User_init_zero;
+        uint8_t privateKey[32];
+        snprintf(user.long_name, sizeof(user.long_name), "Peer %u", i);
+        crypto->generateKeyPair(user.public_key.bytes, privateKey);
+        user.public_key.size = 32;
+        nodeDB->updateUser(base + i, user);
+    }
+    uint8_t publicKey[32];
+    crypto->generateKeyPair(publicKey, config.security.private_key.bytes); // Last, this leaves our own key in the engine
+    config.security.private_key.size = 32;
+    owner.is_licensed = false;
+
+    uint32_t ok = 0;
+    uint64_t start = nowNs();
+    for (uint32_t r = 0; r < PKI_ROUNDS; r++) {
+        meshtastic_MeshPacket p = makePacket(nodeDB->getNodeNum(), r + 1);
+        ok += perhapsEncode(&p) == meshtastic_Routing_Error_NONE;
+    }
+    report("encode_channel", 1, PKI_ROUNDS, nowNs() - start);
+    TEST_ASSERT_EQUAL_UINT32(PKI_ROUNDS, ok);
+
+    ok = 0;
+    start = nowNs();
+    for (uint32_t r = 0; r < PKI_ROUNDS; r++) {
+        meshtastic_MeshPacket p = makePacket(nodeDB->getNodeNum(), r + 1);
+        p.to = base;
+        ok += perhapsEncode(&p) == meshtastic_Routing_Error_NONE && p.pki_encrypted;
+    }
+    report("encode_pki_cached", 1, PKI_ROUNDS, nowNs() - start);
+    TEST_ASSERT_EQUAL_UINT32(PKI_ROUNDS, ok);
+
+    ok = 0;
+    start = nowNs();
+    for (uint32_t r = 0; r < PKI_ROUNDS; r++) {
+        meshtastic_MeshPacket p = makePacket(nodeDB->getNodeNum(), r + 1);
+        p.to = base + r % peers;
+        ok += perhapsEncode(&p) == meshtastic_Routing_Error_NONE && p.pki_encrypted;
+    }
+    report("encode_pki_uncached", peers, PKI_ROUNDS, nowNs() - start);
+    TEST_ASSERT_EQUAL_UINT32(PKI_ROUNDS, ok);
+}
+
+// The cost of finding the modules for a packet, which shouldn't depend on how many modules there are
+void test_callModules(void)
+{
+    setupChannels(1);
+    nodeDB->resetNodes();
+
+    const uint32_t counts[] = {4, 32, 128};
+    for (uint32_t count : counts) {
+        // One module on any port, the rest spread over a quarter as many ports, with packets on every one of those ports
+        // plus one port nobody registered for
+        const uint32_t ports = count / 4;
+        std::vector<CountingModule *> modules;
+        modules.push_back(new CountingModule(MESHMODULE_ANY_PORT));
+        for (uint32_t i = 1; i < count; i++)
+            modules.push_back(new CountingModule(1 + i % ports));
+
+        uint64_t start = nowNs();
+        uint32_t sent = 0;
+        for (uint32_t r = 0; r < DISPATCH_ROUNDS; r++) {
+            for (uint32_t port = 1; port <= ports + 1; port++) {
+                meshtastic_MeshPacket p = makePacket(0x1234, r + 1);
+                p.decoded.portnum = (meshtastic_PortNum)port;
+                MeshModule::callModules(p, RX_SRC_RADIO);
+                sent++;
+            }
+        }
+        report("call_modules", count, sent, nowNs() - start);
+
+        TEST_ASSERT_EQUAL_UINT32(sent, modules[0]->handled);
+        for (uint32_t i = 1; i < count; i++) {
+            TEST_ASSERT_EQUAL_UINT32(DISPATCH_ROUNDS, modules[i]->handled);
+            delete modules[i];
+        }
+        delete modules[0];
+    }
+}
+
+void setup()
+{
+    settingsMap[logoutputlevel] = level_warn; // Per packet debug logging would be most of what we measure
+    initializeTestEnvironment();
+    if (!cryptLock)
+        cryptLock = new concurrency::Lock(); // Normally made by the Router
+    nodeDB = new NodeDB();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_packetHistory);
+    RUN_TEST(test_nodeDBLookup);
+    RUN_TEST(test_packetQueue);
+    RUN_TEST(test_perhapsDecode);
+    RUN_TEST(test_perhapsEncode);
+    RUN_TEST(test_callModules);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This benchmark only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
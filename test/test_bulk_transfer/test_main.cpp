@@ -0,0 +1,200 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "PortduinoGlue.h"
+#include "mesh/BulkTransfer.h"
+
+#include <algorithm>
+#include <string.h>
+#include <vector>
+
+namespace
+{
+
+std::vector<uint8_t> makeObject(size_t len)
+{
+    std::vector<uint8_t> object(len);
+    for (size_t i = 0; i < len; i++)
+        object[i] = (uint8_t)(i * 7 + i / 251);
+    return object;
+}
+
+/**
+ * Send object through a window pair, dropping the fragments for which drop returns true (each is asked once per send).
+ * The receiver ACKs the way BulkTransferModule does; a round with nothing to send stands for a timeout.
+ * @return how many fragments went out, or 0 if it never finished
+ */
+template <typename Drop> size_t transfer(const std::vector<uint8_t> &object, std::vector<uint8_t> &received, Drop drop)
+{
+    BulkSendWindow tx;
+    tx.start(BulkTransfer::fragmentCount(object.size()));
+    std::vector<uint8_t> buffer(BULK_WINDOW * BULK_FRAGMENT_LEN);
+    BulkReceiveWindow rx;
+    rx.start(buffer.data());
+    received.clear();
+
+    size_t sent = 0, sinceAck = 0;
+    for (int round = 0; round < 1000 && !tx.done(); round++) {
+        int32_t seq = tx.take();
+        if (seq < 0) {
+            tx.onTimeout();
+            continue;
+        }
+        size_t offset = seq * BULK_FRAGMENT_LEN;
+        size_t len = std::min<size_t>(BULK_FRAGMENT_LEN, object.size() - offset);
+        sent++;
+        if (drop(seq))
+            continue;
+
+        uint8_t wire[BULK_FIRST_HEADER_LEN + BULK_FRAGMENT_LEN];
+        size_t wireLen = BulkTransfer::encodeData(wire, 0x1234, seq, 300, object.size(), object.data() + offset, len);
+        BulkTransfer::Message m;
+        TEST_ASSERT_TRUE(BulkTransfer::decode(wire, wireLen, m));
+        TEST_ASSERT_EQUAL(len, m.len);
+
+        BulkReceiveWindow::Result result = rx.put(m.seq, m.data, m.len);
+        bool ack =
+            result != BulkReceiveWindow::NEW || ++sinceAck >= (BULK_WINDOW + 1) / 2 || (uint32_t)m.seq + 1 == tx.count;
+        const uint8_t *data;
+        size_t dataLen;
+        while (rx.peek(data, dataLen)) {
+            received.insert(received.end(), data, data + dataLen);
+            rx.pop();
+        }
+        ack = ack || rx.next == tx.count;
+        if (ack) {
+            sinceAck = 0;
+            uint8_t ackWire[BULK_ACK_LEN];
+            BulkTransfer::encodeAck(ackWire, 0x1234, rx.next, rx.bitmap());
+            TEST_ASSERT_TRUE(BulkTransfer::decode(ackWire, sizeof(ackWire), m));
+            TEST_ASSERT_EQUAL(BulkTransfer::ACK, m.type);
+            tx.onAck(m.seq, m.bitmap);
+        }
+    }
+    return tx.done() ? sent : 0;
+}
+
+} // namespace
+
+void test_wireFormat()
+{
+    uint8_t data[3] = {1, 2, 3};
+    uint8_t wire[BULK_FIRST_HEADER_LEN + sizeof(data)];
+    BulkTransfer::Message m;
+
+    TEST_ASSERT_EQUAL(sizeof(wire), BulkTransfer::encodeData(wire, 0xabcd, 0, 300, 0x12345678, data, sizeof(data)));
+    TEST_ASSERT_TRUE(BulkTransfer::decode(wire, sizeof(wire), m));
+    TEST_ASSERT_EQUAL(BulkTransfer::DATA, m.type);
+    TEST_ASSERT_EQUAL_UINT16(0xabcd, m.id);
+    TEST_ASSERT_EQUAL_UINT16(300, m.port);
+    TEST_ASSERT_EQUAL_UINT32(0x12345678, m.total);
+    TEST_ASSERT_EQUAL_MEMORY(data, m.data, sizeof(data));
+
+    // Only the first fragment says where it is going
+    TEST_ASSERT_EQUAL(BULK_HEADER_LEN + sizeof(data), BulkTransfer::encodeData(wire, 0xabcd, 5, 300, 0, data, sizeof(data)));
+    TEST_ASSERT_TRUE(BulkTransfer::decode(wire, BULK_HEADER_LEN + sizeof(data), m));
+    TEST_ASSERT_EQUAL_UINT16(5, m.seq);
+    TEST_ASSERT_EQUAL(sizeof(data), m.len);
+
+    TEST_ASSERT_EQUAL(3, BulkTransfer::encodeCancel(wire, 7));
+    TEST_ASSERT_TRUE(BulkTransfer::decode(wire, 3, m));
+    TEST_ASSERT_EQUAL(BulkTransfer::CANCEL, m.type);
+
+    TEST_ASSERT_FALSE(BulkTransfer::decode(wire, 2, m));
+    wire[0] = 9;
+    TEST_ASSERT_FALSE(BulkTransfer::decode(wire, 3, m));
+    BulkTransfer::encodeData(wire, 1, 0, 300, 10, data, sizeof(data));
+    TEST_ASSERT_FALSE(BulkTransfer::decode(wire, BULK_FIRST_HEADER_LEN - 1, m)); // Cut in the first fragment's header
+}
+
+void test_cleanLink()
+{
+    std::vector<uint8_t> object = makeObject(BULK_FRAGMENT_LEN * 20 + 17), received;
+    size_t sent = transfer(object, received, [](int32_t) { return false; });
+    TEST_ASSERT_EQUAL(BulkTransfer::fragmentCount(object.size()), sent); // Nothing twice
+    TEST_ASSERT_TRUE(received == object);
+}
+
+// Only what was lost goes again, not the rest of the window
+void test_selectiveRepeat()
+{
+    std::vector<uint8_t> object = makeObject(BULK_FRAGMENT_LEN * 20), received;
+    std::vector<int> tries(20);
+    size_t sent = transfer(object, received, [&](int32_t seq) { return seq % 5 == 1 && tries[seq]++ == 0; });
+    TEST_ASSERT_EQUAL(20 + 4, sent);
+    TEST_ASSERT_TRUE(received == object);
+}
+
+// Losing the tail, where no later fragment shows the hole, is left to the timeout
+void test_lostTail()
+{
+    std::vector<uint8_t> object = makeObject(BULK_FRAGMENT_LEN * 3), received;
+    bool dropped = false;
+    size_t sent = transfer(object, received, [&](int32_t seq) {
+        if (seq != 2 || dropped)
+            return false;
+        dropped = true;
+        return true;
+    });
+    TEST_ASSERT_TRUE(sent > 0);
+    TEST_ASSERT_TRUE(received == object);
+}
+
+void test_lossyLink()
+{
+    std::vector<uint8_t> object = makeObject(5000), received;
+    uint32_t state = 12345;
+    size_t sent = transfer(object, received, [&](int32_t) {
+        state = state * 1103515245 + 12345;
+        return (state >> 16) % 4 == 0; // A quarter of them
+    });
+    TEST_ASSERT_TRUE(sent > 0);
+    TEST_ASSERT_TRUE(received == object);
+}
+
+void test_receiveWindow()
+{
+    std::vector<uint8_t> buffer(BULK_WINDOW * BULK_FRAGMENT_LEN);
+    BulkReceiveWindow rx;
+    rx.start(buffer.data());
+    uint8_t data[1] = {42};
+    TEST_ASSERT_EQUAL(BulkReceiveWindow::NEW, rx.put(2, data, 1));
+    TEST_ASSERT_EQUAL(BulkReceiveWindow::DUPLICATE, rx.put(2, data, 1));
+    TEST_ASSERT_EQUAL(BulkReceiveWindow::AHEAD, rx.put(BULK_WINDOW, data, 1));
+    TEST_ASSERT_EQUAL_UINT16(0x2, rx.bitmap()); // Has 2, wants 0
+
+    const uint8_t *p;
+    size_t len;
+    TEST_ASSERT_FALSE(rx.peek(p, len));
+    rx.put(0, data, 1);
+    TEST_ASSERT_TRUE(rx.peek(p, len));
+    rx.pop();
+    TEST_ASSERT_FALSE(rx.peek(p, len));
+    TEST_ASSERT_EQUAL(BulkReceiveWindow::DUPLICATE, rx.put(0, data, 1));
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_wireFormat);
+    RUN_TEST(test_cleanLink);
+    RUN_TEST(test_selectiveRepeat);
+    RUN_TEST(test_lostTail);
+    RUN_TEST(test_lossyLink);
+    RUN_TEST(test_receiveWindow);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
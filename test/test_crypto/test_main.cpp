@@ -152,6 +152,43 @@ void test_PKC(void)
     TEST_ASSERT_EQUAL_MEMORY(expected_decrypted, decrypted, 10);
 }
 
+void test_PKC_shared_key_cache(void)
+{
+    uint8_t private_key[32];
+    uint8_t other_private_key[32];
+    meshtastic_UserLite_public_key_t public_key;
+    uint8_t expected_shared[32];
+    uint8_t radioBytes[128] __attribute__((__aligned__));
+    uint8_t decrypted[128] __attribute__((__aligned__));
+
+    uint32_t fromNode = 0x0929;
+    uint64_t packetNum = 0x13b2d662;
+    HexToBytes(public_key.bytes, "db18fc50eea47f00251cb784819a3cf5fc361882597f589f0d7ff820e8064457");
+    public_key.size = 32;
+    HexToBytes(private_key, "a00330633e63522f8a4d81ec6d9d1e6617f6c8ffd3a4c698229537d44e522277");
+    HexToBytes(other_private_key, "c8a9d5a91091ad851c668b0736c1c9a02936c0d3ad62670858088047ba057475");
+    HexToBytes(expected_shared, "777b1545c9d6f9a2");
+    HexToBytes(radioBytes, "8c646d7a2909000062d6b2136b00000040df24abfcc30a17a3d9046726099e796a1c036a792b");
+
+    // Second decrypt is served from the cache and must give the same secret
+    crypto->setDHPrivateKey(private_key);
+    TEST_ASSERT(crypto->decryptCurve25519(fromNode, public_key, packetNum, 22, radioBytes + 16, decrypted));
+    TEST_ASSERT(crypto->decryptCurve25519(fromNode, public_key, packetNum, 22, radioBytes + 16, decrypted));
+    TEST_ASSERT_EQUAL_MEMORY(expected_shared, crypto->shared_key, 8);
+
+    // A new private key must not reuse secrets derived from the old one
+    crypto->setDHPrivateKey(other_private_key);
+    TEST_ASSERT(!crypto->decryptCurve25519(fromNode, public_key, packetNum, 22, radioBytes + 16, decrypted));
+    TEST_ASSERT(memcmp(expected_shared, crypto->shared_key, 8) != 0);
+
+    // Forgetting the node forces a fresh derivation
+    crypto->setDHPrivateKey(private_key);
+    TEST_ASSERT(crypto->decryptCurve25519(fromNode, public_key, packetNum, 22, radioBytes + 16, decrypted));
+    crypto->forgetSharedKey(fromNode);
+    TEST_ASSERT(crypto->decryptCurve25519(fromNode, public_key, packetNum, 22, radioBytes + 16, decrypted));
+    TEST_ASSERT_EQUAL_MEMORY(expected_shared, crypto->shared_key, 8);
+}
+
 void test_AES_CTR(void)
 {
     uint8_t expected[32];
@@ -178,6 +215,27 @@ void test_AES_CTR(void)
     TEST_ASSERT_EQUAL_MEMORY(expected, plain, 16);
 }
 
+void test_benchmark(void)
+{
+    uint8_t private_key[32], public_key[32];
+    HexToBytes(private_key, "a00330633e63522f8a4d81ec6d9d1e6617f6c8ffd3a4c698229537d44e522277");
+    memcpy(public_key, crypto->public_key, sizeof(public_key));
+    crypto->setDHPrivateKey(private_key);
+
+    CryptoEngine::BenchmarkResult r = crypto->benchmark();
+    for (int i = 0; i < 2; i++) {
+        TEST_ASSERT(r.aesCtr[i] > 0);
+        TEST_ASSERT(r.aesCtrSoftware[i] > 0);
+    }
+    TEST_ASSERT(r.pkiEncryptUncached > r.pkiEncryptCached);
+    TEST_ASSERT(r.pkiDecryptCached > 0);
+
+    // Our own keys are untouched, and the selected backends still encrypt correctly
+    TEST_ASSERT_EQUAL_MEMORY(private_key, crypto->private_key, 32);
+    TEST_ASSERT_EQUAL_MEMORY(public_key, crypto->public_key, 32);
+    test_AES_CTR();
+}
+
 void setup()
 {
     // NOTE!!! Wait for >2 secs
@@ -192,6 +250,8 @@ void setup()
     RUN_TEST(test_DH25519);
     RUN_TEST(test_AES_CTR);
     RUN_TEST(test_PKC);
+    RUN_TEST(test_PKC_shared_key_cache);
+    RUN_TEST(test_benchmark);
     exit(UNITY_END()); // stop unit testing
 }
 
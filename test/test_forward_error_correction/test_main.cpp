@@ -0,0 +1,162 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "PortduinoGlue.h"
+#include "RTC.h"
+#include "mesh/ForwardErrorCorrection.h"
+#include "mesh/NodeDB.h"
+#include "mesh/ReedSolomon.h"
+#include "mesh/Router.h"
+
+#include <string.h>
+
+namespace
+{
+
+// A frame of len bytes, header and all, with room for the parity after it
+size_t makeFrame(uint8_t *frame, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+        frame[i] = (uint8_t)(i * 37 + 11);
+    return len;
+}
+
+meshtastic_MeshPacket makePacket(uint8_t nextHop, size_t size)
+{
+    meshtastic_MeshPacket p = meshtastic_MeshPacket_init_zero;
+    p.from = nodeDB->getNodeNum();
+    p.to = NODENUM_BROADCAST;
+    p.id = 1;
+    p.next_hop = nextHop;
+    p.which_payload_variant = meshtastic_MeshPacket_encrypted_tag;
+    p.encrypted.size = size;
+    return p;
+}
+
+// A neighbour we heard lately, which may or may not have said it reads protected frames
+void addNeighbour(NodeNum num, bool readsFec)
+{
+    meshtastic_User user = meshtastic_User_init_zero;
+    nodeDB->updateUser(num, user, 0);
+    meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(num);
+    node->last_heard = getTime();
+    node->has_hops_away = true;
+    node->hops_away = 0;
+
+    meshtastic_Data nodeInfo = meshtastic_Data_init_zero;
+    nodeInfo.has_bitfield = readsFec;
+    nodeInfo.bitfield = readsFec ? BITFIELD_READS_FEC_MASK : 0;
+    ForwardErrorCorrection::heardNodeInfo(num, nodeInfo);
+}
+
+} // namespace
+
+void test_roundTrip()
+{
+    uint8_t frame[MAX_LORA_PAYLOAD_LEN], original[MAX_LORA_PAYLOAD_LEN];
+    const size_t sizes[] = {sizeof(PacketHeader) + FEC_MIN_PAYLOAD, sizeof(PacketHeader) + FEC_MAX_PAYLOAD};
+    for (size_t len : sizes) {
+        makeFrame(frame, len);
+        memcpy(original, frame, len);
+        size_t protectedLen = ForwardErrorCorrection::protect(frame, len);
+        TEST_ASSERT_EQUAL(len + FEC_PARITY_BYTES, protectedLen);
+        TEST_ASSERT_EQUAL_MEMORY(original, frame, len);
+        TEST_ASSERT_EQUAL(len, ForwardErrorCorrection::unwrap(frame, protectedLen, true));
+        TEST_ASSERT_EQUAL_MEMORY(original, frame, len);
+    }
+}
+
+// Up to FEC_PARITY_BYTES / 2 bad bytes anywhere, header and parity included, are repaired when the CRC failed
+void test_repair()
+{
+    uint8_t frame[MAX_LORA_PAYLOAD_LEN], original[MAX_LORA_PAYLOAD_LEN];
+    size_t len = makeFrame(frame, 120);
+    size_t protectedLen = ForwardErrorCorrection::protect(frame, len);
+    memcpy(original, frame, protectedLen);
+
+    for (size_t i = 0; i < FEC_PARITY_BYTES / 2; i++)
+        frame[(i * 53) % protectedLen] ^= 0x5a;
+    TEST_ASSERT_EQUAL(len, ForwardErrorCorrection::unwrap(frame, protectedLen, false));
+    TEST_ASSERT_EQUAL_MEMORY(original, frame, len);
+
+    // One more is beyond it
+    memcpy(frame, original, protectedLen);
+    for (size_t i = 0; i <= FEC_PARITY_BYTES / 2; i++)
+        frame[(i * 53) % protectedLen] ^= 0x5a;
+    TEST_ASSERT_EQUAL(0, ForwardErrorCorrection::unwrap(frame, protectedLen, false));
+}
+
+// A clean frame without parity is left alone, and one with a good CRC is never "corrected"
+void test_plainFrame()
+{
+    uint8_t frame[MAX_LORA_PAYLOAD_LEN], original[MAX_LORA_PAYLOAD_LEN];
+    size_t len = makeFrame(frame, 150);
+    memcpy(original, frame, len);
+    TEST_ASSERT_EQUAL(0, ForwardErrorCorrection::unwrap(frame, len, true));
+    TEST_ASSERT_EQUAL_MEMORY(original, frame, len);
+
+    size_t protectedLen = ForwardErrorCorrection::protect(frame, len);
+    frame[3] ^= 1;
+    TEST_ASSERT_EQUAL(0, ForwardErrorCorrection::unwrap(frame, protectedLen, true));
+
+    TEST_ASSERT_EQUAL(0, ForwardErrorCorrection::unwrap(frame, sizeof(PacketHeader), false)); // Too short to have parity
+}
+
+void test_reedSolomon()
+{
+    uint8_t codeword[255];
+    for (uint8_t numParity = 2; numParity <= REED_SOLOMON_MAX_PARITY; numParity += 6) {
+        size_t len = 255 - numParity;
+        makeFrame(codeword, len);
+        ReedSolomon::encode(codeword, len, numParity);
+        TEST_ASSERT_TRUE(ReedSolomon::isCodeword(codeword, len + numParity, numParity));
+        codeword[len - 1] ^= 0xff; // Right in front of the parity
+        TEST_ASSERT_FALSE(ReedSolomon::isCodeword(codeword, len + numParity, numParity));
+        TEST_ASSERT_TRUE(ReedSolomon::decode(codeword, len + numParity, numParity));
+        TEST_ASSERT_TRUE(ReedSolomon::isCodeword(codeword, len + numParity, numParity));
+    }
+}
+
+void test_receiversCapable()
+{
+    nodeDB->resetNodes();
+    meshtastic_MeshPacket flood = makePacket(NO_NEXT_HOP_PREFERENCE, 100);
+    TEST_ASSERT_FALSE(ForwardErrorCorrection::receiversCapable(&flood)); // Nobody to hear it
+
+    addNeighbour(0x1011, true);
+    TEST_ASSERT_TRUE(ForwardErrorCorrection::receiversCapable(&flood));
+
+    addNeighbour(0x2022, false);
+    TEST_ASSERT_FALSE(ForwardErrorCorrection::receiversCapable(&flood));
+    meshtastic_MeshPacket toCapable = makePacket(0x11, 100);
+    TEST_ASSERT_TRUE(ForwardErrorCorrection::receiversCapable(&toCapable));
+    meshtastic_MeshPacket toOlder = makePacket(0x22, 100);
+    TEST_ASSERT_FALSE(ForwardErrorCorrection::receiversCapable(&toOlder));
+}
+
+void setup()
+{
+    settingsMap[logoutputlevel] = level_warn;
+    initializeTestEnvironment();
+    nodeDB = new NodeDB();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_roundTrip);
+    RUN_TEST(test_repair);
+    RUN_TEST(test_plainFrame);
+    RUN_TEST(test_reedSolomon);
+    RUN_TEST(test_receiversCapable);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
@@ -0,0 +1,213 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "PortduinoGlue.h"
+#include "RTC.h"
+#include "mesh/FrameAggregation.h"
+#include "mesh/NodeDB.h"
+#include "mesh/Router.h"
+
+#include <string.h>
+#include <vector>
+
+namespace
+{
+
+struct Part {
+    PacketHeader h;
+    std::vector<uint8_t> payload;
+};
+
+PacketHeader makeHeader(NodeNum from, PacketId id)
+{
+    PacketHeader h = {};
+    h.from = from;
+    h.to = NODENUM_BROADCAST;
+    h.id = id;
+    h.flags = 3 | (3 << PACKET_FLAGS_HOP_START_SHIFT);
+    h.channel = 8;
+    return h;
+}
+
+std::vector<Part> takeApart(const uint8_t *payload, size_t len, bool &ok)
+{
+    std::vector<Part> parts;
+    ok = FrameAggregation::forEachPart(payload, len, [&](const PacketHeader &h, const uint8_t *p, size_t n) {
+        parts.push_back({h, std::vector<uint8_t>(p, p + n)});
+    });
+    return parts;
+}
+
+meshtastic_MeshPacket makePacket(NodeNum from, uint8_t nextHop, size_t size)
+{
+    meshtastic_MeshPacket p = meshtastic_MeshPacket_init_zero;
+    p.from = from;
+    p.to = NODENUM_BROADCAST;
+    p.id = 1;
+    p.next_hop = nextHop;
+    p.which_payload_variant = meshtastic_MeshPacket_encrypted_tag;
+    p.encrypted.size = size;
+    return p;
+}
+
+// A neighbour we heard lately, which may or may not have said it reads aggregates
+void addNeighbour(NodeNum num, bool readsAggregates)
+{
+    meshtastic_User user = meshtastic_User_init_zero;
+    nodeDB->updateUser(num, user, 0);
+    meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(num);
+    node->last_heard = getTime();
+    node->has_hops_away = true;
+    node->hops_away = 0;
+
+    meshtastic_Data nodeInfo = meshtastic_Data_init_zero;
+    nodeInfo.has_bitfield = readsAggregates;
+    nodeInfo.bitfield = readsAggregates ? BITFIELD_READS_AGGREGATES_MASK : 0;
+    FrameAggregation::heardNodeInfo(num, nodeInfo);
+}
+
+} // namespace
+
+void test_roundTrip()
+{
+    uint8_t frame[MAX_LORA_PAYLOAD_LEN];
+    size_t used = 0;
+    const size_t sizes[] = {0, 1, 20, 60};
+    for (size_t i = 0; i < 4; i++) {
+        std::vector<uint8_t> payload(sizes[i], (uint8_t)(0x40 + i));
+        PacketHeader h = makeHeader(0x100 + i, 7 + i);
+        TEST_ASSERT_TRUE(FrameAggregation::appendPart(frame, sizeof(frame), used, h, payload.data(), payload.size()));
+    }
+
+    bool ok;
+    std::vector<Part> parts = takeApart(frame, used, ok);
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_EQUAL(4, parts.size());
+    for (size_t i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0x100 + i, parts[i].h.from);
+        TEST_ASSERT_EQUAL_UINT32(7 + i, parts[i].h.id);
+        TEST_ASSERT_EQUAL_UINT8(3 | (3 << PACKET_FLAGS_HOP_START_SHIFT), parts[i].h.flags);
+        TEST_ASSERT_EQUAL(sizes[i], parts[i].payload.size());
+        for (uint8_t b : parts[i].payload)
+            TEST_ASSERT_EQUAL_UINT8(0x40 + i, b);
+    }
+}
+
+void test_fullFrame()
+{
+    uint8_t frame[MAX_LORA_PAYLOAD_LEN - sizeof(PacketHeader)];
+    uint8_t payload[FRAME_AGGREGATE_MAX_PART] = {};
+    size_t used = 0;
+    size_t fitted = 0;
+    while (FrameAggregation::appendPart(frame, sizeof(frame), used, makeHeader(1, 1), payload, 40))
+        fitted++;
+    TEST_ASSERT_EQUAL(sizeof(frame) / (1 + sizeof(PacketHeader) + 40), fitted);
+    TEST_ASSERT_TRUE(used <= sizeof(frame));
+}
+
+void test_header()
+{
+    PacketHeader h;
+    FrameAggregation::initHeader(h, 0x12345678);
+    TEST_ASSERT_TRUE(FrameAggregation::isAggregate(h));
+    TEST_ASSERT_EQUAL_UINT8(0, h.flags & PACKET_FLAGS_HOP_LIMIT_MASK); // Nobody may relay it
+    TEST_ASSERT_FALSE(FrameAggregation::isAggregate(makeHeader(0x12345678, 1)));
+}
+
+// Damage stops the unpacking, but what came before it still gets through
+void test_malformed()
+{
+    uint8_t frame[MAX_LORA_PAYLOAD_LEN];
+    uint8_t payload[20] = {};
+    size_t used = 0;
+    FrameAggregation::appendPart(frame, sizeof(frame), used, makeHeader(1, 1), payload, sizeof(payload));
+    FrameAggregation::appendPart(frame, sizeof(frame), used, makeHeader(2, 2), payload, sizeof(payload));
+
+    bool ok;
+    TEST_ASSERT_EQUAL(1, takeApart(frame, used - 1, ok).size());
+    TEST_ASSERT_FALSE(ok);
+
+    PacketHeader nested;
+    FrameAggregation::initHeader(nested, 3);
+    FrameAggregation::appendPart(frame, sizeof(frame), used, nested, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(2, takeApart(frame, used, ok).size());
+    TEST_ASSERT_FALSE(ok);
+
+    used = 0;
+    FrameAggregation::appendPart(frame, sizeof(frame), used, makeHeader(0, 1), payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(0, takeApart(frame, used, ok).size());
+    TEST_ASSERT_FALSE(ok);
+}
+
+void test_canJoin()
+{
+    const NodeNum us = nodeDB->getNodeNum(), other = 0x4000;
+    meshtastic_MeshPacket lead = makePacket(other, 0x22, 30);
+    meshtastic_MeshPacket ours = makePacket(us, 0x22, 30);
+    TEST_ASSERT_TRUE(FrameAggregation::canJoin(&lead, &ours));
+
+    meshtastic_MeshPacket elsewhere = makePacket(us, 0x23, 30);
+    TEST_ASSERT_FALSE(FrameAggregation::canJoin(&lead, &elsewhere));
+
+    meshtastic_MeshPacket big = makePacket(us, 0x22, FRAME_AGGREGATE_MAX_PART + 1);
+    TEST_ASSERT_FALSE(FrameAggregation::canJoin(&lead, &big));
+
+    meshtastic_MeshPacket later = makePacket(us, 0x22, 30);
+    later.tx_after = millis() + 60000;
+    TEST_ASSERT_FALSE(FrameAggregation::canJoin(&lead, &later));
+
+    // A flood we relay keeps its own slot in the contention window, one of ours doesn't need one
+    meshtastic_MeshPacket flood = makePacket(us, NO_NEXT_HOP_PREFERENCE, 30);
+    meshtastic_MeshPacket relayedFlood = makePacket(other, NO_NEXT_HOP_PREFERENCE, 30);
+    TEST_ASSERT_TRUE(FrameAggregation::canJoin(&flood, &flood));
+    TEST_ASSERT_FALSE(FrameAggregation::canJoin(&flood, &relayedFlood));
+}
+
+void test_receiversCapable()
+{
+    nodeDB->resetNodes();
+    meshtastic_MeshPacket flood = makePacket(nodeDB->getNodeNum(), NO_NEXT_HOP_PREFERENCE, 30);
+    TEST_ASSERT_FALSE(FrameAggregation::receiversCapable(&flood)); // Nobody to hear it
+
+    addNeighbour(0x1011, true);
+    addNeighbour(0x2022, true);
+    TEST_ASSERT_TRUE(FrameAggregation::receiversCapable(&flood));
+
+    meshtastic_MeshPacket direct = makePacket(nodeDB->getNodeNum(), 0x22, 30);
+    TEST_ASSERT_TRUE(FrameAggregation::receiversCapable(&direct));
+
+    // Older firmware next door rules out floods, and next hops that could be it
+    addNeighbour(0x3022, false);
+    TEST_ASSERT_FALSE(FrameAggregation::receiversCapable(&flood));
+    TEST_ASSERT_FALSE(FrameAggregation::receiversCapable(&direct));
+    meshtastic_MeshPacket toCapable = makePacket(nodeDB->getNodeNum(), 0x11, 30);
+    TEST_ASSERT_TRUE(FrameAggregation::receiversCapable(&toCapable));
+}
+
+void setup()
+{
+    settingsMap[logoutputlevel] = level_warn;
+    initializeTestEnvironment();
+    nodeDB = new NodeDB();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_roundTrip);
+    RUN_TEST(test_fullFrame);
+    RUN_TEST(test_header);
+    RUN_TEST(test_malformed);
+    RUN_TEST(test_canJoin);
+    RUN_TEST(test_receiversCapable);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
@@ -0,0 +1,119 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "PortduinoGlue.h"
+#include "mesh/FrameCapture.h"
+
+#include <string.h>
+#include <vector>
+
+namespace
+{
+
+uint32_t read32(const std::vector<uint8_t> &b, size_t at)
+{
+    uint32_t v;
+    memcpy(&v, b.data() + at, sizeof(v));
+    return v;
+}
+
+const size_t firstEPB = 28 + 20; // After the section header and the interface description
+
+/// Frame bytes of every enhanced packet block, in order
+std::vector<std::vector<uint8_t>> frames(const std::vector<uint8_t> &pcapng)
+{
+    std::vector<std::vector<uint8_t>> result;
+    for (size_t at = firstEPB; at < pcapng.size(); at += read32(pcapng, at + 4)) {
+        TEST_ASSERT_EQUAL_UINT32(6, read32(pcapng, at));
+        uint32_t capLen = read32(pcapng, at + 20);
+        const uint8_t *frame = pcapng.data() + at + 28 + FRAME_CAPTURE_LORATAP_LEN;
+        result.emplace_back(frame, frame + capLen - FRAME_CAPTURE_LORATAP_LEN);
+    }
+    return result;
+}
+
+} // namespace
+
+void test_pcapngLayout()
+{
+    frameCapture.clear();
+    const uint8_t frame[3] = {1, 2, 3};
+    frameCapture.add(false, frame, sizeof(frame), 906.875f, 250, 11, -100, 5.25f);
+    frameCapture.add(true, frame, sizeof(frame), 906.875f, 250, 11, 0, 0);
+    frameCapture.add(false, frame, sizeof(frame), 906.875f, 250, 11, -120, -10, false);
+
+    std::vector<uint8_t> pcapng;
+    frameCapture.writePcapng(pcapng);
+    TEST_ASSERT_EQUAL_UINT32(0x0A0D0D0A, read32(pcapng, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x1A2B3C4D, read32(pcapng, 8));
+    TEST_ASSERT_EQUAL_UINT32(1, read32(pcapng, 28));
+    TEST_ASSERT_EQUAL_UINT32(FRAME_CAPTURE_LINKTYPE_LORATAP, read32(pcapng, 36) & 0xffff);
+
+    // Every block is a multiple of 4 bytes and ends with its length again
+    size_t at = firstEPB;
+    uint32_t blockLen = read32(pcapng, at + 4);
+    TEST_ASSERT_EQUAL(0, blockLen % 4);
+    TEST_ASSERT_EQUAL_UINT32(blockLen, read32(pcapng, at + blockLen - 4));
+    TEST_ASSERT_EQUAL_UINT32(FRAME_CAPTURE_LORATAP_LEN + sizeof(frame), read32(pcapng, at + 20));
+
+    const uint8_t *tap = pcapng.data() + at + 28;
+    const uint8_t expectedTap[FRAME_CAPTURE_LORATAP_LEN] = {0, 0, 0, 15, 0x36, 0x0d, 0xd0, 0x78, 2, 11, 39, 39, 39, 21, 0x2b};
+    TEST_ASSERT_EQUAL_MEMORY(expectedTap, tap, sizeof(expectedTap));
+    TEST_ASSERT_EQUAL_MEMORY(frame, tap + FRAME_CAPTURE_LORATAP_LEN, sizeof(frame));
+
+    // Direction and CRC errors are in the epb_flags option
+    size_t flagsAt = at + 28 + 20; // 18 bytes of packet padded to 20
+    TEST_ASSERT_EQUAL_UINT32(2 | (4 << 16), read32(pcapng, flagsAt));
+    TEST_ASSERT_EQUAL_UINT32(1, read32(pcapng, flagsAt + 4));
+    at += blockLen;
+    TEST_ASSERT_EQUAL_UINT32(2, read32(pcapng, at + 28 + 20 + 4));
+    at += read32(pcapng, at + 4);
+    TEST_ASSERT_EQUAL_UINT32(1 | (1 << 24), read32(pcapng, at + 28 + 20 + 4));
+    TEST_ASSERT_EQUAL(pcapng.size(), at + read32(pcapng, at + 4));
+}
+
+// Once full, the oldest frames make room and the newest are all there, in order
+void test_ringDropsOldest()
+{
+    frameCapture.clear();
+    uint8_t frame[200];
+    const uint32_t total = 3 * FRAME_CAPTURE_BYTES / (16 + sizeof(frame));
+    for (uint32_t i = 0; i < total; i++) {
+        memset(frame, 0, sizeof(frame));
+        memcpy(frame, &i, sizeof(i));
+        frameCapture.add(i % 2, frame, sizeof(frame), 869.525f, 125, 9, -80, 8);
+    }
+    TEST_ASSERT_EQUAL(FRAME_CAPTURE_BYTES / (16 + sizeof(frame)), frameCapture.size());
+
+    std::vector<uint8_t> pcapng;
+    frameCapture.writePcapng(pcapng);
+    std::vector<std::vector<uint8_t>> got = frames(pcapng);
+    TEST_ASSERT_EQUAL(frameCapture.size(), got.size());
+    for (size_t i = 0; i < got.size(); i++) {
+        uint32_t id;
+        memcpy(&id, got[i].data(), sizeof(id));
+        TEST_ASSERT_EQUAL_UINT32(total - got.size() + i, id);
+    }
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_pcapngLayout);
+    RUN_TEST(test_ringDropsOldest);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
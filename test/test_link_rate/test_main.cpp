@@ -0,0 +1,60 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "PortduinoGlue.h"
+#include "mesh/LinkRate.h"
+
+// LongFast is SF11 at 250 kHz
+#define PRESET_SF 11
+
+void test_strongLinkGoesFast()
+{
+    // -7.5 dB floor at SF7, plus the margin
+    TEST_ASSERT_EQUAL_UINT8(7, LinkRate::pickSpreadingFactor(-7.5f + LINK_RATE_SNR_MARGIN, PRESET_SF));
+    TEST_ASSERT_EQUAL_UINT8(7, LinkRate::pickSpreadingFactor(12, PRESET_SF));
+}
+
+void test_steps()
+{
+    TEST_ASSERT_EQUAL_UINT8(8, LinkRate::pickSpreadingFactor(-10.0f + LINK_RATE_SNR_MARGIN, PRESET_SF));
+    TEST_ASSERT_EQUAL_UINT8(9, LinkRate::pickSpreadingFactor(-11.0f + LINK_RATE_SNR_MARGIN, PRESET_SF));
+    TEST_ASSERT_EQUAL_UINT8(10, LinkRate::pickSpreadingFactor(-15.0f + LINK_RATE_SNR_MARGIN, PRESET_SF));
+}
+
+void test_weakLinkStays()
+{
+    // Only as good as the preset needs, or worse
+    TEST_ASSERT_EQUAL_UINT8(0, LinkRate::pickSpreadingFactor(-17.5f + LINK_RATE_SNR_MARGIN, PRESET_SF));
+    TEST_ASSERT_EQUAL_UINT8(0, LinkRate::pickSpreadingFactor(-15, PRESET_SF));
+}
+
+void test_neverSlowerThanPreset()
+{
+    // ShortFast is already SF7, there is nothing faster we use
+    TEST_ASSERT_EQUAL_UINT8(0, LinkRate::pickSpreadingFactor(20, 7));
+    TEST_ASSERT_EQUAL_UINT8(7, LinkRate::pickSpreadingFactor(20, 8));
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_strongLinkGoesFast);
+    RUN_TEST(test_steps);
+    RUN_TEST(test_weakLinkStays);
+    RUN_TEST(test_neverSlowerThanPreset);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
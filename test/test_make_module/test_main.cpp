@@ -0,0 +1,56 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#undef MODULES_STATIC
+#define MODULES_STATIC 1
+#include "modules/Modules.h"
+
+namespace
+{
+
+struct Counter {
+    explicit Counter(int v) : value(v) {}
+    virtual ~Counter() {}
+    int value;
+    double align;
+};
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+// The first instance goes in the static storage, any more on the heap, and the arguments get through to both
+void test_staticThenHeap()
+{
+    Counter *first = makeModule<Counter>(1);
+    Counter *second = makeModule<Counter>(2);
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NOT_NULL(second);
+    TEST_ASSERT_TRUE(first != second);
+    TEST_ASSERT_EQUAL(1, first->value);
+    TEST_ASSERT_EQUAL(2, second->value);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)first % alignof(Counter));
+    delete second; // Only ever fine for the heap one
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_staticThenHeap);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
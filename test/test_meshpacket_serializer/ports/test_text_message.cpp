@@ -40,3 +40,32 @@ void test_text_message_serialization()
 
     delete root;
 }
+
+// A text message that is JSON itself is embedded as is, anything malformed or too deeply nested stays plain text
+void test_text_message_json_payload_serialization()
+{
+    const char *test_json = "{\"temp\": 21.5, \"tags\": [\"a\", \"b\"]}";
+    meshtastic_MeshPacket packet =
+        create_test_packet(meshtastic_PortNum_TEXT_MESSAGE_APP, (const uint8_t *)test_json, strlen(test_json));
+
+    std::string json = MeshPacketSerializer::JsonSerialize(&packet, false);
+    JSONValue *root = JSON::Parse(json.c_str());
+    TEST_ASSERT_NOT_NULL(root);
+    JSONObject jsonObj = root->AsObject();
+    TEST_ASSERT_TRUE(jsonObj["payload"]->IsObject());
+    JSONObject payload = jsonObj["payload"]->AsObject();
+    TEST_ASSERT_TRUE(payload.find("temp") != payload.end());
+    TEST_ASSERT_EQUAL_FLOAT(21.5, payload["temp"]->AsNumber());
+    TEST_ASSERT_EQUAL(2, payload["tags"]->AsArray().size());
+    delete root;
+
+    std::string deep(100, '[');
+    packet = create_test_packet(meshtastic_PortNum_TEXT_MESSAGE_APP, (const uint8_t *)deep.c_str(), deep.length());
+    json = MeshPacketSerializer::JsonSerialize(&packet, false);
+    root = JSON::Parse(json.c_str());
+    TEST_ASSERT_NOT_NULL(root);
+    jsonObj = root->AsObject();
+    payload = jsonObj["payload"]->AsObject();
+    TEST_ASSERT_EQUAL_STRING(deep.c_str(), payload["text"]->AsString().c_str());
+    delete root;
+}
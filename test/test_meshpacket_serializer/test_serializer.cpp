@@ -4,6 +4,7 @@
 
 // Forward declarations for test functions
 void test_text_message_serialization();
+void test_text_message_json_payload_serialization();
 void test_position_serialization();
 void test_nodeinfo_serialization();
 void test_waypoint_serialization();
@@ -21,6 +22,7 @@ void setup()
 
     // Text message tests
     RUN_TEST(test_text_message_serialization);
+    RUN_TEST(test_text_message_json_payload_serialization);
 
     // Position tests
     RUN_TEST(test_position_serialization);
@@ -331,6 +331,7 @@ void setUp(void)
         .role = meshtastic_Channel_Role_PRIMARY,
     };
     channelFile.channels_count = 1;
+    channels.onConfigChanged();
     owner = meshtastic_User{.id = "!12345678"};
     myNodeInfo = meshtastic_MyNodeInfo{.my_node_num = 10};
     localPosition =
@@ -503,6 +504,26 @@ void test_sendQueued(void)
     TEST_ASSERT_EQUAL(decoded.id, env.packet->id);
 }
 
+// Test that the whole backlog is published in one pass once the MQTT server is back.
+void test_sendQueuedBatch(void)
+{
+    pubsub->connected_ = false;
+    pubsub->refuseConnection_ = true;
+    TEST_ASSERT_TRUE(loopUntil([] { return !unitTest->getPubSub().connected(); }));
+
+    for (int i = 0; i < 3; i++)
+        mqtt->onSend(encrypted, decoded, 0);
+    TEST_ASSERT_EQUAL(3, unitTest->queueSize());
+
+    pubsub->refuseConnection_ = false;
+    TEST_ASSERT_TRUE(loopUntil([] { return unitTest->queueSize() == 0; }));
+
+    TEST_ASSERT_EQUAL(3, std::count_if(pubsub->published_.begin(), pubsub->published_.end(),
+                                       [](const auto &message) { return message.first == "msh/2/e/test/!12345678"; }));
+    TEST_ASSERT_EQUAL(3, mqtt->getNumQueuePublished());
+    TEST_ASSERT_EQUAL(0, mqtt->getNumQueueDropped());
+}
+
 // Verify reconnecting with the proxy enabled does not reconnect to a MQTT server.
 void test_reconnectProxyDoesNotReconnectMqtt(void)
 {
@@ -534,6 +555,49 @@ void test_receiveDecodedProto(void)
     TEST_ASSERT_TRUE(p.via_mqtt);
 }
 
+// The same packet arriving from several gateways only reaches the router once, and a flood gets cut off.
+void test_receiveDropsDuplicatesAndFloods(void)
+{
+    unitTest->publish(&decoded);
+    unitTest->publish(&decoded, "!abcdef01");
+    TEST_ASSERT_EQUAL(1, mockRouter->packets_.size());
+    TEST_ASSERT_EQUAL(1, mqtt->getNumDownlinkDuplicates());
+
+    meshtastic_MeshPacket p = decoded;
+    for (int i = 0; i < 2 * MQTT_DOWNLINK_BURST; i++) {
+        p.id++;
+        unitTest->publish(&p);
+    }
+    TEST_ASSERT_EQUAL(MQTT_DOWNLINK_BURST, mockRouter->packets_.size());
+    TEST_ASSERT_TRUE(mqtt->getNumDownlinkThrottled() > 0);
+}
+
+// A batch of envelopes is unpacked and each packet handled as if it had come on its own, up to any damage.
+void test_receiveEnvelopeBatch(void)
+{
+    std::basic_string<uint8_t> batch;
+    meshtastic_MeshPacket p = decoded;
+    for (int i = 0; i < 2; i++, p.id++) {
+        const meshtastic_ServiceEnvelope env = {.packet = &p, .channel_id = const_cast<char *>("test"),
+                                                .gateway_id = const_cast<char *>("!87654321")};
+        uint8_t bytes[256];
+        appendBatchedEnvelope(batch, bytes, pb_encode_to_bytes(bytes, sizeof(bytes), &meshtastic_ServiceEnvelope_msg, &env));
+    }
+    char topic[] = "msh/2/eb/test/!87654321";
+
+    unitTest->onReceive(topic, &batch[0], batch.size());
+
+    TEST_ASSERT_EQUAL(2, mockRouter->packets_.size());
+    TEST_ASSERT_EQUAL(decoded.id, mockRouter->packets_.front().id);
+    TEST_ASSERT_EQUAL(decoded.id + 1, mockRouter->packets_.back().id);
+
+    // Cut into the second envelope: the first one still counts, it's a duplicate now though
+    TEST_ASSERT_FALSE(forEachBatchedEnvelope(batch.data(), batch.size() - 1, [](const uint8_t *, size_t) {}));
+    unitTest->onReceive(topic, &batch[0], batch.size() - 1);
+    TEST_ASSERT_EQUAL(2, mockRouter->packets_.size());
+    TEST_ASSERT_EQUAL(1, mqtt->getNumDownlinkDuplicates());
+}
+
 // Test receiving a decoded MeshPacket from the phone proxy.
 void test_receiveDecodedProtoFromProxy(void)
 {
@@ -568,6 +632,7 @@ void test_receiveEmptyDataFromProxy(void)
 void test_receiveWithoutChannelDownlink(void)
 {
     channelFile.channels[0].settings.downlink_enabled = false;
+    channels.onConfigChanged();
 
     unitTest->publish(&decoded);
 
@@ -737,6 +802,34 @@ void test_reportToMapImpreciseProxied(void)
     const DecodedServiceEnvelope env(message.payload_variant.data.bytes, message.payload_variant.data.size);
 }
 
+// The same report is published again as it was, and a change to what it reports shows up in the next one.
+void test_reportToMapReusedUntilChanged(void)
+{
+    moduleConfig.mqtt.proxy_to_client_enabled = true;
+    MQTTUnitTest::restart();
+
+    unitTest->reportToMap();
+    localPosition.latitude_i += 10; // Well within the reported precision
+    unitTest->reportToMap();
+    strcpy(owner.long_name, "Renamed");
+    unitTest->reportToMap();
+
+    TEST_ASSERT_EQUAL(3, mockMeshService->messages_.size());
+    auto it = mockMeshService->messages_.begin();
+    const meshtastic_MqttClientProxyMessage &first = *it++;
+    const meshtastic_MqttClientProxyMessage &second = *it++;
+    const meshtastic_MqttClientProxyMessage &third = *it;
+    TEST_ASSERT_EQUAL(first.payload_variant.data.size, second.payload_variant.data.size);
+    TEST_ASSERT_EQUAL_MEMORY(first.payload_variant.data.bytes, second.payload_variant.data.bytes, first.payload_variant.data.size);
+
+    const DecodedServiceEnvelope env(third.payload_variant.data.bytes, third.payload_variant.data.size);
+    TEST_ASSERT_TRUE(env.validDecode);
+    meshtastic_MapReport mapReport;
+    TEST_ASSERT_TRUE(pb_decode_from_bytes(env.packet->decoded.payload.bytes, env.packet->decoded.payload.size,
+                                          &meshtastic_MapReport_msg, &mapReport));
+    TEST_ASSERT_EQUAL_STRING("Renamed", mapReport.long_name);
+}
+
 // isUsingDefaultServer returns true when using the default server.
 void test_usingDefaultServer(void)
 {
@@ -886,9 +979,12 @@ void setup()
     RUN_TEST(test_noRangeTestAppOnDefaultServer);
     RUN_TEST(test_noDetectionSensorAppOnDefaultServer);
     RUN_TEST(test_sendQueued);
+    RUN_TEST(test_sendQueuedBatch);
     RUN_TEST(test_reconnectProxyDoesNotReconnectMqtt);
     RUN_TEST(test_receiveEmptyMeshPacket);
     RUN_TEST(test_receiveDecodedProto);
+    RUN_TEST(test_receiveDropsDuplicatesAndFloods);
+    RUN_TEST(test_receiveEnvelopeBatch);
     RUN_TEST(test_receiveDecodedProtoFromProxy);
     RUN_TEST(test_receiveEmptyDataFromProxy);
     RUN_TEST(test_receiveWithoutChannelDownlink);
@@ -904,6 +1000,7 @@ void setup()
     RUN_TEST(test_publishTextMessageWithProxy);
     RUN_TEST(test_reportToMapDefaultImprecise);
     RUN_TEST(test_reportToMapImpreciseProxied);
+    RUN_TEST(test_reportToMapReusedUntilChanged);
     RUN_TEST(test_usingDefaultServer);
     RUN_TEST(test_usingDefaultServerWithPort);
     RUN_TEST(test_usingDefaultServerWithInvalidPort);
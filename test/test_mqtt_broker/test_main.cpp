@@ -0,0 +1,61 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "platform/portduino/MqttBroker.h"
+
+void test_exactTopic()
+{
+    TEST_ASSERT_TRUE(MqttBroker::topicMatches("msh/2/e/LongFast/!12345678", "msh/2/e/LongFast/!12345678"));
+    TEST_ASSERT_FALSE(MqttBroker::topicMatches("msh/2/e/LongFast", "msh/2/e/LongFast/!12345678"));
+    TEST_ASSERT_FALSE(MqttBroker::topicMatches("msh/2/e/LongFast/!12345678", "msh/2/e/LongFast"));
+    TEST_ASSERT_FALSE(MqttBroker::topicMatches("msh/2/e/LongFas", "msh/2/e/LongFast"));
+}
+
+void test_singleLevelWildcard()
+{
+    TEST_ASSERT_TRUE(MqttBroker::topicMatches("msh/2/e/+/!12345678", "msh/2/e/LongFast/!12345678"));
+    TEST_ASSERT_TRUE(MqttBroker::topicMatches("msh/2/e/LongFast/+", "msh/2/e/LongFast/!12345678"));
+    TEST_ASSERT_TRUE(MqttBroker::topicMatches("msh/+", "msh/")); // An empty level is still a level
+    TEST_ASSERT_FALSE(MqttBroker::topicMatches("msh/+", "msh/2/e"));
+    TEST_ASSERT_FALSE(MqttBroker::topicMatches("msh/+/e", "msh/2"));
+}
+
+void test_multiLevelWildcard()
+{
+    TEST_ASSERT_TRUE(MqttBroker::topicMatches("#", "msh/2/e/LongFast/!12345678"));
+    TEST_ASSERT_TRUE(MqttBroker::topicMatches("msh/2/#", "msh/2/json/LongFast/!12345678"));
+    TEST_ASSERT_TRUE(MqttBroker::topicMatches("msh/2/#", "msh/2")); // Takes in the parent level too
+    TEST_ASSERT_TRUE(MqttBroker::topicMatches("msh/+/e/#", "msh/2/e/PKI/!12345678"));
+    TEST_ASSERT_FALSE(MqttBroker::topicMatches("msh/2/#", "msh/3/e"));
+}
+
+// Wildcards at the first level leave $SYS and friends alone
+void test_dollarTopics()
+{
+    TEST_ASSERT_FALSE(MqttBroker::topicMatches("#", "$SYS/broker/uptime"));
+    TEST_ASSERT_FALSE(MqttBroker::topicMatches("+/broker/uptime", "$SYS/broker/uptime"));
+    TEST_ASSERT_TRUE(MqttBroker::topicMatches("$SYS/#", "$SYS/broker/uptime"));
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+    UNITY_BEGIN();
+    RUN_TEST(test_exactTopic);
+    RUN_TEST(test_singleLevelWildcard);
+    RUN_TEST(test_multiLevelWildcard);
+    RUN_TEST(test_dollarTopics);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
@@ -0,0 +1,113 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "mesh/NodeRecency.h"
+
+static bool any(uint16_t)
+{
+    return true;
+}
+
+// Nodes heard once go first, oldest first, however recently the protected ones were heard
+void test_probationGoesFirst()
+{
+    NodeRecency r;
+    r.reset(8);
+    for (uint16_t x = 0; x < 4; x++)
+        r.add(x, 0);
+    r.heard(0, NODEDB_PROBATION_SECS);
+    r.heard(1, NODEDB_PROBATION_SECS);
+    TEST_ASSERT_EQUAL(NodeRecency::PROTECTED, r.segmentOf(0));
+    TEST_ASSERT_EQUAL(2, r.size(NodeRecency::PROBATION));
+
+    // A stream of one-off nodes only ever displaces each other
+    for (uint16_t x = 4; x < 8; x++) {
+        int v = r.victim(any);
+        TEST_ASSERT_EQUAL(NodeRecency::PROBATION, r.segmentOf(v));
+        TEST_ASSERT_TRUE(v >= 2);
+        r.remove(v);
+        r.add(v, NODEDB_PROBATION_SECS + x);
+    }
+    TEST_ASSERT_EQUAL(NodeRecency::PROTECTED, r.segmentOf(0));
+    TEST_ASSERT_EQUAL(NodeRecency::PROTECTED, r.segmentOf(1));
+}
+
+// Hearing a node again within its probation, as a burst would, doesn't protect it
+void test_burstStaysOnProbation()
+{
+    NodeRecency r;
+    r.reset(4);
+    r.add(0, 100);
+    r.heard(0, 100);
+    r.heard(0, 100 + NODEDB_PROBATION_SECS - 1);
+    TEST_ASSERT_EQUAL(NodeRecency::PROBATION, r.segmentOf(0));
+    r.heard(0, 100 + NODEDB_PROBATION_SECS);
+    TEST_ASSERT_EQUAL(NodeRecency::PROTECTED, r.segmentOf(0));
+}
+
+// Within a segment the node heard longest ago goes first, and ineligible ones are passed over
+void test_victimOrder()
+{
+    NodeRecency r;
+    r.reset(8);
+    for (uint16_t x = 0; x < 3; x++)
+        r.add(x, 0);
+    TEST_ASSERT_EQUAL(0, r.victim(any));
+    r.heard(0, 1);
+    TEST_ASSERT_EQUAL(1, r.victim(any));
+    TEST_ASSERT_EQUAL(2, r.victim([](uint16_t x) { return x != 1; }));
+    TEST_ASSERT_EQUAL(-1, r.victim([](uint16_t) { return false; }));
+}
+
+// Protecting a node when the protected segment is full sends back the one heard longest ago
+void test_protectedLimit()
+{
+    NodeRecency r;
+    r.reset(4); // Room for 3 protected at 75%
+    for (uint16_t x = 0; x < 4; x++) {
+        r.add(x, 0);
+        r.heard(x, NODEDB_PROBATION_SECS + x);
+    }
+    TEST_ASSERT_EQUAL(3, r.size(NodeRecency::PROTECTED));
+    TEST_ASSERT_EQUAL(NodeRecency::PROBATION, r.segmentOf(0));
+    TEST_ASSERT_EQUAL(0, r.victim(any));
+}
+
+// Rebuilding protects the most recently heard
+void test_rebuild()
+{
+    NodeRecency r;
+    r.reset(8);
+    uint32_t lastHeard[] = {50, 10, 40, 20, 30, 60, 70, 5};
+    r.rebuild(lastHeard, 8);
+    TEST_ASSERT_EQUAL(6, r.size(NodeRecency::PROTECTED));
+    TEST_ASSERT_EQUAL(7, r.victim(any));
+    TEST_ASSERT_EQUAL(NodeRecency::PROBATION, r.segmentOf(1));
+    TEST_ASSERT_EQUAL(NodeRecency::PROTECTED, r.segmentOf(3));
+    TEST_ASSERT_EQUAL(3, r.victim([](uint16_t x) { return x != 7 && x != 1; }));
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_probationGoesFirst);
+    RUN_TEST(test_burstStaysOnProbation);
+    RUN_TEST(test_victimOrder);
+    RUN_TEST(test_protectedLimit);
+    RUN_TEST(test_rebuild);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
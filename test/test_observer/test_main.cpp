@@ -0,0 +1,150 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "Observer.h"
+
+#include <vector>
+
+namespace
+{
+
+std::vector<int> heard;
+
+class Recorder : public Observer<int>
+{
+  public:
+    explicit Recorder(int id) : id(id) {}
+
+    Observable<int> *leaveWhenNotified = NULL;
+    int result = 0;
+
+  protected:
+    virtual int onNotify(int arg) override
+    {
+        heard.push_back(id * 100 + arg);
+        if (leaveWhenNotified)
+            unobserve(leaveWhenNotified);
+        return result;
+    }
+
+  private:
+    int id;
+};
+
+bool heardExactly(const std::vector<int> &expected)
+{
+    bool same = heard == expected;
+    heard.clear();
+    return same;
+}
+
+} // namespace
+
+void test_notifiesInSubscribeOrder()
+{
+    Observable<int> source;
+    Recorder a(1), b(2), c(3);
+    a.observe(&source);
+    b.observe(&source);
+    c.observe(&source);
+    TEST_ASSERT_EQUAL(0, source.notifyObservers(5));
+    TEST_ASSERT_TRUE(heardExactly({105, 205, 305}));
+}
+
+void test_abortStopsNotifying()
+{
+    Observable<int> source;
+    Recorder a(1), b(2);
+    a.observe(&source);
+    b.observe(&source);
+    a.result = 7;
+    TEST_ASSERT_EQUAL(7, source.notifyObservers(1));
+    TEST_ASSERT_TRUE(heardExactly({101}));
+}
+
+void test_unobserve()
+{
+    Observable<int> source, other;
+    Recorder a(1), b(2);
+    a.observe(&source);
+    b.observe(&source);
+    b.observe(&other);
+    b.unobserve(&source);
+    source.notifyObservers(1);
+    other.notifyObservers(2);
+    TEST_ASSERT_TRUE(heardExactly({101, 202}));
+}
+
+void test_unobserveWhileNotified()
+{
+    Observable<int> source;
+    Recorder a(1), b(2), c(3);
+    a.observe(&source);
+    b.observe(&source);
+    c.observe(&source);
+    b.leaveWhenNotified = &source;
+    source.notifyObservers(1);
+    source.notifyObservers(2);
+    TEST_ASSERT_TRUE(heardExactly({101, 201, 301, 102, 302}));
+}
+
+// Whichever side goes away first, the other is left with nothing dangling
+void test_destruction()
+{
+    Observable<int> source;
+    Recorder a(1);
+    a.observe(&source);
+    {
+        Recorder gone(2);
+        gone.observe(&source);
+    }
+    {
+        Observable<int> goneSource;
+        a.observe(&goneSource);
+    }
+    source.notifyObservers(1);
+    TEST_ASSERT_TRUE(heardExactly({101}));
+}
+
+// More subscriptions than the pool holds still work
+void test_pastThePool()
+{
+    Observable<int> source;
+    std::vector<Recorder *> many;
+    for (int i = 0; i < OBSERVER_LINK_POOL_SIZE * 2; i++) {
+        many.push_back(new Recorder(i));
+        many.back()->observe(&source);
+    }
+    source.notifyObservers(0);
+    TEST_ASSERT_EQUAL(OBSERVER_LINK_POOL_SIZE * 2, heard.size());
+    heard.clear();
+    for (Recorder *r : many)
+        delete r;
+    source.notifyObservers(0);
+    TEST_ASSERT_TRUE(heardExactly({}));
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+    UNITY_BEGIN();
+    RUN_TEST(test_notifiesInSubscribeOrder);
+    RUN_TEST(test_abortStopsNotifying);
+    RUN_TEST(test_unobserve);
+    RUN_TEST(test_unobserveWhileNotified);
+    RUN_TEST(test_destruction);
+    RUN_TEST(test_pastThePool);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
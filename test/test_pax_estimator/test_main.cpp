@@ -0,0 +1,97 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "modules/PaxEstimator.h"
+
+#define MINUTE_MS (60 * 1000UL)
+
+namespace
+{
+
+void seen(PaxEstimator &e, uint32_t device, uint32_t nowMs)
+{
+    uint8_t mac[6] = {0x02, 0x42, (uint8_t)(device >> 24), (uint8_t)(device >> 16), (uint8_t)(device >> 8), (uint8_t)device};
+    e.add(mac, sizeof(mac), nowMs);
+}
+
+// Within four standard errors of the true count, or one device for the smallest counts
+void assertNear(uint32_t expected, uint32_t actual)
+{
+    uint32_t tolerance = expected * 4 * 104 / 100 / 11; // 1.04 / sqrt(128) is about 9%
+    if (tolerance < 1)
+        tolerance = 1;
+    TEST_ASSERT_UINT32_WITHIN(tolerance, expected, actual);
+}
+
+} // namespace
+
+void test_empty()
+{
+    PaxEstimator e;
+    TEST_ASSERT_FALSE(e.isFed());
+    TEST_ASSERT_EQUAL_UINT32(0, e.estimate(60, 0));
+}
+
+void test_repeatsCountOnce()
+{
+    const uint32_t sizes[] = {1, 10, 100, 1000, 10000, 50000};
+    for (uint32_t n : sizes) {
+        PaxEstimator e;
+        for (int pass = 0; pass < 3; pass++)
+            for (uint32_t d = 0; d < n; d++)
+                seen(e, d, pass * 1000);
+        TEST_ASSERT_TRUE(e.isFed());
+        assertNear(n, e.estimate(PAX_ESTIMATOR_BUCKET_MINUTES, 3000));
+    }
+}
+
+// The same 100 devices stay around for the hour, and another 100 pass by every minute of it
+void test_slidingWindow()
+{
+    PaxEstimator e;
+    for (uint32_t minute = 0; minute < 60; minute++) {
+        for (uint32_t d = 0; d < 100; d++) {
+            seen(e, d, minute * MINUTE_MS);
+            seen(e, (minute + 1) * 1000 + d, minute * MINUTE_MS);
+        }
+    }
+    uint32_t now = 59 * MINUTE_MS;
+    assertNear(100 + 5 * 100, e.estimate(5, now));
+    assertNear(100 + 15 * 100, e.estimate(15, now));
+    assertNear(100 + 60 * 100, e.estimate(60, now));
+    assertNear(100 + 60 * 100, e.estimate(24 * 60, now)); // No further back than the buckets go
+}
+
+void test_forgetsOldDevices()
+{
+    PaxEstimator e;
+    for (uint32_t d = 0; d < 500; d++)
+        seen(e, d, 0);
+    uint32_t later = PAX_ESTIMATOR_BUCKETS * PAX_ESTIMATOR_BUCKET_MINUTES * MINUTE_MS;
+    TEST_ASSERT_EQUAL_UINT32(0, e.estimate(60, later));
+    seen(e, 1, later);
+    TEST_ASSERT_EQUAL_UINT32(1, e.estimate(60, later));
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+    UNITY_BEGIN();
+    RUN_TEST(test_empty);
+    RUN_TEST(test_repeatsCountOnce);
+    RUN_TEST(test_slidingWindow);
+    RUN_TEST(test_forgetsOldDevices);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
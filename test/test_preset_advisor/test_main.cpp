@@ -0,0 +1,112 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "PortduinoGlue.h"
+#include "mesh/PresetAdvisor.h"
+
+namespace
+{
+
+struct Modem {
+    float bw;
+    uint8_t cr, sf;
+};
+
+Modem modem(meshtastic_Config_LoRaConfig_ModemPreset preset)
+{
+    Modem m;
+    RadioInterface::presetModem(preset, false, m.bw, m.cr, m.sf);
+    return m;
+}
+
+// Estimate of preset relative to LONG_FAST, which c was measured on
+float relative(const PresetConditions &c, meshtastic_Config_LoRaConfig_ModemPreset preset, float &reach)
+{
+    Modem cur = modem(meshtastic_Config_LoRaConfig_ModemPreset_LONG_FAST), m = modem(preset);
+    float curReach;
+    float now = PresetAdvisor::estimate(c, cur.bw, cur.sf, cur.cr, cur.bw, cur.sf, cur.cr, curReach);
+    TEST_ASSERT_TRUE(now > 0);
+    return PresetAdvisor::estimate(c, cur.bw, cur.sf, cur.cr, m.bw, m.sf, m.cr, reach) / now;
+}
+
+const float strong[] = {10, 12, 8};
+const float weak[] = {-12, -14, -10};
+
+} // namespace
+
+void test_presetModem()
+{
+    Modem m = modem(meshtastic_Config_LoRaConfig_ModemPreset_LONG_FAST);
+    TEST_ASSERT_EQUAL_FLOAT(250, m.bw);
+    TEST_ASSERT_EQUAL(5, m.cr);
+    TEST_ASSERT_EQUAL(11, m.sf);
+
+    float bw;
+    uint8_t cr, sf;
+    RadioInterface::presetModem(meshtastic_Config_LoRaConfig_ModemPreset_LONG_SLOW, true, bw, cr, sf);
+    TEST_ASSERT_EQUAL_FLOAT(406.25, bw);
+    TEST_ASSERT_EQUAL(8, cr);
+    TEST_ASSERT_EQUAL(12, sf);
+
+    // About 0.7 s for a typical packet on LONG_FAST
+    uint32_t msec = RadioInterface::packetTimeMsec(PRESET_ADVISOR_PACKET_LEN, 250, 11, 5, 16);
+    TEST_ASSERT_UINT32_WITHIN(30, 714, msec);
+}
+
+// Strong neighbours on a quiet channel are better served by a faster preset, even with the extra hops it needs
+void test_strongNeighbours()
+{
+    PresetConditions c = {0.05f, 0.02f, 2, strong, 3};
+    float reach;
+    TEST_ASSERT_TRUE(relative(c, meshtastic_Config_LoRaConfig_ModemPreset_MEDIUM_FAST, reach) * 100 >
+                     100 + PRESET_ADVISOR_MIN_GAIN);
+    TEST_ASSERT_EQUAL_FLOAT(1, reach);
+    TEST_ASSERT_TRUE(relative(c, meshtastic_Config_LoRaConfig_ModemPreset_LONG_SLOW, reach) < 1);
+}
+
+// A preset nobody would hear us on delivers nothing
+void test_weakNeighbours()
+{
+    PresetConditions c = {0.05f, 0.02f, 2, weak, 3};
+    float reach;
+    TEST_ASSERT_EQUAL_FLOAT(0, relative(c, meshtastic_Config_LoRaConfig_ModemPreset_SHORT_FAST, reach));
+    TEST_ASSERT_EQUAL_FLOAT(0, reach);
+    TEST_ASSERT_TRUE(relative(c, meshtastic_Config_LoRaConfig_ModemPreset_LONG_SLOW, reach) < 1 + PRESET_ADVISOR_MIN_GAIN / 100.0f);
+    TEST_ASSERT_EQUAL_FLOAT(1, reach);
+}
+
+// The busier the channel and the more frames it loses, the more shorter airtime is worth
+void test_busyChannel()
+{
+    PresetConditions quiet = {0.05f, 0.02f, 2, strong, 3};
+    PresetConditions busy = {0.4f, 0.3f, 2, strong, 3};
+    float reach;
+    TEST_ASSERT_TRUE(relative(busy, meshtastic_Config_LoRaConfig_ModemPreset_SHORT_FAST, reach) >
+                     relative(quiet, meshtastic_Config_LoRaConfig_ModemPreset_SHORT_FAST, reach));
+    // A slower preset would need more airtime than there is
+    TEST_ASSERT_EQUAL_FLOAT(0, relative(busy, meshtastic_Config_LoRaConfig_ModemPreset_LONG_SLOW, reach));
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_presetModem);
+    RUN_TEST(test_strongNeighbours);
+    RUN_TEST(test_weakNeighbours);
+    RUN_TEST(test_busyChannel);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
@@ -0,0 +1,177 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "modules/SerialBridge.h"
+
+#include <string>
+#include <vector>
+
+#define CHUNK 100
+
+namespace
+{
+
+std::string out;
+
+SerialBridgeReassembler makeBridge()
+{
+    out.clear();
+    return SerialBridgeReassembler([](const uint8_t *bytes, size_t len) { out.append((const char *)bytes, len); });
+}
+
+// The stream cut into bridged payloads, as the sending side's serial module would
+std::vector<std::vector<uint8_t>> frame(const std::string &stream, uint16_t firstSeq)
+{
+    std::vector<std::vector<uint8_t>> payloads;
+    for (size_t i = 0; i < stream.size(); i += CHUNK) {
+        size_t len = stream.size() - i < CHUNK ? stream.size() - i : CHUNK;
+        std::vector<uint8_t> p(SERIAL_BRIDGE_HEADER_LEN + len);
+        SerialBridgeReassembler::writeHeader(p.data(), firstSeq + payloads.size());
+        memcpy(p.data() + SERIAL_BRIDGE_HEADER_LEN, stream.data() + i, len);
+        payloads.push_back(p);
+    }
+    return payloads;
+}
+
+std::string makeStream(size_t payloads)
+{
+    std::string s;
+    for (size_t i = 0; i < payloads * CHUNK; i++)
+        s += (char)('a' + (i * 7 + i / CHUNK) % 26);
+    return s;
+}
+
+std::string chunkOf(const std::string &stream, size_t i)
+{
+    return stream.substr(i * CHUNK, CHUNK);
+}
+
+void deliver(SerialBridgeReassembler &bridge, const std::vector<uint8_t> &p, uint32_t nowMs = 0, NodeNum from = 0x1234)
+{
+    bridge.receive(from, p.data(), p.size(), nowMs);
+}
+
+} // namespace
+
+void test_inOrder()
+{
+    SerialBridgeReassembler bridge = makeBridge();
+    std::string stream = makeStream(10);
+    for (auto &p : frame(stream, 65530)) // Across the wrap of the sequence number
+        deliver(bridge, p);
+    TEST_ASSERT_TRUE(out == stream);
+    TEST_ASSERT_EQUAL_UINT32(0, bridge.getLost());
+}
+
+void test_reordered()
+{
+    SerialBridgeReassembler bridge = makeBridge();
+    std::string stream = makeStream(8);
+    auto payloads = frame(stream, 10);
+    const int order[] = {0, 2, 3, 1, 4, 7, 5, 6};
+    for (int i : order)
+        deliver(bridge, payloads[i]);
+    TEST_ASSERT_TRUE(out == stream);
+    TEST_ASSERT_EQUAL_UINT32(0, bridge.getLost());
+}
+
+void test_duplicates()
+{
+    SerialBridgeReassembler bridge = makeBridge();
+    std::string stream = makeStream(4);
+    auto payloads = frame(stream, 0);
+    deliver(bridge, payloads[0]);
+    deliver(bridge, payloads[2]);
+    deliver(bridge, payloads[2]); // Relayed to us twice while held
+    deliver(bridge, payloads[1]);
+    deliver(bridge, payloads[0]); // Retransmitted after it was written
+    deliver(bridge, payloads[3]);
+    TEST_ASSERT_TRUE(out == stream);
+    TEST_ASSERT_EQUAL_UINT32(2, bridge.getDuplicates());
+}
+
+// A payload that never comes holds the ones after it only until the gap times out
+void test_lostThenTimeout()
+{
+    SerialBridgeReassembler bridge = makeBridge();
+    std::string stream = makeStream(4);
+    auto payloads = frame(stream, 0);
+    deliver(bridge, payloads[0], 0);
+    deliver(bridge, payloads[2], 100);
+    deliver(bridge, payloads[3], 200);
+    TEST_ASSERT_TRUE(out == chunkOf(stream, 0));
+
+    bridge.tick(100 + SERIAL_BRIDGE_GAP_MS - 1);
+    TEST_ASSERT_TRUE(out == chunkOf(stream, 0));
+    bridge.tick(100 + SERIAL_BRIDGE_GAP_MS);
+    TEST_ASSERT_TRUE(out == chunkOf(stream, 0) + chunkOf(stream, 2) + chunkOf(stream, 3));
+    TEST_ASSERT_EQUAL_UINT32(1, bridge.getLost());
+
+    deliver(bridge, payloads[1], 300); // Too late, it was given up on
+    TEST_ASSERT_EQUAL_UINT32(1, bridge.getDuplicates());
+}
+
+// More arriving than can be held back also gives up on the gap
+void test_lostThenOverrun()
+{
+    SerialBridgeReassembler bridge = makeBridge();
+    std::string stream = makeStream(SERIAL_BRIDGE_REORDER + 3);
+    auto payloads = frame(stream, 0);
+    std::string expected = chunkOf(stream, 0);
+    deliver(bridge, payloads[0]);
+    for (size_t i = 2; i < payloads.size(); i++) {
+        deliver(bridge, payloads[i]);
+        expected += chunkOf(stream, i);
+    }
+    TEST_ASSERT_TRUE(out == expected);
+    TEST_ASSERT_EQUAL_UINT32(1, bridge.getLost());
+}
+
+// A sender that rebooted starts counting again, that is not a duplicate
+void test_senderRestart()
+{
+    SerialBridgeReassembler bridge = makeBridge();
+    std::string first = makeStream(3), second = makeStream(2);
+    for (auto &p : frame(first, 5000))
+        deliver(bridge, p);
+    for (auto &p : frame(second, 0))
+        deliver(bridge, p);
+    TEST_ASSERT_TRUE(out == first + second);
+    TEST_ASSERT_EQUAL_UINT32(0, bridge.getDuplicates());
+}
+
+void test_malformed()
+{
+    SerialBridgeReassembler bridge = makeBridge();
+    uint8_t tiny[1] = {0};
+    bridge.receive(0x1234, tiny, sizeof(tiny), 0);
+    uint8_t huge[meshtastic_Constants_DATA_PAYLOAD_LEN + 1] = {0};
+    bridge.receive(0x1234, huge, sizeof(huge), 0);
+    TEST_ASSERT_EQUAL_UINT32(0, out.size());
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+    UNITY_BEGIN();
+    RUN_TEST(test_inOrder);
+    RUN_TEST(test_reordered);
+    RUN_TEST(test_duplicates);
+    RUN_TEST(test_lostThenTimeout);
+    RUN_TEST(test_lostThenOverrun);
+    RUN_TEST(test_senderRestart);
+    RUN_TEST(test_malformed);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
@@ -0,0 +1,75 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "PortduinoGlue.h"
+#include "mesh/SlottedTx.h"
+
+// 4 slots of 1000 msec, 200 msec of guard split between both ends of each
+#define SLOT 1000
+#define SLOTS 4
+#define GUARD 200
+#define FRAME (SLOT * SLOTS)
+
+static uint32_t until(uint64_t now, uint8_t slot, uint32_t txMsec)
+{
+    return SlottedTx::msecUntilSlot(now, SLOT, SLOTS, slot, txMsec, GUARD);
+}
+
+void test_waitsForOwnSlot()
+{
+    TEST_ASSERT_EQUAL_UINT32(2100, until(0, 2, 500));
+    TEST_ASSERT_EQUAL_UINT32(100, until(2000, 2, 500));
+}
+
+void test_goesInsideSlot()
+{
+    TEST_ASSERT_EQUAL_UINT32(0, until(2100, 2, 500));
+    TEST_ASSERT_EQUAL_UINT32(0, until(2400, 2, 500)); // Ends at 2900, where the guard starts
+}
+
+void test_tooLateForThisFrame()
+{
+    // Would run into the guard, or is already past our slot
+    TEST_ASSERT_EQUAL_UINT32(FRAME - 401, until(2501, 2, 500));
+    TEST_ASSERT_EQUAL_UINT32(FRAME - 3500 + 2100, until(3500, 2, 500));
+}
+
+void test_fullSizePacket()
+{
+    // A packet as long as the slot less the guard only fits at the very start
+    TEST_ASSERT_EQUAL_UINT32(0, until(100, 0, SLOT - GUARD));
+    TEST_ASSERT_EQUAL_UINT32(FRAME - 1, until(101, 0, SLOT - GUARD));
+}
+
+void test_absoluteTime()
+{
+    // Only the position in the frame counts
+    uint64_t frames = (uint64_t)1700000000 * 1000 / FRAME * FRAME;
+    TEST_ASSERT_EQUAL_UINT32(1100, until(frames, 1, 500));
+    TEST_ASSERT_EQUAL_UINT32(0, until(frames + 3200, 3, 300));
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_waitsForOwnSlot);
+    RUN_TEST(test_goesInsideSlot);
+    RUN_TEST(test_tooLateForThisFrame);
+    RUN_TEST(test_fullSizePacket);
+    RUN_TEST(test_absoluteTime);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
@@ -0,0 +1,386 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "mesh/StreamAPI.h"
+#include "serialization/cobs.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+// How much random input each fuzz test pushes through, and how much the benchmarks parse per result
+#define FUZZ_ROUNDS 2000
+#define FUZZ_MAX_INPUT 2048
+#define BENCH_BYTES (4 * 1024 * 1024)
+
+#define START1 0x94
+#define START2 0xc3
+
+namespace
+{
+
+typedef std::vector<uint8_t> Bytes;
+
+uint64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Same "BENCH " JSON lines as test_bench_router
+void report(const char *name, uint32_t size, uint32_t ops, uint64_t ns)
+{
+    printf("BENCH {\"name\":\"%s\",\"size\":%u,\"ops\":%u,\"ns_per_op\":%.1f}\n", name, size, ops, (double)ns / ops);
+}
+
+// Deterministic, so a failure can be reproduced
+uint32_t nextRandom(uint32_t &state)
+{
+    state = state * 1664525 + 1013904223;
+    return state >> 8;
+}
+
+// Mostly framing bytes and small lengths, so random input hits every state of the parser rather than just noise
+uint8_t nastyByte(uint32_t &state)
+{
+    static const uint8_t alphabet[] = {START1, START2, 0x00, 0x01, 0x02, 0x10, 0xff};
+    uint32_t r = nextRandom(state);
+    return (r & 1) ? alphabet[(r >> 1) % sizeof(alphabet)] : (uint8_t)(r >> 4);
+}
+
+void appendFrame(Bytes &out, const Bytes &payload)
+{
+    out.push_back(START1);
+    out.push_back(START2);
+    out.push_back(payload.size() >> 8);
+    out.push_back(payload.size() & 0xff);
+    out.insert(out.end(), payload.begin(), payload.end());
+}
+
+Bytes randomPayload(uint32_t &state, size_t maxLen)
+{
+    Bytes payload(nextRandom(state) % (maxLen + 1));
+    for (auto &b : payload)
+        b = nextRandom(state);
+    return payload;
+}
+
+/// The framing rules one byte at a time, written as plainly as possible, to check the real parser against
+std::vector<Bytes> referenceParse(const Bytes &in)
+{
+    std::vector<Bytes> frames;
+    Bytes cur;
+    for (uint8_t c : in) {
+        cur.push_back(c);
+        if (cur.size() == 1 && c != START1)
+            cur.clear();
+        else if (cur.size() == 2 && c != START2)
+            cur.assign(c == START1 ? 1 : 0, START1);
+        else if (cur.size() == 4 && ((cur[2] << 8) | cur[3]) > MAX_TO_FROM_RADIO_SIZE)
+            cur.clear();
+        if (cur.size() >= 4 && cur.size() == 4u + ((cur[2] << 8) | cur[3])) {
+            frames.push_back(Bytes(cur.begin() + 4, cur.end()));
+            cur.clear();
+        }
+    }
+    return frames;
+}
+
+class FakeStream : public Stream
+{
+  public:
+    Bytes rx;
+    size_t rxPos = 0;
+
+    int available() override { return rx.size() - rxPos; }
+    int read() override { return rxPos < rx.size() ? rx[rxPos++] : -1; }
+    int peek() override { return rxPos < rx.size() ? rx[rxPos] : -1; }
+    size_t write(uint8_t) override { return 1; }
+};
+
+class TestStreamAPI : public StreamAPI
+{
+  public:
+    std::vector<Bytes> frames;
+    bool keepFrames = true;
+    uint32_t frameCount = 0;
+
+    explicit TestStreamAPI(Stream *s) : StreamAPI(s) { canWrite = false; }
+
+    /// Feed bytes the way SerialModule does, in pieces no bigger than the uint16_t length it takes
+    void feed(const uint8_t *buf, size_t len)
+    {
+        while (len) {
+            uint16_t n = len > 0xffff ? 0xffff : len;
+            runOncePart((char *)buf, n);
+            buf += n;
+            len -= n;
+        }
+    }
+
+  protected:
+    bool handleToRadio(const uint8_t *buf, size_t len) override
+    {
+        frameCount++;
+        if (keepFrames)
+            frames.push_back(Bytes(buf, buf + len));
+        return true;
+    }
+
+    bool checkIsConnected() override { return false; }
+};
+
+/// Records each ToRadio a write to PhoneAPI::handleToRadio() is split into
+class BatchAPI : public StreamAPI
+{
+  public:
+    std::vector<Bytes> messages;
+
+    explicit BatchAPI(Stream *s) : StreamAPI(s) { canWrite = false; }
+
+  protected:
+    bool handleToRadioMessage(const uint8_t *buf, size_t len) override
+    {
+        messages.push_back(Bytes(buf, buf + len));
+        return true;
+    }
+
+    bool checkIsConnected() override { return false; }
+};
+
+void assertFramesEqual(const std::vector<Bytes> &expected, const std::vector<Bytes> &actual)
+{
+    TEST_ASSERT_EQUAL_UINT32(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        TEST_ASSERT_EQUAL_UINT32(expected[i].size(), actual[i].size());
+        if (!expected[i].empty())
+            TEST_ASSERT_EQUAL_MEMORY(expected[i].data(), actual[i].data(), expected[i].size());
+    }
+}
+
+} // namespace
+
+// Good frames separated by debug text (which never contains START1) must all come through intact
+void test_framesBetweenNoise()
+{
+    uint32_t state = 1;
+    Bytes in;
+    std::vector<Bytes> expected;
+    for (int i = 0; i < 200; i++) {
+        size_t noise = nextRandom(state) % 40;
+        for (size_t n = 0; n < noise; n++)
+            in.push_back(' ' + nextRandom(state) % 95);
+        expected.push_back(randomPayload(state, MAX_TO_FROM_RADIO_SIZE));
+        appendFrame(in, expected.back());
+    }
+
+    FakeStream stream;
+    TestStreamAPI api(&stream);
+    api.feed(in.data(), in.size());
+    assertFramesEqual(expected, api.frames);
+}
+
+// A corrupt length or a doubled START1 must not cost us the frame right after it
+void test_resync()
+{
+    Bytes in = {START1, START2, 0xff, 0xff, START1, START1, START2, 0x00, 0x02, 'o', 'k', START1, START2, 0x00, 0x00};
+    FakeStream stream;
+    TestStreamAPI api(&stream);
+    api.feed(in.data(), in.size());
+    std::vector<Bytes> expected = {Bytes{'o', 'k'}, Bytes{}};
+    assertFramesEqual(expected, api.frames);
+}
+
+// However random input is split up, and whether it arrives in a buffer or from the Stream, we must find exactly the frames
+// the plain byte at a time rules do
+void test_fuzzFraming()
+{
+    uint32_t state = 12345;
+    for (int round = 0; round < FUZZ_ROUNDS; round++) {
+        Bytes in(nextRandom(state) % FUZZ_MAX_INPUT);
+        for (auto &b : in)
+            b = nastyByte(state);
+        // Real frames too, or almost everything random gets thrown away at the length check
+        if (round & 1) {
+            Bytes frame;
+            appendFrame(frame, randomPayload(state, 64));
+            size_t at = in.empty() ? 0 : nextRandom(state) % in.size();
+            in.insert(in.begin() + at, frame.begin(), frame.end());
+        }
+        std::vector<Bytes> expected = referenceParse(in);
+
+        FakeStream stream;
+        TestStreamAPI whole(&stream), split(&stream), fromStream(&stream);
+        whole.feed(in.data(), in.size());
+
+        for (size_t pos = 0; pos < in.size();) {
+            size_t n = 1 + nextRandom(state) % 80;
+            n = n > in.size() - pos ? in.size() - pos : n;
+            split.feed(in.data() + pos, n);
+            pos += n;
+        }
+
+        stream.rx = in;
+        while (stream.available())
+            fromStream.runOncePart();
+
+        assertFramesEqual(expected, whole.frames);
+        assertFramesEqual(expected, split.frames);
+        assertFramesEqual(expected, fromStream.frames);
+    }
+}
+
+// Encoding never emits a zero and decodes back to what we started with
+// A write holding several framed ToRadio is handled as each of them, an unframed one as a single ToRadio
+void test_batchedToRadio()
+{
+    FakeStream stream;
+    BatchAPI api(&stream);
+
+    const Bytes single = {0x38, 0x01}; // A ToRadio, heartbeat
+    TEST_ASSERT_TRUE(api.handleToRadio(single.data(), single.size()));
+    assertFramesEqual({single}, api.messages);
+
+    api.messages.clear();
+    std::vector<Bytes> expected = {{0x18, 0x2a}, {}, single, Bytes(MAX_TO_FROM_RADIO_SIZE, 0x55)};
+    Bytes batch;
+    for (const Bytes &m : expected)
+        appendFrame(batch, m);
+    TEST_ASSERT_TRUE(api.handleToRadio(batch.data(), batch.size()));
+    assertFramesEqual(expected, api.messages);
+
+    // A truncated last frame is dropped, the ones before it still count
+    api.messages.clear();
+    batch.resize(batch.size() - 1);
+    api.handleToRadio(batch.data(), batch.size());
+    expected.pop_back();
+    assertFramesEqual(expected, api.messages);
+}
+
+void test_cobsRoundTrip()
+{
+    uint32_t state = 99;
+    for (int round = 0; round < FUZZ_ROUNDS; round++) {
+        Bytes src(1 + nextRandom(state) % 1000);
+        for (auto &b : src)
+            b = (nextRandom(state) & 3) ? 0 : nextRandom(state); // Mostly zeros, the interesting case for COBS
+        if (round % 7 == 0)
+            for (auto &b : src)
+                b = 1 + nextRandom(state) % 255; // And long runs without any, for the 254 byte block limit
+
+        Bytes enc(COBS_ENCODE_DST_BUF_LEN_MAX(src.size()) + 1);
+        cobs_encode_result er = cobs_encode(enc.data(), enc.size(), src.data(), src.size());
+        TEST_ASSERT_EQUAL(COBS_ENCODE_OK, er.status);
+        for (size_t i = 0; i < er.out_len; i++)
+            TEST_ASSERT_NOT_EQUAL(0, enc[i]);
+
+        Bytes dec(src.size() + 1);
+        cobs_decode_result dr = cobs_decode(dec.data(), dec.size(), enc.data(), er.out_len);
+        TEST_ASSERT_EQUAL(COBS_DECODE_OK, dr.status);
+        TEST_ASSERT_EQUAL_UINT32(src.size(), dr.out_len);
+        TEST_ASSERT_EQUAL_MEMORY(src.data(), dec.data(), src.size());
+    }
+}
+
+// Garbage in must at worst be reported, never written past the end of the output buffer
+void test_cobsDecodeGarbage()
+{
+    const uint8_t guard = 0xa5;
+    uint32_t state = 7;
+    for (int round = 0; round < FUZZ_ROUNDS; round++) {
+        Bytes src(nextRandom(state) % 600);
+        for (auto &b : src)
+            b = nastyByte(state);
+        size_t dstLen = nextRandom(state) % 600;
+
+        Bytes dst(dstLen + 16, guard);
+        cobs_decode_result dr = cobs_decode(dst.data(), dstLen, src.data(), src.size());
+        TEST_ASSERT_TRUE(dr.out_len <= dstLen);
+        for (size_t i = dstLen; i < dst.size(); i++)
+            TEST_ASSERT_EQUAL_HEX8(guard, dst[i]);
+    }
+}
+
+void test_throughput()
+{
+    FakeStream stream;
+    uint32_t state = 3;
+    const uint32_t sizes[] = {16, 64, MAX_TO_FROM_RADIO_SIZE};
+    for (uint32_t size : sizes) {
+        Bytes in;
+        while (in.size() < BENCH_BYTES) {
+            Bytes payload(size);
+            for (auto &b : payload)
+                b = nextRandom(state);
+            appendFrame(in, payload);
+        }
+        uint32_t frames = in.size() / (size + STREAM_HEADER_LEN);
+
+        TestStreamAPI buffered(&stream);
+        buffered.keepFrames = false;
+        uint64_t start = nowNs();
+        buffered.feed(in.data(), in.size());
+        report("stream_parse_buffer", size, frames, nowNs() - start);
+        TEST_ASSERT_EQUAL_UINT32(frames, buffered.frameCount);
+
+        // A serial port hands us a few bytes at a time, so most frames are split and go through rxBuf
+        TestStreamAPI split(&stream);
+        split.keepFrames = false;
+        start = nowNs();
+        for (size_t pos = 0; pos < in.size(); pos += 60)
+            split.feed(in.data() + pos, in.size() - pos < 60 ? in.size() - pos : 60);
+        report("stream_parse_split60", size, frames, nowNs() - start);
+        TEST_ASSERT_EQUAL_UINT32(frames, split.frameCount);
+
+        TestStreamAPI fromStream(&stream);
+        fromStream.keepFrames = false;
+        stream.rx = in;
+        stream.rxPos = 0;
+        start = nowNs();
+        while (stream.available())
+            fromStream.runOncePart();
+        report("stream_parse_stream", size, frames, nowNs() - start);
+        TEST_ASSERT_EQUAL_UINT32(frames, fromStream.frameCount);
+    }
+
+    Bytes src(MAX_TO_FROM_RADIO_SIZE), enc(COBS_ENCODE_DST_BUF_LEN_MAX(MAX_TO_FROM_RADIO_SIZE)), dec(MAX_TO_FROM_RADIO_SIZE);
+    for (auto &b : src)
+        b = (nextRandom(state) & 7) ? nextRandom(state) : 0;
+    const uint32_t rounds = BENCH_BYTES / MAX_TO_FROM_RADIO_SIZE;
+    size_t encLen = 0, decLen = 0;
+    uint64_t start = nowNs();
+    for (uint32_t r = 0; r < rounds; r++)
+        encLen = cobs_encode(enc.data(), enc.size(), src.data(), src.size()).out_len;
+    report("cobs_encode", src.size(), rounds, nowNs() - start);
+    start = nowNs();
+    for (uint32_t r = 0; r < rounds; r++)
+        decLen = cobs_decode(dec.data(), dec.size(), enc.data(), encLen).out_len;
+    report("cobs_decode", src.size(), rounds, nowNs() - start);
+    TEST_ASSERT_EQUAL_UINT32(src.size(), decLen);
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_framesBetweenNoise);
+    RUN_TEST(test_resync);
+    RUN_TEST(test_fuzzFraming);
+    RUN_TEST(test_batchedToRadio);
+    RUN_TEST(test_cobsRoundTrip);
+    RUN_TEST(test_cobsDecodeGarbage);
+    RUN_TEST(test_throughput);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
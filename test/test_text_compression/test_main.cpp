@@ -0,0 +1,251 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "PortduinoGlue.h"
+#include "RTC.h"
+#include "mesh/NodeDB.h"
+#include "mesh/Router.h"
+#include "mesh/TextCompression.h"
+#include "mesh/compression/unishox2.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_ROUNDS 2000
+
+// LongFast is SF11 at 250 kHz with 4/5 coding: 8.192 ms symbols of 11 bits, 5/4 of them per 8 bits of payload
+#define LONGFAST_NS_PER_BYTE (8192000.0 * 8 / 11 * 5 / 4)
+
+namespace
+{
+
+const char *messages[] = {
+    "ok",
+    "lol yes",
+    "On my way, ETA 15 minutes",
+    "Testing 1 2 3, signal report please",
+    "Hello everyone, is anyone on the mesh tonight?",
+    "Check https://meshtastic.org for the docs",
+    "Temperature is 21.5C, humidity 40%, all good here",
+    "Ünïcödé tëxt ☃ ok",
+    "The quick brown fox jumps over the lazy dog near the river bank at 5pm.",
+    "Meet at the trailhead parking lot by the north entrance, bring water and a radio. Weather looks good for Saturday.",
+};
+
+uint64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Same "BENCH " JSON lines as test_bench_router
+void report(const char *name, uint32_t size, uint32_t ops, uint64_t ns)
+{
+    printf("BENCH {\"name\":\"%s\",\"size\":%u,\"ops\":%u,\"ns_per_op\":%.1f}\n", name, size, ops, (double)ns / ops);
+}
+
+uint32_t nextRandom(uint32_t &state)
+{
+    state = state * 1664525 + 1013904223;
+    return state >> 8;
+}
+
+meshtastic_Data makeText(const char *text)
+{
+    meshtastic_Data d = meshtastic_Data_init_zero;
+    d.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
+    d.payload.size = strlen(text);
+    memcpy(d.payload.bytes, text, d.payload.size);
+    return d;
+}
+
+meshtastic_MeshPacket makePacket(NodeNum to, uint8_t channel, const char *text)
+{
+    meshtastic_MeshPacket p = meshtastic_MeshPacket_init_zero;
+    p.from = nodeDB->getNodeNum();
+    p.to = to;
+    p.channel = channel;
+    p.which_payload_variant = meshtastic_MeshPacket_decoded_tag;
+    p.decoded = makeText(text);
+    return p;
+}
+
+// A node we heard lately on channel, which may or may not have said it reads compressed text
+void addNode(NodeNum num, uint8_t channel, bool readsCompressed)
+{
+    meshtastic_User user = meshtastic_User_init_zero;
+    nodeDB->updateUser(num, user, channel);
+    meshtastic_NodeInfoLite *node = nodeDB->getMeshNode(num);
+    node->channel = channel;
+    node->last_heard = getTime();
+
+    meshtastic_Data nodeInfo = meshtastic_Data_init_zero;
+    nodeInfo.has_bitfield = readsCompressed;
+    nodeInfo.bitfield = readsCompressed ? BITFIELD_READS_COMPRESSED_TEXT_MASK : 0;
+    TextCompression::heardNodeInfo(num, nodeInfo);
+}
+
+} // namespace
+
+void test_roundTrip()
+{
+    for (const char *text : messages) {
+        meshtastic_Data d = makeText(text);
+        bool smaller = TextCompression::compress(d);
+        if (!smaller) {
+            TEST_ASSERT_EQUAL(meshtastic_PortNum_TEXT_MESSAGE_APP, d.portnum);
+            continue;
+        }
+        TEST_ASSERT_EQUAL(meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP, d.portnum);
+        TEST_ASSERT_TRUE(d.payload.size < strlen(text));
+        TEST_ASSERT_TRUE(TextCompression::decompress(d));
+        TEST_ASSERT_EQUAL(meshtastic_PortNum_TEXT_MESSAGE_APP, d.portnum);
+        TEST_ASSERT_EQUAL_UINT32(strlen(text), d.payload.size);
+        TEST_ASSERT_EQUAL_MEMORY(text, d.payload.bytes, d.payload.size);
+    }
+}
+
+// Random bytes almost never get smaller, when they don't the payload must be left just as it was
+void test_randomPayloads()
+{
+    uint32_t state = 17;
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        meshtastic_Data d = meshtastic_Data_init_zero;
+        d.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
+        d.payload.size = 2 + nextRandom(state) % (sizeof(d.payload.bytes) - 1);
+        for (size_t i = 0; i < d.payload.size; i++)
+            d.payload.bytes[i] = (round & 1) ? nextRandom(state) : ' ' + nextRandom(state) % 95;
+        meshtastic_Data original = d;
+
+        if (TextCompression::compress(d)) {
+            TEST_ASSERT_TRUE(TextCompression::decompress(d));
+        }
+        TEST_ASSERT_EQUAL_UINT32(original.payload.size, d.payload.size);
+        TEST_ASSERT_EQUAL_MEMORY(original.payload.bytes, d.payload.bytes, d.payload.size);
+    }
+}
+
+// A few bytes can expand to far more than a packet holds, that must be refused rather than overflow the payload
+void test_decompressOverflow()
+{
+    char text[600];
+    memset(text, 'x', sizeof(text)); // Not a hex digit, those get a run of nibbles instead of a repeat
+    meshtastic_Data d = meshtastic_Data_init_zero;
+    d.portnum = meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP;
+    d.payload.size = unishox2_compress((const char *)text, sizeof(text), (char *)d.payload.bytes, sizeof(d.payload.bytes),
+                                       USX_PSET_DFLT);
+    TEST_ASSERT_TRUE(d.payload.size < 16);
+    meshtastic_Data original = d;
+
+    TEST_ASSERT_FALSE(TextCompression::decompress(d));
+    TEST_ASSERT_EQUAL(meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP, d.portnum);
+    TEST_ASSERT_EQUAL_UINT32(original.payload.size, d.payload.size);
+}
+
+void test_wanted()
+{
+    const char *text = "Hello everyone, is anyone on the mesh tonight?";
+    const NodeNum reader = 0x1000, oldFirmware = 0x2000, elsewhere = 0x3000;
+    nodeDB->resetNodes();
+    addNode(reader, 0, true);
+    addNode(oldFirmware, 1, false);
+    addNode(elsewhere, 2, true);
+
+    TextCompression::channelMask = 0;
+    meshtastic_MeshPacket p = makePacket(reader, 0, text);
+    TEST_ASSERT_FALSE(TextCompression::wanted(&p)); // Nothing opted in
+
+    TextCompression::channelMask = 0x7;
+    TEST_ASSERT_TRUE(TextCompression::wanted(&p));
+    p = makePacket(oldFirmware, 1, text);
+    TEST_ASSERT_FALSE(TextCompression::wanted(&p));
+    p = makePacket(0x4000, 0, text);
+    TEST_ASSERT_FALSE(TextCompression::wanted(&p)); // Never heard of it
+
+    p = makePacket(NODENUM_BROADCAST, 0, text);
+    TEST_ASSERT_TRUE(TextCompression::wanted(&p)); // Everyone on channel 0 can read it
+    p = makePacket(NODENUM_BROADCAST, 1, text);
+    TEST_ASSERT_FALSE(TextCompression::wanted(&p)); // Someone on channel 1 can't
+    p = makePacket(NODENUM_BROADCAST, 3, text);
+    TEST_ASSERT_FALSE(TextCompression::wanted(&p)); // Nobody is listening there
+
+    // An old NodeInfo from the same node takes it back
+    meshtastic_Data nodeInfo = meshtastic_Data_init_zero;
+    TextCompression::heardNodeInfo(reader, nodeInfo);
+    p = makePacket(reader, 0, text);
+    TEST_ASSERT_FALSE(TextCompression::wanted(&p));
+
+    // Someone else's text that we decompressed is compressed again when we relay it, and only then
+    TextCompression::channelMask = 0;
+    p = makePacket(NODENUM_BROADCAST, 1, text);
+    p.from = oldFirmware;
+    TEST_ASSERT_FALSE(TextCompression::wanted(&p));
+    p.decoded.bitfield |= BITFIELD_WAS_COMPRESSED_MASK;
+    TEST_ASSERT_TRUE(TextCompression::wanted(&p));
+    TextCompression::channelMask = TEXT_COMPRESS_CHANNELS;
+}
+
+// What compressing costs against the LongFast airtime it saves, for every message in the list
+void test_benchmark()
+{
+    uint64_t compressNs = 0, decompressNs = 0;
+    uint32_t before = 0, after = 0;
+    for (const char *text : messages) {
+        meshtastic_Data packed = makeText(text);
+        uint64_t start = nowNs();
+        for (int r = 0; r < BENCH_ROUNDS; r++) {
+            packed = makeText(text);
+            TextCompression::compress(packed);
+        }
+        uint64_t ns = nowNs() - start;
+        report("text_compress", strlen(text), BENCH_ROUNDS, ns);
+        compressNs += ns / BENCH_ROUNDS;
+        before += strlen(text);
+        after += packed.payload.size;
+
+        if (packed.portnum != meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP)
+            continue;
+        meshtastic_Data unpacked;
+        start = nowNs();
+        for (int r = 0; r < BENCH_ROUNDS; r++) {
+            unpacked = packed;
+            TextCompression::decompress(unpacked);
+        }
+        ns = nowNs() - start;
+        report("text_decompress", packed.payload.size, BENCH_ROUNDS, ns);
+        decompressNs += ns / BENCH_ROUNDS;
+    }
+
+    double savedNs = (before - after) * LONGFAST_NS_PER_BYTE;
+    printf("BENCH {\"name\":\"text_airtime\",\"bytes_before\":%u,\"bytes_after\":%u,\"cpu_ns\":%llu,\"airtime_saved_ns\":%.0f}\n",
+           before, after, (unsigned long long)(compressNs + decompressNs), savedNs);
+    TEST_ASSERT_TRUE(after < before);
+    TEST_ASSERT_TRUE(compressNs + decompressNs < savedNs);
+}
+
+void setup()
+{
+    settingsMap[logoutputlevel] = level_warn;
+    initializeTestEnvironment();
+    nodeDB = new NodeDB();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_roundTrip);
+    RUN_TEST(test_randomPayloads);
+    RUN_TEST(test_decompressOverflow);
+    RUN_TEST(test_wanted);
+    RUN_TEST(test_benchmark);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
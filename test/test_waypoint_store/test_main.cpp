@@ -0,0 +1,154 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "gps/GeoCoord.h"
+#include "modules/WaypointStore.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace
+{
+
+meshtastic_Waypoint waypoint(uint32_t id, uint32_t expire, int32_t lat = 0, int32_t lon = 0, bool hasPosition = true)
+{
+    meshtastic_Waypoint wp;
+    memset(&wp, 0, sizeof(wp));
+    wp.id = id;
+    wp.expire = expire;
+    wp.has_latitude_i = wp.has_longitude_i = hasPosition;
+    wp.latitude_i = lat;
+    wp.longitude_i = lon;
+    snprintf(wp.name, sizeof(wp.name), "wp%u", id);
+    return wp;
+}
+
+} // namespace
+
+void test_updateAndDelete()
+{
+    WaypointStore store(nullptr);
+    TEST_ASSERT_TRUE(store.update(waypoint(1, 2000), 0x10, 1000));
+    TEST_ASSERT_TRUE(store.update(waypoint(2, 0), 0x10, 1000));
+    TEST_ASSERT_EQUAL(2, store.size());
+    TEST_ASSERT_EQUAL_STRING("wp1", store.find(1)->waypoint.name);
+
+    meshtastic_Waypoint renamed = waypoint(1, 3000);
+    strcpy(renamed.name, "camp");
+    store.update(renamed, 0x11, 1100);
+    TEST_ASSERT_EQUAL(2, store.size());
+    TEST_ASSERT_EQUAL_STRING("camp", store.find(1)->waypoint.name);
+    TEST_ASSERT_EQUAL_UINT32(0x11, store.find(1)->from);
+
+    // The apps delete a waypoint by sending it again with an expiry in the past
+    store.update(waypoint(1, 1), 0x10, 1200);
+    TEST_ASSERT_NULL(store.find(1));
+    TEST_ASSERT_EQUAL(1, store.size());
+}
+
+void test_lockedTo()
+{
+    WaypointStore store(nullptr);
+    meshtastic_Waypoint wp = waypoint(7, 0);
+    wp.locked_to = 0x10;
+    store.update(wp, 0x10, 1000);
+    TEST_ASSERT_FALSE(store.update(waypoint(7, 1), 0x20, 1100));
+    TEST_ASSERT_NOT_NULL(store.find(7));
+    TEST_ASSERT_TRUE(store.update(waypoint(7, 1), 0x10, 1100));
+    TEST_ASSERT_NULL(store.find(7));
+}
+
+// Purging drops what is due, and not a waypoint whose old expiry was replaced with a later one
+void test_purge()
+{
+    WaypointStore store(nullptr);
+    for (uint32_t id = 1; id <= 10; id++)
+        store.update(waypoint(id, 1000 + id * 100), 0, 500);
+    store.update(waypoint(3, 5000), 0, 600);
+    store.update(waypoint(11, 0), 0, 600);
+
+    TEST_ASSERT_EQUAL(0, store.purge(1000));
+    TEST_ASSERT_EQUAL(4, store.purge(1500)); // 1, 2, 4 and 5
+    TEST_ASSERT_NOT_NULL(store.find(3));
+    TEST_ASSERT_NULL(store.find(5));
+    TEST_ASSERT_EQUAL(5, store.purge(4000));
+    TEST_ASSERT_EQUAL(1, store.purge(5000));
+    TEST_ASSERT_EQUAL(1, store.size());
+    TEST_ASSERT_NOT_NULL(store.find(11));
+}
+
+// The latitude band search finds the same waypoint as measuring every one
+void test_nearest()
+{
+    WaypointStore store(nullptr);
+    float meters;
+    TEST_ASSERT_NULL(store.nearest(0, 0, &meters));
+    store.update(waypoint(1000, 0, 0, 0, false), 0, 1);
+    TEST_ASSERT_NULL(store.nearest(0, 0, &meters));
+
+    srand(1);
+    const int32_t baseLat = 473000000, baseLon = 85000000;
+    for (uint32_t id = 1; id <= 300; id++)
+        store.update(waypoint(id, 0, baseLat + rand() % 2000000 - 1000000, baseLon + rand() % 2000000 - 1000000), 0, 1);
+
+    for (int i = 0; i < 50; i++) {
+        int32_t lat = baseLat + rand() % 3000000 - 1500000, lon = baseLon + rand() % 3000000 - 1500000;
+        GeoOrigin origin(lat, lon);
+        const WaypointStore::Entry *expected = nullptr;
+        float expectedMeters = 0;
+        store.forEach([&](const WaypointStore::Entry &e) {
+            if (!e.waypoint.has_latitude_i)
+                return;
+            float d = origin.distanceTo(e.waypoint.latitude_i, e.waypoint.longitude_i);
+            if (!expected || d < expectedMeters) {
+                expected = &e;
+                expectedMeters = d;
+            }
+        });
+        const WaypointStore::Entry *got = store.nearest(lat, lon, &meters);
+        TEST_ASSERT_EQUAL_PTR(expected, got);
+        TEST_ASSERT_EQUAL_FLOAT(expectedMeters, meters);
+    }
+}
+
+// When full, the waypoint that expires soonest makes room, then the one heard longest ago
+void test_bounded()
+{
+    WaypointStore store(nullptr);
+    for (uint32_t id = 1; id <= WAYPOINT_STORE_MAX; id++)
+        store.update(waypoint(id, 0), 0, 100 + id);
+    store.update(waypoint(5, 9000), 0, 100 + WAYPOINT_STORE_MAX);
+    store.update(waypoint(WAYPOINT_STORE_MAX + 1, 0), 0, 2000);
+    TEST_ASSERT_EQUAL(WAYPOINT_STORE_MAX, store.size());
+    TEST_ASSERT_NULL(store.find(5));
+
+    store.update(waypoint(WAYPOINT_STORE_MAX + 2, 0), 0, 2001);
+    TEST_ASSERT_EQUAL(WAYPOINT_STORE_MAX, store.size());
+    TEST_ASSERT_NULL(store.find(1));
+    TEST_ASSERT_NOT_NULL(store.find(2));
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_updateAndDelete);
+    RUN_TEST(test_lockedTo);
+    RUN_TEST(test_purge);
+    RUN_TEST(test_nearest);
+    RUN_TEST(test_bounded);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
@@ -0,0 +1,130 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "mesh/MemoryPool.h"
+#include "mesh/WirePacket.h"
+
+#include <string.h>
+
+namespace
+{
+
+meshtastic_MeshPacket *received(size_t payloadLen)
+{
+    meshtastic_MeshPacket *p = packetPool.allocZeroed();
+    p->from = 0x1234;
+    p->to = 0xffffffff;
+    p->id = 0xabcdef;
+    p->channel = 8;
+    p->which_payload_variant = meshtastic_MeshPacket_encrypted_tag;
+    p->rx_time = 1700000000;
+    p->rx_snr = -7.25f;
+    p->rx_rssi = -110;
+    p->hop_limit = 2;
+    p->hop_start = 3;
+    p->want_ack = true;
+    p->via_mqtt = true;
+    p->next_hop = 0x56;
+    p->relay_node = 0x78;
+    p->encrypted.size = payloadLen;
+    for (size_t i = 0; i < payloadLen; i++)
+        p->encrypted.bytes[i] = i * 7;
+    return p;
+}
+
+void assertRoundTrip(size_t payloadLen)
+{
+    meshtastic_MeshPacket *p = received(payloadLen);
+    meshtastic_MeshPacket expected = *p;
+
+    WirePacket *w = WirePacket::fromPacket(p);
+    TEST_ASSERT_NULL(w->full);
+    TEST_ASSERT_EQUAL(payloadLen > WIRE_PACKET_SMALL_BYTES, w->large);
+
+    meshtastic_MeshPacket *got = w->expand();
+    TEST_ASSERT_EQUAL_UINT32(expected.from, got->from);
+    TEST_ASSERT_EQUAL_UINT32(expected.to, got->to);
+    TEST_ASSERT_EQUAL_UINT32(expected.id, got->id);
+    TEST_ASSERT_EQUAL_UINT8(expected.channel, got->channel);
+    TEST_ASSERT_EQUAL_UINT32(expected.rx_time, got->rx_time);
+    TEST_ASSERT_EQUAL_FLOAT(expected.rx_snr, got->rx_snr);
+    TEST_ASSERT_EQUAL_INT32(expected.rx_rssi, got->rx_rssi);
+    TEST_ASSERT_EQUAL_UINT8(expected.hop_limit, got->hop_limit);
+    TEST_ASSERT_EQUAL_UINT8(expected.hop_start, got->hop_start);
+    TEST_ASSERT_EQUAL(expected.want_ack, got->want_ack);
+    TEST_ASSERT_EQUAL(expected.via_mqtt, got->via_mqtt);
+    TEST_ASSERT_EQUAL_UINT8(expected.next_hop, got->next_hop);
+    TEST_ASSERT_EQUAL_UINT8(expected.relay_node, got->relay_node);
+    TEST_ASSERT_EQUAL(meshtastic_MeshPacket_encrypted_tag, got->which_payload_variant);
+    TEST_ASSERT_EQUAL(payloadLen, got->encrypted.size);
+    if (payloadLen)
+        TEST_ASSERT_EQUAL_MEMORY(expected.encrypted.bytes, got->encrypted.bytes, payloadLen);
+    packetPool.release(got);
+}
+
+} // namespace
+
+void test_roundTripSmall()
+{
+    assertRoundTrip(0);
+    assertRoundTrip(20);
+    assertRoundTrip(WIRE_PACKET_SMALL_BYTES);
+}
+
+void test_roundTripLarge()
+{
+    assertRoundTrip(WIRE_PACKET_SMALL_BYTES + 1);
+    assertRoundTrip(WIRE_PACKET_LARGE_BYTES);
+}
+
+// A decoded packet can't be compacted, it is passed through untouched
+void test_decodedHeldWhole()
+{
+    meshtastic_MeshPacket *p = received(0);
+    p->which_payload_variant = meshtastic_MeshPacket_decoded_tag;
+    p->decoded.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
+
+    WirePacket *w = WirePacket::fromPacket(p);
+    TEST_ASSERT_EQUAL_PTR(p, w->full);
+    meshtastic_MeshPacket scratch;
+    TEST_ASSERT_EQUAL_PTR(p, w->view(scratch));
+    TEST_ASSERT_EQUAL_PTR(p, w->expand());
+    packetPool.release(p);
+}
+
+// Releasing without expanding gives back everything, so the pool ends where it started
+void test_releaseFreesPacket()
+{
+    AllocatorStats before, after;
+    TEST_ASSERT_TRUE(packetPool.getStats(before));
+    meshtastic_MeshPacket *p = received(10);
+    p->which_payload_variant = meshtastic_MeshPacket_decoded_tag;
+    WirePacket::fromPacket(p)->release();
+    WirePacket::fromPacket(received(10))->release();
+    TEST_ASSERT_TRUE(packetPool.getStats(after));
+    TEST_ASSERT_EQUAL_UINT32(before.inUse, after.inUse);
+}
+
+void setup()
+{
+    initializeTestEnvironment();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_roundTripSmall);
+    RUN_TEST(test_roundTripLarge);
+    RUN_TEST(test_decodedHeldWhole);
+    RUN_TEST(test_releaseFreesPacket);
+    exit(UNITY_END());
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}
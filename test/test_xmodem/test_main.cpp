@@ -0,0 +1,270 @@
+#include "DebugConfiguration.h"
+#include "TestUtil.h"
+#include <unity.h>
+
+#ifdef ARCH_PORTDUINO
+#include "PortduinoGlue.h"
+#include "SPILock.h"
+#include "xmodem.h"
+
+#include <map>
+#include <string>
+
+#define TEST_FILE "/xmodem_test.bin"
+
+namespace
+{
+
+// The helpers a client would have to reimplement
+class TestXModem : public XModemAdapter
+{
+  public:
+    using XModemAdapter::crc16_ccitt;
+};
+
+TestXModem xm;
+
+uint32_t nextRandom(uint32_t &state)
+{
+    state = state * 1664525 + 1013904223;
+    return state >> 8;
+}
+
+std::string makeData(size_t size, uint32_t seed)
+{
+    std::string data(size, '\0');
+    for (size_t i = 0; i < size; i++)
+        data[i] = nextRandom(seed);
+    return data;
+}
+
+// What the phone API would hand the phone next, the way PhoneAPI::available() takes it
+meshtastic_XModem take()
+{
+    meshtastic_XModem p = xm.getForPhone();
+    xm.resetForPhone();
+    return p;
+}
+
+meshtastic_XModem control(meshtastic_XModem_Control c, uint16_t seq = 0, uint16_t crc16 = 0, const char *name = NULL)
+{
+    meshtastic_XModem p = meshtastic_XModem_init_zero;
+    p.control = c;
+    p.seq = seq;
+    p.crc16 = crc16;
+    if (name) {
+        p.buffer.size = strlen(name);
+        memcpy(p.buffer.bytes, name, p.buffer.size);
+    }
+    return p;
+}
+
+meshtastic_XModem block(const std::string &data, uint16_t seq)
+{
+    meshtastic_XModem p = meshtastic_XModem_init_zero;
+    p.control = meshtastic_XModem_Control_SOH;
+    p.seq = seq;
+    size_t offset = (seq - 1) * sizeof(p.buffer.bytes);
+    p.buffer.size = offset >= data.size() ? 0 : data.size() - offset;
+    if (p.buffer.size > sizeof(p.buffer.bytes))
+        p.buffer.size = sizeof(p.buffer.bytes);
+    memcpy(p.buffer.bytes, data.data() + offset, p.buffer.size);
+    p.crc16 = xm.crc16_ccitt(p.buffer.bytes, p.buffer.size);
+    return p;
+}
+
+std::string readBack()
+{
+    std::string data;
+    spiLock->lock();
+    File f = FSCom.open(TEST_FILE, FILE_O_READ);
+    uint8_t buf[256];
+    for (size_t n; f && (n = f.read(buf, sizeof(buf))) > 0;)
+        data.append((const char *)buf, n);
+    f.close();
+    spiLock->unlock();
+    return data;
+}
+
+void writeTestFile(const std::string &data)
+{
+    spiLock->lock();
+    File f = FSCom.open(TEST_FILE, FILE_O_WRITE);
+    f.write((const uint8_t *)data.data(), data.size());
+    f.close();
+    spiLock->unlock();
+}
+
+// A client that streams a window of blocks, of which every other try at every fifth one is corrupted on the way
+void upload(const std::string &data, uint8_t askWindow)
+{
+    xm.handlePacket(control(meshtastic_XModem_Control_SOH, 0, XMODEM_WINDOW_MAGIC | askWindow, TEST_FILE));
+    meshtastic_XModem reply = take();
+    TEST_ASSERT_EQUAL(meshtastic_XModem_Control_ACK, reply.control);
+    uint8_t window = (reply.crc16 & 0xff00) == XMODEM_WINDOW_MAGIC ? reply.crc16 & 0xff : 1;
+    TEST_ASSERT_EQUAL_UINT8(askWindow > XMODEM_MAX_WINDOW ? XMODEM_MAX_WINDOW : askWindow, window);
+
+    uint16_t lastBlock = data.size() / sizeof(reply.buffer.bytes) + 1, acked = 0, next = 1;
+    uint32_t tries = 0;
+    while (acked < lastBlock) {
+        TEST_ASSERT_TRUE(tries < 10000);
+        meshtastic_XModem answer = meshtastic_XModem_init_zero; // Only the newest answer is kept for the phone
+        for (; next <= lastBlock && next <= acked + window; next++) {
+            meshtastic_XModem p = block(data, next);
+            if (next % 5 == 2 && tries++ % 2 == 0)
+                p.crc16 ^= 1;
+            xm.handlePacket(p);
+            meshtastic_XModem a = take();
+            if (a.control != meshtastic_XModem_Control_NUL)
+                answer = a;
+        }
+        if (answer.control == meshtastic_XModem_Control_ACK) {
+            acked = answer.seq;
+        } else {
+            // Selective retransmit, the blocks after it are already there
+            TEST_ASSERT_EQUAL(meshtastic_XModem_Control_NAK, answer.control);
+            xm.handlePacket(block(data, answer.seq));
+            meshtastic_XModem a = take();
+            acked = a.control == meshtastic_XModem_Control_ACK ? a.seq : answer.seq - 1;
+            if (next <= acked)
+                next = acked + 1;
+        }
+    }
+    xm.handlePacket(control(meshtastic_XModem_Control_EOT));
+    TEST_ASSERT_EQUAL(meshtastic_XModem_Control_ACK, take().control);
+}
+
+// A client that keeps blocks which arrive ahead of a lost one, and NAKs when nothing comes
+std::string download(uint8_t askWindow, uint32_t *blocksSent)
+{
+    xm.handlePacket(control(meshtastic_XModem_Control_STX, 0, askWindow ? XMODEM_WINDOW_MAGIC | askWindow : 0, TEST_FILE));
+    std::map<uint16_t, std::string> have;
+    uint16_t expect = 1;
+    uint32_t lost = 0, stalls = 0;
+    *blocksSent = 0;
+    for (;;) {
+        meshtastic_XModem p = take();
+        if (p.control == meshtastic_XModem_Control_NUL) {
+            TEST_ASSERT_TRUE(++stalls < 100);
+            xm.handlePacket(control(meshtastic_XModem_Control_NAK, expect));
+            continue;
+        }
+        if (p.control == meshtastic_XModem_Control_EOT)
+            break;
+        TEST_ASSERT_EQUAL(meshtastic_XModem_Control_SOH, p.control);
+        TEST_ASSERT_EQUAL_UINT16(xm.crc16_ccitt(p.buffer.bytes, p.buffer.size), p.crc16);
+        (*blocksSent)++;
+        if (askWindow && p.seq % 5 == 2 && lost++ % 2 == 0)
+            continue;
+        have[p.seq] = std::string((const char *)p.buffer.bytes, p.buffer.size);
+        while (have.count(expect))
+            expect++;
+        if (!askWindow)
+            xm.handlePacket(control(meshtastic_XModem_Control_ACK));
+        else if (p.seq < expect)
+            xm.handlePacket(control(meshtastic_XModem_Control_ACK, expect - 1));
+        else
+            xm.handlePacket(control(meshtastic_XModem_Control_NAK, expect));
+    }
+    std::string data;
+    for (auto &b : have)
+        data += b.second;
+    return data;
+}
+
+const size_t sizes[] = {0, 1, 128, 129, 1000, 5000};
+
+} // namespace
+
+void test_uploadClassic()
+{
+    for (size_t size : sizes) {
+        std::string data = makeData(size, size);
+        xm.handlePacket(control(meshtastic_XModem_Control_SOH, 0, 0, TEST_FILE));
+        meshtastic_XModem reply = take();
+        TEST_ASSERT_EQUAL(meshtastic_XModem_Control_ACK, reply.control);
+        TEST_ASSERT_EQUAL_UINT16(0, reply.crc16); // No window unless asked
+        for (uint16_t seq = 1; seq <= size / 128 + 1; seq++) {
+            xm.handlePacket(block(data, seq));
+            TEST_ASSERT_EQUAL(meshtastic_XModem_Control_ACK, take().control);
+        }
+        xm.handlePacket(control(meshtastic_XModem_Control_EOT));
+        take();
+        TEST_ASSERT_TRUE(readBack() == data);
+    }
+}
+
+void test_uploadWindowed()
+{
+    const uint8_t windows[] = {2, 4, XMODEM_MAX_WINDOW, XMODEM_MAX_WINDOW + 5};
+    for (size_t size : sizes) {
+        for (uint8_t window : windows) {
+            std::string data = makeData(size, size + window);
+            upload(data, window);
+            TEST_ASSERT_TRUE(readBack() == data);
+        }
+    }
+}
+
+void test_downloadClassic()
+{
+    for (size_t size : sizes) {
+        std::string data = makeData(size, size);
+        writeTestFile(data);
+        uint32_t sent;
+        TEST_ASSERT_TRUE(download(0, &sent) == data);
+    }
+}
+
+void test_downloadWindowed()
+{
+    const uint8_t windows[] = {2, 4, XMODEM_MAX_WINDOW};
+    for (size_t size : sizes) {
+        for (uint8_t window : windows) {
+            std::string data = makeData(size, size + window);
+            writeTestFile(data);
+            uint32_t sent;
+            TEST_ASSERT_TRUE(download(window, &sent) == data);
+            uint32_t blocks = size / 128 + 1;
+            TEST_ASSERT_TRUE(sent <= blocks + blocks / 5 + 2); // Only the lost blocks were sent again
+        }
+    }
+}
+
+// A shorter name after a longer one must not keep the longer one's tail
+void test_filenameTerminated()
+{
+    xm.handlePacket(control(meshtastic_XModem_Control_SOH, 0, 0, TEST_FILE ".longer"));
+    take();
+    xm.handlePacket(control(meshtastic_XModem_Control_CAN));
+    take();
+    upload("hello", 2);
+    TEST_ASSERT_TRUE(readBack() == "hello");
+}
+
+void setup()
+{
+    settingsMap[logoutputlevel] = level_warn;
+    initializeTestEnvironment();
+    initSPI();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_uploadClassic);
+    RUN_TEST(test_uploadWindowed);
+    RUN_TEST(test_downloadClassic);
+    RUN_TEST(test_downloadWindowed);
+    RUN_TEST(test_filenameTerminated);
+    int failures = UNITY_END();
+    FSCom.remove(TEST_FILE);
+    exit(failures);
+}
+#else
+void setup()
+{
+    initializeTestEnvironment();
+    LOG_WARN("This test only runs on ARCH_PORTDUINO");
+    UNITY_BEGIN();
+    UNITY_END();
+}
+#endif
+void loop() {}